@@ -0,0 +1,16 @@
+#ifndef BCACHE
+#define BCACHE
+
+// for `bcstat`
+struct bcstat {
+    uint nbuf;      // Buffers in the cache
+    uint nbucket;   // Hash buckets they are spread over
+    uint hits;      // Lookups that found the block cached
+    uint misses;    // Lookups that had to recycle a buffer
+    uint evictions; // Misses that threw out a cached block
+    uint rablocks;  // Blocks read ahead
+    uint diskintrs; // Disk commands completed
+    uint diskblocks; // Blocks those commands moved
+};
+
+#endif
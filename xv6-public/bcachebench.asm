@@ -0,0 +1,2133 @@
+
+_bcachebench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+         nprocs, rounds, elapsed, hits, misses);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+  struct bcstat st;
+  int nprocs, rounds, i;
+
+  nprocs = 4;
+  rounds = 200;
+   f:	be c8 00 00 00       	mov    $0xc8,%esi
+{
+  14:	53                   	push   %ebx
+  nprocs = 4;
+  15:	bb 04 00 00 00       	mov    $0x4,%ebx
+{
+  1a:	51                   	push   %ecx
+  1b:	83 ec 38             	sub    $0x38,%esp
+  1e:	8b 39                	mov    (%ecx),%edi
+  20:	8b 51 04             	mov    0x4(%ecx),%edx
+  if(argc > 1)
+  23:	83 ff 01             	cmp    $0x1,%edi
+  26:	0f 8f a1 00 00 00    	jg     cd <main+0xcd>
+  if(nprocs < 1 || nprocs > 26 || rounds < 1){
+    printf(2, "usage: bcachebench [procs [rounds]]\n");
+    exit();
+  }
+
+  bcstat(&st);
+  2c:	83 ec 0c             	sub    $0xc,%esp
+  2f:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  printf(1, "bcachebench: %d buffers in %d buckets\n", st.nbuf, st.nbucket);
+  for(i = 0; i < nprocs; i++)
+  32:	31 ff                	xor    %edi,%edi
+  bcstat(&st);
+  34:	50                   	push   %eax
+  35:	e8 0a 08 00 00       	call   844 <bcstat>
+  printf(1, "bcachebench: %d buffers in %d buckets\n", st.nbuf, st.nbucket);
+  3a:	ff 75 cc             	push   -0x34(%ebp)
+  3d:	ff 75 c8             	push   -0x38(%ebp)
+  40:	68 94 0e 00 00       	push   $0xe94
+  45:	6a 01                	push   $0x1
+  47:	e8 d4 08 00 00       	call   920 <printf>
+  4c:	83 c4 20             	add    $0x20,%esp
+  4f:	90                   	nop
+    mkfile(i);
+  50:	83 ec 0c             	sub    $0xc,%esp
+  53:	57                   	push   %edi
+  for(i = 0; i < nprocs; i++)
+  54:	83 c7 01             	add    $0x1,%edi
+    mkfile(i);
+  57:	e8 d4 00 00 00       	call   130 <mkfile>
+  for(i = 0; i < nprocs; i++)
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	39 df                	cmp    %ebx,%edi
+  61:	75 ed                	jne    50 <main+0x50>
+  run(1, rounds);
+  63:	50                   	push   %eax
+  64:	50                   	push   %eax
+  65:	56                   	push   %esi
+  66:	6a 01                	push   $0x1
+  68:	e8 03 02 00 00       	call   270 <run>
+  run(nprocs, rounds);
+  6d:	5a                   	pop    %edx
+  6e:	59                   	pop    %ecx
+  6f:	56                   	push   %esi
+  70:	57                   	push   %edi
+  bcstat(&st);
+  printf(1, "bcachebench: totals since boot: %d hits, %d misses, %d evictions\n",
+  71:	be 61 00 00 00       	mov    $0x61,%esi
+  run(nprocs, rounds);
+  76:	e8 f5 01 00 00       	call   270 <run>
+  bcstat(&st);
+  7b:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  7e:	89 04 24             	mov    %eax,(%esp)
+  81:	e8 be 07 00 00       	call   844 <bcstat>
+  printf(1, "bcachebench: totals since boot: %d hits, %d misses, %d evictions\n",
+  86:	5b                   	pop    %ebx
+  87:	ff 75 d8             	push   -0x28(%ebp)
+  8a:	8d 5f 61             	lea    0x61(%edi),%ebx
+  8d:	ff 75 d4             	push   -0x2c(%ebp)
+  90:	ff 75 d0             	push   -0x30(%ebp)
+  93:	68 bc 0e 00 00       	push   $0xebc
+  98:	6a 01                	push   $0x1
+  9a:	e8 81 08 00 00       	call   920 <printf>
+         st.hits, st.misses, st.evictions);
+  for(i = 0; i < nprocs; i++){
+  9f:	83 c4 20             	add    $0x20,%esp
+  a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[8] = 'a' + i;
+    unlink(name);
+  a8:	83 ec 0c             	sub    $0xc,%esp
+    name[8] = 'a' + i;
+  ab:	89 f0                	mov    %esi,%eax
+  for(i = 0; i < nprocs; i++){
+  ad:	83 c6 01             	add    $0x1,%esi
+    unlink(name);
+  b0:	68 b8 14 00 00       	push   $0x14b8
+    name[8] = 'a' + i;
+  b5:	a2 c0 14 00 00       	mov    %al,0x14c0
+    unlink(name);
+  ba:	e8 a5 06 00 00       	call   764 <unlink>
+  for(i = 0; i < nprocs; i++){
+  bf:	89 f0                	mov    %esi,%eax
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	38 d8                	cmp    %bl,%al
+  c6:	75 e0                	jne    a8 <main+0xa8>
+  }
+  exit();
+  c8:	e8 47 06 00 00       	call   714 <exit>
+    nprocs = atoi(argv[1]);
+  cd:	83 ec 0c             	sub    $0xc,%esp
+  d0:	ff 72 04             	push   0x4(%edx)
+  d3:	89 55 c4             	mov    %edx,-0x3c(%ebp)
+  d6:	e8 15 04 00 00       	call   4f0 <atoi>
+  if(argc > 2)
+  db:	83 c4 10             	add    $0x10,%esp
+  de:	83 ff 02             	cmp    $0x2,%edi
+  e1:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+    nprocs = atoi(argv[1]);
+  e4:	89 c3                	mov    %eax,%ebx
+  if(argc > 2)
+  e6:	75 20                	jne    108 <main+0x108>
+  if(nprocs < 1 || nprocs > 26 || rounds < 1){
+  e8:	8d 40 ff             	lea    -0x1(%eax),%eax
+  eb:	83 f8 19             	cmp    $0x19,%eax
+  ee:	0f 86 38 ff ff ff    	jbe    2c <main+0x2c>
+    printf(2, "usage: bcachebench [procs [rounds]]\n");
+  f4:	83 ec 08             	sub    $0x8,%esp
+  f7:	68 6c 0e 00 00       	push   $0xe6c
+  fc:	6a 02                	push   $0x2
+  fe:	e8 1d 08 00 00       	call   920 <printf>
+    exit();
+ 103:	e8 0c 06 00 00       	call   714 <exit>
+    rounds = atoi(argv[2]);
+ 108:	83 ec 0c             	sub    $0xc,%esp
+ 10b:	ff 72 08             	push   0x8(%edx)
+ 10e:	e8 dd 03 00 00       	call   4f0 <atoi>
+  if(nprocs < 1 || nprocs > 26 || rounds < 1){
+ 113:	83 c4 10             	add    $0x10,%esp
+    rounds = atoi(argv[2]);
+ 116:	89 c6                	mov    %eax,%esi
+  if(nprocs < 1 || nprocs > 26 || rounds < 1){
+ 118:	8d 43 ff             	lea    -0x1(%ebx),%eax
+ 11b:	83 f8 19             	cmp    $0x19,%eax
+ 11e:	77 d4                	ja     f4 <main+0xf4>
+ 120:	85 f6                	test   %esi,%esi
+ 122:	7e d0                	jle    f4 <main+0xf4>
+ 124:	e9 03 ff ff ff       	jmp    2c <main+0x2c>
+ 129:	66 90                	xchg   %ax,%ax
+ 12b:	66 90                	xchg   %ax,%ax
+ 12d:	66 90                	xchg   %ax,%ax
+ 12f:	90                   	nop
+
+00000130 <mkfile>:
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	56                   	push   %esi
+ 134:	53                   	push   %ebx
+  name[8] = 'a' + i;
+ 135:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+ 139:	83 c0 61             	add    $0x61,%eax
+  if((fd = open(name, O_CREATE | O_RDWR)) < 0){
+ 13c:	83 ec 08             	sub    $0x8,%esp
+  name[8] = 'a' + i;
+ 13f:	a2 c0 14 00 00       	mov    %al,0x14c0
+  if((fd = open(name, O_CREATE | O_RDWR)) < 0){
+ 144:	68 02 02 00 00       	push   $0x202
+ 149:	68 b8 14 00 00       	push   $0x14b8
+ 14e:	e8 01 06 00 00       	call   754 <open>
+ 153:	83 c4 10             	add    $0x10,%esp
+ 156:	85 c0                	test   %eax,%eax
+ 158:	78 57                	js     1b1 <mkfile+0x81>
+ 15a:	89 c6                	mov    %eax,%esi
+ 15c:	bb 20 00 00 00       	mov    $0x20,%ebx
+ 161:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+ 168:	83 ec 04             	sub    $0x4,%esp
+ 16b:	68 00 10 00 00       	push   $0x1000
+ 170:	68 e0 14 00 00       	push   $0x14e0
+ 175:	56                   	push   %esi
+ 176:	e8 b9 05 00 00       	call   734 <write>
+ 17b:	83 c4 10             	add    $0x10,%esp
+ 17e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+ 183:	75 13                	jne    198 <mkfile+0x68>
+  for(j = 0; j < NBLK; j++){
+ 185:	83 eb 01             	sub    $0x1,%ebx
+ 188:	75 de                	jne    168 <mkfile+0x38>
+  close(fd);
+ 18a:	89 75 08             	mov    %esi,0x8(%ebp)
+}
+ 18d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 190:	5b                   	pop    %ebx
+ 191:	5e                   	pop    %esi
+ 192:	5d                   	pop    %ebp
+  close(fd);
+ 193:	e9 a4 05 00 00       	jmp    73c <close>
+      printf(2, "bcachebench: write %s failed\n", name);
+ 198:	83 ec 04             	sub    $0x4,%esp
+ 19b:	68 b8 14 00 00       	push   $0x14b8
+ 1a0:	68 fe 0e 00 00       	push   $0xefe
+ 1a5:	6a 02                	push   $0x2
+ 1a7:	e8 74 07 00 00       	call   920 <printf>
+      exit();
+ 1ac:	e8 63 05 00 00       	call   714 <exit>
+    printf(2, "bcachebench: create %s failed\n", name);
+ 1b1:	50                   	push   %eax
+ 1b2:	68 b8 14 00 00       	push   $0x14b8
+ 1b7:	68 08 0e 00 00       	push   $0xe08
+ 1bc:	6a 02                	push   $0x2
+ 1be:	e8 5d 07 00 00       	call   920 <printf>
+    exit();
+ 1c3:	e8 4c 05 00 00       	call   714 <exit>
+ 1c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cf:	90                   	nop
+
+000001d0 <reader>:
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	56                   	push   %esi
+ 1d5:	53                   	push   %ebx
+ 1d6:	83 ec 0c             	sub    $0xc,%esp
+  name[8] = 'a' + i;
+ 1d9:	0f b6 45 08          	movzbl 0x8(%ebp),%eax
+{
+ 1dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  name[8] = 'a' + i;
+ 1e0:	83 c0 61             	add    $0x61,%eax
+ 1e3:	a2 c0 14 00 00       	mov    %al,0x14c0
+  for(r = 0; r < rounds; r++){
+ 1e8:	85 ff                	test   %edi,%edi
+ 1ea:	7e 54                	jle    240 <reader+0x70>
+ 1ec:	31 f6                	xor    %esi,%esi
+ 1ee:	66 90                	xchg   %ax,%ax
+    if((fd = open(name, O_RDONLY)) < 0){
+ 1f0:	83 ec 08             	sub    $0x8,%esp
+ 1f3:	6a 00                	push   $0x0
+ 1f5:	68 b8 14 00 00       	push   $0x14b8
+ 1fa:	e8 55 05 00 00       	call   754 <open>
+ 1ff:	83 c4 10             	add    $0x10,%esp
+ 202:	89 c3                	mov    %eax,%ebx
+ 204:	85 c0                	test   %eax,%eax
+ 206:	78 40                	js     248 <reader+0x78>
+ 208:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+    while(read(fd, buf, sizeof(buf)) == sizeof(buf))
+ 210:	83 ec 04             	sub    $0x4,%esp
+ 213:	68 00 10 00 00       	push   $0x1000
+ 218:	68 e0 14 00 00       	push   $0x14e0
+ 21d:	53                   	push   %ebx
+ 21e:	e8 09 05 00 00       	call   72c <read>
+ 223:	83 c4 10             	add    $0x10,%esp
+ 226:	3d 00 10 00 00       	cmp    $0x1000,%eax
+ 22b:	74 e3                	je     210 <reader+0x40>
+    close(fd);
+ 22d:	83 ec 0c             	sub    $0xc,%esp
+  for(r = 0; r < rounds; r++){
+ 230:	83 c6 01             	add    $0x1,%esi
+    close(fd);
+ 233:	53                   	push   %ebx
+ 234:	e8 03 05 00 00       	call   73c <close>
+  for(r = 0; r < rounds; r++){
+ 239:	83 c4 10             	add    $0x10,%esp
+ 23c:	39 f7                	cmp    %esi,%edi
+ 23e:	75 b0                	jne    1f0 <reader+0x20>
+}
+ 240:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 243:	5b                   	pop    %ebx
+ 244:	5e                   	pop    %esi
+ 245:	5f                   	pop    %edi
+ 246:	5d                   	pop    %ebp
+ 247:	c3                   	ret
+      printf(2, "bcachebench: open %s failed\n", name);
+ 248:	83 ec 04             	sub    $0x4,%esp
+ 24b:	68 b8 14 00 00       	push   $0x14b8
+ 250:	68 1c 0f 00 00       	push   $0xf1c
+ 255:	6a 02                	push   $0x2
+ 257:	e8 c4 06 00 00       	call   920 <printf>
+      exit();
+ 25c:	e8 b3 04 00 00       	call   714 <exit>
+ 261:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 268:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <run>:
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+  bcstat(&before);
+ 275:	8d 45 a8             	lea    -0x58(%ebp),%eax
+{
+ 278:	53                   	push   %ebx
+ 279:	83 ec 68             	sub    $0x68,%esp
+ 27c:	8b 75 08             	mov    0x8(%ebp),%esi
+  bcstat(&before);
+ 27f:	50                   	push   %eax
+ 280:	e8 bf 05 00 00       	call   844 <bcstat>
+  start = uptime();
+ 285:	e8 22 05 00 00       	call   7ac <uptime>
+  for(i = 0; i < nprocs; i++){
+ 28a:	83 c4 10             	add    $0x10,%esp
+  start = uptime();
+ 28d:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  for(i = 0; i < nprocs; i++){
+ 290:	85 f6                	test   %esi,%esi
+ 292:	7e 32                	jle    2c6 <run+0x56>
+ 294:	31 db                	xor    %ebx,%ebx
+ 296:	eb 0a                	jmp    2a2 <run+0x32>
+ 298:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+ 2a0:	89 c3                	mov    %eax,%ebx
+    if(fork() == 0){
+ 2a2:	e8 65 04 00 00       	call   70c <fork>
+ 2a7:	85 c0                	test   %eax,%eax
+ 2a9:	74 60                	je     30b <run+0x9b>
+  for(i = 0; i < nprocs; i++){
+ 2ab:	8d 43 01             	lea    0x1(%ebx),%eax
+ 2ae:	39 c6                	cmp    %eax,%esi
+ 2b0:	75 ee                	jne    2a0 <run+0x30>
+  for(i = 0; i < nprocs; i++)
+ 2b2:	31 ff                	xor    %edi,%edi
+ 2b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    wait();
+ 2b8:	e8 5f 04 00 00       	call   71c <wait>
+  for(i = 0; i < nprocs; i++)
+ 2bd:	89 f8                	mov    %edi,%eax
+ 2bf:	83 c7 01             	add    $0x1,%edi
+ 2c2:	39 c3                	cmp    %eax,%ebx
+ 2c4:	75 f2                	jne    2b8 <run+0x48>
+  elapsed = uptime() - start;
+ 2c6:	e8 e1 04 00 00       	call   7ac <uptime>
+ 2cb:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  bcstat(&after);
+ 2ce:	83 ec 0c             	sub    $0xc,%esp
+  elapsed = uptime() - start;
+ 2d1:	29 d0                	sub    %edx,%eax
+ 2d3:	89 c3                	mov    %eax,%ebx
+  bcstat(&after);
+ 2d5:	8d 45 c8             	lea    -0x38(%ebp),%eax
+ 2d8:	50                   	push   %eax
+ 2d9:	e8 66 05 00 00       	call   844 <bcstat>
+  misses = after.misses - before.misses;
+ 2de:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  printf(1, "bcachebench: %d readers x %d rounds: %d ticks, %d hits, %d misses\n",
+ 2e1:	83 c4 0c             	add    $0xc,%esp
+  misses = after.misses - before.misses;
+ 2e4:	2b 45 b4             	sub    -0x4c(%ebp),%eax
+  printf(1, "bcachebench: %d readers x %d rounds: %d ticks, %d hits, %d misses\n",
+ 2e7:	50                   	push   %eax
+  hits = after.hits - before.hits;
+ 2e8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 2eb:	2b 45 b0             	sub    -0x50(%ebp),%eax
+  printf(1, "bcachebench: %d readers x %d rounds: %d ticks, %d hits, %d misses\n",
+ 2ee:	50                   	push   %eax
+ 2ef:	53                   	push   %ebx
+ 2f0:	ff 75 0c             	push   0xc(%ebp)
+ 2f3:	56                   	push   %esi
+ 2f4:	68 28 0e 00 00       	push   $0xe28
+ 2f9:	6a 01                	push   $0x1
+ 2fb:	e8 20 06 00 00       	call   920 <printf>
+}
+ 300:	83 c4 20             	add    $0x20,%esp
+ 303:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 306:	5b                   	pop    %ebx
+ 307:	5e                   	pop    %esi
+ 308:	5f                   	pop    %edi
+ 309:	5d                   	pop    %ebp
+ 30a:	c3                   	ret
+      reader(i, rounds);
+ 30b:	83 ec 08             	sub    $0x8,%esp
+ 30e:	ff 75 0c             	push   0xc(%ebp)
+ 311:	53                   	push   %ebx
+ 312:	e8 b9 fe ff ff       	call   1d0 <reader>
+      exit();
+ 317:	e8 f8 03 00 00       	call   714 <exit>
+ 31c:	66 90                	xchg   %ax,%ax
+ 31e:	66 90                	xchg   %ax,%ax
+
+00000320 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 320:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 321:	31 c0                	xor    %eax,%eax
+{
+ 323:	89 e5                	mov    %esp,%ebp
+ 325:	53                   	push   %ebx
+ 326:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 329:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 330:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 334:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 337:	83 c0 01             	add    $0x1,%eax
+ 33a:	84 d2                	test   %dl,%dl
+ 33c:	75 f2                	jne    330 <strcpy+0x10>
+    ;
+  return os;
+}
+ 33e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 341:	89 c8                	mov    %ecx,%eax
+ 343:	c9                   	leave
+ 344:	c3                   	ret
+ 345:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+ 357:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 35a:	0f b6 02             	movzbl (%edx),%eax
+ 35d:	84 c0                	test   %al,%al
+ 35f:	75 17                	jne    378 <strcmp+0x28>
+ 361:	eb 3a                	jmp    39d <strcmp+0x4d>
+ 363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 367:	90                   	nop
+ 368:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 36c:	83 c2 01             	add    $0x1,%edx
+ 36f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 372:	84 c0                	test   %al,%al
+ 374:	74 1a                	je     390 <strcmp+0x40>
+    p++, q++;
+ 376:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 378:	0f b6 19             	movzbl (%ecx),%ebx
+ 37b:	38 c3                	cmp    %al,%bl
+ 37d:	74 e9                	je     368 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 37f:	29 d8                	sub    %ebx,%eax
+}
+ 381:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 384:	c9                   	leave
+ 385:	c3                   	ret
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 390:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 394:	31 c0                	xor    %eax,%eax
+ 396:	29 d8                	sub    %ebx,%eax
+}
+ 398:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 39b:	c9                   	leave
+ 39c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 39d:	0f b6 19             	movzbl (%ecx),%ebx
+ 3a0:	31 c0                	xor    %eax,%eax
+ 3a2:	eb db                	jmp    37f <strcmp+0x2f>
+ 3a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3af:	90                   	nop
+
+000003b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3b9:	74 15                	je     3d0 <strlen+0x20>
+ 3bb:	31 c0                	xor    %eax,%eax
+ 3bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3c0:	83 c0 01             	add    $0x1,%eax
+ 3c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3c7:	89 c1                	mov    %eax,%ecx
+ 3c9:	75 f5                	jne    3c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3cb:	89 c8                	mov    %ecx,%eax
+ 3cd:	5d                   	pop    %ebp
+ 3ce:	c3                   	ret
+ 3cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3d0:	31 c9                	xor    %ecx,%ecx
+}
+ 3d2:	5d                   	pop    %ebp
+ 3d3:	89 c8                	mov    %ecx,%eax
+ 3d5:	c3                   	ret
+ 3d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	57                   	push   %edi
+ 3e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 3e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 3ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ed:	89 d7                	mov    %edx,%edi
+ 3ef:	fc                   	cld
+ 3f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3f5:	89 d0                	mov    %edx,%eax
+ 3f7:	c9                   	leave
+ 3f8:	c3                   	ret
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	8b 45 08             	mov    0x8(%ebp),%eax
+ 406:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 40a:	0f b6 10             	movzbl (%eax),%edx
+ 40d:	84 d2                	test   %dl,%dl
+ 40f:	75 12                	jne    423 <strchr+0x23>
+ 411:	eb 1d                	jmp    430 <strchr+0x30>
+ 413:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 417:	90                   	nop
+ 418:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 41c:	83 c0 01             	add    $0x1,%eax
+ 41f:	84 d2                	test   %dl,%dl
+ 421:	74 0d                	je     430 <strchr+0x30>
+    if(*s == c)
+ 423:	38 d1                	cmp    %dl,%cl
+ 425:	75 f1                	jne    418 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 427:	5d                   	pop    %ebp
+ 428:	c3                   	ret
+ 429:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 430:	31 c0                	xor    %eax,%eax
+}
+ 432:	5d                   	pop    %ebp
+ 433:	c3                   	ret
+ 434:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 43f:	90                   	nop
+
+00000440 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	57                   	push   %edi
+ 444:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 445:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 448:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 449:	31 db                	xor    %ebx,%ebx
+{
+ 44b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 44e:	eb 27                	jmp    477 <gets+0x37>
+    cc = read(0, &c, 1);
+ 450:	83 ec 04             	sub    $0x4,%esp
+ 453:	6a 01                	push   $0x1
+ 455:	56                   	push   %esi
+ 456:	6a 00                	push   $0x0
+ 458:	e8 cf 02 00 00       	call   72c <read>
+    if(cc < 1)
+ 45d:	83 c4 10             	add    $0x10,%esp
+ 460:	85 c0                	test   %eax,%eax
+ 462:	7e 1d                	jle    481 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 464:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 468:	8b 55 08             	mov    0x8(%ebp),%edx
+ 46b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 46f:	3c 0a                	cmp    $0xa,%al
+ 471:	74 10                	je     483 <gets+0x43>
+ 473:	3c 0d                	cmp    $0xd,%al
+ 475:	74 0c                	je     483 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 477:	89 df                	mov    %ebx,%edi
+ 479:	83 c3 01             	add    $0x1,%ebx
+ 47c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 47f:	7c cf                	jl     450 <gets+0x10>
+ 481:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 48a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 48d:	5b                   	pop    %ebx
+ 48e:	5e                   	pop    %esi
+ 48f:	5f                   	pop    %edi
+ 490:	5d                   	pop    %ebp
+ 491:	c3                   	ret
+ 492:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 499:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	56                   	push   %esi
+ 4a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4a5:	83 ec 08             	sub    $0x8,%esp
+ 4a8:	6a 00                	push   $0x0
+ 4aa:	ff 75 08             	push   0x8(%ebp)
+ 4ad:	e8 a2 02 00 00       	call   754 <open>
+  if(fd < 0)
+ 4b2:	83 c4 10             	add    $0x10,%esp
+ 4b5:	85 c0                	test   %eax,%eax
+ 4b7:	78 27                	js     4e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4b9:	83 ec 08             	sub    $0x8,%esp
+ 4bc:	ff 75 0c             	push   0xc(%ebp)
+ 4bf:	89 c3                	mov    %eax,%ebx
+ 4c1:	50                   	push   %eax
+ 4c2:	e8 a5 02 00 00       	call   76c <fstat>
+  close(fd);
+ 4c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4cc:	e8 6b 02 00 00       	call   73c <close>
+  return r;
+ 4d1:	83 c4 10             	add    $0x10,%esp
+}
+ 4d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4d7:	89 f0                	mov    %esi,%eax
+ 4d9:	5b                   	pop    %ebx
+ 4da:	5e                   	pop    %esi
+ 4db:	5d                   	pop    %ebp
+ 4dc:	c3                   	ret
+ 4dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 4e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 4e5:	eb ed                	jmp    4d4 <stat+0x34>
+ 4e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	89 e5                	mov    %esp,%ebp
+ 4f3:	53                   	push   %ebx
+ 4f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4f7:	0f be 02             	movsbl (%edx),%eax
+ 4fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 500:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 505:	77 1e                	ja     525 <atoi+0x35>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 510:	83 c2 01             	add    $0x1,%edx
+ 513:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 516:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 51a:	0f be 02             	movsbl (%edx),%eax
+ 51d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 520:	80 fb 09             	cmp    $0x9,%bl
+ 523:	76 eb                	jbe    510 <atoi+0x20>
+  return n;
+}
+ 525:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 528:	89 c8                	mov    %ecx,%eax
+ 52a:	c9                   	leave
+ 52b:	c3                   	ret
+ 52c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000530 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	57                   	push   %edi
+ 534:	56                   	push   %esi
+ 535:	8b 45 10             	mov    0x10(%ebp),%eax
+ 538:	8b 55 08             	mov    0x8(%ebp),%edx
+ 53b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 53e:	85 c0                	test   %eax,%eax
+ 540:	7e 13                	jle    555 <memmove+0x25>
+ 542:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 544:	89 d7                	mov    %edx,%edi
+ 546:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 550:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 551:	39 f8                	cmp    %edi,%eax
+ 553:	75 fb                	jne    550 <memmove+0x20>
+  return vdst;
+}
+ 555:	5e                   	pop    %esi
+ 556:	89 d0                	mov    %edx,%eax
+ 558:	5f                   	pop    %edi
+ 559:	5d                   	pop    %ebp
+ 55a:	c3                   	ret
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+
+00000560 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 56c:	5d                   	pop    %ebp
+ 56d:	c3                   	ret
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 570:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 571:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 576:	89 e5                	mov    %esp,%ebp
+ 578:	8b 55 08             	mov    0x8(%ebp),%edx
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+ 580:	89 c8                	mov    %ecx,%eax
+ 582:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 585:	85 c0                	test   %eax,%eax
+ 587:	75 f7                	jne    580 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 589:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 58e:	5d                   	pop    %ebp
+ 58f:	c3                   	ret
+
+00000590 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 590:	55                   	push   %ebp
+ 591:	31 c0                	xor    %eax,%eax
+ 593:	89 e5                	mov    %esp,%ebp
+ 595:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 598:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 59d:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 5a0:	5d                   	pop    %ebp
+ 5a1:	c3                   	ret
+ 5a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5bc:	5d                   	pop    %ebp
+ 5bd:	c3                   	ret
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5c6:	89 e5                	mov    %esp,%ebp
+ 5c8:	56                   	push   %esi
+ 5c9:	53                   	push   %ebx
+ 5ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 5cd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 5d0:	85 c0                	test   %eax,%eax
+ 5d2:	74 2d                	je     601 <mutex_lock+0x41>
+ 5d4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5d9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 5dc:	85 c0                	test   %eax,%eax
+ 5de:	74 21                	je     601 <mutex_lock+0x41>
+ 5e0:	be 02 00 00 00       	mov    $0x2,%esi
+ 5e5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 5e8:	83 ec 04             	sub    $0x4,%esp
+ 5eb:	6a 02                	push   $0x2
+ 5ed:	6a 00                	push   $0x0
+ 5ef:	53                   	push   %ebx
+ 5f0:	e8 37 02 00 00       	call   82c <futex>
+ 5f5:	89 f0                	mov    %esi,%eax
+ 5f7:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 5fa:	83 c4 10             	add    $0x10,%esp
+ 5fd:	85 c0                	test   %eax,%eax
+ 5ff:	75 e7                	jne    5e8 <mutex_lock+0x28>
+}
+ 601:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 604:	5b                   	pop    %ebx
+ 605:	5e                   	pop    %esi
+ 606:	5d                   	pop    %ebp
+ 607:	c3                   	ret
+ 608:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 60f:	90                   	nop
+
+00000610 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 610:	55                   	push   %ebp
+ 611:	31 c0                	xor    %eax,%eax
+ 613:	89 e5                	mov    %esp,%ebp
+ 615:	83 ec 08             	sub    $0x8,%esp
+ 618:	8b 55 08             	mov    0x8(%ebp),%edx
+ 61b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 61e:	83 f8 02             	cmp    $0x2,%eax
+ 621:	74 05                	je     628 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 623:	c9                   	leave
+ 624:	c3                   	ret
+ 625:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 628:	83 ec 04             	sub    $0x4,%esp
+ 62b:	6a 01                	push   $0x1
+ 62d:	6a 01                	push   $0x1
+ 62f:	52                   	push   %edx
+ 630:	e8 f7 01 00 00       	call   82c <futex>
+ 635:	83 c4 10             	add    $0x10,%esp
+}
+ 638:	c9                   	leave
+ 639:	c3                   	ret
+ 63a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000640 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 643:	8b 45 08             	mov    0x8(%ebp),%eax
+ 646:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 64c:	5d                   	pop    %ebp
+ 64d:	c3                   	ret
+ 64e:	66 90                	xchg   %ax,%ax
+
+00000650 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 650:	55                   	push   %ebp
+ 651:	31 c0                	xor    %eax,%eax
+ 653:	89 e5                	mov    %esp,%ebp
+ 655:	57                   	push   %edi
+ 656:	56                   	push   %esi
+ 657:	53                   	push   %ebx
+ 658:	83 ec 0c             	sub    $0xc,%esp
+ 65b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 65e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 661:	8b 3e                	mov    (%esi),%edi
+ 663:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 666:	83 f8 02             	cmp    $0x2,%eax
+ 669:	74 4d                	je     6b8 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 66b:	83 ec 04             	sub    $0x4,%esp
+ 66e:	57                   	push   %edi
+ 66f:	6a 00                	push   $0x0
+ 671:	56                   	push   %esi
+ 672:	e8 b5 01 00 00       	call   82c <futex>
+ 677:	b8 02 00 00 00       	mov    $0x2,%eax
+ 67c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 67f:	83 c4 10             	add    $0x10,%esp
+ 682:	85 c0                	test   %eax,%eax
+ 684:	74 23                	je     6a9 <cond_wait+0x59>
+ 686:	be 02 00 00 00       	mov    $0x2,%esi
+ 68b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 690:	83 ec 04             	sub    $0x4,%esp
+ 693:	6a 02                	push   $0x2
+ 695:	6a 00                	push   $0x0
+ 697:	53                   	push   %ebx
+ 698:	e8 8f 01 00 00       	call   82c <futex>
+ 69d:	89 f0                	mov    %esi,%eax
+ 69f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 6a2:	83 c4 10             	add    $0x10,%esp
+ 6a5:	85 c0                	test   %eax,%eax
+ 6a7:	75 e7                	jne    690 <cond_wait+0x40>
+}
+ 6a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ac:	5b                   	pop    %ebx
+ 6ad:	5e                   	pop    %esi
+ 6ae:	5f                   	pop    %edi
+ 6af:	5d                   	pop    %ebp
+ 6b0:	c3                   	ret
+ 6b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 6b8:	83 ec 04             	sub    $0x4,%esp
+ 6bb:	6a 01                	push   $0x1
+ 6bd:	6a 01                	push   $0x1
+ 6bf:	53                   	push   %ebx
+ 6c0:	e8 67 01 00 00       	call   82c <futex>
+ 6c5:	83 c4 10             	add    $0x10,%esp
+ 6c8:	eb a1                	jmp    66b <cond_wait+0x1b>
+ 6ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006d0 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	89 e5                	mov    %esp,%ebp
+ 6d3:	83 ec 0c             	sub    $0xc,%esp
+ 6d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 6d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 6dd:	6a 01                	push   $0x1
+ 6df:	6a 01                	push   $0x1
+ 6e1:	50                   	push   %eax
+ 6e2:	e8 45 01 00 00       	call   82c <futex>
+}
+ 6e7:	83 c4 10             	add    $0x10,%esp
+ 6ea:	c9                   	leave
+ 6eb:	c3                   	ret
+ 6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006f0 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 6f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 6fd:	6a ff                	push   $0xffffffff
+ 6ff:	6a 01                	push   $0x1
+ 701:	50                   	push   %eax
+ 702:	e8 25 01 00 00       	call   82c <futex>
+}
+ 707:	83 c4 10             	add    $0x10,%esp
+ 70a:	c9                   	leave
+ 70b:	c3                   	ret
+
+0000070c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 70c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <exit>:
+SYSCALL(exit)
+ 714:	b8 02 00 00 00       	mov    $0x2,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <wait>:
+SYSCALL(wait)
+ 71c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <pipe>:
+SYSCALL(pipe)
+ 724:	b8 04 00 00 00       	mov    $0x4,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <read>:
+SYSCALL(read)
+ 72c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <write>:
+SYSCALL(write)
+ 734:	b8 10 00 00 00       	mov    $0x10,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <close>:
+SYSCALL(close)
+ 73c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <kill>:
+SYSCALL(kill)
+ 744:	b8 06 00 00 00       	mov    $0x6,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <exec>:
+SYSCALL(exec)
+ 74c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <open>:
+SYSCALL(open)
+ 754:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <mknod>:
+SYSCALL(mknod)
+ 75c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <unlink>:
+SYSCALL(unlink)
+ 764:	b8 12 00 00 00       	mov    $0x12,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <fstat>:
+SYSCALL(fstat)
+ 76c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 771:	cd 40                	int    $0x40
+ 773:	c3                   	ret
+
+00000774 <link>:
+SYSCALL(link)
+ 774:	b8 13 00 00 00       	mov    $0x13,%eax
+ 779:	cd 40                	int    $0x40
+ 77b:	c3                   	ret
+
+0000077c <mkdir>:
+SYSCALL(mkdir)
+ 77c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 781:	cd 40                	int    $0x40
+ 783:	c3                   	ret
+
+00000784 <chdir>:
+SYSCALL(chdir)
+ 784:	b8 09 00 00 00       	mov    $0x9,%eax
+ 789:	cd 40                	int    $0x40
+ 78b:	c3                   	ret
+
+0000078c <dup>:
+SYSCALL(dup)
+ 78c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 791:	cd 40                	int    $0x40
+ 793:	c3                   	ret
+
+00000794 <getpid>:
+SYSCALL(getpid)
+ 794:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <sbrk>:
+SYSCALL(sbrk)
+ 79c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7a1:	cd 40                	int    $0x40
+ 7a3:	c3                   	ret
+
+000007a4 <sleep>:
+SYSCALL(sleep)
+ 7a4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7a9:	cd 40                	int    $0x40
+ 7ab:	c3                   	ret
+
+000007ac <uptime>:
+SYSCALL(uptime)
+ 7ac:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7b1:	cd 40                	int    $0x40
+ 7b3:	c3                   	ret
+
+000007b4 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 7b4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7b9:	cd 40                	int    $0x40
+ 7bb:	c3                   	ret
+
+000007bc <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 7bc:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7c1:	cd 40                	int    $0x40
+ 7c3:	c3                   	ret
+
+000007c4 <wmap>:
+SYSCALL(wmap)
+ 7c4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7c9:	cd 40                	int    $0x40
+ 7cb:	c3                   	ret
+
+000007cc <wunmap>:
+SYSCALL(wunmap)
+ 7cc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7d1:	cd 40                	int    $0x40
+ 7d3:	c3                   	ret
+
+000007d4 <wremap>:
+SYSCALL(wremap)
+ 7d4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7d9:	cd 40                	int    $0x40
+ 7db:	c3                   	ret
+
+000007dc <wmlock>:
+SYSCALL(wmlock)
+ 7dc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7e1:	cd 40                	int    $0x40
+ 7e3:	c3                   	ret
+
+000007e4 <wmunlock>:
+SYSCALL(wmunlock)
+ 7e4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7e9:	cd 40                	int    $0x40
+ 7eb:	c3                   	ret
+
+000007ec <wmapoff>:
+SYSCALL(wmapoff)
+ 7ec:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7f1:	cd 40                	int    $0x40
+ 7f3:	c3                   	ret
+
+000007f4 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 7f4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7f9:	cd 40                	int    $0x40
+ 7fb:	c3                   	ret
+
+000007fc <setpriority>:
+SYSCALL(setpriority)
+ 7fc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 801:	cd 40                	int    $0x40
+ 803:	c3                   	ret
+
+00000804 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 804:	b8 20 00 00 00       	mov    $0x20,%eax
+ 809:	cd 40                	int    $0x40
+ 80b:	c3                   	ret
+
+0000080c <settickets>:
+SYSCALL(settickets)
+ 80c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 811:	cd 40                	int    $0x40
+ 813:	c3                   	ret
+
+00000814 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 814:	b8 22 00 00 00       	mov    $0x22,%eax
+ 819:	cd 40                	int    $0x40
+ 81b:	c3                   	ret
+
+0000081c <clone>:
+SYSCALL(clone)
+ 81c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 821:	cd 40                	int    $0x40
+ 823:	c3                   	ret
+
+00000824 <join>:
+SYSCALL(join)
+ 824:	b8 24 00 00 00       	mov    $0x24,%eax
+ 829:	cd 40                	int    $0x40
+ 82b:	c3                   	ret
+
+0000082c <futex>:
+SYSCALL(futex)
+ 82c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 831:	cd 40                	int    $0x40
+ 833:	c3                   	ret
+
+00000834 <setaffinity>:
+SYSCALL(setaffinity)
+ 834:	b8 26 00 00 00       	mov    $0x26,%eax
+ 839:	cd 40                	int    $0x40
+ 83b:	c3                   	ret
+
+0000083c <getaffinity>:
+SYSCALL(getaffinity)
+ 83c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 841:	cd 40                	int    $0x40
+ 843:	c3                   	ret
+
+00000844 <bcstat>:
+SYSCALL(bcstat)
+ 844:	b8 29 00 00 00       	mov    $0x29,%eax
+ 849:	cd 40                	int    $0x40
+ 84b:	c3                   	ret
+
+0000084c <dropcache>:
+SYSCALL(dropcache)
+ 84c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 851:	cd 40                	int    $0x40
+ 853:	c3                   	ret
+
+00000854 <setiosched>:
+SYSCALL(setiosched)
+ 854:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 859:	cd 40                	int    $0x40
+ 85b:	c3                   	ret
+
+0000085c <iostat>:
+SYSCALL(iostat)
+ 85c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 861:	cd 40                	int    $0x40
+ 863:	c3                   	ret
+
+00000864 <fsync>:
+SYSCALL(fsync)
+ 864:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 869:	cd 40                	int    $0x40
+ 86b:	c3                   	ret
+
+0000086c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 86c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 86d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 872:	cd 40                	int    $0x40
+ 874:	ff e1                	jmp    *%ecx
+ 876:	66 90                	xchg   %ax,%ax
+ 878:	66 90                	xchg   %ax,%ax
+ 87a:	66 90                	xchg   %ax,%ax
+ 87c:	66 90                	xchg   %ax,%ax
+ 87e:	66 90                	xchg   %ax,%ax
+
+00000880 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 888:	89 d1                	mov    %edx,%ecx
+{
+ 88a:	83 ec 3c             	sub    $0x3c,%esp
+ 88d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 890:	85 d2                	test   %edx,%edx
+ 892:	0f 89 80 00 00 00    	jns    918 <printint+0x98>
+ 898:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 89c:	74 7a                	je     918 <printint+0x98>
+    x = -xx;
+ 89e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8a8:	31 f6                	xor    %esi,%esi
+ 8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8b0:	89 c8                	mov    %ecx,%eax
+ 8b2:	31 d2                	xor    %edx,%edx
+ 8b4:	89 f7                	mov    %esi,%edi
+ 8b6:	f7 f3                	div    %ebx
+ 8b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8bb:	0f b6 92 98 0f 00 00 	movzbl 0xf98(%edx),%edx
+ 8c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8c6:	89 ca                	mov    %ecx,%edx
+ 8c8:	89 c1                	mov    %eax,%ecx
+ 8ca:	39 da                	cmp    %ebx,%edx
+ 8cc:	73 e2                	jae    8b0 <printint+0x30>
+  if(neg)
+ 8ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8d1:	85 c0                	test   %eax,%eax
+ 8d3:	74 07                	je     8dc <printint+0x5c>
+    buf[i++] = '-';
+ 8d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8da:	89 f7                	mov    %esi,%edi
+ 8dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 8e2:	01 df                	add    %ebx,%edi
+ 8e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 8e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 8eb:	83 ec 04             	sub    $0x4,%esp
+ 8ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8f4:	6a 01                	push   $0x1
+ 8f6:	50                   	push   %eax
+ 8f7:	56                   	push   %esi
+ 8f8:	e8 37 fe ff ff       	call   734 <write>
+  while(--i >= 0)
+ 8fd:	89 f8                	mov    %edi,%eax
+ 8ff:	83 c4 10             	add    $0x10,%esp
+ 902:	83 ef 01             	sub    $0x1,%edi
+ 905:	39 d8                	cmp    %ebx,%eax
+ 907:	75 df                	jne    8e8 <printint+0x68>
+}
+ 909:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 90c:	5b                   	pop    %ebx
+ 90d:	5e                   	pop    %esi
+ 90e:	5f                   	pop    %edi
+ 90f:	5d                   	pop    %ebp
+ 910:	c3                   	ret
+ 911:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 918:	31 c0                	xor    %eax,%eax
+ 91a:	eb 89                	jmp    8a5 <printint+0x25>
+ 91c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000920 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 920:	55                   	push   %ebp
+ 921:	89 e5                	mov    %esp,%ebp
+ 923:	57                   	push   %edi
+ 924:	56                   	push   %esi
+ 925:	53                   	push   %ebx
+ 926:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 929:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 92c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 92f:	0f b6 1e             	movzbl (%esi),%ebx
+ 932:	83 c6 01             	add    $0x1,%esi
+ 935:	84 db                	test   %bl,%bl
+ 937:	74 67                	je     9a0 <printf+0x80>
+ 939:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 93c:	31 d2                	xor    %edx,%edx
+ 93e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 941:	eb 34                	jmp    977 <printf+0x57>
+ 943:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 947:	90                   	nop
+ 948:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 94b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 950:	83 f8 25             	cmp    $0x25,%eax
+ 953:	74 18                	je     96d <printf+0x4d>
+  write(fd, &c, 1);
+ 955:	83 ec 04             	sub    $0x4,%esp
+ 958:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 95b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 95e:	6a 01                	push   $0x1
+ 960:	50                   	push   %eax
+ 961:	57                   	push   %edi
+ 962:	e8 cd fd ff ff       	call   734 <write>
+ 967:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 96a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 96d:	0f b6 1e             	movzbl (%esi),%ebx
+ 970:	83 c6 01             	add    $0x1,%esi
+ 973:	84 db                	test   %bl,%bl
+ 975:	74 29                	je     9a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 977:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 97a:	85 d2                	test   %edx,%edx
+ 97c:	74 ca                	je     948 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 97e:	83 fa 25             	cmp    $0x25,%edx
+ 981:	75 ea                	jne    96d <printf+0x4d>
+      if(c == 'd'){
+ 983:	83 f8 25             	cmp    $0x25,%eax
+ 986:	0f 84 24 01 00 00    	je     ab0 <printf+0x190>
+ 98c:	83 e8 63             	sub    $0x63,%eax
+ 98f:	83 f8 15             	cmp    $0x15,%eax
+ 992:	77 1c                	ja     9b0 <printf+0x90>
+ 994:	ff 24 85 40 0f 00 00 	jmp    *0xf40(,%eax,4)
+ 99b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9a3:	5b                   	pop    %ebx
+ 9a4:	5e                   	pop    %esi
+ 9a5:	5f                   	pop    %edi
+ 9a6:	5d                   	pop    %ebp
+ 9a7:	c3                   	ret
+ 9a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9af:	90                   	nop
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9ba:	6a 01                	push   $0x1
+ 9bc:	52                   	push   %edx
+ 9bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9c0:	57                   	push   %edi
+ 9c1:	e8 6e fd ff ff       	call   734 <write>
+ 9c6:	83 c4 0c             	add    $0xc,%esp
+ 9c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9cc:	6a 01                	push   $0x1
+ 9ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9d1:	52                   	push   %edx
+ 9d2:	57                   	push   %edi
+ 9d3:	e8 5c fd ff ff       	call   734 <write>
+        putc(fd, c);
+ 9d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9db:	31 d2                	xor    %edx,%edx
+ 9dd:	eb 8e                	jmp    96d <printf+0x4d>
+ 9df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 9e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9e3:	83 ec 0c             	sub    $0xc,%esp
+ 9e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 9eb:	8b 13                	mov    (%ebx),%edx
+ 9ed:	6a 00                	push   $0x0
+ 9ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9f4:	e8 87 fe ff ff       	call   880 <printint>
+        ap++;
+ 9f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9ff:	31 d2                	xor    %edx,%edx
+ a01:	e9 67 ff ff ff       	jmp    96d <printf+0x4d>
+ a06:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a10:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a13:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a15:	83 c0 04             	add    $0x4,%eax
+ a18:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a1b:	85 db                	test   %ebx,%ebx
+ a1d:	0f 84 9d 00 00 00    	je     ac0 <printf+0x1a0>
+        while(*s != 0){
+ a23:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a26:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a28:	84 c0                	test   %al,%al
+ a2a:	0f 84 3d ff ff ff    	je     96d <printf+0x4d>
+ a30:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a33:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a36:	89 de                	mov    %ebx,%esi
+ a38:	89 d3                	mov    %edx,%ebx
+ a3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a40:	83 ec 04             	sub    $0x4,%esp
+ a43:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a46:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a49:	6a 01                	push   $0x1
+ a4b:	53                   	push   %ebx
+ a4c:	57                   	push   %edi
+ a4d:	e8 e2 fc ff ff       	call   734 <write>
+        while(*s != 0){
+ a52:	0f b6 06             	movzbl (%esi),%eax
+ a55:	83 c4 10             	add    $0x10,%esp
+ a58:	84 c0                	test   %al,%al
+ a5a:	75 e4                	jne    a40 <printf+0x120>
+      state = 0;
+ a5c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a5f:	31 d2                	xor    %edx,%edx
+ a61:	e9 07 ff ff ff       	jmp    96d <printf+0x4d>
+ a66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a6d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a70:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a73:	83 ec 0c             	sub    $0xc,%esp
+ a76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a7b:	8b 13                	mov    (%ebx),%edx
+ a7d:	6a 01                	push   $0x1
+ a7f:	e9 6b ff ff ff       	jmp    9ef <printf+0xcf>
+ a84:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a88:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a8b:	83 ec 04             	sub    $0x4,%esp
+ a8e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a91:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a93:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a96:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a99:	6a 01                	push   $0x1
+ a9b:	52                   	push   %edx
+ a9c:	57                   	push   %edi
+ a9d:	e8 92 fc ff ff       	call   734 <write>
+        ap++;
+ aa2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ aa5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aa8:	31 d2                	xor    %edx,%edx
+ aaa:	e9 be fe ff ff       	jmp    96d <printf+0x4d>
+ aaf:	90                   	nop
+  write(fd, &c, 1);
+ ab0:	83 ec 04             	sub    $0x4,%esp
+ ab3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ab6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab9:	6a 01                	push   $0x1
+ abb:	e9 11 ff ff ff       	jmp    9d1 <printf+0xb1>
+ ac0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ac5:	bb 39 0f 00 00       	mov    $0xf39,%ebx
+ aca:	e9 61 ff ff ff       	jmp    a30 <printf+0x110>
+ acf:	90                   	nop
+
+00000ad0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ad0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ad1:	a1 e0 24 00 00       	mov    0x24e0,%eax
+{
+ ad6:	89 e5                	mov    %esp,%ebp
+ ad8:	57                   	push   %edi
+ ad9:	56                   	push   %esi
+ ada:	53                   	push   %ebx
+ adb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ ade:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ae1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ae8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aec:	39 ca                	cmp    %ecx,%edx
+ aee:	73 30                	jae    b20 <free+0x50>
+ af0:	39 c1                	cmp    %eax,%ecx
+ af2:	72 04                	jb     af8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ af4:	39 c2                	cmp    %eax,%edx
+ af6:	72 f0                	jb     ae8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ af8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ afb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ afe:	39 f8                	cmp    %edi,%eax
+ b00:	74 2e                	je     b30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b05:	8b 42 04             	mov    0x4(%edx),%eax
+ b08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b0b:	39 f1                	cmp    %esi,%ecx
+ b0d:	74 38                	je     b47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b11:	5b                   	pop    %ebx
+  freep = p;
+ b12:	89 15 e0 24 00 00    	mov    %edx,0x24e0
+}
+ b18:	5e                   	pop    %esi
+ b19:	5f                   	pop    %edi
+ b1a:	5d                   	pop    %ebp
+ b1b:	c3                   	ret
+ b1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b20:	39 c1                	cmp    %eax,%ecx
+ b22:	72 d0                	jb     af4 <free+0x24>
+ b24:	eb c2                	jmp    ae8 <free+0x18>
+ b26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b30:	03 70 04             	add    0x4(%eax),%esi
+ b33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b36:	8b 02                	mov    (%edx),%eax
+ b38:	8b 00                	mov    (%eax),%eax
+ b3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b3d:	8b 42 04             	mov    0x4(%edx),%eax
+ b40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b43:	39 f1                	cmp    %esi,%ecx
+ b45:	75 c8                	jne    b0f <free+0x3f>
+    p->s.size += bp->s.size;
+ b47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b4a:	89 15 e0 24 00 00    	mov    %edx,0x24e0
+    p->s.size += bp->s.size;
+ b50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b56:	89 0a                	mov    %ecx,(%edx)
+}
+ b58:	5b                   	pop    %ebx
+ b59:	5e                   	pop    %esi
+ b5a:	5f                   	pop    %edi
+ b5b:	5d                   	pop    %ebp
+ b5c:	c3                   	ret
+ b5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b60:	55                   	push   %ebp
+ b61:	89 e5                	mov    %esp,%ebp
+ b63:	57                   	push   %edi
+ b64:	56                   	push   %esi
+ b65:	53                   	push   %ebx
+ b66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b6c:	8b 15 e0 24 00 00    	mov    0x24e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b72:	8d 78 07             	lea    0x7(%eax),%edi
+ b75:	c1 ef 03             	shr    $0x3,%edi
+ b78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b7b:	85 d2                	test   %edx,%edx
+ b7d:	0f 84 8d 00 00 00    	je     c10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b85:	8b 48 04             	mov    0x4(%eax),%ecx
+ b88:	39 f9                	cmp    %edi,%ecx
+ b8a:	73 64                	jae    bf0 <malloc+0x90>
+  if(nu < 4096)
+ b8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b91:	39 df                	cmp    %ebx,%edi
+ b93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b9d:	eb 0a                	jmp    ba9 <malloc+0x49>
+ b9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ba0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ba2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ba5:	39 f9                	cmp    %edi,%ecx
+ ba7:	73 47                	jae    bf0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ba9:	89 c2                	mov    %eax,%edx
+ bab:	39 05 e0 24 00 00    	cmp    %eax,0x24e0
+ bb1:	75 ed                	jne    ba0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ bb3:	83 ec 0c             	sub    $0xc,%esp
+ bb6:	56                   	push   %esi
+ bb7:	e8 e0 fb ff ff       	call   79c <sbrk>
+  if(p == (char*)-1)
+ bbc:	83 c4 10             	add    $0x10,%esp
+ bbf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ bc2:	74 1c                	je     be0 <malloc+0x80>
+  hp->s.size = nu;
+ bc4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ bc7:	83 ec 0c             	sub    $0xc,%esp
+ bca:	83 c0 08             	add    $0x8,%eax
+ bcd:	50                   	push   %eax
+ bce:	e8 fd fe ff ff       	call   ad0 <free>
+  return freep;
+ bd3:	8b 15 e0 24 00 00    	mov    0x24e0,%edx
+      if((p = morecore(nunits)) == 0)
+ bd9:	83 c4 10             	add    $0x10,%esp
+ bdc:	85 d2                	test   %edx,%edx
+ bde:	75 c0                	jne    ba0 <malloc+0x40>
+        return 0;
+  }
+}
+ be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ be3:	31 c0                	xor    %eax,%eax
+}
+ be5:	5b                   	pop    %ebx
+ be6:	5e                   	pop    %esi
+ be7:	5f                   	pop    %edi
+ be8:	5d                   	pop    %ebp
+ be9:	c3                   	ret
+ bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ bf0:	39 cf                	cmp    %ecx,%edi
+ bf2:	74 4c                	je     c40 <malloc+0xe0>
+        p->s.size -= nunits;
+ bf4:	29 f9                	sub    %edi,%ecx
+ bf6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ bf9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bfc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ bff:	89 15 e0 24 00 00    	mov    %edx,0x24e0
+}
+ c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c08:	83 c0 08             	add    $0x8,%eax
+}
+ c0b:	5b                   	pop    %ebx
+ c0c:	5e                   	pop    %esi
+ c0d:	5f                   	pop    %edi
+ c0e:	5d                   	pop    %ebp
+ c0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c10:	c7 05 e0 24 00 00 e4 	movl   $0x24e4,0x24e0
+ c17:	24 00 00 
+    base.s.size = 0;
+ c1a:	b8 e4 24 00 00       	mov    $0x24e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ c1f:	c7 05 e4 24 00 00 e4 	movl   $0x24e4,0x24e4
+ c26:	24 00 00 
+    base.s.size = 0;
+ c29:	c7 05 e8 24 00 00 00 	movl   $0x0,0x24e8
+ c30:	00 00 00 
+    if(p->s.size >= nunits){
+ c33:	e9 54 ff ff ff       	jmp    b8c <malloc+0x2c>
+ c38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c40:	8b 08                	mov    (%eax),%ecx
+ c42:	89 0a                	mov    %ecx,(%edx)
+ c44:	eb b9                	jmp    bff <malloc+0x9f>
+ c46:	66 90                	xchg   %ax,%ax
+ c48:	66 90                	xchg   %ax,%ax
+ c4a:	66 90                	xchg   %ax,%ax
+ c4c:	66 90                	xchg   %ax,%ax
+ c4e:	66 90                	xchg   %ax,%ax
+
+00000c50 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ c50:	55                   	push   %ebp
+ c51:	89 e5                	mov    %esp,%ebp
+ c53:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ c56:	8b 45 08             	mov    0x8(%ebp),%eax
+ c59:	c1 e0 04             	shl    $0x4,%eax
+ c5c:	ff b0 2c 25 00 00    	push   0x252c(%eax)
+ c62:	05 20 25 00 00       	add    $0x2520,%eax
+ c67:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ c6a:	e8 a5 fa ff ff       	call   714 <exit>
+ c6f:	90                   	nop
+
+00000c70 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ c70:	55                   	push   %ebp
+ c71:	89 e5                	mov    %esp,%ebp
+ c73:	57                   	push   %edi
+ c74:	56                   	push   %esi
+ c75:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ c76:	31 db                	xor    %ebx,%ebx
+{
+ c78:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ c7b:	68 00 25 00 00       	push   $0x2500
+ c80:	e8 eb f8 ff ff       	call   570 <lock_acquire>
+ c85:	83 c4 10             	add    $0x10,%esp
+ c88:	eb 12                	jmp    c9c <thread_create+0x2c>
+ c8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ c90:	83 c3 01             	add    $0x1,%ebx
+ c93:	83 fb 40             	cmp    $0x40,%ebx
+ c96:	0f 84 c4 00 00 00    	je     d60 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ c9c:	89 de                	mov    %ebx,%esi
+ c9e:	c1 e6 04             	shl    $0x4,%esi
+ ca1:	8b 96 20 25 00 00    	mov    0x2520(%esi),%edx
+ ca7:	85 d2                	test   %edx,%edx
+ ca9:	75 e5                	jne    c90 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ cab:	83 ec 0c             	sub    $0xc,%esp
+ cae:	68 00 20 00 00       	push   $0x2000
+ cb3:	e8 a8 fe ff ff       	call   b60 <malloc>
+ cb8:	83 c4 10             	add    $0x10,%esp
+ cbb:	85 c0                	test   %eax,%eax
+ cbd:	0f 84 9d 00 00 00    	je     d60 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ cc3:	89 86 24 25 00 00    	mov    %eax,0x2524(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ cc9:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ cce:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ cd1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ cd6:	89 86 20 25 00 00    	mov    %eax,0x2520(%esi)
+  threads[i].fn = fn;
+ cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+ cdf:	89 86 28 25 00 00    	mov    %eax,0x2528(%esi)
+  threads[i].arg = arg;
+ ce5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ce8:	89 86 2c 25 00 00    	mov    %eax,0x252c(%esi)
+  lock_release(&threadslock);
+ cee:	68 00 25 00 00       	push   $0x2500
+ cf3:	e8 98 f8 ff ff       	call   590 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ cf8:	83 c4 0c             	add    $0xc,%esp
+ cfb:	ff b6 20 25 00 00    	push   0x2520(%esi)
+ d01:	53                   	push   %ebx
+ d02:	68 50 0c 00 00       	push   $0xc50
+ d07:	e8 10 fb ff ff       	call   81c <clone>
+ d0c:	83 c4 10             	add    $0x10,%esp
+ d0f:	85 c0                	test   %eax,%eax
+ d11:	78 0d                	js     d20 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ d13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d16:	5b                   	pop    %ebx
+ d17:	5e                   	pop    %esi
+ d18:	5f                   	pop    %edi
+ d19:	5d                   	pop    %ebp
+ d1a:	c3                   	ret
+ d1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d1f:	90                   	nop
+    lock_acquire(&threadslock);
+ d20:	83 ec 0c             	sub    $0xc,%esp
+ d23:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ d26:	68 00 25 00 00       	push   $0x2500
+ d2b:	e8 40 f8 ff ff       	call   570 <lock_acquire>
+    free(threads[i].block);
+ d30:	58                   	pop    %eax
+ d31:	ff b6 24 25 00 00    	push   0x2524(%esi)
+ d37:	e8 94 fd ff ff       	call   ad0 <free>
+    threads[i].stack = 0;
+ d3c:	c7 86 20 25 00 00 00 	movl   $0x0,0x2520(%esi)
+ d43:	00 00 00 
+    lock_release(&threadslock);
+ d46:	c7 04 24 00 25 00 00 	movl   $0x2500,(%esp)
+ d4d:	e8 3e f8 ff ff       	call   590 <lock_release>
+ d52:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d55:	83 c4 10             	add    $0x10,%esp
+}
+ d58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d5b:	5b                   	pop    %ebx
+ d5c:	5e                   	pop    %esi
+ d5d:	5f                   	pop    %edi
+ d5e:	5d                   	pop    %ebp
+ d5f:	c3                   	ret
+    lock_release(&threadslock);
+ d60:	83 ec 0c             	sub    $0xc,%esp
+ d63:	68 00 25 00 00       	push   $0x2500
+ d68:	e8 23 f8 ff ff       	call   590 <lock_release>
+    return -1;
+ d6d:	83 c4 10             	add    $0x10,%esp
+ d70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d75:	eb 9c                	jmp    d13 <thread_create+0xa3>
+ d77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d7e:	66 90                	xchg   %ax,%ax
+
+00000d80 <thread_join>:
+
+int
+thread_join(void)
+{
+ d80:	55                   	push   %ebp
+ d81:	89 e5                	mov    %esp,%ebp
+ d83:	56                   	push   %esi
+ d84:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ d85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ d88:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ d8b:	50                   	push   %eax
+ d8c:	e8 93 fa ff ff       	call   824 <join>
+ d91:	83 c4 10             	add    $0x10,%esp
+ d94:	85 c0                	test   %eax,%eax
+ d96:	78 69                	js     e01 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ d98:	83 ec 0c             	sub    $0xc,%esp
+ d9b:	89 c6                	mov    %eax,%esi
+ d9d:	68 00 25 00 00       	push   $0x2500
+ da2:	e8 c9 f7 ff ff       	call   570 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ da7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ daa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ dad:	31 c0                	xor    %eax,%eax
+ daf:	eb 0f                	jmp    dc0 <thread_join+0x40>
+ db1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ db8:	83 c0 01             	add    $0x1,%eax
+ dbb:	83 f8 40             	cmp    $0x40,%eax
+ dbe:	74 28                	je     de8 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ dc0:	89 c3                	mov    %eax,%ebx
+ dc2:	c1 e3 04             	shl    $0x4,%ebx
+ dc5:	39 93 20 25 00 00    	cmp    %edx,0x2520(%ebx)
+ dcb:	75 eb                	jne    db8 <thread_join+0x38>
+      free(threads[i].block);
+ dcd:	83 ec 0c             	sub    $0xc,%esp
+ dd0:	ff b3 24 25 00 00    	push   0x2524(%ebx)
+ dd6:	e8 f5 fc ff ff       	call   ad0 <free>
+      threads[i].stack = 0;
+      break;
+ ddb:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ dde:	c7 83 20 25 00 00 00 	movl   $0x0,0x2520(%ebx)
+ de5:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ de8:	83 ec 0c             	sub    $0xc,%esp
+ deb:	68 00 25 00 00       	push   $0x2500
+ df0:	e8 9b f7 ff ff       	call   590 <lock_release>
+  return pid;
+ df5:	83 c4 10             	add    $0x10,%esp
+}
+ df8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ dfb:	89 f0                	mov    %esi,%eax
+ dfd:	5b                   	pop    %ebx
+ dfe:	5e                   	pop    %esi
+ dff:	5d                   	pop    %ebp
+ e00:	c3                   	ret
+    return -1;
+ e01:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ e06:	eb f0                	jmp    df8 <thread_join+0x78>
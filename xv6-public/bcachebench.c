@@ -0,0 +1,114 @@
+// Buffer cache benchmark.
+// Each of n processes reads its own small file over and over, so
+// every read is a bread that should hit in the cache; the lookups
+// of different processes land in different hash buckets and should
+// not contend.  Runs once with a single reader and once with n, and
+// prints the time taken and the cache's hits and misses for each;
+// compare under make qemu CPUS=1 and CPUS=4.
+//
+// usage: bcachebench [procs [rounds]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+
+#define NBLK 32  // blocks in each reader's file
+
+char buf[BSIZE];
+char name[] = "bcbench.a";
+
+void
+mkfile(int i)
+{
+  int fd, j;
+
+  name[8] = 'a' + i;
+  if((fd = open(name, O_CREATE | O_RDWR)) < 0){
+    printf(2, "bcachebench: create %s failed\n", name);
+    exit();
+  }
+  for(j = 0; j < NBLK; j++){
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(2, "bcachebench: write %s failed\n", name);
+      exit();
+    }
+  }
+  close(fd);
+}
+
+void
+reader(int i, int rounds)
+{
+  int fd, r;
+
+  name[8] = 'a' + i;
+  for(r = 0; r < rounds; r++){
+    if((fd = open(name, O_RDONLY)) < 0){
+      printf(2, "bcachebench: open %s failed\n", name);
+      exit();
+    }
+    while(read(fd, buf, sizeof(buf)) == sizeof(buf))
+      ;
+    close(fd);
+  }
+}
+
+void
+run(int nprocs, int rounds)
+{
+  struct bcstat before, after;
+  int i, start, elapsed;
+  uint hits, misses;
+
+  bcstat(&before);
+  start = uptime();
+  for(i = 0; i < nprocs; i++){
+    if(fork() == 0){
+      reader(i, rounds);
+      exit();
+    }
+  }
+  for(i = 0; i < nprocs; i++)
+    wait();
+  elapsed = uptime() - start;
+  bcstat(&after);
+  hits = after.hits - before.hits;
+  misses = after.misses - before.misses;
+  printf(1, "bcachebench: %d readers x %d rounds: %d ticks, %d hits, %d misses\n",
+         nprocs, rounds, elapsed, hits, misses);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct bcstat st;
+  int nprocs, rounds, i;
+
+  nprocs = 4;
+  rounds = 200;
+  if(argc > 1)
+    nprocs = atoi(argv[1]);
+  if(argc > 2)
+    rounds = atoi(argv[2]);
+  if(nprocs < 1 || nprocs > 26 || rounds < 1){
+    printf(2, "usage: bcachebench [procs [rounds]]\n");
+    exit();
+  }
+
+  bcstat(&st);
+  printf(1, "bcachebench: %d buffers in %d buckets\n", st.nbuf, st.nbucket);
+  for(i = 0; i < nprocs; i++)
+    mkfile(i);
+  run(1, rounds);
+  run(nprocs, rounds);
+  bcstat(&st);
+  printf(1, "bcachebench: totals since boot: %d hits, %d misses, %d evictions\n",
+         st.hits, st.misses, st.evictions);
+  for(i = 0; i < nprocs; i++){
+    name[8] = 'a' + i;
+    unlink(name);
+  }
+  exit();
+}
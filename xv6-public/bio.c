@@ -1,6 +1,6 @@
 // Buffer cache.
 //
-// The buffer cache is a linked list of buf structures holding
+// The buffer cache is a hash table of buf structures holding
 // cached copies of disk block contents.  Caching disk blocks
 // in memory reduces the number of disk reads and also provides
 // a synchronization point for disk blocks used by multiple processes.
@@ -17,79 +17,237 @@
 // * B_VALID: the buffer data has been read from the disk.
 // * B_DIRTY: the buffer data has been modified
 //     and needs to be written to disk.
+//
+// Each buffer holding a block sits in the bucket that (dev, blockno)
+// hashes to, and each bucket has its own lock, so lookups of
+// different blocks rarely contend.  A miss recycles a buffer chosen by a clock hand
+// sweeping a ring of all buffers: a buffer looked up since the hand
+// last passed gets a second chance.  Misses are serialized by
+// bcache.lock, which is the only time two bucket locks are held.
+//
+// breada also starts reads of blocks the caller expects to want
+// soon.  Those buffers are marked B_ASYNC and stay locked until the
+// disk finishes with them, when the driver calls bdone to unlock
+// them for whoever bread()s them next.
 
 #include "types.h"
 #include "defs.h"
 #include "param.h"
+#include "mmu.h"
 #include "spinlock.h"
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "bcache.h"
 
-struct {
+#define NBUCKET 1021
+#define BUCKET(dev, blockno) (((dev)*31 + (blockno)) % NBUCKET)
+#define NODEV ((uint)-1)  // dev of a buffer holding no block, in no bucket
+#define NWRITEV 64        // bufs bwritev hands the driver at a time
+
+struct bucket {
   struct spinlock lock;
-  struct buf buf[NBUF];
+  struct buf *head;
+  uint hits;
+  uint misses;
+  uint rablocks;
+};
 
-  // Linked list of all buffers, through prev/next.
-  // head.next is most recently used.
-  struct buf head;
+struct {
+  struct spinlock lock;  // serializes misses
+  struct bucket bucket[NBUCKET];
+  struct buf *hand;      // clock hand, in the ring through cnext
+  uint nbuf;
+  uint evictions;
 } bcache;
 
+// Size the cache at BCACHEPCT percent of free memory, but no
+// smaller than NBUF buffers.  Must come after kinit2.
 void
 binit(void)
 {
-  struct buf *b;
+  struct buf *b, *last;
+  struct bucket *bk;
+  char *data;
+  int per, nbuf, i;
 
   initlock(&bcache.lock, "bcache");
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++)
+    initlock(&bk->lock, "bcache.bucket");
 
 //PAGEBREAK!
-  // Create linked list of buffers
-  bcache.head.prev = &bcache.head;
-  bcache.head.next = &bcache.head;
-  for(b = bcache.buf; b < bcache.buf+NBUF; b++){
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
+  // Carve buf structs and, separately, their data out of whole
+  // pages, and link the bufs into the clock ring.
+  per = PGSIZE / sizeof(struct buf);
+  nbuf = kfreepages() * BCACHEPCT / 100 * PGSIZE / (BSIZE + sizeof(struct buf));
+  if(nbuf < NBUF)
+    nbuf = NBUF;
+  b = last = 0;
+  data = 0;
+  for(i = 0; i < nbuf; i++){
+    if(i % per == 0){
+      if((b = (struct buf*)kalloc()) == 0)
+        break;
+      memset(b, 0, PGSIZE);
+    }
+    if(i % (PGSIZE / BSIZE) == 0 && (data = kalloc()) == 0)
+      break;
+    b->data = (uchar*)data + i % (PGSIZE / BSIZE) * BSIZE;
     initsleeplock(&b->lock, "buffer");
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+    b->dev = NODEV;
+    if(last)
+      last->cnext = b;
+    else
+      bcache.hand = b;
+    last = b++;
+    bcache.nbuf++;
   }
+  if(bcache.nbuf < NBUF)
+    panic("binit");
+  last->cnext = bcache.hand;
+  cprintf("bcache: %d buffers in %d buckets\n", bcache.nbuf, NBUCKET);
+}
+
+// Return b, which is in bk and whose bucket lock is held,
+// locked and referenced.
+static struct buf*
+bhit(struct bucket *bk, struct buf *b)
+{
+  b->refcnt++;
+  b->used = 1;
+  bk->hits++;
+  release(&bk->lock);
+  acquiresleep(&b->lock);
+  return b;
+}
+
+// Advance the clock hand to a buffer that can be recycled and
+// remove it from its bucket, or return 0 if there is none.  The
+// caller holds bcache.lock and the lock of bucket h.
+static struct buf*
+bevict(int h)
+{
+  struct buf *b, **pp;
+  struct bucket *bk;
+  int i, bh;
+
+  for(i = 0; i < 2*bcache.nbuf; i++){
+    b = bcache.hand;
+    bcache.hand = b->cnext;
+    if(b->dev == NODEV)
+      return b;
+    bh = BUCKET(b->dev, b->blockno);
+    bk = &bcache.bucket[bh];
+    if(bh != h)
+      acquire(&bk->lock);
+    // Even if refcnt==0, B_DIRTY indicates a buffer is in use
+    // because log.c has modified it but not yet committed it.
+    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+      if(b->used)
+        b->used = 0;
+      else {
+        for(pp = &bk->head; *pp != b; pp = &(*pp)->hnext)
+          ;
+        *pp = b->hnext;
+        if(b->flags & B_VALID)
+          bcache.evictions++;
+        if(bh != h)
+          release(&bk->lock);
+        return b;
+      }
+    }
+    if(bh != h)
+      release(&bk->lock);
+  }
+  return 0;
 }
 
 // Look through buffer cache for block on device dev.
 // If not found, allocate a buffer.
 // In either case, return locked buffer.
+// To read ahead, return a locked B_ASYNC buffer only if the block
+// is not cached and a buffer is free, and 0 otherwise.
 static struct buf*
-bget(uint dev, uint blockno)
+bget(uint dev, uint blockno, int ahead)
 {
   struct buf *b;
+  struct bucket *bk;
+  int h;
 
-  acquire(&bcache.lock);
+  h = BUCKET(dev, blockno);
+  bk = &bcache.bucket[h];
 
   // Is the block already cached?
-  for(b = bcache.head.next; b != &bcache.head; b = b->next){
+  acquire(&bk->lock);
+  for(b = bk->head; b; b = b->hnext){
     if(b->dev == dev && b->blockno == blockno){
-      b->refcnt++;
-      release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+      if(ahead){
+        release(&bk->lock);
+        return 0;
+      }
+      return bhit(bk, b);
     }
   }
+  release(&bk->lock);
 
-  // Not cached; recycle an unused buffer.
-  // Even if refcnt==0, B_DIRTY indicates a buffer is in use
-  // because log.c has modified it but not yet committed it.
-  for(b = bcache.head.prev; b != &bcache.head; b = b->prev){
-    if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0) {
-      b->dev = dev;
-      b->blockno = blockno;
-      b->flags = 0;
-      b->refcnt = 1;
+  // Not cached; recycle an unused buffer.  Look again once misses
+  // are serialized, in case another miss on this block got here
+  // first.
+  acquire(&bcache.lock);
+  acquire(&bk->lock);
+  for(b = bk->head; b; b = b->hnext){
+    if(b->dev == dev && b->blockno == blockno){
       release(&bcache.lock);
-      acquiresleep(&b->lock);
-      return b;
+      if(ahead){
+        release(&bk->lock);
+        return 0;
+      }
+      return bhit(bk, b);
     }
   }
-  panic("bget: no buffers");
+  if((b = bevict(h)) == 0){
+    if(!ahead)
+      panic("bget: no buffers");
+    release(&bk->lock);
+    release(&bcache.lock);
+    return 0;
+  }
+  b->dev = dev;
+  b->blockno = blockno;
+  b->flags = ahead ? B_ASYNC : 0;
+  b->refcnt = 1;
+  b->used = 1;
+  b->hnext = bk->head;
+  bk->head = b;
+  if(ahead)
+    bk->rablocks++;
+  else
+    bk->misses++;
+  release(&bk->lock);
+  release(&bcache.lock);
+  acquiresleep(&b->lock);
+  return b;
+}
+
+// Send b and the async bufs to whichever disk driver is in use.
+static void
+brw(struct buf *b, struct buf **async, int n)
+{
+  if(virtioblk)
+    virtiorwv(b, async, n);
+  else
+    iderwv(b, async, n);
+}
+
+// Wait for the disk driver to finish with b, which was handed to
+// it without B_ASYNC and without waiting.
+static void
+bwait(struct buf *b)
+{
+  if(virtioblk)
+    virtiorwait(b);
+  else
+    iderwait(b);
 }
 
 // Return a locked buf with the contents of the indicated block.
@@ -98,13 +256,34 @@ bread(uint dev, uint blockno)
 {
   struct buf *b;
 
-  b = bget(dev, blockno);
+  b = bget(dev, blockno, 0);
   if((b->flags & B_VALID) == 0) {
-    iderw(b);
+    brw(b, 0, 0);
   }
   return b;
 }
 
+// Like bread, but also start reading the n blocks in ra that are
+// not cached, without waiting for them.  Runs of consecutive
+// blocks go to the disk as single requests.
+struct buf*
+breada(uint dev, uint blockno, uint *ra, int n)
+{
+  struct buf *b, *async[n];
+  int i, nasync;
+
+  b = bget(dev, blockno, 0);
+  nasync = 0;
+  for(i = 0; i < n; i++)
+    if((async[nasync] = bget(dev, ra[i], 1)) != 0)
+      nasync++;
+  if((b->flags & B_VALID) == 0)
+    brw(b, async, nasync);
+  else
+    brw(0, async, nasync);
+  return b;
+}
+
 // Write b's contents to disk.  Must be locked.
 void
 bwrite(struct buf *b)
@@ -112,33 +291,124 @@ bwrite(struct buf *b)
   if(!holdingsleep(&b->lock))
     panic("bwrite");
   b->flags |= B_DIRTY;
-  iderw(b);
+  brw(b, 0, 0);
+}
+
+// Return a locked buf for the indicated block without reading
+// it, for a caller that is going to overwrite all of its data.
+struct buf*
+bnew(uint dev, uint blockno)
+{
+  struct buf *b;
+
+  b = bget(dev, blockno, 0);
+  b->flags |= B_VALID;
+  return b;
+}
+
+// Write the contents of the n locked bufs in bs to disk and wait
+// for all of them.  They go to the driver together, so that runs
+// of consecutive blocks become single requests.
+void
+bwritev(struct buf **bs, int n)
+{
+  int i, m;
+
+  for(i = 0; i < n; i++){
+    if(!holdingsleep(&bs[i]->lock))
+      panic("bwritev");
+    bs[i]->flags |= B_DIRTY;
+  }
+  for(i = 0; i < n; i += m){
+    m = n - i < NWRITEV ? n - i : NWRITEV;
+    brw(0, bs + i, m);
+  }
+  for(i = 0; i < n; i++)
+    bwait(bs[i]);
 }
 
 // Release a locked buffer.
-// Move to the head of the MRU list.
+// The clock hand can recycle it once nobody holds a reference.
 void
 brelse(struct buf *b)
 {
+  struct bucket *bk;
+
   if(!holdingsleep(&b->lock))
     panic("brelse");
 
   releasesleep(&b->lock);
 
-  acquire(&bcache.lock);
+  bk = &bcache.bucket[BUCKET(b->dev, b->blockno)];
+  acquire(&bk->lock);
+  b->refcnt--;
+  release(&bk->lock);
+}
+
+// Release a B_ASYNC buffer once the disk is done with it.
+// Called by the disk driver, maybe from an interrupt.
+void
+bdone(struct buf *b)
+{
+  struct bucket *bk;
+
+  b->flags &= ~B_ASYNC;
+  releasesleep(&b->lock);
+
+  bk = &bcache.bucket[BUCKET(b->dev, b->blockno)];
+  acquire(&bk->lock);
   b->refcnt--;
-  if (b->refcnt == 0) {
-    // no one is waiting for it.
-    b->next->prev = b->prev;
-    b->prev->next = b->next;
-    b->next = bcache.head.next;
-    b->prev = &bcache.head;
-    bcache.head.next->prev = b;
-    bcache.head.next = b;
+  release(&bk->lock);
+}
+
+// Forget the contents of every clean buffer nobody is using, so
+// that their blocks are read from disk again.
+void
+bdrop(void)
+{
+  struct bucket *bk;
+  struct buf *b, **pp;
+
+  acquire(&bcache.lock);
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+    acquire(&bk->lock);
+    for(pp = &bk->head; (b = *pp) != 0; ){
+      if(b->refcnt == 0 && (b->flags & B_DIRTY) == 0){
+        *pp = b->hnext;
+        b->dev = NODEV;
+        b->flags = 0;
+        b->used = 0;
+      } else
+        pp = &b->hnext;
+    }
+    release(&bk->lock);
+  }
+  release(&bcache.lock);
+}
+
+// Report the cache's size and hit and miss counts so far.
+void
+bcstat(struct bcstat *st)
+{
+  struct bucket *bk;
+
+  st->nbuf = bcache.nbuf;
+  st->nbucket = NBUCKET;
+  st->hits = st->misses = st->rablocks = 0;
+  for(bk = bcache.bucket; bk < bcache.bucket+NBUCKET; bk++){
+    acquire(&bk->lock);
+    st->hits += bk->hits;
+    st->misses += bk->misses;
+    st->rablocks += bk->rablocks;
+    release(&bk->lock);
   }
-  
+  acquire(&bcache.lock);
+  st->evictions = bcache.evictions;
   release(&bcache.lock);
+  if(virtioblk)
+    virtiostat(st);
+  else
+    idestat(st);
 }
 //PAGEBREAK!
 // Blank page.
-
@@ -4,11 +4,14 @@ struct buf {
   uint blockno;
   struct sleeplock lock;
   uint refcnt;
-  struct buf *prev; // LRU cache list
-  struct buf *next;
+  uint used;         // looked up since the clock hand last passed
+  struct buf *hnext; // hash bucket chain
+  struct buf *cnext; // clock ring of all buffers
   struct buf *qnext; // disk queue
-  uchar data[BSIZE];
+  uint qtime;        // when it joined the disk queue, in microseconds
+  uchar *data;       // BSIZE bytes, never crossing a page
 };
 #define B_VALID 0x2  // buffer has been read from disk
 #define B_DIRTY 0x4  // buffer needs to be written to disk
+#define B_ASYNC 0x8  // read ahead; released by bdone, not brelse
 
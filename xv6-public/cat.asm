@@ -0,0 +1,1880 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 26                	jg     4f <main+0x4f>
+  29:	eb 52                	jmp    7d <main+0x7d>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "cat: cannot open %s\n", argv[i]);
+      exit();
+    }
+    cat(fd);
+  30:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 1; i < argc; i++){
+  33:	83 c6 01             	add    $0x1,%esi
+  36:	83 c3 04             	add    $0x4,%ebx
+    cat(fd);
+  39:	50                   	push   %eax
+  3a:	e8 51 00 00 00       	call   90 <cat>
+    close(fd);
+  3f:	89 3c 24             	mov    %edi,(%esp)
+  42:	e8 e5 04 00 00       	call   52c <close>
+  for(i = 1; i < argc; i++){
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4d:	74 29                	je     78 <main+0x78>
+    if((fd = open(argv[i], 0)) < 0){
+  4f:	83 ec 08             	sub    $0x8,%esp
+  52:	6a 00                	push   $0x0
+  54:	ff 33                	push   (%ebx)
+  56:	e8 e9 04 00 00       	call   544 <open>
+  5b:	83 c4 10             	add    $0x10,%esp
+  5e:	89 c7                	mov    %eax,%edi
+  60:	85 c0                	test   %eax,%eax
+  62:	79 cc                	jns    30 <main+0x30>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  64:	50                   	push   %eax
+  65:	ff 33                	push   (%ebx)
+  67:	68 1b 0c 00 00       	push   $0xc1b
+  6c:	6a 01                	push   $0x1
+  6e:	e8 9d 06 00 00       	call   710 <printf>
+      exit();
+  73:	e8 8c 04 00 00       	call   504 <exit>
+  }
+  exit();
+  78:	e8 87 04 00 00       	call   504 <exit>
+    cat(0);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	6a 00                	push   $0x0
+  82:	e8 09 00 00 00       	call   90 <cat>
+    exit();
+  87:	e8 78 04 00 00       	call   504 <exit>
+  8c:	66 90                	xchg   %ax,%ax
+  8e:	66 90                	xchg   %ax,%ax
+
+00000090 <cat>:
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	56                   	push   %esi
+  94:	53                   	push   %ebx
+  95:	8b 75 08             	mov    0x8(%ebp),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  98:	eb 1d                	jmp    b7 <cat+0x27>
+  9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if (write(1, buf, n) != n) {
+  a0:	83 ec 04             	sub    $0x4,%esp
+  a3:	53                   	push   %ebx
+  a4:	68 60 11 00 00       	push   $0x1160
+  a9:	6a 01                	push   $0x1
+  ab:	e8 74 04 00 00       	call   524 <write>
+  b0:	83 c4 10             	add    $0x10,%esp
+  b3:	39 d8                	cmp    %ebx,%eax
+  b5:	75 25                	jne    dc <cat+0x4c>
+  while((n = read(fd, buf, sizeof(buf))) > 0) {
+  b7:	83 ec 04             	sub    $0x4,%esp
+  ba:	68 00 02 00 00       	push   $0x200
+  bf:	68 60 11 00 00       	push   $0x1160
+  c4:	56                   	push   %esi
+  c5:	e8 52 04 00 00       	call   51c <read>
+  ca:	83 c4 10             	add    $0x10,%esp
+  cd:	89 c3                	mov    %eax,%ebx
+  cf:	85 c0                	test   %eax,%eax
+  d1:	7f cd                	jg     a0 <cat+0x10>
+  if(n < 0){
+  d3:	75 1b                	jne    f0 <cat+0x60>
+}
+  d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  d8:	5b                   	pop    %ebx
+  d9:	5e                   	pop    %esi
+  da:	5d                   	pop    %ebp
+  db:	c3                   	ret
+      printf(1, "cat: write error\n");
+  dc:	83 ec 08             	sub    $0x8,%esp
+  df:	68 f8 0b 00 00       	push   $0xbf8
+  e4:	6a 01                	push   $0x1
+  e6:	e8 25 06 00 00       	call   710 <printf>
+      exit();
+  eb:	e8 14 04 00 00       	call   504 <exit>
+    printf(1, "cat: read error\n");
+  f0:	50                   	push   %eax
+  f1:	50                   	push   %eax
+  f2:	68 0a 0c 00 00       	push   $0xc0a
+  f7:	6a 01                	push   $0x1
+  f9:	e8 12 06 00 00       	call   710 <printf>
+    exit();
+  fe:	e8 01 04 00 00       	call   504 <exit>
+ 103:	66 90                	xchg   %ax,%ax
+ 105:	66 90                	xchg   %ax,%ax
+ 107:	66 90                	xchg   %ax,%ax
+ 109:	66 90                	xchg   %ax,%ax
+ 10b:	66 90                	xchg   %ax,%ax
+ 10d:	66 90                	xchg   %ax,%ax
+ 10f:	90                   	nop
+
+00000110 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 110:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 111:	31 c0                	xor    %eax,%eax
+{
+ 113:	89 e5                	mov    %esp,%ebp
+ 115:	53                   	push   %ebx
+ 116:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 119:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 120:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 124:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 127:	83 c0 01             	add    $0x1,%eax
+ 12a:	84 d2                	test   %dl,%dl
+ 12c:	75 f2                	jne    120 <strcpy+0x10>
+    ;
+  return os;
+}
+ 12e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 131:	89 c8                	mov    %ecx,%eax
+ 133:	c9                   	leave
+ 134:	c3                   	ret
+ 135:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	53                   	push   %ebx
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+ 147:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 14a:	0f b6 02             	movzbl (%edx),%eax
+ 14d:	84 c0                	test   %al,%al
+ 14f:	75 17                	jne    168 <strcmp+0x28>
+ 151:	eb 3a                	jmp    18d <strcmp+0x4d>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 15c:	83 c2 01             	add    $0x1,%edx
+ 15f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 162:	84 c0                	test   %al,%al
+ 164:	74 1a                	je     180 <strcmp+0x40>
+    p++, q++;
+ 166:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 168:	0f b6 19             	movzbl (%ecx),%ebx
+ 16b:	38 c3                	cmp    %al,%bl
+ 16d:	74 e9                	je     158 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 16f:	29 d8                	sub    %ebx,%eax
+}
+ 171:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 174:	c9                   	leave
+ 175:	c3                   	ret
+ 176:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 180:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 184:	31 c0                	xor    %eax,%eax
+ 186:	29 d8                	sub    %ebx,%eax
+}
+ 188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 18d:	0f b6 19             	movzbl (%ecx),%ebx
+ 190:	31 c0                	xor    %eax,%eax
+ 192:	eb db                	jmp    16f <strcmp+0x2f>
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 1a6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 1a9:	74 15                	je     1c0 <strlen+0x20>
+ 1ab:	31 c0                	xor    %eax,%eax
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+ 1b0:	83 c0 01             	add    $0x1,%eax
+ 1b3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 1b7:	89 c1                	mov    %eax,%ecx
+ 1b9:	75 f5                	jne    1b0 <strlen+0x10>
+    ;
+  return n;
+}
+ 1bb:	89 c8                	mov    %ecx,%eax
+ 1bd:	5d                   	pop    %ebp
+ 1be:	c3                   	ret
+ 1bf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1c0:	31 c9                	xor    %ecx,%ecx
+}
+ 1c2:	5d                   	pop    %ebp
+ 1c3:	89 c8                	mov    %ecx,%eax
+ 1c5:	c3                   	ret
+ 1c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1cd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001d0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1d7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1da:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dd:	89 d7                	mov    %edx,%edi
+ 1df:	fc                   	cld
+ 1e0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1e2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1e5:	89 d0                	mov    %edx,%eax
+ 1e7:	c9                   	leave
+ 1e8:	c3                   	ret
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1fa:	0f b6 10             	movzbl (%eax),%edx
+ 1fd:	84 d2                	test   %dl,%dl
+ 1ff:	75 12                	jne    213 <strchr+0x23>
+ 201:	eb 1d                	jmp    220 <strchr+0x30>
+ 203:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 207:	90                   	nop
+ 208:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 20c:	83 c0 01             	add    $0x1,%eax
+ 20f:	84 d2                	test   %dl,%dl
+ 211:	74 0d                	je     220 <strchr+0x30>
+    if(*s == c)
+ 213:	38 d1                	cmp    %dl,%cl
+ 215:	75 f1                	jne    208 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 217:	5d                   	pop    %ebp
+ 218:	c3                   	ret
+ 219:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 220:	31 c0                	xor    %eax,%eax
+}
+ 222:	5d                   	pop    %ebp
+ 223:	c3                   	ret
+ 224:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 22f:	90                   	nop
+
+00000230 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	57                   	push   %edi
+ 234:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 235:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 238:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 239:	31 db                	xor    %ebx,%ebx
+{
+ 23b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 23e:	eb 27                	jmp    267 <gets+0x37>
+    cc = read(0, &c, 1);
+ 240:	83 ec 04             	sub    $0x4,%esp
+ 243:	6a 01                	push   $0x1
+ 245:	56                   	push   %esi
+ 246:	6a 00                	push   $0x0
+ 248:	e8 cf 02 00 00       	call   51c <read>
+    if(cc < 1)
+ 24d:	83 c4 10             	add    $0x10,%esp
+ 250:	85 c0                	test   %eax,%eax
+ 252:	7e 1d                	jle    271 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 254:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 258:	8b 55 08             	mov    0x8(%ebp),%edx
+ 25b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 25f:	3c 0a                	cmp    $0xa,%al
+ 261:	74 10                	je     273 <gets+0x43>
+ 263:	3c 0d                	cmp    $0xd,%al
+ 265:	74 0c                	je     273 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 267:	89 df                	mov    %ebx,%edi
+ 269:	83 c3 01             	add    $0x1,%ebx
+ 26c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 26f:	7c cf                	jl     240 <gets+0x10>
+ 271:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 27a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 27d:	5b                   	pop    %ebx
+ 27e:	5e                   	pop    %esi
+ 27f:	5f                   	pop    %edi
+ 280:	5d                   	pop    %ebp
+ 281:	c3                   	ret
+ 282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	56                   	push   %esi
+ 294:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 295:	83 ec 08             	sub    $0x8,%esp
+ 298:	6a 00                	push   $0x0
+ 29a:	ff 75 08             	push   0x8(%ebp)
+ 29d:	e8 a2 02 00 00       	call   544 <open>
+  if(fd < 0)
+ 2a2:	83 c4 10             	add    $0x10,%esp
+ 2a5:	85 c0                	test   %eax,%eax
+ 2a7:	78 27                	js     2d0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 2a9:	83 ec 08             	sub    $0x8,%esp
+ 2ac:	ff 75 0c             	push   0xc(%ebp)
+ 2af:	89 c3                	mov    %eax,%ebx
+ 2b1:	50                   	push   %eax
+ 2b2:	e8 a5 02 00 00       	call   55c <fstat>
+  close(fd);
+ 2b7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 2ba:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 2bc:	e8 6b 02 00 00       	call   52c <close>
+  return r;
+ 2c1:	83 c4 10             	add    $0x10,%esp
+}
+ 2c4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2c7:	89 f0                	mov    %esi,%eax
+ 2c9:	5b                   	pop    %ebx
+ 2ca:	5e                   	pop    %esi
+ 2cb:	5d                   	pop    %ebp
+ 2cc:	c3                   	ret
+ 2cd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2d5:	eb ed                	jmp    2c4 <stat+0x34>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+
+000002e0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	53                   	push   %ebx
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2e7:	0f be 02             	movsbl (%edx),%eax
+ 2ea:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2ed:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2f5:	77 1e                	ja     315 <atoi+0x35>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 300:	83 c2 01             	add    $0x1,%edx
+ 303:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 306:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 30a:	0f be 02             	movsbl (%edx),%eax
+ 30d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 310:	80 fb 09             	cmp    $0x9,%bl
+ 313:	76 eb                	jbe    300 <atoi+0x20>
+  return n;
+}
+ 315:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 318:	89 c8                	mov    %ecx,%eax
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+ 31c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000320 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	56                   	push   %esi
+ 325:	8b 45 10             	mov    0x10(%ebp),%eax
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 32e:	85 c0                	test   %eax,%eax
+ 330:	7e 13                	jle    345 <memmove+0x25>
+ 332:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 334:	89 d7                	mov    %edx,%edi
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 340:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 341:	39 f8                	cmp    %edi,%eax
+ 343:	75 fb                	jne    340 <memmove+0x20>
+  return vdst;
+}
+ 345:	5e                   	pop    %esi
+ 346:	89 d0                	mov    %edx,%eax
+ 348:	5f                   	pop    %edi
+ 349:	5d                   	pop    %ebp
+ 34a:	c3                   	ret
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 35c:	5d                   	pop    %ebp
+ 35d:	c3                   	ret
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 360:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 361:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 366:	89 e5                	mov    %esp,%ebp
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+ 370:	89 c8                	mov    %ecx,%eax
+ 372:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 375:	85 c0                	test   %eax,%eax
+ 377:	75 f7                	jne    370 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 379:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 37e:	5d                   	pop    %ebp
+ 37f:	c3                   	ret
+
+00000380 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 380:	55                   	push   %ebp
+ 381:	31 c0                	xor    %eax,%eax
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 388:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 38d:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 390:	5d                   	pop    %ebp
+ 391:	c3                   	ret
+ 392:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3ac:	5d                   	pop    %ebp
+ 3ad:	c3                   	ret
+ 3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 3b6:	89 e5                	mov    %esp,%ebp
+ 3b8:	56                   	push   %esi
+ 3b9:	53                   	push   %ebx
+ 3ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3bd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 3c0:	85 c0                	test   %eax,%eax
+ 3c2:	74 2d                	je     3f1 <mutex_lock+0x41>
+ 3c4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3c9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 3cc:	85 c0                	test   %eax,%eax
+ 3ce:	74 21                	je     3f1 <mutex_lock+0x41>
+ 3d0:	be 02 00 00 00       	mov    $0x2,%esi
+ 3d5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3d8:	83 ec 04             	sub    $0x4,%esp
+ 3db:	6a 02                	push   $0x2
+ 3dd:	6a 00                	push   $0x0
+ 3df:	53                   	push   %ebx
+ 3e0:	e8 37 02 00 00       	call   61c <futex>
+ 3e5:	89 f0                	mov    %esi,%eax
+ 3e7:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 3ea:	83 c4 10             	add    $0x10,%esp
+ 3ed:	85 c0                	test   %eax,%eax
+ 3ef:	75 e7                	jne    3d8 <mutex_lock+0x28>
+}
+ 3f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3f4:	5b                   	pop    %ebx
+ 3f5:	5e                   	pop    %esi
+ 3f6:	5d                   	pop    %ebp
+ 3f7:	c3                   	ret
+ 3f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ff:	90                   	nop
+
+00000400 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 400:	55                   	push   %ebp
+ 401:	31 c0                	xor    %eax,%eax
+ 403:	89 e5                	mov    %esp,%ebp
+ 405:	83 ec 08             	sub    $0x8,%esp
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 40e:	83 f8 02             	cmp    $0x2,%eax
+ 411:	74 05                	je     418 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 413:	c9                   	leave
+ 414:	c3                   	ret
+ 415:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 418:	83 ec 04             	sub    $0x4,%esp
+ 41b:	6a 01                	push   $0x1
+ 41d:	6a 01                	push   $0x1
+ 41f:	52                   	push   %edx
+ 420:	e8 f7 01 00 00       	call   61c <futex>
+ 425:	83 c4 10             	add    $0x10,%esp
+}
+ 428:	c9                   	leave
+ 429:	c3                   	ret
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000430 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 43c:	5d                   	pop    %ebp
+ 43d:	c3                   	ret
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 440:	55                   	push   %ebp
+ 441:	31 c0                	xor    %eax,%eax
+ 443:	89 e5                	mov    %esp,%ebp
+ 445:	57                   	push   %edi
+ 446:	56                   	push   %esi
+ 447:	53                   	push   %ebx
+ 448:	83 ec 0c             	sub    $0xc,%esp
+ 44b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 44e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 451:	8b 3e                	mov    (%esi),%edi
+ 453:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 456:	83 f8 02             	cmp    $0x2,%eax
+ 459:	74 4d                	je     4a8 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 45b:	83 ec 04             	sub    $0x4,%esp
+ 45e:	57                   	push   %edi
+ 45f:	6a 00                	push   $0x0
+ 461:	56                   	push   %esi
+ 462:	e8 b5 01 00 00       	call   61c <futex>
+ 467:	b8 02 00 00 00       	mov    $0x2,%eax
+ 46c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 46f:	83 c4 10             	add    $0x10,%esp
+ 472:	85 c0                	test   %eax,%eax
+ 474:	74 23                	je     499 <cond_wait+0x59>
+ 476:	be 02 00 00 00       	mov    $0x2,%esi
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 480:	83 ec 04             	sub    $0x4,%esp
+ 483:	6a 02                	push   $0x2
+ 485:	6a 00                	push   $0x0
+ 487:	53                   	push   %ebx
+ 488:	e8 8f 01 00 00       	call   61c <futex>
+ 48d:	89 f0                	mov    %esi,%eax
+ 48f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 492:	83 c4 10             	add    $0x10,%esp
+ 495:	85 c0                	test   %eax,%eax
+ 497:	75 e7                	jne    480 <cond_wait+0x40>
+}
+ 499:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 49c:	5b                   	pop    %ebx
+ 49d:	5e                   	pop    %esi
+ 49e:	5f                   	pop    %edi
+ 49f:	5d                   	pop    %ebp
+ 4a0:	c3                   	ret
+ 4a1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 4a8:	83 ec 04             	sub    $0x4,%esp
+ 4ab:	6a 01                	push   $0x1
+ 4ad:	6a 01                	push   $0x1
+ 4af:	53                   	push   %ebx
+ 4b0:	e8 67 01 00 00       	call   61c <futex>
+ 4b5:	83 c4 10             	add    $0x10,%esp
+ 4b8:	eb a1                	jmp    45b <cond_wait+0x1b>
+ 4ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004c0 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	83 ec 0c             	sub    $0xc,%esp
+ 4c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 4cd:	6a 01                	push   $0x1
+ 4cf:	6a 01                	push   $0x1
+ 4d1:	50                   	push   %eax
+ 4d2:	e8 45 01 00 00       	call   61c <futex>
+}
+ 4d7:	83 c4 10             	add    $0x10,%esp
+ 4da:	c9                   	leave
+ 4db:	c3                   	ret
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	83 ec 0c             	sub    $0xc,%esp
+ 4e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4e9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 4ed:	6a ff                	push   $0xffffffff
+ 4ef:	6a 01                	push   $0x1
+ 4f1:	50                   	push   %eax
+ 4f2:	e8 25 01 00 00       	call   61c <futex>
+}
+ 4f7:	83 c4 10             	add    $0x10,%esp
+ 4fa:	c9                   	leave
+ 4fb:	c3                   	ret
+
+000004fc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4fc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <exit>:
+SYSCALL(exit)
+ 504:	b8 02 00 00 00       	mov    $0x2,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <wait>:
+SYSCALL(wait)
+ 50c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <pipe>:
+SYSCALL(pipe)
+ 514:	b8 04 00 00 00       	mov    $0x4,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <read>:
+SYSCALL(read)
+ 51c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <write>:
+SYSCALL(write)
+ 524:	b8 10 00 00 00       	mov    $0x10,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <close>:
+SYSCALL(close)
+ 52c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <kill>:
+SYSCALL(kill)
+ 534:	b8 06 00 00 00       	mov    $0x6,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <exec>:
+SYSCALL(exec)
+ 53c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <open>:
+SYSCALL(open)
+ 544:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <mknod>:
+SYSCALL(mknod)
+ 54c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <unlink>:
+SYSCALL(unlink)
+ 554:	b8 12 00 00 00       	mov    $0x12,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <fstat>:
+SYSCALL(fstat)
+ 55c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <link>:
+SYSCALL(link)
+ 564:	b8 13 00 00 00       	mov    $0x13,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <mkdir>:
+SYSCALL(mkdir)
+ 56c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <chdir>:
+SYSCALL(chdir)
+ 574:	b8 09 00 00 00       	mov    $0x9,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <dup>:
+SYSCALL(dup)
+ 57c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <getpid>:
+SYSCALL(getpid)
+ 584:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <sbrk>:
+SYSCALL(sbrk)
+ 58c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <sleep>:
+SYSCALL(sleep)
+ 594:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <uptime>:
+SYSCALL(uptime)
+ 59c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 5a4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 5ac:	b8 19 00 00 00       	mov    $0x19,%eax
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <wmap>:
+SYSCALL(wmap)
+ 5b4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <wunmap>:
+SYSCALL(wunmap)
+ 5bc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5c1:	cd 40                	int    $0x40
+ 5c3:	c3                   	ret
+
+000005c4 <wremap>:
+SYSCALL(wremap)
+ 5c4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5c9:	cd 40                	int    $0x40
+ 5cb:	c3                   	ret
+
+000005cc <wmlock>:
+SYSCALL(wmlock)
+ 5cc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5d1:	cd 40                	int    $0x40
+ 5d3:	c3                   	ret
+
+000005d4 <wmunlock>:
+SYSCALL(wmunlock)
+ 5d4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5d9:	cd 40                	int    $0x40
+ 5db:	c3                   	ret
+
+000005dc <wmapoff>:
+SYSCALL(wmapoff)
+ 5dc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 5e4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <setpriority>:
+SYSCALL(setpriority)
+ 5ec:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 5f4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <settickets>:
+SYSCALL(settickets)
+ 5fc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 604:	b8 22 00 00 00       	mov    $0x22,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <clone>:
+SYSCALL(clone)
+ 60c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <join>:
+SYSCALL(join)
+ 614:	b8 24 00 00 00       	mov    $0x24,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <futex>:
+SYSCALL(futex)
+ 61c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <setaffinity>:
+SYSCALL(setaffinity)
+ 624:	b8 26 00 00 00       	mov    $0x26,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <getaffinity>:
+SYSCALL(getaffinity)
+ 62c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <bcstat>:
+SYSCALL(bcstat)
+ 634:	b8 29 00 00 00       	mov    $0x29,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <dropcache>:
+SYSCALL(dropcache)
+ 63c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <setiosched>:
+SYSCALL(setiosched)
+ 644:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <iostat>:
+SYSCALL(iostat)
+ 64c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <fsync>:
+SYSCALL(fsync)
+ 654:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 65c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 65d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 662:	cd 40                	int    $0x40
+ 664:	ff e1                	jmp    *%ecx
+ 666:	66 90                	xchg   %ax,%ax
+ 668:	66 90                	xchg   %ax,%ax
+ 66a:	66 90                	xchg   %ax,%ax
+ 66c:	66 90                	xchg   %ax,%ax
+ 66e:	66 90                	xchg   %ax,%ax
+
+00000670 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 678:	89 d1                	mov    %edx,%ecx
+{
+ 67a:	83 ec 3c             	sub    $0x3c,%esp
+ 67d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 680:	85 d2                	test   %edx,%edx
+ 682:	0f 89 80 00 00 00    	jns    708 <printint+0x98>
+ 688:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 68c:	74 7a                	je     708 <printint+0x98>
+    x = -xx;
+ 68e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 690:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 695:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 698:	31 f6                	xor    %esi,%esi
+ 69a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 6a0:	89 c8                	mov    %ecx,%eax
+ 6a2:	31 d2                	xor    %edx,%edx
+ 6a4:	89 f7                	mov    %esi,%edi
+ 6a6:	f7 f3                	div    %ebx
+ 6a8:	8d 76 01             	lea    0x1(%esi),%esi
+ 6ab:	0f b6 92 90 0c 00 00 	movzbl 0xc90(%edx),%edx
+ 6b2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 6b6:	89 ca                	mov    %ecx,%edx
+ 6b8:	89 c1                	mov    %eax,%ecx
+ 6ba:	39 da                	cmp    %ebx,%edx
+ 6bc:	73 e2                	jae    6a0 <printint+0x30>
+  if(neg)
+ 6be:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6c1:	85 c0                	test   %eax,%eax
+ 6c3:	74 07                	je     6cc <printint+0x5c>
+    buf[i++] = '-';
+ 6c5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6ca:	89 f7                	mov    %esi,%edi
+ 6cc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6cf:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6d2:	01 df                	add    %ebx,%edi
+ 6d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6d8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6db:	83 ec 04             	sub    $0x4,%esp
+ 6de:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6e1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6e4:	6a 01                	push   $0x1
+ 6e6:	50                   	push   %eax
+ 6e7:	56                   	push   %esi
+ 6e8:	e8 37 fe ff ff       	call   524 <write>
+  while(--i >= 0)
+ 6ed:	89 f8                	mov    %edi,%eax
+ 6ef:	83 c4 10             	add    $0x10,%esp
+ 6f2:	83 ef 01             	sub    $0x1,%edi
+ 6f5:	39 d8                	cmp    %ebx,%eax
+ 6f7:	75 df                	jne    6d8 <printint+0x68>
+}
+ 6f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6fc:	5b                   	pop    %ebx
+ 6fd:	5e                   	pop    %esi
+ 6fe:	5f                   	pop    %edi
+ 6ff:	5d                   	pop    %ebp
+ 700:	c3                   	ret
+ 701:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 708:	31 c0                	xor    %eax,%eax
+ 70a:	eb 89                	jmp    695 <printint+0x25>
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	57                   	push   %edi
+ 714:	56                   	push   %esi
+ 715:	53                   	push   %ebx
+ 716:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 719:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 71c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 71f:	0f b6 1e             	movzbl (%esi),%ebx
+ 722:	83 c6 01             	add    $0x1,%esi
+ 725:	84 db                	test   %bl,%bl
+ 727:	74 67                	je     790 <printf+0x80>
+ 729:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 72c:	31 d2                	xor    %edx,%edx
+ 72e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 731:	eb 34                	jmp    767 <printf+0x57>
+ 733:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 737:	90                   	nop
+ 738:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 73b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 740:	83 f8 25             	cmp    $0x25,%eax
+ 743:	74 18                	je     75d <printf+0x4d>
+  write(fd, &c, 1);
+ 745:	83 ec 04             	sub    $0x4,%esp
+ 748:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 74b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 74e:	6a 01                	push   $0x1
+ 750:	50                   	push   %eax
+ 751:	57                   	push   %edi
+ 752:	e8 cd fd ff ff       	call   524 <write>
+ 757:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 75a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 75d:	0f b6 1e             	movzbl (%esi),%ebx
+ 760:	83 c6 01             	add    $0x1,%esi
+ 763:	84 db                	test   %bl,%bl
+ 765:	74 29                	je     790 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 767:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 76a:	85 d2                	test   %edx,%edx
+ 76c:	74 ca                	je     738 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 76e:	83 fa 25             	cmp    $0x25,%edx
+ 771:	75 ea                	jne    75d <printf+0x4d>
+      if(c == 'd'){
+ 773:	83 f8 25             	cmp    $0x25,%eax
+ 776:	0f 84 24 01 00 00    	je     8a0 <printf+0x190>
+ 77c:	83 e8 63             	sub    $0x63,%eax
+ 77f:	83 f8 15             	cmp    $0x15,%eax
+ 782:	77 1c                	ja     7a0 <printf+0x90>
+ 784:	ff 24 85 38 0c 00 00 	jmp    *0xc38(,%eax,4)
+ 78b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 78f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 790:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 793:	5b                   	pop    %ebx
+ 794:	5e                   	pop    %esi
+ 795:	5f                   	pop    %edi
+ 796:	5d                   	pop    %ebp
+ 797:	c3                   	ret
+ 798:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 79f:	90                   	nop
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7a6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 7aa:	6a 01                	push   $0x1
+ 7ac:	52                   	push   %edx
+ 7ad:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 7b0:	57                   	push   %edi
+ 7b1:	e8 6e fd ff ff       	call   524 <write>
+ 7b6:	83 c4 0c             	add    $0xc,%esp
+ 7b9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7bc:	6a 01                	push   $0x1
+ 7be:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7c1:	52                   	push   %edx
+ 7c2:	57                   	push   %edi
+ 7c3:	e8 5c fd ff ff       	call   524 <write>
+        putc(fd, c);
+ 7c8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7cb:	31 d2                	xor    %edx,%edx
+ 7cd:	eb 8e                	jmp    75d <printf+0x4d>
+ 7cf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7db:	8b 13                	mov    (%ebx),%edx
+ 7dd:	6a 00                	push   $0x0
+ 7df:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7e1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7e4:	e8 87 fe ff ff       	call   670 <printint>
+        ap++;
+ 7e9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7ec:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7ef:	31 d2                	xor    %edx,%edx
+ 7f1:	e9 67 ff ff ff       	jmp    75d <printf+0x4d>
+ 7f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7fd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 800:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 803:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 805:	83 c0 04             	add    $0x4,%eax
+ 808:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 80b:	85 db                	test   %ebx,%ebx
+ 80d:	0f 84 9d 00 00 00    	je     8b0 <printf+0x1a0>
+        while(*s != 0){
+ 813:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 816:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 818:	84 c0                	test   %al,%al
+ 81a:	0f 84 3d ff ff ff    	je     75d <printf+0x4d>
+ 820:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 823:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 826:	89 de                	mov    %ebx,%esi
+ 828:	89 d3                	mov    %edx,%ebx
+ 82a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 830:	83 ec 04             	sub    $0x4,%esp
+ 833:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 836:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 839:	6a 01                	push   $0x1
+ 83b:	53                   	push   %ebx
+ 83c:	57                   	push   %edi
+ 83d:	e8 e2 fc ff ff       	call   524 <write>
+        while(*s != 0){
+ 842:	0f b6 06             	movzbl (%esi),%eax
+ 845:	83 c4 10             	add    $0x10,%esp
+ 848:	84 c0                	test   %al,%al
+ 84a:	75 e4                	jne    830 <printf+0x120>
+      state = 0;
+ 84c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 84f:	31 d2                	xor    %edx,%edx
+ 851:	e9 07 ff ff ff       	jmp    75d <printf+0x4d>
+ 856:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 85d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 860:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 863:	83 ec 0c             	sub    $0xc,%esp
+ 866:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 86b:	8b 13                	mov    (%ebx),%edx
+ 86d:	6a 01                	push   $0x1
+ 86f:	e9 6b ff ff ff       	jmp    7df <printf+0xcf>
+ 874:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 878:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 87b:	83 ec 04             	sub    $0x4,%esp
+ 87e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 881:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 883:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 886:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 889:	6a 01                	push   $0x1
+ 88b:	52                   	push   %edx
+ 88c:	57                   	push   %edi
+ 88d:	e8 92 fc ff ff       	call   524 <write>
+        ap++;
+ 892:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 895:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 898:	31 d2                	xor    %edx,%edx
+ 89a:	e9 be fe ff ff       	jmp    75d <printf+0x4d>
+ 89f:	90                   	nop
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8a6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8a9:	6a 01                	push   $0x1
+ 8ab:	e9 11 ff ff ff       	jmp    7c1 <printf+0xb1>
+ 8b0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 8b5:	bb 30 0c 00 00       	mov    $0xc30,%ebx
+ 8ba:	e9 61 ff ff ff       	jmp    820 <printf+0x110>
+ 8bf:	90                   	nop
+
+000008c0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8c0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8c1:	a1 60 13 00 00       	mov    0x1360,%eax
+{
+ 8c6:	89 e5                	mov    %esp,%ebp
+ 8c8:	57                   	push   %edi
+ 8c9:	56                   	push   %esi
+ 8ca:	53                   	push   %ebx
+ 8cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8ce:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8d8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8da:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8dc:	39 ca                	cmp    %ecx,%edx
+ 8de:	73 30                	jae    910 <free+0x50>
+ 8e0:	39 c1                	cmp    %eax,%ecx
+ 8e2:	72 04                	jb     8e8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8e4:	39 c2                	cmp    %eax,%edx
+ 8e6:	72 f0                	jb     8d8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8e8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8eb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8ee:	39 f8                	cmp    %edi,%eax
+ 8f0:	74 2e                	je     920 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8f2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8f5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8f8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8fb:	39 f1                	cmp    %esi,%ecx
+ 8fd:	74 38                	je     937 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8ff:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 901:	5b                   	pop    %ebx
+  freep = p;
+ 902:	89 15 60 13 00 00    	mov    %edx,0x1360
+}
+ 908:	5e                   	pop    %esi
+ 909:	5f                   	pop    %edi
+ 90a:	5d                   	pop    %ebp
+ 90b:	c3                   	ret
+ 90c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 910:	39 c1                	cmp    %eax,%ecx
+ 912:	72 d0                	jb     8e4 <free+0x24>
+ 914:	eb c2                	jmp    8d8 <free+0x18>
+ 916:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 91d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 920:	03 70 04             	add    0x4(%eax),%esi
+ 923:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 926:	8b 02                	mov    (%edx),%eax
+ 928:	8b 00                	mov    (%eax),%eax
+ 92a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 92d:	8b 42 04             	mov    0x4(%edx),%eax
+ 930:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 933:	39 f1                	cmp    %esi,%ecx
+ 935:	75 c8                	jne    8ff <free+0x3f>
+    p->s.size += bp->s.size;
+ 937:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 93a:	89 15 60 13 00 00    	mov    %edx,0x1360
+    p->s.size += bp->s.size;
+ 940:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 943:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 946:	89 0a                	mov    %ecx,(%edx)
+}
+ 948:	5b                   	pop    %ebx
+ 949:	5e                   	pop    %esi
+ 94a:	5f                   	pop    %edi
+ 94b:	5d                   	pop    %ebp
+ 94c:	c3                   	ret
+ 94d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000950 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	53                   	push   %ebx
+ 956:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 959:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 95c:	8b 15 60 13 00 00    	mov    0x1360,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 962:	8d 78 07             	lea    0x7(%eax),%edi
+ 965:	c1 ef 03             	shr    $0x3,%edi
+ 968:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 96b:	85 d2                	test   %edx,%edx
+ 96d:	0f 84 8d 00 00 00    	je     a00 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 973:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 975:	8b 48 04             	mov    0x4(%eax),%ecx
+ 978:	39 f9                	cmp    %edi,%ecx
+ 97a:	73 64                	jae    9e0 <malloc+0x90>
+  if(nu < 4096)
+ 97c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 981:	39 df                	cmp    %ebx,%edi
+ 983:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 986:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 98d:	eb 0a                	jmp    999 <malloc+0x49>
+ 98f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 990:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 992:	8b 48 04             	mov    0x4(%eax),%ecx
+ 995:	39 f9                	cmp    %edi,%ecx
+ 997:	73 47                	jae    9e0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 999:	89 c2                	mov    %eax,%edx
+ 99b:	39 05 60 13 00 00    	cmp    %eax,0x1360
+ 9a1:	75 ed                	jne    990 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	56                   	push   %esi
+ 9a7:	e8 e0 fb ff ff       	call   58c <sbrk>
+  if(p == (char*)-1)
+ 9ac:	83 c4 10             	add    $0x10,%esp
+ 9af:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 9b2:	74 1c                	je     9d0 <malloc+0x80>
+  hp->s.size = nu;
+ 9b4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 9b7:	83 ec 0c             	sub    $0xc,%esp
+ 9ba:	83 c0 08             	add    $0x8,%eax
+ 9bd:	50                   	push   %eax
+ 9be:	e8 fd fe ff ff       	call   8c0 <free>
+  return freep;
+ 9c3:	8b 15 60 13 00 00    	mov    0x1360,%edx
+      if((p = morecore(nunits)) == 0)
+ 9c9:	83 c4 10             	add    $0x10,%esp
+ 9cc:	85 d2                	test   %edx,%edx
+ 9ce:	75 c0                	jne    990 <malloc+0x40>
+        return 0;
+  }
+}
+ 9d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9d3:	31 c0                	xor    %eax,%eax
+}
+ 9d5:	5b                   	pop    %ebx
+ 9d6:	5e                   	pop    %esi
+ 9d7:	5f                   	pop    %edi
+ 9d8:	5d                   	pop    %ebp
+ 9d9:	c3                   	ret
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9e0:	39 cf                	cmp    %ecx,%edi
+ 9e2:	74 4c                	je     a30 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9e4:	29 f9                	sub    %edi,%ecx
+ 9e6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9e9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9ec:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9ef:	89 15 60 13 00 00    	mov    %edx,0x1360
+}
+ 9f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9f8:	83 c0 08             	add    $0x8,%eax
+}
+ 9fb:	5b                   	pop    %ebx
+ 9fc:	5e                   	pop    %esi
+ 9fd:	5f                   	pop    %edi
+ 9fe:	5d                   	pop    %ebp
+ 9ff:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a00:	c7 05 60 13 00 00 64 	movl   $0x1364,0x1360
+ a07:	13 00 00 
+    base.s.size = 0;
+ a0a:	b8 64 13 00 00       	mov    $0x1364,%eax
+    base.s.ptr = freep = prevp = &base;
+ a0f:	c7 05 64 13 00 00 64 	movl   $0x1364,0x1364
+ a16:	13 00 00 
+    base.s.size = 0;
+ a19:	c7 05 68 13 00 00 00 	movl   $0x0,0x1368
+ a20:	00 00 00 
+    if(p->s.size >= nunits){
+ a23:	e9 54 ff ff ff       	jmp    97c <malloc+0x2c>
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a30:	8b 08                	mov    (%eax),%ecx
+ a32:	89 0a                	mov    %ecx,(%edx)
+ a34:	eb b9                	jmp    9ef <malloc+0x9f>
+ a36:	66 90                	xchg   %ax,%ax
+ a38:	66 90                	xchg   %ax,%ax
+ a3a:	66 90                	xchg   %ax,%ax
+ a3c:	66 90                	xchg   %ax,%ax
+ a3e:	66 90                	xchg   %ax,%ax
+
+00000a40 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ a46:	8b 45 08             	mov    0x8(%ebp),%eax
+ a49:	c1 e0 04             	shl    $0x4,%eax
+ a4c:	ff b0 ac 13 00 00    	push   0x13ac(%eax)
+ a52:	05 a0 13 00 00       	add    $0x13a0,%eax
+ a57:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ a5a:	e8 a5 fa ff ff       	call   504 <exit>
+ a5f:	90                   	nop
+
+00000a60 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ a66:	31 db                	xor    %ebx,%ebx
+{
+ a68:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ a6b:	68 80 13 00 00       	push   $0x1380
+ a70:	e8 eb f8 ff ff       	call   360 <lock_acquire>
+ a75:	83 c4 10             	add    $0x10,%esp
+ a78:	eb 12                	jmp    a8c <thread_create+0x2c>
+ a7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ a80:	83 c3 01             	add    $0x1,%ebx
+ a83:	83 fb 40             	cmp    $0x40,%ebx
+ a86:	0f 84 c4 00 00 00    	je     b50 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ a8c:	89 de                	mov    %ebx,%esi
+ a8e:	c1 e6 04             	shl    $0x4,%esi
+ a91:	8b 96 a0 13 00 00    	mov    0x13a0(%esi),%edx
+ a97:	85 d2                	test   %edx,%edx
+ a99:	75 e5                	jne    a80 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ a9b:	83 ec 0c             	sub    $0xc,%esp
+ a9e:	68 00 20 00 00       	push   $0x2000
+ aa3:	e8 a8 fe ff ff       	call   950 <malloc>
+ aa8:	83 c4 10             	add    $0x10,%esp
+ aab:	85 c0                	test   %eax,%eax
+ aad:	0f 84 9d 00 00 00    	je     b50 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ ab3:	89 86 a4 13 00 00    	mov    %eax,0x13a4(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ ab9:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ abe:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ ac1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ ac6:	89 86 a0 13 00 00    	mov    %eax,0x13a0(%esi)
+  threads[i].fn = fn;
+ acc:	8b 45 08             	mov    0x8(%ebp),%eax
+ acf:	89 86 a8 13 00 00    	mov    %eax,0x13a8(%esi)
+  threads[i].arg = arg;
+ ad5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ad8:	89 86 ac 13 00 00    	mov    %eax,0x13ac(%esi)
+  lock_release(&threadslock);
+ ade:	68 80 13 00 00       	push   $0x1380
+ ae3:	e8 98 f8 ff ff       	call   380 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ ae8:	83 c4 0c             	add    $0xc,%esp
+ aeb:	ff b6 a0 13 00 00    	push   0x13a0(%esi)
+ af1:	53                   	push   %ebx
+ af2:	68 40 0a 00 00       	push   $0xa40
+ af7:	e8 10 fb ff ff       	call   60c <clone>
+ afc:	83 c4 10             	add    $0x10,%esp
+ aff:	85 c0                	test   %eax,%eax
+ b01:	78 0d                	js     b10 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ b03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b06:	5b                   	pop    %ebx
+ b07:	5e                   	pop    %esi
+ b08:	5f                   	pop    %edi
+ b09:	5d                   	pop    %ebp
+ b0a:	c3                   	ret
+ b0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b0f:	90                   	nop
+    lock_acquire(&threadslock);
+ b10:	83 ec 0c             	sub    $0xc,%esp
+ b13:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ b16:	68 80 13 00 00       	push   $0x1380
+ b1b:	e8 40 f8 ff ff       	call   360 <lock_acquire>
+    free(threads[i].block);
+ b20:	58                   	pop    %eax
+ b21:	ff b6 a4 13 00 00    	push   0x13a4(%esi)
+ b27:	e8 94 fd ff ff       	call   8c0 <free>
+    threads[i].stack = 0;
+ b2c:	c7 86 a0 13 00 00 00 	movl   $0x0,0x13a0(%esi)
+ b33:	00 00 00 
+    lock_release(&threadslock);
+ b36:	c7 04 24 80 13 00 00 	movl   $0x1380,(%esp)
+ b3d:	e8 3e f8 ff ff       	call   380 <lock_release>
+ b42:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b45:	83 c4 10             	add    $0x10,%esp
+}
+ b48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b4b:	5b                   	pop    %ebx
+ b4c:	5e                   	pop    %esi
+ b4d:	5f                   	pop    %edi
+ b4e:	5d                   	pop    %ebp
+ b4f:	c3                   	ret
+    lock_release(&threadslock);
+ b50:	83 ec 0c             	sub    $0xc,%esp
+ b53:	68 80 13 00 00       	push   $0x1380
+ b58:	e8 23 f8 ff ff       	call   380 <lock_release>
+    return -1;
+ b5d:	83 c4 10             	add    $0x10,%esp
+ b60:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b65:	eb 9c                	jmp    b03 <thread_create+0xa3>
+ b67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6e:	66 90                	xchg   %ax,%ax
+
+00000b70 <thread_join>:
+
+int
+thread_join(void)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	56                   	push   %esi
+ b74:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ b75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ b78:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ b7b:	50                   	push   %eax
+ b7c:	e8 93 fa ff ff       	call   614 <join>
+ b81:	83 c4 10             	add    $0x10,%esp
+ b84:	85 c0                	test   %eax,%eax
+ b86:	78 69                	js     bf1 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ b88:	83 ec 0c             	sub    $0xc,%esp
+ b8b:	89 c6                	mov    %eax,%esi
+ b8d:	68 80 13 00 00       	push   $0x1380
+ b92:	e8 c9 f7 ff ff       	call   360 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ b97:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ b9a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ b9d:	31 c0                	xor    %eax,%eax
+ b9f:	eb 0f                	jmp    bb0 <thread_join+0x40>
+ ba1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ba8:	83 c0 01             	add    $0x1,%eax
+ bab:	83 f8 40             	cmp    $0x40,%eax
+ bae:	74 28                	je     bd8 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ bb0:	89 c3                	mov    %eax,%ebx
+ bb2:	c1 e3 04             	shl    $0x4,%ebx
+ bb5:	39 93 a0 13 00 00    	cmp    %edx,0x13a0(%ebx)
+ bbb:	75 eb                	jne    ba8 <thread_join+0x38>
+      free(threads[i].block);
+ bbd:	83 ec 0c             	sub    $0xc,%esp
+ bc0:	ff b3 a4 13 00 00    	push   0x13a4(%ebx)
+ bc6:	e8 f5 fc ff ff       	call   8c0 <free>
+      threads[i].stack = 0;
+      break;
+ bcb:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ bce:	c7 83 a0 13 00 00 00 	movl   $0x0,0x13a0(%ebx)
+ bd5:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ bd8:	83 ec 0c             	sub    $0xc,%esp
+ bdb:	68 80 13 00 00       	push   $0x1380
+ be0:	e8 9b f7 ff ff       	call   380 <lock_release>
+  return pid;
+ be5:	83 c4 10             	add    $0x10,%esp
+}
+ be8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ beb:	89 f0                	mov    %esi,%eax
+ bed:	5b                   	pop    %ebx
+ bee:	5e                   	pop    %esi
+ bef:	5d                   	pop    %ebp
+ bf0:	c3                   	ret
+    return -1;
+ bf1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ bf6:	eb f0                	jmp    be8 <thread_join+0x78>
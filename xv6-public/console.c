@@ -232,14 +232,18 @@ consoleintr(int (*getc)(void))
   }
 }
 
+// As with pipes, user memory goes through a buffer on the stack
+// rather than being touched with cons.lock held.
 int
 consoleread(struct inode *ip, char *dst, int n)
 {
+  char buf[128];
   uint target;
-  int c;
+  int c, m;
 
   iunlock(ip);
   target = n;
+  m = 0;
   acquire(&cons.lock);
   while(n > 0){
     while(input.r == input.w){
@@ -259,12 +263,20 @@ consoleread(struct inode *ip, char *dst, int n)
       }
       break;
     }
-    *dst++ = c;
+    buf[m++] = c;
     --n;
     if(c == '\n')
       break;
+    if(m == sizeof(buf)){
+      release(&cons.lock);
+      memmove(dst, buf, m);
+      dst += m;
+      m = 0;
+      acquire(&cons.lock);
+    }
   }
   release(&cons.lock);
+  memmove(dst, buf, m);
   ilock(ip);
 
   return target - n;
@@ -273,13 +285,18 @@ consoleread(struct inode *ip, char *dst, int n)
 int
 consolewrite(struct inode *ip, char *buf, int n)
 {
-  int i;
+  char cbuf[128];
+  int i, j, m;
 
   iunlock(ip);
-  acquire(&cons.lock);
-  for(i = 0; i < n; i++)
-    consputc(buf[i] & 0xff);
-  release(&cons.lock);
+  for(i = 0; i < n; i += m){
+    m = n - i < sizeof(cbuf) ? n - i : sizeof(cbuf);
+    memmove(cbuf, buf + i, m);
+    acquire(&cons.lock);
+    for(j = 0; j < m; j++)
+      consputc(cbuf[j] & 0xff);
+    release(&cons.lock);
+  }
   ilock(ip);
 
   return n;
@@ -1,20 +1,32 @@
+struct bcstat;
 struct buf;
 struct context;
 struct file;
 struct inode;
+struct iostat;
 struct pipe;
+struct pcidev;
 struct proc;
 struct rtcdate;
+struct schedinfo;
 struct spinlock;
 struct sleeplock;
+struct slab;
 struct stat;
 struct superblock;
+struct vmspace;
 
 // bio.c
+void            bcstat(struct bcstat*);
+void            bdone(struct buf*);
+void            bdrop(void);
 void            binit(void);
 struct buf*     bread(uint, uint);
+struct buf*     breada(uint, uint, uint*, int);
+struct buf*     bnew(uint, uint);
 void            brelse(struct buf*);
 void            bwrite(struct buf*);
+void            bwritev(struct buf**, int);
 
 // console.c
 void            consoleinit(void);
@@ -33,6 +45,7 @@ void            fileinit(void);
 int             fileread(struct file*, char*, int n);
 int             filestat(struct file*, struct stat*);
 int             filewrite(struct file*, char*, int n);
+int             filewriteat(struct file*, char*, int n, uint *off);
 
 // fs.c
 void            readsb(int dev, struct superblock *sb);
@@ -56,7 +69,12 @@ int             writei(struct inode*, char*, uint, uint);
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
+void            ideiostat(struct iostat*);
 void            iderw(struct buf*);
+void            iderwv(struct buf*, struct buf**, int);
+int             idesetsched(int);
+void            idestat(struct bcstat*);
+void            iderwait(struct buf*);
 
 // ioapic.c
 void            ioapicenable(int irq, int cpu);
@@ -66,8 +84,12 @@ void            ioapicinit(void);
 // kalloc.c
 char*           kalloc(void);
 void            kfree(char*);
+int             kfreepages(void);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+void            kpin(char*);
+void            kshare(char*);
+void            kunpin(char*);
 
 // kbd.c
 void            kbdintr(void);
@@ -78,13 +100,21 @@ int             lapicid(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapiconeshot(uint);
+void            lapicperiodic(void);
+uint            lapicticks(void);
+uint            lapicusecs(void);
+void            lapicwake(uchar);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
 // log.c
 void            initlog(int dev);
 void            log_write(struct buf*);
+void            log_flush(void);
 void            begin_op();
+void            begin_opn(int);
+int             log_opmax(void);
 void            end_op();
 
 // mp.c
@@ -95,6 +125,13 @@ void            mpinit(void);
 void            picenable(int);
 void            picinit(void);
 
+// pci.c
+void            pcienable(struct pcidev*, uint);
+int             pcifindclass(int, int, struct pcidev*);
+int             pcifindid(ushort, ushort, struct pcidev*);
+uint            pciread(struct pcidev*, int);
+void            pciwrite(struct pcidev*, int, uint);
+
 // pipe.c
 int             pipealloc(struct file**, struct file**);
 void            pipeclose(struct pipe*, int);
@@ -103,20 +140,38 @@ int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+struct vmspace* allocvm(pde_t*);
+int             clone(void(*)(void*), void*, void*);
 int             cpuid(void);
 void            exit(void);
+void            flushuvm(struct proc*);
 int             fork(void);
+int             futexwait(uint*, uint);
+int             futexwake(uint*, int);
+int             getaffinity(int);
+int             getschedinfo(int, struct schedinfo*);
 int             growproc(int);
+int             kproc(char*, void(*)(void));
+int             join(void**);
 int             kill(int);
 struct cpu*     mycpu(void);
 struct proc*    myproc();
 void            pinit(void);
+void            priboost(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             schedtick(struct proc*);
+int             setaffinity(int, uint, int);
+int             setpriority(int, int);
+int             setschedpolicy(int);
+int             settickets(int);
 void            setproc(struct proc*);
 void            sleep(void*, struct spinlock*);
+int             unsharefdt(struct proc*);
 void            userinit(void);
+int             vfork(void);
+int             vmexec(struct proc*, pde_t*, struct vmspace*);
 int             wait(void);
 void            wakeup(void*);
 void            yield(void);
@@ -124,6 +179,11 @@ void            yield(void);
 // swtch.S
 void            swtch(struct context**, struct context*);
 
+// slab.c
+void*           slaballoc(struct slab*);
+void            slabfree(struct slab*, void*);
+void            slabinit(struct slab*, char*, uint, void(*)(void*));
+
 // spinlock.c
 void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
@@ -161,8 +221,15 @@ void            timerinit(void);
 
 // trap.c
 void            idtinit(void);
+extern uint     nextwake;
 extern uint     ticks;
+void*           tickchan(uint);
+void            tickwait(uint);
 void            tvinit(void);
+int             wmapfault(struct proc*, uint);
+int             wmapfind(struct proc*, uint);
+int             wmappopulate(struct proc*, uint, uint);
+void            wmapwriteback(struct proc*, struct file*, uint, uint, uint);
 extern struct spinlock tickslock;
 
 // uart.c
@@ -170,6 +237,15 @@ void            uartinit(void);
 void            uartintr(void);
 void            uartputc(int);
 
+// virtio.c
+extern int      virtioblk;
+int             virtioinit(void);
+int             virtiointr(int);
+void            virtiorw(struct buf*);
+void            virtiorwv(struct buf*, struct buf**, int);
+void            virtiostat(struct bcstat*);
+void            virtiorwait(struct buf*);
+
 // vm.c
 void            seginit(void);
 void            kvmalloc(void);
@@ -177,10 +253,17 @@ pde_t*          setupkvm(void);
 char*           uva2ka(pde_t*, char*);
 int             allocuvm(pde_t*, uint, uint);
 int             deallocuvm(pde_t*, uint, uint);
+void            unmapuvm(pde_t*, uint, uint);
+void            reapuvm(pde_t*, uint, uint);
+int             populateuvm(pde_t*, uint, uint, int);
+int             mapframes(pde_t*, uint, char**, int, int);
+int             unpinuvm(pde_t*, uint, uint);
+int             moveuvm(pde_t*, uint, uint, uint);
 void            freevm(pde_t*);
 void            inituvm(pde_t*, char*, uint);
 int             loaduvm(pde_t*, char*, struct inode*, uint, uint);
 pde_t*          copyuvm(pde_t*, uint);
+int             copyuvmrange(pde_t*, pde_t*, uint, uint, int);
 void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
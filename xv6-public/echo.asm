@@ -0,0 +1,1794 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	8b 31                	mov    (%ecx),%esi
+  16:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  for(i = 1; i < argc; i++)
+  19:	83 fe 01             	cmp    $0x1,%esi
+  1c:	7e 47                	jle    65 <main+0x65>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1e:	8b 47 04             	mov    0x4(%edi),%eax
+  21:	83 fe 02             	cmp    $0x2,%esi
+  24:	74 2a                	je     50 <main+0x50>
+  26:	bb 02 00 00 00       	mov    $0x2,%ebx
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  30:	68 58 0b 00 00       	push   $0xb58
+  35:	83 c3 01             	add    $0x1,%ebx
+  38:	50                   	push   %eax
+  39:	68 5a 0b 00 00       	push   $0xb5a
+  3e:	6a 01                	push   $0x1
+  40:	e8 2b 06 00 00       	call   670 <printf>
+  45:	8b 44 9f fc          	mov    -0x4(%edi,%ebx,4),%eax
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 f3                	cmp    %esi,%ebx
+  4e:	75 e0                	jne    30 <main+0x30>
+  50:	68 5f 0b 00 00       	push   $0xb5f
+  55:	50                   	push   %eax
+  56:	68 5a 0b 00 00       	push   $0xb5a
+  5b:	6a 01                	push   $0x1
+  5d:	e8 0e 06 00 00       	call   670 <printf>
+  62:	83 c4 10             	add    $0x10,%esp
+  exit();
+  65:	e8 fa 03 00 00       	call   464 <exit>
+  6a:	66 90                	xchg   %ax,%ax
+  6c:	66 90                	xchg   %ax,%ax
+  6e:	66 90                	xchg   %ax,%ax
+
+00000070 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  70:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  71:	31 c0                	xor    %eax,%eax
+{
+  73:	89 e5                	mov    %esp,%ebp
+  75:	53                   	push   %ebx
+  76:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  80:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  84:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  87:	83 c0 01             	add    $0x1,%eax
+  8a:	84 d2                	test   %dl,%dl
+  8c:	75 f2                	jne    80 <strcpy+0x10>
+    ;
+  return os;
+}
+  8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  91:	89 c8                	mov    %ecx,%eax
+  93:	c9                   	leave
+  94:	c3                   	ret
+  95:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  a0:	55                   	push   %ebp
+  a1:	89 e5                	mov    %esp,%ebp
+  a3:	53                   	push   %ebx
+  a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  aa:	0f b6 02             	movzbl (%edx),%eax
+  ad:	84 c0                	test   %al,%al
+  af:	75 17                	jne    c8 <strcmp+0x28>
+  b1:	eb 3a                	jmp    ed <strcmp+0x4d>
+  b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  b7:	90                   	nop
+  b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  bc:	83 c2 01             	add    $0x1,%edx
+  bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  c2:	84 c0                	test   %al,%al
+  c4:	74 1a                	je     e0 <strcmp+0x40>
+    p++, q++;
+  c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  c8:	0f b6 19             	movzbl (%ecx),%ebx
+  cb:	38 c3                	cmp    %al,%bl
+  cd:	74 e9                	je     b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  cf:	29 d8                	sub    %ebx,%eax
+}
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+  d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  e4:	31 c0                	xor    %eax,%eax
+  e6:	29 d8                	sub    %ebx,%eax
+}
+  e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  eb:	c9                   	leave
+  ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ed:	0f b6 19             	movzbl (%ecx),%ebx
+  f0:	31 c0                	xor    %eax,%eax
+  f2:	eb db                	jmp    cf <strcmp+0x2f>
+  f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ff:	90                   	nop
+
+00000100 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 106:	80 3a 00             	cmpb   $0x0,(%edx)
+ 109:	74 15                	je     120 <strlen+0x20>
+ 10b:	31 c0                	xor    %eax,%eax
+ 10d:	8d 76 00             	lea    0x0(%esi),%esi
+ 110:	83 c0 01             	add    $0x1,%eax
+ 113:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 117:	89 c1                	mov    %eax,%ecx
+ 119:	75 f5                	jne    110 <strlen+0x10>
+    ;
+  return n;
+}
+ 11b:	89 c8                	mov    %ecx,%eax
+ 11d:	5d                   	pop    %ebp
+ 11e:	c3                   	ret
+ 11f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 120:	31 c9                	xor    %ecx,%ecx
+}
+ 122:	5d                   	pop    %ebp
+ 123:	89 c8                	mov    %ecx,%eax
+ 125:	c3                   	ret
+ 126:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 12d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000130 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 130:	55                   	push   %ebp
+ 131:	89 e5                	mov    %esp,%ebp
+ 133:	57                   	push   %edi
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 137:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 13a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13d:	89 d7                	mov    %edx,%edi
+ 13f:	fc                   	cld
+ 140:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 142:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 145:	89 d0                	mov    %edx,%eax
+ 147:	c9                   	leave
+ 148:	c3                   	ret
+ 149:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000150 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	8b 45 08             	mov    0x8(%ebp),%eax
+ 156:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 15a:	0f b6 10             	movzbl (%eax),%edx
+ 15d:	84 d2                	test   %dl,%dl
+ 15f:	75 12                	jne    173 <strchr+0x23>
+ 161:	eb 1d                	jmp    180 <strchr+0x30>
+ 163:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 167:	90                   	nop
+ 168:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 16c:	83 c0 01             	add    $0x1,%eax
+ 16f:	84 d2                	test   %dl,%dl
+ 171:	74 0d                	je     180 <strchr+0x30>
+    if(*s == c)
+ 173:	38 d1                	cmp    %dl,%cl
+ 175:	75 f1                	jne    168 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 177:	5d                   	pop    %ebp
+ 178:	c3                   	ret
+ 179:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 180:	31 c0                	xor    %eax,%eax
+}
+ 182:	5d                   	pop    %ebp
+ 183:	c3                   	ret
+ 184:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 18b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 18f:	90                   	nop
+
+00000190 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	57                   	push   %edi
+ 194:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 195:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 198:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 199:	31 db                	xor    %ebx,%ebx
+{
+ 19b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 19e:	eb 27                	jmp    1c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1a0:	83 ec 04             	sub    $0x4,%esp
+ 1a3:	6a 01                	push   $0x1
+ 1a5:	56                   	push   %esi
+ 1a6:	6a 00                	push   $0x0
+ 1a8:	e8 cf 02 00 00       	call   47c <read>
+    if(cc < 1)
+ 1ad:	83 c4 10             	add    $0x10,%esp
+ 1b0:	85 c0                	test   %eax,%eax
+ 1b2:	7e 1d                	jle    1d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1bf:	3c 0a                	cmp    $0xa,%al
+ 1c1:	74 10                	je     1d3 <gets+0x43>
+ 1c3:	3c 0d                	cmp    $0xd,%al
+ 1c5:	74 0c                	je     1d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1c7:	89 df                	mov    %ebx,%edi
+ 1c9:	83 c3 01             	add    $0x1,%ebx
+ 1cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1cf:	7c cf                	jl     1a0 <gets+0x10>
+ 1d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1dd:	5b                   	pop    %ebx
+ 1de:	5e                   	pop    %esi
+ 1df:	5f                   	pop    %edi
+ 1e0:	5d                   	pop    %ebp
+ 1e1:	c3                   	ret
+ 1e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	56                   	push   %esi
+ 1f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1f5:	83 ec 08             	sub    $0x8,%esp
+ 1f8:	6a 00                	push   $0x0
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 a2 02 00 00       	call   4a4 <open>
+  if(fd < 0)
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 27                	js     230 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 209:	83 ec 08             	sub    $0x8,%esp
+ 20c:	ff 75 0c             	push   0xc(%ebp)
+ 20f:	89 c3                	mov    %eax,%ebx
+ 211:	50                   	push   %eax
+ 212:	e8 a5 02 00 00       	call   4bc <fstat>
+  close(fd);
+ 217:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 21a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 21c:	e8 6b 02 00 00       	call   48c <close>
+  return r;
+ 221:	83 c4 10             	add    $0x10,%esp
+}
+ 224:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 227:	89 f0                	mov    %esi,%eax
+ 229:	5b                   	pop    %ebx
+ 22a:	5e                   	pop    %esi
+ 22b:	5d                   	pop    %ebp
+ 22c:	c3                   	ret
+ 22d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 230:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 235:	eb ed                	jmp    224 <stat+0x34>
+ 237:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23e:	66 90                	xchg   %ax,%ax
+
+00000240 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	53                   	push   %ebx
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 247:	0f be 02             	movsbl (%edx),%eax
+ 24a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 24d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 250:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 255:	77 1e                	ja     275 <atoi+0x35>
+ 257:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 260:	83 c2 01             	add    $0x1,%edx
+ 263:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 266:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 26a:	0f be 02             	movsbl (%edx),%eax
+ 26d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 270:	80 fb 09             	cmp    $0x9,%bl
+ 273:	76 eb                	jbe    260 <atoi+0x20>
+  return n;
+}
+ 275:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 278:	89 c8                	mov    %ecx,%eax
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	57                   	push   %edi
+ 284:	56                   	push   %esi
+ 285:	8b 45 10             	mov    0x10(%ebp),%eax
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 28e:	85 c0                	test   %eax,%eax
+ 290:	7e 13                	jle    2a5 <memmove+0x25>
+ 292:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 294:	89 d7                	mov    %edx,%edi
+ 296:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2a1:	39 f8                	cmp    %edi,%eax
+ 2a3:	75 fb                	jne    2a0 <memmove+0x20>
+  return vdst;
+}
+ 2a5:	5e                   	pop    %esi
+ 2a6:	89 d0                	mov    %edx,%eax
+ 2a8:	5f                   	pop    %edi
+ 2a9:	5d                   	pop    %ebp
+ 2aa:	c3                   	ret
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 2b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2bc:	5d                   	pop    %ebp
+ 2bd:	c3                   	ret
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 2c0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 2c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 2c6:	89 e5                	mov    %esp,%ebp
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2cf:	90                   	nop
+ 2d0:	89 c8                	mov    %ecx,%eax
+ 2d2:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 2d5:	85 c0                	test   %eax,%eax
+ 2d7:	75 f7                	jne    2d0 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 2d9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 2de:	5d                   	pop    %ebp
+ 2df:	c3                   	ret
+
+000002e0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	31 c0                	xor    %eax,%eax
+ 2e3:	89 e5                	mov    %esp,%ebp
+ 2e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 2e8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 2ed:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 30c:	5d                   	pop    %ebp
+ 30d:	c3                   	ret
+ 30e:	66 90                	xchg   %ax,%ax
+
+00000310 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 310:	55                   	push   %ebp
+ 311:	b8 01 00 00 00       	mov    $0x1,%eax
+ 316:	89 e5                	mov    %esp,%ebp
+ 318:	56                   	push   %esi
+ 319:	53                   	push   %ebx
+ 31a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 31d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 320:	85 c0                	test   %eax,%eax
+ 322:	74 2d                	je     351 <mutex_lock+0x41>
+ 324:	b8 02 00 00 00       	mov    $0x2,%eax
+ 329:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 32c:	85 c0                	test   %eax,%eax
+ 32e:	74 21                	je     351 <mutex_lock+0x41>
+ 330:	be 02 00 00 00       	mov    $0x2,%esi
+ 335:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 338:	83 ec 04             	sub    $0x4,%esp
+ 33b:	6a 02                	push   $0x2
+ 33d:	6a 00                	push   $0x0
+ 33f:	53                   	push   %ebx
+ 340:	e8 37 02 00 00       	call   57c <futex>
+ 345:	89 f0                	mov    %esi,%eax
+ 347:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 34a:	83 c4 10             	add    $0x10,%esp
+ 34d:	85 c0                	test   %eax,%eax
+ 34f:	75 e7                	jne    338 <mutex_lock+0x28>
+}
+ 351:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 354:	5b                   	pop    %ebx
+ 355:	5e                   	pop    %esi
+ 356:	5d                   	pop    %ebp
+ 357:	c3                   	ret
+ 358:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 360:	55                   	push   %ebp
+ 361:	31 c0                	xor    %eax,%eax
+ 363:	89 e5                	mov    %esp,%ebp
+ 365:	83 ec 08             	sub    $0x8,%esp
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 36e:	83 f8 02             	cmp    $0x2,%eax
+ 371:	74 05                	je     378 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 373:	c9                   	leave
+ 374:	c3                   	ret
+ 375:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 378:	83 ec 04             	sub    $0x4,%esp
+ 37b:	6a 01                	push   $0x1
+ 37d:	6a 01                	push   $0x1
+ 37f:	52                   	push   %edx
+ 380:	e8 f7 01 00 00       	call   57c <futex>
+ 385:	83 c4 10             	add    $0x10,%esp
+}
+ 388:	c9                   	leave
+ 389:	c3                   	ret
+ 38a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000390 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 393:	8b 45 08             	mov    0x8(%ebp),%eax
+ 396:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 39c:	5d                   	pop    %ebp
+ 39d:	c3                   	ret
+ 39e:	66 90                	xchg   %ax,%ax
+
+000003a0 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	31 c0                	xor    %eax,%eax
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	57                   	push   %edi
+ 3a6:	56                   	push   %esi
+ 3a7:	53                   	push   %ebx
+ 3a8:	83 ec 0c             	sub    $0xc,%esp
+ 3ab:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 3b1:	8b 3e                	mov    (%esi),%edi
+ 3b3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 3b6:	83 f8 02             	cmp    $0x2,%eax
+ 3b9:	74 4d                	je     408 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 3bb:	83 ec 04             	sub    $0x4,%esp
+ 3be:	57                   	push   %edi
+ 3bf:	6a 00                	push   $0x0
+ 3c1:	56                   	push   %esi
+ 3c2:	e8 b5 01 00 00       	call   57c <futex>
+ 3c7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3cc:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 3cf:	83 c4 10             	add    $0x10,%esp
+ 3d2:	85 c0                	test   %eax,%eax
+ 3d4:	74 23                	je     3f9 <cond_wait+0x59>
+ 3d6:	be 02 00 00 00       	mov    $0x2,%esi
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3e0:	83 ec 04             	sub    $0x4,%esp
+ 3e3:	6a 02                	push   $0x2
+ 3e5:	6a 00                	push   $0x0
+ 3e7:	53                   	push   %ebx
+ 3e8:	e8 8f 01 00 00       	call   57c <futex>
+ 3ed:	89 f0                	mov    %esi,%eax
+ 3ef:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 3f2:	83 c4 10             	add    $0x10,%esp
+ 3f5:	85 c0                	test   %eax,%eax
+ 3f7:	75 e7                	jne    3e0 <cond_wait+0x40>
+}
+ 3f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3fc:	5b                   	pop    %ebx
+ 3fd:	5e                   	pop    %esi
+ 3fe:	5f                   	pop    %edi
+ 3ff:	5d                   	pop    %ebp
+ 400:	c3                   	ret
+ 401:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 408:	83 ec 04             	sub    $0x4,%esp
+ 40b:	6a 01                	push   $0x1
+ 40d:	6a 01                	push   $0x1
+ 40f:	53                   	push   %ebx
+ 410:	e8 67 01 00 00       	call   57c <futex>
+ 415:	83 c4 10             	add    $0x10,%esp
+ 418:	eb a1                	jmp    3bb <cond_wait+0x1b>
+ 41a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000420 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	83 ec 0c             	sub    $0xc,%esp
+ 426:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 429:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 42d:	6a 01                	push   $0x1
+ 42f:	6a 01                	push   $0x1
+ 431:	50                   	push   %eax
+ 432:	e8 45 01 00 00       	call   57c <futex>
+}
+ 437:	83 c4 10             	add    $0x10,%esp
+ 43a:	c9                   	leave
+ 43b:	c3                   	ret
+ 43c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	83 ec 0c             	sub    $0xc,%esp
+ 446:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 449:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 44d:	6a ff                	push   $0xffffffff
+ 44f:	6a 01                	push   $0x1
+ 451:	50                   	push   %eax
+ 452:	e8 25 01 00 00       	call   57c <futex>
+}
+ 457:	83 c4 10             	add    $0x10,%esp
+ 45a:	c9                   	leave
+ 45b:	c3                   	ret
+
+0000045c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 45c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <exit>:
+SYSCALL(exit)
+ 464:	b8 02 00 00 00       	mov    $0x2,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <wait>:
+SYSCALL(wait)
+ 46c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <pipe>:
+SYSCALL(pipe)
+ 474:	b8 04 00 00 00       	mov    $0x4,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <read>:
+SYSCALL(read)
+ 47c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <write>:
+SYSCALL(write)
+ 484:	b8 10 00 00 00       	mov    $0x10,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <close>:
+SYSCALL(close)
+ 48c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <kill>:
+SYSCALL(kill)
+ 494:	b8 06 00 00 00       	mov    $0x6,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <exec>:
+SYSCALL(exec)
+ 49c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <open>:
+SYSCALL(open)
+ 4a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <mknod>:
+SYSCALL(mknod)
+ 4ac:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <unlink>:
+SYSCALL(unlink)
+ 4b4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <fstat>:
+SYSCALL(fstat)
+ 4bc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <link>:
+SYSCALL(link)
+ 4c4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <mkdir>:
+SYSCALL(mkdir)
+ 4cc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <chdir>:
+SYSCALL(chdir)
+ 4d4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <dup>:
+SYSCALL(dup)
+ 4dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <getpid>:
+SYSCALL(getpid)
+ 4e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <sbrk>:
+SYSCALL(sbrk)
+ 4ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <sleep>:
+SYSCALL(sleep)
+ 4f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <uptime>:
+SYSCALL(uptime)
+ 4fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 504:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 50c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <wmap>:
+SYSCALL(wmap)
+ 514:	b8 16 00 00 00       	mov    $0x16,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <wunmap>:
+SYSCALL(wunmap)
+ 51c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <wremap>:
+SYSCALL(wremap)
+ 524:	b8 18 00 00 00       	mov    $0x18,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <wmlock>:
+SYSCALL(wmlock)
+ 52c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <wmunlock>:
+SYSCALL(wmunlock)
+ 534:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <wmapoff>:
+SYSCALL(wmapoff)
+ 53c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 544:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <setpriority>:
+SYSCALL(setpriority)
+ 54c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 554:	b8 20 00 00 00       	mov    $0x20,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <settickets>:
+SYSCALL(settickets)
+ 55c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 564:	b8 22 00 00 00       	mov    $0x22,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <clone>:
+SYSCALL(clone)
+ 56c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <join>:
+SYSCALL(join)
+ 574:	b8 24 00 00 00       	mov    $0x24,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <futex>:
+SYSCALL(futex)
+ 57c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <setaffinity>:
+SYSCALL(setaffinity)
+ 584:	b8 26 00 00 00       	mov    $0x26,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <getaffinity>:
+SYSCALL(getaffinity)
+ 58c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <bcstat>:
+SYSCALL(bcstat)
+ 594:	b8 29 00 00 00       	mov    $0x29,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <dropcache>:
+SYSCALL(dropcache)
+ 59c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <setiosched>:
+SYSCALL(setiosched)
+ 5a4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <iostat>:
+SYSCALL(iostat)
+ 5ac:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <fsync>:
+SYSCALL(fsync)
+ 5b4:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 5bc:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 5bd:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 5c2:	cd 40                	int    $0x40
+ 5c4:	ff e1                	jmp    *%ecx
+ 5c6:	66 90                	xchg   %ax,%ax
+ 5c8:	66 90                	xchg   %ax,%ax
+ 5ca:	66 90                	xchg   %ax,%ax
+ 5cc:	66 90                	xchg   %ax,%ax
+ 5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	57                   	push   %edi
+ 5d4:	56                   	push   %esi
+ 5d5:	53                   	push   %ebx
+ 5d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5d8:	89 d1                	mov    %edx,%ecx
+{
+ 5da:	83 ec 3c             	sub    $0x3c,%esp
+ 5dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5e0:	85 d2                	test   %edx,%edx
+ 5e2:	0f 89 80 00 00 00    	jns    668 <printint+0x98>
+ 5e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5ec:	74 7a                	je     668 <printint+0x98>
+    x = -xx;
+ 5ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5f8:	31 f6                	xor    %esi,%esi
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 600:	89 c8                	mov    %ecx,%eax
+ 602:	31 d2                	xor    %edx,%edx
+ 604:	89 f7                	mov    %esi,%edi
+ 606:	f7 f3                	div    %ebx
+ 608:	8d 76 01             	lea    0x1(%esi),%esi
+ 60b:	0f b6 92 c0 0b 00 00 	movzbl 0xbc0(%edx),%edx
+ 612:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 616:	89 ca                	mov    %ecx,%edx
+ 618:	89 c1                	mov    %eax,%ecx
+ 61a:	39 da                	cmp    %ebx,%edx
+ 61c:	73 e2                	jae    600 <printint+0x30>
+  if(neg)
+ 61e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 621:	85 c0                	test   %eax,%eax
+ 623:	74 07                	je     62c <printint+0x5c>
+    buf[i++] = '-';
+ 625:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 62a:	89 f7                	mov    %esi,%edi
+ 62c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 62f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 632:	01 df                	add    %ebx,%edi
+ 634:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 638:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 63b:	83 ec 04             	sub    $0x4,%esp
+ 63e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 641:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 644:	6a 01                	push   $0x1
+ 646:	50                   	push   %eax
+ 647:	56                   	push   %esi
+ 648:	e8 37 fe ff ff       	call   484 <write>
+  while(--i >= 0)
+ 64d:	89 f8                	mov    %edi,%eax
+ 64f:	83 c4 10             	add    $0x10,%esp
+ 652:	83 ef 01             	sub    $0x1,%edi
+ 655:	39 d8                	cmp    %ebx,%eax
+ 657:	75 df                	jne    638 <printint+0x68>
+}
+ 659:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 65c:	5b                   	pop    %ebx
+ 65d:	5e                   	pop    %esi
+ 65e:	5f                   	pop    %edi
+ 65f:	5d                   	pop    %ebp
+ 660:	c3                   	ret
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 668:	31 c0                	xor    %eax,%eax
+ 66a:	eb 89                	jmp    5f5 <printint+0x25>
+ 66c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000670 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 670:	55                   	push   %ebp
+ 671:	89 e5                	mov    %esp,%ebp
+ 673:	57                   	push   %edi
+ 674:	56                   	push   %esi
+ 675:	53                   	push   %ebx
+ 676:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 679:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 67c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 67f:	0f b6 1e             	movzbl (%esi),%ebx
+ 682:	83 c6 01             	add    $0x1,%esi
+ 685:	84 db                	test   %bl,%bl
+ 687:	74 67                	je     6f0 <printf+0x80>
+ 689:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 68c:	31 d2                	xor    %edx,%edx
+ 68e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 691:	eb 34                	jmp    6c7 <printf+0x57>
+ 693:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 697:	90                   	nop
+ 698:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 69b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6a0:	83 f8 25             	cmp    $0x25,%eax
+ 6a3:	74 18                	je     6bd <printf+0x4d>
+  write(fd, &c, 1);
+ 6a5:	83 ec 04             	sub    $0x4,%esp
+ 6a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6ae:	6a 01                	push   $0x1
+ 6b0:	50                   	push   %eax
+ 6b1:	57                   	push   %edi
+ 6b2:	e8 cd fd ff ff       	call   484 <write>
+ 6b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6c0:	83 c6 01             	add    $0x1,%esi
+ 6c3:	84 db                	test   %bl,%bl
+ 6c5:	74 29                	je     6f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ca:	85 d2                	test   %edx,%edx
+ 6cc:	74 ca                	je     698 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6ce:	83 fa 25             	cmp    $0x25,%edx
+ 6d1:	75 ea                	jne    6bd <printf+0x4d>
+      if(c == 'd'){
+ 6d3:	83 f8 25             	cmp    $0x25,%eax
+ 6d6:	0f 84 24 01 00 00    	je     800 <printf+0x190>
+ 6dc:	83 e8 63             	sub    $0x63,%eax
+ 6df:	83 f8 15             	cmp    $0x15,%eax
+ 6e2:	77 1c                	ja     700 <printf+0x90>
+ 6e4:	ff 24 85 68 0b 00 00 	jmp    *0xb68(,%eax,4)
+ 6eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6f3:	5b                   	pop    %ebx
+ 6f4:	5e                   	pop    %esi
+ 6f5:	5f                   	pop    %edi
+ 6f6:	5d                   	pop    %ebp
+ 6f7:	c3                   	ret
+ 6f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+  write(fd, &c, 1);
+ 700:	83 ec 04             	sub    $0x4,%esp
+ 703:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 706:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 70a:	6a 01                	push   $0x1
+ 70c:	52                   	push   %edx
+ 70d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 710:	57                   	push   %edi
+ 711:	e8 6e fd ff ff       	call   484 <write>
+ 716:	83 c4 0c             	add    $0xc,%esp
+ 719:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 71c:	6a 01                	push   $0x1
+ 71e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 721:	52                   	push   %edx
+ 722:	57                   	push   %edi
+ 723:	e8 5c fd ff ff       	call   484 <write>
+        putc(fd, c);
+ 728:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 72b:	31 d2                	xor    %edx,%edx
+ 72d:	eb 8e                	jmp    6bd <printf+0x4d>
+ 72f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 730:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 73b:	8b 13                	mov    (%ebx),%edx
+ 73d:	6a 00                	push   $0x0
+ 73f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 741:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 744:	e8 87 fe ff ff       	call   5d0 <printint>
+        ap++;
+ 749:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 74c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 74f:	31 d2                	xor    %edx,%edx
+ 751:	e9 67 ff ff ff       	jmp    6bd <printf+0x4d>
+ 756:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 75d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 760:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 763:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 765:	83 c0 04             	add    $0x4,%eax
+ 768:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 76b:	85 db                	test   %ebx,%ebx
+ 76d:	0f 84 9d 00 00 00    	je     810 <printf+0x1a0>
+        while(*s != 0){
+ 773:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 776:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 778:	84 c0                	test   %al,%al
+ 77a:	0f 84 3d ff ff ff    	je     6bd <printf+0x4d>
+ 780:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 783:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 786:	89 de                	mov    %ebx,%esi
+ 788:	89 d3                	mov    %edx,%ebx
+ 78a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 790:	83 ec 04             	sub    $0x4,%esp
+ 793:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 796:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 799:	6a 01                	push   $0x1
+ 79b:	53                   	push   %ebx
+ 79c:	57                   	push   %edi
+ 79d:	e8 e2 fc ff ff       	call   484 <write>
+        while(*s != 0){
+ 7a2:	0f b6 06             	movzbl (%esi),%eax
+ 7a5:	83 c4 10             	add    $0x10,%esp
+ 7a8:	84 c0                	test   %al,%al
+ 7aa:	75 e4                	jne    790 <printf+0x120>
+      state = 0;
+ 7ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7af:	31 d2                	xor    %edx,%edx
+ 7b1:	e9 07 ff ff ff       	jmp    6bd <printf+0x4d>
+ 7b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7cb:	8b 13                	mov    (%ebx),%edx
+ 7cd:	6a 01                	push   $0x1
+ 7cf:	e9 6b ff ff ff       	jmp    73f <printf+0xcf>
+ 7d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7db:	83 ec 04             	sub    $0x4,%esp
+ 7de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7e9:	6a 01                	push   $0x1
+ 7eb:	52                   	push   %edx
+ 7ec:	57                   	push   %edi
+ 7ed:	e8 92 fc ff ff       	call   484 <write>
+        ap++;
+ 7f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7f8:	31 d2                	xor    %edx,%edx
+ 7fa:	e9 be fe ff ff       	jmp    6bd <printf+0x4d>
+ 7ff:	90                   	nop
+  write(fd, &c, 1);
+ 800:	83 ec 04             	sub    $0x4,%esp
+ 803:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 806:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 809:	6a 01                	push   $0x1
+ 80b:	e9 11 ff ff ff       	jmp    721 <printf+0xb1>
+ 810:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 815:	bb 61 0b 00 00       	mov    $0xb61,%ebx
+ 81a:	e9 61 ff ff ff       	jmp    780 <printf+0x110>
+ 81f:	90                   	nop
+
+00000820 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 820:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 821:	a1 60 10 00 00       	mov    0x1060,%eax
+{
+ 826:	89 e5                	mov    %esp,%ebp
+ 828:	57                   	push   %edi
+ 829:	56                   	push   %esi
+ 82a:	53                   	push   %ebx
+ 82b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 82e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 831:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 838:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 83a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 83c:	39 ca                	cmp    %ecx,%edx
+ 83e:	73 30                	jae    870 <free+0x50>
+ 840:	39 c1                	cmp    %eax,%ecx
+ 842:	72 04                	jb     848 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 844:	39 c2                	cmp    %eax,%edx
+ 846:	72 f0                	jb     838 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 848:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 84b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 84e:	39 f8                	cmp    %edi,%eax
+ 850:	74 2e                	je     880 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 852:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 855:	8b 42 04             	mov    0x4(%edx),%eax
+ 858:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 85b:	39 f1                	cmp    %esi,%ecx
+ 85d:	74 38                	je     897 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 85f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 861:	5b                   	pop    %ebx
+  freep = p;
+ 862:	89 15 60 10 00 00    	mov    %edx,0x1060
+}
+ 868:	5e                   	pop    %esi
+ 869:	5f                   	pop    %edi
+ 86a:	5d                   	pop    %ebp
+ 86b:	c3                   	ret
+ 86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 870:	39 c1                	cmp    %eax,%ecx
+ 872:	72 d0                	jb     844 <free+0x24>
+ 874:	eb c2                	jmp    838 <free+0x18>
+ 876:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 880:	03 70 04             	add    0x4(%eax),%esi
+ 883:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 886:	8b 02                	mov    (%edx),%eax
+ 888:	8b 00                	mov    (%eax),%eax
+ 88a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 88d:	8b 42 04             	mov    0x4(%edx),%eax
+ 890:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 893:	39 f1                	cmp    %esi,%ecx
+ 895:	75 c8                	jne    85f <free+0x3f>
+    p->s.size += bp->s.size;
+ 897:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 89a:	89 15 60 10 00 00    	mov    %edx,0x1060
+    p->s.size += bp->s.size;
+ 8a0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8a3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8a6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8a8:	5b                   	pop    %ebx
+ 8a9:	5e                   	pop    %esi
+ 8aa:	5f                   	pop    %edi
+ 8ab:	5d                   	pop    %ebp
+ 8ac:	c3                   	ret
+ 8ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008b0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	57                   	push   %edi
+ 8b4:	56                   	push   %esi
+ 8b5:	53                   	push   %ebx
+ 8b6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8bc:	8b 15 60 10 00 00    	mov    0x1060,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8c2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8c5:	c1 ef 03             	shr    $0x3,%edi
+ 8c8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8cb:	85 d2                	test   %edx,%edx
+ 8cd:	0f 84 8d 00 00 00    	je     960 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8d3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8d5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8d8:	39 f9                	cmp    %edi,%ecx
+ 8da:	73 64                	jae    940 <malloc+0x90>
+  if(nu < 4096)
+ 8dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8e1:	39 df                	cmp    %ebx,%edi
+ 8e3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8e6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8ed:	eb 0a                	jmp    8f9 <malloc+0x49>
+ 8ef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8f0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8f2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8f5:	39 f9                	cmp    %edi,%ecx
+ 8f7:	73 47                	jae    940 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8f9:	89 c2                	mov    %eax,%edx
+ 8fb:	39 05 60 10 00 00    	cmp    %eax,0x1060
+ 901:	75 ed                	jne    8f0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 903:	83 ec 0c             	sub    $0xc,%esp
+ 906:	56                   	push   %esi
+ 907:	e8 e0 fb ff ff       	call   4ec <sbrk>
+  if(p == (char*)-1)
+ 90c:	83 c4 10             	add    $0x10,%esp
+ 90f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 912:	74 1c                	je     930 <malloc+0x80>
+  hp->s.size = nu;
+ 914:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 917:	83 ec 0c             	sub    $0xc,%esp
+ 91a:	83 c0 08             	add    $0x8,%eax
+ 91d:	50                   	push   %eax
+ 91e:	e8 fd fe ff ff       	call   820 <free>
+  return freep;
+ 923:	8b 15 60 10 00 00    	mov    0x1060,%edx
+      if((p = morecore(nunits)) == 0)
+ 929:	83 c4 10             	add    $0x10,%esp
+ 92c:	85 d2                	test   %edx,%edx
+ 92e:	75 c0                	jne    8f0 <malloc+0x40>
+        return 0;
+  }
+}
+ 930:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 933:	31 c0                	xor    %eax,%eax
+}
+ 935:	5b                   	pop    %ebx
+ 936:	5e                   	pop    %esi
+ 937:	5f                   	pop    %edi
+ 938:	5d                   	pop    %ebp
+ 939:	c3                   	ret
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 940:	39 cf                	cmp    %ecx,%edi
+ 942:	74 4c                	je     990 <malloc+0xe0>
+        p->s.size -= nunits;
+ 944:	29 f9                	sub    %edi,%ecx
+ 946:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 949:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 94c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 94f:	89 15 60 10 00 00    	mov    %edx,0x1060
+}
+ 955:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 958:	83 c0 08             	add    $0x8,%eax
+}
+ 95b:	5b                   	pop    %ebx
+ 95c:	5e                   	pop    %esi
+ 95d:	5f                   	pop    %edi
+ 95e:	5d                   	pop    %ebp
+ 95f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 960:	c7 05 60 10 00 00 64 	movl   $0x1064,0x1060
+ 967:	10 00 00 
+    base.s.size = 0;
+ 96a:	b8 64 10 00 00       	mov    $0x1064,%eax
+    base.s.ptr = freep = prevp = &base;
+ 96f:	c7 05 64 10 00 00 64 	movl   $0x1064,0x1064
+ 976:	10 00 00 
+    base.s.size = 0;
+ 979:	c7 05 68 10 00 00 00 	movl   $0x0,0x1068
+ 980:	00 00 00 
+    if(p->s.size >= nunits){
+ 983:	e9 54 ff ff ff       	jmp    8dc <malloc+0x2c>
+ 988:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 990:	8b 08                	mov    (%eax),%ecx
+ 992:	89 0a                	mov    %ecx,(%edx)
+ 994:	eb b9                	jmp    94f <malloc+0x9f>
+ 996:	66 90                	xchg   %ax,%ax
+ 998:	66 90                	xchg   %ax,%ax
+ 99a:	66 90                	xchg   %ax,%ax
+ 99c:	66 90                	xchg   %ax,%ax
+ 99e:	66 90                	xchg   %ax,%ax
+
+000009a0 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ 9a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9a9:	c1 e0 04             	shl    $0x4,%eax
+ 9ac:	ff b0 ac 10 00 00    	push   0x10ac(%eax)
+ 9b2:	05 a0 10 00 00       	add    $0x10a0,%eax
+ 9b7:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ 9ba:	e8 a5 fa ff ff       	call   464 <exit>
+ 9bf:	90                   	nop
+
+000009c0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ 9c6:	31 db                	xor    %ebx,%ebx
+{
+ 9c8:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ 9cb:	68 80 10 00 00       	push   $0x1080
+ 9d0:	e8 eb f8 ff ff       	call   2c0 <lock_acquire>
+ 9d5:	83 c4 10             	add    $0x10,%esp
+ 9d8:	eb 12                	jmp    9ec <thread_create+0x2c>
+ 9da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ 9e0:	83 c3 01             	add    $0x1,%ebx
+ 9e3:	83 fb 40             	cmp    $0x40,%ebx
+ 9e6:	0f 84 c4 00 00 00    	je     ab0 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ 9ec:	89 de                	mov    %ebx,%esi
+ 9ee:	c1 e6 04             	shl    $0x4,%esi
+ 9f1:	8b 96 a0 10 00 00    	mov    0x10a0(%esi),%edx
+ 9f7:	85 d2                	test   %edx,%edx
+ 9f9:	75 e5                	jne    9e0 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ 9fb:	83 ec 0c             	sub    $0xc,%esp
+ 9fe:	68 00 20 00 00       	push   $0x2000
+ a03:	e8 a8 fe ff ff       	call   8b0 <malloc>
+ a08:	83 c4 10             	add    $0x10,%esp
+ a0b:	85 c0                	test   %eax,%eax
+ a0d:	0f 84 9d 00 00 00    	je     ab0 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ a13:	89 86 a4 10 00 00    	mov    %eax,0x10a4(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ a19:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ a1e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ a21:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ a26:	89 86 a0 10 00 00    	mov    %eax,0x10a0(%esi)
+  threads[i].fn = fn;
+ a2c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a2f:	89 86 a8 10 00 00    	mov    %eax,0x10a8(%esi)
+  threads[i].arg = arg;
+ a35:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a38:	89 86 ac 10 00 00    	mov    %eax,0x10ac(%esi)
+  lock_release(&threadslock);
+ a3e:	68 80 10 00 00       	push   $0x1080
+ a43:	e8 98 f8 ff ff       	call   2e0 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ a48:	83 c4 0c             	add    $0xc,%esp
+ a4b:	ff b6 a0 10 00 00    	push   0x10a0(%esi)
+ a51:	53                   	push   %ebx
+ a52:	68 a0 09 00 00       	push   $0x9a0
+ a57:	e8 10 fb ff ff       	call   56c <clone>
+ a5c:	83 c4 10             	add    $0x10,%esp
+ a5f:	85 c0                	test   %eax,%eax
+ a61:	78 0d                	js     a70 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ a63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a66:	5b                   	pop    %ebx
+ a67:	5e                   	pop    %esi
+ a68:	5f                   	pop    %edi
+ a69:	5d                   	pop    %ebp
+ a6a:	c3                   	ret
+ a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+    lock_acquire(&threadslock);
+ a70:	83 ec 0c             	sub    $0xc,%esp
+ a73:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ a76:	68 80 10 00 00       	push   $0x1080
+ a7b:	e8 40 f8 ff ff       	call   2c0 <lock_acquire>
+    free(threads[i].block);
+ a80:	58                   	pop    %eax
+ a81:	ff b6 a4 10 00 00    	push   0x10a4(%esi)
+ a87:	e8 94 fd ff ff       	call   820 <free>
+    threads[i].stack = 0;
+ a8c:	c7 86 a0 10 00 00 00 	movl   $0x0,0x10a0(%esi)
+ a93:	00 00 00 
+    lock_release(&threadslock);
+ a96:	c7 04 24 80 10 00 00 	movl   $0x1080,(%esp)
+ a9d:	e8 3e f8 ff ff       	call   2e0 <lock_release>
+ aa2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ aa5:	83 c4 10             	add    $0x10,%esp
+}
+ aa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ aab:	5b                   	pop    %ebx
+ aac:	5e                   	pop    %esi
+ aad:	5f                   	pop    %edi
+ aae:	5d                   	pop    %ebp
+ aaf:	c3                   	ret
+    lock_release(&threadslock);
+ ab0:	83 ec 0c             	sub    $0xc,%esp
+ ab3:	68 80 10 00 00       	push   $0x1080
+ ab8:	e8 23 f8 ff ff       	call   2e0 <lock_release>
+    return -1;
+ abd:	83 c4 10             	add    $0x10,%esp
+ ac0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ac5:	eb 9c                	jmp    a63 <thread_create+0xa3>
+ ac7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ace:	66 90                	xchg   %ax,%ax
+
+00000ad0 <thread_join>:
+
+int
+thread_join(void)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	56                   	push   %esi
+ ad4:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ ad5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ ad8:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ adb:	50                   	push   %eax
+ adc:	e8 93 fa ff ff       	call   574 <join>
+ ae1:	83 c4 10             	add    $0x10,%esp
+ ae4:	85 c0                	test   %eax,%eax
+ ae6:	78 69                	js     b51 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ ae8:	83 ec 0c             	sub    $0xc,%esp
+ aeb:	89 c6                	mov    %eax,%esi
+ aed:	68 80 10 00 00       	push   $0x1080
+ af2:	e8 c9 f7 ff ff       	call   2c0 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ af7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ afa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ afd:	31 c0                	xor    %eax,%eax
+ aff:	eb 0f                	jmp    b10 <thread_join+0x40>
+ b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b08:	83 c0 01             	add    $0x1,%eax
+ b0b:	83 f8 40             	cmp    $0x40,%eax
+ b0e:	74 28                	je     b38 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ b10:	89 c3                	mov    %eax,%ebx
+ b12:	c1 e3 04             	shl    $0x4,%ebx
+ b15:	39 93 a0 10 00 00    	cmp    %edx,0x10a0(%ebx)
+ b1b:	75 eb                	jne    b08 <thread_join+0x38>
+      free(threads[i].block);
+ b1d:	83 ec 0c             	sub    $0xc,%esp
+ b20:	ff b3 a4 10 00 00    	push   0x10a4(%ebx)
+ b26:	e8 f5 fc ff ff       	call   820 <free>
+      threads[i].stack = 0;
+      break;
+ b2b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ b2e:	c7 83 a0 10 00 00 00 	movl   $0x0,0x10a0(%ebx)
+ b35:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ b38:	83 ec 0c             	sub    $0xc,%esp
+ b3b:	68 80 10 00 00       	push   $0x1080
+ b40:	e8 9b f7 ff ff       	call   2e0 <lock_release>
+  return pid;
+ b45:	83 c4 10             	add    $0x10,%esp
+}
+ b48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b4b:	89 f0                	mov    %esi,%eax
+ b4d:	5b                   	pop    %ebx
+ b4e:	5e                   	pop    %esi
+ b4f:	5d                   	pop    %ebp
+ b50:	c3                   	ret
+    return -1;
+ b51:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ b56:	eb f0                	jmp    b48 <thread_join+0x78>
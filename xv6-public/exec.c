@@ -2,6 +2,8 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
+#include "sleeplock.h"
 #include "proc.h"
 #include "defs.h"
 #include "x86.h"
@@ -11,12 +13,13 @@ int
 exec(char *path, char **argv)
 {
   char *s, *last;
-  int i, off;
+  int i, off, sole;
   uint argc, sz, sp, ustack[3+MAXARG+1];
   struct elfhdr elf;
   struct inode *ip;
   struct proghdr ph;
   pde_t *pgdir, *oldpgdir;
+  struct vmspace *vm;
   struct proc *curproc = myproc();
 
   begin_op();
@@ -28,6 +31,7 @@ exec(char *path, char **argv)
   }
   ilock(ip);
   pgdir = 0;
+  vm = 0;
 
   // Check ELF header
   if(readi(ip, (char*)&elf, 0, sizeof(elf)) != sizeof(elf))
@@ -93,6 +97,15 @@ exec(char *path, char **argv)
       last = s+1;
   safestrcpy(curproc->name, last, sizeof(curproc->name));
 
+  // A thread leaves its siblings the old address space
+  // and takes a vmspace and descriptor table of its own.
+  if(curproc->vm->nlive > 1 && (vm = allocvm(pgdir)) == 0)
+    goto bad;
+  if(unsharefdt(curproc) < 0)
+    goto bad;
+  if((sole = vmexec(curproc, pgdir, vm)) < 0)
+    goto bad;
+
   // Commit to the user image.
   oldpgdir = curproc->pgdir;
   curproc->pgdir = pgdir;
@@ -100,10 +113,15 @@ exec(char *path, char **argv)
   curproc->tf->eip = elf.entry;  // main
   curproc->tf->esp = sp;
   switchuvm(curproc);
-  freevm(oldpgdir);
+  if(sole){
+    curproc->vm->npinned -= unpinuvm(oldpgdir, 0, KERNBASE);
+    freevm(oldpgdir);
+  }
   return 0;
 
  bad:
+  if(vm)
+    vmexec(0, 0, vm);
   if(pgdir)
     freevm(pgdir);
   if(ip){
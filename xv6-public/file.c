@@ -113,45 +113,54 @@ fileread(struct file *f, char *addr, int n)
 }
 
 //PAGEBREAK!
+// Write n bytes from addr to f's inode at offset *off,
+// advancing *off past whatever was written.
+int
+filewriteat(struct file *f, char *addr, int n, uint *off)
+{
+  int r = 0;
+
+  // write as many blocks at a time as one op may
+  // reserve in the log, including i-node, two indirect
+  // blocks per level in case the write crosses from one
+  // to the next, allocation blocks, and 2 blocks of slop
+  // for non-aligned writes, and reserve only what each
+  // piece needs.
+  // this really belongs lower down, since writei()
+  // might be writing a device like the console.
+  int max = ((log_opmax()-1-2*NLEVEL) / 2 - 1) * BSIZE;
+  int i = 0;
+  while(i < n){
+    int n1 = n - i;
+    if(n1 > max)
+      n1 = max;
+
+    begin_opn(1 + 2*NLEVEL + 2 * ((n1 + BSIZE-1) / BSIZE + 1));
+    ilock(f->ip);
+    if ((r = writei(f->ip, addr + i, *off, n1)) > 0)
+      *off += r;
+    iunlock(f->ip);
+    end_op();
+
+    if(r < 0)
+      break;
+    if(r != n1)
+      panic("short filewrite");
+    i += r;
+  }
+  return i == n ? n : -1;
+}
+
 // Write to file f.
 int
 filewrite(struct file *f, char *addr, int n)
 {
-  int r;
-
   if(f->writable == 0)
     return -1;
   if(f->type == FD_PIPE)
     return pipewrite(f->pipe, addr, n);
-  if(f->type == FD_INODE){
-    // write a few blocks at a time to avoid exceeding
-    // the maximum log transaction size, including
-    // i-node, indirect block, allocation blocks,
-    // and 2 blocks of slop for non-aligned writes.
-    // this really belongs lower down, since writei()
-    // might be writing a device like the console.
-    int max = ((MAXOPBLOCKS-1-1-2) / 2) * 512;
-    int i = 0;
-    while(i < n){
-      int n1 = n - i;
-      if(n1 > max)
-        n1 = max;
-
-      begin_op();
-      ilock(f->ip);
-      if ((r = writei(f->ip, addr + i, f->off, n1)) > 0)
-        f->off += r;
-      iunlock(f->ip);
-      end_op();
-
-      if(r < 0)
-        break;
-      if(r != n1)
-        panic("short filewrite");
-      i += r;
-    }
-    return i == n ? n : -1;
-  }
+  if(f->type == FD_INODE)
+    return filewriteat(f, addr, n, &f->off);
   panic("filewrite");
 }
 
@@ -22,7 +22,11 @@ struct inode {
   short minor;
   short nlink;
   uint size;
-  uint addrs[NDIRECT+1];
+  uint addrs[NDIRECT+NLEVEL];
+  uint lastblock;     // block bmap last allocated; the next goes after it
+
+  uint ranext;        // block a sequential reader would read next
+  uint raend;         // first block not yet read ahead
 };
 
 // table mapping major device number to
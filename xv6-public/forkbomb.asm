@@ -0,0 +1,2012 @@
+
+_forkbomb:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#define BATCH  256   // forks per timed batch
+#define NKILL  1000  // kill calls to time
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  int n, i, pid, start, batch, fds[2];
+  char c;
+
+  n = 2048;
+  if(argc > 1)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1a:	0f 8e 43 01 00 00    	jle    163 <main+0x163>
+    n = atoi(argv[1]);
+  20:	83 ec 0c             	sub    $0xc,%esp
+  23:	ff 70 04             	push   0x4(%eax)
+  26:	e8 c5 03 00 00       	call   3f0 <atoi>
+  if(n < 1){
+  2b:	83 c4 10             	add    $0x10,%esp
+    n = atoi(argv[1]);
+  2e:	89 c6                	mov    %eax,%esi
+  if(n < 1){
+  30:	85 c0                	test   %eax,%eax
+  32:	0f 8e 48 01 00 00    	jle    180 <main+0x180>
+    printf(2, "usage: forkbomb [n]\n");
+    exit();
+  }
+  if(pipe(fds) < 0){
+  38:	83 ec 0c             	sub    $0xc,%esp
+  3b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  3e:	50                   	push   %eax
+  3f:	e8 e0 05 00 00       	call   624 <pipe>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	0f 88 1e 01 00 00    	js     16d <main+0x16d>
+    printf(2, "forkbomb: pipe failed\n");
+    exit();
+  }
+
+  printf(1, "forkbomb: forking %d children\n", n);
+  4f:	50                   	push   %eax
+  start = batch = uptime();
+  for(i = 0; i < n; i++){
+  50:	31 ff                	xor    %edi,%edi
+  printf(1, "forkbomb: forking %d children\n", n);
+  52:	56                   	push   %esi
+  53:	68 7c 0d 00 00       	push   $0xd7c
+  58:	6a 01                	push   $0x1
+  5a:	e8 c1 07 00 00       	call   820 <printf>
+  start = batch = uptime();
+  5f:	e8 48 06 00 00       	call   6ac <uptime>
+  64:	83 c4 10             	add    $0x10,%esp
+  67:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  6a:	89 c3                	mov    %eax,%ebx
+  6c:	eb 08                	jmp    76 <main+0x76>
+  6e:	66 90                	xchg   %ax,%ax
+  for(i = 0; i < n; i++){
+  70:	39 f1                	cmp    %esi,%ecx
+  72:	74 51                	je     c5 <main+0xc5>
+  74:	89 cf                	mov    %ecx,%edi
+    if((pid = fork()) < 0){
+  76:	e8 91 05 00 00       	call   60c <fork>
+  7b:	85 c0                	test   %eax,%eax
+  7d:	0f 88 2d 01 00 00    	js     1b0 <main+0x1b0>
+      printf(1, "forkbomb: fork failed after %d children\n", i);
+      break;
+    }
+    if(pid == 0){
+  83:	0f 84 3f 01 00 00    	je     1c8 <main+0x1c8>
+      close(fds[1]);
+      read(fds[0], &c, 1);  // returns 0 once the parent closes fds[1]
+      exit();
+    }
+    if((i + 1) % BATCH == 0){
+  89:	89 f8                	mov    %edi,%eax
+  8b:	8d 4f 01             	lea    0x1(%edi),%ecx
+  8e:	3c ff                	cmp    $0xff,%al
+  90:	75 de                	jne    70 <main+0x70>
+  92:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+      printf(1, "forkbomb: children %d-%d: %d ticks\n",
+             i + 1 - BATCH, i, uptime() - batch);
+  95:	e8 12 06 00 00       	call   6ac <uptime>
+      printf(1, "forkbomb: children %d-%d: %d ticks\n",
+  9a:	83 ec 0c             	sub    $0xc,%esp
+  9d:	8d 97 01 ff ff ff    	lea    -0xff(%edi),%edx
+  a3:	29 d8                	sub    %ebx,%eax
+  a5:	50                   	push   %eax
+  a6:	57                   	push   %edi
+  a7:	52                   	push   %edx
+  a8:	68 c8 0d 00 00       	push   $0xdc8
+  ad:	6a 01                	push   $0x1
+  af:	e8 6c 07 00 00       	call   820 <printf>
+      batch = uptime();
+  b4:	83 c4 20             	add    $0x20,%esp
+  b7:	e8 f0 05 00 00       	call   6ac <uptime>
+  bc:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  bf:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < n; i++){
+  c1:	39 f1                	cmp    %esi,%ecx
+  c3:	75 af                	jne    74 <main+0x74>
+    }
+  }
+  n = i;
+  printf(1, "forkbomb: %d children in %d ticks\n", n, uptime() - start);
+  c5:	e8 e2 05 00 00       	call   6ac <uptime>
+  ca:	8b 55 d0             	mov    -0x30(%ebp),%edx
+
+  start = uptime();
+  cd:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  printf(1, "forkbomb: %d children in %d ticks\n", n, uptime() - start);
+  d2:	29 d0                	sub    %edx,%eax
+  d4:	50                   	push   %eax
+  d5:	56                   	push   %esi
+  d6:	68 ec 0d 00 00       	push   $0xdec
+  db:	6a 01                	push   $0x1
+  dd:	e8 3e 07 00 00       	call   820 <printf>
+  start = uptime();
+  e2:	e8 c5 05 00 00       	call   6ac <uptime>
+  e7:	83 c4 10             	add    $0x10,%esp
+  ea:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < NKILL; i++)
+  ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    kill(-1);
+  f0:	83 ec 0c             	sub    $0xc,%esp
+  f3:	6a ff                	push   $0xffffffff
+  f5:	e8 4a 05 00 00       	call   644 <kill>
+  for(i = 0; i < NKILL; i++)
+  fa:	83 c4 10             	add    $0x10,%esp
+  fd:	83 eb 01             	sub    $0x1,%ebx
+ 100:	75 ee                	jne    f0 <main+0xf0>
+  printf(1, "forkbomb: %d kills of a missing pid: %d ticks\n",
+         NKILL, uptime() - start);
+ 102:	e8 a5 05 00 00       	call   6ac <uptime>
+  printf(1, "forkbomb: %d kills of a missing pid: %d ticks\n",
+ 107:	29 f8                	sub    %edi,%eax
+ 109:	50                   	push   %eax
+ 10a:	68 e8 03 00 00       	push   $0x3e8
+ 10f:	68 10 0e 00 00       	push   $0xe10
+ 114:	6a 01                	push   $0x1
+ 116:	e8 05 07 00 00       	call   820 <printf>
+
+  start = uptime();
+ 11b:	e8 8c 05 00 00       	call   6ac <uptime>
+ 120:	89 c7                	mov    %eax,%edi
+  close(fds[1]);
+ 122:	58                   	pop    %eax
+ 123:	ff 75 e4             	push   -0x1c(%ebp)
+ 126:	e8 11 05 00 00       	call   63c <close>
+  for(i = 0; i < n; i++){
+ 12b:	83 c4 10             	add    $0x10,%esp
+ 12e:	85 f6                	test   %esi,%esi
+ 130:	74 61                	je     193 <main+0x193>
+ 132:	31 db                	xor    %ebx,%ebx
+ 134:	eb 11                	jmp    147 <main+0x147>
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+ 140:	83 c3 01             	add    $0x1,%ebx
+ 143:	39 f3                	cmp    %esi,%ebx
+ 145:	74 4c                	je     193 <main+0x193>
+    if(wait() < 0){
+ 147:	e8 d0 04 00 00       	call   61c <wait>
+ 14c:	85 c0                	test   %eax,%eax
+ 14e:	79 f0                	jns    140 <main+0x140>
+      printf(1, "forkbomb: wait stopped early\n");
+ 150:	53                   	push   %ebx
+ 151:	53                   	push   %ebx
+ 152:	68 34 0d 00 00       	push   $0xd34
+ 157:	6a 01                	push   $0x1
+ 159:	e8 c2 06 00 00       	call   820 <printf>
+      exit();
+ 15e:	e8 b1 04 00 00       	call   614 <exit>
+  n = 2048;
+ 163:	be 00 08 00 00       	mov    $0x800,%esi
+ 168:	e9 cb fe ff ff       	jmp    38 <main+0x38>
+    printf(2, "forkbomb: pipe failed\n");
+ 16d:	50                   	push   %eax
+ 16e:	50                   	push   %eax
+ 16f:	68 1d 0d 00 00       	push   $0xd1d
+ 174:	6a 02                	push   $0x2
+ 176:	e8 a5 06 00 00       	call   820 <printf>
+    exit();
+ 17b:	e8 94 04 00 00       	call   614 <exit>
+    printf(2, "usage: forkbomb [n]\n");
+ 180:	50                   	push   %eax
+ 181:	50                   	push   %eax
+ 182:	68 08 0d 00 00       	push   $0xd08
+ 187:	6a 02                	push   $0x2
+ 189:	e8 92 06 00 00       	call   820 <printf>
+    exit();
+ 18e:	e8 81 04 00 00       	call   614 <exit>
+    }
+  }
+  if(wait() != -1){
+ 193:	e8 84 04 00 00       	call   61c <wait>
+ 198:	83 c0 01             	add    $0x1,%eax
+ 19b:	74 4c                	je     1e9 <main+0x1e9>
+    printf(1, "forkbomb: wait got too many\n");
+ 19d:	51                   	push   %ecx
+ 19e:	51                   	push   %ecx
+ 19f:	68 52 0d 00 00       	push   $0xd52
+ 1a4:	6a 01                	push   $0x1
+ 1a6:	e8 75 06 00 00       	call   820 <printf>
+    exit();
+ 1ab:	e8 64 04 00 00       	call   614 <exit>
+      printf(1, "forkbomb: fork failed after %d children\n", i);
+ 1b0:	50                   	push   %eax
+      break;
+ 1b1:	89 fe                	mov    %edi,%esi
+      printf(1, "forkbomb: fork failed after %d children\n", i);
+ 1b3:	57                   	push   %edi
+ 1b4:	68 9c 0d 00 00       	push   $0xd9c
+ 1b9:	6a 01                	push   $0x1
+ 1bb:	e8 60 06 00 00       	call   820 <printf>
+      break;
+ 1c0:	83 c4 10             	add    $0x10,%esp
+ 1c3:	e9 fd fe ff ff       	jmp    c5 <main+0xc5>
+      close(fds[1]);
+ 1c8:	83 ec 0c             	sub    $0xc,%esp
+ 1cb:	ff 75 e4             	push   -0x1c(%ebp)
+ 1ce:	e8 69 04 00 00       	call   63c <close>
+      read(fds[0], &c, 1);  // returns 0 once the parent closes fds[1]
+ 1d3:	83 c4 0c             	add    $0xc,%esp
+ 1d6:	8d 45 df             	lea    -0x21(%ebp),%eax
+ 1d9:	6a 01                	push   $0x1
+ 1db:	50                   	push   %eax
+ 1dc:	ff 75 e0             	push   -0x20(%ebp)
+ 1df:	e8 48 04 00 00       	call   62c <read>
+      exit();
+ 1e4:	e8 2b 04 00 00       	call   614 <exit>
+  }
+  printf(1, "forkbomb: waited for %d children in %d ticks\n",
+         n, uptime() - start);
+ 1e9:	e8 be 04 00 00       	call   6ac <uptime>
+  printf(1, "forkbomb: waited for %d children in %d ticks\n",
+ 1ee:	29 f8                	sub    %edi,%eax
+ 1f0:	50                   	push   %eax
+ 1f1:	56                   	push   %esi
+ 1f2:	68 40 0e 00 00       	push   $0xe40
+ 1f7:	6a 01                	push   $0x1
+ 1f9:	e8 22 06 00 00       	call   820 <printf>
+  printf(1, "forkbomb ok\n");
+ 1fe:	58                   	pop    %eax
+ 1ff:	5a                   	pop    %edx
+ 200:	68 6f 0d 00 00       	push   $0xd6f
+ 205:	6a 01                	push   $0x1
+ 207:	e8 14 06 00 00       	call   820 <printf>
+  exit();
+ 20c:	e8 03 04 00 00       	call   614 <exit>
+ 211:	66 90                	xchg   %ax,%ax
+ 213:	66 90                	xchg   %ax,%ax
+ 215:	66 90                	xchg   %ax,%ax
+ 217:	66 90                	xchg   %ax,%ax
+ 219:	66 90                	xchg   %ax,%ax
+ 21b:	66 90                	xchg   %ax,%ax
+ 21d:	66 90                	xchg   %ax,%ax
+ 21f:	90                   	nop
+
+00000220 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 220:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 221:	31 c0                	xor    %eax,%eax
+{
+ 223:	89 e5                	mov    %esp,%ebp
+ 225:	53                   	push   %ebx
+ 226:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 229:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 22c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 230:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 234:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 237:	83 c0 01             	add    $0x1,%eax
+ 23a:	84 d2                	test   %dl,%dl
+ 23c:	75 f2                	jne    230 <strcpy+0x10>
+    ;
+  return os;
+}
+ 23e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 241:	89 c8                	mov    %ecx,%eax
+ 243:	c9                   	leave
+ 244:	c3                   	ret
+ 245:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+ 257:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 25a:	0f b6 02             	movzbl (%edx),%eax
+ 25d:	84 c0                	test   %al,%al
+ 25f:	75 17                	jne    278 <strcmp+0x28>
+ 261:	eb 3a                	jmp    29d <strcmp+0x4d>
+ 263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 267:	90                   	nop
+ 268:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 26c:	83 c2 01             	add    $0x1,%edx
+ 26f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 272:	84 c0                	test   %al,%al
+ 274:	74 1a                	je     290 <strcmp+0x40>
+    p++, q++;
+ 276:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 278:	0f b6 19             	movzbl (%ecx),%ebx
+ 27b:	38 c3                	cmp    %al,%bl
+ 27d:	74 e9                	je     268 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 27f:	29 d8                	sub    %ebx,%eax
+}
+ 281:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 284:	c9                   	leave
+ 285:	c3                   	ret
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 290:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 294:	31 c0                	xor    %eax,%eax
+ 296:	29 d8                	sub    %ebx,%eax
+}
+ 298:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 29b:	c9                   	leave
+ 29c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 29d:	0f b6 19             	movzbl (%ecx),%ebx
+ 2a0:	31 c0                	xor    %eax,%eax
+ 2a2:	eb db                	jmp    27f <strcmp+0x2f>
+ 2a4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2af:	90                   	nop
+
+000002b0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2b6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2b9:	74 15                	je     2d0 <strlen+0x20>
+ 2bb:	31 c0                	xor    %eax,%eax
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+ 2c0:	83 c0 01             	add    $0x1,%eax
+ 2c3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2c7:	89 c1                	mov    %eax,%ecx
+ 2c9:	75 f5                	jne    2c0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2cb:	89 c8                	mov    %ecx,%eax
+ 2cd:	5d                   	pop    %ebp
+ 2ce:	c3                   	ret
+ 2cf:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2d0:	31 c9                	xor    %ecx,%ecx
+}
+ 2d2:	5d                   	pop    %ebp
+ 2d3:	89 c8                	mov    %ecx,%eax
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002e0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	57                   	push   %edi
+ 2e4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2e7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ed:	89 d7                	mov    %edx,%edi
+ 2ef:	fc                   	cld
+ 2f0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2f2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2f5:	89 d0                	mov    %edx,%eax
+ 2f7:	c9                   	leave
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	8b 45 08             	mov    0x8(%ebp),%eax
+ 306:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 30a:	0f b6 10             	movzbl (%eax),%edx
+ 30d:	84 d2                	test   %dl,%dl
+ 30f:	75 12                	jne    323 <strchr+0x23>
+ 311:	eb 1d                	jmp    330 <strchr+0x30>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+ 318:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 31c:	83 c0 01             	add    $0x1,%eax
+ 31f:	84 d2                	test   %dl,%dl
+ 321:	74 0d                	je     330 <strchr+0x30>
+    if(*s == c)
+ 323:	38 d1                	cmp    %dl,%cl
+ 325:	75 f1                	jne    318 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 327:	5d                   	pop    %ebp
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 330:	31 c0                	xor    %eax,%eax
+}
+ 332:	5d                   	pop    %ebp
+ 333:	c3                   	ret
+ 334:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 33f:	90                   	nop
+
+00000340 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 345:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 348:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 349:	31 db                	xor    %ebx,%ebx
+{
+ 34b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 34e:	eb 27                	jmp    377 <gets+0x37>
+    cc = read(0, &c, 1);
+ 350:	83 ec 04             	sub    $0x4,%esp
+ 353:	6a 01                	push   $0x1
+ 355:	56                   	push   %esi
+ 356:	6a 00                	push   $0x0
+ 358:	e8 cf 02 00 00       	call   62c <read>
+    if(cc < 1)
+ 35d:	83 c4 10             	add    $0x10,%esp
+ 360:	85 c0                	test   %eax,%eax
+ 362:	7e 1d                	jle    381 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 364:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 368:	8b 55 08             	mov    0x8(%ebp),%edx
+ 36b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 36f:	3c 0a                	cmp    $0xa,%al
+ 371:	74 10                	je     383 <gets+0x43>
+ 373:	3c 0d                	cmp    $0xd,%al
+ 375:	74 0c                	je     383 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 377:	89 df                	mov    %ebx,%edi
+ 379:	83 c3 01             	add    $0x1,%ebx
+ 37c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 37f:	7c cf                	jl     350 <gets+0x10>
+ 381:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 38a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 38d:	5b                   	pop    %ebx
+ 38e:	5e                   	pop    %esi
+ 38f:	5f                   	pop    %edi
+ 390:	5d                   	pop    %ebp
+ 391:	c3                   	ret
+ 392:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 399:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003a0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	56                   	push   %esi
+ 3a4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3a5:	83 ec 08             	sub    $0x8,%esp
+ 3a8:	6a 00                	push   $0x0
+ 3aa:	ff 75 08             	push   0x8(%ebp)
+ 3ad:	e8 a2 02 00 00       	call   654 <open>
+  if(fd < 0)
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	78 27                	js     3e0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3b9:	83 ec 08             	sub    $0x8,%esp
+ 3bc:	ff 75 0c             	push   0xc(%ebp)
+ 3bf:	89 c3                	mov    %eax,%ebx
+ 3c1:	50                   	push   %eax
+ 3c2:	e8 a5 02 00 00       	call   66c <fstat>
+  close(fd);
+ 3c7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3ca:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3cc:	e8 6b 02 00 00       	call   63c <close>
+  return r;
+ 3d1:	83 c4 10             	add    $0x10,%esp
+}
+ 3d4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d7:	89 f0                	mov    %esi,%eax
+ 3d9:	5b                   	pop    %ebx
+ 3da:	5e                   	pop    %esi
+ 3db:	5d                   	pop    %ebp
+ 3dc:	c3                   	ret
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3e0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3e5:	eb ed                	jmp    3d4 <stat+0x34>
+ 3e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	53                   	push   %ebx
+ 3f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3f7:	0f be 02             	movsbl (%edx),%eax
+ 3fa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3fd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 400:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 405:	77 1e                	ja     425 <atoi+0x35>
+ 407:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 410:	83 c2 01             	add    $0x1,%edx
+ 413:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 416:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 41a:	0f be 02             	movsbl (%edx),%eax
+ 41d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 420:	80 fb 09             	cmp    $0x9,%bl
+ 423:	76 eb                	jbe    410 <atoi+0x20>
+  return n;
+}
+ 425:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 428:	89 c8                	mov    %ecx,%eax
+ 42a:	c9                   	leave
+ 42b:	c3                   	ret
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	57                   	push   %edi
+ 434:	56                   	push   %esi
+ 435:	8b 45 10             	mov    0x10(%ebp),%eax
+ 438:	8b 55 08             	mov    0x8(%ebp),%edx
+ 43b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 43e:	85 c0                	test   %eax,%eax
+ 440:	7e 13                	jle    455 <memmove+0x25>
+ 442:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 444:	89 d7                	mov    %edx,%edi
+ 446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 450:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 451:	39 f8                	cmp    %edi,%eax
+ 453:	75 fb                	jne    450 <memmove+0x20>
+  return vdst;
+}
+ 455:	5e                   	pop    %esi
+ 456:	89 d0                	mov    %edx,%eax
+ 458:	5f                   	pop    %edi
+ 459:	5d                   	pop    %ebp
+ 45a:	c3                   	ret
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 463:	8b 45 08             	mov    0x8(%ebp),%eax
+ 466:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 46c:	5d                   	pop    %ebp
+ 46d:	c3                   	ret
+ 46e:	66 90                	xchg   %ax,%ax
+
+00000470 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 470:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 471:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 476:	89 e5                	mov    %esp,%ebp
+ 478:	8b 55 08             	mov    0x8(%ebp),%edx
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+ 480:	89 c8                	mov    %ecx,%eax
+ 482:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 485:	85 c0                	test   %eax,%eax
+ 487:	75 f7                	jne    480 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 489:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 48e:	5d                   	pop    %ebp
+ 48f:	c3                   	ret
+
+00000490 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 490:	55                   	push   %ebp
+ 491:	31 c0                	xor    %eax,%eax
+ 493:	89 e5                	mov    %esp,%ebp
+ 495:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 498:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 49d:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 4a0:	5d                   	pop    %ebp
+ 4a1:	c3                   	ret
+ 4a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004b0 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4bc:	5d                   	pop    %ebp
+ 4bd:	c3                   	ret
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4c6:	89 e5                	mov    %esp,%ebp
+ 4c8:	56                   	push   %esi
+ 4c9:	53                   	push   %ebx
+ 4ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4cd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 4d0:	85 c0                	test   %eax,%eax
+ 4d2:	74 2d                	je     501 <mutex_lock+0x41>
+ 4d4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4d9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 4dc:	85 c0                	test   %eax,%eax
+ 4de:	74 21                	je     501 <mutex_lock+0x41>
+ 4e0:	be 02 00 00 00       	mov    $0x2,%esi
+ 4e5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 4e8:	83 ec 04             	sub    $0x4,%esp
+ 4eb:	6a 02                	push   $0x2
+ 4ed:	6a 00                	push   $0x0
+ 4ef:	53                   	push   %ebx
+ 4f0:	e8 37 02 00 00       	call   72c <futex>
+ 4f5:	89 f0                	mov    %esi,%eax
+ 4f7:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 4fa:	83 c4 10             	add    $0x10,%esp
+ 4fd:	85 c0                	test   %eax,%eax
+ 4ff:	75 e7                	jne    4e8 <mutex_lock+0x28>
+}
+ 501:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 504:	5b                   	pop    %ebx
+ 505:	5e                   	pop    %esi
+ 506:	5d                   	pop    %ebp
+ 507:	c3                   	ret
+ 508:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 510:	55                   	push   %ebp
+ 511:	31 c0                	xor    %eax,%eax
+ 513:	89 e5                	mov    %esp,%ebp
+ 515:	83 ec 08             	sub    $0x8,%esp
+ 518:	8b 55 08             	mov    0x8(%ebp),%edx
+ 51b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 51e:	83 f8 02             	cmp    $0x2,%eax
+ 521:	74 05                	je     528 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 523:	c9                   	leave
+ 524:	c3                   	ret
+ 525:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 528:	83 ec 04             	sub    $0x4,%esp
+ 52b:	6a 01                	push   $0x1
+ 52d:	6a 01                	push   $0x1
+ 52f:	52                   	push   %edx
+ 530:	e8 f7 01 00 00       	call   72c <futex>
+ 535:	83 c4 10             	add    $0x10,%esp
+}
+ 538:	c9                   	leave
+ 539:	c3                   	ret
+ 53a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000540 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 540:	55                   	push   %ebp
+ 541:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 543:	8b 45 08             	mov    0x8(%ebp),%eax
+ 546:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 54c:	5d                   	pop    %ebp
+ 54d:	c3                   	ret
+ 54e:	66 90                	xchg   %ax,%ax
+
+00000550 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 550:	55                   	push   %ebp
+ 551:	31 c0                	xor    %eax,%eax
+ 553:	89 e5                	mov    %esp,%ebp
+ 555:	57                   	push   %edi
+ 556:	56                   	push   %esi
+ 557:	53                   	push   %ebx
+ 558:	83 ec 0c             	sub    $0xc,%esp
+ 55b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 55e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 561:	8b 3e                	mov    (%esi),%edi
+ 563:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 566:	83 f8 02             	cmp    $0x2,%eax
+ 569:	74 4d                	je     5b8 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 56b:	83 ec 04             	sub    $0x4,%esp
+ 56e:	57                   	push   %edi
+ 56f:	6a 00                	push   $0x0
+ 571:	56                   	push   %esi
+ 572:	e8 b5 01 00 00       	call   72c <futex>
+ 577:	b8 02 00 00 00       	mov    $0x2,%eax
+ 57c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 57f:	83 c4 10             	add    $0x10,%esp
+ 582:	85 c0                	test   %eax,%eax
+ 584:	74 23                	je     5a9 <cond_wait+0x59>
+ 586:	be 02 00 00 00       	mov    $0x2,%esi
+ 58b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 58f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 590:	83 ec 04             	sub    $0x4,%esp
+ 593:	6a 02                	push   $0x2
+ 595:	6a 00                	push   $0x0
+ 597:	53                   	push   %ebx
+ 598:	e8 8f 01 00 00       	call   72c <futex>
+ 59d:	89 f0                	mov    %esi,%eax
+ 59f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 5a2:	83 c4 10             	add    $0x10,%esp
+ 5a5:	85 c0                	test   %eax,%eax
+ 5a7:	75 e7                	jne    590 <cond_wait+0x40>
+}
+ 5a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5ac:	5b                   	pop    %ebx
+ 5ad:	5e                   	pop    %esi
+ 5ae:	5f                   	pop    %edi
+ 5af:	5d                   	pop    %ebp
+ 5b0:	c3                   	ret
+ 5b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 5b8:	83 ec 04             	sub    $0x4,%esp
+ 5bb:	6a 01                	push   $0x1
+ 5bd:	6a 01                	push   $0x1
+ 5bf:	53                   	push   %ebx
+ 5c0:	e8 67 01 00 00       	call   72c <futex>
+ 5c5:	83 c4 10             	add    $0x10,%esp
+ 5c8:	eb a1                	jmp    56b <cond_wait+0x1b>
+ 5ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005d0 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	83 ec 0c             	sub    $0xc,%esp
+ 5d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 5d9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 5dd:	6a 01                	push   $0x1
+ 5df:	6a 01                	push   $0x1
+ 5e1:	50                   	push   %eax
+ 5e2:	e8 45 01 00 00       	call   72c <futex>
+}
+ 5e7:	83 c4 10             	add    $0x10,%esp
+ 5ea:	c9                   	leave
+ 5eb:	c3                   	ret
+ 5ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+ 5f3:	83 ec 0c             	sub    $0xc,%esp
+ 5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 5f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 5fd:	6a ff                	push   $0xffffffff
+ 5ff:	6a 01                	push   $0x1
+ 601:	50                   	push   %eax
+ 602:	e8 25 01 00 00       	call   72c <futex>
+}
+ 607:	83 c4 10             	add    $0x10,%esp
+ 60a:	c9                   	leave
+ 60b:	c3                   	ret
+
+0000060c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 60c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <exit>:
+SYSCALL(exit)
+ 614:	b8 02 00 00 00       	mov    $0x2,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <wait>:
+SYSCALL(wait)
+ 61c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <pipe>:
+SYSCALL(pipe)
+ 624:	b8 04 00 00 00       	mov    $0x4,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <read>:
+SYSCALL(read)
+ 62c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <write>:
+SYSCALL(write)
+ 634:	b8 10 00 00 00       	mov    $0x10,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <close>:
+SYSCALL(close)
+ 63c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <kill>:
+SYSCALL(kill)
+ 644:	b8 06 00 00 00       	mov    $0x6,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <exec>:
+SYSCALL(exec)
+ 64c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <open>:
+SYSCALL(open)
+ 654:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <mknod>:
+SYSCALL(mknod)
+ 65c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <unlink>:
+SYSCALL(unlink)
+ 664:	b8 12 00 00 00       	mov    $0x12,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <fstat>:
+SYSCALL(fstat)
+ 66c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <link>:
+SYSCALL(link)
+ 674:	b8 13 00 00 00       	mov    $0x13,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <mkdir>:
+SYSCALL(mkdir)
+ 67c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <chdir>:
+SYSCALL(chdir)
+ 684:	b8 09 00 00 00       	mov    $0x9,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <dup>:
+SYSCALL(dup)
+ 68c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <getpid>:
+SYSCALL(getpid)
+ 694:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <sbrk>:
+SYSCALL(sbrk)
+ 69c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <sleep>:
+SYSCALL(sleep)
+ 6a4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <uptime>:
+SYSCALL(uptime)
+ 6ac:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 6b4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 6bc:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <wmap>:
+SYSCALL(wmap)
+ 6c4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <wunmap>:
+SYSCALL(wunmap)
+ 6cc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <wremap>:
+SYSCALL(wremap)
+ 6d4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <wmlock>:
+SYSCALL(wmlock)
+ 6dc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <wmunlock>:
+SYSCALL(wmunlock)
+ 6e4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <wmapoff>:
+SYSCALL(wmapoff)
+ 6ec:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 6f4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <setpriority>:
+SYSCALL(setpriority)
+ 6fc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 704:	b8 20 00 00 00       	mov    $0x20,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <settickets>:
+SYSCALL(settickets)
+ 70c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 714:	b8 22 00 00 00       	mov    $0x22,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <clone>:
+SYSCALL(clone)
+ 71c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <join>:
+SYSCALL(join)
+ 724:	b8 24 00 00 00       	mov    $0x24,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <futex>:
+SYSCALL(futex)
+ 72c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <setaffinity>:
+SYSCALL(setaffinity)
+ 734:	b8 26 00 00 00       	mov    $0x26,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <getaffinity>:
+SYSCALL(getaffinity)
+ 73c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <bcstat>:
+SYSCALL(bcstat)
+ 744:	b8 29 00 00 00       	mov    $0x29,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <dropcache>:
+SYSCALL(dropcache)
+ 74c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <setiosched>:
+SYSCALL(setiosched)
+ 754:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <iostat>:
+SYSCALL(iostat)
+ 75c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <fsync>:
+SYSCALL(fsync)
+ 764:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 76c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 76d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 772:	cd 40                	int    $0x40
+ 774:	ff e1                	jmp    *%ecx
+ 776:	66 90                	xchg   %ax,%ax
+ 778:	66 90                	xchg   %ax,%ax
+ 77a:	66 90                	xchg   %ax,%ax
+ 77c:	66 90                	xchg   %ax,%ax
+ 77e:	66 90                	xchg   %ax,%ax
+
+00000780 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	56                   	push   %esi
+ 785:	53                   	push   %ebx
+ 786:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 788:	89 d1                	mov    %edx,%ecx
+{
+ 78a:	83 ec 3c             	sub    $0x3c,%esp
+ 78d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 790:	85 d2                	test   %edx,%edx
+ 792:	0f 89 80 00 00 00    	jns    818 <printint+0x98>
+ 798:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 79c:	74 7a                	je     818 <printint+0x98>
+    x = -xx;
+ 79e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7a5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7a8:	31 f6                	xor    %esi,%esi
+ 7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7b0:	89 c8                	mov    %ecx,%eax
+ 7b2:	31 d2                	xor    %edx,%edx
+ 7b4:	89 f7                	mov    %esi,%edi
+ 7b6:	f7 f3                	div    %ebx
+ 7b8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7bb:	0f b6 92 d0 0e 00 00 	movzbl 0xed0(%edx),%edx
+ 7c2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7c6:	89 ca                	mov    %ecx,%edx
+ 7c8:	89 c1                	mov    %eax,%ecx
+ 7ca:	39 da                	cmp    %ebx,%edx
+ 7cc:	73 e2                	jae    7b0 <printint+0x30>
+  if(neg)
+ 7ce:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7d1:	85 c0                	test   %eax,%eax
+ 7d3:	74 07                	je     7dc <printint+0x5c>
+    buf[i++] = '-';
+ 7d5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7da:	89 f7                	mov    %esi,%edi
+ 7dc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7df:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7e2:	01 df                	add    %ebx,%edi
+ 7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7e8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7eb:	83 ec 04             	sub    $0x4,%esp
+ 7ee:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7f1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7f4:	6a 01                	push   $0x1
+ 7f6:	50                   	push   %eax
+ 7f7:	56                   	push   %esi
+ 7f8:	e8 37 fe ff ff       	call   634 <write>
+  while(--i >= 0)
+ 7fd:	89 f8                	mov    %edi,%eax
+ 7ff:	83 c4 10             	add    $0x10,%esp
+ 802:	83 ef 01             	sub    $0x1,%edi
+ 805:	39 d8                	cmp    %ebx,%eax
+ 807:	75 df                	jne    7e8 <printint+0x68>
+}
+ 809:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 80c:	5b                   	pop    %ebx
+ 80d:	5e                   	pop    %esi
+ 80e:	5f                   	pop    %edi
+ 80f:	5d                   	pop    %ebp
+ 810:	c3                   	ret
+ 811:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 818:	31 c0                	xor    %eax,%eax
+ 81a:	eb 89                	jmp    7a5 <printint+0x25>
+ 81c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000820 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 820:	55                   	push   %ebp
+ 821:	89 e5                	mov    %esp,%ebp
+ 823:	57                   	push   %edi
+ 824:	56                   	push   %esi
+ 825:	53                   	push   %ebx
+ 826:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 829:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 82c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 82f:	0f b6 1e             	movzbl (%esi),%ebx
+ 832:	83 c6 01             	add    $0x1,%esi
+ 835:	84 db                	test   %bl,%bl
+ 837:	74 67                	je     8a0 <printf+0x80>
+ 839:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 83c:	31 d2                	xor    %edx,%edx
+ 83e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 841:	eb 34                	jmp    877 <printf+0x57>
+ 843:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 847:	90                   	nop
+ 848:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 84b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 850:	83 f8 25             	cmp    $0x25,%eax
+ 853:	74 18                	je     86d <printf+0x4d>
+  write(fd, &c, 1);
+ 855:	83 ec 04             	sub    $0x4,%esp
+ 858:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 85b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 85e:	6a 01                	push   $0x1
+ 860:	50                   	push   %eax
+ 861:	57                   	push   %edi
+ 862:	e8 cd fd ff ff       	call   634 <write>
+ 867:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 86a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 86d:	0f b6 1e             	movzbl (%esi),%ebx
+ 870:	83 c6 01             	add    $0x1,%esi
+ 873:	84 db                	test   %bl,%bl
+ 875:	74 29                	je     8a0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 877:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 87a:	85 d2                	test   %edx,%edx
+ 87c:	74 ca                	je     848 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 87e:	83 fa 25             	cmp    $0x25,%edx
+ 881:	75 ea                	jne    86d <printf+0x4d>
+      if(c == 'd'){
+ 883:	83 f8 25             	cmp    $0x25,%eax
+ 886:	0f 84 24 01 00 00    	je     9b0 <printf+0x190>
+ 88c:	83 e8 63             	sub    $0x63,%eax
+ 88f:	83 f8 15             	cmp    $0x15,%eax
+ 892:	77 1c                	ja     8b0 <printf+0x90>
+ 894:	ff 24 85 78 0e 00 00 	jmp    *0xe78(,%eax,4)
+ 89b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 89f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8a3:	5b                   	pop    %ebx
+ 8a4:	5e                   	pop    %esi
+ 8a5:	5f                   	pop    %edi
+ 8a6:	5d                   	pop    %ebp
+ 8a7:	c3                   	ret
+ 8a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8af:	90                   	nop
+  write(fd, &c, 1);
+ 8b0:	83 ec 04             	sub    $0x4,%esp
+ 8b3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8b6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ba:	6a 01                	push   $0x1
+ 8bc:	52                   	push   %edx
+ 8bd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8c0:	57                   	push   %edi
+ 8c1:	e8 6e fd ff ff       	call   634 <write>
+ 8c6:	83 c4 0c             	add    $0xc,%esp
+ 8c9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8cc:	6a 01                	push   $0x1
+ 8ce:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8d1:	52                   	push   %edx
+ 8d2:	57                   	push   %edi
+ 8d3:	e8 5c fd ff ff       	call   634 <write>
+        putc(fd, c);
+ 8d8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8db:	31 d2                	xor    %edx,%edx
+ 8dd:	eb 8e                	jmp    86d <printf+0x4d>
+ 8df:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8e0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8e3:	83 ec 0c             	sub    $0xc,%esp
+ 8e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8eb:	8b 13                	mov    (%ebx),%edx
+ 8ed:	6a 00                	push   $0x0
+ 8ef:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8f1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8f4:	e8 87 fe ff ff       	call   780 <printint>
+        ap++;
+ 8f9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8fc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ff:	31 d2                	xor    %edx,%edx
+ 901:	e9 67 ff ff ff       	jmp    86d <printf+0x4d>
+ 906:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 910:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 913:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 915:	83 c0 04             	add    $0x4,%eax
+ 918:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 91b:	85 db                	test   %ebx,%ebx
+ 91d:	0f 84 9d 00 00 00    	je     9c0 <printf+0x1a0>
+        while(*s != 0){
+ 923:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 926:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 928:	84 c0                	test   %al,%al
+ 92a:	0f 84 3d ff ff ff    	je     86d <printf+0x4d>
+ 930:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 933:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 936:	89 de                	mov    %ebx,%esi
+ 938:	89 d3                	mov    %edx,%ebx
+ 93a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 940:	83 ec 04             	sub    $0x4,%esp
+ 943:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 946:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 949:	6a 01                	push   $0x1
+ 94b:	53                   	push   %ebx
+ 94c:	57                   	push   %edi
+ 94d:	e8 e2 fc ff ff       	call   634 <write>
+        while(*s != 0){
+ 952:	0f b6 06             	movzbl (%esi),%eax
+ 955:	83 c4 10             	add    $0x10,%esp
+ 958:	84 c0                	test   %al,%al
+ 95a:	75 e4                	jne    940 <printf+0x120>
+      state = 0;
+ 95c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 95f:	31 d2                	xor    %edx,%edx
+ 961:	e9 07 ff ff ff       	jmp    86d <printf+0x4d>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 970:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 973:	83 ec 0c             	sub    $0xc,%esp
+ 976:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 97b:	8b 13                	mov    (%ebx),%edx
+ 97d:	6a 01                	push   $0x1
+ 97f:	e9 6b ff ff ff       	jmp    8ef <printf+0xcf>
+ 984:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 988:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 98b:	83 ec 04             	sub    $0x4,%esp
+ 98e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 991:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 993:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 996:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 999:	6a 01                	push   $0x1
+ 99b:	52                   	push   %edx
+ 99c:	57                   	push   %edi
+ 99d:	e8 92 fc ff ff       	call   634 <write>
+        ap++;
+ 9a2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9a5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9a8:	31 d2                	xor    %edx,%edx
+ 9aa:	e9 be fe ff ff       	jmp    86d <printf+0x4d>
+ 9af:	90                   	nop
+  write(fd, &c, 1);
+ 9b0:	83 ec 04             	sub    $0x4,%esp
+ 9b3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9b6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9b9:	6a 01                	push   $0x1
+ 9bb:	e9 11 ff ff ff       	jmp    8d1 <printf+0xb1>
+ 9c0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9c5:	bb 6e 0e 00 00       	mov    $0xe6e,%ebx
+ 9ca:	e9 61 ff ff ff       	jmp    930 <printf+0x110>
+ 9cf:	90                   	nop
+
+000009d0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9d0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9d1:	a1 60 13 00 00       	mov    0x1360,%eax
+{
+ 9d6:	89 e5                	mov    %esp,%ebp
+ 9d8:	57                   	push   %edi
+ 9d9:	56                   	push   %esi
+ 9da:	53                   	push   %ebx
+ 9db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9de:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9e8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ea:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9ec:	39 ca                	cmp    %ecx,%edx
+ 9ee:	73 30                	jae    a20 <free+0x50>
+ 9f0:	39 c1                	cmp    %eax,%ecx
+ 9f2:	72 04                	jb     9f8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9f4:	39 c2                	cmp    %eax,%edx
+ 9f6:	72 f0                	jb     9e8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9f8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9fb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9fe:	39 f8                	cmp    %edi,%eax
+ a00:	74 2e                	je     a30 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a02:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a05:	8b 42 04             	mov    0x4(%edx),%eax
+ a08:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a0b:	39 f1                	cmp    %esi,%ecx
+ a0d:	74 38                	je     a47 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a0f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a11:	5b                   	pop    %ebx
+  freep = p;
+ a12:	89 15 60 13 00 00    	mov    %edx,0x1360
+}
+ a18:	5e                   	pop    %esi
+ a19:	5f                   	pop    %edi
+ a1a:	5d                   	pop    %ebp
+ a1b:	c3                   	ret
+ a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a20:	39 c1                	cmp    %eax,%ecx
+ a22:	72 d0                	jb     9f4 <free+0x24>
+ a24:	eb c2                	jmp    9e8 <free+0x18>
+ a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a30:	03 70 04             	add    0x4(%eax),%esi
+ a33:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a36:	8b 02                	mov    (%edx),%eax
+ a38:	8b 00                	mov    (%eax),%eax
+ a3a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a3d:	8b 42 04             	mov    0x4(%edx),%eax
+ a40:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a43:	39 f1                	cmp    %esi,%ecx
+ a45:	75 c8                	jne    a0f <free+0x3f>
+    p->s.size += bp->s.size;
+ a47:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a4a:	89 15 60 13 00 00    	mov    %edx,0x1360
+    p->s.size += bp->s.size;
+ a50:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a53:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a56:	89 0a                	mov    %ecx,(%edx)
+}
+ a58:	5b                   	pop    %ebx
+ a59:	5e                   	pop    %esi
+ a5a:	5f                   	pop    %edi
+ a5b:	5d                   	pop    %ebp
+ a5c:	c3                   	ret
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a60 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a60:	55                   	push   %ebp
+ a61:	89 e5                	mov    %esp,%ebp
+ a63:	57                   	push   %edi
+ a64:	56                   	push   %esi
+ a65:	53                   	push   %ebx
+ a66:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a69:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a6c:	8b 15 60 13 00 00    	mov    0x1360,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a72:	8d 78 07             	lea    0x7(%eax),%edi
+ a75:	c1 ef 03             	shr    $0x3,%edi
+ a78:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a7b:	85 d2                	test   %edx,%edx
+ a7d:	0f 84 8d 00 00 00    	je     b10 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a83:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a85:	8b 48 04             	mov    0x4(%eax),%ecx
+ a88:	39 f9                	cmp    %edi,%ecx
+ a8a:	73 64                	jae    af0 <malloc+0x90>
+  if(nu < 4096)
+ a8c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a91:	39 df                	cmp    %ebx,%edi
+ a93:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a96:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a9d:	eb 0a                	jmp    aa9 <malloc+0x49>
+ a9f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ aa0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ aa2:	8b 48 04             	mov    0x4(%eax),%ecx
+ aa5:	39 f9                	cmp    %edi,%ecx
+ aa7:	73 47                	jae    af0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ aa9:	89 c2                	mov    %eax,%edx
+ aab:	39 05 60 13 00 00    	cmp    %eax,0x1360
+ ab1:	75 ed                	jne    aa0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ab3:	83 ec 0c             	sub    $0xc,%esp
+ ab6:	56                   	push   %esi
+ ab7:	e8 e0 fb ff ff       	call   69c <sbrk>
+  if(p == (char*)-1)
+ abc:	83 c4 10             	add    $0x10,%esp
+ abf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ ac2:	74 1c                	je     ae0 <malloc+0x80>
+  hp->s.size = nu;
+ ac4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ ac7:	83 ec 0c             	sub    $0xc,%esp
+ aca:	83 c0 08             	add    $0x8,%eax
+ acd:	50                   	push   %eax
+ ace:	e8 fd fe ff ff       	call   9d0 <free>
+  return freep;
+ ad3:	8b 15 60 13 00 00    	mov    0x1360,%edx
+      if((p = morecore(nunits)) == 0)
+ ad9:	83 c4 10             	add    $0x10,%esp
+ adc:	85 d2                	test   %edx,%edx
+ ade:	75 c0                	jne    aa0 <malloc+0x40>
+        return 0;
+  }
+}
+ ae0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ae3:	31 c0                	xor    %eax,%eax
+}
+ ae5:	5b                   	pop    %ebx
+ ae6:	5e                   	pop    %esi
+ ae7:	5f                   	pop    %edi
+ ae8:	5d                   	pop    %ebp
+ ae9:	c3                   	ret
+ aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ af0:	39 cf                	cmp    %ecx,%edi
+ af2:	74 4c                	je     b40 <malloc+0xe0>
+        p->s.size -= nunits;
+ af4:	29 f9                	sub    %edi,%ecx
+ af6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ af9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ afc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ aff:	89 15 60 13 00 00    	mov    %edx,0x1360
+}
+ b05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b08:	83 c0 08             	add    $0x8,%eax
+}
+ b0b:	5b                   	pop    %ebx
+ b0c:	5e                   	pop    %esi
+ b0d:	5f                   	pop    %edi
+ b0e:	5d                   	pop    %ebp
+ b0f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b10:	c7 05 60 13 00 00 64 	movl   $0x1364,0x1360
+ b17:	13 00 00 
+    base.s.size = 0;
+ b1a:	b8 64 13 00 00       	mov    $0x1364,%eax
+    base.s.ptr = freep = prevp = &base;
+ b1f:	c7 05 64 13 00 00 64 	movl   $0x1364,0x1364
+ b26:	13 00 00 
+    base.s.size = 0;
+ b29:	c7 05 68 13 00 00 00 	movl   $0x0,0x1368
+ b30:	00 00 00 
+    if(p->s.size >= nunits){
+ b33:	e9 54 ff ff ff       	jmp    a8c <malloc+0x2c>
+ b38:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b40:	8b 08                	mov    (%eax),%ecx
+ b42:	89 0a                	mov    %ecx,(%edx)
+ b44:	eb b9                	jmp    aff <malloc+0x9f>
+ b46:	66 90                	xchg   %ax,%ax
+ b48:	66 90                	xchg   %ax,%ax
+ b4a:	66 90                	xchg   %ax,%ax
+ b4c:	66 90                	xchg   %ax,%ax
+ b4e:	66 90                	xchg   %ax,%ax
+
+00000b50 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ b56:	8b 45 08             	mov    0x8(%ebp),%eax
+ b59:	c1 e0 04             	shl    $0x4,%eax
+ b5c:	ff b0 ac 13 00 00    	push   0x13ac(%eax)
+ b62:	05 a0 13 00 00       	add    $0x13a0,%eax
+ b67:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ b6a:	e8 a5 fa ff ff       	call   614 <exit>
+ b6f:	90                   	nop
+
+00000b70 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	57                   	push   %edi
+ b74:	56                   	push   %esi
+ b75:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ b76:	31 db                	xor    %ebx,%ebx
+{
+ b78:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ b7b:	68 80 13 00 00       	push   $0x1380
+ b80:	e8 eb f8 ff ff       	call   470 <lock_acquire>
+ b85:	83 c4 10             	add    $0x10,%esp
+ b88:	eb 12                	jmp    b9c <thread_create+0x2c>
+ b8a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ b90:	83 c3 01             	add    $0x1,%ebx
+ b93:	83 fb 40             	cmp    $0x40,%ebx
+ b96:	0f 84 c4 00 00 00    	je     c60 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ b9c:	89 de                	mov    %ebx,%esi
+ b9e:	c1 e6 04             	shl    $0x4,%esi
+ ba1:	8b 96 a0 13 00 00    	mov    0x13a0(%esi),%edx
+ ba7:	85 d2                	test   %edx,%edx
+ ba9:	75 e5                	jne    b90 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ bab:	83 ec 0c             	sub    $0xc,%esp
+ bae:	68 00 20 00 00       	push   $0x2000
+ bb3:	e8 a8 fe ff ff       	call   a60 <malloc>
+ bb8:	83 c4 10             	add    $0x10,%esp
+ bbb:	85 c0                	test   %eax,%eax
+ bbd:	0f 84 9d 00 00 00    	je     c60 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ bc3:	89 86 a4 13 00 00    	mov    %eax,0x13a4(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ bc9:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ bce:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ bd1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ bd6:	89 86 a0 13 00 00    	mov    %eax,0x13a0(%esi)
+  threads[i].fn = fn;
+ bdc:	8b 45 08             	mov    0x8(%ebp),%eax
+ bdf:	89 86 a8 13 00 00    	mov    %eax,0x13a8(%esi)
+  threads[i].arg = arg;
+ be5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ be8:	89 86 ac 13 00 00    	mov    %eax,0x13ac(%esi)
+  lock_release(&threadslock);
+ bee:	68 80 13 00 00       	push   $0x1380
+ bf3:	e8 98 f8 ff ff       	call   490 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ bf8:	83 c4 0c             	add    $0xc,%esp
+ bfb:	ff b6 a0 13 00 00    	push   0x13a0(%esi)
+ c01:	53                   	push   %ebx
+ c02:	68 50 0b 00 00       	push   $0xb50
+ c07:	e8 10 fb ff ff       	call   71c <clone>
+ c0c:	83 c4 10             	add    $0x10,%esp
+ c0f:	85 c0                	test   %eax,%eax
+ c11:	78 0d                	js     c20 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ c13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c16:	5b                   	pop    %ebx
+ c17:	5e                   	pop    %esi
+ c18:	5f                   	pop    %edi
+ c19:	5d                   	pop    %ebp
+ c1a:	c3                   	ret
+ c1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c1f:	90                   	nop
+    lock_acquire(&threadslock);
+ c20:	83 ec 0c             	sub    $0xc,%esp
+ c23:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ c26:	68 80 13 00 00       	push   $0x1380
+ c2b:	e8 40 f8 ff ff       	call   470 <lock_acquire>
+    free(threads[i].block);
+ c30:	58                   	pop    %eax
+ c31:	ff b6 a4 13 00 00    	push   0x13a4(%esi)
+ c37:	e8 94 fd ff ff       	call   9d0 <free>
+    threads[i].stack = 0;
+ c3c:	c7 86 a0 13 00 00 00 	movl   $0x0,0x13a0(%esi)
+ c43:	00 00 00 
+    lock_release(&threadslock);
+ c46:	c7 04 24 80 13 00 00 	movl   $0x1380,(%esp)
+ c4d:	e8 3e f8 ff ff       	call   490 <lock_release>
+ c52:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c55:	83 c4 10             	add    $0x10,%esp
+}
+ c58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c5b:	5b                   	pop    %ebx
+ c5c:	5e                   	pop    %esi
+ c5d:	5f                   	pop    %edi
+ c5e:	5d                   	pop    %ebp
+ c5f:	c3                   	ret
+    lock_release(&threadslock);
+ c60:	83 ec 0c             	sub    $0xc,%esp
+ c63:	68 80 13 00 00       	push   $0x1380
+ c68:	e8 23 f8 ff ff       	call   490 <lock_release>
+    return -1;
+ c6d:	83 c4 10             	add    $0x10,%esp
+ c70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c75:	eb 9c                	jmp    c13 <thread_create+0xa3>
+ c77:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c7e:	66 90                	xchg   %ax,%ax
+
+00000c80 <thread_join>:
+
+int
+thread_join(void)
+{
+ c80:	55                   	push   %ebp
+ c81:	89 e5                	mov    %esp,%ebp
+ c83:	56                   	push   %esi
+ c84:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ c85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ c88:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ c8b:	50                   	push   %eax
+ c8c:	e8 93 fa ff ff       	call   724 <join>
+ c91:	83 c4 10             	add    $0x10,%esp
+ c94:	85 c0                	test   %eax,%eax
+ c96:	78 69                	js     d01 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ c98:	83 ec 0c             	sub    $0xc,%esp
+ c9b:	89 c6                	mov    %eax,%esi
+ c9d:	68 80 13 00 00       	push   $0x1380
+ ca2:	e8 c9 f7 ff ff       	call   470 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ ca7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ caa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ cad:	31 c0                	xor    %eax,%eax
+ caf:	eb 0f                	jmp    cc0 <thread_join+0x40>
+ cb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cb8:	83 c0 01             	add    $0x1,%eax
+ cbb:	83 f8 40             	cmp    $0x40,%eax
+ cbe:	74 28                	je     ce8 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ cc0:	89 c3                	mov    %eax,%ebx
+ cc2:	c1 e3 04             	shl    $0x4,%ebx
+ cc5:	39 93 a0 13 00 00    	cmp    %edx,0x13a0(%ebx)
+ ccb:	75 eb                	jne    cb8 <thread_join+0x38>
+      free(threads[i].block);
+ ccd:	83 ec 0c             	sub    $0xc,%esp
+ cd0:	ff b3 a4 13 00 00    	push   0x13a4(%ebx)
+ cd6:	e8 f5 fc ff ff       	call   9d0 <free>
+      threads[i].stack = 0;
+      break;
+ cdb:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ cde:	c7 83 a0 13 00 00 00 	movl   $0x0,0x13a0(%ebx)
+ ce5:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ ce8:	83 ec 0c             	sub    $0xc,%esp
+ ceb:	68 80 13 00 00       	push   $0x1380
+ cf0:	e8 9b f7 ff ff       	call   490 <lock_release>
+  return pid;
+ cf5:	83 c4 10             	add    $0x10,%esp
+}
+ cf8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ cfb:	89 f0                	mov    %esi,%eax
+ cfd:	5b                   	pop    %ebx
+ cfe:	5e                   	pop    %esi
+ cff:	5d                   	pop    %ebp
+ d00:	c3                   	ret
+    return -1;
+ d01:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ d06:	eb f0                	jmp    cf8 <thread_join+0x78>
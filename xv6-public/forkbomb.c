@@ -0,0 +1,78 @@
+// Fork-bomb scaling test.
+// Forks up to n children that all block reading one pipe, timing
+// each batch of forks; with allocation from a slab and lookups by
+// pid hash, later batches should take no longer than early ones.
+// Then times kill on a missing pid with them all alive, and how
+// long it takes to wait for them all once the pipe is closed.
+//
+// usage: forkbomb [n]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define BATCH  256   // forks per timed batch
+#define NKILL  1000  // kill calls to time
+
+int
+main(int argc, char *argv[])
+{
+  int n, i, pid, start, batch, fds[2];
+  char c;
+
+  n = 2048;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(n < 1){
+    printf(2, "usage: forkbomb [n]\n");
+    exit();
+  }
+  if(pipe(fds) < 0){
+    printf(2, "forkbomb: pipe failed\n");
+    exit();
+  }
+
+  printf(1, "forkbomb: forking %d children\n", n);
+  start = batch = uptime();
+  for(i = 0; i < n; i++){
+    if((pid = fork()) < 0){
+      printf(1, "forkbomb: fork failed after %d children\n", i);
+      break;
+    }
+    if(pid == 0){
+      close(fds[1]);
+      read(fds[0], &c, 1);  // returns 0 once the parent closes fds[1]
+      exit();
+    }
+    if((i + 1) % BATCH == 0){
+      printf(1, "forkbomb: children %d-%d: %d ticks\n",
+             i + 1 - BATCH, i, uptime() - batch);
+      batch = uptime();
+    }
+  }
+  n = i;
+  printf(1, "forkbomb: %d children in %d ticks\n", n, uptime() - start);
+
+  start = uptime();
+  for(i = 0; i < NKILL; i++)
+    kill(-1);
+  printf(1, "forkbomb: %d kills of a missing pid: %d ticks\n",
+         NKILL, uptime() - start);
+
+  start = uptime();
+  close(fds[1]);
+  for(i = 0; i < n; i++){
+    if(wait() < 0){
+      printf(1, "forkbomb: wait stopped early\n");
+      exit();
+    }
+  }
+  if(wait() != -1){
+    printf(1, "forkbomb: wait got too many\n");
+    exit();
+  }
+  printf(1, "forkbomb: waited for %d children in %d ticks\n",
+         n, uptime() - start);
+  printf(1, "forkbomb ok\n");
+  exit();
+}
@@ -0,0 +1,1337 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, " ticks\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(argc > 1)
+  11:	83 39 01             	cmpl   $0x1,(%ecx)
+  14:	7e 05                	jle    1b <main+0x1b>
+    exit();  // started by exectest
+  16:	e8 39 07 00 00       	call   754 <exit>
+  forktest();
+  1b:	e8 00 01 00 00       	call   120 <forktest>
+  exectest(0);
+  20:	83 ec 0c             	sub    $0xc,%esp
+  23:	6a 00                	push   $0x0
+  25:	e8 d6 01 00 00       	call   200 <exectest>
+  exectest(1);
+  2a:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  31:	e8 ca 01 00 00       	call   200 <exectest>
+  if(sbrk(BIGHEAP) != (char*)-1){
+  36:	c7 04 24 00 00 10 00 	movl   $0x100000,(%esp)
+  3d:	e8 9a 07 00 00       	call   7dc <sbrk>
+  42:	83 c4 10             	add    $0x10,%esp
+  45:	83 c0 01             	add    $0x1,%eax
+  48:	74 cc                	je     16 <main+0x16>
+    printf(1, "with a big heap:\n");
+  4a:	50                   	push   %eax
+  4b:	50                   	push   %eax
+  4c:	68 48 09 00 00       	push   $0x948
+  51:	6a 01                	push   $0x1
+  53:	e8 28 00 00 00       	call   80 <printf>
+    exectest(0);
+  58:	31 d2                	xor    %edx,%edx
+  5a:	89 14 24             	mov    %edx,(%esp)
+  5d:	e8 9e 01 00 00       	call   200 <exectest>
+    exectest(1);
+  62:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  69:	e8 92 01 00 00       	call   200 <exectest>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	eb a3                	jmp    16 <main+0x16>
+  73:	66 90                	xchg   %ax,%ax
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <printf>:
+{
+  80:	55                   	push   %ebp
+  81:	89 e5                	mov    %esp,%ebp
+  83:	53                   	push   %ebx
+  84:	83 ec 10             	sub    $0x10,%esp
+  87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  write(fd, s, strlen(s));
+  8a:	53                   	push   %ebx
+  8b:	e8 60 03 00 00       	call   3f0 <strlen>
+  90:	83 c4 0c             	add    $0xc,%esp
+  93:	50                   	push   %eax
+  94:	53                   	push   %ebx
+  95:	ff 75 08             	push   0x8(%ebp)
+  98:	e8 d7 06 00 00       	call   774 <write>
+}
+  9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <printnum>:
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	57                   	push   %edi
+  b4:	56                   	push   %esi
+    buf[--i] = '0' + n % 10;
+  b5:	be 67 66 66 66       	mov    $0x66666667,%esi
+{
+  ba:	53                   	push   %ebx
+  i = sizeof(buf);
+  bb:	bb 0c 00 00 00       	mov    $0xc,%ebx
+{
+  c0:	83 ec 1c             	sub    $0x1c,%esp
+  c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+    buf[--i] = '0' + n % 10;
+  d0:	89 c8                	mov    %ecx,%eax
+  d2:	83 eb 01             	sub    $0x1,%ebx
+  d5:	f7 ee                	imul   %esi
+  d7:	89 c8                	mov    %ecx,%eax
+  d9:	c1 f8 1f             	sar    $0x1f,%eax
+  dc:	c1 fa 02             	sar    $0x2,%edx
+  df:	29 c2                	sub    %eax,%edx
+  e1:	89 c8                	mov    %ecx,%eax
+  e3:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+  e6:	01 ff                	add    %edi,%edi
+  e8:	29 f8                	sub    %edi,%eax
+  ea:	83 c0 30             	add    $0x30,%eax
+  ed:	88 44 1d dc          	mov    %al,-0x24(%ebp,%ebx,1)
+  } while((n /= 10) > 0);
+  f1:	89 c8                	mov    %ecx,%eax
+  f3:	89 d1                	mov    %edx,%ecx
+  f5:	83 f8 09             	cmp    $0x9,%eax
+  f8:	7f d6                	jg     d0 <printnum+0x20>
+  write(fd, buf + i, sizeof(buf) - i);
+  fa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  ff:	83 ec 04             	sub    $0x4,%esp
+ 102:	29 d8                	sub    %ebx,%eax
+ 104:	50                   	push   %eax
+ 105:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 108:	01 d8                	add    %ebx,%eax
+ 10a:	50                   	push   %eax
+ 10b:	ff 75 08             	push   0x8(%ebp)
+ 10e:	e8 61 06 00 00       	call   774 <write>
+}
+ 113:	83 c4 10             	add    $0x10,%esp
+ 116:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 119:	5b                   	pop    %ebx
+ 11a:	5e                   	pop    %esi
+ 11b:	5f                   	pop    %edi
+ 11c:	5d                   	pop    %ebp
+ 11d:	c3                   	ret
+ 11e:	66 90                	xchg   %ax,%ax
+
+00000120 <forktest>:
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	53                   	push   %ebx
+  for(n=0; n<N; n++){
+ 124:	31 db                	xor    %ebx,%ebx
+{
+ 126:	83 ec 10             	sub    $0x10,%esp
+  write(fd, s, strlen(s));
+ 129:	68 b8 08 00 00       	push   $0x8b8
+ 12e:	e8 bd 02 00 00       	call   3f0 <strlen>
+ 133:	83 c4 0c             	add    $0xc,%esp
+ 136:	50                   	push   %eax
+ 137:	68 b8 08 00 00       	push   $0x8b8
+ 13c:	6a 01                	push   $0x1
+ 13e:	e8 31 06 00 00       	call   774 <write>
+ 143:	83 c4 10             	add    $0x10,%esp
+ 146:	eb 19                	jmp    161 <forktest+0x41>
+ 148:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+    if(pid == 0)
+ 150:	74 5b                	je     1ad <forktest+0x8d>
+  for(n=0; n<N; n++){
+ 152:	83 c3 01             	add    $0x1,%ebx
+ 155:	81 fb 88 13 00 00    	cmp    $0x1388,%ebx
+ 15b:	0f 84 86 00 00 00    	je     1e7 <forktest+0xc7>
+    pid = fork();
+ 161:	e8 e6 05 00 00       	call   74c <fork>
+    if(pid < 0)
+ 166:	85 c0                	test   %eax,%eax
+ 168:	79 e6                	jns    150 <forktest+0x30>
+  for(; n > 0; n--){
+ 16a:	85 db                	test   %ebx,%ebx
+ 16c:	74 10                	je     17e <forktest+0x5e>
+ 16e:	66 90                	xchg   %ax,%ax
+    if(wait() < 0){
+ 170:	e8 e7 05 00 00       	call   75c <wait>
+ 175:	85 c0                	test   %eax,%eax
+ 177:	78 39                	js     1b2 <forktest+0x92>
+  for(; n > 0; n--){
+ 179:	83 eb 01             	sub    $0x1,%ebx
+ 17c:	75 f2                	jne    170 <forktest+0x50>
+  if(wait() != -1){
+ 17e:	e8 d9 05 00 00       	call   75c <wait>
+ 183:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 186:	75 4c                	jne    1d4 <forktest+0xb4>
+  write(fd, s, strlen(s));
+ 188:	83 ec 0c             	sub    $0xc,%esp
+ 18b:	68 ea 08 00 00       	push   $0x8ea
+ 190:	e8 5b 02 00 00       	call   3f0 <strlen>
+ 195:	83 c4 0c             	add    $0xc,%esp
+ 198:	50                   	push   %eax
+ 199:	68 ea 08 00 00       	push   $0x8ea
+ 19e:	6a 01                	push   $0x1
+ 1a0:	e8 cf 05 00 00       	call   774 <write>
+}
+ 1a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a8:	83 c4 10             	add    $0x10,%esp
+ 1ab:	c9                   	leave
+ 1ac:	c3                   	ret
+      exit();
+ 1ad:	e8 a2 05 00 00       	call   754 <exit>
+  write(fd, s, strlen(s));
+ 1b2:	83 ec 0c             	sub    $0xc,%esp
+ 1b5:	68 c3 08 00 00       	push   $0x8c3
+ 1ba:	e8 31 02 00 00       	call   3f0 <strlen>
+ 1bf:	83 c4 0c             	add    $0xc,%esp
+ 1c2:	50                   	push   %eax
+ 1c3:	68 c3 08 00 00       	push   $0x8c3
+ 1c8:	6a 01                	push   $0x1
+ 1ca:	e8 a5 05 00 00       	call   774 <write>
+      exit();
+ 1cf:	e8 80 05 00 00       	call   754 <exit>
+    printf(1, "wait got too many\n");
+ 1d4:	50                   	push   %eax
+ 1d5:	50                   	push   %eax
+ 1d6:	68 d7 08 00 00       	push   $0x8d7
+ 1db:	6a 01                	push   $0x1
+ 1dd:	e8 9e fe ff ff       	call   80 <printf>
+    exit();
+ 1e2:	e8 6d 05 00 00       	call   754 <exit>
+    printf(1, "fork claimed to work N times!\n", N);
+ 1e7:	52                   	push   %edx
+ 1e8:	68 88 13 00 00       	push   $0x1388
+ 1ed:	68 5c 09 00 00       	push   $0x95c
+ 1f2:	6a 01                	push   $0x1
+ 1f4:	e8 87 fe ff ff       	call   80 <printf>
+    exit();
+ 1f9:	e8 56 05 00 00       	call   754 <exit>
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <exectest>:
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	57                   	push   %edi
+ 204:	56                   	push   %esi
+ 205:	53                   	push   %ebx
+ 206:	83 ec 3c             	sub    $0x3c,%esp
+  char *argv[] = { "forktest", "x", 0 };
+ 209:	c7 45 d0 05 09 00 00 	movl   $0x905,-0x30(%ebp)
+ 210:	c7 45 d4 0e 09 00 00 	movl   $0x90e,-0x2c(%ebp)
+ 217:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  start = uptime();
+ 21e:	e8 c9 05 00 00       	call   7ec <uptime>
+  for(i = 0; i < NEXEC; i++){
+ 223:	c7 45 c4 00 00 00 00 	movl   $0x0,-0x3c(%ebp)
+ 22a:	83 7d c4 63          	cmpl   $0x63,-0x3c(%ebp)
+  start = uptime();
+ 22e:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  for(i = 0; i < NEXEC; i++){
+ 231:	7f 2d                	jg     260 <exectest+0x60>
+    pid = usevfork ? vfork() : fork();
+ 233:	8b 7d 08             	mov    0x8(%ebp),%edi
+ 236:	85 ff                	test   %edi,%edi
+ 238:	0f 84 d2 00 00 00    	je     310 <exectest+0x110>
+ 23e:	e8 69 06 00 00       	call   8ac <vfork>
+    if(pid < 0){
+ 243:	85 c0                	test   %eax,%eax
+ 245:	0f 88 f3 00 00 00    	js     33e <exectest+0x13e>
+    if(pid == 0){
+ 24b:	0f 84 c9 00 00 00    	je     31a <exectest+0x11a>
+    wait();
+ 251:	e8 06 05 00 00       	call   75c <wait>
+  for(i = 0; i < NEXEC; i++){
+ 256:	83 45 c4 01          	addl   $0x1,-0x3c(%ebp)
+ 25a:	83 7d c4 63          	cmpl   $0x63,-0x3c(%ebp)
+ 25e:	7e d3                	jle    233 <exectest+0x33>
+  printf(1, usevfork ? "vfork+exec: " : "fork+exec: ");
+ 260:	8b 45 08             	mov    0x8(%ebp),%eax
+ 263:	bb f9 08 00 00       	mov    $0x8f9,%ebx
+ 268:	85 c0                	test   %eax,%eax
+ 26a:	b8 f8 08 00 00       	mov    $0x8f8,%eax
+ 26f:	0f 45 d8             	cmovne %eax,%ebx
+  write(fd, s, strlen(s));
+ 272:	83 ec 0c             	sub    $0xc,%esp
+ 275:	53                   	push   %ebx
+ 276:	e8 75 01 00 00       	call   3f0 <strlen>
+ 27b:	83 c4 0c             	add    $0xc,%esp
+ 27e:	50                   	push   %eax
+ 27f:	53                   	push   %ebx
+  i = sizeof(buf);
+ 280:	bb 0c 00 00 00       	mov    $0xc,%ebx
+  write(fd, s, strlen(s));
+ 285:	6a 01                	push   $0x1
+ 287:	e8 e8 04 00 00       	call   774 <write>
+}
+ 28c:	83 c4 10             	add    $0x10,%esp
+  printnum(1, uptime() - start);
+ 28f:	e8 58 05 00 00       	call   7ec <uptime>
+ 294:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 297:	29 f0                	sub    %esi,%eax
+    buf[--i] = '0' + n % 10;
+ 299:	be 67 66 66 66       	mov    $0x66666667,%esi
+  printnum(1, uptime() - start);
+ 29e:	89 c1                	mov    %eax,%ecx
+    buf[--i] = '0' + n % 10;
+ 2a0:	89 c8                	mov    %ecx,%eax
+ 2a2:	83 eb 01             	sub    $0x1,%ebx
+ 2a5:	f7 ee                	imul   %esi
+ 2a7:	89 c8                	mov    %ecx,%eax
+ 2a9:	c1 f8 1f             	sar    $0x1f,%eax
+ 2ac:	c1 fa 02             	sar    $0x2,%edx
+ 2af:	29 c2                	sub    %eax,%edx
+ 2b1:	89 c8                	mov    %ecx,%eax
+ 2b3:	8d 3c 92             	lea    (%edx,%edx,4),%edi
+ 2b6:	01 ff                	add    %edi,%edi
+ 2b8:	29 f8                	sub    %edi,%eax
+ 2ba:	83 c0 30             	add    $0x30,%eax
+ 2bd:	88 44 1d dc          	mov    %al,-0x24(%ebp,%ebx,1)
+  } while((n /= 10) > 0);
+ 2c1:	89 c8                	mov    %ecx,%eax
+ 2c3:	89 d1                	mov    %edx,%ecx
+ 2c5:	83 f8 09             	cmp    $0x9,%eax
+ 2c8:	7f d6                	jg     2a0 <exectest+0xa0>
+  write(fd, buf + i, sizeof(buf) - i);
+ 2ca:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 2cf:	83 ec 04             	sub    $0x4,%esp
+ 2d2:	29 d8                	sub    %ebx,%eax
+ 2d4:	50                   	push   %eax
+ 2d5:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 2d8:	01 d8                	add    %ebx,%eax
+ 2da:	50                   	push   %eax
+ 2db:	6a 01                	push   $0x1
+ 2dd:	e8 92 04 00 00       	call   774 <write>
+  write(fd, s, strlen(s));
+ 2e2:	c7 04 24 40 09 00 00 	movl   $0x940,(%esp)
+ 2e9:	e8 02 01 00 00       	call   3f0 <strlen>
+ 2ee:	83 c4 0c             	add    $0xc,%esp
+ 2f1:	50                   	push   %eax
+ 2f2:	68 40 09 00 00       	push   $0x940
+ 2f7:	6a 01                	push   $0x1
+ 2f9:	e8 76 04 00 00       	call   774 <write>
+}
+ 2fe:	83 c4 10             	add    $0x10,%esp
+}
+ 301:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 304:	5b                   	pop    %ebx
+ 305:	5e                   	pop    %esi
+ 306:	5f                   	pop    %edi
+ 307:	5d                   	pop    %ebp
+ 308:	c3                   	ret
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    pid = usevfork ? vfork() : fork();
+ 310:	e8 37 04 00 00       	call   74c <fork>
+ 315:	e9 29 ff ff ff       	jmp    243 <exectest+0x43>
+      exec(argv[0], argv);
+ 31a:	8d 45 d0             	lea    -0x30(%ebp),%eax
+ 31d:	52                   	push   %edx
+ 31e:	52                   	push   %edx
+ 31f:	50                   	push   %eax
+ 320:	ff 75 d0             	push   -0x30(%ebp)
+ 323:	e8 64 04 00 00       	call   78c <exec>
+ 328:	59                   	pop    %ecx
+ 329:	5b                   	pop    %ebx
+      printf(1, "exec test: exec failed\n");
+ 32a:	68 28 09 00 00       	push   $0x928
+ 32f:	6a 01                	push   $0x1
+ 331:	e8 4a fd ff ff       	call   80 <printf>
+ 336:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 339:	e8 16 04 00 00       	call   754 <exit>
+      printf(1, "exec test: fork failed\n");
+ 33e:	56                   	push   %esi
+ 33f:	56                   	push   %esi
+ 340:	68 10 09 00 00       	push   $0x910
+ 345:	6a 01                	push   $0x1
+ 347:	e8 34 fd ff ff       	call   80 <printf>
+ 34c:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 34f:	e8 00 04 00 00       	call   754 <exit>
+ 354:	66 90                	xchg   %ax,%ax
+ 356:	66 90                	xchg   %ax,%ax
+ 358:	66 90                	xchg   %ax,%ax
+ 35a:	66 90                	xchg   %ax,%ax
+ 35c:	66 90                	xchg   %ax,%ax
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 360:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 361:	31 c0                	xor    %eax,%eax
+{
+ 363:	89 e5                	mov    %esp,%ebp
+ 365:	53                   	push   %ebx
+ 366:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 369:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 370:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 374:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 377:	83 c0 01             	add    $0x1,%eax
+ 37a:	84 d2                	test   %dl,%dl
+ 37c:	75 f2                	jne    370 <strcpy+0x10>
+    ;
+  return os;
+}
+ 37e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 381:	89 c8                	mov    %ecx,%eax
+ 383:	c9                   	leave
+ 384:	c3                   	ret
+ 385:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	53                   	push   %ebx
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+ 397:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 39a:	0f b6 02             	movzbl (%edx),%eax
+ 39d:	84 c0                	test   %al,%al
+ 39f:	75 17                	jne    3b8 <strcmp+0x28>
+ 3a1:	eb 3a                	jmp    3dd <strcmp+0x4d>
+ 3a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3a7:	90                   	nop
+ 3a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ac:	83 c2 01             	add    $0x1,%edx
+ 3af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3b2:	84 c0                	test   %al,%al
+ 3b4:	74 1a                	je     3d0 <strcmp+0x40>
+    p++, q++;
+ 3b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3b8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3bb:	38 c3                	cmp    %al,%bl
+ 3bd:	74 e9                	je     3a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3bf:	29 d8                	sub    %ebx,%eax
+}
+ 3c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c4:	c9                   	leave
+ 3c5:	c3                   	ret
+ 3c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3d4:	31 c0                	xor    %eax,%eax
+ 3d6:	29 d8                	sub    %ebx,%eax
+}
+ 3d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3db:	c9                   	leave
+ 3dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3dd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3e0:	31 c0                	xor    %eax,%eax
+ 3e2:	eb db                	jmp    3bf <strcmp+0x2f>
+ 3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3f6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3f9:	74 15                	je     410 <strlen+0x20>
+ 3fb:	31 c0                	xor    %eax,%eax
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 400:	83 c0 01             	add    $0x1,%eax
+ 403:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 407:	89 c1                	mov    %eax,%ecx
+ 409:	75 f5                	jne    400 <strlen+0x10>
+    ;
+  return n;
+}
+ 40b:	89 c8                	mov    %ecx,%eax
+ 40d:	5d                   	pop    %ebp
+ 40e:	c3                   	ret
+ 40f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 410:	31 c9                	xor    %ecx,%ecx
+}
+ 412:	5d                   	pop    %ebp
+ 413:	89 c8                	mov    %ecx,%eax
+ 415:	c3                   	ret
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000420 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	57                   	push   %edi
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 427:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 42a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 42d:	89 d7                	mov    %edx,%edi
+ 42f:	fc                   	cld
+ 430:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 432:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 435:	89 d0                	mov    %edx,%eax
+ 437:	c9                   	leave
+ 438:	c3                   	ret
+ 439:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000440 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+ 446:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 44a:	0f b6 10             	movzbl (%eax),%edx
+ 44d:	84 d2                	test   %dl,%dl
+ 44f:	75 12                	jne    463 <strchr+0x23>
+ 451:	eb 1d                	jmp    470 <strchr+0x30>
+ 453:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 457:	90                   	nop
+ 458:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 45c:	83 c0 01             	add    $0x1,%eax
+ 45f:	84 d2                	test   %dl,%dl
+ 461:	74 0d                	je     470 <strchr+0x30>
+    if(*s == c)
+ 463:	38 d1                	cmp    %dl,%cl
+ 465:	75 f1                	jne    458 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 467:	5d                   	pop    %ebp
+ 468:	c3                   	ret
+ 469:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 470:	31 c0                	xor    %eax,%eax
+}
+ 472:	5d                   	pop    %ebp
+ 473:	c3                   	ret
+ 474:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 485:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 488:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 489:	31 db                	xor    %ebx,%ebx
+{
+ 48b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 48e:	eb 27                	jmp    4b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 490:	83 ec 04             	sub    $0x4,%esp
+ 493:	6a 01                	push   $0x1
+ 495:	56                   	push   %esi
+ 496:	6a 00                	push   $0x0
+ 498:	e8 cf 02 00 00       	call   76c <read>
+    if(cc < 1)
+ 49d:	83 c4 10             	add    $0x10,%esp
+ 4a0:	85 c0                	test   %eax,%eax
+ 4a2:	7e 1d                	jle    4c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4af:	3c 0a                	cmp    $0xa,%al
+ 4b1:	74 10                	je     4c3 <gets+0x43>
+ 4b3:	3c 0d                	cmp    $0xd,%al
+ 4b5:	74 0c                	je     4c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4b7:	89 df                	mov    %ebx,%edi
+ 4b9:	83 c3 01             	add    $0x1,%ebx
+ 4bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4bf:	7c cf                	jl     490 <gets+0x10>
+ 4c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4cd:	5b                   	pop    %ebx
+ 4ce:	5e                   	pop    %esi
+ 4cf:	5f                   	pop    %edi
+ 4d0:	5d                   	pop    %ebp
+ 4d1:	c3                   	ret
+ 4d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	56                   	push   %esi
+ 4e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4e5:	83 ec 08             	sub    $0x8,%esp
+ 4e8:	6a 00                	push   $0x0
+ 4ea:	ff 75 08             	push   0x8(%ebp)
+ 4ed:	e8 a2 02 00 00       	call   794 <open>
+  if(fd < 0)
+ 4f2:	83 c4 10             	add    $0x10,%esp
+ 4f5:	85 c0                	test   %eax,%eax
+ 4f7:	78 27                	js     520 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4f9:	83 ec 08             	sub    $0x8,%esp
+ 4fc:	ff 75 0c             	push   0xc(%ebp)
+ 4ff:	89 c3                	mov    %eax,%ebx
+ 501:	50                   	push   %eax
+ 502:	e8 a5 02 00 00       	call   7ac <fstat>
+  close(fd);
+ 507:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 50a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 50c:	e8 6b 02 00 00       	call   77c <close>
+  return r;
+ 511:	83 c4 10             	add    $0x10,%esp
+}
+ 514:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 517:	89 f0                	mov    %esi,%eax
+ 519:	5b                   	pop    %ebx
+ 51a:	5e                   	pop    %esi
+ 51b:	5d                   	pop    %ebp
+ 51c:	c3                   	ret
+ 51d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 520:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 525:	eb ed                	jmp    514 <stat+0x34>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+
+00000530 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	53                   	push   %ebx
+ 534:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 537:	0f be 02             	movsbl (%edx),%eax
+ 53a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 53d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 540:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 545:	77 1e                	ja     565 <atoi+0x35>
+ 547:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 54e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 550:	83 c2 01             	add    $0x1,%edx
+ 553:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 556:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 55a:	0f be 02             	movsbl (%edx),%eax
+ 55d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 560:	80 fb 09             	cmp    $0x9,%bl
+ 563:	76 eb                	jbe    550 <atoi+0x20>
+  return n;
+}
+ 565:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 568:	89 c8                	mov    %ecx,%eax
+ 56a:	c9                   	leave
+ 56b:	c3                   	ret
+ 56c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	57                   	push   %edi
+ 574:	56                   	push   %esi
+ 575:	8b 45 10             	mov    0x10(%ebp),%eax
+ 578:	8b 55 08             	mov    0x8(%ebp),%edx
+ 57b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 57e:	85 c0                	test   %eax,%eax
+ 580:	7e 13                	jle    595 <memmove+0x25>
+ 582:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 584:	89 d7                	mov    %edx,%edi
+ 586:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 590:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 591:	39 f8                	cmp    %edi,%eax
+ 593:	75 fb                	jne    590 <memmove+0x20>
+  return vdst;
+}
+ 595:	5e                   	pop    %esi
+ 596:	89 d0                	mov    %edx,%eax
+ 598:	5f                   	pop    %edi
+ 599:	5d                   	pop    %ebp
+ 59a:	c3                   	ret
+ 59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+
+000005a0 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5ac:	5d                   	pop    %ebp
+ 5ad:	c3                   	ret
+ 5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 5b0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 5b1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 5b6:	89 e5                	mov    %esp,%ebp
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+ 5c0:	89 c8                	mov    %ecx,%eax
+ 5c2:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 5c5:	85 c0                	test   %eax,%eax
+ 5c7:	75 f7                	jne    5c0 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 5c9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 5ce:	5d                   	pop    %ebp
+ 5cf:	c3                   	ret
+
+000005d0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	31 c0                	xor    %eax,%eax
+ 5d3:	89 e5                	mov    %esp,%ebp
+ 5d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 5d8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 5dd:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 5e0:	5d                   	pop    %ebp
+ 5e1:	c3                   	ret
+ 5e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005f0 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 5f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5fc:	5d                   	pop    %ebp
+ 5fd:	c3                   	ret
+ 5fe:	66 90                	xchg   %ax,%ax
+
+00000600 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 600:	55                   	push   %ebp
+ 601:	b8 01 00 00 00       	mov    $0x1,%eax
+ 606:	89 e5                	mov    %esp,%ebp
+ 608:	56                   	push   %esi
+ 609:	53                   	push   %ebx
+ 60a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 60d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 610:	85 c0                	test   %eax,%eax
+ 612:	74 2d                	je     641 <mutex_lock+0x41>
+ 614:	b8 02 00 00 00       	mov    $0x2,%eax
+ 619:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 61c:	85 c0                	test   %eax,%eax
+ 61e:	74 21                	je     641 <mutex_lock+0x41>
+ 620:	be 02 00 00 00       	mov    $0x2,%esi
+ 625:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 628:	83 ec 04             	sub    $0x4,%esp
+ 62b:	6a 02                	push   $0x2
+ 62d:	6a 00                	push   $0x0
+ 62f:	53                   	push   %ebx
+ 630:	e8 37 02 00 00       	call   86c <futex>
+ 635:	89 f0                	mov    %esi,%eax
+ 637:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 63a:	83 c4 10             	add    $0x10,%esp
+ 63d:	85 c0                	test   %eax,%eax
+ 63f:	75 e7                	jne    628 <mutex_lock+0x28>
+}
+ 641:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 644:	5b                   	pop    %ebx
+ 645:	5e                   	pop    %esi
+ 646:	5d                   	pop    %ebp
+ 647:	c3                   	ret
+ 648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+
+00000650 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 650:	55                   	push   %ebp
+ 651:	31 c0                	xor    %eax,%eax
+ 653:	89 e5                	mov    %esp,%ebp
+ 655:	83 ec 08             	sub    $0x8,%esp
+ 658:	8b 55 08             	mov    0x8(%ebp),%edx
+ 65b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 65e:	83 f8 02             	cmp    $0x2,%eax
+ 661:	74 05                	je     668 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 663:	c9                   	leave
+ 664:	c3                   	ret
+ 665:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 668:	83 ec 04             	sub    $0x4,%esp
+ 66b:	6a 01                	push   $0x1
+ 66d:	6a 01                	push   $0x1
+ 66f:	52                   	push   %edx
+ 670:	e8 f7 01 00 00       	call   86c <futex>
+ 675:	83 c4 10             	add    $0x10,%esp
+}
+ 678:	c9                   	leave
+ 679:	c3                   	ret
+ 67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000680 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 683:	8b 45 08             	mov    0x8(%ebp),%eax
+ 686:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 68c:	5d                   	pop    %ebp
+ 68d:	c3                   	ret
+ 68e:	66 90                	xchg   %ax,%ax
+
+00000690 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 690:	55                   	push   %ebp
+ 691:	31 c0                	xor    %eax,%eax
+ 693:	89 e5                	mov    %esp,%ebp
+ 695:	57                   	push   %edi
+ 696:	56                   	push   %esi
+ 697:	53                   	push   %ebx
+ 698:	83 ec 0c             	sub    $0xc,%esp
+ 69b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 69e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 6a1:	8b 3e                	mov    (%esi),%edi
+ 6a3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 6a6:	83 f8 02             	cmp    $0x2,%eax
+ 6a9:	74 4d                	je     6f8 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 6ab:	83 ec 04             	sub    $0x4,%esp
+ 6ae:	57                   	push   %edi
+ 6af:	6a 00                	push   $0x0
+ 6b1:	56                   	push   %esi
+ 6b2:	e8 b5 01 00 00       	call   86c <futex>
+ 6b7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6bc:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 6bf:	83 c4 10             	add    $0x10,%esp
+ 6c2:	85 c0                	test   %eax,%eax
+ 6c4:	74 23                	je     6e9 <cond_wait+0x59>
+ 6c6:	be 02 00 00 00       	mov    $0x2,%esi
+ 6cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6cf:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 6d0:	83 ec 04             	sub    $0x4,%esp
+ 6d3:	6a 02                	push   $0x2
+ 6d5:	6a 00                	push   $0x0
+ 6d7:	53                   	push   %ebx
+ 6d8:	e8 8f 01 00 00       	call   86c <futex>
+ 6dd:	89 f0                	mov    %esi,%eax
+ 6df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 6e2:	83 c4 10             	add    $0x10,%esp
+ 6e5:	85 c0                	test   %eax,%eax
+ 6e7:	75 e7                	jne    6d0 <cond_wait+0x40>
+}
+ 6e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6ec:	5b                   	pop    %ebx
+ 6ed:	5e                   	pop    %esi
+ 6ee:	5f                   	pop    %edi
+ 6ef:	5d                   	pop    %ebp
+ 6f0:	c3                   	ret
+ 6f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 6f8:	83 ec 04             	sub    $0x4,%esp
+ 6fb:	6a 01                	push   $0x1
+ 6fd:	6a 01                	push   $0x1
+ 6ff:	53                   	push   %ebx
+ 700:	e8 67 01 00 00       	call   86c <futex>
+ 705:	83 c4 10             	add    $0x10,%esp
+ 708:	eb a1                	jmp    6ab <cond_wait+0x1b>
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000710 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 719:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 71d:	6a 01                	push   $0x1
+ 71f:	6a 01                	push   $0x1
+ 721:	50                   	push   %eax
+ 722:	e8 45 01 00 00       	call   86c <futex>
+}
+ 727:	83 c4 10             	add    $0x10,%esp
+ 72a:	c9                   	leave
+ 72b:	c3                   	ret
+ 72c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000730 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+ 733:	83 ec 0c             	sub    $0xc,%esp
+ 736:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 739:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 73d:	6a ff                	push   $0xffffffff
+ 73f:	6a 01                	push   $0x1
+ 741:	50                   	push   %eax
+ 742:	e8 25 01 00 00       	call   86c <futex>
+}
+ 747:	83 c4 10             	add    $0x10,%esp
+ 74a:	c9                   	leave
+ 74b:	c3                   	ret
+
+0000074c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 74c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <exit>:
+SYSCALL(exit)
+ 754:	b8 02 00 00 00       	mov    $0x2,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <wait>:
+SYSCALL(wait)
+ 75c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <pipe>:
+SYSCALL(pipe)
+ 764:	b8 04 00 00 00       	mov    $0x4,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <read>:
+SYSCALL(read)
+ 76c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 771:	cd 40                	int    $0x40
+ 773:	c3                   	ret
+
+00000774 <write>:
+SYSCALL(write)
+ 774:	b8 10 00 00 00       	mov    $0x10,%eax
+ 779:	cd 40                	int    $0x40
+ 77b:	c3                   	ret
+
+0000077c <close>:
+SYSCALL(close)
+ 77c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 781:	cd 40                	int    $0x40
+ 783:	c3                   	ret
+
+00000784 <kill>:
+SYSCALL(kill)
+ 784:	b8 06 00 00 00       	mov    $0x6,%eax
+ 789:	cd 40                	int    $0x40
+ 78b:	c3                   	ret
+
+0000078c <exec>:
+SYSCALL(exec)
+ 78c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 791:	cd 40                	int    $0x40
+ 793:	c3                   	ret
+
+00000794 <open>:
+SYSCALL(open)
+ 794:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <mknod>:
+SYSCALL(mknod)
+ 79c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7a1:	cd 40                	int    $0x40
+ 7a3:	c3                   	ret
+
+000007a4 <unlink>:
+SYSCALL(unlink)
+ 7a4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7a9:	cd 40                	int    $0x40
+ 7ab:	c3                   	ret
+
+000007ac <fstat>:
+SYSCALL(fstat)
+ 7ac:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7b1:	cd 40                	int    $0x40
+ 7b3:	c3                   	ret
+
+000007b4 <link>:
+SYSCALL(link)
+ 7b4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7b9:	cd 40                	int    $0x40
+ 7bb:	c3                   	ret
+
+000007bc <mkdir>:
+SYSCALL(mkdir)
+ 7bc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7c1:	cd 40                	int    $0x40
+ 7c3:	c3                   	ret
+
+000007c4 <chdir>:
+SYSCALL(chdir)
+ 7c4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7c9:	cd 40                	int    $0x40
+ 7cb:	c3                   	ret
+
+000007cc <dup>:
+SYSCALL(dup)
+ 7cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7d1:	cd 40                	int    $0x40
+ 7d3:	c3                   	ret
+
+000007d4 <getpid>:
+SYSCALL(getpid)
+ 7d4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7d9:	cd 40                	int    $0x40
+ 7db:	c3                   	ret
+
+000007dc <sbrk>:
+SYSCALL(sbrk)
+ 7dc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7e1:	cd 40                	int    $0x40
+ 7e3:	c3                   	ret
+
+000007e4 <sleep>:
+SYSCALL(sleep)
+ 7e4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7e9:	cd 40                	int    $0x40
+ 7eb:	c3                   	ret
+
+000007ec <uptime>:
+SYSCALL(uptime)
+ 7ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7f1:	cd 40                	int    $0x40
+ 7f3:	c3                   	ret
+
+000007f4 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 7f4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7f9:	cd 40                	int    $0x40
+ 7fb:	c3                   	ret
+
+000007fc <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 7fc:	b8 19 00 00 00       	mov    $0x19,%eax
+ 801:	cd 40                	int    $0x40
+ 803:	c3                   	ret
+
+00000804 <wmap>:
+SYSCALL(wmap)
+ 804:	b8 16 00 00 00       	mov    $0x16,%eax
+ 809:	cd 40                	int    $0x40
+ 80b:	c3                   	ret
+
+0000080c <wunmap>:
+SYSCALL(wunmap)
+ 80c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 811:	cd 40                	int    $0x40
+ 813:	c3                   	ret
+
+00000814 <wremap>:
+SYSCALL(wremap)
+ 814:	b8 18 00 00 00       	mov    $0x18,%eax
+ 819:	cd 40                	int    $0x40
+ 81b:	c3                   	ret
+
+0000081c <wmlock>:
+SYSCALL(wmlock)
+ 81c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 821:	cd 40                	int    $0x40
+ 823:	c3                   	ret
+
+00000824 <wmunlock>:
+SYSCALL(wmunlock)
+ 824:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 829:	cd 40                	int    $0x40
+ 82b:	c3                   	ret
+
+0000082c <wmapoff>:
+SYSCALL(wmapoff)
+ 82c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 831:	cd 40                	int    $0x40
+ 833:	c3                   	ret
+
+00000834 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 834:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 839:	cd 40                	int    $0x40
+ 83b:	c3                   	ret
+
+0000083c <setpriority>:
+SYSCALL(setpriority)
+ 83c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 841:	cd 40                	int    $0x40
+ 843:	c3                   	ret
+
+00000844 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 844:	b8 20 00 00 00       	mov    $0x20,%eax
+ 849:	cd 40                	int    $0x40
+ 84b:	c3                   	ret
+
+0000084c <settickets>:
+SYSCALL(settickets)
+ 84c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 851:	cd 40                	int    $0x40
+ 853:	c3                   	ret
+
+00000854 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 854:	b8 22 00 00 00       	mov    $0x22,%eax
+ 859:	cd 40                	int    $0x40
+ 85b:	c3                   	ret
+
+0000085c <clone>:
+SYSCALL(clone)
+ 85c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 861:	cd 40                	int    $0x40
+ 863:	c3                   	ret
+
+00000864 <join>:
+SYSCALL(join)
+ 864:	b8 24 00 00 00       	mov    $0x24,%eax
+ 869:	cd 40                	int    $0x40
+ 86b:	c3                   	ret
+
+0000086c <futex>:
+SYSCALL(futex)
+ 86c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 871:	cd 40                	int    $0x40
+ 873:	c3                   	ret
+
+00000874 <setaffinity>:
+SYSCALL(setaffinity)
+ 874:	b8 26 00 00 00       	mov    $0x26,%eax
+ 879:	cd 40                	int    $0x40
+ 87b:	c3                   	ret
+
+0000087c <getaffinity>:
+SYSCALL(getaffinity)
+ 87c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 881:	cd 40                	int    $0x40
+ 883:	c3                   	ret
+
+00000884 <bcstat>:
+SYSCALL(bcstat)
+ 884:	b8 29 00 00 00       	mov    $0x29,%eax
+ 889:	cd 40                	int    $0x40
+ 88b:	c3                   	ret
+
+0000088c <dropcache>:
+SYSCALL(dropcache)
+ 88c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 891:	cd 40                	int    $0x40
+ 893:	c3                   	ret
+
+00000894 <setiosched>:
+SYSCALL(setiosched)
+ 894:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 899:	cd 40                	int    $0x40
+ 89b:	c3                   	ret
+
+0000089c <iostat>:
+SYSCALL(iostat)
+ 89c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8a1:	cd 40                	int    $0x40
+ 8a3:	c3                   	ret
+
+000008a4 <fsync>:
+SYSCALL(fsync)
+ 8a4:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 8a9:	cd 40                	int    $0x40
+ 8ab:	c3                   	ret
+
+000008ac <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 8ac:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 8ad:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 8b2:	cd 40                	int    $0x40
+ 8b4:	ff e1                	jmp    *%ecx
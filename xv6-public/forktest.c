@@ -1,11 +1,14 @@
-// Test that fork fails gracefully.
+// Test that fork fails gracefully, then time fork+exec against
+// vfork+exec, with a small heap and again with a big one.
 // Tiny executable so that the limit can be filling the proc table.
 
 #include "types.h"
 #include "stat.h"
 #include "user.h"
 
-#define N  1000
+#define N  5000  // more than NPROC
+#define NEXEC    100          // fork+exec rounds to time
+#define BIGHEAP  (1024*1024)  // heap fork has to copy in the second run
 
 void
 printf(int fd, const char *s, ...)
@@ -13,6 +16,20 @@ printf(int fd, const char *s, ...)
   write(fd, s, strlen(s));
 }
 
+// Print n in decimal.
+void
+printnum(int fd, int n)
+{
+  char buf[12];
+  int i;
+
+  i = sizeof(buf);
+  do {
+    buf[--i] = '0' + n % 10;
+  } while((n /= 10) > 0);
+  write(fd, buf + i, sizeof(buf) - i);
+}
+
 void
 forktest(void)
 {
@@ -48,9 +65,45 @@ forktest(void)
   printf(1, "fork test OK\n");
 }
 
+// Time NEXEC rounds of running this program, with an argument that
+// makes it exit at once, from a child made by fork or vfork.
+void
+exectest(int usevfork)
+{
+  char *argv[] = { "forktest", "x", 0 };
+  int i, pid, start;
+
+  start = uptime();
+  for(i = 0; i < NEXEC; i++){
+    pid = usevfork ? vfork() : fork();
+    if(pid < 0){
+      printf(1, "exec test: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+      exec(argv[0], argv);
+      printf(1, "exec test: exec failed\n");
+      exit();
+    }
+    wait();
+  }
+  printf(1, usevfork ? "vfork+exec: " : "fork+exec: ");
+  printnum(1, uptime() - start);
+  printf(1, " ticks\n");
+}
+
 int
-main(void)
+main(int argc, char *argv[])
 {
+  if(argc > 1)
+    exit();  // started by exectest
   forktest();
+  exectest(0);
+  exectest(1);
+  if(sbrk(BIGHEAP) != (char*)-1){
+    printf(1, "with a big heap:\n");
+    exectest(0);
+    exectest(1);
+  }
   exit();
 }
@@ -44,7 +44,7 @@ bzero(int dev, int bno)
 {
   struct buf *bp;
 
-  bp = bread(dev, bno);
+  bp = bnew(dev, bno);
   memset(bp->data, 0, BSIZE);
   log_write(bp);
   brelse(bp);
@@ -52,29 +52,50 @@ bzero(int dev, int bno)
 
 // Blocks.
 
-// Allocate a zeroed disk block.
+// Where balloc looks first for a block with no neighbour to follow.
+static uint allocnext;
+
+// Mark the first free block in [from, to) in use and return it,
+// or return 0 if there is none.
 static uint
-balloc(uint dev)
+bscan(uint dev, uint from, uint to)
 {
-  int b, bi, m;
+  uint b, bi, m;
   struct buf *bp;
 
-  bp = 0;
-  for(b = 0; b < sb.size; b += BPB){
+  for(b = from - from%BPB; b < to; b += BPB){
     bp = bread(dev, BBLOCK(b, sb));
-    for(bi = 0; bi < BPB && b + bi < sb.size; bi++){
+    for(bi = b < from ? from - b : 0; bi < BPB && b + bi < to; bi++){
       m = 1 << (bi % 8);
       if((bp->data[bi/8] & m) == 0){  // Is block free?
         bp->data[bi/8] |= m;  // Mark block in use.
         log_write(bp);
         brelse(bp);
-        bzero(dev, b + bi);
         return b + bi;
       }
     }
     brelse(bp);
   }
-  panic("balloc: out of blocks");
+  return 0;
+}
+
+// Allocate a zeroed disk block, the first free one after prev
+// if prev is not 0, so that a file written in order is laid out
+// in order and can be read with few disk requests.
+static uint
+balloc(uint dev, uint prev)
+{
+  uint b, near;
+
+  near = prev ? prev + 1 : allocnext;
+  if(near >= sb.size)
+    near = 0;
+  // block 0, the boot block, is never free.
+  if((b = bscan(dev, near, sb.size)) == 0 && (b = bscan(dev, 0, near)) == 0)
+    panic("balloc: out of blocks");
+  allocnext = b + 1;
+  bzero(dev, b);
+  return b;
 }
 
 // Free a disk block.
@@ -179,6 +200,10 @@ iinit(int dev)
   }
 
   readsb(dev, &sb);
+  if(sb.version != FSVERSION)
+    panic("iinit: wrong file system version");
+  if(sb.bsize != BSIZE)
+    panic("iinit: wrong block size");
   cprintf("sb: size %d nblocks %d ninodes %d nlog %d logstart %d\
  inodestart %d bmap start %d\n", sb.size, sb.nblocks,
           sb.ninodes, sb.nlog, sb.logstart, sb.inodestart,
@@ -305,6 +330,8 @@ ilock(struct inode *ip)
     ip->size = dip->size;
     memmove(ip->addrs, dip->addrs, sizeof(ip->addrs));
     brelse(bp);
+    ip->ranext = ip->raend = 0;
+    ip->lastblock = 0;
     ip->valid = 1;
     if(ip->type == 0)
       panic("ilock: no type");
@@ -365,38 +392,79 @@ iunlockput(struct inode *ip)
 // The content (data) associated with each inode is stored
 // in blocks on the disk. The first NDIRECT block numbers
 // are listed in ip->addrs[].  The next NINDIRECT blocks are
-// listed in block ip->addrs[NDIRECT].
+// listed in block ip->addrs[NDIRECT], the NINDIRECT^2 after
+// those in the blocks listed in block ip->addrs[NDIRECT+1],
+// and so on for NLEVEL levels.
+
+// Allocate a block for ip, after the one it got last.
+static uint
+iballoc(struct inode *ip)
+{
+  ip->lastblock = balloc(ip->dev, ip->lastblock);
+  return ip->lastblock;
+}
 
 // Return the disk block address of the nth block in inode ip.
 // If there is no such block, bmap allocates one.
 static uint
 bmap(struct inode *ip, uint bn)
 {
-  uint addr, *a;
+  uint addr, *a, span;
   struct buf *bp;
+  int level;
 
   if(bn < NDIRECT){
     if((addr = ip->addrs[bn]) == 0)
-      ip->addrs[bn] = addr = balloc(ip->dev);
+      ip->addrs[bn] = addr = iballoc(ip);
     return addr;
   }
   bn -= NDIRECT;
 
-  if(bn < NINDIRECT){
-    // Load indirect block, allocating if necessary.
-    if((addr = ip->addrs[NDIRECT]) == 0)
-      ip->addrs[NDIRECT] = addr = balloc(ip->dev);
+  // Find the tree holding bn; each entry of its root maps span
+  // blocks.
+  span = 1;
+  for(level = 0; bn >= span*NINDIRECT; level++){
+    if(level == NLEVEL-1)
+      panic("bmap: out of range");
+    bn -= span*NINDIRECT;
+    span *= NINDIRECT;
+  }
+
+  // Walk down the tree, allocating indirect blocks as necessary.
+  if((addr = ip->addrs[NDIRECT+level]) == 0)
+    ip->addrs[NDIRECT+level] = addr = iballoc(ip);
+  for(; span > 0; span /= NINDIRECT){
     bp = bread(ip->dev, addr);
     a = (uint*)bp->data;
-    if((addr = a[bn]) == 0){
-      a[bn] = addr = balloc(ip->dev);
+    if((addr = a[bn/span]) == 0){
+      a[bn/span] = addr = iballoc(ip);
       log_write(bp);
     }
     brelse(bp);
-    return addr;
+    bn %= span;
   }
+  return addr;
+}
+
+// Free block addr and, if it is an indirect block with level
+// levels below it, all the blocks it maps.
+static void
+bfreetree(uint dev, uint addr, int level)
+{
+  struct buf *bp;
+  uint *a;
+  int j;
 
-  panic("bmap: out of range");
+  if(level > 0){
+    bp = bread(dev, addr);
+    a = (uint*)bp->data;
+    for(j = 0; j < NINDIRECT; j++){
+      if(a[j])
+        bfreetree(dev, a[j], level-1);
+    }
+    brelse(bp);
+  }
+  bfree(dev, addr);
 }
 
 // Truncate inode (discard contents).
@@ -407,9 +475,7 @@ bmap(struct inode *ip, uint bn)
 static void
 itrunc(struct inode *ip)
 {
-  int i, j;
-  struct buf *bp;
-  uint *a;
+  int i;
 
   for(i = 0; i < NDIRECT; i++){
     if(ip->addrs[i]){
@@ -418,17 +484,13 @@ itrunc(struct inode *ip)
     }
   }
 
-  if(ip->addrs[NDIRECT]){
-    bp = bread(ip->dev, ip->addrs[NDIRECT]);
-    a = (uint*)bp->data;
-    for(j = 0; j < NINDIRECT; j++){
-      if(a[j])
-        bfree(ip->dev, a[j]);
+  for(i = 0; i < NLEVEL; i++){
+    if(ip->addrs[NDIRECT+i]){
+      bfreetree(ip->dev, ip->addrs[NDIRECT+i], i+1);
+      ip->addrs[NDIRECT+i] = 0;
     }
-    brelse(bp);
-    bfree(ip->dev, ip->addrs[NDIRECT]);
-    ip->addrs[NDIRECT] = 0;
   }
+  ip->lastblock = 0;
 
   ip->size = 0;
   iupdate(ip);
@@ -446,14 +508,41 @@ stati(struct inode *ip, struct stat *st)
   st->size = ip->size;
 }
 
+// Note that a reader of ip is about to read block bn.  If it has
+// been reading sequentially, fill ra with the disk addresses of
+// blocks to read ahead and return how many there are; once the
+// reader has used up half of what was read ahead, read ahead up to
+// RABLOCKS blocks past bn.  Caller must hold ip->lock.
+static int
+readahead(struct inode *ip, uint bn, uint *ra)
+{
+  uint end;
+  int n;
+
+  if(bn != ip->ranext && bn + 1 != ip->ranext){
+    ip->ranext = ip->raend = bn + 1;
+    return 0;
+  }
+  ip->ranext = bn + 1;
+  if(ip->raend < bn + 1)
+    ip->raend = bn + 1;
+  if(bn + RABLOCKS/2 < ip->raend)
+    return 0;
+  end = min(bn + 1 + RABLOCKS, (ip->size + BSIZE - 1) / BSIZE);
+  for(n = 0; ip->raend < end; ip->raend++)
+    ra[n++] = bmap(ip, ip->raend);
+  return n;
+}
+
 //PAGEBREAK!
 // Read data from inode.
 // Caller must hold ip->lock.
 int
 readi(struct inode *ip, char *dst, uint off, uint n)
 {
-  uint tot, m;
+  uint tot, m, ra[RABLOCKS];
   struct buf *bp;
+  int nra;
 
   if(ip->type == T_DEV){
     if(ip->major < 0 || ip->major >= NDEV || !devsw[ip->major].read)
@@ -467,7 +556,8 @@ readi(struct inode *ip, char *dst, uint off, uint n)
     n = ip->size - off;
 
   for(tot=0; tot<n; tot+=m, off+=m, dst+=m){
-    bp = bread(ip->dev, bmap(ip, off/BSIZE));
+    nra = readahead(ip, off/BSIZE, ra);
+    bp = breada(ip->dev, bmap(ip, off/BSIZE), ra, nra);
     m = min(n - tot, BSIZE - off%BSIZE);
     memmove(dst, bp->data + off%BSIZE, m);
     brelse(bp);
@@ -492,7 +582,7 @@ writei(struct inode *ip, char *src, uint off, uint n)
 
   if(off > ip->size || off + n < off)
     return -1;
-  if(off + n > MAXFILE*BSIZE)
+  if((off + n + BSIZE - 1) / BSIZE > MAXFILE)
     return -1;
 
   for(tot=0; tot<n; tot+=m, off+=m, src+=m){
@@ -3,7 +3,9 @@
 
 
 #define ROOTINO 1  // root i-number
-#define BSIZE 512  // block size
+#define BSIZE 4096  // block size, one page
+#define FSVERSION 3  // on-disk format; 2 added multi-level indirect
+                     // blocks, 3 the block size in the super block
 
 // Disk layout:
 // [ boot block | super block | log | inode blocks |
@@ -19,11 +21,18 @@ struct superblock {
   uint logstart;     // Block number of first log block
   uint inodestart;   // Block number of first inode block
   uint bmapstart;    // Block number of first free map block
+  uint version;      // Format of the file system, FSVERSION
+  uint bsize;        // Block size in bytes, BSIZE
 };
 
-#define NDIRECT 12
+// An inode lists NDIRECT data blocks, then the roots of trees of
+// NLEVEL indirect blocks: addrs[NDIRECT+l] maps NINDIRECT^(l+1)
+// blocks through l+1 levels of indirect blocks.
+#define NDIRECT 10
+#define NLEVEL 3
 #define NINDIRECT (BSIZE / sizeof(uint))
-#define MAXFILE (NDIRECT + NINDIRECT)
+#define MAXFILE (NDIRECT + NINDIRECT + NINDIRECT*NINDIRECT + \
+                 NINDIRECT*NINDIRECT*NINDIRECT)
 
 // On-disk inode structure
 struct dinode {
@@ -32,7 +41,7 @@ struct dinode {
   short minor;          // Minor device number (T_DEV only)
   short nlink;          // Number of links to inode in file system
   uint size;            // Size of file (bytes)
-  uint addrs[NDIRECT+1];   // Data block addresses
+  uint addrs[NDIRECT+NLEVEL];   // Data block addresses
 };
 
 // Inodes per block.
@@ -0,0 +1,8 @@
+#ifndef FUTEX
+#define FUTEX
+
+// Operations for `futex`
+#define FUTEX_WAIT 0 // Sleep if the word still holds val
+#define FUTEX_WAKE 1 // Wake up to val waiters, all if val < 0
+
+#endif
@@ -0,0 +1,2185 @@
+
+_futexbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  wunmap((uint)sh);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	56                   	push   %esi
+   e:	53                   	push   %ebx
+   f:	51                   	push   %ecx
+  10:	83 ec 0c             	sub    $0xc,%esp
+  13:	8b 19                	mov    (%ecx),%ebx
+  15:	8b 71 04             	mov    0x4(%ecx),%esi
+  nthreads = 4;
+  18:	c7 05 b0 15 00 00 04 	movl   $0x4,0x15b0
+  1f:	00 00 00 
+  iters = 20000;
+  22:	c7 05 ac 15 00 00 20 	movl   $0x4e20,0x15ac
+  29:	4e 00 00 
+  if(argc > 1)
+  2c:	83 fb 01             	cmp    $0x1,%ebx
+  2f:	7f 45                	jg     76 <main+0x76>
+  if(nthreads < 1 || iters < 1){
+    printf(2, "usage: futexbench [threads [iters]]\n");
+    exit();
+  }
+
+  lock_init(&spin);
+  31:	83 ec 0c             	sub    $0xc,%esp
+  34:	68 a4 15 00 00       	push   $0x15a4
+  39:	e8 f2 05 00 00       	call   630 <lock_init>
+  mutex_init(&mu);
+  3e:	c7 04 24 a0 15 00 00 	movl   $0x15a0,(%esp)
+  45:	e8 36 06 00 00       	call   680 <mutex_init>
+  run("spinlock", spinworker);
+  4a:	58                   	pop    %eax
+  4b:	5a                   	pop    %edx
+  4c:	68 d0 00 00 00       	push   $0xd0
+  51:	68 fe 0e 00 00       	push   $0xefe
+  56:	e8 75 01 00 00       	call   1d0 <run>
+  run("mutex", mutexworker);
+  5b:	59                   	pop    %ecx
+  5c:	5b                   	pop    %ebx
+  5d:	68 40 01 00 00       	push   $0x140
+  62:	68 07 0f 00 00       	push   $0xf07
+  67:	e8 64 01 00 00       	call   1d0 <run>
+  crossproc();
+  6c:	e8 2f 02 00 00       	call   2a0 <crossproc>
+  exit();
+  71:	e8 6e 07 00 00       	call   7e4 <exit>
+    nthreads = atoi(argv[1]);
+  76:	83 ec 0c             	sub    $0xc,%esp
+  79:	ff 76 04             	push   0x4(%esi)
+  7c:	e8 3f 05 00 00       	call   5c0 <atoi>
+  if(argc > 2)
+  81:	83 c4 10             	add    $0x10,%esp
+    nthreads = atoi(argv[1]);
+  84:	a3 b0 15 00 00       	mov    %eax,0x15b0
+  if(argc > 2)
+  89:	83 fb 02             	cmp    $0x2,%ebx
+  8c:	74 13                	je     a1 <main+0xa1>
+    iters = atoi(argv[2]);
+  8e:	83 ec 0c             	sub    $0xc,%esp
+  91:	ff 76 08             	push   0x8(%esi)
+  94:	e8 27 05 00 00       	call   5c0 <atoi>
+  99:	83 c4 10             	add    $0x10,%esp
+  9c:	a3 ac 15 00 00       	mov    %eax,0x15ac
+  if(nthreads < 1 || iters < 1){
+  a1:	83 3d b0 15 00 00 00 	cmpl   $0x0,0x15b0
+  a8:	7f 14                	jg     be <main+0xbe>
+    printf(2, "usage: futexbench [threads [iters]]\n");
+  aa:	83 ec 08             	sub    $0x8,%esp
+  ad:	68 9c 0f 00 00       	push   $0xf9c
+  b2:	6a 02                	push   $0x2
+  b4:	e8 37 09 00 00       	call   9f0 <printf>
+    exit();
+  b9:	e8 26 07 00 00       	call   7e4 <exit>
+  if(nthreads < 1 || iters < 1){
+  be:	83 3d ac 15 00 00 00 	cmpl   $0x0,0x15ac
+  c5:	7e e3                	jle    aa <main+0xaa>
+  c7:	e9 65 ff ff ff       	jmp    31 <main+0x31>
+  cc:	66 90                	xchg   %ax,%ax
+  ce:	66 90                	xchg   %ax,%ax
+
+000000d0 <spinworker>:
+  for(i = 0; i < iters; i++){
+  d0:	a1 ac 15 00 00       	mov    0x15ac,%eax
+  d5:	85 c0                	test   %eax,%eax
+  d7:	7e 59                	jle    132 <spinworker+0x62>
+{
+  d9:	55                   	push   %ebp
+  da:	89 e5                	mov    %esp,%ebp
+  dc:	53                   	push   %ebx
+  for(i = 0; i < iters; i++){
+  dd:	31 db                	xor    %ebx,%ebx
+{
+  df:	83 ec 04             	sub    $0x4,%esp
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    lock_acquire(&spin);
+  e8:	83 ec 0c             	sub    $0xc,%esp
+  eb:	68 a4 15 00 00       	push   $0x15a4
+  f0:	e8 4b 05 00 00       	call   640 <lock_acquire>
+  f5:	83 c4 10             	add    $0x10,%esp
+  f8:	ba 32 00 00 00       	mov    $0x32,%edx
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+    (*c)++;
+ 100:	a1 a8 15 00 00       	mov    0x15a8,%eax
+ 105:	83 c0 01             	add    $0x1,%eax
+ 108:	a3 a8 15 00 00       	mov    %eax,0x15a8
+  for(i = 0; i < HOLD; i++)
+ 10d:	83 ea 01             	sub    $0x1,%edx
+ 110:	75 ee                	jne    100 <spinworker+0x30>
+    lock_release(&spin);
+ 112:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < iters; i++){
+ 115:	83 c3 01             	add    $0x1,%ebx
+    lock_release(&spin);
+ 118:	68 a4 15 00 00       	push   $0x15a4
+ 11d:	e8 3e 05 00 00       	call   660 <lock_release>
+  for(i = 0; i < iters; i++){
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	39 1d ac 15 00 00    	cmp    %ebx,0x15ac
+ 12b:	7f bb                	jg     e8 <spinworker+0x18>
+}
+ 12d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 130:	c9                   	leave
+ 131:	c3                   	ret
+ 132:	c3                   	ret
+ 133:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000140 <mutexworker>:
+  for(i = 0; i < iters; i++){
+ 140:	a1 ac 15 00 00       	mov    0x15ac,%eax
+ 145:	85 c0                	test   %eax,%eax
+ 147:	7e 59                	jle    1a2 <mutexworker+0x62>
+{
+ 149:	55                   	push   %ebp
+ 14a:	89 e5                	mov    %esp,%ebp
+ 14c:	53                   	push   %ebx
+  for(i = 0; i < iters; i++){
+ 14d:	31 db                	xor    %ebx,%ebx
+{
+ 14f:	83 ec 04             	sub    $0x4,%esp
+ 152:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    mutex_lock(&mu);
+ 158:	83 ec 0c             	sub    $0xc,%esp
+ 15b:	68 a0 15 00 00       	push   $0x15a0
+ 160:	e8 2b 05 00 00       	call   690 <mutex_lock>
+ 165:	83 c4 10             	add    $0x10,%esp
+ 168:	ba 32 00 00 00       	mov    $0x32,%edx
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    (*c)++;
+ 170:	a1 a8 15 00 00       	mov    0x15a8,%eax
+ 175:	83 c0 01             	add    $0x1,%eax
+ 178:	a3 a8 15 00 00       	mov    %eax,0x15a8
+  for(i = 0; i < HOLD; i++)
+ 17d:	83 ea 01             	sub    $0x1,%edx
+ 180:	75 ee                	jne    170 <mutexworker+0x30>
+    mutex_unlock(&mu);
+ 182:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < iters; i++){
+ 185:	83 c3 01             	add    $0x1,%ebx
+    mutex_unlock(&mu);
+ 188:	68 a0 15 00 00       	push   $0x15a0
+ 18d:	e8 4e 05 00 00       	call   6e0 <mutex_unlock>
+  for(i = 0; i < iters; i++){
+ 192:	83 c4 10             	add    $0x10,%esp
+ 195:	39 1d ac 15 00 00    	cmp    %ebx,0x15ac
+ 19b:	7f bb                	jg     158 <mutexworker+0x18>
+}
+ 19d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a0:	c9                   	leave
+ 1a1:	c3                   	ret
+ 1a2:	c3                   	ret
+ 1a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001b0 <critical>:
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	ba 32 00 00 00       	mov    $0x32,%edx
+ 1b6:	89 e5                	mov    %esp,%ebp
+ 1b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1bf:	90                   	nop
+    (*c)++;
+ 1c0:	8b 01                	mov    (%ecx),%eax
+ 1c2:	83 c0 01             	add    $0x1,%eax
+ 1c5:	89 01                	mov    %eax,(%ecx)
+  for(i = 0; i < HOLD; i++)
+ 1c7:	83 ea 01             	sub    $0x1,%edx
+ 1ca:	75 f4                	jne    1c0 <critical+0x10>
+}
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+
+000001d0 <run>:
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	57                   	push   %edi
+ 1d4:	56                   	push   %esi
+ 1d5:	53                   	push   %ebx
+ 1d6:	83 ec 0c             	sub    $0xc,%esp
+ 1d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  counter = 0;
+ 1dc:	c7 05 a8 15 00 00 00 	movl   $0x0,0x15a8
+ 1e3:	00 00 00 
+  start = uptime();
+ 1e6:	e8 91 06 00 00       	call   87c <uptime>
+ 1eb:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < nthreads; i++){
+ 1ed:	a1 b0 15 00 00       	mov    0x15b0,%eax
+ 1f2:	85 c0                	test   %eax,%eax
+ 1f4:	7e 42                	jle    238 <run+0x68>
+ 1f6:	31 db                	xor    %ebx,%ebx
+ 1f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+    if(thread_create(fn, 0) < 0){
+ 200:	83 ec 08             	sub    $0x8,%esp
+ 203:	6a 00                	push   $0x0
+ 205:	56                   	push   %esi
+ 206:	e8 35 0b 00 00       	call   d40 <thread_create>
+ 20b:	83 c4 10             	add    $0x10,%esp
+ 20e:	85 c0                	test   %eax,%eax
+ 210:	78 75                	js     287 <run+0xb7>
+  for(i = 0; i < nthreads; i++){
+ 212:	a1 b0 15 00 00       	mov    0x15b0,%eax
+ 217:	83 c3 01             	add    $0x1,%ebx
+ 21a:	39 d8                	cmp    %ebx,%eax
+ 21c:	7f e2                	jg     200 <run+0x30>
+  for(i = 0; i < nthreads; i++)
+ 21e:	85 c0                	test   %eax,%eax
+ 220:	7e 16                	jle    238 <run+0x68>
+ 222:	31 db                	xor    %ebx,%ebx
+ 224:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    thread_join();
+ 228:	e8 23 0c 00 00       	call   e50 <thread_join>
+  for(i = 0; i < nthreads; i++)
+ 22d:	83 c3 01             	add    $0x1,%ebx
+ 230:	39 1d b0 15 00 00    	cmp    %ebx,0x15b0
+ 236:	7f f0                	jg     228 <run+0x58>
+  elapsed = uptime() - start;
+ 238:	e8 3f 06 00 00       	call   87c <uptime>
+         counter == nthreads * iters * HOLD ? "" : " WRONG COUNT");
+ 23d:	8b 0d b0 15 00 00    	mov    0x15b0,%ecx
+  printf(1, "futexbench: %s: %d threads x %d: %d ticks%s\n",
+ 243:	be fd 0e 00 00       	mov    $0xefd,%esi
+         counter == nthreads * iters * HOLD ? "" : " WRONG COUNT");
+ 248:	8b 1d ac 15 00 00    	mov    0x15ac,%ebx
+  elapsed = uptime() - start;
+ 24e:	29 f8                	sub    %edi,%eax
+         counter == nthreads * iters * HOLD ? "" : " WRONG COUNT");
+ 250:	89 ca                	mov    %ecx,%edx
+ 252:	0f af d3             	imul   %ebx,%edx
+ 255:	6b d2 32             	imul   $0x32,%edx,%edx
+  printf(1, "futexbench: %s: %d threads x %d: %d ticks%s\n",
+ 258:	3b 15 a8 15 00 00    	cmp    0x15a8,%edx
+ 25e:	ba d8 0e 00 00       	mov    $0xed8,%edx
+ 263:	0f 44 d6             	cmove  %esi,%edx
+ 266:	83 ec 04             	sub    $0x4,%esp
+ 269:	52                   	push   %edx
+ 26a:	50                   	push   %eax
+ 26b:	53                   	push   %ebx
+ 26c:	51                   	push   %ecx
+ 26d:	ff 75 08             	push   0x8(%ebp)
+ 270:	68 34 0f 00 00       	push   $0xf34
+ 275:	6a 01                	push   $0x1
+ 277:	e8 74 07 00 00       	call   9f0 <printf>
+}
+ 27c:	83 c4 20             	add    $0x20,%esp
+ 27f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 282:	5b                   	pop    %ebx
+ 283:	5e                   	pop    %esi
+ 284:	5f                   	pop    %edi
+ 285:	5d                   	pop    %ebp
+ 286:	c3                   	ret
+      printf(2, "futexbench: thread_create failed\n");
+ 287:	83 ec 08             	sub    $0x8,%esp
+ 28a:	68 10 0f 00 00       	push   $0xf10
+ 28f:	6a 02                	push   $0x2
+ 291:	e8 5a 07 00 00       	call   9f0 <printf>
+      exit();
+ 296:	e8 49 05 00 00       	call   7e4 <exit>
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <crossproc>:
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+ 2a5:	53                   	push   %ebx
+ 2a6:	83 ec 0c             	sub    $0xc,%esp
+  sh = (void*)wmap(0, 4096, MAP_SHARED | MAP_ANONYMOUS | MAP_POPULATE, -1);
+ 2a9:	6a ff                	push   $0xffffffff
+ 2ab:	6a 16                	push   $0x16
+ 2ad:	68 00 10 00 00       	push   $0x1000
+ 2b2:	6a 00                	push   $0x0
+ 2b4:	e8 db 05 00 00       	call   894 <wmap>
+  if((int)sh == FAILED){
+ 2b9:	83 c4 10             	add    $0x10,%esp
+ 2bc:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 2bf:	0f 84 c3 00 00 00    	je     388 <crossproc+0xe8>
+  mutex_init(&sh->mu);
+ 2c5:	83 ec 0c             	sub    $0xc,%esp
+ 2c8:	89 c7                	mov    %eax,%edi
+ 2ca:	50                   	push   %eax
+ 2cb:	e8 b0 03 00 00       	call   680 <mutex_init>
+  sh->counter = 0;
+ 2d0:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%edi)
+  start = uptime();
+ 2d7:	e8 a0 05 00 00       	call   87c <uptime>
+ 2dc:	89 c6                	mov    %eax,%esi
+  if(fork() == 0){
+ 2de:	e8 f9 04 00 00       	call   7dc <fork>
+ 2e3:	83 c4 10             	add    $0x10,%esp
+ 2e6:	89 c3                	mov    %eax,%ebx
+ 2e8:	85 c0                	test   %eax,%eax
+ 2ea:	0f 84 b2 00 00 00    	je     3a2 <crossproc+0x102>
+  for(i = 0; i < iters; i++){
+ 2f0:	a1 ac 15 00 00       	mov    0x15ac,%eax
+ 2f5:	31 db                	xor    %ebx,%ebx
+ 2f7:	85 c0                	test   %eax,%eax
+ 2f9:	7e 42                	jle    33d <crossproc+0x9d>
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+    mutex_lock(&sh->mu);
+ 300:	83 ec 0c             	sub    $0xc,%esp
+ 303:	57                   	push   %edi
+ 304:	e8 87 03 00 00       	call   690 <mutex_lock>
+ 309:	83 c4 10             	add    $0x10,%esp
+ 30c:	ba 32 00 00 00       	mov    $0x32,%edx
+ 311:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    (*c)++;
+ 318:	8b 47 04             	mov    0x4(%edi),%eax
+ 31b:	83 c0 01             	add    $0x1,%eax
+ 31e:	89 47 04             	mov    %eax,0x4(%edi)
+  for(i = 0; i < HOLD; i++)
+ 321:	83 ea 01             	sub    $0x1,%edx
+ 324:	75 f2                	jne    318 <crossproc+0x78>
+    mutex_unlock(&sh->mu);
+ 326:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < iters; i++){
+ 329:	83 c3 01             	add    $0x1,%ebx
+    mutex_unlock(&sh->mu);
+ 32c:	57                   	push   %edi
+ 32d:	e8 ae 03 00 00       	call   6e0 <mutex_unlock>
+  for(i = 0; i < iters; i++){
+ 332:	83 c4 10             	add    $0x10,%esp
+ 335:	39 1d ac 15 00 00    	cmp    %ebx,0x15ac
+ 33b:	7f c3                	jg     300 <crossproc+0x60>
+  wait();
+ 33d:	e8 aa 04 00 00       	call   7ec <wait>
+  printf(1, "futexbench: shared mutex: 2 processes x %d: %d ticks%s\n",
+ 342:	bb fd 0e 00 00       	mov    $0xefd,%ebx
+  elapsed = uptime() - start;
+ 347:	e8 30 05 00 00       	call   87c <uptime>
+         iters, elapsed, sh->counter == 2 * iters * HOLD ? "" : " WRONG COUNT");
+ 34c:	8b 0d ac 15 00 00    	mov    0x15ac,%ecx
+  elapsed = uptime() - start;
+ 352:	29 f0                	sub    %esi,%eax
+         iters, elapsed, sh->counter == 2 * iters * HOLD ? "" : " WRONG COUNT");
+ 354:	6b d1 64             	imul   $0x64,%ecx,%edx
+  printf(1, "futexbench: shared mutex: 2 processes x %d: %d ticks%s\n",
+ 357:	39 57 04             	cmp    %edx,0x4(%edi)
+ 35a:	ba d8 0e 00 00       	mov    $0xed8,%edx
+ 35f:	0f 44 d3             	cmove  %ebx,%edx
+ 362:	83 ec 0c             	sub    $0xc,%esp
+ 365:	52                   	push   %edx
+ 366:	50                   	push   %eax
+ 367:	51                   	push   %ecx
+ 368:	68 64 0f 00 00       	push   $0xf64
+ 36d:	6a 01                	push   $0x1
+ 36f:	e8 7c 06 00 00       	call   9f0 <printf>
+  wunmap((uint)sh);
+ 374:	83 c4 14             	add    $0x14,%esp
+ 377:	57                   	push   %edi
+ 378:	e8 1f 05 00 00       	call   89c <wunmap>
+ 37d:	83 c4 10             	add    $0x10,%esp
+}
+ 380:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 383:	5b                   	pop    %ebx
+ 384:	5e                   	pop    %esi
+ 385:	5f                   	pop    %edi
+ 386:	5d                   	pop    %ebp
+ 387:	c3                   	ret
+    printf(2, "futexbench: wmap failed\n");
+ 388:	83 ec 08             	sub    $0x8,%esp
+ 38b:	68 e5 0e 00 00       	push   $0xee5
+ 390:	6a 02                	push   $0x2
+ 392:	e8 59 06 00 00       	call   9f0 <printf>
+    return;
+ 397:	83 c4 10             	add    $0x10,%esp
+}
+ 39a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 39d:	5b                   	pop    %ebx
+ 39e:	5e                   	pop    %esi
+ 39f:	5f                   	pop    %edi
+ 3a0:	5d                   	pop    %ebp
+ 3a1:	c3                   	ret
+    for(i = 0; i < iters; i++){
+ 3a2:	83 3d ac 15 00 00 00 	cmpl   $0x0,0x15ac
+ 3a9:	7e 36                	jle    3e1 <crossproc+0x141>
+      mutex_lock(&sh->mu);
+ 3ab:	83 ec 0c             	sub    $0xc,%esp
+ 3ae:	57                   	push   %edi
+ 3af:	e8 dc 02 00 00       	call   690 <mutex_lock>
+ 3b4:	83 c4 10             	add    $0x10,%esp
+ 3b7:	b8 32 00 00 00       	mov    $0x32,%eax
+    (*c)++;
+ 3bc:	8b 57 04             	mov    0x4(%edi),%edx
+ 3bf:	83 c2 01             	add    $0x1,%edx
+ 3c2:	89 57 04             	mov    %edx,0x4(%edi)
+  for(i = 0; i < HOLD; i++)
+ 3c5:	83 e8 01             	sub    $0x1,%eax
+ 3c8:	75 f2                	jne    3bc <crossproc+0x11c>
+      mutex_unlock(&sh->mu);
+ 3ca:	83 ec 0c             	sub    $0xc,%esp
+    for(i = 0; i < iters; i++){
+ 3cd:	83 c3 01             	add    $0x1,%ebx
+      mutex_unlock(&sh->mu);
+ 3d0:	57                   	push   %edi
+ 3d1:	e8 0a 03 00 00       	call   6e0 <mutex_unlock>
+    for(i = 0; i < iters; i++){
+ 3d6:	83 c4 10             	add    $0x10,%esp
+ 3d9:	39 1d ac 15 00 00    	cmp    %ebx,0x15ac
+ 3df:	7f ca                	jg     3ab <crossproc+0x10b>
+    exit();
+ 3e1:	e8 fe 03 00 00       	call   7e4 <exit>
+ 3e6:	66 90                	xchg   %ax,%ax
+ 3e8:	66 90                	xchg   %ax,%ax
+ 3ea:	66 90                	xchg   %ax,%ax
+ 3ec:	66 90                	xchg   %ax,%ax
+ 3ee:	66 90                	xchg   %ax,%ax
+
+000003f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3f1:	31 c0                	xor    %eax,%eax
+{
+ 3f3:	89 e5                	mov    %esp,%ebp
+ 3f5:	53                   	push   %ebx
+ 3f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 400:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 404:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 407:	83 c0 01             	add    $0x1,%eax
+ 40a:	84 d2                	test   %dl,%dl
+ 40c:	75 f2                	jne    400 <strcpy+0x10>
+    ;
+  return os;
+}
+ 40e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 411:	89 c8                	mov    %ecx,%eax
+ 413:	c9                   	leave
+ 414:	c3                   	ret
+ 415:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+ 427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 42a:	0f b6 02             	movzbl (%edx),%eax
+ 42d:	84 c0                	test   %al,%al
+ 42f:	75 17                	jne    448 <strcmp+0x28>
+ 431:	eb 3a                	jmp    46d <strcmp+0x4d>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 43c:	83 c2 01             	add    $0x1,%edx
+ 43f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 442:	84 c0                	test   %al,%al
+ 444:	74 1a                	je     460 <strcmp+0x40>
+    p++, q++;
+ 446:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 448:	0f b6 19             	movzbl (%ecx),%ebx
+ 44b:	38 c3                	cmp    %al,%bl
+ 44d:	74 e9                	je     438 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 44f:	29 d8                	sub    %ebx,%eax
+}
+ 451:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 454:	c9                   	leave
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 460:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 464:	31 c0                	xor    %eax,%eax
+ 466:	29 d8                	sub    %ebx,%eax
+}
+ 468:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 46b:	c9                   	leave
+ 46c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 46d:	0f b6 19             	movzbl (%ecx),%ebx
+ 470:	31 c0                	xor    %eax,%eax
+ 472:	eb db                	jmp    44f <strcmp+0x2f>
+ 474:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 47f:	90                   	nop
+
+00000480 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 486:	80 3a 00             	cmpb   $0x0,(%edx)
+ 489:	74 15                	je     4a0 <strlen+0x20>
+ 48b:	31 c0                	xor    %eax,%eax
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+ 490:	83 c0 01             	add    $0x1,%eax
+ 493:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 497:	89 c1                	mov    %eax,%ecx
+ 499:	75 f5                	jne    490 <strlen+0x10>
+    ;
+  return n;
+}
+ 49b:	89 c8                	mov    %ecx,%eax
+ 49d:	5d                   	pop    %ebp
+ 49e:	c3                   	ret
+ 49f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 4a0:	31 c9                	xor    %ecx,%ecx
+}
+ 4a2:	5d                   	pop    %ebp
+ 4a3:	89 c8                	mov    %ecx,%eax
+ 4a5:	c3                   	ret
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000004b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+ 4b3:	57                   	push   %edi
+ 4b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 4b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 4ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4bd:	89 d7                	mov    %edx,%edi
+ 4bf:	fc                   	cld
+ 4c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 4c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 4c5:	89 d0                	mov    %edx,%eax
+ 4c7:	c9                   	leave
+ 4c8:	c3                   	ret
+ 4c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 4d0:	55                   	push   %ebp
+ 4d1:	89 e5                	mov    %esp,%ebp
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 4da:	0f b6 10             	movzbl (%eax),%edx
+ 4dd:	84 d2                	test   %dl,%dl
+ 4df:	75 12                	jne    4f3 <strchr+0x23>
+ 4e1:	eb 1d                	jmp    500 <strchr+0x30>
+ 4e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4e7:	90                   	nop
+ 4e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 4ec:	83 c0 01             	add    $0x1,%eax
+ 4ef:	84 d2                	test   %dl,%dl
+ 4f1:	74 0d                	je     500 <strchr+0x30>
+    if(*s == c)
+ 4f3:	38 d1                	cmp    %dl,%cl
+ 4f5:	75 f1                	jne    4e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4f7:	5d                   	pop    %ebp
+ 4f8:	c3                   	ret
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 500:	31 c0                	xor    %eax,%eax
+}
+ 502:	5d                   	pop    %ebp
+ 503:	c3                   	ret
+ 504:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	57                   	push   %edi
+ 514:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 515:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 518:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 519:	31 db                	xor    %ebx,%ebx
+{
+ 51b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 51e:	eb 27                	jmp    547 <gets+0x37>
+    cc = read(0, &c, 1);
+ 520:	83 ec 04             	sub    $0x4,%esp
+ 523:	6a 01                	push   $0x1
+ 525:	56                   	push   %esi
+ 526:	6a 00                	push   $0x0
+ 528:	e8 cf 02 00 00       	call   7fc <read>
+    if(cc < 1)
+ 52d:	83 c4 10             	add    $0x10,%esp
+ 530:	85 c0                	test   %eax,%eax
+ 532:	7e 1d                	jle    551 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 534:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 538:	8b 55 08             	mov    0x8(%ebp),%edx
+ 53b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 53f:	3c 0a                	cmp    $0xa,%al
+ 541:	74 10                	je     553 <gets+0x43>
+ 543:	3c 0d                	cmp    $0xd,%al
+ 545:	74 0c                	je     553 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 547:	89 df                	mov    %ebx,%edi
+ 549:	83 c3 01             	add    $0x1,%ebx
+ 54c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 54f:	7c cf                	jl     520 <gets+0x10>
+ 551:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 55a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 55d:	5b                   	pop    %ebx
+ 55e:	5e                   	pop    %esi
+ 55f:	5f                   	pop    %edi
+ 560:	5d                   	pop    %ebp
+ 561:	c3                   	ret
+ 562:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 569:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000570 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	56                   	push   %esi
+ 574:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 575:	83 ec 08             	sub    $0x8,%esp
+ 578:	6a 00                	push   $0x0
+ 57a:	ff 75 08             	push   0x8(%ebp)
+ 57d:	e8 a2 02 00 00       	call   824 <open>
+  if(fd < 0)
+ 582:	83 c4 10             	add    $0x10,%esp
+ 585:	85 c0                	test   %eax,%eax
+ 587:	78 27                	js     5b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 589:	83 ec 08             	sub    $0x8,%esp
+ 58c:	ff 75 0c             	push   0xc(%ebp)
+ 58f:	89 c3                	mov    %eax,%ebx
+ 591:	50                   	push   %eax
+ 592:	e8 a5 02 00 00       	call   83c <fstat>
+  close(fd);
+ 597:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 59a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 59c:	e8 6b 02 00 00       	call   80c <close>
+  return r;
+ 5a1:	83 c4 10             	add    $0x10,%esp
+}
+ 5a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5a7:	89 f0                	mov    %esi,%eax
+ 5a9:	5b                   	pop    %ebx
+ 5aa:	5e                   	pop    %esi
+ 5ab:	5d                   	pop    %ebp
+ 5ac:	c3                   	ret
+ 5ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 5b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 5b5:	eb ed                	jmp    5a4 <stat+0x34>
+ 5b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	53                   	push   %ebx
+ 5c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 5c7:	0f be 02             	movsbl (%edx),%eax
+ 5ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 5cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 5d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 5d5:	77 1e                	ja     5f5 <atoi+0x35>
+ 5d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 5e0:	83 c2 01             	add    $0x1,%edx
+ 5e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 5e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 5ea:	0f be 02             	movsbl (%edx),%eax
+ 5ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5f0:	80 fb 09             	cmp    $0x9,%bl
+ 5f3:	76 eb                	jbe    5e0 <atoi+0x20>
+  return n;
+}
+ 5f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5f8:	89 c8                	mov    %ecx,%eax
+ 5fa:	c9                   	leave
+ 5fb:	c3                   	ret
+ 5fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000600 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	57                   	push   %edi
+ 604:	56                   	push   %esi
+ 605:	8b 45 10             	mov    0x10(%ebp),%eax
+ 608:	8b 55 08             	mov    0x8(%ebp),%edx
+ 60b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 60e:	85 c0                	test   %eax,%eax
+ 610:	7e 13                	jle    625 <memmove+0x25>
+ 612:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 614:	89 d7                	mov    %edx,%edi
+ 616:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 61d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 620:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 621:	39 f8                	cmp    %edi,%eax
+ 623:	75 fb                	jne    620 <memmove+0x20>
+  return vdst;
+}
+ 625:	5e                   	pop    %esi
+ 626:	89 d0                	mov    %edx,%eax
+ 628:	5f                   	pop    %edi
+ 629:	5d                   	pop    %ebp
+ 62a:	c3                   	ret
+ 62b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+
+00000630 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 633:	8b 45 08             	mov    0x8(%ebp),%eax
+ 636:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 63c:	5d                   	pop    %ebp
+ 63d:	c3                   	ret
+ 63e:	66 90                	xchg   %ax,%ax
+
+00000640 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 640:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 641:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 646:	89 e5                	mov    %esp,%ebp
+ 648:	8b 55 08             	mov    0x8(%ebp),%edx
+ 64b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 64f:	90                   	nop
+ 650:	89 c8                	mov    %ecx,%eax
+ 652:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 655:	85 c0                	test   %eax,%eax
+ 657:	75 f7                	jne    650 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 659:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 65e:	5d                   	pop    %ebp
+ 65f:	c3                   	ret
+
+00000660 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 660:	55                   	push   %ebp
+ 661:	31 c0                	xor    %eax,%eax
+ 663:	89 e5                	mov    %esp,%ebp
+ 665:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 668:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 66d:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 670:	5d                   	pop    %ebp
+ 671:	c3                   	ret
+ 672:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 679:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 683:	8b 45 08             	mov    0x8(%ebp),%eax
+ 686:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 68c:	5d                   	pop    %ebp
+ 68d:	c3                   	ret
+ 68e:	66 90                	xchg   %ax,%ax
+
+00000690 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 690:	55                   	push   %ebp
+ 691:	b8 01 00 00 00       	mov    $0x1,%eax
+ 696:	89 e5                	mov    %esp,%ebp
+ 698:	56                   	push   %esi
+ 699:	53                   	push   %ebx
+ 69a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 69d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 6a0:	85 c0                	test   %eax,%eax
+ 6a2:	74 2d                	je     6d1 <mutex_lock+0x41>
+ 6a4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6a9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 6ac:	85 c0                	test   %eax,%eax
+ 6ae:	74 21                	je     6d1 <mutex_lock+0x41>
+ 6b0:	be 02 00 00 00       	mov    $0x2,%esi
+ 6b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 6b8:	83 ec 04             	sub    $0x4,%esp
+ 6bb:	6a 02                	push   $0x2
+ 6bd:	6a 00                	push   $0x0
+ 6bf:	53                   	push   %ebx
+ 6c0:	e8 37 02 00 00       	call   8fc <futex>
+ 6c5:	89 f0                	mov    %esi,%eax
+ 6c7:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 6ca:	83 c4 10             	add    $0x10,%esp
+ 6cd:	85 c0                	test   %eax,%eax
+ 6cf:	75 e7                	jne    6b8 <mutex_lock+0x28>
+}
+ 6d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 6d4:	5b                   	pop    %ebx
+ 6d5:	5e                   	pop    %esi
+ 6d6:	5d                   	pop    %ebp
+ 6d7:	c3                   	ret
+ 6d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+
+000006e0 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	31 c0                	xor    %eax,%eax
+ 6e3:	89 e5                	mov    %esp,%ebp
+ 6e5:	83 ec 08             	sub    $0x8,%esp
+ 6e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 6eb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 6ee:	83 f8 02             	cmp    $0x2,%eax
+ 6f1:	74 05                	je     6f8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 6f3:	c9                   	leave
+ 6f4:	c3                   	ret
+ 6f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 6f8:	83 ec 04             	sub    $0x4,%esp
+ 6fb:	6a 01                	push   $0x1
+ 6fd:	6a 01                	push   $0x1
+ 6ff:	52                   	push   %edx
+ 700:	e8 f7 01 00 00       	call   8fc <futex>
+ 705:	83 c4 10             	add    $0x10,%esp
+}
+ 708:	c9                   	leave
+ 709:	c3                   	ret
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000710 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 713:	8b 45 08             	mov    0x8(%ebp),%eax
+ 716:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 71c:	5d                   	pop    %ebp
+ 71d:	c3                   	ret
+ 71e:	66 90                	xchg   %ax,%ax
+
+00000720 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 720:	55                   	push   %ebp
+ 721:	31 c0                	xor    %eax,%eax
+ 723:	89 e5                	mov    %esp,%ebp
+ 725:	57                   	push   %edi
+ 726:	56                   	push   %esi
+ 727:	53                   	push   %ebx
+ 728:	83 ec 0c             	sub    $0xc,%esp
+ 72b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 72e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 731:	8b 3e                	mov    (%esi),%edi
+ 733:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 736:	83 f8 02             	cmp    $0x2,%eax
+ 739:	74 4d                	je     788 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 73b:	83 ec 04             	sub    $0x4,%esp
+ 73e:	57                   	push   %edi
+ 73f:	6a 00                	push   $0x0
+ 741:	56                   	push   %esi
+ 742:	e8 b5 01 00 00       	call   8fc <futex>
+ 747:	b8 02 00 00 00       	mov    $0x2,%eax
+ 74c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 74f:	83 c4 10             	add    $0x10,%esp
+ 752:	85 c0                	test   %eax,%eax
+ 754:	74 23                	je     779 <cond_wait+0x59>
+ 756:	be 02 00 00 00       	mov    $0x2,%esi
+ 75b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 75f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 760:	83 ec 04             	sub    $0x4,%esp
+ 763:	6a 02                	push   $0x2
+ 765:	6a 00                	push   $0x0
+ 767:	53                   	push   %ebx
+ 768:	e8 8f 01 00 00       	call   8fc <futex>
+ 76d:	89 f0                	mov    %esi,%eax
+ 76f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 772:	83 c4 10             	add    $0x10,%esp
+ 775:	85 c0                	test   %eax,%eax
+ 777:	75 e7                	jne    760 <cond_wait+0x40>
+}
+ 779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 77c:	5b                   	pop    %ebx
+ 77d:	5e                   	pop    %esi
+ 77e:	5f                   	pop    %edi
+ 77f:	5d                   	pop    %ebp
+ 780:	c3                   	ret
+ 781:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 788:	83 ec 04             	sub    $0x4,%esp
+ 78b:	6a 01                	push   $0x1
+ 78d:	6a 01                	push   $0x1
+ 78f:	53                   	push   %ebx
+ 790:	e8 67 01 00 00       	call   8fc <futex>
+ 795:	83 c4 10             	add    $0x10,%esp
+ 798:	eb a1                	jmp    73b <cond_wait+0x1b>
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000007a0 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 7a0:	55                   	push   %ebp
+ 7a1:	89 e5                	mov    %esp,%ebp
+ 7a3:	83 ec 0c             	sub    $0xc,%esp
+ 7a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 7a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 7ad:	6a 01                	push   $0x1
+ 7af:	6a 01                	push   $0x1
+ 7b1:	50                   	push   %eax
+ 7b2:	e8 45 01 00 00       	call   8fc <futex>
+}
+ 7b7:	83 c4 10             	add    $0x10,%esp
+ 7ba:	c9                   	leave
+ 7bb:	c3                   	ret
+ 7bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007c0 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 7c0:	55                   	push   %ebp
+ 7c1:	89 e5                	mov    %esp,%ebp
+ 7c3:	83 ec 0c             	sub    $0xc,%esp
+ 7c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 7c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 7cd:	6a ff                	push   $0xffffffff
+ 7cf:	6a 01                	push   $0x1
+ 7d1:	50                   	push   %eax
+ 7d2:	e8 25 01 00 00       	call   8fc <futex>
+}
+ 7d7:	83 c4 10             	add    $0x10,%esp
+ 7da:	c9                   	leave
+ 7db:	c3                   	ret
+
+000007dc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 7dc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7e1:	cd 40                	int    $0x40
+ 7e3:	c3                   	ret
+
+000007e4 <exit>:
+SYSCALL(exit)
+ 7e4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7e9:	cd 40                	int    $0x40
+ 7eb:	c3                   	ret
+
+000007ec <wait>:
+SYSCALL(wait)
+ 7ec:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7f1:	cd 40                	int    $0x40
+ 7f3:	c3                   	ret
+
+000007f4 <pipe>:
+SYSCALL(pipe)
+ 7f4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7f9:	cd 40                	int    $0x40
+ 7fb:	c3                   	ret
+
+000007fc <read>:
+SYSCALL(read)
+ 7fc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 801:	cd 40                	int    $0x40
+ 803:	c3                   	ret
+
+00000804 <write>:
+SYSCALL(write)
+ 804:	b8 10 00 00 00       	mov    $0x10,%eax
+ 809:	cd 40                	int    $0x40
+ 80b:	c3                   	ret
+
+0000080c <close>:
+SYSCALL(close)
+ 80c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 811:	cd 40                	int    $0x40
+ 813:	c3                   	ret
+
+00000814 <kill>:
+SYSCALL(kill)
+ 814:	b8 06 00 00 00       	mov    $0x6,%eax
+ 819:	cd 40                	int    $0x40
+ 81b:	c3                   	ret
+
+0000081c <exec>:
+SYSCALL(exec)
+ 81c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 821:	cd 40                	int    $0x40
+ 823:	c3                   	ret
+
+00000824 <open>:
+SYSCALL(open)
+ 824:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 829:	cd 40                	int    $0x40
+ 82b:	c3                   	ret
+
+0000082c <mknod>:
+SYSCALL(mknod)
+ 82c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 831:	cd 40                	int    $0x40
+ 833:	c3                   	ret
+
+00000834 <unlink>:
+SYSCALL(unlink)
+ 834:	b8 12 00 00 00       	mov    $0x12,%eax
+ 839:	cd 40                	int    $0x40
+ 83b:	c3                   	ret
+
+0000083c <fstat>:
+SYSCALL(fstat)
+ 83c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 841:	cd 40                	int    $0x40
+ 843:	c3                   	ret
+
+00000844 <link>:
+SYSCALL(link)
+ 844:	b8 13 00 00 00       	mov    $0x13,%eax
+ 849:	cd 40                	int    $0x40
+ 84b:	c3                   	ret
+
+0000084c <mkdir>:
+SYSCALL(mkdir)
+ 84c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 851:	cd 40                	int    $0x40
+ 853:	c3                   	ret
+
+00000854 <chdir>:
+SYSCALL(chdir)
+ 854:	b8 09 00 00 00       	mov    $0x9,%eax
+ 859:	cd 40                	int    $0x40
+ 85b:	c3                   	ret
+
+0000085c <dup>:
+SYSCALL(dup)
+ 85c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 861:	cd 40                	int    $0x40
+ 863:	c3                   	ret
+
+00000864 <getpid>:
+SYSCALL(getpid)
+ 864:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 869:	cd 40                	int    $0x40
+ 86b:	c3                   	ret
+
+0000086c <sbrk>:
+SYSCALL(sbrk)
+ 86c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 871:	cd 40                	int    $0x40
+ 873:	c3                   	ret
+
+00000874 <sleep>:
+SYSCALL(sleep)
+ 874:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 879:	cd 40                	int    $0x40
+ 87b:	c3                   	ret
+
+0000087c <uptime>:
+SYSCALL(uptime)
+ 87c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 881:	cd 40                	int    $0x40
+ 883:	c3                   	ret
+
+00000884 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 884:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 889:	cd 40                	int    $0x40
+ 88b:	c3                   	ret
+
+0000088c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 88c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 891:	cd 40                	int    $0x40
+ 893:	c3                   	ret
+
+00000894 <wmap>:
+SYSCALL(wmap)
+ 894:	b8 16 00 00 00       	mov    $0x16,%eax
+ 899:	cd 40                	int    $0x40
+ 89b:	c3                   	ret
+
+0000089c <wunmap>:
+SYSCALL(wunmap)
+ 89c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8a1:	cd 40                	int    $0x40
+ 8a3:	c3                   	ret
+
+000008a4 <wremap>:
+SYSCALL(wremap)
+ 8a4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8a9:	cd 40                	int    $0x40
+ 8ab:	c3                   	ret
+
+000008ac <wmlock>:
+SYSCALL(wmlock)
+ 8ac:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8b1:	cd 40                	int    $0x40
+ 8b3:	c3                   	ret
+
+000008b4 <wmunlock>:
+SYSCALL(wmunlock)
+ 8b4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8b9:	cd 40                	int    $0x40
+ 8bb:	c3                   	ret
+
+000008bc <wmapoff>:
+SYSCALL(wmapoff)
+ 8bc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8c1:	cd 40                	int    $0x40
+ 8c3:	c3                   	ret
+
+000008c4 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 8c4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8c9:	cd 40                	int    $0x40
+ 8cb:	c3                   	ret
+
+000008cc <setpriority>:
+SYSCALL(setpriority)
+ 8cc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8d1:	cd 40                	int    $0x40
+ 8d3:	c3                   	ret
+
+000008d4 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 8d4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 8d9:	cd 40                	int    $0x40
+ 8db:	c3                   	ret
+
+000008dc <settickets>:
+SYSCALL(settickets)
+ 8dc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 8e1:	cd 40                	int    $0x40
+ 8e3:	c3                   	ret
+
+000008e4 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 8e4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 8e9:	cd 40                	int    $0x40
+ 8eb:	c3                   	ret
+
+000008ec <clone>:
+SYSCALL(clone)
+ 8ec:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8f1:	cd 40                	int    $0x40
+ 8f3:	c3                   	ret
+
+000008f4 <join>:
+SYSCALL(join)
+ 8f4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8f9:	cd 40                	int    $0x40
+ 8fb:	c3                   	ret
+
+000008fc <futex>:
+SYSCALL(futex)
+ 8fc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 901:	cd 40                	int    $0x40
+ 903:	c3                   	ret
+
+00000904 <setaffinity>:
+SYSCALL(setaffinity)
+ 904:	b8 26 00 00 00       	mov    $0x26,%eax
+ 909:	cd 40                	int    $0x40
+ 90b:	c3                   	ret
+
+0000090c <getaffinity>:
+SYSCALL(getaffinity)
+ 90c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 911:	cd 40                	int    $0x40
+ 913:	c3                   	ret
+
+00000914 <bcstat>:
+SYSCALL(bcstat)
+ 914:	b8 29 00 00 00       	mov    $0x29,%eax
+ 919:	cd 40                	int    $0x40
+ 91b:	c3                   	ret
+
+0000091c <dropcache>:
+SYSCALL(dropcache)
+ 91c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 921:	cd 40                	int    $0x40
+ 923:	c3                   	ret
+
+00000924 <setiosched>:
+SYSCALL(setiosched)
+ 924:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 929:	cd 40                	int    $0x40
+ 92b:	c3                   	ret
+
+0000092c <iostat>:
+SYSCALL(iostat)
+ 92c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 931:	cd 40                	int    $0x40
+ 933:	c3                   	ret
+
+00000934 <fsync>:
+SYSCALL(fsync)
+ 934:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 939:	cd 40                	int    $0x40
+ 93b:	c3                   	ret
+
+0000093c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 93c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 93d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 942:	cd 40                	int    $0x40
+ 944:	ff e1                	jmp    *%ecx
+ 946:	66 90                	xchg   %ax,%ax
+ 948:	66 90                	xchg   %ax,%ax
+ 94a:	66 90                	xchg   %ax,%ax
+ 94c:	66 90                	xchg   %ax,%ax
+ 94e:	66 90                	xchg   %ax,%ax
+
+00000950 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 950:	55                   	push   %ebp
+ 951:	89 e5                	mov    %esp,%ebp
+ 953:	57                   	push   %edi
+ 954:	56                   	push   %esi
+ 955:	53                   	push   %ebx
+ 956:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 958:	89 d1                	mov    %edx,%ecx
+{
+ 95a:	83 ec 3c             	sub    $0x3c,%esp
+ 95d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 960:	85 d2                	test   %edx,%edx
+ 962:	0f 89 80 00 00 00    	jns    9e8 <printint+0x98>
+ 968:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 96c:	74 7a                	je     9e8 <printint+0x98>
+    x = -xx;
+ 96e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 970:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 975:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 978:	31 f6                	xor    %esi,%esi
+ 97a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 980:	89 c8                	mov    %ecx,%eax
+ 982:	31 d2                	xor    %edx,%edx
+ 984:	89 f7                	mov    %esi,%edi
+ 986:	f7 f3                	div    %ebx
+ 988:	8d 76 01             	lea    0x1(%esi),%esi
+ 98b:	0f b6 92 20 10 00 00 	movzbl 0x1020(%edx),%edx
+ 992:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 996:	89 ca                	mov    %ecx,%edx
+ 998:	89 c1                	mov    %eax,%ecx
+ 99a:	39 da                	cmp    %ebx,%edx
+ 99c:	73 e2                	jae    980 <printint+0x30>
+  if(neg)
+ 99e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 9a1:	85 c0                	test   %eax,%eax
+ 9a3:	74 07                	je     9ac <printint+0x5c>
+    buf[i++] = '-';
+ 9a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 9aa:	89 f7                	mov    %esi,%edi
+ 9ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 9af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 9b2:	01 df                	add    %ebx,%edi
+ 9b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 9b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 9bb:	83 ec 04             	sub    $0x4,%esp
+ 9be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 9c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 9c4:	6a 01                	push   $0x1
+ 9c6:	50                   	push   %eax
+ 9c7:	56                   	push   %esi
+ 9c8:	e8 37 fe ff ff       	call   804 <write>
+  while(--i >= 0)
+ 9cd:	89 f8                	mov    %edi,%eax
+ 9cf:	83 c4 10             	add    $0x10,%esp
+ 9d2:	83 ef 01             	sub    $0x1,%edi
+ 9d5:	39 d8                	cmp    %ebx,%eax
+ 9d7:	75 df                	jne    9b8 <printint+0x68>
+}
+ 9d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9dc:	5b                   	pop    %ebx
+ 9dd:	5e                   	pop    %esi
+ 9de:	5f                   	pop    %edi
+ 9df:	5d                   	pop    %ebp
+ 9e0:	c3                   	ret
+ 9e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 9e8:	31 c0                	xor    %eax,%eax
+ 9ea:	eb 89                	jmp    975 <printint+0x25>
+ 9ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9f0:	55                   	push   %ebp
+ 9f1:	89 e5                	mov    %esp,%ebp
+ 9f3:	57                   	push   %edi
+ 9f4:	56                   	push   %esi
+ 9f5:	53                   	push   %ebx
+ 9f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 9fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 9ff:	0f b6 1e             	movzbl (%esi),%ebx
+ a02:	83 c6 01             	add    $0x1,%esi
+ a05:	84 db                	test   %bl,%bl
+ a07:	74 67                	je     a70 <printf+0x80>
+ a09:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ a0c:	31 d2                	xor    %edx,%edx
+ a0e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ a11:	eb 34                	jmp    a47 <printf+0x57>
+ a13:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a17:	90                   	nop
+ a18:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ a1b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ a20:	83 f8 25             	cmp    $0x25,%eax
+ a23:	74 18                	je     a3d <printf+0x4d>
+  write(fd, &c, 1);
+ a25:	83 ec 04             	sub    $0x4,%esp
+ a28:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ a2b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a2e:	6a 01                	push   $0x1
+ a30:	50                   	push   %eax
+ a31:	57                   	push   %edi
+ a32:	e8 cd fd ff ff       	call   804 <write>
+ a37:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ a3a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ a3d:	0f b6 1e             	movzbl (%esi),%ebx
+ a40:	83 c6 01             	add    $0x1,%esi
+ a43:	84 db                	test   %bl,%bl
+ a45:	74 29                	je     a70 <printf+0x80>
+    c = fmt[i] & 0xff;
+ a47:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ a4a:	85 d2                	test   %edx,%edx
+ a4c:	74 ca                	je     a18 <printf+0x28>
+      }
+    } else if(state == '%'){
+ a4e:	83 fa 25             	cmp    $0x25,%edx
+ a51:	75 ea                	jne    a3d <printf+0x4d>
+      if(c == 'd'){
+ a53:	83 f8 25             	cmp    $0x25,%eax
+ a56:	0f 84 24 01 00 00    	je     b80 <printf+0x190>
+ a5c:	83 e8 63             	sub    $0x63,%eax
+ a5f:	83 f8 15             	cmp    $0x15,%eax
+ a62:	77 1c                	ja     a80 <printf+0x90>
+ a64:	ff 24 85 c8 0f 00 00 	jmp    *0xfc8(,%eax,4)
+ a6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a6f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a73:	5b                   	pop    %ebx
+ a74:	5e                   	pop    %esi
+ a75:	5f                   	pop    %edi
+ a76:	5d                   	pop    %ebp
+ a77:	c3                   	ret
+ a78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7f:	90                   	nop
+  write(fd, &c, 1);
+ a80:	83 ec 04             	sub    $0x4,%esp
+ a83:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a86:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a8a:	6a 01                	push   $0x1
+ a8c:	52                   	push   %edx
+ a8d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a90:	57                   	push   %edi
+ a91:	e8 6e fd ff ff       	call   804 <write>
+ a96:	83 c4 0c             	add    $0xc,%esp
+ a99:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a9c:	6a 01                	push   $0x1
+ a9e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ aa1:	52                   	push   %edx
+ aa2:	57                   	push   %edi
+ aa3:	e8 5c fd ff ff       	call   804 <write>
+        putc(fd, c);
+ aa8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ aab:	31 d2                	xor    %edx,%edx
+ aad:	eb 8e                	jmp    a3d <printf+0x4d>
+ aaf:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ ab0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ ab3:	83 ec 0c             	sub    $0xc,%esp
+ ab6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ abb:	8b 13                	mov    (%ebx),%edx
+ abd:	6a 00                	push   $0x0
+ abf:	89 f8                	mov    %edi,%eax
+        ap++;
+ ac1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ ac4:	e8 87 fe ff ff       	call   950 <printint>
+        ap++;
+ ac9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ acc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ acf:	31 d2                	xor    %edx,%edx
+ ad1:	e9 67 ff ff ff       	jmp    a3d <printf+0x4d>
+ ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ add:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ ae0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ ae3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ ae5:	83 c0 04             	add    $0x4,%eax
+ ae8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ aeb:	85 db                	test   %ebx,%ebx
+ aed:	0f 84 9d 00 00 00    	je     b90 <printf+0x1a0>
+        while(*s != 0){
+ af3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ af6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ af8:	84 c0                	test   %al,%al
+ afa:	0f 84 3d ff ff ff    	je     a3d <printf+0x4d>
+ b00:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b03:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ b06:	89 de                	mov    %ebx,%esi
+ b08:	89 d3                	mov    %edx,%ebx
+ b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ b10:	83 ec 04             	sub    $0x4,%esp
+ b13:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ b16:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ b19:	6a 01                	push   $0x1
+ b1b:	53                   	push   %ebx
+ b1c:	57                   	push   %edi
+ b1d:	e8 e2 fc ff ff       	call   804 <write>
+        while(*s != 0){
+ b22:	0f b6 06             	movzbl (%esi),%eax
+ b25:	83 c4 10             	add    $0x10,%esp
+ b28:	84 c0                	test   %al,%al
+ b2a:	75 e4                	jne    b10 <printf+0x120>
+      state = 0;
+ b2c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ b2f:	31 d2                	xor    %edx,%edx
+ b31:	e9 07 ff ff ff       	jmp    a3d <printf+0x4d>
+ b36:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b3d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ b40:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ b43:	83 ec 0c             	sub    $0xc,%esp
+ b46:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ b4b:	8b 13                	mov    (%ebx),%edx
+ b4d:	6a 01                	push   $0x1
+ b4f:	e9 6b ff ff ff       	jmp    abf <printf+0xcf>
+ b54:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b58:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b5b:	83 ec 04             	sub    $0x4,%esp
+ b5e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b61:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b63:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b66:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b69:	6a 01                	push   $0x1
+ b6b:	52                   	push   %edx
+ b6c:	57                   	push   %edi
+ b6d:	e8 92 fc ff ff       	call   804 <write>
+        ap++;
+ b72:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b75:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b78:	31 d2                	xor    %edx,%edx
+ b7a:	e9 be fe ff ff       	jmp    a3d <printf+0x4d>
+ b7f:	90                   	nop
+  write(fd, &c, 1);
+ b80:	83 ec 04             	sub    $0x4,%esp
+ b83:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b86:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b89:	6a 01                	push   $0x1
+ b8b:	e9 11 ff ff ff       	jmp    aa1 <printf+0xb1>
+ b90:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b95:	bb c1 0f 00 00       	mov    $0xfc1,%ebx
+ b9a:	e9 61 ff ff ff       	jmp    b00 <printf+0x110>
+ b9f:	90                   	nop
+
+00000ba0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ba0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ba1:	a1 b4 15 00 00       	mov    0x15b4,%eax
+{
+ ba6:	89 e5                	mov    %esp,%ebp
+ ba8:	57                   	push   %edi
+ ba9:	56                   	push   %esi
+ baa:	53                   	push   %ebx
+ bab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ bae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bb8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bbc:	39 ca                	cmp    %ecx,%edx
+ bbe:	73 30                	jae    bf0 <free+0x50>
+ bc0:	39 c1                	cmp    %eax,%ecx
+ bc2:	72 04                	jb     bc8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bc4:	39 c2                	cmp    %eax,%edx
+ bc6:	72 f0                	jb     bb8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bc8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ bcb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ bce:	39 f8                	cmp    %edi,%eax
+ bd0:	74 2e                	je     c00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bd2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ bd5:	8b 42 04             	mov    0x4(%edx),%eax
+ bd8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ bdb:	39 f1                	cmp    %esi,%ecx
+ bdd:	74 38                	je     c17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ bdf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ be1:	5b                   	pop    %ebx
+  freep = p;
+ be2:	89 15 b4 15 00 00    	mov    %edx,0x15b4
+}
+ be8:	5e                   	pop    %esi
+ be9:	5f                   	pop    %edi
+ bea:	5d                   	pop    %ebp
+ beb:	c3                   	ret
+ bec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bf0:	39 c1                	cmp    %eax,%ecx
+ bf2:	72 d0                	jb     bc4 <free+0x24>
+ bf4:	eb c2                	jmp    bb8 <free+0x18>
+ bf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bfd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ c00:	03 70 04             	add    0x4(%eax),%esi
+ c03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c06:	8b 02                	mov    (%edx),%eax
+ c08:	8b 00                	mov    (%eax),%eax
+ c0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ c0d:	8b 42 04             	mov    0x4(%edx),%eax
+ c10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ c13:	39 f1                	cmp    %esi,%ecx
+ c15:	75 c8                	jne    bdf <free+0x3f>
+    p->s.size += bp->s.size;
+ c17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ c1a:	89 15 b4 15 00 00    	mov    %edx,0x15b4
+    p->s.size += bp->s.size;
+ c20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ c23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ c26:	89 0a                	mov    %ecx,(%edx)
+}
+ c28:	5b                   	pop    %ebx
+ c29:	5e                   	pop    %esi
+ c2a:	5f                   	pop    %edi
+ c2b:	5d                   	pop    %ebp
+ c2c:	c3                   	ret
+ c2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000c30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ c30:	55                   	push   %ebp
+ c31:	89 e5                	mov    %esp,%ebp
+ c33:	57                   	push   %edi
+ c34:	56                   	push   %esi
+ c35:	53                   	push   %ebx
+ c36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ c3c:	8b 15 b4 15 00 00    	mov    0x15b4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c42:	8d 78 07             	lea    0x7(%eax),%edi
+ c45:	c1 ef 03             	shr    $0x3,%edi
+ c48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ c4b:	85 d2                	test   %edx,%edx
+ c4d:	0f 84 8d 00 00 00    	je     ce0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c55:	8b 48 04             	mov    0x4(%eax),%ecx
+ c58:	39 f9                	cmp    %edi,%ecx
+ c5a:	73 64                	jae    cc0 <malloc+0x90>
+  if(nu < 4096)
+ c5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c61:	39 df                	cmp    %ebx,%edi
+ c63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c6d:	eb 0a                	jmp    c79 <malloc+0x49>
+ c6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c72:	8b 48 04             	mov    0x4(%eax),%ecx
+ c75:	39 f9                	cmp    %edi,%ecx
+ c77:	73 47                	jae    cc0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c79:	89 c2                	mov    %eax,%edx
+ c7b:	39 05 b4 15 00 00    	cmp    %eax,0x15b4
+ c81:	75 ed                	jne    c70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c83:	83 ec 0c             	sub    $0xc,%esp
+ c86:	56                   	push   %esi
+ c87:	e8 e0 fb ff ff       	call   86c <sbrk>
+  if(p == (char*)-1)
+ c8c:	83 c4 10             	add    $0x10,%esp
+ c8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c92:	74 1c                	je     cb0 <malloc+0x80>
+  hp->s.size = nu;
+ c94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c97:	83 ec 0c             	sub    $0xc,%esp
+ c9a:	83 c0 08             	add    $0x8,%eax
+ c9d:	50                   	push   %eax
+ c9e:	e8 fd fe ff ff       	call   ba0 <free>
+  return freep;
+ ca3:	8b 15 b4 15 00 00    	mov    0x15b4,%edx
+      if((p = morecore(nunits)) == 0)
+ ca9:	83 c4 10             	add    $0x10,%esp
+ cac:	85 d2                	test   %edx,%edx
+ cae:	75 c0                	jne    c70 <malloc+0x40>
+        return 0;
+  }
+}
+ cb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ cb3:	31 c0                	xor    %eax,%eax
+}
+ cb5:	5b                   	pop    %ebx
+ cb6:	5e                   	pop    %esi
+ cb7:	5f                   	pop    %edi
+ cb8:	5d                   	pop    %ebp
+ cb9:	c3                   	ret
+ cba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ cc0:	39 cf                	cmp    %ecx,%edi
+ cc2:	74 4c                	je     d10 <malloc+0xe0>
+        p->s.size -= nunits;
+ cc4:	29 f9                	sub    %edi,%ecx
+ cc6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ cc9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ ccc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ ccf:	89 15 b4 15 00 00    	mov    %edx,0x15b4
+}
+ cd5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ cd8:	83 c0 08             	add    $0x8,%eax
+}
+ cdb:	5b                   	pop    %ebx
+ cdc:	5e                   	pop    %esi
+ cdd:	5f                   	pop    %edi
+ cde:	5d                   	pop    %ebp
+ cdf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ce0:	c7 05 b4 15 00 00 b8 	movl   $0x15b8,0x15b4
+ ce7:	15 00 00 
+    base.s.size = 0;
+ cea:	b8 b8 15 00 00       	mov    $0x15b8,%eax
+    base.s.ptr = freep = prevp = &base;
+ cef:	c7 05 b8 15 00 00 b8 	movl   $0x15b8,0x15b8
+ cf6:	15 00 00 
+    base.s.size = 0;
+ cf9:	c7 05 bc 15 00 00 00 	movl   $0x0,0x15bc
+ d00:	00 00 00 
+    if(p->s.size >= nunits){
+ d03:	e9 54 ff ff ff       	jmp    c5c <malloc+0x2c>
+ d08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ d10:	8b 08                	mov    (%eax),%ecx
+ d12:	89 0a                	mov    %ecx,(%edx)
+ d14:	eb b9                	jmp    ccf <malloc+0x9f>
+ d16:	66 90                	xchg   %ax,%ax
+ d18:	66 90                	xchg   %ax,%ax
+ d1a:	66 90                	xchg   %ax,%ax
+ d1c:	66 90                	xchg   %ax,%ax
+ d1e:	66 90                	xchg   %ax,%ax
+
+00000d20 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ d20:	55                   	push   %ebp
+ d21:	89 e5                	mov    %esp,%ebp
+ d23:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ d26:	8b 45 08             	mov    0x8(%ebp),%eax
+ d29:	c1 e0 04             	shl    $0x4,%eax
+ d2c:	ff b0 ec 15 00 00    	push   0x15ec(%eax)
+ d32:	05 e0 15 00 00       	add    $0x15e0,%eax
+ d37:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ d3a:	e8 a5 fa ff ff       	call   7e4 <exit>
+ d3f:	90                   	nop
+
+00000d40 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d40:	55                   	push   %ebp
+ d41:	89 e5                	mov    %esp,%ebp
+ d43:	57                   	push   %edi
+ d44:	56                   	push   %esi
+ d45:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ d46:	31 db                	xor    %ebx,%ebx
+{
+ d48:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ d4b:	68 c0 15 00 00       	push   $0x15c0
+ d50:	e8 eb f8 ff ff       	call   640 <lock_acquire>
+ d55:	83 c4 10             	add    $0x10,%esp
+ d58:	eb 12                	jmp    d6c <thread_create+0x2c>
+ d5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ d60:	83 c3 01             	add    $0x1,%ebx
+ d63:	83 fb 40             	cmp    $0x40,%ebx
+ d66:	0f 84 c4 00 00 00    	je     e30 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ d6c:	89 de                	mov    %ebx,%esi
+ d6e:	c1 e6 04             	shl    $0x4,%esi
+ d71:	8b 96 e0 15 00 00    	mov    0x15e0(%esi),%edx
+ d77:	85 d2                	test   %edx,%edx
+ d79:	75 e5                	jne    d60 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ d7b:	83 ec 0c             	sub    $0xc,%esp
+ d7e:	68 00 20 00 00       	push   $0x2000
+ d83:	e8 a8 fe ff ff       	call   c30 <malloc>
+ d88:	83 c4 10             	add    $0x10,%esp
+ d8b:	85 c0                	test   %eax,%eax
+ d8d:	0f 84 9d 00 00 00    	je     e30 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ d93:	89 86 e4 15 00 00    	mov    %eax,0x15e4(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ d99:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ d9e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ da1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ da6:	89 86 e0 15 00 00    	mov    %eax,0x15e0(%esi)
+  threads[i].fn = fn;
+ dac:	8b 45 08             	mov    0x8(%ebp),%eax
+ daf:	89 86 e8 15 00 00    	mov    %eax,0x15e8(%esi)
+  threads[i].arg = arg;
+ db5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ db8:	89 86 ec 15 00 00    	mov    %eax,0x15ec(%esi)
+  lock_release(&threadslock);
+ dbe:	68 c0 15 00 00       	push   $0x15c0
+ dc3:	e8 98 f8 ff ff       	call   660 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ dc8:	83 c4 0c             	add    $0xc,%esp
+ dcb:	ff b6 e0 15 00 00    	push   0x15e0(%esi)
+ dd1:	53                   	push   %ebx
+ dd2:	68 20 0d 00 00       	push   $0xd20
+ dd7:	e8 10 fb ff ff       	call   8ec <clone>
+ ddc:	83 c4 10             	add    $0x10,%esp
+ ddf:	85 c0                	test   %eax,%eax
+ de1:	78 0d                	js     df0 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ de3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ de6:	5b                   	pop    %ebx
+ de7:	5e                   	pop    %esi
+ de8:	5f                   	pop    %edi
+ de9:	5d                   	pop    %ebp
+ dea:	c3                   	ret
+ deb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ def:	90                   	nop
+    lock_acquire(&threadslock);
+ df0:	83 ec 0c             	sub    $0xc,%esp
+ df3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ df6:	68 c0 15 00 00       	push   $0x15c0
+ dfb:	e8 40 f8 ff ff       	call   640 <lock_acquire>
+    free(threads[i].block);
+ e00:	58                   	pop    %eax
+ e01:	ff b6 e4 15 00 00    	push   0x15e4(%esi)
+ e07:	e8 94 fd ff ff       	call   ba0 <free>
+    threads[i].stack = 0;
+ e0c:	c7 86 e0 15 00 00 00 	movl   $0x0,0x15e0(%esi)
+ e13:	00 00 00 
+    lock_release(&threadslock);
+ e16:	c7 04 24 c0 15 00 00 	movl   $0x15c0,(%esp)
+ e1d:	e8 3e f8 ff ff       	call   660 <lock_release>
+ e22:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ e25:	83 c4 10             	add    $0x10,%esp
+}
+ e28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ e2b:	5b                   	pop    %ebx
+ e2c:	5e                   	pop    %esi
+ e2d:	5f                   	pop    %edi
+ e2e:	5d                   	pop    %ebp
+ e2f:	c3                   	ret
+    lock_release(&threadslock);
+ e30:	83 ec 0c             	sub    $0xc,%esp
+ e33:	68 c0 15 00 00       	push   $0x15c0
+ e38:	e8 23 f8 ff ff       	call   660 <lock_release>
+    return -1;
+ e3d:	83 c4 10             	add    $0x10,%esp
+ e40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e45:	eb 9c                	jmp    de3 <thread_create+0xa3>
+ e47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e4e:	66 90                	xchg   %ax,%ax
+
+00000e50 <thread_join>:
+
+int
+thread_join(void)
+{
+ e50:	55                   	push   %ebp
+ e51:	89 e5                	mov    %esp,%ebp
+ e53:	56                   	push   %esi
+ e54:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ e55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ e58:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ e5b:	50                   	push   %eax
+ e5c:	e8 93 fa ff ff       	call   8f4 <join>
+ e61:	83 c4 10             	add    $0x10,%esp
+ e64:	85 c0                	test   %eax,%eax
+ e66:	78 69                	js     ed1 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ e68:	83 ec 0c             	sub    $0xc,%esp
+ e6b:	89 c6                	mov    %eax,%esi
+ e6d:	68 c0 15 00 00       	push   $0x15c0
+ e72:	e8 c9 f7 ff ff       	call   640 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ e77:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e7a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ e7d:	31 c0                	xor    %eax,%eax
+ e7f:	eb 0f                	jmp    e90 <thread_join+0x40>
+ e81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e88:	83 c0 01             	add    $0x1,%eax
+ e8b:	83 f8 40             	cmp    $0x40,%eax
+ e8e:	74 28                	je     eb8 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ e90:	89 c3                	mov    %eax,%ebx
+ e92:	c1 e3 04             	shl    $0x4,%ebx
+ e95:	39 93 e0 15 00 00    	cmp    %edx,0x15e0(%ebx)
+ e9b:	75 eb                	jne    e88 <thread_join+0x38>
+      free(threads[i].block);
+ e9d:	83 ec 0c             	sub    $0xc,%esp
+ ea0:	ff b3 e4 15 00 00    	push   0x15e4(%ebx)
+ ea6:	e8 f5 fc ff ff       	call   ba0 <free>
+      threads[i].stack = 0;
+      break;
+ eab:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ eae:	c7 83 e0 15 00 00 00 	movl   $0x0,0x15e0(%ebx)
+ eb5:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ eb8:	83 ec 0c             	sub    $0xc,%esp
+ ebb:	68 c0 15 00 00       	push   $0x15c0
+ ec0:	e8 9b f7 ff ff       	call   660 <lock_release>
+  return pid;
+ ec5:	83 c4 10             	add    $0x10,%esp
+}
+ ec8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ecb:	89 f0                	mov    %esi,%eax
+ ecd:	5b                   	pop    %ebx
+ ece:	5e                   	pop    %esi
+ ecf:	5d                   	pop    %ebp
+ ed0:	c3                   	ret
+    return -1;
+ ed1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ ed6:	eb f0                	jmp    ec8 <thread_join+0x78>
@@ -0,0 +1,136 @@
+// Lock contention benchmark for futex.
+// Threads hammer one counter under the spinning lock_t and then
+// under the futex-based mutex_t, and the time each run took is
+// printed; compare the two under make qemu CPUS=1 and CPUS=4.
+// A final run shares a mutex between two processes through a
+// MAP_SHARED page, which only works if futex waiters are keyed by
+// physical address.
+//
+// usage: futexbench [threads [iters]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define HOLD 50  // work done while holding the lock
+
+int nthreads, iters;
+uint counter;
+lock_t spin;
+mutex_t mu;
+
+// Bump counter HOLD times, so that the lock is held long enough to
+// be contended.
+void
+critical(volatile uint *c)
+{
+  int i;
+
+  for(i = 0; i < HOLD; i++)
+    (*c)++;
+}
+
+void
+spinworker(void *arg)
+{
+  int i;
+
+  for(i = 0; i < iters; i++){
+    lock_acquire(&spin);
+    critical(&counter);
+    lock_release(&spin);
+  }
+}
+
+void
+mutexworker(void *arg)
+{
+  int i;
+
+  for(i = 0; i < iters; i++){
+    mutex_lock(&mu);
+    critical(&counter);
+    mutex_unlock(&mu);
+  }
+}
+
+void
+run(char *name, void (*fn)(void*))
+{
+  int i, start, elapsed;
+
+  counter = 0;
+  start = uptime();
+  for(i = 0; i < nthreads; i++){
+    if(thread_create(fn, 0) < 0){
+      printf(2, "futexbench: thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < nthreads; i++)
+    thread_join();
+  elapsed = uptime() - start;
+  printf(1, "futexbench: %s: %d threads x %d: %d ticks%s\n",
+         name, nthreads, iters, elapsed,
+         counter == nthreads * iters * HOLD ? "" : " WRONG COUNT");
+}
+
+// Parent and child share a page holding a mutex and a counter.
+void
+crossproc(void)
+{
+  struct {
+    mutex_t mu;
+    uint counter;
+  } *sh;
+  int i, start, elapsed;
+
+  sh = (void*)wmap(0, 4096, MAP_SHARED | MAP_ANONYMOUS | MAP_POPULATE, -1);
+  if((int)sh == FAILED){
+    printf(2, "futexbench: wmap failed\n");
+    return;
+  }
+  mutex_init(&sh->mu);
+  sh->counter = 0;
+  start = uptime();
+  if(fork() == 0){
+    for(i = 0; i < iters; i++){
+      mutex_lock(&sh->mu);
+      critical(&sh->counter);
+      mutex_unlock(&sh->mu);
+    }
+    exit();
+  }
+  for(i = 0; i < iters; i++){
+    mutex_lock(&sh->mu);
+    critical(&sh->counter);
+    mutex_unlock(&sh->mu);
+  }
+  wait();
+  elapsed = uptime() - start;
+  printf(1, "futexbench: shared mutex: 2 processes x %d: %d ticks%s\n",
+         iters, elapsed, sh->counter == 2 * iters * HOLD ? "" : " WRONG COUNT");
+  wunmap((uint)sh);
+}
+
+int
+main(int argc, char *argv[])
+{
+  nthreads = 4;
+  iters = 20000;
+  if(argc > 1)
+    nthreads = atoi(argv[1]);
+  if(argc > 2)
+    iters = atoi(argv[2]);
+  if(nthreads < 1 || iters < 1){
+    printf(2, "usage: futexbench [threads [iters]]\n");
+    exit();
+  }
+
+  lock_init(&spin);
+  mutex_init(&mu);
+  run("spinlock", spinworker);
+  run("mutex", mutexworker);
+  crossproc();
+  exit();
+}
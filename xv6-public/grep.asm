@@ -0,0 +1,2228 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 18             	sub    $0x18,%esp
+  14:	8b 01                	mov    (%ecx),%eax
+  16:	8b 59 04             	mov    0x4(%ecx),%ebx
+  19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int fd, i;
+  char *pattern;
+
+  if(argc <= 1){
+  1c:	83 f8 01             	cmp    $0x1,%eax
+  1f:	7e 6f                	jle    90 <main+0x90>
+    printf(2, "usage: grep pattern [file ...]\n");
+    exit();
+  }
+  pattern = argv[1];
+  21:	8b 43 04             	mov    0x4(%ebx),%eax
+  24:	83 c3 08             	add    $0x8,%ebx
+
+  if(argc <= 2){
+  27:	83 7d e4 02          	cmpl   $0x2,-0x1c(%ebp)
+    grep(pattern, 0);
+    exit();
+  }
+
+  for(i = 2; i < argc; i++){
+  2b:	be 02 00 00 00       	mov    $0x2,%esi
+  pattern = argv[1];
+  30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc <= 2){
+  33:	75 2d                	jne    62 <main+0x62>
+  35:	eb 6c                	jmp    a3 <main+0xa3>
+  37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  3e:	66 90                	xchg   %ax,%ax
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "grep: cannot open %s\n", argv[i]);
+      exit();
+    }
+    grep(pattern, fd);
+  40:	83 ec 08             	sub    $0x8,%esp
+  for(i = 2; i < argc; i++){
+  43:	83 c6 01             	add    $0x1,%esi
+  46:	83 c3 04             	add    $0x4,%ebx
+    grep(pattern, fd);
+  49:	50                   	push   %eax
+  4a:	ff 75 e0             	push   -0x20(%ebp)
+  4d:	e8 9e 01 00 00       	call   1f0 <grep>
+    close(fd);
+  52:	89 3c 24             	mov    %edi,(%esp)
+  55:	e8 62 07 00 00       	call   7bc <close>
+  for(i = 2; i < argc; i++){
+  5a:	83 c4 10             	add    $0x10,%esp
+  5d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  60:	7e 29                	jle    8b <main+0x8b>
+    if((fd = open(argv[i], 0)) < 0){
+  62:	83 ec 08             	sub    $0x8,%esp
+  65:	6a 00                	push   $0x0
+  67:	ff 33                	push   (%ebx)
+  69:	e8 66 07 00 00       	call   7d4 <open>
+  6e:	83 c4 10             	add    $0x10,%esp
+  71:	89 c7                	mov    %eax,%edi
+  73:	85 c0                	test   %eax,%eax
+  75:	79 c9                	jns    40 <main+0x40>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+  77:	50                   	push   %eax
+  78:	ff 33                	push   (%ebx)
+  7a:	68 a8 0e 00 00       	push   $0xea8
+  7f:	6a 01                	push   $0x1
+  81:	e8 1a 09 00 00       	call   9a0 <printf>
+      exit();
+  86:	e8 09 07 00 00       	call   794 <exit>
+  }
+  exit();
+  8b:	e8 04 07 00 00       	call   794 <exit>
+    printf(2, "usage: grep pattern [file ...]\n");
+  90:	51                   	push   %ecx
+  91:	51                   	push   %ecx
+  92:	68 88 0e 00 00       	push   $0xe88
+  97:	6a 02                	push   $0x2
+  99:	e8 02 09 00 00       	call   9a0 <printf>
+    exit();
+  9e:	e8 f1 06 00 00       	call   794 <exit>
+    grep(pattern, 0);
+  a3:	52                   	push   %edx
+  a4:	52                   	push   %edx
+  a5:	6a 00                	push   $0x0
+  a7:	50                   	push   %eax
+  a8:	e8 43 01 00 00       	call   1f0 <grep>
+    exit();
+  ad:	e8 e2 06 00 00       	call   794 <exit>
+  b2:	66 90                	xchg   %ax,%ax
+  b4:	66 90                	xchg   %ax,%ax
+  b6:	66 90                	xchg   %ax,%ax
+  b8:	66 90                	xchg   %ax,%ax
+  ba:	66 90                	xchg   %ax,%ax
+  bc:	66 90                	xchg   %ax,%ax
+  be:	66 90                	xchg   %ax,%ax
+
+000000c0 <matchhere>:
+  return 0;
+}
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	57                   	push   %edi
+  c4:	56                   	push   %esi
+  c5:	53                   	push   %ebx
+  c6:	83 ec 0c             	sub    $0xc,%esp
+  c9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  cc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(re[0] == '\0')
+  cf:	0f b6 0f             	movzbl (%edi),%ecx
+  d2:	84 c9                	test   %cl,%cl
+  d4:	0f 84 96 00 00 00    	je     170 <matchhere+0xb0>
+    return 1;
+  if(re[1] == '*')
+  da:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+  de:	3c 2a                	cmp    $0x2a,%al
+  e0:	74 2d                	je     10f <matchhere+0x4f>
+  e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return matchstar(re[0], re+2, text);
+  if(re[0] == '$' && re[1] == '\0')
+    return *text == '\0';
+  e8:	0f b6 33             	movzbl (%ebx),%esi
+  if(re[0] == '$' && re[1] == '\0')
+  eb:	80 f9 24             	cmp    $0x24,%cl
+  ee:	74 50                	je     140 <matchhere+0x80>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+  f0:	89 f2                	mov    %esi,%edx
+  f2:	84 d2                	test   %dl,%dl
+  f4:	74 6e                	je     164 <matchhere+0xa4>
+  f6:	80 f9 2e             	cmp    $0x2e,%cl
+  f9:	75 65                	jne    160 <matchhere+0xa0>
+    return matchhere(re+1, text+1);
+  fb:	83 c3 01             	add    $0x1,%ebx
+  fe:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 101:	84 c0                	test   %al,%al
+ 103:	74 6b                	je     170 <matchhere+0xb0>
+ 105:	89 c1                	mov    %eax,%ecx
+  if(re[1] == '*')
+ 107:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+ 10b:	3c 2a                	cmp    $0x2a,%al
+ 10d:	75 d9                	jne    e8 <matchhere+0x28>
+    return matchstar(re[0], re+2, text);
+ 10f:	8d 77 02             	lea    0x2(%edi),%esi
+ 112:	0f be f9             	movsbl %cl,%edi
+  return 0;
+}
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+ 115:	8d 76 00             	lea    0x0(%esi),%esi
+{
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 118:	83 ec 08             	sub    $0x8,%esp
+ 11b:	53                   	push   %ebx
+ 11c:	56                   	push   %esi
+ 11d:	e8 9e ff ff ff       	call   c0 <matchhere>
+ 122:	83 c4 10             	add    $0x10,%esp
+ 125:	85 c0                	test   %eax,%eax
+ 127:	75 47                	jne    170 <matchhere+0xb0>
+      return 1;
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 129:	0f be 13             	movsbl (%ebx),%edx
+ 12c:	84 d2                	test   %dl,%dl
+ 12e:	74 45                	je     175 <matchhere+0xb5>
+ 130:	83 c3 01             	add    $0x1,%ebx
+ 133:	39 fa                	cmp    %edi,%edx
+ 135:	74 e1                	je     118 <matchhere+0x58>
+ 137:	83 ff 2e             	cmp    $0x2e,%edi
+ 13a:	74 dc                	je     118 <matchhere+0x58>
+ 13c:	eb 37                	jmp    175 <matchhere+0xb5>
+ 13e:	66 90                	xchg   %ax,%ax
+  if(re[0] == '$' && re[1] == '\0')
+ 140:	84 c0                	test   %al,%al
+ 142:	74 39                	je     17d <matchhere+0xbd>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 144:	89 f2                	mov    %esi,%edx
+ 146:	84 d2                	test   %dl,%dl
+ 148:	74 1a                	je     164 <matchhere+0xa4>
+ 14a:	80 fa 24             	cmp    $0x24,%dl
+ 14d:	75 15                	jne    164 <matchhere+0xa4>
+    return matchhere(re+1, text+1);
+ 14f:	83 c3 01             	add    $0x1,%ebx
+ 152:	83 c7 01             	add    $0x1,%edi
+  if(re[0] == '\0')
+ 155:	89 c1                	mov    %eax,%ecx
+ 157:	eb ae                	jmp    107 <matchhere+0x47>
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 160:	38 ca                	cmp    %cl,%dl
+ 162:	74 97                	je     fb <matchhere+0x3b>
+}
+ 164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  return 0;
+ 167:	31 c0                	xor    %eax,%eax
+}
+ 169:	5b                   	pop    %ebx
+ 16a:	5e                   	pop    %esi
+ 16b:	5f                   	pop    %edi
+ 16c:	5d                   	pop    %ebp
+ 16d:	c3                   	ret
+ 16e:	66 90                	xchg   %ax,%ax
+    return 1;
+ 170:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 175:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 178:	5b                   	pop    %ebx
+ 179:	5e                   	pop    %esi
+ 17a:	5f                   	pop    %edi
+ 17b:	5d                   	pop    %ebp
+ 17c:	c3                   	ret
+    return *text == '\0';
+ 17d:	89 f0                	mov    %esi,%eax
+ 17f:	84 c0                	test   %al,%al
+ 181:	0f 94 c0             	sete   %al
+ 184:	0f b6 c0             	movzbl %al,%eax
+ 187:	eb ec                	jmp    175 <matchhere+0xb5>
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000190 <match>:
+{
+ 190:	55                   	push   %ebp
+ 191:	89 e5                	mov    %esp,%ebp
+ 193:	56                   	push   %esi
+ 194:	53                   	push   %ebx
+ 195:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 198:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(re[0] == '^')
+ 19b:	80 3b 5e             	cmpb   $0x5e,(%ebx)
+ 19e:	75 11                	jne    1b1 <match+0x21>
+ 1a0:	eb 2e                	jmp    1d0 <match+0x40>
+ 1a2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  }while(*text++ != '\0');
+ 1a8:	83 c6 01             	add    $0x1,%esi
+ 1ab:	80 7e ff 00          	cmpb   $0x0,-0x1(%esi)
+ 1af:	74 16                	je     1c7 <match+0x37>
+    if(matchhere(re, text))
+ 1b1:	83 ec 08             	sub    $0x8,%esp
+ 1b4:	56                   	push   %esi
+ 1b5:	53                   	push   %ebx
+ 1b6:	e8 05 ff ff ff       	call   c0 <matchhere>
+ 1bb:	83 c4 10             	add    $0x10,%esp
+ 1be:	85 c0                	test   %eax,%eax
+ 1c0:	74 e6                	je     1a8 <match+0x18>
+      return 1;
+ 1c2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 1c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1ca:	5b                   	pop    %ebx
+ 1cb:	5e                   	pop    %esi
+ 1cc:	5d                   	pop    %ebp
+ 1cd:	c3                   	ret
+ 1ce:	66 90                	xchg   %ax,%ax
+    return matchhere(re+1, text);
+ 1d0:	83 c3 01             	add    $0x1,%ebx
+ 1d3:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+ 1d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1d9:	5b                   	pop    %ebx
+ 1da:	5e                   	pop    %esi
+ 1db:	5d                   	pop    %ebp
+    return matchhere(re+1, text);
+ 1dc:	e9 df fe ff ff       	jmp    c0 <matchhere>
+ 1e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ef:	90                   	nop
+
+000001f0 <grep>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	57                   	push   %edi
+  m = 0;
+ 1f4:	31 ff                	xor    %edi,%edi
+{
+ 1f6:	56                   	push   %esi
+ 1f7:	53                   	push   %ebx
+ 1f8:	83 ec 1c             	sub    $0x1c,%esp
+ 1fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1fe:	89 7d e0             	mov    %edi,-0x20(%ebp)
+    return matchhere(re+1, text);
+ 201:	8d 43 01             	lea    0x1(%ebx),%eax
+ 204:	89 45 dc             	mov    %eax,-0x24(%ebp)
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf+m, sizeof(buf)-m-1)) > 0){
+ 210:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+ 213:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+ 218:	83 ec 04             	sub    $0x4,%esp
+ 21b:	29 c8                	sub    %ecx,%eax
+ 21d:	50                   	push   %eax
+ 21e:	8d 81 a0 14 00 00    	lea    0x14a0(%ecx),%eax
+ 224:	50                   	push   %eax
+ 225:	ff 75 0c             	push   0xc(%ebp)
+ 228:	e8 7f 05 00 00       	call   7ac <read>
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	0f 8e fd 00 00 00    	jle    335 <grep+0x145>
+    m += n;
+ 238:	01 45 e0             	add    %eax,-0x20(%ebp)
+ 23b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+    buf[m] = '\0';
+ 23e:	bf a0 14 00 00       	mov    $0x14a0,%edi
+ 243:	89 de                	mov    %ebx,%esi
+ 245:	c6 81 a0 14 00 00 00 	movb   $0x0,0x14a0(%ecx)
+    while((q = strchr(p, '\n')) != 0){
+ 24c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 250:	83 ec 08             	sub    $0x8,%esp
+ 253:	6a 0a                	push   $0xa
+ 255:	57                   	push   %edi
+ 256:	e8 25 02 00 00       	call   480 <strchr>
+ 25b:	83 c4 10             	add    $0x10,%esp
+ 25e:	89 c2                	mov    %eax,%edx
+ 260:	85 c0                	test   %eax,%eax
+ 262:	0f 84 88 00 00 00    	je     2f0 <grep+0x100>
+      *q = 0;
+ 268:	c6 02 00             	movb   $0x0,(%edx)
+  if(re[0] == '^')
+ 26b:	80 3e 5e             	cmpb   $0x5e,(%esi)
+ 26e:	74 58                	je     2c8 <grep+0xd8>
+ 270:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+ 273:	89 d3                	mov    %edx,%ebx
+ 275:	eb 12                	jmp    289 <grep+0x99>
+ 277:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27e:	66 90                	xchg   %ax,%ax
+  }while(*text++ != '\0');
+ 280:	83 c7 01             	add    $0x1,%edi
+ 283:	80 7f ff 00          	cmpb   $0x0,-0x1(%edi)
+ 287:	74 37                	je     2c0 <grep+0xd0>
+    if(matchhere(re, text))
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	57                   	push   %edi
+ 28d:	56                   	push   %esi
+ 28e:	e8 2d fe ff ff       	call   c0 <matchhere>
+ 293:	83 c4 10             	add    $0x10,%esp
+ 296:	85 c0                	test   %eax,%eax
+ 298:	74 e6                	je     280 <grep+0x90>
+        write(1, p, q+1 - p);
+ 29a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+ 29d:	89 da                	mov    %ebx,%edx
+ 29f:	8d 5b 01             	lea    0x1(%ebx),%ebx
+ 2a2:	89 d8                	mov    %ebx,%eax
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+        *q = '\n';
+ 2a7:	c6 02 0a             	movb   $0xa,(%edx)
+        write(1, p, q+1 - p);
+ 2aa:	29 f8                	sub    %edi,%eax
+ 2ac:	50                   	push   %eax
+ 2ad:	57                   	push   %edi
+ 2ae:	89 df                	mov    %ebx,%edi
+ 2b0:	6a 01                	push   $0x1
+ 2b2:	e8 fd 04 00 00       	call   7b4 <write>
+ 2b7:	83 c4 10             	add    $0x10,%esp
+ 2ba:	eb 94                	jmp    250 <grep+0x60>
+ 2bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c0:	8d 7b 01             	lea    0x1(%ebx),%edi
+      p = q+1;
+ 2c3:	eb 8b                	jmp    250 <grep+0x60>
+ 2c5:	8d 76 00             	lea    0x0(%esi),%esi
+    return matchhere(re+1, text);
+ 2c8:	83 ec 08             	sub    $0x8,%esp
+ 2cb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+ 2ce:	57                   	push   %edi
+ 2cf:	ff 75 dc             	push   -0x24(%ebp)
+ 2d2:	e8 e9 fd ff ff       	call   c0 <matchhere>
+        write(1, p, q+1 - p);
+ 2d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    return matchhere(re+1, text);
+ 2da:	83 c4 10             	add    $0x10,%esp
+        write(1, p, q+1 - p);
+ 2dd:	8d 5a 01             	lea    0x1(%edx),%ebx
+      if(match(pattern, p)){
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	75 be                	jne    2a2 <grep+0xb2>
+        write(1, p, q+1 - p);
+ 2e4:	89 df                	mov    %ebx,%edi
+ 2e6:	e9 65 ff ff ff       	jmp    250 <grep+0x60>
+ 2eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ef:	90                   	nop
+    if(p == buf)
+ 2f0:	89 f3                	mov    %esi,%ebx
+ 2f2:	81 ff a0 14 00 00    	cmp    $0x14a0,%edi
+ 2f8:	74 2f                	je     329 <grep+0x139>
+    if(m > 0){
+ 2fa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	0f 8e 0b ff ff ff    	jle    210 <grep+0x20>
+      m -= p - buf;
+ 305:	89 f8                	mov    %edi,%eax
+      memmove(buf, p, m);
+ 307:	83 ec 04             	sub    $0x4,%esp
+      m -= p - buf;
+ 30a:	2d a0 14 00 00       	sub    $0x14a0,%eax
+ 30f:	29 45 e0             	sub    %eax,-0x20(%ebp)
+ 312:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      memmove(buf, p, m);
+ 315:	51                   	push   %ecx
+ 316:	57                   	push   %edi
+ 317:	68 a0 14 00 00       	push   $0x14a0
+ 31c:	e8 8f 02 00 00       	call   5b0 <memmove>
+ 321:	83 c4 10             	add    $0x10,%esp
+ 324:	e9 e7 fe ff ff       	jmp    210 <grep+0x20>
+      m = 0;
+ 329:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 330:	e9 db fe ff ff       	jmp    210 <grep+0x20>
+}
+ 335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 338:	5b                   	pop    %ebx
+ 339:	5e                   	pop    %esi
+ 33a:	5f                   	pop    %edi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <matchstar>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	56                   	push   %esi
+ 345:	53                   	push   %ebx
+ 346:	83 ec 0c             	sub    $0xc,%esp
+ 349:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 34c:	8b 75 0c             	mov    0xc(%ebp),%esi
+ 34f:	8b 7d 10             	mov    0x10(%ebp),%edi
+ 352:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(matchhere(re, text))
+ 358:	83 ec 08             	sub    $0x8,%esp
+ 35b:	57                   	push   %edi
+ 35c:	56                   	push   %esi
+ 35d:	e8 5e fd ff ff       	call   c0 <matchhere>
+ 362:	83 c4 10             	add    $0x10,%esp
+ 365:	85 c0                	test   %eax,%eax
+ 367:	75 1f                	jne    388 <matchstar+0x48>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 369:	0f be 17             	movsbl (%edi),%edx
+ 36c:	84 d2                	test   %dl,%dl
+ 36e:	74 0c                	je     37c <matchstar+0x3c>
+ 370:	83 c7 01             	add    $0x1,%edi
+ 373:	39 da                	cmp    %ebx,%edx
+ 375:	74 e1                	je     358 <matchstar+0x18>
+ 377:	83 fb 2e             	cmp    $0x2e,%ebx
+ 37a:	74 dc                	je     358 <matchstar+0x18>
+}
+ 37c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 37f:	5b                   	pop    %ebx
+ 380:	5e                   	pop    %esi
+ 381:	5f                   	pop    %edi
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 388:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return 1;
+ 38b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+ 390:	5b                   	pop    %ebx
+ 391:	5e                   	pop    %esi
+ 392:	5f                   	pop    %edi
+ 393:	5d                   	pop    %ebp
+ 394:	c3                   	ret
+ 395:	66 90                	xchg   %ax,%ax
+ 397:	66 90                	xchg   %ax,%ax
+ 399:	66 90                	xchg   %ax,%ax
+ 39b:	66 90                	xchg   %ax,%ax
+ 39d:	66 90                	xchg   %ax,%ax
+ 39f:	90                   	nop
+
+000003a0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 3a0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 3a1:	31 c0                	xor    %eax,%eax
+{
+ 3a3:	89 e5                	mov    %esp,%ebp
+ 3a5:	53                   	push   %ebx
+ 3a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 3ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 3b0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 3b4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 3b7:	83 c0 01             	add    $0x1,%eax
+ 3ba:	84 d2                	test   %dl,%dl
+ 3bc:	75 f2                	jne    3b0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 3be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3c1:	89 c8                	mov    %ecx,%eax
+ 3c3:	c9                   	leave
+ 3c4:	c3                   	ret
+ 3c5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	53                   	push   %ebx
+ 3d4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 3da:	0f b6 02             	movzbl (%edx),%eax
+ 3dd:	84 c0                	test   %al,%al
+ 3df:	75 17                	jne    3f8 <strcmp+0x28>
+ 3e1:	eb 3a                	jmp    41d <strcmp+0x4d>
+ 3e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3e7:	90                   	nop
+ 3e8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 3ec:	83 c2 01             	add    $0x1,%edx
+ 3ef:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 3f2:	84 c0                	test   %al,%al
+ 3f4:	74 1a                	je     410 <strcmp+0x40>
+    p++, q++;
+ 3f6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 3f8:	0f b6 19             	movzbl (%ecx),%ebx
+ 3fb:	38 c3                	cmp    %al,%bl
+ 3fd:	74 e9                	je     3e8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 3ff:	29 d8                	sub    %ebx,%eax
+}
+ 401:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 404:	c9                   	leave
+ 405:	c3                   	ret
+ 406:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 410:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 414:	31 c0                	xor    %eax,%eax
+ 416:	29 d8                	sub    %ebx,%eax
+}
+ 418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 41b:	c9                   	leave
+ 41c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 41d:	0f b6 19             	movzbl (%ecx),%ebx
+ 420:	31 c0                	xor    %eax,%eax
+ 422:	eb db                	jmp    3ff <strcmp+0x2f>
+ 424:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 436:	80 3a 00             	cmpb   $0x0,(%edx)
+ 439:	74 15                	je     450 <strlen+0x20>
+ 43b:	31 c0                	xor    %eax,%eax
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+ 440:	83 c0 01             	add    $0x1,%eax
+ 443:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 447:	89 c1                	mov    %eax,%ecx
+ 449:	75 f5                	jne    440 <strlen+0x10>
+    ;
+  return n;
+}
+ 44b:	89 c8                	mov    %ecx,%eax
+ 44d:	5d                   	pop    %ebp
+ 44e:	c3                   	ret
+ 44f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 450:	31 c9                	xor    %ecx,%ecx
+}
+ 452:	5d                   	pop    %ebp
+ 453:	89 c8                	mov    %ecx,%eax
+ 455:	c3                   	ret
+ 456:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000460 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 467:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 46a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 46d:	89 d7                	mov    %edx,%edi
+ 46f:	fc                   	cld
+ 470:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 472:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 475:	89 d0                	mov    %edx,%eax
+ 477:	c9                   	leave
+ 478:	c3                   	ret
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 48a:	0f b6 10             	movzbl (%eax),%edx
+ 48d:	84 d2                	test   %dl,%dl
+ 48f:	75 12                	jne    4a3 <strchr+0x23>
+ 491:	eb 1d                	jmp    4b0 <strchr+0x30>
+ 493:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 497:	90                   	nop
+ 498:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 49c:	83 c0 01             	add    $0x1,%eax
+ 49f:	84 d2                	test   %dl,%dl
+ 4a1:	74 0d                	je     4b0 <strchr+0x30>
+    if(*s == c)
+ 4a3:	38 d1                	cmp    %dl,%cl
+ 4a5:	75 f1                	jne    498 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 4a7:	5d                   	pop    %ebp
+ 4a8:	c3                   	ret
+ 4a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 4b0:	31 c0                	xor    %eax,%eax
+}
+ 4b2:	5d                   	pop    %ebp
+ 4b3:	c3                   	ret
+ 4b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	57                   	push   %edi
+ 4c4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 4c5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 4c8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 4c9:	31 db                	xor    %ebx,%ebx
+{
+ 4cb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 4ce:	eb 27                	jmp    4f7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 4d0:	83 ec 04             	sub    $0x4,%esp
+ 4d3:	6a 01                	push   $0x1
+ 4d5:	56                   	push   %esi
+ 4d6:	6a 00                	push   $0x0
+ 4d8:	e8 cf 02 00 00       	call   7ac <read>
+    if(cc < 1)
+ 4dd:	83 c4 10             	add    $0x10,%esp
+ 4e0:	85 c0                	test   %eax,%eax
+ 4e2:	7e 1d                	jle    501 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 4e4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 4ef:	3c 0a                	cmp    $0xa,%al
+ 4f1:	74 10                	je     503 <gets+0x43>
+ 4f3:	3c 0d                	cmp    $0xd,%al
+ 4f5:	74 0c                	je     503 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 4f7:	89 df                	mov    %ebx,%edi
+ 4f9:	83 c3 01             	add    $0x1,%ebx
+ 4fc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 4ff:	7c cf                	jl     4d0 <gets+0x10>
+ 501:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 50a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50d:	5b                   	pop    %ebx
+ 50e:	5e                   	pop    %esi
+ 50f:	5f                   	pop    %edi
+ 510:	5d                   	pop    %ebp
+ 511:	c3                   	ret
+ 512:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 519:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000520 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 520:	55                   	push   %ebp
+ 521:	89 e5                	mov    %esp,%ebp
+ 523:	56                   	push   %esi
+ 524:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 525:	83 ec 08             	sub    $0x8,%esp
+ 528:	6a 00                	push   $0x0
+ 52a:	ff 75 08             	push   0x8(%ebp)
+ 52d:	e8 a2 02 00 00       	call   7d4 <open>
+  if(fd < 0)
+ 532:	83 c4 10             	add    $0x10,%esp
+ 535:	85 c0                	test   %eax,%eax
+ 537:	78 27                	js     560 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 539:	83 ec 08             	sub    $0x8,%esp
+ 53c:	ff 75 0c             	push   0xc(%ebp)
+ 53f:	89 c3                	mov    %eax,%ebx
+ 541:	50                   	push   %eax
+ 542:	e8 a5 02 00 00       	call   7ec <fstat>
+  close(fd);
+ 547:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 54a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 54c:	e8 6b 02 00 00       	call   7bc <close>
+  return r;
+ 551:	83 c4 10             	add    $0x10,%esp
+}
+ 554:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 557:	89 f0                	mov    %esi,%eax
+ 559:	5b                   	pop    %ebx
+ 55a:	5e                   	pop    %esi
+ 55b:	5d                   	pop    %ebp
+ 55c:	c3                   	ret
+ 55d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 560:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 565:	eb ed                	jmp    554 <stat+0x34>
+ 567:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+ 573:	53                   	push   %ebx
+ 574:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 577:	0f be 02             	movsbl (%edx),%eax
+ 57a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 57d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 580:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 585:	77 1e                	ja     5a5 <atoi+0x35>
+ 587:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 58e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 590:	83 c2 01             	add    $0x1,%edx
+ 593:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 596:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 59a:	0f be 02             	movsbl (%edx),%eax
+ 59d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 5a0:	80 fb 09             	cmp    $0x9,%bl
+ 5a3:	76 eb                	jbe    590 <atoi+0x20>
+  return n;
+}
+ 5a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 5a8:	89 c8                	mov    %ecx,%eax
+ 5aa:	c9                   	leave
+ 5ab:	c3                   	ret
+ 5ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005b0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	89 e5                	mov    %esp,%ebp
+ 5b3:	57                   	push   %edi
+ 5b4:	56                   	push   %esi
+ 5b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5bb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 5be:	85 c0                	test   %eax,%eax
+ 5c0:	7e 13                	jle    5d5 <memmove+0x25>
+ 5c2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 5c4:	89 d7                	mov    %edx,%edi
+ 5c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5cd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 5d0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 5d1:	39 f8                	cmp    %edi,%eax
+ 5d3:	75 fb                	jne    5d0 <memmove+0x20>
+  return vdst;
+}
+ 5d5:	5e                   	pop    %esi
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	5f                   	pop    %edi
+ 5d9:	5d                   	pop    %ebp
+ 5da:	c3                   	ret
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+
+000005e0 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 5e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5ec:	5d                   	pop    %ebp
+ 5ed:	c3                   	ret
+ 5ee:	66 90                	xchg   %ax,%ax
+
+000005f0 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 5f0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 5f1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 5f6:	89 e5                	mov    %esp,%ebp
+ 5f8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ff:	90                   	nop
+ 600:	89 c8                	mov    %ecx,%eax
+ 602:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 605:	85 c0                	test   %eax,%eax
+ 607:	75 f7                	jne    600 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 609:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 60e:	5d                   	pop    %ebp
+ 60f:	c3                   	ret
+
+00000610 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 610:	55                   	push   %ebp
+ 611:	31 c0                	xor    %eax,%eax
+ 613:	89 e5                	mov    %esp,%ebp
+ 615:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 618:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 61d:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 620:	5d                   	pop    %ebp
+ 621:	c3                   	ret
+ 622:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 629:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 633:	8b 45 08             	mov    0x8(%ebp),%eax
+ 636:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 63c:	5d                   	pop    %ebp
+ 63d:	c3                   	ret
+ 63e:	66 90                	xchg   %ax,%ax
+
+00000640 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 640:	55                   	push   %ebp
+ 641:	b8 01 00 00 00       	mov    $0x1,%eax
+ 646:	89 e5                	mov    %esp,%ebp
+ 648:	56                   	push   %esi
+ 649:	53                   	push   %ebx
+ 64a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 64d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 650:	85 c0                	test   %eax,%eax
+ 652:	74 2d                	je     681 <mutex_lock+0x41>
+ 654:	b8 02 00 00 00       	mov    $0x2,%eax
+ 659:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 65c:	85 c0                	test   %eax,%eax
+ 65e:	74 21                	je     681 <mutex_lock+0x41>
+ 660:	be 02 00 00 00       	mov    $0x2,%esi
+ 665:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 668:	83 ec 04             	sub    $0x4,%esp
+ 66b:	6a 02                	push   $0x2
+ 66d:	6a 00                	push   $0x0
+ 66f:	53                   	push   %ebx
+ 670:	e8 37 02 00 00       	call   8ac <futex>
+ 675:	89 f0                	mov    %esi,%eax
+ 677:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 67a:	83 c4 10             	add    $0x10,%esp
+ 67d:	85 c0                	test   %eax,%eax
+ 67f:	75 e7                	jne    668 <mutex_lock+0x28>
+}
+ 681:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 684:	5b                   	pop    %ebx
+ 685:	5e                   	pop    %esi
+ 686:	5d                   	pop    %ebp
+ 687:	c3                   	ret
+ 688:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 68f:	90                   	nop
+
+00000690 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 690:	55                   	push   %ebp
+ 691:	31 c0                	xor    %eax,%eax
+ 693:	89 e5                	mov    %esp,%ebp
+ 695:	83 ec 08             	sub    $0x8,%esp
+ 698:	8b 55 08             	mov    0x8(%ebp),%edx
+ 69b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 69e:	83 f8 02             	cmp    $0x2,%eax
+ 6a1:	74 05                	je     6a8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 6a3:	c9                   	leave
+ 6a4:	c3                   	ret
+ 6a5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 6a8:	83 ec 04             	sub    $0x4,%esp
+ 6ab:	6a 01                	push   $0x1
+ 6ad:	6a 01                	push   $0x1
+ 6af:	52                   	push   %edx
+ 6b0:	e8 f7 01 00 00       	call   8ac <futex>
+ 6b5:	83 c4 10             	add    $0x10,%esp
+}
+ 6b8:	c9                   	leave
+ 6b9:	c3                   	ret
+ 6ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006c0 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 6c0:	55                   	push   %ebp
+ 6c1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 6c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 6cc:	5d                   	pop    %ebp
+ 6cd:	c3                   	ret
+ 6ce:	66 90                	xchg   %ax,%ax
+
+000006d0 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 6d0:	55                   	push   %ebp
+ 6d1:	31 c0                	xor    %eax,%eax
+ 6d3:	89 e5                	mov    %esp,%ebp
+ 6d5:	57                   	push   %edi
+ 6d6:	56                   	push   %esi
+ 6d7:	53                   	push   %ebx
+ 6d8:	83 ec 0c             	sub    $0xc,%esp
+ 6db:	8b 75 08             	mov    0x8(%ebp),%esi
+ 6de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 6e1:	8b 3e                	mov    (%esi),%edi
+ 6e3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 6e6:	83 f8 02             	cmp    $0x2,%eax
+ 6e9:	74 4d                	je     738 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 6eb:	83 ec 04             	sub    $0x4,%esp
+ 6ee:	57                   	push   %edi
+ 6ef:	6a 00                	push   $0x0
+ 6f1:	56                   	push   %esi
+ 6f2:	e8 b5 01 00 00       	call   8ac <futex>
+ 6f7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6fc:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 6ff:	83 c4 10             	add    $0x10,%esp
+ 702:	85 c0                	test   %eax,%eax
+ 704:	74 23                	je     729 <cond_wait+0x59>
+ 706:	be 02 00 00 00       	mov    $0x2,%esi
+ 70b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 70f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	6a 02                	push   $0x2
+ 715:	6a 00                	push   $0x0
+ 717:	53                   	push   %ebx
+ 718:	e8 8f 01 00 00       	call   8ac <futex>
+ 71d:	89 f0                	mov    %esi,%eax
+ 71f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 722:	83 c4 10             	add    $0x10,%esp
+ 725:	85 c0                	test   %eax,%eax
+ 727:	75 e7                	jne    710 <cond_wait+0x40>
+}
+ 729:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 72c:	5b                   	pop    %ebx
+ 72d:	5e                   	pop    %esi
+ 72e:	5f                   	pop    %edi
+ 72f:	5d                   	pop    %ebp
+ 730:	c3                   	ret
+ 731:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 738:	83 ec 04             	sub    $0x4,%esp
+ 73b:	6a 01                	push   $0x1
+ 73d:	6a 01                	push   $0x1
+ 73f:	53                   	push   %ebx
+ 740:	e8 67 01 00 00       	call   8ac <futex>
+ 745:	83 c4 10             	add    $0x10,%esp
+ 748:	eb a1                	jmp    6eb <cond_wait+0x1b>
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000750 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	83 ec 0c             	sub    $0xc,%esp
+ 756:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 759:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 75d:	6a 01                	push   $0x1
+ 75f:	6a 01                	push   $0x1
+ 761:	50                   	push   %eax
+ 762:	e8 45 01 00 00       	call   8ac <futex>
+}
+ 767:	83 c4 10             	add    $0x10,%esp
+ 76a:	c9                   	leave
+ 76b:	c3                   	ret
+ 76c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000770 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 770:	55                   	push   %ebp
+ 771:	89 e5                	mov    %esp,%ebp
+ 773:	83 ec 0c             	sub    $0xc,%esp
+ 776:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 779:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 77d:	6a ff                	push   $0xffffffff
+ 77f:	6a 01                	push   $0x1
+ 781:	50                   	push   %eax
+ 782:	e8 25 01 00 00       	call   8ac <futex>
+}
+ 787:	83 c4 10             	add    $0x10,%esp
+ 78a:	c9                   	leave
+ 78b:	c3                   	ret
+
+0000078c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 78c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 791:	cd 40                	int    $0x40
+ 793:	c3                   	ret
+
+00000794 <exit>:
+SYSCALL(exit)
+ 794:	b8 02 00 00 00       	mov    $0x2,%eax
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <wait>:
+SYSCALL(wait)
+ 79c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7a1:	cd 40                	int    $0x40
+ 7a3:	c3                   	ret
+
+000007a4 <pipe>:
+SYSCALL(pipe)
+ 7a4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7a9:	cd 40                	int    $0x40
+ 7ab:	c3                   	ret
+
+000007ac <read>:
+SYSCALL(read)
+ 7ac:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7b1:	cd 40                	int    $0x40
+ 7b3:	c3                   	ret
+
+000007b4 <write>:
+SYSCALL(write)
+ 7b4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7b9:	cd 40                	int    $0x40
+ 7bb:	c3                   	ret
+
+000007bc <close>:
+SYSCALL(close)
+ 7bc:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7c1:	cd 40                	int    $0x40
+ 7c3:	c3                   	ret
+
+000007c4 <kill>:
+SYSCALL(kill)
+ 7c4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7c9:	cd 40                	int    $0x40
+ 7cb:	c3                   	ret
+
+000007cc <exec>:
+SYSCALL(exec)
+ 7cc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7d1:	cd 40                	int    $0x40
+ 7d3:	c3                   	ret
+
+000007d4 <open>:
+SYSCALL(open)
+ 7d4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7d9:	cd 40                	int    $0x40
+ 7db:	c3                   	ret
+
+000007dc <mknod>:
+SYSCALL(mknod)
+ 7dc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7e1:	cd 40                	int    $0x40
+ 7e3:	c3                   	ret
+
+000007e4 <unlink>:
+SYSCALL(unlink)
+ 7e4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7e9:	cd 40                	int    $0x40
+ 7eb:	c3                   	ret
+
+000007ec <fstat>:
+SYSCALL(fstat)
+ 7ec:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7f1:	cd 40                	int    $0x40
+ 7f3:	c3                   	ret
+
+000007f4 <link>:
+SYSCALL(link)
+ 7f4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7f9:	cd 40                	int    $0x40
+ 7fb:	c3                   	ret
+
+000007fc <mkdir>:
+SYSCALL(mkdir)
+ 7fc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 801:	cd 40                	int    $0x40
+ 803:	c3                   	ret
+
+00000804 <chdir>:
+SYSCALL(chdir)
+ 804:	b8 09 00 00 00       	mov    $0x9,%eax
+ 809:	cd 40                	int    $0x40
+ 80b:	c3                   	ret
+
+0000080c <dup>:
+SYSCALL(dup)
+ 80c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 811:	cd 40                	int    $0x40
+ 813:	c3                   	ret
+
+00000814 <getpid>:
+SYSCALL(getpid)
+ 814:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 819:	cd 40                	int    $0x40
+ 81b:	c3                   	ret
+
+0000081c <sbrk>:
+SYSCALL(sbrk)
+ 81c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 821:	cd 40                	int    $0x40
+ 823:	c3                   	ret
+
+00000824 <sleep>:
+SYSCALL(sleep)
+ 824:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 829:	cd 40                	int    $0x40
+ 82b:	c3                   	ret
+
+0000082c <uptime>:
+SYSCALL(uptime)
+ 82c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 831:	cd 40                	int    $0x40
+ 833:	c3                   	ret
+
+00000834 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 834:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 839:	cd 40                	int    $0x40
+ 83b:	c3                   	ret
+
+0000083c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 83c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 841:	cd 40                	int    $0x40
+ 843:	c3                   	ret
+
+00000844 <wmap>:
+SYSCALL(wmap)
+ 844:	b8 16 00 00 00       	mov    $0x16,%eax
+ 849:	cd 40                	int    $0x40
+ 84b:	c3                   	ret
+
+0000084c <wunmap>:
+SYSCALL(wunmap)
+ 84c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 851:	cd 40                	int    $0x40
+ 853:	c3                   	ret
+
+00000854 <wremap>:
+SYSCALL(wremap)
+ 854:	b8 18 00 00 00       	mov    $0x18,%eax
+ 859:	cd 40                	int    $0x40
+ 85b:	c3                   	ret
+
+0000085c <wmlock>:
+SYSCALL(wmlock)
+ 85c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 861:	cd 40                	int    $0x40
+ 863:	c3                   	ret
+
+00000864 <wmunlock>:
+SYSCALL(wmunlock)
+ 864:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 869:	cd 40                	int    $0x40
+ 86b:	c3                   	ret
+
+0000086c <wmapoff>:
+SYSCALL(wmapoff)
+ 86c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 871:	cd 40                	int    $0x40
+ 873:	c3                   	ret
+
+00000874 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 874:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 879:	cd 40                	int    $0x40
+ 87b:	c3                   	ret
+
+0000087c <setpriority>:
+SYSCALL(setpriority)
+ 87c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 881:	cd 40                	int    $0x40
+ 883:	c3                   	ret
+
+00000884 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 884:	b8 20 00 00 00       	mov    $0x20,%eax
+ 889:	cd 40                	int    $0x40
+ 88b:	c3                   	ret
+
+0000088c <settickets>:
+SYSCALL(settickets)
+ 88c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 891:	cd 40                	int    $0x40
+ 893:	c3                   	ret
+
+00000894 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 894:	b8 22 00 00 00       	mov    $0x22,%eax
+ 899:	cd 40                	int    $0x40
+ 89b:	c3                   	ret
+
+0000089c <clone>:
+SYSCALL(clone)
+ 89c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 8a1:	cd 40                	int    $0x40
+ 8a3:	c3                   	ret
+
+000008a4 <join>:
+SYSCALL(join)
+ 8a4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 8a9:	cd 40                	int    $0x40
+ 8ab:	c3                   	ret
+
+000008ac <futex>:
+SYSCALL(futex)
+ 8ac:	b8 25 00 00 00       	mov    $0x25,%eax
+ 8b1:	cd 40                	int    $0x40
+ 8b3:	c3                   	ret
+
+000008b4 <setaffinity>:
+SYSCALL(setaffinity)
+ 8b4:	b8 26 00 00 00       	mov    $0x26,%eax
+ 8b9:	cd 40                	int    $0x40
+ 8bb:	c3                   	ret
+
+000008bc <getaffinity>:
+SYSCALL(getaffinity)
+ 8bc:	b8 27 00 00 00       	mov    $0x27,%eax
+ 8c1:	cd 40                	int    $0x40
+ 8c3:	c3                   	ret
+
+000008c4 <bcstat>:
+SYSCALL(bcstat)
+ 8c4:	b8 29 00 00 00       	mov    $0x29,%eax
+ 8c9:	cd 40                	int    $0x40
+ 8cb:	c3                   	ret
+
+000008cc <dropcache>:
+SYSCALL(dropcache)
+ 8cc:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 8d1:	cd 40                	int    $0x40
+ 8d3:	c3                   	ret
+
+000008d4 <setiosched>:
+SYSCALL(setiosched)
+ 8d4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 8d9:	cd 40                	int    $0x40
+ 8db:	c3                   	ret
+
+000008dc <iostat>:
+SYSCALL(iostat)
+ 8dc:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 8e1:	cd 40                	int    $0x40
+ 8e3:	c3                   	ret
+
+000008e4 <fsync>:
+SYSCALL(fsync)
+ 8e4:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 8e9:	cd 40                	int    $0x40
+ 8eb:	c3                   	ret
+
+000008ec <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 8ec:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 8ed:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 8f2:	cd 40                	int    $0x40
+ 8f4:	ff e1                	jmp    *%ecx
+ 8f6:	66 90                	xchg   %ax,%ax
+ 8f8:	66 90                	xchg   %ax,%ax
+ 8fa:	66 90                	xchg   %ax,%ax
+ 8fc:	66 90                	xchg   %ax,%ax
+ 8fe:	66 90                	xchg   %ax,%ax
+
+00000900 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 900:	55                   	push   %ebp
+ 901:	89 e5                	mov    %esp,%ebp
+ 903:	57                   	push   %edi
+ 904:	56                   	push   %esi
+ 905:	53                   	push   %ebx
+ 906:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 908:	89 d1                	mov    %edx,%ecx
+{
+ 90a:	83 ec 3c             	sub    $0x3c,%esp
+ 90d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 910:	85 d2                	test   %edx,%edx
+ 912:	0f 89 80 00 00 00    	jns    998 <printint+0x98>
+ 918:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 91c:	74 7a                	je     998 <printint+0x98>
+    x = -xx;
+ 91e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 920:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 925:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 928:	31 f6                	xor    %esi,%esi
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 930:	89 c8                	mov    %ecx,%eax
+ 932:	31 d2                	xor    %edx,%edx
+ 934:	89 f7                	mov    %esi,%edi
+ 936:	f7 f3                	div    %ebx
+ 938:	8d 76 01             	lea    0x1(%esi),%esi
+ 93b:	0f b6 92 20 0f 00 00 	movzbl 0xf20(%edx),%edx
+ 942:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 946:	89 ca                	mov    %ecx,%edx
+ 948:	89 c1                	mov    %eax,%ecx
+ 94a:	39 da                	cmp    %ebx,%edx
+ 94c:	73 e2                	jae    930 <printint+0x30>
+  if(neg)
+ 94e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 951:	85 c0                	test   %eax,%eax
+ 953:	74 07                	je     95c <printint+0x5c>
+    buf[i++] = '-';
+ 955:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 95a:	89 f7                	mov    %esi,%edi
+ 95c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 95f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 962:	01 df                	add    %ebx,%edi
+ 964:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 968:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 96b:	83 ec 04             	sub    $0x4,%esp
+ 96e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 971:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 974:	6a 01                	push   $0x1
+ 976:	50                   	push   %eax
+ 977:	56                   	push   %esi
+ 978:	e8 37 fe ff ff       	call   7b4 <write>
+  while(--i >= 0)
+ 97d:	89 f8                	mov    %edi,%eax
+ 97f:	83 c4 10             	add    $0x10,%esp
+ 982:	83 ef 01             	sub    $0x1,%edi
+ 985:	39 d8                	cmp    %ebx,%eax
+ 987:	75 df                	jne    968 <printint+0x68>
+}
+ 989:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 98c:	5b                   	pop    %ebx
+ 98d:	5e                   	pop    %esi
+ 98e:	5f                   	pop    %edi
+ 98f:	5d                   	pop    %ebp
+ 990:	c3                   	ret
+ 991:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 998:	31 c0                	xor    %eax,%eax
+ 99a:	eb 89                	jmp    925 <printint+0x25>
+ 99c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000009a0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 9a0:	55                   	push   %ebp
+ 9a1:	89 e5                	mov    %esp,%ebp
+ 9a3:	57                   	push   %edi
+ 9a4:	56                   	push   %esi
+ 9a5:	53                   	push   %ebx
+ 9a6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 9a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 9ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 9af:	0f b6 1e             	movzbl (%esi),%ebx
+ 9b2:	83 c6 01             	add    $0x1,%esi
+ 9b5:	84 db                	test   %bl,%bl
+ 9b7:	74 67                	je     a20 <printf+0x80>
+ 9b9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 9bc:	31 d2                	xor    %edx,%edx
+ 9be:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 9c1:	eb 34                	jmp    9f7 <printf+0x57>
+ 9c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9c7:	90                   	nop
+ 9c8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 9cb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 9d0:	83 f8 25             	cmp    $0x25,%eax
+ 9d3:	74 18                	je     9ed <printf+0x4d>
+  write(fd, &c, 1);
+ 9d5:	83 ec 04             	sub    $0x4,%esp
+ 9d8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 9db:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9de:	6a 01                	push   $0x1
+ 9e0:	50                   	push   %eax
+ 9e1:	57                   	push   %edi
+ 9e2:	e8 cd fd ff ff       	call   7b4 <write>
+ 9e7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 9ea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 9ed:	0f b6 1e             	movzbl (%esi),%ebx
+ 9f0:	83 c6 01             	add    $0x1,%esi
+ 9f3:	84 db                	test   %bl,%bl
+ 9f5:	74 29                	je     a20 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 9f7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 9fa:	85 d2                	test   %edx,%edx
+ 9fc:	74 ca                	je     9c8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 9fe:	83 fa 25             	cmp    $0x25,%edx
+ a01:	75 ea                	jne    9ed <printf+0x4d>
+      if(c == 'd'){
+ a03:	83 f8 25             	cmp    $0x25,%eax
+ a06:	0f 84 24 01 00 00    	je     b30 <printf+0x190>
+ a0c:	83 e8 63             	sub    $0x63,%eax
+ a0f:	83 f8 15             	cmp    $0x15,%eax
+ a12:	77 1c                	ja     a30 <printf+0x90>
+ a14:	ff 24 85 c8 0e 00 00 	jmp    *0xec8(,%eax,4)
+ a1b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a1f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ a20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a23:	5b                   	pop    %ebx
+ a24:	5e                   	pop    %esi
+ a25:	5f                   	pop    %edi
+ a26:	5d                   	pop    %ebp
+ a27:	c3                   	ret
+ a28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+  write(fd, &c, 1);
+ a30:	83 ec 04             	sub    $0x4,%esp
+ a33:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a36:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ a3a:	6a 01                	push   $0x1
+ a3c:	52                   	push   %edx
+ a3d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ a40:	57                   	push   %edi
+ a41:	e8 6e fd ff ff       	call   7b4 <write>
+ a46:	83 c4 0c             	add    $0xc,%esp
+ a49:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a4c:	6a 01                	push   $0x1
+ a4e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ a51:	52                   	push   %edx
+ a52:	57                   	push   %edi
+ a53:	e8 5c fd ff ff       	call   7b4 <write>
+        putc(fd, c);
+ a58:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a5b:	31 d2                	xor    %edx,%edx
+ a5d:	eb 8e                	jmp    9ed <printf+0x4d>
+ a5f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a60:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a63:	83 ec 0c             	sub    $0xc,%esp
+ a66:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a6b:	8b 13                	mov    (%ebx),%edx
+ a6d:	6a 00                	push   $0x0
+ a6f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a71:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a74:	e8 87 fe ff ff       	call   900 <printint>
+        ap++;
+ a79:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a7c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a7f:	31 d2                	xor    %edx,%edx
+ a81:	e9 67 ff ff ff       	jmp    9ed <printf+0x4d>
+ a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a90:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a93:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a95:	83 c0 04             	add    $0x4,%eax
+ a98:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a9b:	85 db                	test   %ebx,%ebx
+ a9d:	0f 84 9d 00 00 00    	je     b40 <printf+0x1a0>
+        while(*s != 0){
+ aa3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ aa6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ aa8:	84 c0                	test   %al,%al
+ aaa:	0f 84 3d ff ff ff    	je     9ed <printf+0x4d>
+ ab0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ab3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ ab6:	89 de                	mov    %ebx,%esi
+ ab8:	89 d3                	mov    %edx,%ebx
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ ac0:	83 ec 04             	sub    $0x4,%esp
+ ac3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ ac6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ ac9:	6a 01                	push   $0x1
+ acb:	53                   	push   %ebx
+ acc:	57                   	push   %edi
+ acd:	e8 e2 fc ff ff       	call   7b4 <write>
+        while(*s != 0){
+ ad2:	0f b6 06             	movzbl (%esi),%eax
+ ad5:	83 c4 10             	add    $0x10,%esp
+ ad8:	84 c0                	test   %al,%al
+ ada:	75 e4                	jne    ac0 <printf+0x120>
+      state = 0;
+ adc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ adf:	31 d2                	xor    %edx,%edx
+ ae1:	e9 07 ff ff ff       	jmp    9ed <printf+0x4d>
+ ae6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ aed:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ af0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ af3:	83 ec 0c             	sub    $0xc,%esp
+ af6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ afb:	8b 13                	mov    (%ebx),%edx
+ afd:	6a 01                	push   $0x1
+ aff:	e9 6b ff ff ff       	jmp    a6f <printf+0xcf>
+ b04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ b08:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ b0b:	83 ec 04             	sub    $0x4,%esp
+ b0e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ b11:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ b13:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ b16:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ b19:	6a 01                	push   $0x1
+ b1b:	52                   	push   %edx
+ b1c:	57                   	push   %edi
+ b1d:	e8 92 fc ff ff       	call   7b4 <write>
+        ap++;
+ b22:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ b25:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ b28:	31 d2                	xor    %edx,%edx
+ b2a:	e9 be fe ff ff       	jmp    9ed <printf+0x4d>
+ b2f:	90                   	nop
+  write(fd, &c, 1);
+ b30:	83 ec 04             	sub    $0x4,%esp
+ b33:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ b36:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ b39:	6a 01                	push   $0x1
+ b3b:	e9 11 ff ff ff       	jmp    a51 <printf+0xb1>
+ b40:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ b45:	bb be 0e 00 00       	mov    $0xebe,%ebx
+ b4a:	e9 61 ff ff ff       	jmp    ab0 <printf+0x110>
+ b4f:	90                   	nop
+
+00000b50 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b50:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b51:	a1 a0 18 00 00       	mov    0x18a0,%eax
+{
+ b56:	89 e5                	mov    %esp,%ebp
+ b58:	57                   	push   %edi
+ b59:	56                   	push   %esi
+ b5a:	53                   	push   %ebx
+ b5b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ b5e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b68:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b6a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b6c:	39 ca                	cmp    %ecx,%edx
+ b6e:	73 30                	jae    ba0 <free+0x50>
+ b70:	39 c1                	cmp    %eax,%ecx
+ b72:	72 04                	jb     b78 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b74:	39 c2                	cmp    %eax,%edx
+ b76:	72 f0                	jb     b68 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b78:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b7b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b7e:	39 f8                	cmp    %edi,%eax
+ b80:	74 2e                	je     bb0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b82:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b85:	8b 42 04             	mov    0x4(%edx),%eax
+ b88:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b8b:	39 f1                	cmp    %esi,%ecx
+ b8d:	74 38                	je     bc7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b8f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b91:	5b                   	pop    %ebx
+  freep = p;
+ b92:	89 15 a0 18 00 00    	mov    %edx,0x18a0
+}
+ b98:	5e                   	pop    %esi
+ b99:	5f                   	pop    %edi
+ b9a:	5d                   	pop    %ebp
+ b9b:	c3                   	ret
+ b9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ba0:	39 c1                	cmp    %eax,%ecx
+ ba2:	72 d0                	jb     b74 <free+0x24>
+ ba4:	eb c2                	jmp    b68 <free+0x18>
+ ba6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bad:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ bb0:	03 70 04             	add    0x4(%eax),%esi
+ bb3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bb6:	8b 02                	mov    (%edx),%eax
+ bb8:	8b 00                	mov    (%eax),%eax
+ bba:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ bbd:	8b 42 04             	mov    0x4(%edx),%eax
+ bc0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ bc3:	39 f1                	cmp    %esi,%ecx
+ bc5:	75 c8                	jne    b8f <free+0x3f>
+    p->s.size += bp->s.size;
+ bc7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ bca:	89 15 a0 18 00 00    	mov    %edx,0x18a0
+    p->s.size += bp->s.size;
+ bd0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ bd3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ bd6:	89 0a                	mov    %ecx,(%edx)
+}
+ bd8:	5b                   	pop    %ebx
+ bd9:	5e                   	pop    %esi
+ bda:	5f                   	pop    %edi
+ bdb:	5d                   	pop    %ebp
+ bdc:	c3                   	ret
+ bdd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000be0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	57                   	push   %edi
+ be4:	56                   	push   %esi
+ be5:	53                   	push   %ebx
+ be6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ be9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ bec:	8b 15 a0 18 00 00    	mov    0x18a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ bf2:	8d 78 07             	lea    0x7(%eax),%edi
+ bf5:	c1 ef 03             	shr    $0x3,%edi
+ bf8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ bfb:	85 d2                	test   %edx,%edx
+ bfd:	0f 84 8d 00 00 00    	je     c90 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c03:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c05:	8b 48 04             	mov    0x4(%eax),%ecx
+ c08:	39 f9                	cmp    %edi,%ecx
+ c0a:	73 64                	jae    c70 <malloc+0x90>
+  if(nu < 4096)
+ c0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ c11:	39 df                	cmp    %ebx,%edi
+ c13:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ c16:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ c1d:	eb 0a                	jmp    c29 <malloc+0x49>
+ c1f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c20:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ c22:	8b 48 04             	mov    0x4(%eax),%ecx
+ c25:	39 f9                	cmp    %edi,%ecx
+ c27:	73 47                	jae    c70 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ c29:	89 c2                	mov    %eax,%edx
+ c2b:	39 05 a0 18 00 00    	cmp    %eax,0x18a0
+ c31:	75 ed                	jne    c20 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ c33:	83 ec 0c             	sub    $0xc,%esp
+ c36:	56                   	push   %esi
+ c37:	e8 e0 fb ff ff       	call   81c <sbrk>
+  if(p == (char*)-1)
+ c3c:	83 c4 10             	add    $0x10,%esp
+ c3f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ c42:	74 1c                	je     c60 <malloc+0x80>
+  hp->s.size = nu;
+ c44:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ c47:	83 ec 0c             	sub    $0xc,%esp
+ c4a:	83 c0 08             	add    $0x8,%eax
+ c4d:	50                   	push   %eax
+ c4e:	e8 fd fe ff ff       	call   b50 <free>
+  return freep;
+ c53:	8b 15 a0 18 00 00    	mov    0x18a0,%edx
+      if((p = morecore(nunits)) == 0)
+ c59:	83 c4 10             	add    $0x10,%esp
+ c5c:	85 d2                	test   %edx,%edx
+ c5e:	75 c0                	jne    c20 <malloc+0x40>
+        return 0;
+  }
+}
+ c60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c63:	31 c0                	xor    %eax,%eax
+}
+ c65:	5b                   	pop    %ebx
+ c66:	5e                   	pop    %esi
+ c67:	5f                   	pop    %edi
+ c68:	5d                   	pop    %ebp
+ c69:	c3                   	ret
+ c6a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c70:	39 cf                	cmp    %ecx,%edi
+ c72:	74 4c                	je     cc0 <malloc+0xe0>
+        p->s.size -= nunits;
+ c74:	29 f9                	sub    %edi,%ecx
+ c76:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c79:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c7c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c7f:	89 15 a0 18 00 00    	mov    %edx,0x18a0
+}
+ c85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c88:	83 c0 08             	add    $0x8,%eax
+}
+ c8b:	5b                   	pop    %ebx
+ c8c:	5e                   	pop    %esi
+ c8d:	5f                   	pop    %edi
+ c8e:	5d                   	pop    %ebp
+ c8f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c90:	c7 05 a0 18 00 00 a4 	movl   $0x18a4,0x18a0
+ c97:	18 00 00 
+    base.s.size = 0;
+ c9a:	b8 a4 18 00 00       	mov    $0x18a4,%eax
+    base.s.ptr = freep = prevp = &base;
+ c9f:	c7 05 a4 18 00 00 a4 	movl   $0x18a4,0x18a4
+ ca6:	18 00 00 
+    base.s.size = 0;
+ ca9:	c7 05 a8 18 00 00 00 	movl   $0x0,0x18a8
+ cb0:	00 00 00 
+    if(p->s.size >= nunits){
+ cb3:	e9 54 ff ff ff       	jmp    c0c <malloc+0x2c>
+ cb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cbf:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ cc0:	8b 08                	mov    (%eax),%ecx
+ cc2:	89 0a                	mov    %ecx,(%edx)
+ cc4:	eb b9                	jmp    c7f <malloc+0x9f>
+ cc6:	66 90                	xchg   %ax,%ax
+ cc8:	66 90                	xchg   %ax,%ax
+ cca:	66 90                	xchg   %ax,%ax
+ ccc:	66 90                	xchg   %ax,%ax
+ cce:	66 90                	xchg   %ax,%ax
+
+00000cd0 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ cd0:	55                   	push   %ebp
+ cd1:	89 e5                	mov    %esp,%ebp
+ cd3:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ cd6:	8b 45 08             	mov    0x8(%ebp),%eax
+ cd9:	c1 e0 04             	shl    $0x4,%eax
+ cdc:	ff b0 ec 18 00 00    	push   0x18ec(%eax)
+ ce2:	05 e0 18 00 00       	add    $0x18e0,%eax
+ ce7:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ cea:	e8 a5 fa ff ff       	call   794 <exit>
+ cef:	90                   	nop
+
+00000cf0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ cf0:	55                   	push   %ebp
+ cf1:	89 e5                	mov    %esp,%ebp
+ cf3:	57                   	push   %edi
+ cf4:	56                   	push   %esi
+ cf5:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ cf6:	31 db                	xor    %ebx,%ebx
+{
+ cf8:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ cfb:	68 c0 18 00 00       	push   $0x18c0
+ d00:	e8 eb f8 ff ff       	call   5f0 <lock_acquire>
+ d05:	83 c4 10             	add    $0x10,%esp
+ d08:	eb 12                	jmp    d1c <thread_create+0x2c>
+ d0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ d10:	83 c3 01             	add    $0x1,%ebx
+ d13:	83 fb 40             	cmp    $0x40,%ebx
+ d16:	0f 84 c4 00 00 00    	je     de0 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ d1c:	89 de                	mov    %ebx,%esi
+ d1e:	c1 e6 04             	shl    $0x4,%esi
+ d21:	8b 96 e0 18 00 00    	mov    0x18e0(%esi),%edx
+ d27:	85 d2                	test   %edx,%edx
+ d29:	75 e5                	jne    d10 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ d2b:	83 ec 0c             	sub    $0xc,%esp
+ d2e:	68 00 20 00 00       	push   $0x2000
+ d33:	e8 a8 fe ff ff       	call   be0 <malloc>
+ d38:	83 c4 10             	add    $0x10,%esp
+ d3b:	85 c0                	test   %eax,%eax
+ d3d:	0f 84 9d 00 00 00    	je     de0 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ d43:	89 86 e4 18 00 00    	mov    %eax,0x18e4(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ d49:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ d4e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ d51:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ d56:	89 86 e0 18 00 00    	mov    %eax,0x18e0(%esi)
+  threads[i].fn = fn;
+ d5c:	8b 45 08             	mov    0x8(%ebp),%eax
+ d5f:	89 86 e8 18 00 00    	mov    %eax,0x18e8(%esi)
+  threads[i].arg = arg;
+ d65:	8b 45 0c             	mov    0xc(%ebp),%eax
+ d68:	89 86 ec 18 00 00    	mov    %eax,0x18ec(%esi)
+  lock_release(&threadslock);
+ d6e:	68 c0 18 00 00       	push   $0x18c0
+ d73:	e8 98 f8 ff ff       	call   610 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ d78:	83 c4 0c             	add    $0xc,%esp
+ d7b:	ff b6 e0 18 00 00    	push   0x18e0(%esi)
+ d81:	53                   	push   %ebx
+ d82:	68 d0 0c 00 00       	push   $0xcd0
+ d87:	e8 10 fb ff ff       	call   89c <clone>
+ d8c:	83 c4 10             	add    $0x10,%esp
+ d8f:	85 c0                	test   %eax,%eax
+ d91:	78 0d                	js     da0 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ d93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d96:	5b                   	pop    %ebx
+ d97:	5e                   	pop    %esi
+ d98:	5f                   	pop    %edi
+ d99:	5d                   	pop    %ebp
+ d9a:	c3                   	ret
+ d9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d9f:	90                   	nop
+    lock_acquire(&threadslock);
+ da0:	83 ec 0c             	sub    $0xc,%esp
+ da3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ da6:	68 c0 18 00 00       	push   $0x18c0
+ dab:	e8 40 f8 ff ff       	call   5f0 <lock_acquire>
+    free(threads[i].block);
+ db0:	58                   	pop    %eax
+ db1:	ff b6 e4 18 00 00    	push   0x18e4(%esi)
+ db7:	e8 94 fd ff ff       	call   b50 <free>
+    threads[i].stack = 0;
+ dbc:	c7 86 e0 18 00 00 00 	movl   $0x0,0x18e0(%esi)
+ dc3:	00 00 00 
+    lock_release(&threadslock);
+ dc6:	c7 04 24 c0 18 00 00 	movl   $0x18c0,(%esp)
+ dcd:	e8 3e f8 ff ff       	call   610 <lock_release>
+ dd2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ dd5:	83 c4 10             	add    $0x10,%esp
+}
+ dd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ddb:	5b                   	pop    %ebx
+ ddc:	5e                   	pop    %esi
+ ddd:	5f                   	pop    %edi
+ dde:	5d                   	pop    %ebp
+ ddf:	c3                   	ret
+    lock_release(&threadslock);
+ de0:	83 ec 0c             	sub    $0xc,%esp
+ de3:	68 c0 18 00 00       	push   $0x18c0
+ de8:	e8 23 f8 ff ff       	call   610 <lock_release>
+    return -1;
+ ded:	83 c4 10             	add    $0x10,%esp
+ df0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ df5:	eb 9c                	jmp    d93 <thread_create+0xa3>
+ df7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dfe:	66 90                	xchg   %ax,%ax
+
+00000e00 <thread_join>:
+
+int
+thread_join(void)
+{
+ e00:	55                   	push   %ebp
+ e01:	89 e5                	mov    %esp,%ebp
+ e03:	56                   	push   %esi
+ e04:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ e05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ e08:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ e0b:	50                   	push   %eax
+ e0c:	e8 93 fa ff ff       	call   8a4 <join>
+ e11:	83 c4 10             	add    $0x10,%esp
+ e14:	85 c0                	test   %eax,%eax
+ e16:	78 69                	js     e81 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ e18:	83 ec 0c             	sub    $0xc,%esp
+ e1b:	89 c6                	mov    %eax,%esi
+ e1d:	68 c0 18 00 00       	push   $0x18c0
+ e22:	e8 c9 f7 ff ff       	call   5f0 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ e27:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ e2a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ e2d:	31 c0                	xor    %eax,%eax
+ e2f:	eb 0f                	jmp    e40 <thread_join+0x40>
+ e31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ e38:	83 c0 01             	add    $0x1,%eax
+ e3b:	83 f8 40             	cmp    $0x40,%eax
+ e3e:	74 28                	je     e68 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ e40:	89 c3                	mov    %eax,%ebx
+ e42:	c1 e3 04             	shl    $0x4,%ebx
+ e45:	39 93 e0 18 00 00    	cmp    %edx,0x18e0(%ebx)
+ e4b:	75 eb                	jne    e38 <thread_join+0x38>
+      free(threads[i].block);
+ e4d:	83 ec 0c             	sub    $0xc,%esp
+ e50:	ff b3 e4 18 00 00    	push   0x18e4(%ebx)
+ e56:	e8 f5 fc ff ff       	call   b50 <free>
+      threads[i].stack = 0;
+      break;
+ e5b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ e5e:	c7 83 e0 18 00 00 00 	movl   $0x0,0x18e0(%ebx)
+ e65:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ e68:	83 ec 0c             	sub    $0xc,%esp
+ e6b:	68 c0 18 00 00       	push   $0x18c0
+ e70:	e8 9b f7 ff ff       	call   610 <lock_release>
+  return pid;
+ e75:	83 c4 10             	add    $0x10,%esp
+}
+ e78:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ e7b:	89 f0                	mov    %esi,%eax
+ e7d:	5b                   	pop    %ebx
+ e7e:	5e                   	pop    %esi
+ e7f:	5d                   	pop    %ebp
+ e80:	c3                   	ret
+    return -1;
+ e81:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ e86:	eb f0                	jmp    e78 <thread_join+0x78>
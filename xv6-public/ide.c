@@ -1,4 +1,8 @@
-// Simple PIO-based (non-DMA) IDE driver code.
+// IDE driver code.  Built with IDEDMA, it uses bus-master DMA when
+// the disk controller is a PCI IDE controller that supports it (like
+// the PIIX that QEMU emulates), and PIO otherwise or after a failed
+// DMA transfer.  The DMA path has not been booted yet, so it is off
+// by default.
 
 #include "types.h"
 #include "defs.h"
@@ -12,6 +16,9 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "bcache.h"
+#include "pci.h"
+#include "iosched.h"
 
 #define SECTOR_SIZE   512
 #define IDE_BSY       0x80
@@ -23,16 +30,79 @@
 #define IDE_CMD_WRITE 0x30
 #define IDE_CMD_RDMUL 0xc4
 #define IDE_CMD_WRMUL 0xc5
+#define IDE_CMD_SETMUL 0xc6
+#define IDE_CMD_RDDMA 0xc8
+#define IDE_CMD_WRDMA 0xca
+#define IDE_CMD_IDENTIFY 0xec
+
+#define IDE_MULT      16  // sectors moved per interrupt by RDMUL/WRMUL
+#define IDE_MAXDMA   128  // sectors moved by one DMA command
+#define IDE_MAXRETRY   3  // failed commands in a row before giving up
+
+// Bus-master IDE registers for the primary channel, at bmide.
+#define BM_CMD        0
+#define BM_STATUS     2
+#define BM_PRDT       4
+#define BM_START      0x01  // in BM_CMD: start the transfer
+#define BM_READ       0x08  // in BM_CMD: transfer into memory
+#define BM_ERR        0x02  // in BM_STATUS; write 1 to clear
+#define BM_INTR       0x04  // in BM_STATUS; write 1 to clear
+
+// Physical region descriptor: one piece of a DMA transfer.
+struct prd {
+  uint addr;
+  ushort len;
+  ushort flags;
+};
+#define PRD_EOT       0x8000  // last descriptor in the table
+
+// The table must not cross a 64K boundary, which this alignment
+// ensures.  A buf's data never crosses a page, so it needs one
+// descriptor.
+static struct prd prdt[IDE_MAXDMA] __attribute__((aligned(sizeof(struct prd)*IDE_MAXDMA)));
+static ushort bmide;  // bus-master registers, or 0 to use PIO
+static int ideerrors; // failed commands since the last good one
 
 // idequeue points to the buf now being read/written to the disk.
 // idequeue->qnext points to the next buf to be processed.
+// The request in progress covers the first idencluster bufs, which
+// are consecutive blocks going the same way; idencluster is 0 when
+// the disk is idle.  The order of the bufs behind them is up to the
+// disk scheduler.
 // You must hold idelock while manipulating queue.
 
 static struct spinlock idelock;
 static struct buf *idequeue;
+static int idencluster;
+static uint idepos;   // block the disk head is at
+static uint nintrs;   // completed disk commands
+static uint nblocks;  // blocks they moved
+static struct iostat iostat;
+
+// A disk scheduler.  add puts a new buf into idequeue somewhere
+// behind the request in progress; next, if set, may reorder the
+// queue just before its head is started.
+struct iosched {
+  char *name;
+  void (*add)(struct buf**, struct buf*);
+  void (*next)(void);
+};
+
+static void fifoadd(struct buf**, struct buf*);
+static void cscanadd(struct buf**, struct buf*);
+static void deadline(void);
+
+static struct iosched ioscheds[] = {
+[IOSCHED_FIFO]  { "fifo",  fifoadd,  0 },
+[IOSCHED_CSCAN] { "cscan", cscanadd, deadline },
+};
+static struct iosched *iosched = &ioscheds[IOSCHEDPOLICY];
 
 static int havedisk1;
+static uint idesize[2];  // sectors on each disk, or 0 if unknown
 static void idestart(struct buf*);
+static void idenext(void);
+static int histbucket(uint);
 
 // Wait for IDE disk to become ready.
 static int
@@ -50,6 +120,10 @@ idewait(int checkerr)
 void
 ideinit(void)
 {
+#ifdef IDEDMA
+  struct pcidev pd;
+#endif
+  ushort id[256];
   int i;
 
   initlock(&idelock, "ide");
@@ -65,35 +139,98 @@ ideinit(void)
     }
   }
 
+  // Let RDMUL/WRMUL move IDE_MULT sectors per interrupt, with the
+  // interrupt masked; idestart unmasks it.  Also read the number
+  // of LBA28 sectors from the IDENTIFY data, words 60 and 61.
+  for(i = 0; i <= havedisk1; i++){
+    outb(0x3f6, 2);
+    outb(0x1f6, 0xe0 | (i<<4));
+    outb(0x1f2, IDE_MULT);
+    outb(0x1f7, IDE_CMD_SETMUL);
+    idewait(0);
+    outb(0x1f7, IDE_CMD_IDENTIFY);
+    if(idewait(1) >= 0){
+      insl(0x1f0, id, sizeof(id)/4);
+      idesize[i] = id[60] | (id[61] << 16);
+    }
+  }
+
   // Switch back to disk 0.
   outb(0x1f6, 0xe0 | (0<<4));
+
+#ifdef IDEDMA
+  // BAR4 of a PCI IDE controller holds its bus-master registers,
+  // if it has any.
+  if(pcifindclass(PCI_CLASS_STORAGE, PCI_SUBCLASS_IDE, &pd) == 0 &&
+     (pd.bar[4] & 1) && (pd.bar[4] & ~3)){
+    pcienable(&pd, PCI_CMD_IO | PCI_CMD_MASTER);
+    bmide = pd.bar[4] & ~3;
+    cprintf("ide: bus-master DMA at port 0x%x\n", bmide);
+  }
+#endif
 }
 
-// Start the request for b.  Caller must hold idelock.
+// Start the request for b, taking in as many of the bufs queued
+// behind it as continue it on disk.  Caller must hold idelock.
 static void
 idestart(struct buf *b)
 {
+  struct buf *q;
+  int i, n;
+
   if(b == 0)
     panic("idestart");
-  if(b->blockno >= FSSIZE)
-    panic("incorrect blockno");
   int sector_per_block =  BSIZE/SECTOR_SIZE;
   int sector = b->blockno * sector_per_block;
-  int read_cmd = (sector_per_block == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
-  int write_cmd = (sector_per_block == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int max_sector = bmide ? IDE_MAXDMA : IDE_MULT;
+
+  if(idesize[b->dev&1] && sector + sector_per_block > idesize[b->dev&1])
+    panic("incorrect blockno");
+
+  if (sector_per_block > max_sector) panic("idestart");
+
+  n = 1;
+  for(q = b; q->qnext && (n+1)*sector_per_block <= max_sector; q = q->qnext, n++){
+    if(q->qnext->dev != b->dev || q->qnext->blockno != q->blockno + 1 ||
+       (q->qnext->flags & B_DIRTY) != (b->flags & B_DIRTY))
+      break;
+  }
+  idencluster = n;
+  idepos = q->blockno;
+  int nsector = n * sector_per_block;
+  int read_cmd = (nsector == 1) ? IDE_CMD_READ :  IDE_CMD_RDMUL;
+  int write_cmd = (nsector == 1) ? IDE_CMD_WRITE : IDE_CMD_WRMUL;
+  int bm_dir = (b->flags & B_DIRTY) ? 0 : BM_READ;
 
-  if (sector_per_block > 7) panic("idestart");
+  if(bmide){
+    // One descriptor per buf, scattering the run of blocks
+    // across their data arrays.
+    for(q = b, i = 0; i < n; q = q->qnext, i++){
+      prdt[i].addr = V2P(q->data);
+      prdt[i].len = BSIZE;
+      prdt[i].flags = (i == n-1) ? PRD_EOT : 0;
+    }
+    outl(bmide + BM_PRDT, V2P(prdt));
+    outb(bmide + BM_CMD, bm_dir);
+    outb(bmide + BM_STATUS, inb(bmide + BM_STATUS) | BM_ERR | BM_INTR);
+    read_cmd = IDE_CMD_RDDMA;
+    write_cmd = IDE_CMD_WRDMA;
+  }
 
   idewait(0);
   outb(0x3f6, 0);  // generate interrupt
-  outb(0x1f2, sector_per_block);  // number of sectors
+  outb(0x1f2, nsector);  // number of sectors
   outb(0x1f3, sector & 0xff);
   outb(0x1f4, (sector >> 8) & 0xff);
   outb(0x1f5, (sector >> 16) & 0xff);
   outb(0x1f6, 0xe0 | ((b->dev&1)<<4) | ((sector>>24)&0x0f));
-  if(b->flags & B_DIRTY){
+  if(bmide){
+    outb(0x1f7, (b->flags & B_DIRTY) ? write_cmd : read_cmd);
+    outb(bmide + BM_CMD, bm_dir | BM_START);
+  } else if(b->flags & B_DIRTY){
     outb(0x1f7, write_cmd);
-    outsl(0x1f0, b->data, BSIZE/4);
+    for(q = b; n > 0; q = q->qnext, n--)
+      outsl(0x1f0, q->data, BSIZE/4);
   } else {
     outb(0x1f7, read_cmd);
   }
@@ -104,65 +241,277 @@ void
 ideintr(void)
 {
   struct buf *b;
+  int i, pio, err;
+  uint now, st;
 
-  // First queued buffer is the active request.
+  // First queued buffers are the active request.
   acquire(&idelock);
 
   if((b = idequeue) == 0){
     release(&idelock);
     return;
   }
-  idequeue = b->qnext;
+  if(bmide){
+    // Stop the engine; the data is already in place unless
+    // the engine or the drive reports an error.
+    st = inb(bmide + BM_STATUS);
+    outb(bmide + BM_CMD, 0);
+    outb(bmide + BM_STATUS, st | BM_ERR | BM_INTR);
+    err = idewait(1) < 0 || (st & BM_ERR);
+    pio = 0;
+  } else {
+    err = idewait(1) < 0;
+    pio = !(b->flags & B_DIRTY) && !err;
+  }
 
-  // Read data if needed.
-  if(!(b->flags & B_DIRTY) && idewait(1) >= 0)
-    insl(0x1f0, b->data, BSIZE/4);
+  // Leave the bufs queued and start the request again, with PIO
+  // if it was DMA that failed.
+  if(err){
+    if(bmide){
+      cprintf("ide: DMA error, falling back to PIO\n");
+      bmide = 0;
+    } else if(++ideerrors > IDE_MAXRETRY)
+      panic("ide: disk error");
+    idencluster = 0;
+    idenext();
+    release(&idelock);
+    return;
+  }
+  ideerrors = 0;
+  nintrs++;
+  nblocks += idencluster;
+  now = lapicusecs();
 
-  // Wake process waiting for this buf.
-  b->flags |= B_VALID;
-  b->flags &= ~B_DIRTY;
-  wakeup(b);
+  for(i = 0; i < idencluster; i++){
+    b = idequeue;
+    idequeue = b->qnext;
+    iostat.latency[histbucket((now - b->qtime) >> 5)]++;
+
+    // Read data if needed.
+    if(pio)
+      insl(0x1f0, b->data, BSIZE/4);
+
+    // Wake process waiting for this buf, or release it if nobody
+    // is waiting.
+    b->flags |= B_VALID;
+    b->flags &= ~B_DIRTY;
+    if(b->flags & B_ASYNC)
+      bdone(b);
+    else
+      wakeup(b);
+  }
 
   // Start disk on next buf in queue.
-  if(idequeue != 0)
-    idestart(idequeue);
+  idencluster = 0;
+  idenext();
 
   release(&idelock);
 }
 
 //PAGEBREAK!
-// Sync buf with disk.
-// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
-// Else if B_VALID is not set, read buf from disk, set B_VALID.
-void
-iderw(struct buf *b)
+static void
+idecheck(struct buf *b)
 {
-  struct buf **pp;
-
   if(!holdingsleep(&b->lock))
     panic("iderw: buf not locked");
   if((b->flags & (B_VALID|B_DIRTY)) == B_VALID)
     panic("iderw: nothing to do");
   if(b->dev != 0 && !havedisk1)
     panic("iderw: ide disk 1 not present");
+}
 
-  acquire(&idelock);  //DOC:acquire-lock
+// Return the histogram bucket for v: floor(log2(v)), but no more
+// than the last bucket.
+static int
+histbucket(uint v)
+{
+  int k;
 
-  // Append b to idequeue.
-  b->qnext = 0;
-  for(pp=&idequeue; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
+  for(k = 0; v > 1 && k < NIOHIST-1; k++)
+    v >>= 1;
+  return k;
+}
+
+// Append b to the queue at pp.
+static void
+fifoadd(struct buf **pp, struct buf *b)
+{
+  for(; *pp; pp=&(*pp)->qnext)  //DOC:insert-queue
     ;
   *pp = b;
+}
+
+// Would the head, sweeping up from idepos and then starting again
+// from block 0, reach a before b?
+static int
+cscanbefore(struct buf *a, struct buf *b)
+{
+  int awrap, bwrap;
+
+  awrap = a->blockno < idepos;
+  bwrap = b->blockno < idepos;
+  if(awrap != bwrap)
+    return bwrap;
+  return a->blockno < b->blockno;
+}
+
+// Insert b into the queue at pp, which is kept in the order of a
+// one-way sweep, so that adjacent blocks end up next to each other
+// and can go out as one command.
+static void
+cscanadd(struct buf **pp, struct buf *b)
+{
+  for(; *pp && !cscanbefore(b, *pp); pp=&(*pp)->qnext)
+    ;
+  b->qnext = *pp;
+  *pp = b;
+}
+
+// If the oldest request has waited longer than IOMAXWAIT, carry on
+// the sweep from it.  The queue is a rotation of the sorted order,
+// so rotating it again to start at the old request keeps it one.
+static void
+deadline(void)
+{
+  struct buf **pp, **oldest;
+  uint now;
+
+  now = lapicusecs();
+  oldest = &idequeue;
+  for(pp = &idequeue; *pp; pp = &(*pp)->qnext)
+    if(now - (*pp)->qtime > now - (*oldest)->qtime)
+      oldest = pp;
+  if(oldest == &idequeue || now - (*oldest)->qtime <= IOMAXWAIT*1000)
+    return;
+  for(pp = oldest; *pp; pp = &(*pp)->qnext)
+    ;
+  *pp = idequeue;
+  idequeue = *oldest;
+  *oldest = 0;
+  iostat.expired++;
+}
+
+// Queue b behind the request in progress, if any.  Caller must
+// hold idelock.
+static void
+ideappend(struct buf *b)
+{
+  struct buf **pp, *q;
+  int i, depth;
+
+  b->qnext = 0;
+  b->qtime = lapicusecs();
+  pp = &idequeue;
+  for(i = 0; i < idencluster; i++)
+    pp = &(*pp)->qnext;
+  iosched->add(pp, b);
+
+  depth = 0;
+  for(q = idequeue; q; q = q->qnext)
+    depth++;
+  iostat.depth[histbucket(depth)]++;
+}
+
+// Start the disk on the head of the queue, if the disk is idle
+// and there is one.  Caller must hold idelock.
+static void
+idenext(void)
+{
+  if(idencluster || idequeue == 0)
+    return;
+  if(iosched->next)
+    iosched->next();
+  idestart(idequeue);
+}
+
+// Sync buf with disk.
+// If B_DIRTY is set, write buf to disk, clear B_DIRTY, set B_VALID.
+// Else if B_VALID is not set, read buf from disk, set B_VALID.
+void
+iderw(struct buf *b)
+{
+  iderwv(b, 0, 0);
+}
+
+// Sync b with disk as iderw does, but first queue the n bufs in
+// async to go right behind it, so that a run of blocks goes out as
+// one command.  The async bufs are not waited for; bdone releases
+// each B_ASYNC one when it is finished, and iderwait waits for the
+// others.  b may be 0.
+void
+iderwv(struct buf *b, struct buf **async, int n)
+{
+  int i;
+
+  if(b == 0 && n == 0)
+    return;
+  if(b)
+    idecheck(b);
+  for(i = 0; i < n; i++)
+    idecheck(async[i]);
+
+  acquire(&idelock);  //DOC:acquire-lock
+
+  if(b)
+    ideappend(b);
+  for(i = 0; i < n; i++)
+    ideappend(async[i]);
 
   // Start disk if necessary.
-  if(idequeue == b)
-    idestart(b);
+  idenext();
 
   // Wait for request to finish.
-  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+  while(b && (b->flags & (B_VALID|B_DIRTY)) != B_VALID){
     sleep(b, &idelock);
   }
 
 
   release(&idelock);
 }
+
+// Wait for the disk to finish with b, which iderwv queued
+// without B_ASYNC.
+void
+iderwait(struct buf *b)
+{
+  acquire(&idelock);
+  while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &idelock);
+  release(&idelock);
+}
+
+// Add up the disk commands completed and the blocks they moved.
+void
+idestat(struct bcstat *st)
+{
+  acquire(&idelock);
+  st->diskintrs = nintrs;
+  st->diskblocks = nblocks;
+  release(&idelock);
+}
+
+// Switch to disk scheduling policy IOSCHED_FIFO or IOSCHED_CSCAN,
+// for requests queued from now on.  Returns the previous policy.
+int
+idesetsched(int policy)
+{
+  int old;
+
+  if(policy != IOSCHED_FIFO && policy != IOSCHED_CSCAN)
+    return -1;
+  acquire(&idelock);
+  old = iosched - ioscheds;
+  iosched = &ioscheds[policy];
+  release(&idelock);
+  return old;
+}
+
+// Copy out the queue depth and latency histograms.
+void
+ideiostat(struct iostat *st)
+{
+  acquire(&idelock);
+  *st = iostat;
+  st->policy = iosched - ioscheds;
+  release(&idelock);
+}
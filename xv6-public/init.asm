@@ -0,0 +1,1856 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+   f:	83 ec 08             	sub    $0x8,%esp
+  12:	6a 02                	push   $0x2
+  14:	68 d8 0b 00 00       	push   $0xbd8
+  19:	e8 06 05 00 00       	call   524 <open>
+  1e:	83 c4 10             	add    $0x10,%esp
+  21:	85 c0                	test   %eax,%eax
+  23:	0f 88 9f 00 00 00    	js     c8 <main+0xc8>
+    mknod("console", 1, 1);
+    open("console", O_RDWR);
+  }
+  dup(0);  // stdout
+  29:	83 ec 0c             	sub    $0xc,%esp
+  2c:	6a 00                	push   $0x0
+  2e:	e8 29 05 00 00       	call   55c <dup>
+  dup(0);  // stderr
+  33:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  3a:	e8 1d 05 00 00       	call   55c <dup>
+  3f:	83 c4 10             	add    $0x10,%esp
+  42:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  48:	83 ec 08             	sub    $0x8,%esp
+  4b:	68 e0 0b 00 00       	push   $0xbe0
+  50:	6a 01                	push   $0x1
+  52:	e8 99 06 00 00       	call   6f0 <printf>
+    pid = fork();
+  57:	e8 80 04 00 00       	call   4dc <fork>
+    if(pid < 0){
+  5c:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  5f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+  61:	85 c0                	test   %eax,%eax
+  63:	78 2c                	js     91 <main+0x91>
+      printf(1, "init: fork failed\n");
+      exit();
+    }
+    if(pid == 0){
+  65:	74 3d                	je     a4 <main+0xa4>
+  67:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  6e:	66 90                	xchg   %ax,%ax
+      exec("sh", argv);
+      printf(1, "init: exec sh failed\n");
+      exit();
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+  70:	e8 77 04 00 00       	call   4ec <wait>
+  75:	85 c0                	test   %eax,%eax
+  77:	78 cf                	js     48 <main+0x48>
+  79:	39 c3                	cmp    %eax,%ebx
+  7b:	74 cb                	je     48 <main+0x48>
+      printf(1, "zombie!\n");
+  7d:	83 ec 08             	sub    $0x8,%esp
+  80:	68 1f 0c 00 00       	push   $0xc1f
+  85:	6a 01                	push   $0x1
+  87:	e8 64 06 00 00       	call   6f0 <printf>
+  8c:	83 c4 10             	add    $0x10,%esp
+  8f:	eb df                	jmp    70 <main+0x70>
+      printf(1, "init: fork failed\n");
+  91:	53                   	push   %ebx
+  92:	53                   	push   %ebx
+  93:	68 f3 0b 00 00       	push   $0xbf3
+  98:	6a 01                	push   $0x1
+  9a:	e8 51 06 00 00       	call   6f0 <printf>
+      exit();
+  9f:	e8 40 04 00 00       	call   4e4 <exit>
+      exec("sh", argv);
+  a4:	50                   	push   %eax
+  a5:	50                   	push   %eax
+  a6:	68 10 11 00 00       	push   $0x1110
+  ab:	68 06 0c 00 00       	push   $0xc06
+  b0:	e8 67 04 00 00       	call   51c <exec>
+      printf(1, "init: exec sh failed\n");
+  b5:	5a                   	pop    %edx
+  b6:	59                   	pop    %ecx
+  b7:	68 09 0c 00 00       	push   $0xc09
+  bc:	6a 01                	push   $0x1
+  be:	e8 2d 06 00 00       	call   6f0 <printf>
+      exit();
+  c3:	e8 1c 04 00 00       	call   4e4 <exit>
+    mknod("console", 1, 1);
+  c8:	50                   	push   %eax
+  c9:	6a 01                	push   $0x1
+  cb:	6a 01                	push   $0x1
+  cd:	68 d8 0b 00 00       	push   $0xbd8
+  d2:	e8 55 04 00 00       	call   52c <mknod>
+    open("console", O_RDWR);
+  d7:	58                   	pop    %eax
+  d8:	5a                   	pop    %edx
+  d9:	6a 02                	push   $0x2
+  db:	68 d8 0b 00 00       	push   $0xbd8
+  e0:	e8 3f 04 00 00       	call   524 <open>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	e9 3c ff ff ff       	jmp    29 <main+0x29>
+  ed:	66 90                	xchg   %ax,%ax
+  ef:	90                   	nop
+
+000000f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  f1:	31 c0                	xor    %eax,%eax
+{
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 100:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 104:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 107:	83 c0 01             	add    $0x1,%eax
+ 10a:	84 d2                	test   %dl,%dl
+ 10c:	75 f2                	jne    100 <strcpy+0x10>
+    ;
+  return os;
+}
+ 10e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 111:	89 c8                	mov    %ecx,%eax
+ 113:	c9                   	leave
+ 114:	c3                   	ret
+ 115:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000120 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	53                   	push   %ebx
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+ 127:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 12a:	0f b6 02             	movzbl (%edx),%eax
+ 12d:	84 c0                	test   %al,%al
+ 12f:	75 17                	jne    148 <strcmp+0x28>
+ 131:	eb 3a                	jmp    16d <strcmp+0x4d>
+ 133:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 137:	90                   	nop
+ 138:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 13c:	83 c2 01             	add    $0x1,%edx
+ 13f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 142:	84 c0                	test   %al,%al
+ 144:	74 1a                	je     160 <strcmp+0x40>
+    p++, q++;
+ 146:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 148:	0f b6 19             	movzbl (%ecx),%ebx
+ 14b:	38 c3                	cmp    %al,%bl
+ 14d:	74 e9                	je     138 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 14f:	29 d8                	sub    %ebx,%eax
+}
+ 151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 154:	c9                   	leave
+ 155:	c3                   	ret
+ 156:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 15d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 160:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 164:	31 c0                	xor    %eax,%eax
+ 166:	29 d8                	sub    %ebx,%eax
+}
+ 168:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16b:	c9                   	leave
+ 16c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 16d:	0f b6 19             	movzbl (%ecx),%ebx
+ 170:	31 c0                	xor    %eax,%eax
+ 172:	eb db                	jmp    14f <strcmp+0x2f>
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 186:	80 3a 00             	cmpb   $0x0,(%edx)
+ 189:	74 15                	je     1a0 <strlen+0x20>
+ 18b:	31 c0                	xor    %eax,%eax
+ 18d:	8d 76 00             	lea    0x0(%esi),%esi
+ 190:	83 c0 01             	add    $0x1,%eax
+ 193:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 197:	89 c1                	mov    %eax,%ecx
+ 199:	75 f5                	jne    190 <strlen+0x10>
+    ;
+  return n;
+}
+ 19b:	89 c8                	mov    %ecx,%eax
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+ 19f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 1a0:	31 c9                	xor    %ecx,%ecx
+}
+ 1a2:	5d                   	pop    %ebp
+ 1a3:	89 c8                	mov    %ecx,%eax
+ 1a5:	c3                   	ret
+ 1a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000001b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	57                   	push   %edi
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 1b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 1ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1bd:	89 d7                	mov    %edx,%edi
+ 1bf:	fc                   	cld
+ 1c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 1c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 1c5:	89 d0                	mov    %edx,%eax
+ 1c7:	c9                   	leave
+ 1c8:	c3                   	ret
+ 1c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 1d0:	55                   	push   %ebp
+ 1d1:	89 e5                	mov    %esp,%ebp
+ 1d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 1da:	0f b6 10             	movzbl (%eax),%edx
+ 1dd:	84 d2                	test   %dl,%dl
+ 1df:	75 12                	jne    1f3 <strchr+0x23>
+ 1e1:	eb 1d                	jmp    200 <strchr+0x30>
+ 1e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1e7:	90                   	nop
+ 1e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 1ec:	83 c0 01             	add    $0x1,%eax
+ 1ef:	84 d2                	test   %dl,%dl
+ 1f1:	74 0d                	je     200 <strchr+0x30>
+    if(*s == c)
+ 1f3:	38 d1                	cmp    %dl,%cl
+ 1f5:	75 f1                	jne    1e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 1f7:	5d                   	pop    %ebp
+ 1f8:	c3                   	ret
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 200:	31 c0                	xor    %eax,%eax
+}
+ 202:	5d                   	pop    %ebp
+ 203:	c3                   	ret
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	57                   	push   %edi
+ 214:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 215:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 218:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 219:	31 db                	xor    %ebx,%ebx
+{
+ 21b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 21e:	eb 27                	jmp    247 <gets+0x37>
+    cc = read(0, &c, 1);
+ 220:	83 ec 04             	sub    $0x4,%esp
+ 223:	6a 01                	push   $0x1
+ 225:	56                   	push   %esi
+ 226:	6a 00                	push   $0x0
+ 228:	e8 cf 02 00 00       	call   4fc <read>
+    if(cc < 1)
+ 22d:	83 c4 10             	add    $0x10,%esp
+ 230:	85 c0                	test   %eax,%eax
+ 232:	7e 1d                	jle    251 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 234:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 238:	8b 55 08             	mov    0x8(%ebp),%edx
+ 23b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 23f:	3c 0a                	cmp    $0xa,%al
+ 241:	74 10                	je     253 <gets+0x43>
+ 243:	3c 0d                	cmp    $0xd,%al
+ 245:	74 0c                	je     253 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 247:	89 df                	mov    %ebx,%edi
+ 249:	83 c3 01             	add    $0x1,%ebx
+ 24c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 24f:	7c cf                	jl     220 <gets+0x10>
+ 251:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 253:	8b 45 08             	mov    0x8(%ebp),%eax
+ 256:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 25a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25d:	5b                   	pop    %ebx
+ 25e:	5e                   	pop    %esi
+ 25f:	5f                   	pop    %edi
+ 260:	5d                   	pop    %ebp
+ 261:	c3                   	ret
+ 262:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 269:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	56                   	push   %esi
+ 274:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 275:	83 ec 08             	sub    $0x8,%esp
+ 278:	6a 00                	push   $0x0
+ 27a:	ff 75 08             	push   0x8(%ebp)
+ 27d:	e8 a2 02 00 00       	call   524 <open>
+  if(fd < 0)
+ 282:	83 c4 10             	add    $0x10,%esp
+ 285:	85 c0                	test   %eax,%eax
+ 287:	78 27                	js     2b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 289:	83 ec 08             	sub    $0x8,%esp
+ 28c:	ff 75 0c             	push   0xc(%ebp)
+ 28f:	89 c3                	mov    %eax,%ebx
+ 291:	50                   	push   %eax
+ 292:	e8 a5 02 00 00       	call   53c <fstat>
+  close(fd);
+ 297:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 29a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 29c:	e8 6b 02 00 00       	call   50c <close>
+  return r;
+ 2a1:	83 c4 10             	add    $0x10,%esp
+}
+ 2a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 2a7:	89 f0                	mov    %esi,%eax
+ 2a9:	5b                   	pop    %ebx
+ 2aa:	5e                   	pop    %esi
+ 2ab:	5d                   	pop    %ebp
+ 2ac:	c3                   	ret
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 2b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 2b5:	eb ed                	jmp    2a4 <stat+0x34>
+ 2b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2be:	66 90                	xchg   %ax,%ax
+
+000002c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+ 2c3:	53                   	push   %ebx
+ 2c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 2c7:	0f be 02             	movsbl (%edx),%eax
+ 2ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 2cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 2d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 2d5:	77 1e                	ja     2f5 <atoi+0x35>
+ 2d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 2e0:	83 c2 01             	add    $0x1,%edx
+ 2e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 2e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 2ea:	0f be 02             	movsbl (%edx),%eax
+ 2ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 2f0:	80 fb 09             	cmp    $0x9,%bl
+ 2f3:	76 eb                	jbe    2e0 <atoi+0x20>
+  return n;
+}
+ 2f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f8:	89 c8                	mov    %ecx,%eax
+ 2fa:	c9                   	leave
+ 2fb:	c3                   	ret
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	57                   	push   %edi
+ 304:	56                   	push   %esi
+ 305:	8b 45 10             	mov    0x10(%ebp),%eax
+ 308:	8b 55 08             	mov    0x8(%ebp),%edx
+ 30b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 30e:	85 c0                	test   %eax,%eax
+ 310:	7e 13                	jle    325 <memmove+0x25>
+ 312:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 314:	89 d7                	mov    %edx,%edi
+ 316:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 320:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 321:	39 f8                	cmp    %edi,%eax
+ 323:	75 fb                	jne    320 <memmove+0x20>
+  return vdst;
+}
+ 325:	5e                   	pop    %esi
+ 326:	89 d0                	mov    %edx,%eax
+ 328:	5f                   	pop    %edi
+ 329:	5d                   	pop    %ebp
+ 32a:	c3                   	ret
+ 32b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 32f:	90                   	nop
+
+00000330 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 33c:	5d                   	pop    %ebp
+ 33d:	c3                   	ret
+ 33e:	66 90                	xchg   %ax,%ax
+
+00000340 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 340:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 341:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 346:	89 e5                	mov    %esp,%ebp
+ 348:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+ 350:	89 c8                	mov    %ecx,%eax
+ 352:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 355:	85 c0                	test   %eax,%eax
+ 357:	75 f7                	jne    350 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 359:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 35e:	5d                   	pop    %ebp
+ 35f:	c3                   	ret
+
+00000360 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 360:	55                   	push   %ebp
+ 361:	31 c0                	xor    %eax,%eax
+ 363:	89 e5                	mov    %esp,%ebp
+ 365:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 368:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 36d:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 370:	5d                   	pop    %ebp
+ 371:	c3                   	ret
+ 372:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000380 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 38c:	5d                   	pop    %ebp
+ 38d:	c3                   	ret
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 390:	55                   	push   %ebp
+ 391:	b8 01 00 00 00       	mov    $0x1,%eax
+ 396:	89 e5                	mov    %esp,%ebp
+ 398:	56                   	push   %esi
+ 399:	53                   	push   %ebx
+ 39a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 39d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 3a0:	85 c0                	test   %eax,%eax
+ 3a2:	74 2d                	je     3d1 <mutex_lock+0x41>
+ 3a4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3a9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 3ac:	85 c0                	test   %eax,%eax
+ 3ae:	74 21                	je     3d1 <mutex_lock+0x41>
+ 3b0:	be 02 00 00 00       	mov    $0x2,%esi
+ 3b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3b8:	83 ec 04             	sub    $0x4,%esp
+ 3bb:	6a 02                	push   $0x2
+ 3bd:	6a 00                	push   $0x0
+ 3bf:	53                   	push   %ebx
+ 3c0:	e8 37 02 00 00       	call   5fc <futex>
+ 3c5:	89 f0                	mov    %esi,%eax
+ 3c7:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 3ca:	83 c4 10             	add    $0x10,%esp
+ 3cd:	85 c0                	test   %eax,%eax
+ 3cf:	75 e7                	jne    3b8 <mutex_lock+0x28>
+}
+ 3d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3d4:	5b                   	pop    %ebx
+ 3d5:	5e                   	pop    %esi
+ 3d6:	5d                   	pop    %ebp
+ 3d7:	c3                   	ret
+ 3d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+
+000003e0 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	31 c0                	xor    %eax,%eax
+ 3e3:	89 e5                	mov    %esp,%ebp
+ 3e5:	83 ec 08             	sub    $0x8,%esp
+ 3e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3eb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 3ee:	83 f8 02             	cmp    $0x2,%eax
+ 3f1:	74 05                	je     3f8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 3f3:	c9                   	leave
+ 3f4:	c3                   	ret
+ 3f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3f8:	83 ec 04             	sub    $0x4,%esp
+ 3fb:	6a 01                	push   $0x1
+ 3fd:	6a 01                	push   $0x1
+ 3ff:	52                   	push   %edx
+ 400:	e8 f7 01 00 00       	call   5fc <futex>
+ 405:	83 c4 10             	add    $0x10,%esp
+}
+ 408:	c9                   	leave
+ 409:	c3                   	ret
+ 40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000410 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 413:	8b 45 08             	mov    0x8(%ebp),%eax
+ 416:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 41c:	5d                   	pop    %ebp
+ 41d:	c3                   	ret
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 420:	55                   	push   %ebp
+ 421:	31 c0                	xor    %eax,%eax
+ 423:	89 e5                	mov    %esp,%ebp
+ 425:	57                   	push   %edi
+ 426:	56                   	push   %esi
+ 427:	53                   	push   %ebx
+ 428:	83 ec 0c             	sub    $0xc,%esp
+ 42b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 42e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 431:	8b 3e                	mov    (%esi),%edi
+ 433:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 436:	83 f8 02             	cmp    $0x2,%eax
+ 439:	74 4d                	je     488 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 43b:	83 ec 04             	sub    $0x4,%esp
+ 43e:	57                   	push   %edi
+ 43f:	6a 00                	push   $0x0
+ 441:	56                   	push   %esi
+ 442:	e8 b5 01 00 00       	call   5fc <futex>
+ 447:	b8 02 00 00 00       	mov    $0x2,%eax
+ 44c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 44f:	83 c4 10             	add    $0x10,%esp
+ 452:	85 c0                	test   %eax,%eax
+ 454:	74 23                	je     479 <cond_wait+0x59>
+ 456:	be 02 00 00 00       	mov    $0x2,%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 460:	83 ec 04             	sub    $0x4,%esp
+ 463:	6a 02                	push   $0x2
+ 465:	6a 00                	push   $0x0
+ 467:	53                   	push   %ebx
+ 468:	e8 8f 01 00 00       	call   5fc <futex>
+ 46d:	89 f0                	mov    %esi,%eax
+ 46f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 472:	83 c4 10             	add    $0x10,%esp
+ 475:	85 c0                	test   %eax,%eax
+ 477:	75 e7                	jne    460 <cond_wait+0x40>
+}
+ 479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 47c:	5b                   	pop    %ebx
+ 47d:	5e                   	pop    %esi
+ 47e:	5f                   	pop    %edi
+ 47f:	5d                   	pop    %ebp
+ 480:	c3                   	ret
+ 481:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 488:	83 ec 04             	sub    $0x4,%esp
+ 48b:	6a 01                	push   $0x1
+ 48d:	6a 01                	push   $0x1
+ 48f:	53                   	push   %ebx
+ 490:	e8 67 01 00 00       	call   5fc <futex>
+ 495:	83 c4 10             	add    $0x10,%esp
+ 498:	eb a1                	jmp    43b <cond_wait+0x1b>
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004a0 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	83 ec 0c             	sub    $0xc,%esp
+ 4a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 4ad:	6a 01                	push   $0x1
+ 4af:	6a 01                	push   $0x1
+ 4b1:	50                   	push   %eax
+ 4b2:	e8 45 01 00 00       	call   5fc <futex>
+}
+ 4b7:	83 c4 10             	add    $0x10,%esp
+ 4ba:	c9                   	leave
+ 4bb:	c3                   	ret
+ 4bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	83 ec 0c             	sub    $0xc,%esp
+ 4c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 4c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 4cd:	6a ff                	push   $0xffffffff
+ 4cf:	6a 01                	push   $0x1
+ 4d1:	50                   	push   %eax
+ 4d2:	e8 25 01 00 00       	call   5fc <futex>
+}
+ 4d7:	83 c4 10             	add    $0x10,%esp
+ 4da:	c9                   	leave
+ 4db:	c3                   	ret
+
+000004dc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 4dc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <exit>:
+SYSCALL(exit)
+ 4e4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <wait>:
+SYSCALL(wait)
+ 4ec:	b8 03 00 00 00       	mov    $0x3,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <pipe>:
+SYSCALL(pipe)
+ 4f4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <read>:
+SYSCALL(read)
+ 4fc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <write>:
+SYSCALL(write)
+ 504:	b8 10 00 00 00       	mov    $0x10,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <close>:
+SYSCALL(close)
+ 50c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <kill>:
+SYSCALL(kill)
+ 514:	b8 06 00 00 00       	mov    $0x6,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <exec>:
+SYSCALL(exec)
+ 51c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <open>:
+SYSCALL(open)
+ 524:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <mknod>:
+SYSCALL(mknod)
+ 52c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <unlink>:
+SYSCALL(unlink)
+ 534:	b8 12 00 00 00       	mov    $0x12,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <fstat>:
+SYSCALL(fstat)
+ 53c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <link>:
+SYSCALL(link)
+ 544:	b8 13 00 00 00       	mov    $0x13,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <mkdir>:
+SYSCALL(mkdir)
+ 54c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <chdir>:
+SYSCALL(chdir)
+ 554:	b8 09 00 00 00       	mov    $0x9,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <dup>:
+SYSCALL(dup)
+ 55c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <getpid>:
+SYSCALL(getpid)
+ 564:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <sbrk>:
+SYSCALL(sbrk)
+ 56c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <sleep>:
+SYSCALL(sleep)
+ 574:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <uptime>:
+SYSCALL(uptime)
+ 57c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 584:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 58c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <wmap>:
+SYSCALL(wmap)
+ 594:	b8 16 00 00 00       	mov    $0x16,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <wunmap>:
+SYSCALL(wunmap)
+ 59c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <wremap>:
+SYSCALL(wremap)
+ 5a4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <wmlock>:
+SYSCALL(wmlock)
+ 5ac:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <wmunlock>:
+SYSCALL(wmunlock)
+ 5b4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <wmapoff>:
+SYSCALL(wmapoff)
+ 5bc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 5c1:	cd 40                	int    $0x40
+ 5c3:	c3                   	ret
+
+000005c4 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 5c4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 5c9:	cd 40                	int    $0x40
+ 5cb:	c3                   	ret
+
+000005cc <setpriority>:
+SYSCALL(setpriority)
+ 5cc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 5d1:	cd 40                	int    $0x40
+ 5d3:	c3                   	ret
+
+000005d4 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 5d4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 5d9:	cd 40                	int    $0x40
+ 5db:	c3                   	ret
+
+000005dc <settickets>:
+SYSCALL(settickets)
+ 5dc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 5e4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <clone>:
+SYSCALL(clone)
+ 5ec:	b8 23 00 00 00       	mov    $0x23,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <join>:
+SYSCALL(join)
+ 5f4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <futex>:
+SYSCALL(futex)
+ 5fc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <setaffinity>:
+SYSCALL(setaffinity)
+ 604:	b8 26 00 00 00       	mov    $0x26,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <getaffinity>:
+SYSCALL(getaffinity)
+ 60c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <bcstat>:
+SYSCALL(bcstat)
+ 614:	b8 29 00 00 00       	mov    $0x29,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <dropcache>:
+SYSCALL(dropcache)
+ 61c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <setiosched>:
+SYSCALL(setiosched)
+ 624:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <iostat>:
+SYSCALL(iostat)
+ 62c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <fsync>:
+SYSCALL(fsync)
+ 634:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 63c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 63d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 642:	cd 40                	int    $0x40
+ 644:	ff e1                	jmp    *%ecx
+ 646:	66 90                	xchg   %ax,%ax
+ 648:	66 90                	xchg   %ax,%ax
+ 64a:	66 90                	xchg   %ax,%ax
+ 64c:	66 90                	xchg   %ax,%ax
+ 64e:	66 90                	xchg   %ax,%ax
+
+00000650 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	57                   	push   %edi
+ 654:	56                   	push   %esi
+ 655:	53                   	push   %ebx
+ 656:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 658:	89 d1                	mov    %edx,%ecx
+{
+ 65a:	83 ec 3c             	sub    $0x3c,%esp
+ 65d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 660:	85 d2                	test   %edx,%edx
+ 662:	0f 89 80 00 00 00    	jns    6e8 <printint+0x98>
+ 668:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 66c:	74 7a                	je     6e8 <printint+0x98>
+    x = -xx;
+ 66e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 670:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 675:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 678:	31 f6                	xor    %esi,%esi
+ 67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 680:	89 c8                	mov    %ecx,%eax
+ 682:	31 d2                	xor    %edx,%edx
+ 684:	89 f7                	mov    %esi,%edi
+ 686:	f7 f3                	div    %ebx
+ 688:	8d 76 01             	lea    0x1(%esi),%esi
+ 68b:	0f b6 92 88 0c 00 00 	movzbl 0xc88(%edx),%edx
+ 692:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 696:	89 ca                	mov    %ecx,%edx
+ 698:	89 c1                	mov    %eax,%ecx
+ 69a:	39 da                	cmp    %ebx,%edx
+ 69c:	73 e2                	jae    680 <printint+0x30>
+  if(neg)
+ 69e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 6a1:	85 c0                	test   %eax,%eax
+ 6a3:	74 07                	je     6ac <printint+0x5c>
+    buf[i++] = '-';
+ 6a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 6aa:	89 f7                	mov    %esi,%edi
+ 6ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 6af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 6b2:	01 df                	add    %ebx,%edi
+ 6b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 6b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 6bb:	83 ec 04             	sub    $0x4,%esp
+ 6be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 6c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 6c4:	6a 01                	push   $0x1
+ 6c6:	50                   	push   %eax
+ 6c7:	56                   	push   %esi
+ 6c8:	e8 37 fe ff ff       	call   504 <write>
+  while(--i >= 0)
+ 6cd:	89 f8                	mov    %edi,%eax
+ 6cf:	83 c4 10             	add    $0x10,%esp
+ 6d2:	83 ef 01             	sub    $0x1,%edi
+ 6d5:	39 d8                	cmp    %ebx,%eax
+ 6d7:	75 df                	jne    6b8 <printint+0x68>
+}
+ 6d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6dc:	5b                   	pop    %ebx
+ 6dd:	5e                   	pop    %esi
+ 6de:	5f                   	pop    %edi
+ 6df:	5d                   	pop    %ebp
+ 6e0:	c3                   	ret
+ 6e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 6e8:	31 c0                	xor    %eax,%eax
+ 6ea:	eb 89                	jmp    675 <printint+0x25>
+ 6ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	57                   	push   %edi
+ 6f4:	56                   	push   %esi
+ 6f5:	53                   	push   %ebx
+ 6f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 6f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 6fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 6ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 702:	83 c6 01             	add    $0x1,%esi
+ 705:	84 db                	test   %bl,%bl
+ 707:	74 67                	je     770 <printf+0x80>
+ 709:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 70c:	31 d2                	xor    %edx,%edx
+ 70e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 711:	eb 34                	jmp    747 <printf+0x57>
+ 713:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 717:	90                   	nop
+ 718:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 71b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 720:	83 f8 25             	cmp    $0x25,%eax
+ 723:	74 18                	je     73d <printf+0x4d>
+  write(fd, &c, 1);
+ 725:	83 ec 04             	sub    $0x4,%esp
+ 728:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 72b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 72e:	6a 01                	push   $0x1
+ 730:	50                   	push   %eax
+ 731:	57                   	push   %edi
+ 732:	e8 cd fd ff ff       	call   504 <write>
+ 737:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 73a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 73d:	0f b6 1e             	movzbl (%esi),%ebx
+ 740:	83 c6 01             	add    $0x1,%esi
+ 743:	84 db                	test   %bl,%bl
+ 745:	74 29                	je     770 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 747:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 74a:	85 d2                	test   %edx,%edx
+ 74c:	74 ca                	je     718 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 74e:	83 fa 25             	cmp    $0x25,%edx
+ 751:	75 ea                	jne    73d <printf+0x4d>
+      if(c == 'd'){
+ 753:	83 f8 25             	cmp    $0x25,%eax
+ 756:	0f 84 24 01 00 00    	je     880 <printf+0x190>
+ 75c:	83 e8 63             	sub    $0x63,%eax
+ 75f:	83 f8 15             	cmp    $0x15,%eax
+ 762:	77 1c                	ja     780 <printf+0x90>
+ 764:	ff 24 85 30 0c 00 00 	jmp    *0xc30(,%eax,4)
+ 76b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 76f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 773:	5b                   	pop    %ebx
+ 774:	5e                   	pop    %esi
+ 775:	5f                   	pop    %edi
+ 776:	5d                   	pop    %ebp
+ 777:	c3                   	ret
+ 778:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77f:	90                   	nop
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 786:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 78a:	6a 01                	push   $0x1
+ 78c:	52                   	push   %edx
+ 78d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 790:	57                   	push   %edi
+ 791:	e8 6e fd ff ff       	call   504 <write>
+ 796:	83 c4 0c             	add    $0xc,%esp
+ 799:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 79c:	6a 01                	push   $0x1
+ 79e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 7a1:	52                   	push   %edx
+ 7a2:	57                   	push   %edi
+ 7a3:	e8 5c fd ff ff       	call   504 <write>
+        putc(fd, c);
+ 7a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7ab:	31 d2                	xor    %edx,%edx
+ 7ad:	eb 8e                	jmp    73d <printf+0x4d>
+ 7af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 7b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 7bb:	8b 13                	mov    (%ebx),%edx
+ 7bd:	6a 00                	push   $0x0
+ 7bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 7c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 7c4:	e8 87 fe ff ff       	call   650 <printint>
+        ap++;
+ 7c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7cf:	31 d2                	xor    %edx,%edx
+ 7d1:	e9 67 ff ff ff       	jmp    73d <printf+0x4d>
+ 7d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 7e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 7e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 7e5:	83 c0 04             	add    $0x4,%eax
+ 7e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 7eb:	85 db                	test   %ebx,%ebx
+ 7ed:	0f 84 9d 00 00 00    	je     890 <printf+0x1a0>
+        while(*s != 0){
+ 7f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 7f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 7f8:	84 c0                	test   %al,%al
+ 7fa:	0f 84 3d ff ff ff    	je     73d <printf+0x4d>
+ 800:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 803:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 806:	89 de                	mov    %ebx,%esi
+ 808:	89 d3                	mov    %edx,%ebx
+ 80a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 810:	83 ec 04             	sub    $0x4,%esp
+ 813:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 816:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 819:	6a 01                	push   $0x1
+ 81b:	53                   	push   %ebx
+ 81c:	57                   	push   %edi
+ 81d:	e8 e2 fc ff ff       	call   504 <write>
+        while(*s != 0){
+ 822:	0f b6 06             	movzbl (%esi),%eax
+ 825:	83 c4 10             	add    $0x10,%esp
+ 828:	84 c0                	test   %al,%al
+ 82a:	75 e4                	jne    810 <printf+0x120>
+      state = 0;
+ 82c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 82f:	31 d2                	xor    %edx,%edx
+ 831:	e9 07 ff ff ff       	jmp    73d <printf+0x4d>
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 840:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 843:	83 ec 0c             	sub    $0xc,%esp
+ 846:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 84b:	8b 13                	mov    (%ebx),%edx
+ 84d:	6a 01                	push   $0x1
+ 84f:	e9 6b ff ff ff       	jmp    7bf <printf+0xcf>
+ 854:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 858:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 85b:	83 ec 04             	sub    $0x4,%esp
+ 85e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 861:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 863:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 866:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 869:	6a 01                	push   $0x1
+ 86b:	52                   	push   %edx
+ 86c:	57                   	push   %edi
+ 86d:	e8 92 fc ff ff       	call   504 <write>
+        ap++;
+ 872:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 875:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 878:	31 d2                	xor    %edx,%edx
+ 87a:	e9 be fe ff ff       	jmp    73d <printf+0x4d>
+ 87f:	90                   	nop
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 886:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 889:	6a 01                	push   $0x1
+ 88b:	e9 11 ff ff ff       	jmp    7a1 <printf+0xb1>
+ 890:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 895:	bb 28 0c 00 00       	mov    $0xc28,%ebx
+ 89a:	e9 61 ff ff ff       	jmp    800 <printf+0x110>
+ 89f:	90                   	nop
+
+000008a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 8a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8a1:	a1 20 11 00 00       	mov    0x1120,%eax
+{
+ 8a6:	89 e5                	mov    %esp,%ebp
+ 8a8:	57                   	push   %edi
+ 8a9:	56                   	push   %esi
+ 8aa:	53                   	push   %ebx
+ 8ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 8ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 8bc:	39 ca                	cmp    %ecx,%edx
+ 8be:	73 30                	jae    8f0 <free+0x50>
+ 8c0:	39 c1                	cmp    %eax,%ecx
+ 8c2:	72 04                	jb     8c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8c4:	39 c2                	cmp    %eax,%edx
+ 8c6:	72 f0                	jb     8b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 8c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 8cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 8ce:	39 f8                	cmp    %edi,%eax
+ 8d0:	74 2e                	je     900 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 8d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 8d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 8d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8db:	39 f1                	cmp    %esi,%ecx
+ 8dd:	74 38                	je     917 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 8df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 8e1:	5b                   	pop    %ebx
+  freep = p;
+ 8e2:	89 15 20 11 00 00    	mov    %edx,0x1120
+}
+ 8e8:	5e                   	pop    %esi
+ 8e9:	5f                   	pop    %edi
+ 8ea:	5d                   	pop    %ebp
+ 8eb:	c3                   	ret
+ 8ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 8f0:	39 c1                	cmp    %eax,%ecx
+ 8f2:	72 d0                	jb     8c4 <free+0x24>
+ 8f4:	eb c2                	jmp    8b8 <free+0x18>
+ 8f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 900:	03 70 04             	add    0x4(%eax),%esi
+ 903:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 906:	8b 02                	mov    (%edx),%eax
+ 908:	8b 00                	mov    (%eax),%eax
+ 90a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 90d:	8b 42 04             	mov    0x4(%edx),%eax
+ 910:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 913:	39 f1                	cmp    %esi,%ecx
+ 915:	75 c8                	jne    8df <free+0x3f>
+    p->s.size += bp->s.size;
+ 917:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 91a:	89 15 20 11 00 00    	mov    %edx,0x1120
+    p->s.size += bp->s.size;
+ 920:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 923:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 926:	89 0a                	mov    %ecx,(%edx)
+}
+ 928:	5b                   	pop    %ebx
+ 929:	5e                   	pop    %esi
+ 92a:	5f                   	pop    %edi
+ 92b:	5d                   	pop    %ebp
+ 92c:	c3                   	ret
+ 92d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000930 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 930:	55                   	push   %ebp
+ 931:	89 e5                	mov    %esp,%ebp
+ 933:	57                   	push   %edi
+ 934:	56                   	push   %esi
+ 935:	53                   	push   %ebx
+ 936:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 939:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 93c:	8b 15 20 11 00 00    	mov    0x1120,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 942:	8d 78 07             	lea    0x7(%eax),%edi
+ 945:	c1 ef 03             	shr    $0x3,%edi
+ 948:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 94b:	85 d2                	test   %edx,%edx
+ 94d:	0f 84 8d 00 00 00    	je     9e0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 953:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 955:	8b 48 04             	mov    0x4(%eax),%ecx
+ 958:	39 f9                	cmp    %edi,%ecx
+ 95a:	73 64                	jae    9c0 <malloc+0x90>
+  if(nu < 4096)
+ 95c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 961:	39 df                	cmp    %ebx,%edi
+ 963:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 966:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 96d:	eb 0a                	jmp    979 <malloc+0x49>
+ 96f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 970:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 972:	8b 48 04             	mov    0x4(%eax),%ecx
+ 975:	39 f9                	cmp    %edi,%ecx
+ 977:	73 47                	jae    9c0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 979:	89 c2                	mov    %eax,%edx
+ 97b:	39 05 20 11 00 00    	cmp    %eax,0x1120
+ 981:	75 ed                	jne    970 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 983:	83 ec 0c             	sub    $0xc,%esp
+ 986:	56                   	push   %esi
+ 987:	e8 e0 fb ff ff       	call   56c <sbrk>
+  if(p == (char*)-1)
+ 98c:	83 c4 10             	add    $0x10,%esp
+ 98f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 992:	74 1c                	je     9b0 <malloc+0x80>
+  hp->s.size = nu;
+ 994:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 997:	83 ec 0c             	sub    $0xc,%esp
+ 99a:	83 c0 08             	add    $0x8,%eax
+ 99d:	50                   	push   %eax
+ 99e:	e8 fd fe ff ff       	call   8a0 <free>
+  return freep;
+ 9a3:	8b 15 20 11 00 00    	mov    0x1120,%edx
+      if((p = morecore(nunits)) == 0)
+ 9a9:	83 c4 10             	add    $0x10,%esp
+ 9ac:	85 d2                	test   %edx,%edx
+ 9ae:	75 c0                	jne    970 <malloc+0x40>
+        return 0;
+  }
+}
+ 9b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 9b3:	31 c0                	xor    %eax,%eax
+}
+ 9b5:	5b                   	pop    %ebx
+ 9b6:	5e                   	pop    %esi
+ 9b7:	5f                   	pop    %edi
+ 9b8:	5d                   	pop    %ebp
+ 9b9:	c3                   	ret
+ 9ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 9c0:	39 cf                	cmp    %ecx,%edi
+ 9c2:	74 4c                	je     a10 <malloc+0xe0>
+        p->s.size -= nunits;
+ 9c4:	29 f9                	sub    %edi,%ecx
+ 9c6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 9c9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 9cc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 9cf:	89 15 20 11 00 00    	mov    %edx,0x1120
+}
+ 9d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 9d8:	83 c0 08             	add    $0x8,%eax
+}
+ 9db:	5b                   	pop    %ebx
+ 9dc:	5e                   	pop    %esi
+ 9dd:	5f                   	pop    %edi
+ 9de:	5d                   	pop    %ebp
+ 9df:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 9e0:	c7 05 20 11 00 00 24 	movl   $0x1124,0x1120
+ 9e7:	11 00 00 
+    base.s.size = 0;
+ 9ea:	b8 24 11 00 00       	mov    $0x1124,%eax
+    base.s.ptr = freep = prevp = &base;
+ 9ef:	c7 05 24 11 00 00 24 	movl   $0x1124,0x1124
+ 9f6:	11 00 00 
+    base.s.size = 0;
+ 9f9:	c7 05 28 11 00 00 00 	movl   $0x0,0x1128
+ a00:	00 00 00 
+    if(p->s.size >= nunits){
+ a03:	e9 54 ff ff ff       	jmp    95c <malloc+0x2c>
+ a08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ a10:	8b 08                	mov    (%eax),%ecx
+ a12:	89 0a                	mov    %ecx,(%edx)
+ a14:	eb b9                	jmp    9cf <malloc+0x9f>
+ a16:	66 90                	xchg   %ax,%ax
+ a18:	66 90                	xchg   %ax,%ax
+ a1a:	66 90                	xchg   %ax,%ax
+ a1c:	66 90                	xchg   %ax,%ax
+ a1e:	66 90                	xchg   %ax,%ax
+
+00000a20 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ a20:	55                   	push   %ebp
+ a21:	89 e5                	mov    %esp,%ebp
+ a23:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ a26:	8b 45 08             	mov    0x8(%ebp),%eax
+ a29:	c1 e0 04             	shl    $0x4,%eax
+ a2c:	ff b0 6c 11 00 00    	push   0x116c(%eax)
+ a32:	05 60 11 00 00       	add    $0x1160,%eax
+ a37:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ a3a:	e8 a5 fa ff ff       	call   4e4 <exit>
+ a3f:	90                   	nop
+
+00000a40 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ a40:	55                   	push   %ebp
+ a41:	89 e5                	mov    %esp,%ebp
+ a43:	57                   	push   %edi
+ a44:	56                   	push   %esi
+ a45:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ a46:	31 db                	xor    %ebx,%ebx
+{
+ a48:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ a4b:	68 40 11 00 00       	push   $0x1140
+ a50:	e8 eb f8 ff ff       	call   340 <lock_acquire>
+ a55:	83 c4 10             	add    $0x10,%esp
+ a58:	eb 12                	jmp    a6c <thread_create+0x2c>
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ a60:	83 c3 01             	add    $0x1,%ebx
+ a63:	83 fb 40             	cmp    $0x40,%ebx
+ a66:	0f 84 c4 00 00 00    	je     b30 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ a6c:	89 de                	mov    %ebx,%esi
+ a6e:	c1 e6 04             	shl    $0x4,%esi
+ a71:	8b 96 60 11 00 00    	mov    0x1160(%esi),%edx
+ a77:	85 d2                	test   %edx,%edx
+ a79:	75 e5                	jne    a60 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ a7b:	83 ec 0c             	sub    $0xc,%esp
+ a7e:	68 00 20 00 00       	push   $0x2000
+ a83:	e8 a8 fe ff ff       	call   930 <malloc>
+ a88:	83 c4 10             	add    $0x10,%esp
+ a8b:	85 c0                	test   %eax,%eax
+ a8d:	0f 84 9d 00 00 00    	je     b30 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ a93:	89 86 64 11 00 00    	mov    %eax,0x1164(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ a99:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ a9e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ aa1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ aa6:	89 86 60 11 00 00    	mov    %eax,0x1160(%esi)
+  threads[i].fn = fn;
+ aac:	8b 45 08             	mov    0x8(%ebp),%eax
+ aaf:	89 86 68 11 00 00    	mov    %eax,0x1168(%esi)
+  threads[i].arg = arg;
+ ab5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ab8:	89 86 6c 11 00 00    	mov    %eax,0x116c(%esi)
+  lock_release(&threadslock);
+ abe:	68 40 11 00 00       	push   $0x1140
+ ac3:	e8 98 f8 ff ff       	call   360 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ ac8:	83 c4 0c             	add    $0xc,%esp
+ acb:	ff b6 60 11 00 00    	push   0x1160(%esi)
+ ad1:	53                   	push   %ebx
+ ad2:	68 20 0a 00 00       	push   $0xa20
+ ad7:	e8 10 fb ff ff       	call   5ec <clone>
+ adc:	83 c4 10             	add    $0x10,%esp
+ adf:	85 c0                	test   %eax,%eax
+ ae1:	78 0d                	js     af0 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ ae3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ ae6:	5b                   	pop    %ebx
+ ae7:	5e                   	pop    %esi
+ ae8:	5f                   	pop    %edi
+ ae9:	5d                   	pop    %ebp
+ aea:	c3                   	ret
+ aeb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ aef:	90                   	nop
+    lock_acquire(&threadslock);
+ af0:	83 ec 0c             	sub    $0xc,%esp
+ af3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ af6:	68 40 11 00 00       	push   $0x1140
+ afb:	e8 40 f8 ff ff       	call   340 <lock_acquire>
+    free(threads[i].block);
+ b00:	58                   	pop    %eax
+ b01:	ff b6 64 11 00 00    	push   0x1164(%esi)
+ b07:	e8 94 fd ff ff       	call   8a0 <free>
+    threads[i].stack = 0;
+ b0c:	c7 86 60 11 00 00 00 	movl   $0x0,0x1160(%esi)
+ b13:	00 00 00 
+    lock_release(&threadslock);
+ b16:	c7 04 24 40 11 00 00 	movl   $0x1140,(%esp)
+ b1d:	e8 3e f8 ff ff       	call   360 <lock_release>
+ b22:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b25:	83 c4 10             	add    $0x10,%esp
+}
+ b28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b2b:	5b                   	pop    %ebx
+ b2c:	5e                   	pop    %esi
+ b2d:	5f                   	pop    %edi
+ b2e:	5d                   	pop    %ebp
+ b2f:	c3                   	ret
+    lock_release(&threadslock);
+ b30:	83 ec 0c             	sub    $0xc,%esp
+ b33:	68 40 11 00 00       	push   $0x1140
+ b38:	e8 23 f8 ff ff       	call   360 <lock_release>
+    return -1;
+ b3d:	83 c4 10             	add    $0x10,%esp
+ b40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ b45:	eb 9c                	jmp    ae3 <thread_create+0xa3>
+ b47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4e:	66 90                	xchg   %ax,%ax
+
+00000b50 <thread_join>:
+
+int
+thread_join(void)
+{
+ b50:	55                   	push   %ebp
+ b51:	89 e5                	mov    %esp,%ebp
+ b53:	56                   	push   %esi
+ b54:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ b55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ b58:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ b5b:	50                   	push   %eax
+ b5c:	e8 93 fa ff ff       	call   5f4 <join>
+ b61:	83 c4 10             	add    $0x10,%esp
+ b64:	85 c0                	test   %eax,%eax
+ b66:	78 69                	js     bd1 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ b68:	83 ec 0c             	sub    $0xc,%esp
+ b6b:	89 c6                	mov    %eax,%esi
+ b6d:	68 40 11 00 00       	push   $0x1140
+ b72:	e8 c9 f7 ff ff       	call   340 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ b77:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ b7a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ b7d:	31 c0                	xor    %eax,%eax
+ b7f:	eb 0f                	jmp    b90 <thread_join+0x40>
+ b81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b88:	83 c0 01             	add    $0x1,%eax
+ b8b:	83 f8 40             	cmp    $0x40,%eax
+ b8e:	74 28                	je     bb8 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ b90:	89 c3                	mov    %eax,%ebx
+ b92:	c1 e3 04             	shl    $0x4,%ebx
+ b95:	39 93 60 11 00 00    	cmp    %edx,0x1160(%ebx)
+ b9b:	75 eb                	jne    b88 <thread_join+0x38>
+      free(threads[i].block);
+ b9d:	83 ec 0c             	sub    $0xc,%esp
+ ba0:	ff b3 64 11 00 00    	push   0x1164(%ebx)
+ ba6:	e8 f5 fc ff ff       	call   8a0 <free>
+      threads[i].stack = 0;
+      break;
+ bab:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ bae:	c7 83 60 11 00 00 00 	movl   $0x0,0x1160(%ebx)
+ bb5:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ bb8:	83 ec 0c             	sub    $0xc,%esp
+ bbb:	68 40 11 00 00       	push   $0x1140
+ bc0:	e8 9b f7 ff ff       	call   360 <lock_release>
+  return pid;
+ bc5:	83 c4 10             	add    $0x10,%esp
+}
+ bc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ bcb:	89 f0                	mov    %esi,%eax
+ bcd:	5b                   	pop    %ebx
+ bce:	5e                   	pop    %esi
+ bcf:	5d                   	pop    %ebp
+ bd0:	c3                   	ret
+    return -1;
+ bd1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ bd6:	eb f0                	jmp    bc8 <thread_join+0x78>
@@ -0,0 +1,2066 @@
+
+_iobench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 04 00 00 00       	mov    $0x4,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	81 ec e8 00 00 00    	sub    $0xe8,%esp
+  struct iostat before, after;
+  int n, p, w, old, start, elapsed;
+
+  n = 4;
+  if(argc > 1)
+  1c:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  1f:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  22:	0f 8f fd 00 00 00    	jg     125 <main+0x125>
+  if(n < 1 || n > 26){
+    printf(2, "usage: iobench [procs]\n");
+    exit();
+  }
+
+  old = setiosched(IOSCHED_FIFO);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  for(p = IOSCHED_FIFO; p <= IOSCHED_CSCAN; p++){
+  2b:	31 f6                	xor    %esi,%esi
+  old = setiosched(IOSCHED_FIFO);
+  2d:	6a 00                	push   $0x0
+  2f:	e8 d0 07 00 00       	call   804 <setiosched>
+  34:	83 c4 10             	add    $0x10,%esp
+  37:	89 85 10 ff ff ff    	mov    %eax,-0xf0(%ebp)
+    setiosched(p);
+  3d:	83 ec 0c             	sub    $0xc,%esp
+    for(w = 0; w < 2; w++){
+  40:	31 db                	xor    %ebx,%ebx
+    setiosched(p);
+  42:	56                   	push   %esi
+  43:	e8 bc 07 00 00       	call   804 <setiosched>
+    for(w = 0; w < 2; w++){
+  48:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%ebp)
+    setiosched(p);
+  4e:	83 c4 10             	add    $0x10,%esp
+      dropcache();
+  51:	e8 a6 07 00 00       	call   7fc <dropcache>
+      iostat(&before);
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	8d 85 18 ff ff ff    	lea    -0xe8(%ebp),%eax
+  5f:	50                   	push   %eax
+  60:	e8 a7 07 00 00       	call   80c <iostat>
+      start = uptime();
+  65:	e8 f2 06 00 00       	call   75c <uptime>
+  6a:	89 c6                	mov    %eax,%esi
+      run(workloads[w], n);
+  6c:	58                   	pop    %eax
+  6d:	5a                   	pop    %edx
+  6e:	57                   	push   %edi
+  6f:	ff 34 9d dc 13 00 00 	push   0x13dc(,%ebx,4)
+  76:	e8 55 01 00 00       	call   1d0 <run>
+      elapsed = uptime() - start;
+  7b:	e8 dc 06 00 00       	call   75c <uptime>
+  80:	29 f0                	sub    %esi,%eax
+  82:	89 c6                	mov    %eax,%esi
+      iostat(&after);
+  84:	8d 45 80             	lea    -0x80(%ebp),%eax
+  87:	89 04 24             	mov    %eax,(%esp)
+  8a:	e8 7d 07 00 00       	call   80c <iostat>
+      printf(1, "iobench: %s, %d x %s: %d ticks, %d expired\n",
+  8f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  92:	83 c4 0c             	add    $0xc,%esp
+  95:	2b 85 7c ff ff ff    	sub    -0x84(%ebp),%eax
+  9b:	50                   	push   %eax
+  9c:	56                   	push   %esi
+  9d:	ff 34 9d dc 13 00 00 	push   0x13dc(,%ebx,4)
+  a4:	57                   	push   %edi
+  a5:	8b 85 14 ff ff ff    	mov    -0xec(%ebp),%eax
+  ab:	ff 34 85 e4 13 00 00 	push   0x13e4(,%eax,4)
+  b2:	68 60 0e 00 00       	push   $0xe60
+  b7:	6a 01                	push   $0x1
+  b9:	e8 12 08 00 00       	call   8d0 <printf>
+             policies[p], n, workloads[w], elapsed,
+             after.expired - before.expired);
+      printhist("depth 1,2,4..", before.depth, after.depth);
+  be:	83 c4 1c             	add    $0x1c,%esp
+  c1:	8d 45 84             	lea    -0x7c(%ebp),%eax
+  c4:	50                   	push   %eax
+  c5:	8d 85 1c ff ff ff    	lea    -0xe4(%ebp),%eax
+  cb:	50                   	push   %eax
+  cc:	68 ff 0d 00 00       	push   $0xdff
+  d1:	e8 8a 00 00 00       	call   160 <printhist>
+      printhist("usecs <64,128,256..", before.latency, after.latency);
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	8d 45 b4             	lea    -0x4c(%ebp),%eax
+  dc:	50                   	push   %eax
+  dd:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  e3:	50                   	push   %eax
+  e4:	68 0d 0e 00 00       	push   $0xe0d
+  e9:	e8 72 00 00 00       	call   160 <printhist>
+    for(w = 0; w < 2; w++){
+  ee:	83 c4 10             	add    $0x10,%esp
+  f1:	85 db                	test   %ebx,%ebx
+  f3:	75 0b                	jne    100 <main+0x100>
+  f5:	bb 01 00 00 00       	mov    $0x1,%ebx
+  fa:	e9 52 ff ff ff       	jmp    51 <main+0x51>
+  ff:	90                   	nop
+  for(p = IOSCHED_FIFO; p <= IOSCHED_CSCAN; p++){
+ 100:	8b b5 14 ff ff ff    	mov    -0xec(%ebp),%esi
+ 106:	85 f6                	test   %esi,%esi
+ 108:	75 07                	jne    111 <main+0x111>
+ 10a:	89 de                	mov    %ebx,%esi
+ 10c:	e9 2c ff ff ff       	jmp    3d <main+0x3d>
+    }
+  }
+  setiosched(old);
+ 111:	8b 85 10 ff ff ff    	mov    -0xf0(%ebp),%eax
+ 117:	83 ec 0c             	sub    $0xc,%esp
+ 11a:	50                   	push   %eax
+ 11b:	e8 e4 06 00 00       	call   804 <setiosched>
+  exit();
+ 120:	e8 9f 05 00 00       	call   6c4 <exit>
+    n = atoi(argv[1]);
+ 125:	83 ec 0c             	sub    $0xc,%esp
+ 128:	ff 70 04             	push   0x4(%eax)
+ 12b:	e8 70 03 00 00       	call   4a0 <atoi>
+  if(n < 1 || n > 26){
+ 130:	83 c4 10             	add    $0x10,%esp
+    n = atoi(argv[1]);
+ 133:	89 c7                	mov    %eax,%edi
+  if(n < 1 || n > 26){
+ 135:	8d 40 ff             	lea    -0x1(%eax),%eax
+ 138:	83 f8 19             	cmp    $0x19,%eax
+ 13b:	0f 86 e7 fe ff ff    	jbe    28 <main+0x28>
+    printf(2, "usage: iobench [procs]\n");
+ 141:	51                   	push   %ecx
+ 142:	51                   	push   %ecx
+ 143:	68 e7 0d 00 00       	push   $0xde7
+ 148:	6a 02                	push   $0x2
+ 14a:	e8 81 07 00 00       	call   8d0 <printf>
+    exit();
+ 14f:	e8 70 05 00 00       	call   6c4 <exit>
+ 154:	66 90                	xchg   %ax,%ax
+ 156:	66 90                	xchg   %ax,%ax
+ 158:	66 90                	xchg   %ax,%ax
+ 15a:	66 90                	xchg   %ax,%ax
+ 15c:	66 90                	xchg   %ax,%ax
+ 15e:	66 90                	xchg   %ax,%ax
+
+00000160 <printhist>:
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	57                   	push   %edi
+ 164:	56                   	push   %esi
+ 165:	53                   	push   %ebx
+  for(k = 0; k < NIOHIST; k++)
+ 166:	31 db                	xor    %ebx,%ebx
+{
+ 168:	83 ec 10             	sub    $0x10,%esp
+ 16b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+ 16e:	8b 75 10             	mov    0x10(%ebp),%esi
+  printf(1, "  %s:", name);
+ 171:	ff 75 08             	push   0x8(%ebp)
+ 174:	68 b8 0d 00 00       	push   $0xdb8
+ 179:	6a 01                	push   $0x1
+ 17b:	e8 50 07 00 00       	call   8d0 <printf>
+ 180:	83 c4 10             	add    $0x10,%esp
+ 183:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 187:	90                   	nop
+    printf(1, " %d", after[k] - before[k]);
+ 188:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+ 18b:	83 ec 04             	sub    $0x4,%esp
+ 18e:	2b 04 9f             	sub    (%edi,%ebx,4),%eax
+  for(k = 0; k < NIOHIST; k++)
+ 191:	83 c3 01             	add    $0x1,%ebx
+    printf(1, " %d", after[k] - before[k]);
+ 194:	50                   	push   %eax
+ 195:	68 be 0d 00 00       	push   $0xdbe
+ 19a:	6a 01                	push   $0x1
+ 19c:	e8 2f 07 00 00       	call   8d0 <printf>
+  for(k = 0; k < NIOHIST; k++)
+ 1a1:	83 c4 10             	add    $0x10,%esp
+ 1a4:	83 fb 0c             	cmp    $0xc,%ebx
+ 1a7:	75 df                	jne    188 <printhist+0x28>
+  printf(1, "\n");
+ 1a9:	c7 45 0c fd 0d 00 00 	movl   $0xdfd,0xc(%ebp)
+ 1b0:	c7 45 08 01 00 00 00 	movl   $0x1,0x8(%ebp)
+}
+ 1b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ba:	5b                   	pop    %ebx
+ 1bb:	5e                   	pop    %esi
+ 1bc:	5f                   	pop    %edi
+ 1bd:	5d                   	pop    %ebp
+  printf(1, "\n");
+ 1be:	e9 0d 07 00 00       	jmp    8d0 <printf>
+ 1c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000001d0 <run>:
+{
+ 1d0:	55                   	push   %ebp
+  char dir[] = "iobench.a";
+ 1d1:	b9 61 00 00 00       	mov    $0x61,%ecx
+{
+ 1d6:	89 e5                	mov    %esp,%ebp
+ 1d8:	57                   	push   %edi
+ 1d9:	56                   	push   %esi
+ 1da:	53                   	push   %ebx
+ 1db:	31 db                	xor    %ebx,%ebx
+ 1dd:	83 ec 2c             	sub    $0x2c,%esp
+  char *argv[] = { "/usertests", workload, 0 };
+ 1e0:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+ 1e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char dir[] = "iobench.a";
+ 1e6:	c7 45 d2 69 6f 62 65 	movl   $0x65626f69,-0x2e(%ebp)
+ 1ed:	c7 45 d6 6e 63 68 2e 	movl   $0x2e68636e,-0x2a(%ebp)
+ 1f4:	66 89 4d da          	mov    %cx,-0x26(%ebp)
+  char *argv[] = { "/usertests", workload, 0 };
+ 1f8:	c7 45 dc c2 0d 00 00 	movl   $0xdc2,-0x24(%ebp)
+ 1ff:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 202:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  for(i = 0; i < n; i++){
+ 209:	85 f6                	test   %esi,%esi
+ 20b:	7f 14                	jg     221 <run+0x51>
+ 20d:	e9 99 00 00 00       	jmp    2ab <run+0xdb>
+ 212:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+ 218:	8d 43 01             	lea    0x1(%ebx),%eax
+ 21b:	39 c6                	cmp    %eax,%esi
+ 21d:	74 51                	je     270 <run+0xa0>
+ 21f:	89 c3                	mov    %eax,%ebx
+    if(fork() == 0){
+ 221:	e8 96 04 00 00       	call   6bc <fork>
+ 226:	85 c0                	test   %eax,%eax
+ 228:	75 ee                	jne    218 <run+0x48>
+      dir[8] = 'a' + i;
+ 22a:	83 c3 61             	add    $0x61,%ebx
+      mkdir(dir);
+ 22d:	83 ec 0c             	sub    $0xc,%esp
+      dir[8] = 'a' + i;
+ 230:	88 5d da             	mov    %bl,-0x26(%ebp)
+      mkdir(dir);
+ 233:	8d 5d d2             	lea    -0x2e(%ebp),%ebx
+ 236:	53                   	push   %ebx
+ 237:	e8 f0 04 00 00       	call   72c <mkdir>
+      if(chdir(dir) < 0){
+ 23c:	89 1c 24             	mov    %ebx,(%esp)
+ 23f:	e8 f0 04 00 00       	call   734 <chdir>
+ 244:	83 c4 10             	add    $0x10,%esp
+ 247:	85 c0                	test   %eax,%eax
+ 249:	78 6d                	js     2b8 <run+0xe8>
+      exec(argv[0], argv);
+ 24b:	83 ec 08             	sub    $0x8,%esp
+ 24e:	8d 45 dc             	lea    -0x24(%ebp),%eax
+ 251:	50                   	push   %eax
+ 252:	ff 75 dc             	push   -0x24(%ebp)
+ 255:	e8 a2 04 00 00       	call   6fc <exec>
+      printf(2, "iobench: exec usertests failed\n");
+ 25a:	58                   	pop    %eax
+ 25b:	5a                   	pop    %edx
+ 25c:	68 40 0e 00 00       	push   $0xe40
+ 261:	6a 02                	push   $0x2
+ 263:	e8 68 06 00 00       	call   8d0 <printf>
+      exit();
+ 268:	e8 57 04 00 00       	call   6c4 <exit>
+ 26d:	8d 76 00             	lea    0x0(%esi),%esi
+  for(i = 0; i < n; i++)
+ 270:	31 f6                	xor    %esi,%esi
+ 272:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+ 278:	e8 4f 04 00 00       	call   6cc <wait>
+  for(i = 0; i < n; i++)
+ 27d:	89 f0                	mov    %esi,%eax
+ 27f:	83 c6 01             	add    $0x1,%esi
+ 282:	39 c3                	cmp    %eax,%ebx
+ 284:	75 f2                	jne    278 <run+0xa8>
+  for(i = 0; i < n; i++){
+ 286:	31 f6                	xor    %esi,%esi
+ 288:	8d 7d d2             	lea    -0x2e(%ebp),%edi
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+    dir[8] = 'a' + i;
+ 290:	8d 46 61             	lea    0x61(%esi),%eax
+    unlink(dir);
+ 293:	83 ec 0c             	sub    $0xc,%esp
+    dir[8] = 'a' + i;
+ 296:	88 45 da             	mov    %al,-0x26(%ebp)
+    unlink(dir);
+ 299:	57                   	push   %edi
+ 29a:	e8 75 04 00 00       	call   714 <unlink>
+  for(i = 0; i < n; i++){
+ 29f:	89 f0                	mov    %esi,%eax
+ 2a1:	83 c4 10             	add    $0x10,%esp
+ 2a4:	83 c6 01             	add    $0x1,%esi
+ 2a7:	39 c3                	cmp    %eax,%ebx
+ 2a9:	75 e5                	jne    290 <run+0xc0>
+}
+ 2ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ae:	5b                   	pop    %ebx
+ 2af:	5e                   	pop    %esi
+ 2b0:	5f                   	pop    %edi
+ 2b1:	5d                   	pop    %ebp
+ 2b2:	c3                   	ret
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+        printf(2, "iobench: chdir %s failed\n", dir);
+ 2b8:	83 ec 04             	sub    $0x4,%esp
+ 2bb:	53                   	push   %ebx
+ 2bc:	68 cd 0d 00 00       	push   $0xdcd
+ 2c1:	6a 02                	push   $0x2
+ 2c3:	e8 08 06 00 00       	call   8d0 <printf>
+        exit();
+ 2c8:	e8 f7 03 00 00       	call   6c4 <exit>
+ 2cd:	66 90                	xchg   %ax,%ax
+ 2cf:	90                   	nop
+
+000002d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 2d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 2d1:	31 c0                	xor    %eax,%eax
+{
+ 2d3:	89 e5                	mov    %esp,%ebp
+ 2d5:	53                   	push   %ebx
+ 2d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 2dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 2e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 2e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 2e7:	83 c0 01             	add    $0x1,%eax
+ 2ea:	84 d2                	test   %dl,%dl
+ 2ec:	75 f2                	jne    2e0 <strcpy+0x10>
+    ;
+  return os;
+}
+ 2ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f1:	89 c8                	mov    %ecx,%eax
+ 2f3:	c9                   	leave
+ 2f4:	c3                   	ret
+ 2f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	53                   	push   %ebx
+ 304:	8b 55 08             	mov    0x8(%ebp),%edx
+ 307:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 30a:	0f b6 02             	movzbl (%edx),%eax
+ 30d:	84 c0                	test   %al,%al
+ 30f:	75 17                	jne    328 <strcmp+0x28>
+ 311:	eb 3a                	jmp    34d <strcmp+0x4d>
+ 313:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 317:	90                   	nop
+ 318:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 31c:	83 c2 01             	add    $0x1,%edx
+ 31f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 322:	84 c0                	test   %al,%al
+ 324:	74 1a                	je     340 <strcmp+0x40>
+    p++, q++;
+ 326:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 328:	0f b6 19             	movzbl (%ecx),%ebx
+ 32b:	38 c3                	cmp    %al,%bl
+ 32d:	74 e9                	je     318 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 32f:	29 d8                	sub    %ebx,%eax
+}
+ 331:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 334:	c9                   	leave
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 340:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 344:	31 c0                	xor    %eax,%eax
+ 346:	29 d8                	sub    %ebx,%eax
+}
+ 348:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 34b:	c9                   	leave
+ 34c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 34d:	0f b6 19             	movzbl (%ecx),%ebx
+ 350:	31 c0                	xor    %eax,%eax
+ 352:	eb db                	jmp    32f <strcmp+0x2f>
+ 354:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 35f:	90                   	nop
+
+00000360 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 366:	80 3a 00             	cmpb   $0x0,(%edx)
+ 369:	74 15                	je     380 <strlen+0x20>
+ 36b:	31 c0                	xor    %eax,%eax
+ 36d:	8d 76 00             	lea    0x0(%esi),%esi
+ 370:	83 c0 01             	add    $0x1,%eax
+ 373:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 377:	89 c1                	mov    %eax,%ecx
+ 379:	75 f5                	jne    370 <strlen+0x10>
+    ;
+  return n;
+}
+ 37b:	89 c8                	mov    %ecx,%eax
+ 37d:	5d                   	pop    %ebp
+ 37e:	c3                   	ret
+ 37f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 380:	31 c9                	xor    %ecx,%ecx
+}
+ 382:	5d                   	pop    %ebp
+ 383:	89 c8                	mov    %ecx,%eax
+ 385:	c3                   	ret
+ 386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000390 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 397:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 39a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 39d:	89 d7                	mov    %edx,%edi
+ 39f:	fc                   	cld
+ 3a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 3a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 3a5:	89 d0                	mov    %edx,%eax
+ 3a7:	c9                   	leave
+ 3a8:	c3                   	ret
+ 3a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 3ba:	0f b6 10             	movzbl (%eax),%edx
+ 3bd:	84 d2                	test   %dl,%dl
+ 3bf:	75 12                	jne    3d3 <strchr+0x23>
+ 3c1:	eb 1d                	jmp    3e0 <strchr+0x30>
+ 3c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3c7:	90                   	nop
+ 3c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 3cc:	83 c0 01             	add    $0x1,%eax
+ 3cf:	84 d2                	test   %dl,%dl
+ 3d1:	74 0d                	je     3e0 <strchr+0x30>
+    if(*s == c)
+ 3d3:	38 d1                	cmp    %dl,%cl
+ 3d5:	75 f1                	jne    3c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 3d7:	5d                   	pop    %ebp
+ 3d8:	c3                   	ret
+ 3d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 3e0:	31 c0                	xor    %eax,%eax
+}
+ 3e2:	5d                   	pop    %ebp
+ 3e3:	c3                   	ret
+ 3e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+
+000003f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	57                   	push   %edi
+ 3f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3f9:	31 db                	xor    %ebx,%ebx
+{
+ 3fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3fe:	eb 27                	jmp    427 <gets+0x37>
+    cc = read(0, &c, 1);
+ 400:	83 ec 04             	sub    $0x4,%esp
+ 403:	6a 01                	push   $0x1
+ 405:	56                   	push   %esi
+ 406:	6a 00                	push   $0x0
+ 408:	e8 cf 02 00 00       	call   6dc <read>
+    if(cc < 1)
+ 40d:	83 c4 10             	add    $0x10,%esp
+ 410:	85 c0                	test   %eax,%eax
+ 412:	7e 1d                	jle    431 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 414:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 418:	8b 55 08             	mov    0x8(%ebp),%edx
+ 41b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 41f:	3c 0a                	cmp    $0xa,%al
+ 421:	74 10                	je     433 <gets+0x43>
+ 423:	3c 0d                	cmp    $0xd,%al
+ 425:	74 0c                	je     433 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 427:	89 df                	mov    %ebx,%edi
+ 429:	83 c3 01             	add    $0x1,%ebx
+ 42c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 42f:	7c cf                	jl     400 <gets+0x10>
+ 431:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 43a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 43d:	5b                   	pop    %ebx
+ 43e:	5e                   	pop    %esi
+ 43f:	5f                   	pop    %edi
+ 440:	5d                   	pop    %ebp
+ 441:	c3                   	ret
+ 442:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	56                   	push   %esi
+ 454:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 455:	83 ec 08             	sub    $0x8,%esp
+ 458:	6a 00                	push   $0x0
+ 45a:	ff 75 08             	push   0x8(%ebp)
+ 45d:	e8 a2 02 00 00       	call   704 <open>
+  if(fd < 0)
+ 462:	83 c4 10             	add    $0x10,%esp
+ 465:	85 c0                	test   %eax,%eax
+ 467:	78 27                	js     490 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 469:	83 ec 08             	sub    $0x8,%esp
+ 46c:	ff 75 0c             	push   0xc(%ebp)
+ 46f:	89 c3                	mov    %eax,%ebx
+ 471:	50                   	push   %eax
+ 472:	e8 a5 02 00 00       	call   71c <fstat>
+  close(fd);
+ 477:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 47a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 47c:	e8 6b 02 00 00       	call   6ec <close>
+  return r;
+ 481:	83 c4 10             	add    $0x10,%esp
+}
+ 484:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 487:	89 f0                	mov    %esi,%eax
+ 489:	5b                   	pop    %ebx
+ 48a:	5e                   	pop    %esi
+ 48b:	5d                   	pop    %ebp
+ 48c:	c3                   	ret
+ 48d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 490:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 495:	eb ed                	jmp    484 <stat+0x34>
+ 497:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+ 4a3:	53                   	push   %ebx
+ 4a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 4a7:	0f be 02             	movsbl (%edx),%eax
+ 4aa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 4ad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 4b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 4b5:	77 1e                	ja     4d5 <atoi+0x35>
+ 4b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4be:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 4c0:	83 c2 01             	add    $0x1,%edx
+ 4c3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 4c6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 4ca:	0f be 02             	movsbl (%edx),%eax
+ 4cd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 4d0:	80 fb 09             	cmp    $0x9,%bl
+ 4d3:	76 eb                	jbe    4c0 <atoi+0x20>
+  return n;
+}
+ 4d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 4d8:	89 c8                	mov    %ecx,%eax
+ 4da:	c9                   	leave
+ 4db:	c3                   	ret
+ 4dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+ 4e3:	57                   	push   %edi
+ 4e4:	56                   	push   %esi
+ 4e5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 4ee:	85 c0                	test   %eax,%eax
+ 4f0:	7e 13                	jle    505 <memmove+0x25>
+ 4f2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4f4:	89 d7                	mov    %edx,%edi
+ 4f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 500:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 501:	39 f8                	cmp    %edi,%eax
+ 503:	75 fb                	jne    500 <memmove+0x20>
+  return vdst;
+}
+ 505:	5e                   	pop    %esi
+ 506:	89 d0                	mov    %edx,%eax
+ 508:	5f                   	pop    %edi
+ 509:	5d                   	pop    %ebp
+ 50a:	c3                   	ret
+ 50b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 50f:	90                   	nop
+
+00000510 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 513:	8b 45 08             	mov    0x8(%ebp),%eax
+ 516:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 51c:	5d                   	pop    %ebp
+ 51d:	c3                   	ret
+ 51e:	66 90                	xchg   %ax,%ax
+
+00000520 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 520:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 521:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 526:	89 e5                	mov    %esp,%ebp
+ 528:	8b 55 08             	mov    0x8(%ebp),%edx
+ 52b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 52f:	90                   	nop
+ 530:	89 c8                	mov    %ecx,%eax
+ 532:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 535:	85 c0                	test   %eax,%eax
+ 537:	75 f7                	jne    530 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 539:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 53e:	5d                   	pop    %ebp
+ 53f:	c3                   	ret
+
+00000540 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 540:	55                   	push   %ebp
+ 541:	31 c0                	xor    %eax,%eax
+ 543:	89 e5                	mov    %esp,%ebp
+ 545:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 548:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 54d:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 550:	5d                   	pop    %ebp
+ 551:	c3                   	ret
+ 552:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 559:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000560 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 560:	55                   	push   %ebp
+ 561:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 56c:	5d                   	pop    %ebp
+ 56d:	c3                   	ret
+ 56e:	66 90                	xchg   %ax,%ax
+
+00000570 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 570:	55                   	push   %ebp
+ 571:	b8 01 00 00 00       	mov    $0x1,%eax
+ 576:	89 e5                	mov    %esp,%ebp
+ 578:	56                   	push   %esi
+ 579:	53                   	push   %ebx
+ 57a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 57d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 580:	85 c0                	test   %eax,%eax
+ 582:	74 2d                	je     5b1 <mutex_lock+0x41>
+ 584:	b8 02 00 00 00       	mov    $0x2,%eax
+ 589:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 58c:	85 c0                	test   %eax,%eax
+ 58e:	74 21                	je     5b1 <mutex_lock+0x41>
+ 590:	be 02 00 00 00       	mov    $0x2,%esi
+ 595:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 598:	83 ec 04             	sub    $0x4,%esp
+ 59b:	6a 02                	push   $0x2
+ 59d:	6a 00                	push   $0x0
+ 59f:	53                   	push   %ebx
+ 5a0:	e8 37 02 00 00       	call   7dc <futex>
+ 5a5:	89 f0                	mov    %esi,%eax
+ 5a7:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 5aa:	83 c4 10             	add    $0x10,%esp
+ 5ad:	85 c0                	test   %eax,%eax
+ 5af:	75 e7                	jne    598 <mutex_lock+0x28>
+}
+ 5b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 5b4:	5b                   	pop    %ebx
+ 5b5:	5e                   	pop    %esi
+ 5b6:	5d                   	pop    %ebp
+ 5b7:	c3                   	ret
+ 5b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+
+000005c0 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	31 c0                	xor    %eax,%eax
+ 5c3:	89 e5                	mov    %esp,%ebp
+ 5c5:	83 ec 08             	sub    $0x8,%esp
+ 5c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 5cb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 5ce:	83 f8 02             	cmp    $0x2,%eax
+ 5d1:	74 05                	je     5d8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 5d3:	c9                   	leave
+ 5d4:	c3                   	ret
+ 5d5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 5d8:	83 ec 04             	sub    $0x4,%esp
+ 5db:	6a 01                	push   $0x1
+ 5dd:	6a 01                	push   $0x1
+ 5df:	52                   	push   %edx
+ 5e0:	e8 f7 01 00 00       	call   7dc <futex>
+ 5e5:	83 c4 10             	add    $0x10,%esp
+}
+ 5e8:	c9                   	leave
+ 5e9:	c3                   	ret
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005f0 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 5f0:	55                   	push   %ebp
+ 5f1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 5f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5fc:	5d                   	pop    %ebp
+ 5fd:	c3                   	ret
+ 5fe:	66 90                	xchg   %ax,%ax
+
+00000600 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 600:	55                   	push   %ebp
+ 601:	31 c0                	xor    %eax,%eax
+ 603:	89 e5                	mov    %esp,%ebp
+ 605:	57                   	push   %edi
+ 606:	56                   	push   %esi
+ 607:	53                   	push   %ebx
+ 608:	83 ec 0c             	sub    $0xc,%esp
+ 60b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 60e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 611:	8b 3e                	mov    (%esi),%edi
+ 613:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 616:	83 f8 02             	cmp    $0x2,%eax
+ 619:	74 4d                	je     668 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 61b:	83 ec 04             	sub    $0x4,%esp
+ 61e:	57                   	push   %edi
+ 61f:	6a 00                	push   $0x0
+ 621:	56                   	push   %esi
+ 622:	e8 b5 01 00 00       	call   7dc <futex>
+ 627:	b8 02 00 00 00       	mov    $0x2,%eax
+ 62c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 62f:	83 c4 10             	add    $0x10,%esp
+ 632:	85 c0                	test   %eax,%eax
+ 634:	74 23                	je     659 <cond_wait+0x59>
+ 636:	be 02 00 00 00       	mov    $0x2,%esi
+ 63b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 63f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 640:	83 ec 04             	sub    $0x4,%esp
+ 643:	6a 02                	push   $0x2
+ 645:	6a 00                	push   $0x0
+ 647:	53                   	push   %ebx
+ 648:	e8 8f 01 00 00       	call   7dc <futex>
+ 64d:	89 f0                	mov    %esi,%eax
+ 64f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 652:	83 c4 10             	add    $0x10,%esp
+ 655:	85 c0                	test   %eax,%eax
+ 657:	75 e7                	jne    640 <cond_wait+0x40>
+}
+ 659:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 65c:	5b                   	pop    %ebx
+ 65d:	5e                   	pop    %esi
+ 65e:	5f                   	pop    %edi
+ 65f:	5d                   	pop    %ebp
+ 660:	c3                   	ret
+ 661:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 668:	83 ec 04             	sub    $0x4,%esp
+ 66b:	6a 01                	push   $0x1
+ 66d:	6a 01                	push   $0x1
+ 66f:	53                   	push   %ebx
+ 670:	e8 67 01 00 00       	call   7dc <futex>
+ 675:	83 c4 10             	add    $0x10,%esp
+ 678:	eb a1                	jmp    61b <cond_wait+0x1b>
+ 67a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000680 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	83 ec 0c             	sub    $0xc,%esp
+ 686:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 689:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 68d:	6a 01                	push   $0x1
+ 68f:	6a 01                	push   $0x1
+ 691:	50                   	push   %eax
+ 692:	e8 45 01 00 00       	call   7dc <futex>
+}
+ 697:	83 c4 10             	add    $0x10,%esp
+ 69a:	c9                   	leave
+ 69b:	c3                   	ret
+ 69c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000006a0 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	83 ec 0c             	sub    $0xc,%esp
+ 6a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 6a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 6ad:	6a ff                	push   $0xffffffff
+ 6af:	6a 01                	push   $0x1
+ 6b1:	50                   	push   %eax
+ 6b2:	e8 25 01 00 00       	call   7dc <futex>
+}
+ 6b7:	83 c4 10             	add    $0x10,%esp
+ 6ba:	c9                   	leave
+ 6bb:	c3                   	ret
+
+000006bc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 6bc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <exit>:
+SYSCALL(exit)
+ 6c4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <wait>:
+SYSCALL(wait)
+ 6cc:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <pipe>:
+SYSCALL(pipe)
+ 6d4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <read>:
+SYSCALL(read)
+ 6dc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <write>:
+SYSCALL(write)
+ 6e4:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <close>:
+SYSCALL(close)
+ 6ec:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <kill>:
+SYSCALL(kill)
+ 6f4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <exec>:
+SYSCALL(exec)
+ 6fc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <open>:
+SYSCALL(open)
+ 704:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <mknod>:
+SYSCALL(mknod)
+ 70c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <unlink>:
+SYSCALL(unlink)
+ 714:	b8 12 00 00 00       	mov    $0x12,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <fstat>:
+SYSCALL(fstat)
+ 71c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <link>:
+SYSCALL(link)
+ 724:	b8 13 00 00 00       	mov    $0x13,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <mkdir>:
+SYSCALL(mkdir)
+ 72c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <chdir>:
+SYSCALL(chdir)
+ 734:	b8 09 00 00 00       	mov    $0x9,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <dup>:
+SYSCALL(dup)
+ 73c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <getpid>:
+SYSCALL(getpid)
+ 744:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <sbrk>:
+SYSCALL(sbrk)
+ 74c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <sleep>:
+SYSCALL(sleep)
+ 754:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <uptime>:
+SYSCALL(uptime)
+ 75c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 764:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 76c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 771:	cd 40                	int    $0x40
+ 773:	c3                   	ret
+
+00000774 <wmap>:
+SYSCALL(wmap)
+ 774:	b8 16 00 00 00       	mov    $0x16,%eax
+ 779:	cd 40                	int    $0x40
+ 77b:	c3                   	ret
+
+0000077c <wunmap>:
+SYSCALL(wunmap)
+ 77c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 781:	cd 40                	int    $0x40
+ 783:	c3                   	ret
+
+00000784 <wremap>:
+SYSCALL(wremap)
+ 784:	b8 18 00 00 00       	mov    $0x18,%eax
+ 789:	cd 40                	int    $0x40
+ 78b:	c3                   	ret
+
+0000078c <wmlock>:
+SYSCALL(wmlock)
+ 78c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 791:	cd 40                	int    $0x40
+ 793:	c3                   	ret
+
+00000794 <wmunlock>:
+SYSCALL(wmunlock)
+ 794:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <wmapoff>:
+SYSCALL(wmapoff)
+ 79c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7a1:	cd 40                	int    $0x40
+ 7a3:	c3                   	ret
+
+000007a4 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 7a4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7a9:	cd 40                	int    $0x40
+ 7ab:	c3                   	ret
+
+000007ac <setpriority>:
+SYSCALL(setpriority)
+ 7ac:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7b1:	cd 40                	int    $0x40
+ 7b3:	c3                   	ret
+
+000007b4 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 7b4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 7b9:	cd 40                	int    $0x40
+ 7bb:	c3                   	ret
+
+000007bc <settickets>:
+SYSCALL(settickets)
+ 7bc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 7c1:	cd 40                	int    $0x40
+ 7c3:	c3                   	ret
+
+000007c4 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 7c4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 7c9:	cd 40                	int    $0x40
+ 7cb:	c3                   	ret
+
+000007cc <clone>:
+SYSCALL(clone)
+ 7cc:	b8 23 00 00 00       	mov    $0x23,%eax
+ 7d1:	cd 40                	int    $0x40
+ 7d3:	c3                   	ret
+
+000007d4 <join>:
+SYSCALL(join)
+ 7d4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 7d9:	cd 40                	int    $0x40
+ 7db:	c3                   	ret
+
+000007dc <futex>:
+SYSCALL(futex)
+ 7dc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 7e1:	cd 40                	int    $0x40
+ 7e3:	c3                   	ret
+
+000007e4 <setaffinity>:
+SYSCALL(setaffinity)
+ 7e4:	b8 26 00 00 00       	mov    $0x26,%eax
+ 7e9:	cd 40                	int    $0x40
+ 7eb:	c3                   	ret
+
+000007ec <getaffinity>:
+SYSCALL(getaffinity)
+ 7ec:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7f1:	cd 40                	int    $0x40
+ 7f3:	c3                   	ret
+
+000007f4 <bcstat>:
+SYSCALL(bcstat)
+ 7f4:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7f9:	cd 40                	int    $0x40
+ 7fb:	c3                   	ret
+
+000007fc <dropcache>:
+SYSCALL(dropcache)
+ 7fc:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 801:	cd 40                	int    $0x40
+ 803:	c3                   	ret
+
+00000804 <setiosched>:
+SYSCALL(setiosched)
+ 804:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 809:	cd 40                	int    $0x40
+ 80b:	c3                   	ret
+
+0000080c <iostat>:
+SYSCALL(iostat)
+ 80c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 811:	cd 40                	int    $0x40
+ 813:	c3                   	ret
+
+00000814 <fsync>:
+SYSCALL(fsync)
+ 814:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 819:	cd 40                	int    $0x40
+ 81b:	c3                   	ret
+
+0000081c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 81c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 81d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 822:	cd 40                	int    $0x40
+ 824:	ff e1                	jmp    *%ecx
+ 826:	66 90                	xchg   %ax,%ax
+ 828:	66 90                	xchg   %ax,%ax
+ 82a:	66 90                	xchg   %ax,%ax
+ 82c:	66 90                	xchg   %ax,%ax
+ 82e:	66 90                	xchg   %ax,%ax
+
+00000830 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 830:	55                   	push   %ebp
+ 831:	89 e5                	mov    %esp,%ebp
+ 833:	57                   	push   %edi
+ 834:	56                   	push   %esi
+ 835:	53                   	push   %ebx
+ 836:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 838:	89 d1                	mov    %edx,%ecx
+{
+ 83a:	83 ec 3c             	sub    $0x3c,%esp
+ 83d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 840:	85 d2                	test   %edx,%edx
+ 842:	0f 89 80 00 00 00    	jns    8c8 <printint+0x98>
+ 848:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 84c:	74 7a                	je     8c8 <printint+0x98>
+    x = -xx;
+ 84e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 850:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 855:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 858:	31 f6                	xor    %esi,%esi
+ 85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 860:	89 c8                	mov    %ecx,%eax
+ 862:	31 d2                	xor    %edx,%edx
+ 864:	89 f7                	mov    %esi,%edi
+ 866:	f7 f3                	div    %ebx
+ 868:	8d 76 01             	lea    0x1(%esi),%esi
+ 86b:	0f b6 92 ec 0e 00 00 	movzbl 0xeec(%edx),%edx
+ 872:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 876:	89 ca                	mov    %ecx,%edx
+ 878:	89 c1                	mov    %eax,%ecx
+ 87a:	39 da                	cmp    %ebx,%edx
+ 87c:	73 e2                	jae    860 <printint+0x30>
+  if(neg)
+ 87e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 881:	85 c0                	test   %eax,%eax
+ 883:	74 07                	je     88c <printint+0x5c>
+    buf[i++] = '-';
+ 885:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 88a:	89 f7                	mov    %esi,%edi
+ 88c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 88f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 892:	01 df                	add    %ebx,%edi
+ 894:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 898:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 89b:	83 ec 04             	sub    $0x4,%esp
+ 89e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 8a1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 8a4:	6a 01                	push   $0x1
+ 8a6:	50                   	push   %eax
+ 8a7:	56                   	push   %esi
+ 8a8:	e8 37 fe ff ff       	call   6e4 <write>
+  while(--i >= 0)
+ 8ad:	89 f8                	mov    %edi,%eax
+ 8af:	83 c4 10             	add    $0x10,%esp
+ 8b2:	83 ef 01             	sub    $0x1,%edi
+ 8b5:	39 d8                	cmp    %ebx,%eax
+ 8b7:	75 df                	jne    898 <printint+0x68>
+}
+ 8b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8bc:	5b                   	pop    %ebx
+ 8bd:	5e                   	pop    %esi
+ 8be:	5f                   	pop    %edi
+ 8bf:	5d                   	pop    %ebp
+ 8c0:	c3                   	ret
+ 8c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 8c8:	31 c0                	xor    %eax,%eax
+ 8ca:	eb 89                	jmp    855 <printint+0x25>
+ 8cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000008d0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 8d0:	55                   	push   %ebp
+ 8d1:	89 e5                	mov    %esp,%ebp
+ 8d3:	57                   	push   %edi
+ 8d4:	56                   	push   %esi
+ 8d5:	53                   	push   %ebx
+ 8d6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 8d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 8dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 8df:	0f b6 1e             	movzbl (%esi),%ebx
+ 8e2:	83 c6 01             	add    $0x1,%esi
+ 8e5:	84 db                	test   %bl,%bl
+ 8e7:	74 67                	je     950 <printf+0x80>
+ 8e9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 8ec:	31 d2                	xor    %edx,%edx
+ 8ee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8f1:	eb 34                	jmp    927 <printf+0x57>
+ 8f3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8f7:	90                   	nop
+ 8f8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8fb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 900:	83 f8 25             	cmp    $0x25,%eax
+ 903:	74 18                	je     91d <printf+0x4d>
+  write(fd, &c, 1);
+ 905:	83 ec 04             	sub    $0x4,%esp
+ 908:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 90b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 90e:	6a 01                	push   $0x1
+ 910:	50                   	push   %eax
+ 911:	57                   	push   %edi
+ 912:	e8 cd fd ff ff       	call   6e4 <write>
+ 917:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 91a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 91d:	0f b6 1e             	movzbl (%esi),%ebx
+ 920:	83 c6 01             	add    $0x1,%esi
+ 923:	84 db                	test   %bl,%bl
+ 925:	74 29                	je     950 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 927:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 92a:	85 d2                	test   %edx,%edx
+ 92c:	74 ca                	je     8f8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 92e:	83 fa 25             	cmp    $0x25,%edx
+ 931:	75 ea                	jne    91d <printf+0x4d>
+      if(c == 'd'){
+ 933:	83 f8 25             	cmp    $0x25,%eax
+ 936:	0f 84 24 01 00 00    	je     a60 <printf+0x190>
+ 93c:	83 e8 63             	sub    $0x63,%eax
+ 93f:	83 f8 15             	cmp    $0x15,%eax
+ 942:	77 1c                	ja     960 <printf+0x90>
+ 944:	ff 24 85 94 0e 00 00 	jmp    *0xe94(,%eax,4)
+ 94b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 950:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 953:	5b                   	pop    %ebx
+ 954:	5e                   	pop    %esi
+ 955:	5f                   	pop    %edi
+ 956:	5d                   	pop    %ebp
+ 957:	c3                   	ret
+ 958:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95f:	90                   	nop
+  write(fd, &c, 1);
+ 960:	83 ec 04             	sub    $0x4,%esp
+ 963:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 966:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 96a:	6a 01                	push   $0x1
+ 96c:	52                   	push   %edx
+ 96d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 970:	57                   	push   %edi
+ 971:	e8 6e fd ff ff       	call   6e4 <write>
+ 976:	83 c4 0c             	add    $0xc,%esp
+ 979:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 97c:	6a 01                	push   $0x1
+ 97e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 981:	52                   	push   %edx
+ 982:	57                   	push   %edi
+ 983:	e8 5c fd ff ff       	call   6e4 <write>
+        putc(fd, c);
+ 988:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 98b:	31 d2                	xor    %edx,%edx
+ 98d:	eb 8e                	jmp    91d <printf+0x4d>
+ 98f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 990:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 993:	83 ec 0c             	sub    $0xc,%esp
+ 996:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 99b:	8b 13                	mov    (%ebx),%edx
+ 99d:	6a 00                	push   $0x0
+ 99f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 9a1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 9a4:	e8 87 fe ff ff       	call   830 <printint>
+        ap++;
+ 9a9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9ac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9af:	31 d2                	xor    %edx,%edx
+ 9b1:	e9 67 ff ff ff       	jmp    91d <printf+0x4d>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 9c0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 9c3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 9c5:	83 c0 04             	add    $0x4,%eax
+ 9c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 9cb:	85 db                	test   %ebx,%ebx
+ 9cd:	0f 84 9d 00 00 00    	je     a70 <printf+0x1a0>
+        while(*s != 0){
+ 9d3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 9d6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 9d8:	84 c0                	test   %al,%al
+ 9da:	0f 84 3d ff ff ff    	je     91d <printf+0x4d>
+ 9e0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9e3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 9e6:	89 de                	mov    %ebx,%esi
+ 9e8:	89 d3                	mov    %edx,%ebx
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9f0:	83 ec 04             	sub    $0x4,%esp
+ 9f3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9f6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9f9:	6a 01                	push   $0x1
+ 9fb:	53                   	push   %ebx
+ 9fc:	57                   	push   %edi
+ 9fd:	e8 e2 fc ff ff       	call   6e4 <write>
+        while(*s != 0){
+ a02:	0f b6 06             	movzbl (%esi),%eax
+ a05:	83 c4 10             	add    $0x10,%esp
+ a08:	84 c0                	test   %al,%al
+ a0a:	75 e4                	jne    9f0 <printf+0x120>
+      state = 0;
+ a0c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a0f:	31 d2                	xor    %edx,%edx
+ a11:	e9 07 ff ff ff       	jmp    91d <printf+0x4d>
+ a16:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a1d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a20:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a23:	83 ec 0c             	sub    $0xc,%esp
+ a26:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a2b:	8b 13                	mov    (%ebx),%edx
+ a2d:	6a 01                	push   $0x1
+ a2f:	e9 6b ff ff ff       	jmp    99f <printf+0xcf>
+ a34:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ a38:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ a3b:	83 ec 04             	sub    $0x4,%esp
+ a3e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ a41:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ a43:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ a46:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ a49:	6a 01                	push   $0x1
+ a4b:	52                   	push   %edx
+ a4c:	57                   	push   %edi
+ a4d:	e8 92 fc ff ff       	call   6e4 <write>
+        ap++;
+ a52:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a55:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a58:	31 d2                	xor    %edx,%edx
+ a5a:	e9 be fe ff ff       	jmp    91d <printf+0x4d>
+ a5f:	90                   	nop
+  write(fd, &c, 1);
+ a60:	83 ec 04             	sub    $0x4,%esp
+ a63:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a66:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a69:	6a 01                	push   $0x1
+ a6b:	e9 11 ff ff ff       	jmp    981 <printf+0xb1>
+ a70:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a75:	bb 8c 0e 00 00       	mov    $0xe8c,%ebx
+ a7a:	e9 61 ff ff ff       	jmp    9e0 <printf+0x110>
+ a7f:	90                   	nop
+
+00000a80 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a80:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a81:	a1 00 14 00 00       	mov    0x1400,%eax
+{
+ a86:	89 e5                	mov    %esp,%ebp
+ a88:	57                   	push   %edi
+ a89:	56                   	push   %esi
+ a8a:	53                   	push   %ebx
+ a8b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a8e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a91:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a98:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a9a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a9c:	39 ca                	cmp    %ecx,%edx
+ a9e:	73 30                	jae    ad0 <free+0x50>
+ aa0:	39 c1                	cmp    %eax,%ecx
+ aa2:	72 04                	jb     aa8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ aa4:	39 c2                	cmp    %eax,%edx
+ aa6:	72 f0                	jb     a98 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ aa8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ aab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ aae:	39 f8                	cmp    %edi,%eax
+ ab0:	74 2e                	je     ae0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ab2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ ab5:	8b 42 04             	mov    0x4(%edx),%eax
+ ab8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ abb:	39 f1                	cmp    %esi,%ecx
+ abd:	74 38                	je     af7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ abf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ ac1:	5b                   	pop    %ebx
+  freep = p;
+ ac2:	89 15 00 14 00 00    	mov    %edx,0x1400
+}
+ ac8:	5e                   	pop    %esi
+ ac9:	5f                   	pop    %edi
+ aca:	5d                   	pop    %ebp
+ acb:	c3                   	ret
+ acc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ad0:	39 c1                	cmp    %eax,%ecx
+ ad2:	72 d0                	jb     aa4 <free+0x24>
+ ad4:	eb c2                	jmp    a98 <free+0x18>
+ ad6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ add:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ ae0:	03 70 04             	add    0x4(%eax),%esi
+ ae3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ae6:	8b 02                	mov    (%edx),%eax
+ ae8:	8b 00                	mov    (%eax),%eax
+ aea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ aed:	8b 42 04             	mov    0x4(%edx),%eax
+ af0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ af3:	39 f1                	cmp    %esi,%ecx
+ af5:	75 c8                	jne    abf <free+0x3f>
+    p->s.size += bp->s.size;
+ af7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ afa:	89 15 00 14 00 00    	mov    %edx,0x1400
+    p->s.size += bp->s.size;
+ b00:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b03:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b06:	89 0a                	mov    %ecx,(%edx)
+}
+ b08:	5b                   	pop    %ebx
+ b09:	5e                   	pop    %esi
+ b0a:	5f                   	pop    %edi
+ b0b:	5d                   	pop    %ebp
+ b0c:	c3                   	ret
+ b0d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b10 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	57                   	push   %edi
+ b14:	56                   	push   %esi
+ b15:	53                   	push   %ebx
+ b16:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b19:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b1c:	8b 15 00 14 00 00    	mov    0x1400,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b22:	8d 78 07             	lea    0x7(%eax),%edi
+ b25:	c1 ef 03             	shr    $0x3,%edi
+ b28:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b2b:	85 d2                	test   %edx,%edx
+ b2d:	0f 84 8d 00 00 00    	je     bc0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b33:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b35:	8b 48 04             	mov    0x4(%eax),%ecx
+ b38:	39 f9                	cmp    %edi,%ecx
+ b3a:	73 64                	jae    ba0 <malloc+0x90>
+  if(nu < 4096)
+ b3c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ b41:	39 df                	cmp    %ebx,%edi
+ b43:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ b46:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ b4d:	eb 0a                	jmp    b59 <malloc+0x49>
+ b4f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b50:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b52:	8b 48 04             	mov    0x4(%eax),%ecx
+ b55:	39 f9                	cmp    %edi,%ecx
+ b57:	73 47                	jae    ba0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b59:	89 c2                	mov    %eax,%edx
+ b5b:	39 05 00 14 00 00    	cmp    %eax,0x1400
+ b61:	75 ed                	jne    b50 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b63:	83 ec 0c             	sub    $0xc,%esp
+ b66:	56                   	push   %esi
+ b67:	e8 e0 fb ff ff       	call   74c <sbrk>
+  if(p == (char*)-1)
+ b6c:	83 c4 10             	add    $0x10,%esp
+ b6f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b72:	74 1c                	je     b90 <malloc+0x80>
+  hp->s.size = nu;
+ b74:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b77:	83 ec 0c             	sub    $0xc,%esp
+ b7a:	83 c0 08             	add    $0x8,%eax
+ b7d:	50                   	push   %eax
+ b7e:	e8 fd fe ff ff       	call   a80 <free>
+  return freep;
+ b83:	8b 15 00 14 00 00    	mov    0x1400,%edx
+      if((p = morecore(nunits)) == 0)
+ b89:	83 c4 10             	add    $0x10,%esp
+ b8c:	85 d2                	test   %edx,%edx
+ b8e:	75 c0                	jne    b50 <malloc+0x40>
+        return 0;
+  }
+}
+ b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b93:	31 c0                	xor    %eax,%eax
+}
+ b95:	5b                   	pop    %ebx
+ b96:	5e                   	pop    %esi
+ b97:	5f                   	pop    %edi
+ b98:	5d                   	pop    %ebp
+ b99:	c3                   	ret
+ b9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ba0:	39 cf                	cmp    %ecx,%edi
+ ba2:	74 4c                	je     bf0 <malloc+0xe0>
+        p->s.size -= nunits;
+ ba4:	29 f9                	sub    %edi,%ecx
+ ba6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ba9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ bac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ baf:	89 15 00 14 00 00    	mov    %edx,0x1400
+}
+ bb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ bb8:	83 c0 08             	add    $0x8,%eax
+}
+ bbb:	5b                   	pop    %ebx
+ bbc:	5e                   	pop    %esi
+ bbd:	5f                   	pop    %edi
+ bbe:	5d                   	pop    %ebp
+ bbf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ bc0:	c7 05 00 14 00 00 04 	movl   $0x1404,0x1400
+ bc7:	14 00 00 
+    base.s.size = 0;
+ bca:	b8 04 14 00 00       	mov    $0x1404,%eax
+    base.s.ptr = freep = prevp = &base;
+ bcf:	c7 05 04 14 00 00 04 	movl   $0x1404,0x1404
+ bd6:	14 00 00 
+    base.s.size = 0;
+ bd9:	c7 05 08 14 00 00 00 	movl   $0x0,0x1408
+ be0:	00 00 00 
+    if(p->s.size >= nunits){
+ be3:	e9 54 ff ff ff       	jmp    b3c <malloc+0x2c>
+ be8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ bf0:	8b 08                	mov    (%eax),%ecx
+ bf2:	89 0a                	mov    %ecx,(%edx)
+ bf4:	eb b9                	jmp    baf <malloc+0x9f>
+ bf6:	66 90                	xchg   %ax,%ax
+ bf8:	66 90                	xchg   %ax,%ax
+ bfa:	66 90                	xchg   %ax,%ax
+ bfc:	66 90                	xchg   %ax,%ax
+ bfe:	66 90                	xchg   %ax,%ax
+
+00000c00 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ c00:	55                   	push   %ebp
+ c01:	89 e5                	mov    %esp,%ebp
+ c03:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ c06:	8b 45 08             	mov    0x8(%ebp),%eax
+ c09:	c1 e0 04             	shl    $0x4,%eax
+ c0c:	ff b0 4c 14 00 00    	push   0x144c(%eax)
+ c12:	05 40 14 00 00       	add    $0x1440,%eax
+ c17:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ c1a:	e8 a5 fa ff ff       	call   6c4 <exit>
+ c1f:	90                   	nop
+
+00000c20 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ c20:	55                   	push   %ebp
+ c21:	89 e5                	mov    %esp,%ebp
+ c23:	57                   	push   %edi
+ c24:	56                   	push   %esi
+ c25:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ c26:	31 db                	xor    %ebx,%ebx
+{
+ c28:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ c2b:	68 20 14 00 00       	push   $0x1420
+ c30:	e8 eb f8 ff ff       	call   520 <lock_acquire>
+ c35:	83 c4 10             	add    $0x10,%esp
+ c38:	eb 12                	jmp    c4c <thread_create+0x2c>
+ c3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ c40:	83 c3 01             	add    $0x1,%ebx
+ c43:	83 fb 40             	cmp    $0x40,%ebx
+ c46:	0f 84 c4 00 00 00    	je     d10 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ c4c:	89 de                	mov    %ebx,%esi
+ c4e:	c1 e6 04             	shl    $0x4,%esi
+ c51:	8b 96 40 14 00 00    	mov    0x1440(%esi),%edx
+ c57:	85 d2                	test   %edx,%edx
+ c59:	75 e5                	jne    c40 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ c5b:	83 ec 0c             	sub    $0xc,%esp
+ c5e:	68 00 20 00 00       	push   $0x2000
+ c63:	e8 a8 fe ff ff       	call   b10 <malloc>
+ c68:	83 c4 10             	add    $0x10,%esp
+ c6b:	85 c0                	test   %eax,%eax
+ c6d:	0f 84 9d 00 00 00    	je     d10 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ c73:	89 86 44 14 00 00    	mov    %eax,0x1444(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ c79:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ c7e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ c81:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ c86:	89 86 40 14 00 00    	mov    %eax,0x1440(%esi)
+  threads[i].fn = fn;
+ c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c8f:	89 86 48 14 00 00    	mov    %eax,0x1448(%esi)
+  threads[i].arg = arg;
+ c95:	8b 45 0c             	mov    0xc(%ebp),%eax
+ c98:	89 86 4c 14 00 00    	mov    %eax,0x144c(%esi)
+  lock_release(&threadslock);
+ c9e:	68 20 14 00 00       	push   $0x1420
+ ca3:	e8 98 f8 ff ff       	call   540 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ ca8:	83 c4 0c             	add    $0xc,%esp
+ cab:	ff b6 40 14 00 00    	push   0x1440(%esi)
+ cb1:	53                   	push   %ebx
+ cb2:	68 00 0c 00 00       	push   $0xc00
+ cb7:	e8 10 fb ff ff       	call   7cc <clone>
+ cbc:	83 c4 10             	add    $0x10,%esp
+ cbf:	85 c0                	test   %eax,%eax
+ cc1:	78 0d                	js     cd0 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cc6:	5b                   	pop    %ebx
+ cc7:	5e                   	pop    %esi
+ cc8:	5f                   	pop    %edi
+ cc9:	5d                   	pop    %ebp
+ cca:	c3                   	ret
+ ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ ccf:	90                   	nop
+    lock_acquire(&threadslock);
+ cd0:	83 ec 0c             	sub    $0xc,%esp
+ cd3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ cd6:	68 20 14 00 00       	push   $0x1420
+ cdb:	e8 40 f8 ff ff       	call   520 <lock_acquire>
+    free(threads[i].block);
+ ce0:	58                   	pop    %eax
+ ce1:	ff b6 44 14 00 00    	push   0x1444(%esi)
+ ce7:	e8 94 fd ff ff       	call   a80 <free>
+    threads[i].stack = 0;
+ cec:	c7 86 40 14 00 00 00 	movl   $0x0,0x1440(%esi)
+ cf3:	00 00 00 
+    lock_release(&threadslock);
+ cf6:	c7 04 24 20 14 00 00 	movl   $0x1420,(%esp)
+ cfd:	e8 3e f8 ff ff       	call   540 <lock_release>
+ d02:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d05:	83 c4 10             	add    $0x10,%esp
+}
+ d08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d0b:	5b                   	pop    %ebx
+ d0c:	5e                   	pop    %esi
+ d0d:	5f                   	pop    %edi
+ d0e:	5d                   	pop    %ebp
+ d0f:	c3                   	ret
+    lock_release(&threadslock);
+ d10:	83 ec 0c             	sub    $0xc,%esp
+ d13:	68 20 14 00 00       	push   $0x1420
+ d18:	e8 23 f8 ff ff       	call   540 <lock_release>
+    return -1;
+ d1d:	83 c4 10             	add    $0x10,%esp
+ d20:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d25:	eb 9c                	jmp    cc3 <thread_create+0xa3>
+ d27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d2e:	66 90                	xchg   %ax,%ax
+
+00000d30 <thread_join>:
+
+int
+thread_join(void)
+{
+ d30:	55                   	push   %ebp
+ d31:	89 e5                	mov    %esp,%ebp
+ d33:	56                   	push   %esi
+ d34:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ d35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ d38:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ d3b:	50                   	push   %eax
+ d3c:	e8 93 fa ff ff       	call   7d4 <join>
+ d41:	83 c4 10             	add    $0x10,%esp
+ d44:	85 c0                	test   %eax,%eax
+ d46:	78 69                	js     db1 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ d48:	83 ec 0c             	sub    $0xc,%esp
+ d4b:	89 c6                	mov    %eax,%esi
+ d4d:	68 20 14 00 00       	push   $0x1420
+ d52:	e8 c9 f7 ff ff       	call   520 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ d57:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d5a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ d5d:	31 c0                	xor    %eax,%eax
+ d5f:	eb 0f                	jmp    d70 <thread_join+0x40>
+ d61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d68:	83 c0 01             	add    $0x1,%eax
+ d6b:	83 f8 40             	cmp    $0x40,%eax
+ d6e:	74 28                	je     d98 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ d70:	89 c3                	mov    %eax,%ebx
+ d72:	c1 e3 04             	shl    $0x4,%ebx
+ d75:	39 93 40 14 00 00    	cmp    %edx,0x1440(%ebx)
+ d7b:	75 eb                	jne    d68 <thread_join+0x38>
+      free(threads[i].block);
+ d7d:	83 ec 0c             	sub    $0xc,%esp
+ d80:	ff b3 44 14 00 00    	push   0x1444(%ebx)
+ d86:	e8 f5 fc ff ff       	call   a80 <free>
+      threads[i].stack = 0;
+      break;
+ d8b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ d8e:	c7 83 40 14 00 00 00 	movl   $0x0,0x1440(%ebx)
+ d95:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ d98:	83 ec 0c             	sub    $0xc,%esp
+ d9b:	68 20 14 00 00       	push   $0x1420
+ da0:	e8 9b f7 ff ff       	call   540 <lock_release>
+  return pid;
+ da5:	83 c4 10             	add    $0x10,%esp
+}
+ da8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ dab:	89 f0                	mov    %esi,%eax
+ dad:	5b                   	pop    %ebx
+ dae:	5e                   	pop    %esi
+ daf:	5d                   	pop    %ebp
+ db0:	c3                   	ret
+    return -1;
+ db1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ db6:	eb f0                	jmp    da8 <thread_join+0x78>
@@ -0,0 +1,92 @@
+// Disk scheduler benchmark.
+// Runs the concreate and fourfiles tests from usertests, several
+// processes each, under the FIFO and then the C-SCAN disk scheduler,
+// starting each run with a cold buffer cache, and prints the time
+// each took with histograms of the disk queue depth and request
+// latency seen during it.
+//
+// usage: iobench [procs]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+char *policies[] = { "fifo", "cscan" };
+char *workloads[] = { "concreate", "fourfiles" };
+
+void
+printhist(char *name, uint *before, uint *after)
+{
+  int k;
+
+  printf(1, "  %s:", name);
+  for(k = 0; k < NIOHIST; k++)
+    printf(1, " %d", after[k] - before[k]);
+  printf(1, "\n");
+}
+
+// Run usertests with one workload in each of n processes at once,
+// each in its own directory so they do not trip over each other's
+// files.
+void
+run(char *workload, int n)
+{
+  char dir[] = "iobench.a";
+  char *argv[] = { "/usertests", workload, 0 };
+  int i;
+
+  for(i = 0; i < n; i++){
+    if(fork() == 0){
+      dir[8] = 'a' + i;
+      mkdir(dir);
+      if(chdir(dir) < 0){
+        printf(2, "iobench: chdir %s failed\n", dir);
+        exit();
+      }
+      exec(argv[0], argv);
+      printf(2, "iobench: exec usertests failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < n; i++)
+    wait();
+  for(i = 0; i < n; i++){
+    dir[8] = 'a' + i;
+    unlink(dir);
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct iostat before, after;
+  int n, p, w, old, start, elapsed;
+
+  n = 4;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(n < 1 || n > 26){
+    printf(2, "usage: iobench [procs]\n");
+    exit();
+  }
+
+  old = setiosched(IOSCHED_FIFO);
+  for(p = IOSCHED_FIFO; p <= IOSCHED_CSCAN; p++){
+    setiosched(p);
+    for(w = 0; w < 2; w++){
+      dropcache();
+      iostat(&before);
+      start = uptime();
+      run(workloads[w], n);
+      elapsed = uptime() - start;
+      iostat(&after);
+      printf(1, "iobench: %s, %d x %s: %d ticks, %d expired\n",
+             policies[p], n, workloads[w], elapsed,
+             after.expired - before.expired);
+      printhist("depth 1,2,4..", before.depth, after.depth);
+      printhist("usecs <64,128,256..", before.latency, after.latency);
+    }
+  }
+  setiosched(old);
+  exit();
+}
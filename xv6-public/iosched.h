@@ -0,0 +1,22 @@
+#ifndef IOSCHED
+#define IOSCHED
+
+// Disk request scheduling policies for `setiosched`
+#define IOSCHED_FIFO  0 // In arrival order
+#define IOSCHED_CSCAN 1 // One-way elevator by block, with deadlines
+
+// Histogram buckets in `iostat`
+#define NIOHIST 12
+
+// for `iostat`
+struct iostat {
+    int policy;            // Current IOSCHED_ policy
+    uint depth[NIOHIST];   // Requests queued when one arrives, counting
+                           // it; bucket k is [2^k, 2^(k+1))
+    uint latency[NIOHIST]; // Microseconds from queueing to completion;
+                           // bucket 0 is < 64, bucket k is
+                           // [2^(k+5), 2^(k+6)), the last is open
+    uint expired;          // Requests that went next on a deadline
+};
+
+#endif
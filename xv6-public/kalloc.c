@@ -17,10 +17,18 @@ struct run {
   struct run *next;
 };
 
+// Per-frame metadata, indexed by physical page number.
+struct frame {
+  ushort pins;     // # of wmlock pins keeping this frame resident
+  ushort shares;   // # of page tables mapping it besides the first
+};
+
 struct {
   struct spinlock lock;
   int use_lock;
   struct run *freelist;
+  uint nfree;
+  struct frame frames[PHYSTOP/PGSIZE];
 } kmem;
 
 // Initialization happens in two phases.
@@ -56,13 +64,28 @@ freerange(void *vstart, void *vend)
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
 // initializing the allocator; see kinit above.)
+// A frame shared with kshare is only freed by its last kfree.
 void
 kfree(char *v)
 {
   struct run *r;
+  struct frame *f;
 
   if((uint)v % PGSIZE || v < end || V2P(v) >= PHYSTOP)
     panic("kfree");
+  f = &kmem.frames[V2P(v)/PGSIZE];
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  if(f->shares > 0){
+    f->shares--;
+    if(kmem.use_lock)
+      release(&kmem.lock);
+    return;
+  }
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  if(f->pins)
+    panic("kfree pinned");
 
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
@@ -72,6 +95,7 @@ kfree(char *v)
   r = (struct run*)v;
   r->next = kmem.freelist;
   kmem.freelist = r;
+  kmem.nfree++;
   if(kmem.use_lock)
     release(&kmem.lock);
 }
@@ -87,10 +111,48 @@ kalloc(void)
   if(kmem.use_lock)
     acquire(&kmem.lock);
   r = kmem.freelist;
-  if(r)
+  if(r){
     kmem.freelist = r->next;
+    kmem.nfree--;
+  }
   if(kmem.use_lock)
     release(&kmem.lock);
   return (char*)r;
 }
 
+// Return the number of free pages.
+int
+kfreepages(void)
+{
+  return kmem.nfree;
+}
+
+// Note another page table mapping the frame at kernel address v,
+// which then takes one more kfree to free.
+void
+kshare(char *v)
+{
+  acquire(&kmem.lock);
+  kmem.frames[V2P(v)/PGSIZE].shares++;
+  release(&kmem.lock);
+}
+
+// Pin the frame at kernel address v until a matching kunpin; kfree
+// panics on a pinned frame.
+void
+kpin(char *v)
+{
+  acquire(&kmem.lock);
+  kmem.frames[V2P(v)/PGSIZE].pins++;
+  release(&kmem.lock);
+}
+
+void
+kunpin(char *v)
+{
+  acquire(&kmem.lock);
+  if(kmem.frames[V2P(v)/PGSIZE].pins == 0)
+    panic("kunpin");
+  kmem.frames[V2P(v)/PGSIZE].pins--;
+  release(&kmem.lock);
+}
@@ -0,0 +1,1798 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 27                	jle    4a <main+0x4a>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    printf(2, "usage: kill pid...\n");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    kill(atoi(argv[i]));
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    kill(atoi(argv[i]));
+  31:	e8 fa 01 00 00       	call   230 <atoi>
+  36:	89 04 24             	mov    %eax,(%esp)
+  39:	e8 46 04 00 00       	call   484 <kill>
+  for(i=1; i<argc; i++)
+  3e:	83 c4 10             	add    $0x10,%esp
+  41:	39 de                	cmp    %ebx,%esi
+  43:	75 e3                	jne    28 <main+0x28>
+  exit();
+  45:	e8 0a 04 00 00       	call   454 <exit>
+    printf(2, "usage: kill pid...\n");
+  4a:	50                   	push   %eax
+  4b:	50                   	push   %eax
+  4c:	68 48 0b 00 00       	push   $0xb48
+  51:	6a 02                	push   $0x2
+  53:	e8 08 06 00 00       	call   660 <printf>
+    exit();
+  58:	e8 f7 03 00 00       	call   454 <exit>
+  5d:	66 90                	xchg   %ax,%ax
+  5f:	90                   	nop
+
+00000060 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  60:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  61:	31 c0                	xor    %eax,%eax
+{
+  63:	89 e5                	mov    %esp,%ebp
+  65:	53                   	push   %ebx
+  66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  70:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  74:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  77:	83 c0 01             	add    $0x1,%eax
+  7a:	84 d2                	test   %dl,%dl
+  7c:	75 f2                	jne    70 <strcpy+0x10>
+    ;
+  return os;
+}
+  7e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  81:	89 c8                	mov    %ecx,%eax
+  83:	c9                   	leave
+  84:	c3                   	ret
+  85:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000090 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	53                   	push   %ebx
+  94:	8b 55 08             	mov    0x8(%ebp),%edx
+  97:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  9a:	0f b6 02             	movzbl (%edx),%eax
+  9d:	84 c0                	test   %al,%al
+  9f:	75 17                	jne    b8 <strcmp+0x28>
+  a1:	eb 3a                	jmp    dd <strcmp+0x4d>
+  a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  a7:	90                   	nop
+  a8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  ac:	83 c2 01             	add    $0x1,%edx
+  af:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  b2:	84 c0                	test   %al,%al
+  b4:	74 1a                	je     d0 <strcmp+0x40>
+    p++, q++;
+  b6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  b8:	0f b6 19             	movzbl (%ecx),%ebx
+  bb:	38 c3                	cmp    %al,%bl
+  bd:	74 e9                	je     a8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  bf:	29 d8                	sub    %ebx,%eax
+}
+  c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c4:	c9                   	leave
+  c5:	c3                   	ret
+  c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  d0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  d4:	31 c0                	xor    %eax,%eax
+  d6:	29 d8                	sub    %ebx,%eax
+}
+  d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  db:	c9                   	leave
+  dc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  dd:	0f b6 19             	movzbl (%ecx),%ebx
+  e0:	31 c0                	xor    %eax,%eax
+  e2:	eb db                	jmp    bf <strcmp+0x2f>
+  e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  ef:	90                   	nop
+
+000000f0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  f6:	80 3a 00             	cmpb   $0x0,(%edx)
+  f9:	74 15                	je     110 <strlen+0x20>
+  fb:	31 c0                	xor    %eax,%eax
+  fd:	8d 76 00             	lea    0x0(%esi),%esi
+ 100:	83 c0 01             	add    $0x1,%eax
+ 103:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 107:	89 c1                	mov    %eax,%ecx
+ 109:	75 f5                	jne    100 <strlen+0x10>
+    ;
+  return n;
+}
+ 10b:	89 c8                	mov    %ecx,%eax
+ 10d:	5d                   	pop    %ebp
+ 10e:	c3                   	ret
+ 10f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 110:	31 c9                	xor    %ecx,%ecx
+}
+ 112:	5d                   	pop    %ebp
+ 113:	89 c8                	mov    %ecx,%eax
+ 115:	c3                   	ret
+ 116:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000120 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 120:	55                   	push   %ebp
+ 121:	89 e5                	mov    %esp,%ebp
+ 123:	57                   	push   %edi
+ 124:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 127:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	89 d7                	mov    %edx,%edi
+ 12f:	fc                   	cld
+ 130:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 132:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 135:	89 d0                	mov    %edx,%eax
+ 137:	c9                   	leave
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000140 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 14a:	0f b6 10             	movzbl (%eax),%edx
+ 14d:	84 d2                	test   %dl,%dl
+ 14f:	75 12                	jne    163 <strchr+0x23>
+ 151:	eb 1d                	jmp    170 <strchr+0x30>
+ 153:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 157:	90                   	nop
+ 158:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 15c:	83 c0 01             	add    $0x1,%eax
+ 15f:	84 d2                	test   %dl,%dl
+ 161:	74 0d                	je     170 <strchr+0x30>
+    if(*s == c)
+ 163:	38 d1                	cmp    %dl,%cl
+ 165:	75 f1                	jne    158 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 167:	5d                   	pop    %ebp
+ 168:	c3                   	ret
+ 169:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 170:	31 c0                	xor    %eax,%eax
+}
+ 172:	5d                   	pop    %ebp
+ 173:	c3                   	ret
+ 174:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 17b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 17f:	90                   	nop
+
+00000180 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	57                   	push   %edi
+ 184:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 185:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 188:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 189:	31 db                	xor    %ebx,%ebx
+{
+ 18b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 18e:	eb 27                	jmp    1b7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	6a 01                	push   $0x1
+ 195:	56                   	push   %esi
+ 196:	6a 00                	push   $0x0
+ 198:	e8 cf 02 00 00       	call   46c <read>
+    if(cc < 1)
+ 19d:	83 c4 10             	add    $0x10,%esp
+ 1a0:	85 c0                	test   %eax,%eax
+ 1a2:	7e 1d                	jle    1c1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1a4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ab:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1af:	3c 0a                	cmp    $0xa,%al
+ 1b1:	74 10                	je     1c3 <gets+0x43>
+ 1b3:	3c 0d                	cmp    $0xd,%al
+ 1b5:	74 0c                	je     1c3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1b7:	89 df                	mov    %ebx,%edi
+ 1b9:	83 c3 01             	add    $0x1,%ebx
+ 1bc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1bf:	7c cf                	jl     190 <gets+0x10>
+ 1c1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1cd:	5b                   	pop    %ebx
+ 1ce:	5e                   	pop    %esi
+ 1cf:	5f                   	pop    %edi
+ 1d0:	5d                   	pop    %ebp
+ 1d1:	c3                   	ret
+ 1d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001e0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	56                   	push   %esi
+ 1e4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1e5:	83 ec 08             	sub    $0x8,%esp
+ 1e8:	6a 00                	push   $0x0
+ 1ea:	ff 75 08             	push   0x8(%ebp)
+ 1ed:	e8 a2 02 00 00       	call   494 <open>
+  if(fd < 0)
+ 1f2:	83 c4 10             	add    $0x10,%esp
+ 1f5:	85 c0                	test   %eax,%eax
+ 1f7:	78 27                	js     220 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1f9:	83 ec 08             	sub    $0x8,%esp
+ 1fc:	ff 75 0c             	push   0xc(%ebp)
+ 1ff:	89 c3                	mov    %eax,%ebx
+ 201:	50                   	push   %eax
+ 202:	e8 a5 02 00 00       	call   4ac <fstat>
+  close(fd);
+ 207:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 20a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 20c:	e8 6b 02 00 00       	call   47c <close>
+  return r;
+ 211:	83 c4 10             	add    $0x10,%esp
+}
+ 214:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 217:	89 f0                	mov    %esi,%eax
+ 219:	5b                   	pop    %ebx
+ 21a:	5e                   	pop    %esi
+ 21b:	5d                   	pop    %ebp
+ 21c:	c3                   	ret
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 220:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 225:	eb ed                	jmp    214 <stat+0x34>
+ 227:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 22e:	66 90                	xchg   %ax,%ax
+
+00000230 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	53                   	push   %ebx
+ 234:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 237:	0f be 02             	movsbl (%edx),%eax
+ 23a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 23d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 245:	77 1e                	ja     265 <atoi+0x35>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 250:	83 c2 01             	add    $0x1,%edx
+ 253:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 256:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 25a:	0f be 02             	movsbl (%edx),%eax
+ 25d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 260:	80 fb 09             	cmp    $0x9,%bl
+ 263:	76 eb                	jbe    250 <atoi+0x20>
+  return n;
+}
+ 265:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 268:	89 c8                	mov    %ecx,%eax
+ 26a:	c9                   	leave
+ 26b:	c3                   	ret
+ 26c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000270 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+ 273:	57                   	push   %edi
+ 274:	56                   	push   %esi
+ 275:	8b 45 10             	mov    0x10(%ebp),%eax
+ 278:	8b 55 08             	mov    0x8(%ebp),%edx
+ 27b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 27e:	85 c0                	test   %eax,%eax
+ 280:	7e 13                	jle    295 <memmove+0x25>
+ 282:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 284:	89 d7                	mov    %edx,%edi
+ 286:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 290:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 291:	39 f8                	cmp    %edi,%eax
+ 293:	75 fb                	jne    290 <memmove+0x20>
+  return vdst;
+}
+ 295:	5e                   	pop    %esi
+ 296:	89 d0                	mov    %edx,%eax
+ 298:	5f                   	pop    %edi
+ 299:	5d                   	pop    %ebp
+ 29a:	c3                   	ret
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 2a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2ac:	5d                   	pop    %ebp
+ 2ad:	c3                   	ret
+ 2ae:	66 90                	xchg   %ax,%ax
+
+000002b0 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 2b0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 2b1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 2b6:	89 e5                	mov    %esp,%ebp
+ 2b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+ 2c0:	89 c8                	mov    %ecx,%eax
+ 2c2:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 2c5:	85 c0                	test   %eax,%eax
+ 2c7:	75 f7                	jne    2c0 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 2c9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 2ce:	5d                   	pop    %ebp
+ 2cf:	c3                   	ret
+
+000002d0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	31 c0                	xor    %eax,%eax
+ 2d3:	89 e5                	mov    %esp,%ebp
+ 2d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 2d8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 2dd:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 2e0:	5d                   	pop    %ebp
+ 2e1:	c3                   	ret
+ 2e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002f0 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2fc:	5d                   	pop    %ebp
+ 2fd:	c3                   	ret
+ 2fe:	66 90                	xchg   %ax,%ax
+
+00000300 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 300:	55                   	push   %ebp
+ 301:	b8 01 00 00 00       	mov    $0x1,%eax
+ 306:	89 e5                	mov    %esp,%ebp
+ 308:	56                   	push   %esi
+ 309:	53                   	push   %ebx
+ 30a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 30d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 310:	85 c0                	test   %eax,%eax
+ 312:	74 2d                	je     341 <mutex_lock+0x41>
+ 314:	b8 02 00 00 00       	mov    $0x2,%eax
+ 319:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 31c:	85 c0                	test   %eax,%eax
+ 31e:	74 21                	je     341 <mutex_lock+0x41>
+ 320:	be 02 00 00 00       	mov    $0x2,%esi
+ 325:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	6a 02                	push   $0x2
+ 32d:	6a 00                	push   $0x0
+ 32f:	53                   	push   %ebx
+ 330:	e8 37 02 00 00       	call   56c <futex>
+ 335:	89 f0                	mov    %esi,%eax
+ 337:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 33a:	83 c4 10             	add    $0x10,%esp
+ 33d:	85 c0                	test   %eax,%eax
+ 33f:	75 e7                	jne    328 <mutex_lock+0x28>
+}
+ 341:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 344:	5b                   	pop    %ebx
+ 345:	5e                   	pop    %esi
+ 346:	5d                   	pop    %ebp
+ 347:	c3                   	ret
+ 348:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34f:	90                   	nop
+
+00000350 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 350:	55                   	push   %ebp
+ 351:	31 c0                	xor    %eax,%eax
+ 353:	89 e5                	mov    %esp,%ebp
+ 355:	83 ec 08             	sub    $0x8,%esp
+ 358:	8b 55 08             	mov    0x8(%ebp),%edx
+ 35b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 35e:	83 f8 02             	cmp    $0x2,%eax
+ 361:	74 05                	je     368 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 368:	83 ec 04             	sub    $0x4,%esp
+ 36b:	6a 01                	push   $0x1
+ 36d:	6a 01                	push   $0x1
+ 36f:	52                   	push   %edx
+ 370:	e8 f7 01 00 00       	call   56c <futex>
+ 375:	83 c4 10             	add    $0x10,%esp
+}
+ 378:	c9                   	leave
+ 379:	c3                   	ret
+ 37a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000380 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 38c:	5d                   	pop    %ebp
+ 38d:	c3                   	ret
+ 38e:	66 90                	xchg   %ax,%ax
+
+00000390 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 390:	55                   	push   %ebp
+ 391:	31 c0                	xor    %eax,%eax
+ 393:	89 e5                	mov    %esp,%ebp
+ 395:	57                   	push   %edi
+ 396:	56                   	push   %esi
+ 397:	53                   	push   %ebx
+ 398:	83 ec 0c             	sub    $0xc,%esp
+ 39b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 39e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 3a1:	8b 3e                	mov    (%esi),%edi
+ 3a3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 3a6:	83 f8 02             	cmp    $0x2,%eax
+ 3a9:	74 4d                	je     3f8 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 3ab:	83 ec 04             	sub    $0x4,%esp
+ 3ae:	57                   	push   %edi
+ 3af:	6a 00                	push   $0x0
+ 3b1:	56                   	push   %esi
+ 3b2:	e8 b5 01 00 00       	call   56c <futex>
+ 3b7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3bc:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 3bf:	83 c4 10             	add    $0x10,%esp
+ 3c2:	85 c0                	test   %eax,%eax
+ 3c4:	74 23                	je     3e9 <cond_wait+0x59>
+ 3c6:	be 02 00 00 00       	mov    $0x2,%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3d0:	83 ec 04             	sub    $0x4,%esp
+ 3d3:	6a 02                	push   $0x2
+ 3d5:	6a 00                	push   $0x0
+ 3d7:	53                   	push   %ebx
+ 3d8:	e8 8f 01 00 00       	call   56c <futex>
+ 3dd:	89 f0                	mov    %esi,%eax
+ 3df:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	75 e7                	jne    3d0 <cond_wait+0x40>
+}
+ 3e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ec:	5b                   	pop    %ebx
+ 3ed:	5e                   	pop    %esi
+ 3ee:	5f                   	pop    %edi
+ 3ef:	5d                   	pop    %ebp
+ 3f0:	c3                   	ret
+ 3f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3f8:	83 ec 04             	sub    $0x4,%esp
+ 3fb:	6a 01                	push   $0x1
+ 3fd:	6a 01                	push   $0x1
+ 3ff:	53                   	push   %ebx
+ 400:	e8 67 01 00 00       	call   56c <futex>
+ 405:	83 c4 10             	add    $0x10,%esp
+ 408:	eb a1                	jmp    3ab <cond_wait+0x1b>
+ 40a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000410 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+ 413:	83 ec 0c             	sub    $0xc,%esp
+ 416:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 419:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 41d:	6a 01                	push   $0x1
+ 41f:	6a 01                	push   $0x1
+ 421:	50                   	push   %eax
+ 422:	e8 45 01 00 00       	call   56c <futex>
+}
+ 427:	83 c4 10             	add    $0x10,%esp
+ 42a:	c9                   	leave
+ 42b:	c3                   	ret
+ 42c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000430 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	83 ec 0c             	sub    $0xc,%esp
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 439:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 43d:	6a ff                	push   $0xffffffff
+ 43f:	6a 01                	push   $0x1
+ 441:	50                   	push   %eax
+ 442:	e8 25 01 00 00       	call   56c <futex>
+}
+ 447:	83 c4 10             	add    $0x10,%esp
+ 44a:	c9                   	leave
+ 44b:	c3                   	ret
+
+0000044c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 44c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <exit>:
+SYSCALL(exit)
+ 454:	b8 02 00 00 00       	mov    $0x2,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <wait>:
+SYSCALL(wait)
+ 45c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <pipe>:
+SYSCALL(pipe)
+ 464:	b8 04 00 00 00       	mov    $0x4,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <read>:
+SYSCALL(read)
+ 46c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <write>:
+SYSCALL(write)
+ 474:	b8 10 00 00 00       	mov    $0x10,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <close>:
+SYSCALL(close)
+ 47c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <kill>:
+SYSCALL(kill)
+ 484:	b8 06 00 00 00       	mov    $0x6,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <exec>:
+SYSCALL(exec)
+ 48c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <open>:
+SYSCALL(open)
+ 494:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <mknod>:
+SYSCALL(mknod)
+ 49c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <unlink>:
+SYSCALL(unlink)
+ 4a4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <fstat>:
+SYSCALL(fstat)
+ 4ac:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <link>:
+SYSCALL(link)
+ 4b4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <mkdir>:
+SYSCALL(mkdir)
+ 4bc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <chdir>:
+SYSCALL(chdir)
+ 4c4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <dup>:
+SYSCALL(dup)
+ 4cc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <getpid>:
+SYSCALL(getpid)
+ 4d4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <sbrk>:
+SYSCALL(sbrk)
+ 4dc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <sleep>:
+SYSCALL(sleep)
+ 4e4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <uptime>:
+SYSCALL(uptime)
+ 4ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 4f4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 4fc:	b8 19 00 00 00       	mov    $0x19,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <wmap>:
+SYSCALL(wmap)
+ 504:	b8 16 00 00 00       	mov    $0x16,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <wunmap>:
+SYSCALL(wunmap)
+ 50c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <wremap>:
+SYSCALL(wremap)
+ 514:	b8 18 00 00 00       	mov    $0x18,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <wmlock>:
+SYSCALL(wmlock)
+ 51c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <wmunlock>:
+SYSCALL(wmunlock)
+ 524:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <wmapoff>:
+SYSCALL(wmapoff)
+ 52c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 534:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <setpriority>:
+SYSCALL(setpriority)
+ 53c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 544:	b8 20 00 00 00       	mov    $0x20,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <settickets>:
+SYSCALL(settickets)
+ 54c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 554:	b8 22 00 00 00       	mov    $0x22,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <clone>:
+SYSCALL(clone)
+ 55c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <join>:
+SYSCALL(join)
+ 564:	b8 24 00 00 00       	mov    $0x24,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <futex>:
+SYSCALL(futex)
+ 56c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <setaffinity>:
+SYSCALL(setaffinity)
+ 574:	b8 26 00 00 00       	mov    $0x26,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <getaffinity>:
+SYSCALL(getaffinity)
+ 57c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <bcstat>:
+SYSCALL(bcstat)
+ 584:	b8 29 00 00 00       	mov    $0x29,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <dropcache>:
+SYSCALL(dropcache)
+ 58c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <setiosched>:
+SYSCALL(setiosched)
+ 594:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <iostat>:
+SYSCALL(iostat)
+ 59c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <fsync>:
+SYSCALL(fsync)
+ 5a4:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 5ac:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 5ad:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 5b2:	cd 40                	int    $0x40
+ 5b4:	ff e1                	jmp    *%ecx
+ 5b6:	66 90                	xchg   %ax,%ax
+ 5b8:	66 90                	xchg   %ax,%ax
+ 5ba:	66 90                	xchg   %ax,%ax
+ 5bc:	66 90                	xchg   %ax,%ax
+ 5be:	66 90                	xchg   %ax,%ax
+
+000005c0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	57                   	push   %edi
+ 5c4:	56                   	push   %esi
+ 5c5:	53                   	push   %ebx
+ 5c6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5c8:	89 d1                	mov    %edx,%ecx
+{
+ 5ca:	83 ec 3c             	sub    $0x3c,%esp
+ 5cd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5d0:	85 d2                	test   %edx,%edx
+ 5d2:	0f 89 80 00 00 00    	jns    658 <printint+0x98>
+ 5d8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5dc:	74 7a                	je     658 <printint+0x98>
+    x = -xx;
+ 5de:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5e5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5e8:	31 f6                	xor    %esi,%esi
+ 5ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5f0:	89 c8                	mov    %ecx,%eax
+ 5f2:	31 d2                	xor    %edx,%edx
+ 5f4:	89 f7                	mov    %esi,%edi
+ 5f6:	f7 f3                	div    %ebx
+ 5f8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5fb:	0f b6 92 bc 0b 00 00 	movzbl 0xbbc(%edx),%edx
+ 602:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 606:	89 ca                	mov    %ecx,%edx
+ 608:	89 c1                	mov    %eax,%ecx
+ 60a:	39 da                	cmp    %ebx,%edx
+ 60c:	73 e2                	jae    5f0 <printint+0x30>
+  if(neg)
+ 60e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 611:	85 c0                	test   %eax,%eax
+ 613:	74 07                	je     61c <printint+0x5c>
+    buf[i++] = '-';
+ 615:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 61a:	89 f7                	mov    %esi,%edi
+ 61c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 61f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 622:	01 df                	add    %ebx,%edi
+ 624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 628:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 62b:	83 ec 04             	sub    $0x4,%esp
+ 62e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 631:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 634:	6a 01                	push   $0x1
+ 636:	50                   	push   %eax
+ 637:	56                   	push   %esi
+ 638:	e8 37 fe ff ff       	call   474 <write>
+  while(--i >= 0)
+ 63d:	89 f8                	mov    %edi,%eax
+ 63f:	83 c4 10             	add    $0x10,%esp
+ 642:	83 ef 01             	sub    $0x1,%edi
+ 645:	39 d8                	cmp    %ebx,%eax
+ 647:	75 df                	jne    628 <printint+0x68>
+}
+ 649:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 64c:	5b                   	pop    %ebx
+ 64d:	5e                   	pop    %esi
+ 64e:	5f                   	pop    %edi
+ 64f:	5d                   	pop    %ebp
+ 650:	c3                   	ret
+ 651:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 658:	31 c0                	xor    %eax,%eax
+ 65a:	eb 89                	jmp    5e5 <printint+0x25>
+ 65c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000660 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+ 663:	57                   	push   %edi
+ 664:	56                   	push   %esi
+ 665:	53                   	push   %ebx
+ 666:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 669:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 66c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 66f:	0f b6 1e             	movzbl (%esi),%ebx
+ 672:	83 c6 01             	add    $0x1,%esi
+ 675:	84 db                	test   %bl,%bl
+ 677:	74 67                	je     6e0 <printf+0x80>
+ 679:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 67c:	31 d2                	xor    %edx,%edx
+ 67e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 681:	eb 34                	jmp    6b7 <printf+0x57>
+ 683:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 687:	90                   	nop
+ 688:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 68b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 690:	83 f8 25             	cmp    $0x25,%eax
+ 693:	74 18                	je     6ad <printf+0x4d>
+  write(fd, &c, 1);
+ 695:	83 ec 04             	sub    $0x4,%esp
+ 698:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 69b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 69e:	6a 01                	push   $0x1
+ 6a0:	50                   	push   %eax
+ 6a1:	57                   	push   %edi
+ 6a2:	e8 cd fd ff ff       	call   474 <write>
+ 6a7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6aa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6ad:	0f b6 1e             	movzbl (%esi),%ebx
+ 6b0:	83 c6 01             	add    $0x1,%esi
+ 6b3:	84 db                	test   %bl,%bl
+ 6b5:	74 29                	je     6e0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6b7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6ba:	85 d2                	test   %edx,%edx
+ 6bc:	74 ca                	je     688 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6be:	83 fa 25             	cmp    $0x25,%edx
+ 6c1:	75 ea                	jne    6ad <printf+0x4d>
+      if(c == 'd'){
+ 6c3:	83 f8 25             	cmp    $0x25,%eax
+ 6c6:	0f 84 24 01 00 00    	je     7f0 <printf+0x190>
+ 6cc:	83 e8 63             	sub    $0x63,%eax
+ 6cf:	83 f8 15             	cmp    $0x15,%eax
+ 6d2:	77 1c                	ja     6f0 <printf+0x90>
+ 6d4:	ff 24 85 64 0b 00 00 	jmp    *0xb64(,%eax,4)
+ 6db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6df:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6e3:	5b                   	pop    %ebx
+ 6e4:	5e                   	pop    %esi
+ 6e5:	5f                   	pop    %edi
+ 6e6:	5d                   	pop    %ebp
+ 6e7:	c3                   	ret
+ 6e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6ef:	90                   	nop
+  write(fd, &c, 1);
+ 6f0:	83 ec 04             	sub    $0x4,%esp
+ 6f3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6f6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6fa:	6a 01                	push   $0x1
+ 6fc:	52                   	push   %edx
+ 6fd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 700:	57                   	push   %edi
+ 701:	e8 6e fd ff ff       	call   474 <write>
+ 706:	83 c4 0c             	add    $0xc,%esp
+ 709:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 70c:	6a 01                	push   $0x1
+ 70e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 711:	52                   	push   %edx
+ 712:	57                   	push   %edi
+ 713:	e8 5c fd ff ff       	call   474 <write>
+        putc(fd, c);
+ 718:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 71b:	31 d2                	xor    %edx,%edx
+ 71d:	eb 8e                	jmp    6ad <printf+0x4d>
+ 71f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 720:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 723:	83 ec 0c             	sub    $0xc,%esp
+ 726:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 72b:	8b 13                	mov    (%ebx),%edx
+ 72d:	6a 00                	push   $0x0
+ 72f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 731:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 734:	e8 87 fe ff ff       	call   5c0 <printint>
+        ap++;
+ 739:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 73c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 73f:	31 d2                	xor    %edx,%edx
+ 741:	e9 67 ff ff ff       	jmp    6ad <printf+0x4d>
+ 746:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 74d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 750:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 753:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 755:	83 c0 04             	add    $0x4,%eax
+ 758:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 75b:	85 db                	test   %ebx,%ebx
+ 75d:	0f 84 9d 00 00 00    	je     800 <printf+0x1a0>
+        while(*s != 0){
+ 763:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 766:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 768:	84 c0                	test   %al,%al
+ 76a:	0f 84 3d ff ff ff    	je     6ad <printf+0x4d>
+ 770:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 773:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 776:	89 de                	mov    %ebx,%esi
+ 778:	89 d3                	mov    %edx,%ebx
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 780:	83 ec 04             	sub    $0x4,%esp
+ 783:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 786:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 789:	6a 01                	push   $0x1
+ 78b:	53                   	push   %ebx
+ 78c:	57                   	push   %edi
+ 78d:	e8 e2 fc ff ff       	call   474 <write>
+        while(*s != 0){
+ 792:	0f b6 06             	movzbl (%esi),%eax
+ 795:	83 c4 10             	add    $0x10,%esp
+ 798:	84 c0                	test   %al,%al
+ 79a:	75 e4                	jne    780 <printf+0x120>
+      state = 0;
+ 79c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 79f:	31 d2                	xor    %edx,%edx
+ 7a1:	e9 07 ff ff ff       	jmp    6ad <printf+0x4d>
+ 7a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7ad:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7b3:	83 ec 0c             	sub    $0xc,%esp
+ 7b6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7bb:	8b 13                	mov    (%ebx),%edx
+ 7bd:	6a 01                	push   $0x1
+ 7bf:	e9 6b ff ff ff       	jmp    72f <printf+0xcf>
+ 7c4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7c8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7cb:	83 ec 04             	sub    $0x4,%esp
+ 7ce:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7d1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7d3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7d6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7d9:	6a 01                	push   $0x1
+ 7db:	52                   	push   %edx
+ 7dc:	57                   	push   %edi
+ 7dd:	e8 92 fc ff ff       	call   474 <write>
+        ap++;
+ 7e2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7e5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7e8:	31 d2                	xor    %edx,%edx
+ 7ea:	e9 be fe ff ff       	jmp    6ad <printf+0x4d>
+ 7ef:	90                   	nop
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7f6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	e9 11 ff ff ff       	jmp    711 <printf+0xb1>
+ 800:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 805:	bb 5c 0b 00 00       	mov    $0xb5c,%ebx
+ 80a:	e9 61 ff ff ff       	jmp    770 <printf+0x110>
+ 80f:	90                   	nop
+
+00000810 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 810:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 811:	a1 60 10 00 00       	mov    0x1060,%eax
+{
+ 816:	89 e5                	mov    %esp,%ebp
+ 818:	57                   	push   %edi
+ 819:	56                   	push   %esi
+ 81a:	53                   	push   %ebx
+ 81b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 81e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 821:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 828:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 82a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 82c:	39 ca                	cmp    %ecx,%edx
+ 82e:	73 30                	jae    860 <free+0x50>
+ 830:	39 c1                	cmp    %eax,%ecx
+ 832:	72 04                	jb     838 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 834:	39 c2                	cmp    %eax,%edx
+ 836:	72 f0                	jb     828 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 838:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 83b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 83e:	39 f8                	cmp    %edi,%eax
+ 840:	74 2e                	je     870 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 842:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 845:	8b 42 04             	mov    0x4(%edx),%eax
+ 848:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 84b:	39 f1                	cmp    %esi,%ecx
+ 84d:	74 38                	je     887 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 84f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 851:	5b                   	pop    %ebx
+  freep = p;
+ 852:	89 15 60 10 00 00    	mov    %edx,0x1060
+}
+ 858:	5e                   	pop    %esi
+ 859:	5f                   	pop    %edi
+ 85a:	5d                   	pop    %ebp
+ 85b:	c3                   	ret
+ 85c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 860:	39 c1                	cmp    %eax,%ecx
+ 862:	72 d0                	jb     834 <free+0x24>
+ 864:	eb c2                	jmp    828 <free+0x18>
+ 866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 870:	03 70 04             	add    0x4(%eax),%esi
+ 873:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 876:	8b 02                	mov    (%edx),%eax
+ 878:	8b 00                	mov    (%eax),%eax
+ 87a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 87d:	8b 42 04             	mov    0x4(%edx),%eax
+ 880:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 883:	39 f1                	cmp    %esi,%ecx
+ 885:	75 c8                	jne    84f <free+0x3f>
+    p->s.size += bp->s.size;
+ 887:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 88a:	89 15 60 10 00 00    	mov    %edx,0x1060
+    p->s.size += bp->s.size;
+ 890:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 893:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 896:	89 0a                	mov    %ecx,(%edx)
+}
+ 898:	5b                   	pop    %ebx
+ 899:	5e                   	pop    %esi
+ 89a:	5f                   	pop    %edi
+ 89b:	5d                   	pop    %ebp
+ 89c:	c3                   	ret
+ 89d:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008a0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	57                   	push   %edi
+ 8a4:	56                   	push   %esi
+ 8a5:	53                   	push   %ebx
+ 8a6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8ac:	8b 15 60 10 00 00    	mov    0x1060,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8b2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8b5:	c1 ef 03             	shr    $0x3,%edi
+ 8b8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8bb:	85 d2                	test   %edx,%edx
+ 8bd:	0f 84 8d 00 00 00    	je     950 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8c3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8c5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8c8:	39 f9                	cmp    %edi,%ecx
+ 8ca:	73 64                	jae    930 <malloc+0x90>
+  if(nu < 4096)
+ 8cc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8d1:	39 df                	cmp    %ebx,%edi
+ 8d3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8d6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8dd:	eb 0a                	jmp    8e9 <malloc+0x49>
+ 8df:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8e0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8e2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8e5:	39 f9                	cmp    %edi,%ecx
+ 8e7:	73 47                	jae    930 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8e9:	89 c2                	mov    %eax,%edx
+ 8eb:	39 05 60 10 00 00    	cmp    %eax,0x1060
+ 8f1:	75 ed                	jne    8e0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8f3:	83 ec 0c             	sub    $0xc,%esp
+ 8f6:	56                   	push   %esi
+ 8f7:	e8 e0 fb ff ff       	call   4dc <sbrk>
+  if(p == (char*)-1)
+ 8fc:	83 c4 10             	add    $0x10,%esp
+ 8ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 902:	74 1c                	je     920 <malloc+0x80>
+  hp->s.size = nu;
+ 904:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 907:	83 ec 0c             	sub    $0xc,%esp
+ 90a:	83 c0 08             	add    $0x8,%eax
+ 90d:	50                   	push   %eax
+ 90e:	e8 fd fe ff ff       	call   810 <free>
+  return freep;
+ 913:	8b 15 60 10 00 00    	mov    0x1060,%edx
+      if((p = morecore(nunits)) == 0)
+ 919:	83 c4 10             	add    $0x10,%esp
+ 91c:	85 d2                	test   %edx,%edx
+ 91e:	75 c0                	jne    8e0 <malloc+0x40>
+        return 0;
+  }
+}
+ 920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 923:	31 c0                	xor    %eax,%eax
+}
+ 925:	5b                   	pop    %ebx
+ 926:	5e                   	pop    %esi
+ 927:	5f                   	pop    %edi
+ 928:	5d                   	pop    %ebp
+ 929:	c3                   	ret
+ 92a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 930:	39 cf                	cmp    %ecx,%edi
+ 932:	74 4c                	je     980 <malloc+0xe0>
+        p->s.size -= nunits;
+ 934:	29 f9                	sub    %edi,%ecx
+ 936:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 939:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 93c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 93f:	89 15 60 10 00 00    	mov    %edx,0x1060
+}
+ 945:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 948:	83 c0 08             	add    $0x8,%eax
+}
+ 94b:	5b                   	pop    %ebx
+ 94c:	5e                   	pop    %esi
+ 94d:	5f                   	pop    %edi
+ 94e:	5d                   	pop    %ebp
+ 94f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 950:	c7 05 60 10 00 00 64 	movl   $0x1064,0x1060
+ 957:	10 00 00 
+    base.s.size = 0;
+ 95a:	b8 64 10 00 00       	mov    $0x1064,%eax
+    base.s.ptr = freep = prevp = &base;
+ 95f:	c7 05 64 10 00 00 64 	movl   $0x1064,0x1064
+ 966:	10 00 00 
+    base.s.size = 0;
+ 969:	c7 05 68 10 00 00 00 	movl   $0x0,0x1068
+ 970:	00 00 00 
+    if(p->s.size >= nunits){
+ 973:	e9 54 ff ff ff       	jmp    8cc <malloc+0x2c>
+ 978:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 97f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 980:	8b 08                	mov    (%eax),%ecx
+ 982:	89 0a                	mov    %ecx,(%edx)
+ 984:	eb b9                	jmp    93f <malloc+0x9f>
+ 986:	66 90                	xchg   %ax,%ax
+ 988:	66 90                	xchg   %ax,%ax
+ 98a:	66 90                	xchg   %ax,%ax
+ 98c:	66 90                	xchg   %ax,%ax
+ 98e:	66 90                	xchg   %ax,%ax
+
+00000990 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ 990:	55                   	push   %ebp
+ 991:	89 e5                	mov    %esp,%ebp
+ 993:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ 996:	8b 45 08             	mov    0x8(%ebp),%eax
+ 999:	c1 e0 04             	shl    $0x4,%eax
+ 99c:	ff b0 ac 10 00 00    	push   0x10ac(%eax)
+ 9a2:	05 a0 10 00 00       	add    $0x10a0,%eax
+ 9a7:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ 9aa:	e8 a5 fa ff ff       	call   454 <exit>
+ 9af:	90                   	nop
+
+000009b0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	57                   	push   %edi
+ 9b4:	56                   	push   %esi
+ 9b5:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ 9b6:	31 db                	xor    %ebx,%ebx
+{
+ 9b8:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ 9bb:	68 80 10 00 00       	push   $0x1080
+ 9c0:	e8 eb f8 ff ff       	call   2b0 <lock_acquire>
+ 9c5:	83 c4 10             	add    $0x10,%esp
+ 9c8:	eb 12                	jmp    9dc <thread_create+0x2c>
+ 9ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ 9d0:	83 c3 01             	add    $0x1,%ebx
+ 9d3:	83 fb 40             	cmp    $0x40,%ebx
+ 9d6:	0f 84 c4 00 00 00    	je     aa0 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ 9dc:	89 de                	mov    %ebx,%esi
+ 9de:	c1 e6 04             	shl    $0x4,%esi
+ 9e1:	8b 96 a0 10 00 00    	mov    0x10a0(%esi),%edx
+ 9e7:	85 d2                	test   %edx,%edx
+ 9e9:	75 e5                	jne    9d0 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ 9eb:	83 ec 0c             	sub    $0xc,%esp
+ 9ee:	68 00 20 00 00       	push   $0x2000
+ 9f3:	e8 a8 fe ff ff       	call   8a0 <malloc>
+ 9f8:	83 c4 10             	add    $0x10,%esp
+ 9fb:	85 c0                	test   %eax,%eax
+ 9fd:	0f 84 9d 00 00 00    	je     aa0 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ a03:	89 86 a4 10 00 00    	mov    %eax,0x10a4(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ a09:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ a0e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ a11:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ a16:	89 86 a0 10 00 00    	mov    %eax,0x10a0(%esi)
+  threads[i].fn = fn;
+ a1c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a1f:	89 86 a8 10 00 00    	mov    %eax,0x10a8(%esi)
+  threads[i].arg = arg;
+ a25:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a28:	89 86 ac 10 00 00    	mov    %eax,0x10ac(%esi)
+  lock_release(&threadslock);
+ a2e:	68 80 10 00 00       	push   $0x1080
+ a33:	e8 98 f8 ff ff       	call   2d0 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ a38:	83 c4 0c             	add    $0xc,%esp
+ a3b:	ff b6 a0 10 00 00    	push   0x10a0(%esi)
+ a41:	53                   	push   %ebx
+ a42:	68 90 09 00 00       	push   $0x990
+ a47:	e8 10 fb ff ff       	call   55c <clone>
+ a4c:	83 c4 10             	add    $0x10,%esp
+ a4f:	85 c0                	test   %eax,%eax
+ a51:	78 0d                	js     a60 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ a53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a56:	5b                   	pop    %ebx
+ a57:	5e                   	pop    %esi
+ a58:	5f                   	pop    %edi
+ a59:	5d                   	pop    %ebp
+ a5a:	c3                   	ret
+ a5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a5f:	90                   	nop
+    lock_acquire(&threadslock);
+ a60:	83 ec 0c             	sub    $0xc,%esp
+ a63:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ a66:	68 80 10 00 00       	push   $0x1080
+ a6b:	e8 40 f8 ff ff       	call   2b0 <lock_acquire>
+    free(threads[i].block);
+ a70:	58                   	pop    %eax
+ a71:	ff b6 a4 10 00 00    	push   0x10a4(%esi)
+ a77:	e8 94 fd ff ff       	call   810 <free>
+    threads[i].stack = 0;
+ a7c:	c7 86 a0 10 00 00 00 	movl   $0x0,0x10a0(%esi)
+ a83:	00 00 00 
+    lock_release(&threadslock);
+ a86:	c7 04 24 80 10 00 00 	movl   $0x1080,(%esp)
+ a8d:	e8 3e f8 ff ff       	call   2d0 <lock_release>
+ a92:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a95:	83 c4 10             	add    $0x10,%esp
+}
+ a98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a9b:	5b                   	pop    %ebx
+ a9c:	5e                   	pop    %esi
+ a9d:	5f                   	pop    %edi
+ a9e:	5d                   	pop    %ebp
+ a9f:	c3                   	ret
+    lock_release(&threadslock);
+ aa0:	83 ec 0c             	sub    $0xc,%esp
+ aa3:	68 80 10 00 00       	push   $0x1080
+ aa8:	e8 23 f8 ff ff       	call   2d0 <lock_release>
+    return -1;
+ aad:	83 c4 10             	add    $0x10,%esp
+ ab0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ab5:	eb 9c                	jmp    a53 <thread_create+0xa3>
+ ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ abe:	66 90                	xchg   %ax,%ax
+
+00000ac0 <thread_join>:
+
+int
+thread_join(void)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	56                   	push   %esi
+ ac4:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ ac5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ ac8:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ acb:	50                   	push   %eax
+ acc:	e8 93 fa ff ff       	call   564 <join>
+ ad1:	83 c4 10             	add    $0x10,%esp
+ ad4:	85 c0                	test   %eax,%eax
+ ad6:	78 69                	js     b41 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ ad8:	83 ec 0c             	sub    $0xc,%esp
+ adb:	89 c6                	mov    %eax,%esi
+ add:	68 80 10 00 00       	push   $0x1080
+ ae2:	e8 c9 f7 ff ff       	call   2b0 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ ae7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ aea:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ aed:	31 c0                	xor    %eax,%eax
+ aef:	eb 0f                	jmp    b00 <thread_join+0x40>
+ af1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ af8:	83 c0 01             	add    $0x1,%eax
+ afb:	83 f8 40             	cmp    $0x40,%eax
+ afe:	74 28                	je     b28 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ b00:	89 c3                	mov    %eax,%ebx
+ b02:	c1 e3 04             	shl    $0x4,%ebx
+ b05:	39 93 a0 10 00 00    	cmp    %edx,0x10a0(%ebx)
+ b0b:	75 eb                	jne    af8 <thread_join+0x38>
+      free(threads[i].block);
+ b0d:	83 ec 0c             	sub    $0xc,%esp
+ b10:	ff b3 a4 10 00 00    	push   0x10a4(%ebx)
+ b16:	e8 f5 fc ff ff       	call   810 <free>
+      threads[i].stack = 0;
+      break;
+ b1b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ b1e:	c7 83 a0 10 00 00 00 	movl   $0x0,0x10a0(%ebx)
+ b25:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ b28:	83 ec 0c             	sub    $0xc,%esp
+ b2b:	68 80 10 00 00       	push   $0x1080
+ b30:	e8 9b f7 ff ff       	call   2d0 <lock_release>
+  return pid;
+ b35:	83 c4 10             	add    $0x10,%esp
+}
+ b38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b3b:	89 f0                	mov    %esi,%eax
+ b3d:	5b                   	pop    %ebx
+ b3e:	5e                   	pop    %esi
+ b3f:	5d                   	pop    %ebp
+ b40:	c3                   	ret
+    return -1;
+ b41:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ b46:	eb f0                	jmp    b38 <thread_join+0x78>
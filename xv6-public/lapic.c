@@ -43,6 +43,16 @@
 
 volatile uint *lapic;  // Initialized in mp.c
 
+// Clock calibration, done once by the boot CPU.
+static uint lapictick;         // Timer counts per tick (10ms)
+static uint tscpertick;        // TSC cycles per tick
+static unsigned long long tsc0;  // TSC at calibration
+
+#define PIT_HZ       1193182   // 8254 PIT input clock
+#define PIT_CH2      0x42
+#define PIT_CMD      0x43
+#define PIT_GATE     0x61      // bit 0 gates channel 2, bit 5 is its output
+
 //PAGEBREAK!
 static void
 lapicw(int index, int value)
@@ -51,6 +61,38 @@ lapicw(int index, int value)
   lapic[ID];  // wait for write to finish, by reading
 }
 
+// Measure the timer and TSC rates against one tick (10ms)
+// of the PIT, whose input clock has a fixed frequency.
+static void
+lapiccalibrate(void)
+{
+  uint count;
+  unsigned long long t;
+
+  count = PIT_HZ / 100;
+  outb(PIT_GATE, inb(PIT_GATE) & ~0x03);  // gate off, speaker off
+  outb(PIT_CMD, 0xB0);                    // channel 2, mode 0, lo/hi
+  outb(PIT_CH2, count & 0xFF);
+  outb(PIT_CH2, count >> 8);
+
+  lapicw(TDCR, X1);
+  lapicw(TIMER, MASKED);
+  lapicw(TICR, 0xFFFFFFFF);
+  t = rdtsc();
+  outb(PIT_GATE, inb(PIT_GATE) | 0x01);   // start counting
+  while((inb(PIT_GATE) & 0x20) == 0)
+    ;
+  tsc0 = rdtsc();
+  lapictick = 0xFFFFFFFF - lapic[TCCR];
+  tscpertick = tsc0 - t;
+
+  // Fall back to the old fixed rate if the PIT looks absent.
+  if(lapictick == 0)
+    lapictick = 10000000;
+  if(tscpertick == 0)
+    tscpertick = 1;
+}
+
 void
 lapicinit(void)
 {
@@ -62,11 +104,10 @@ lapicinit(void)
 
   // The timer repeatedly counts down at bus frequency
   // from lapic[TICR] and then issues an interrupt.
-  // If xv6 cared more about precise timekeeping,
-  // TICR would be calibrated using an external time source.
-  lapicw(TDCR, X1);
-  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
-  lapicw(TICR, 10000000);
+  // TICR is calibrated against the PIT so that a tick is 10ms.
+  if(lapictick == 0)
+    lapiccalibrate();
+  lapicperiodic();
 
   // Disable logical interrupt lines.
   lapicw(LINT0, MASKED);
@@ -105,6 +146,86 @@ lapicid(void)
   return lapic[ID] >> 24;
 }
 
+// Run this CPU's timer periodically, one interrupt per tick.
+// Used whenever the CPU has a process that may need preempting.
+void
+lapicperiodic(void)
+{
+  if(!lapic)
+    return;
+  lapicw(TDCR, X1);
+  lapicw(TIMER, PERIODIC | (T_IRQ0 + IRQ_TIMER));
+  lapicw(TICR, lapictick);
+}
+
+// Fire this CPU's timer once, n ticks from now, or
+// never if n is 0.  Used by idle CPUs.
+void
+lapiconeshot(uint n)
+{
+  if(!lapic)
+    return;
+  if(n == 0){
+    lapicw(TIMER, MASKED);
+    return;
+  }
+  if(n > 0xFFFFFFFF / lapictick)
+    n = 0xFFFFFFFF / lapictick;  // wakes early; the caller re-arms
+  lapicw(TDCR, X1);
+  lapicw(TIMER, T_IRQ0 + IRQ_TIMER);
+  lapicw(TICR, n * lapictick);
+}
+
+// TSC cycles since boot divided by div, modulo 2^32.
+static uint
+tscdiv(uint div)
+{
+  unsigned long long d;
+  uint hi, lo, q;
+
+  d = rdtsc() - tsc0;
+  hi = d >> 32;
+  lo = d;
+  // 64-by-32 division, the low word of the quotient only;
+  // the kernel is not linked with libgcc.
+  hi %= div;
+  asm("divl %2" : "=a" (q), "=d" (hi) : "rm" (div), "a" (lo), "d" (hi));
+  return q;
+}
+
+// Ticks since boot, from the TSC.  The TSC keeps counting
+// while CPUs halt with their timers disarmed, so the clock
+// stays right however few timer interrupts arrive.
+uint
+lapicticks(void)
+{
+  if(!lapic)
+    return 0;
+  return tscdiv(tscpertick);
+}
+
+// Microseconds since boot, from the TSC; wraps every 71 minutes,
+// so only differences are meaningful.  A tick is 10ms.
+uint
+lapicusecs(void)
+{
+  if(!lapic)
+    return 0;
+  return tscdiv(tscpertick >= 10000 ? tscpertick / 10000 : 1);
+}
+
+// Interrupt the CPU with the given APIC ID, to break it out of hlt.
+void
+lapicwake(uchar apicid)
+{
+  if(!lapic)
+    return;
+  lapicw(ICRHI, apicid<<24);
+  lapicw(ICRLO, FIXED | ASSERT | (T_IRQ0 + IRQ_WAKE));
+  while(lapic[ICRLO] & DELIVS)
+    ;
+}
+
 // Acknowledge interrupt.
 void
 lapiceoi(void)
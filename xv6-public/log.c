@@ -5,6 +5,8 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "mmu.h"
+#include "proc.h"
 
 // Simple logging that allows concurrent FS system calls.
 //
@@ -17,20 +19,42 @@
 // A system call should call begin_op()/end_op() to mark
 // its start and end. Usually begin_op() just increments
 // the count of in-progress FS system calls and returns.
-// But if it thinks the log is close to running out, it
-// sleeps until the last outstanding end_op() commits.
+// But if the blocks it reserves might not fit in the log, it
+// sleeps until the transaction has been committed.  Each op
+// reserves MAXOPBLOCKS, or what it asks for with begin_opn(), and
+// its reservation shrinks as log_write() adds its blocks to the
+// log, so admission counts only blocks still to come.
+//
+// Commits are done by a kernel process, the log flusher, not by
+// the system calls.  A transaction stays open for LOGFLUSHTICKS
+// after its first write so that the ops of many system calls can
+// be committed together, and is committed sooner if the log fills
+// or somebody calls log_flush.  So end_op() returns before the
+// system call's updates are on disk; log_flush() (sys_fsync) waits
+// until they are.
 //
 // The log is a physical re-do log containing disk blocks.
-// The on-disk log format:
-//   header block, containing block #s for block A, B, C, ...
+// mkfs chooses its size, sb.nlog.  The on-disk log format:
+//   header blocks, containing n, a checksum, then block #s for
+//     block A, B, C, ...
 //   block A
 //   block B
 //   block C
 //   ...
-// Log appends are synchronous.
+// The header takes as many blocks as its n+HDRWORDS words need,
+// HDRSLOTS words to a block, and the blocks follow right after it.
+// The checksum covers the block #s and the blocks, so a commit is
+// a single write of the whole transaction, header included, which
+// recovery ignores unless it finds all of it on disk.  An installed
+// transaction is not erased: installing it again is harmless, and
+// the next commit overwrites it.
+
+#define HDRSLOTS (BSIZE / sizeof(uint))  // words per header block
+#define HDRWORDS 2                       // n and the checksum
+#define NHEAD(n) (((n) + HDRWORDS + HDRSLOTS - 1) / HDRSLOTS)
 
-// Contents of the header block, used for both the on-disk header block
-// and to keep track in memory of logged block# before commit.
+// The header, used to keep track in memory of logged block# before
+// commit.  read_head() and write_head() convert to the on-disk form.
 struct logheader {
   int n;
   int block[LOGSIZE];
@@ -39,121 +63,206 @@ struct logheader {
 struct log {
   struct spinlock lock;
   int start;
-  int size;
+  int nhead;       // header blocks at the start of the log
+  int size;        // data blocks after them
   int outstanding; // how many FS sys calls are executing.
+  int reserved;    // log blocks they may still add
   int committing;  // in commit(), please wait.
   int dev;
   struct logheader lh;
+
+  uint seq;        // number of the open transaction
+  uint done;       // number of the last committed one
+  uint first;      // tick of the open transaction's first write
+  uint deadline;   // tick the flusher is waiting for
+  int urgent;      // commit without waiting for the deadline
 };
 struct log log;
 
+// The bufs of one disk write, header and log blocks or home blocks.
+static struct buf *wb[NHEAD(LOGSIZE) + LOGSIZE];
+
 static void recover_from_log(void);
 static void commit();
+static void flusher(void);
 
 void
 initlog(int dev)
 {
-  if (sizeof(struct logheader) >= BSIZE)
-    panic("initlog: too big logheader");
-
   struct superblock sb;
   initlock(&log.lock, "log");
   readsb(dev, &sb);
   log.start = sb.logstart;
-  log.size = sb.nlog;
+  // fewest headers h with h*HDRSLOTS-HDRWORDS >= sb.nlog-h
+  log.nhead = (sb.nlog + HDRWORDS + HDRSLOTS) / (HDRSLOTS + 1);
+  log.size = sb.nlog - log.nhead;
+  if(log.size > LOGSIZE)
+    log.size = LOGSIZE;
+  if(log.size < 2*MAXOPBLOCKS)
+    panic("initlog: log too small");
   log.dev = dev;
+  log.seq = 1;
   recover_from_log();
+  if(kproc("logflush", flusher) < 0)
+    panic("initlog: no flusher");
+}
+
+// Add n bytes at p, a multiple of 4, to checksum sum.
+static uint
+cksum(uint sum, void *p, int n)
+{
+  uint *w = p;
+  int i;
+
+  for (i = 0; i < n/4; i++)
+    sum = ((sum << 7) | (sum >> 25)) + w[i];
+  return sum;
 }
 
-// Copy committed blocks from log to their home location
+// Copy committed blocks to their home location, from the cache
+// after a commit and from the log when recovering.  The home
+// blocks are written together.
 static void
-install_trans(void)
+install_trans(int recovering)
 {
   int tail;
 
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *lbuf = bread(log.dev, log.start+tail+1); // read log block
-    struct buf *dbuf = bread(log.dev, log.lh.block[tail]); // read dst
-    memmove(dbuf->data, lbuf->data, BSIZE);  // copy block to dst
-    bwrite(dbuf);  // write dst to disk
-    brelse(lbuf);
-    brelse(dbuf);
+    if (recovering) {
+      struct buf *lbuf = bread(log.dev, log.start+NHEAD(log.lh.n)+tail); // read log block
+      wb[tail] = bnew(log.dev, log.lh.block[tail]); // dst
+      memmove(wb[tail]->data, lbuf->data, BSIZE);  // copy block to dst
+      brelse(lbuf);
+    } else {
+      wb[tail] = bread(log.dev, log.lh.block[tail]); // still in the cache
+    }
   }
+  bwritev(wb, log.lh.n);  // write dst to disk
+  for (tail = 0; tail < log.lh.n; tail++)
+    brelse(wb[tail]);
 }
 
-// Read the log header from disk into the in-memory log header
-static void
+// Read the log header from disk into the in-memory log header.
+// Word k of the header is word k%HDRSLOTS of header block
+// k/HDRSLOTS.  Returns 1 if the checksum matches the header and
+// blocks in the log, else sets n to 0 and returns 0.
+static int
 read_head(void)
 {
   struct buf *buf = bread(log.dev, log.start);
-  struct logheader *lh = (struct logheader *) (buf->data);
-  int i;
-  log.lh.n = lh->n;
+  uint *hb = (uint*)buf->data;
+  uint want, sum;
+  int i, k;
+  if (hb[0] > log.size) {
+    brelse(buf);
+    log.lh.n = 0;
+    return 0;
+  }
+  log.lh.n = hb[0];
+  want = hb[1];
   for (i = 0; i < log.lh.n; i++) {
-    log.lh.block[i] = lh->block[i];
+    k = i + HDRWORDS;
+    if (k % HDRSLOTS == 0) {
+      brelse(buf);
+      buf = bread(log.dev, log.start + k/HDRSLOTS);
+      hb = (uint*)buf->data;
+    }
+    log.lh.block[i] = hb[k % HDRSLOTS];
   }
   brelse(buf);
-}
 
-// Write in-memory log header to disk.
-// This is the true point at which the
-// current transaction commits.
-static void
-write_head(void)
-{
-  struct buf *buf = bread(log.dev, log.start);
-  struct logheader *hb = (struct logheader *) (buf->data);
-  int i;
-  hb->n = log.lh.n;
+  if (log.lh.n == 0)
+    return 1;
+  sum = cksum(0, log.lh.block, log.lh.n * sizeof(uint));
   for (i = 0; i < log.lh.n; i++) {
-    hb->block[i] = log.lh.block[i];
+    buf = bread(log.dev, log.start+NHEAD(log.lh.n)+i);
+    sum = cksum(sum, buf->data, BSIZE);
+    brelse(buf);
   }
-  bwrite(buf);
-  brelse(buf);
+  if (sum != want) {
+    log.lh.n = 0;
+    return 0;
+  }
+  return 1;
 }
 
 static void
 recover_from_log(void)
 {
-  read_head();
-  install_trans(); // if committed, copy from log to disk
+  if (!read_head())
+    cprintf("log: discarding incomplete transaction\n");
+  install_trans(1); // if committed, copy from log to disk
   log.lh.n = 0;
-  write_head(); // clear the log
+}
+
+// Make the flusher commit now rather than at its deadline.
+// Caller must hold log.lock, which is released and reacquired.
+static void
+hurry(void)
+{
+  log.urgent = 1;
+  release(&log.lock);
+  acquire(&tickslock);
+  wakeup(tickchan(log.deadline));
+  release(&tickslock);
+  acquire(&log.lock);
 }
 
 // called at the start of each FS system call.
 void
 begin_op(void)
+{
+  begin_opn(MAXOPBLOCKS);
+}
+
+// Start an FS op that writes at most n blocks; n must not be
+// more than log_opmax().
+void
+begin_opn(int n)
 {
   acquire(&log.lock);
   while(1){
     if(log.committing){
       sleep(&log, &log.lock);
-    } else if(log.lh.n + (log.outstanding+1)*MAXOPBLOCKS > LOGSIZE){
+    } else if(log.lh.n + log.reserved + n > log.size){
       // this op might exhaust log space; wait for commit.
-      sleep(&log, &log.lock);
+      if(!log.urgent)
+        hurry();
+      else
+        sleep(&log, &log.lock);
     } else {
       log.outstanding += 1;
+      log.reserved += n;
+      myproc()->logres = n;
       release(&log.lock);
       break;
     }
   }
 }
 
+// The most blocks one op may reserve, leaving room in the log
+// for a few others.
+int
+log_opmax(void)
+{
+  if(log.size / 4 < 2*MAXOPBLOCKS)
+    return 2*MAXOPBLOCKS;
+  return log.size / 4;
+}
+
 // called at the end of each FS system call.
-// commits if this was the last outstanding operation.
+// the flusher commits the transaction later.
 void
 end_op(void)
 {
-  int do_commit = 0;
-
   acquire(&log.lock);
   log.outstanding -= 1;
-  if(log.committing)
-    panic("log.committing");
-  if(log.outstanding == 0){
-    do_commit = 1;
-    log.committing = 1;
+  log.reserved -= myproc()->logres;
+  myproc()->logres = 0;
+  if(log.committing){
+    // the flusher is waiting for the last op to finish.
+    if(log.outstanding == 0)
+      wakeup(&log.urgent);
   } else {
     // begin_op() may be waiting for log space,
     // and decrementing log.outstanding has decreased
@@ -161,43 +270,112 @@ end_op(void)
     wakeup(&log);
   }
   release(&log.lock);
+}
+
+// Wait until the updates of every FS system call that has
+// finished are on disk.
+void
+log_flush(void)
+{
+  uint seq;
+
+  acquire(&log.lock);
+  if(log.lh.n > 0){
+    seq = log.seq;
+    hurry();
+    while((int)(log.done - seq) < 0)
+      sleep(&log, &log.lock);
+  }
+  release(&log.lock);
+}
+
+// The log flusher, a kernel process.  Waits for a transaction to
+// get its first write, gives other system calls LOGFLUSHTICKS to
+// join it unless hurried, then waits for the ops in progress to
+// finish and commits.
+static void
+flusher(void)
+{
+  uint deadline;
+
+  for(;;){
+    // wait for a transaction; log_write() wakes us.
+    acquire(&log.lock);
+    while(log.lh.n == 0)
+      sleep(&log.urgent, &log.lock);
+    deadline = log.first + LOGFLUSHTICKS;
+    release(&log.lock);
+
+    // hurry() wakes us on the deadline's channel.
+    acquire(&tickslock);
+    log.deadline = deadline;
+    while((int)(ticks - deadline) < 0 && !log.urgent){
+      tickwait(deadline);
+      sleep(tickchan(deadline), &tickslock);
+    }
+    release(&tickslock);
+
+    // keep new ops out and wait for the ones in progress.
+    acquire(&log.lock);
+    log.committing = 1;
+    while(log.outstanding > 0)
+      sleep(&log.urgent, &log.lock);
+    release(&log.lock);
 
-  if(do_commit){
     // call commit w/o holding locks, since not allowed
     // to sleep with locks.
     commit();
+
     acquire(&log.lock);
     log.committing = 0;
+    log.urgent = 0;
+    log.done = log.seq++;
     wakeup(&log);
     release(&log.lock);
   }
 }
 
-// Copy modified blocks from cache to log.
+// Copy modified blocks from cache to log, behind a header with
+// their checksum, and write it all to disk at once.  Once the
+// write is done the transaction is committed.
 static void
 write_log(void)
 {
-  int tail;
+  struct buf *from;
+  uint sum, *hb;
+  int tail, nh, h, k;
 
+  nh = NHEAD(log.lh.n);
+  sum = cksum(0, log.lh.block, log.lh.n * sizeof(uint));
   for (tail = 0; tail < log.lh.n; tail++) {
-    struct buf *to = bread(log.dev, log.start+tail+1); // log block
-    struct buf *from = bread(log.dev, log.lh.block[tail]); // cache block
-    memmove(to->data, from->data, BSIZE);
-    bwrite(to);  // write the log
+    wb[nh+tail] = bnew(log.dev, log.start+nh+tail); // log block
+    from = bread(log.dev, log.lh.block[tail]); // cache block
+    memmove(wb[nh+tail]->data, from->data, BSIZE);
     brelse(from);
-    brelse(to);
+    sum = cksum(sum, wb[nh+tail]->data, BSIZE);
   }
+  for (h = 0; h < nh; h++) {
+    wb[h] = bnew(log.dev, log.start+h); // header block
+    hb = (uint*)wb[h]->data;
+    for (k = h*HDRSLOTS; k < (h+1)*HDRSLOTS; k++)
+      hb[k % HDRSLOTS] = k >= HDRWORDS && k-HDRWORDS < log.lh.n ?
+        log.lh.block[k-HDRWORDS] : 0;
+  }
+  hb = (uint*)wb[0]->data;
+  hb[0] = log.lh.n;
+  hb[1] = sum;
+  bwritev(wb, nh + log.lh.n);  // write the log -- the real commit
+  for (k = 0; k < nh + log.lh.n; k++)
+    brelse(wb[k]);
 }
 
 static void
 commit()
 {
   if (log.lh.n > 0) {
-    write_log();     // Write modified blocks from cache to log
-    write_head();    // Write header to disk -- the real commit
-    install_trans(); // Now install writes to home locations
+    write_log();      // Write header and modified blocks to log
+    install_trans(0); // Now install writes to home locations
     log.lh.n = 0;
-    write_head();    // Erase the transaction from the log
   }
 }
 
@@ -215,7 +393,7 @@ log_write(struct buf *b)
 {
   int i;
 
-  if (log.lh.n >= LOGSIZE || log.lh.n >= log.size - 1)
+  if (log.lh.n >= log.size)
     panic("too big a transaction");
   if (log.outstanding < 1)
     panic("log_write outside of trans");
@@ -226,8 +404,17 @@ log_write(struct buf *b)
       break;
   }
   log.lh.block[i] = b->blockno;
-  if (i == log.lh.n)
+  if (i == log.lh.n) {
+    if (log.lh.n == 0) {
+      log.first = ticks;
+      wakeup(&log.urgent); // the flusher waits for a first write
+    }
     log.lh.n++;
+    if (myproc()->logres > 0) {
+      myproc()->logres--;  // the block was reserved; now it is used
+      log.reserved--;
+    }
+  }
   b->flags |= B_DIRTY; // prevent eviction
   release(&log.lock);
 }
@@ -0,0 +1,2079 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	bb 01 00 00 00       	mov    $0x1,%ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 31                	mov    (%ecx),%esi
+  1b:	8b 79 04             	mov    0x4(%ecx),%edi
+  int i;
+
+  if(argc < 2){
+  1e:	83 fe 01             	cmp    $0x1,%esi
+  21:	7e 1f                	jle    42 <main+0x42>
+  23:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  27:	90                   	nop
+    ls(".");
+    exit();
+  }
+  for(i=1; i<argc; i++)
+    ls(argv[i]);
+  28:	83 ec 0c             	sub    $0xc,%esp
+  2b:	ff 34 9f             	push   (%edi,%ebx,4)
+  for(i=1; i<argc; i++)
+  2e:	83 c3 01             	add    $0x1,%ebx
+    ls(argv[i]);
+  31:	e8 ca 00 00 00       	call   100 <ls>
+  for(i=1; i<argc; i++)
+  36:	83 c4 10             	add    $0x10,%esp
+  39:	39 de                	cmp    %ebx,%esi
+  3b:	75 eb                	jne    28 <main+0x28>
+  exit();
+  3d:	e8 f2 06 00 00       	call   734 <exit>
+    ls(".");
+  42:	83 ec 0c             	sub    $0xc,%esp
+  45:	68 70 0e 00 00       	push   $0xe70
+  4a:	e8 b1 00 00 00       	call   100 <ls>
+    exit();
+  4f:	e8 e0 06 00 00       	call   734 <exit>
+  54:	66 90                	xchg   %ax,%ax
+  56:	66 90                	xchg   %ax,%ax
+  58:	66 90                	xchg   %ax,%ax
+  5a:	66 90                	xchg   %ax,%ax
+  5c:	66 90                	xchg   %ax,%ax
+  5e:	66 90                	xchg   %ax,%ax
+
+00000060 <fmtname>:
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	56                   	push   %esi
+  64:	53                   	push   %ebx
+  65:	8b 75 08             	mov    0x8(%ebp),%esi
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+  68:	83 ec 0c             	sub    $0xc,%esp
+  6b:	56                   	push   %esi
+  6c:	e8 5f 03 00 00       	call   3d0 <strlen>
+  71:	83 c4 10             	add    $0x10,%esp
+  74:	01 f0                	add    %esi,%eax
+  76:	89 c3                	mov    %eax,%ebx
+  78:	73 0f                	jae    89 <fmtname+0x29>
+  7a:	eb 12                	jmp    8e <fmtname+0x2e>
+  7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  80:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  83:	39 f0                	cmp    %esi,%eax
+  85:	72 0a                	jb     91 <fmtname+0x31>
+  87:	89 c3                	mov    %eax,%ebx
+  89:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  8c:	75 f2                	jne    80 <fmtname+0x20>
+  p++;
+  8e:	83 c3 01             	add    $0x1,%ebx
+  if(strlen(p) >= DIRSIZ)
+  91:	83 ec 0c             	sub    $0xc,%esp
+  94:	53                   	push   %ebx
+  95:	e8 36 03 00 00       	call   3d0 <strlen>
+  9a:	83 c4 10             	add    $0x10,%esp
+  9d:	83 f8 0d             	cmp    $0xd,%eax
+  a0:	77 4a                	ja     ec <fmtname+0x8c>
+  memmove(buf, p, strlen(p));
+  a2:	83 ec 0c             	sub    $0xc,%esp
+  a5:	53                   	push   %ebx
+  a6:	e8 25 03 00 00       	call   3d0 <strlen>
+  ab:	83 c4 0c             	add    $0xc,%esp
+  ae:	50                   	push   %eax
+  af:	53                   	push   %ebx
+  b0:	68 e0 13 00 00       	push   $0x13e0
+  b5:	e8 96 04 00 00       	call   550 <memmove>
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ba:	89 1c 24             	mov    %ebx,(%esp)
+  bd:	e8 0e 03 00 00       	call   3d0 <strlen>
+  c2:	89 1c 24             	mov    %ebx,(%esp)
+  return buf;
+  c5:	bb e0 13 00 00       	mov    $0x13e0,%ebx
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  ca:	89 c6                	mov    %eax,%esi
+  cc:	e8 ff 02 00 00       	call   3d0 <strlen>
+  d1:	ba 0e 00 00 00       	mov    $0xe,%edx
+  d6:	83 c4 0c             	add    $0xc,%esp
+  d9:	29 f2                	sub    %esi,%edx
+  db:	05 e0 13 00 00       	add    $0x13e0,%eax
+  e0:	52                   	push   %edx
+  e1:	6a 20                	push   $0x20
+  e3:	50                   	push   %eax
+  e4:	e8 17 03 00 00       	call   400 <memset>
+  return buf;
+  e9:	83 c4 10             	add    $0x10,%esp
+}
+  ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  ef:	89 d8                	mov    %ebx,%eax
+  f1:	5b                   	pop    %ebx
+  f2:	5e                   	pop    %esi
+  f3:	5d                   	pop    %ebp
+  f4:	c3                   	ret
+  f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000100 <ls>:
+{
+ 100:	55                   	push   %ebp
+ 101:	89 e5                	mov    %esp,%ebp
+ 103:	57                   	push   %edi
+ 104:	56                   	push   %esi
+ 105:	53                   	push   %ebx
+ 106:	81 ec 64 02 00 00    	sub    $0x264,%esp
+ 10c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if((fd = open(path, 0)) < 0){
+ 10f:	6a 00                	push   $0x0
+ 111:	57                   	push   %edi
+ 112:	e8 5d 06 00 00       	call   774 <open>
+ 117:	83 c4 10             	add    $0x10,%esp
+ 11a:	85 c0                	test   %eax,%eax
+ 11c:	0f 88 9e 01 00 00    	js     2c0 <ls+0x1c0>
+  if(fstat(fd, &st) < 0){
+ 122:	83 ec 08             	sub    $0x8,%esp
+ 125:	8d b5 d4 fd ff ff    	lea    -0x22c(%ebp),%esi
+ 12b:	89 c3                	mov    %eax,%ebx
+ 12d:	56                   	push   %esi
+ 12e:	50                   	push   %eax
+ 12f:	e8 58 06 00 00       	call   78c <fstat>
+ 134:	83 c4 10             	add    $0x10,%esp
+ 137:	85 c0                	test   %eax,%eax
+ 139:	0f 88 c1 01 00 00    	js     300 <ls+0x200>
+  switch(st.type){
+ 13f:	0f b7 85 d4 fd ff ff 	movzwl -0x22c(%ebp),%eax
+ 146:	66 83 f8 01          	cmp    $0x1,%ax
+ 14a:	74 64                	je     1b0 <ls+0xb0>
+ 14c:	66 83 f8 02          	cmp    $0x2,%ax
+ 150:	74 1e                	je     170 <ls+0x70>
+  close(fd);
+ 152:	83 ec 0c             	sub    $0xc,%esp
+ 155:	53                   	push   %ebx
+ 156:	e8 01 06 00 00       	call   75c <close>
+ 15b:	83 c4 10             	add    $0x10,%esp
+}
+ 15e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 161:	5b                   	pop    %ebx
+ 162:	5e                   	pop    %esi
+ 163:	5f                   	pop    %edi
+ 164:	5d                   	pop    %ebp
+ 165:	c3                   	ret
+ 166:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 16d:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 170:	8b 95 e4 fd ff ff    	mov    -0x21c(%ebp),%edx
+ 176:	83 ec 0c             	sub    $0xc,%esp
+ 179:	8b b5 dc fd ff ff    	mov    -0x224(%ebp),%esi
+ 17f:	89 95 b4 fd ff ff    	mov    %edx,-0x24c(%ebp)
+ 185:	57                   	push   %edi
+ 186:	e8 d5 fe ff ff       	call   60 <fmtname>
+ 18b:	8b 95 b4 fd ff ff    	mov    -0x24c(%ebp),%edx
+ 191:	59                   	pop    %ecx
+ 192:	5f                   	pop    %edi
+ 193:	52                   	push   %edx
+ 194:	56                   	push   %esi
+ 195:	6a 02                	push   $0x2
+ 197:	50                   	push   %eax
+ 198:	68 50 0e 00 00       	push   $0xe50
+ 19d:	6a 01                	push   $0x1
+ 19f:	e8 9c 07 00 00       	call   940 <printf>
+    break;
+ 1a4:	83 c4 20             	add    $0x20,%esp
+ 1a7:	eb a9                	jmp    152 <ls+0x52>
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 1b0:	83 ec 0c             	sub    $0xc,%esp
+ 1b3:	57                   	push   %edi
+ 1b4:	e8 17 02 00 00       	call   3d0 <strlen>
+ 1b9:	83 c4 10             	add    $0x10,%esp
+ 1bc:	83 c0 10             	add    $0x10,%eax
+ 1bf:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1c4:	0f 87 16 01 00 00    	ja     2e0 <ls+0x1e0>
+    strcpy(buf, path);
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	57                   	push   %edi
+ 1ce:	8d bd e8 fd ff ff    	lea    -0x218(%ebp),%edi
+ 1d4:	57                   	push   %edi
+ 1d5:	e8 66 01 00 00       	call   340 <strcpy>
+    p = buf+strlen(buf);
+ 1da:	89 3c 24             	mov    %edi,(%esp)
+ 1dd:	e8 ee 01 00 00       	call   3d0 <strlen>
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1e2:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1e5:	01 f8                	add    %edi,%eax
+    *p++ = '/';
+ 1e7:	8d 48 01             	lea    0x1(%eax),%ecx
+    p = buf+strlen(buf);
+ 1ea:	89 85 a8 fd ff ff    	mov    %eax,-0x258(%ebp)
+    *p++ = '/';
+ 1f0:	89 8d a4 fd ff ff    	mov    %ecx,-0x25c(%ebp)
+ 1f6:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 200:	83 ec 04             	sub    $0x4,%esp
+ 203:	8d 85 c4 fd ff ff    	lea    -0x23c(%ebp),%eax
+ 209:	6a 10                	push   $0x10
+ 20b:	50                   	push   %eax
+ 20c:	53                   	push   %ebx
+ 20d:	e8 3a 05 00 00       	call   74c <read>
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	83 f8 10             	cmp    $0x10,%eax
+ 218:	0f 85 34 ff ff ff    	jne    152 <ls+0x52>
+      if(de.inum == 0)
+ 21e:	66 83 bd c4 fd ff ff 	cmpw   $0x0,-0x23c(%ebp)
+ 225:	00 
+ 226:	74 d8                	je     200 <ls+0x100>
+      memmove(p, de.name, DIRSIZ);
+ 228:	83 ec 04             	sub    $0x4,%esp
+ 22b:	8d 85 c6 fd ff ff    	lea    -0x23a(%ebp),%eax
+ 231:	6a 0e                	push   $0xe
+ 233:	50                   	push   %eax
+ 234:	ff b5 a4 fd ff ff    	push   -0x25c(%ebp)
+ 23a:	e8 11 03 00 00       	call   550 <memmove>
+      p[DIRSIZ] = 0;
+ 23f:	8b 85 a8 fd ff ff    	mov    -0x258(%ebp),%eax
+ 245:	c6 40 0f 00          	movb   $0x0,0xf(%eax)
+      if(stat(buf, &st) < 0){
+ 249:	58                   	pop    %eax
+ 24a:	5a                   	pop    %edx
+ 24b:	56                   	push   %esi
+ 24c:	57                   	push   %edi
+ 24d:	e8 6e 02 00 00       	call   4c0 <stat>
+ 252:	83 c4 10             	add    $0x10,%esp
+ 255:	85 c0                	test   %eax,%eax
+ 257:	0f 88 cb 00 00 00    	js     328 <ls+0x228>
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 25d:	8b 8d e4 fd ff ff    	mov    -0x21c(%ebp),%ecx
+ 263:	8b 95 dc fd ff ff    	mov    -0x224(%ebp),%edx
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	0f bf 85 d4 fd ff ff 	movswl -0x22c(%ebp),%eax
+ 273:	89 8d ac fd ff ff    	mov    %ecx,-0x254(%ebp)
+ 279:	89 95 b0 fd ff ff    	mov    %edx,-0x250(%ebp)
+ 27f:	89 85 b4 fd ff ff    	mov    %eax,-0x24c(%ebp)
+ 285:	57                   	push   %edi
+ 286:	e8 d5 fd ff ff       	call   60 <fmtname>
+ 28b:	5a                   	pop    %edx
+ 28c:	59                   	pop    %ecx
+ 28d:	8b 8d ac fd ff ff    	mov    -0x254(%ebp),%ecx
+ 293:	51                   	push   %ecx
+ 294:	8b 95 b0 fd ff ff    	mov    -0x250(%ebp),%edx
+ 29a:	52                   	push   %edx
+ 29b:	ff b5 b4 fd ff ff    	push   -0x24c(%ebp)
+ 2a1:	50                   	push   %eax
+ 2a2:	68 50 0e 00 00       	push   $0xe50
+ 2a7:	6a 01                	push   $0x1
+ 2a9:	e8 92 06 00 00       	call   940 <printf>
+ 2ae:	83 c4 20             	add    $0x20,%esp
+ 2b1:	e9 4a ff ff ff       	jmp    200 <ls+0x100>
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+    printf(2, "ls: cannot open %s\n", path);
+ 2c0:	83 ec 04             	sub    $0x4,%esp
+ 2c3:	57                   	push   %edi
+ 2c4:	68 28 0e 00 00       	push   $0xe28
+ 2c9:	6a 02                	push   $0x2
+ 2cb:	e8 70 06 00 00       	call   940 <printf>
+    return;
+ 2d0:	83 c4 10             	add    $0x10,%esp
+}
+ 2d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2d6:	5b                   	pop    %ebx
+ 2d7:	5e                   	pop    %esi
+ 2d8:	5f                   	pop    %edi
+ 2d9:	5d                   	pop    %ebp
+ 2da:	c3                   	ret
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+      printf(1, "ls: path too long\n");
+ 2e0:	83 ec 08             	sub    $0x8,%esp
+ 2e3:	68 5d 0e 00 00       	push   $0xe5d
+ 2e8:	6a 01                	push   $0x1
+ 2ea:	e8 51 06 00 00       	call   940 <printf>
+      break;
+ 2ef:	83 c4 10             	add    $0x10,%esp
+ 2f2:	e9 5b fe ff ff       	jmp    152 <ls+0x52>
+ 2f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fe:	66 90                	xchg   %ax,%ax
+    printf(2, "ls: cannot stat %s\n", path);
+ 300:	83 ec 04             	sub    $0x4,%esp
+ 303:	57                   	push   %edi
+ 304:	68 3c 0e 00 00       	push   $0xe3c
+ 309:	6a 02                	push   $0x2
+ 30b:	e8 30 06 00 00       	call   940 <printf>
+    close(fd);
+ 310:	89 1c 24             	mov    %ebx,(%esp)
+ 313:	e8 44 04 00 00       	call   75c <close>
+    return;
+ 318:	83 c4 10             	add    $0x10,%esp
+}
+ 31b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 31e:	5b                   	pop    %ebx
+ 31f:	5e                   	pop    %esi
+ 320:	5f                   	pop    %edi
+ 321:	5d                   	pop    %ebp
+ 322:	c3                   	ret
+ 323:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 327:	90                   	nop
+        printf(1, "ls: cannot stat %s\n", buf);
+ 328:	83 ec 04             	sub    $0x4,%esp
+ 32b:	57                   	push   %edi
+ 32c:	68 3c 0e 00 00       	push   $0xe3c
+ 331:	6a 01                	push   $0x1
+ 333:	e8 08 06 00 00       	call   940 <printf>
+        continue;
+ 338:	83 c4 10             	add    $0x10,%esp
+ 33b:	e9 c0 fe ff ff       	jmp    200 <ls+0x100>
+
+00000340 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 340:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 341:	31 c0                	xor    %eax,%eax
+{
+ 343:	89 e5                	mov    %esp,%ebp
+ 345:	53                   	push   %ebx
+ 346:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 34c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 350:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 354:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 357:	83 c0 01             	add    $0x1,%eax
+ 35a:	84 d2                	test   %dl,%dl
+ 35c:	75 f2                	jne    350 <strcpy+0x10>
+    ;
+  return os;
+}
+ 35e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 361:	89 c8                	mov    %ecx,%eax
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+ 365:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	53                   	push   %ebx
+ 374:	8b 55 08             	mov    0x8(%ebp),%edx
+ 377:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 37a:	0f b6 02             	movzbl (%edx),%eax
+ 37d:	84 c0                	test   %al,%al
+ 37f:	75 17                	jne    398 <strcmp+0x28>
+ 381:	eb 3a                	jmp    3bd <strcmp+0x4d>
+ 383:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 387:	90                   	nop
+ 388:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 38c:	83 c2 01             	add    $0x1,%edx
+ 38f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 392:	84 c0                	test   %al,%al
+ 394:	74 1a                	je     3b0 <strcmp+0x40>
+    p++, q++;
+ 396:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 398:	0f b6 19             	movzbl (%ecx),%ebx
+ 39b:	38 c3                	cmp    %al,%bl
+ 39d:	74 e9                	je     388 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 39f:	29 d8                	sub    %ebx,%eax
+}
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 3b0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 3b4:	31 c0                	xor    %eax,%eax
+ 3b6:	29 d8                	sub    %ebx,%eax
+}
+ 3b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3bb:	c9                   	leave
+ 3bc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 3bd:	0f b6 19             	movzbl (%ecx),%ebx
+ 3c0:	31 c0                	xor    %eax,%eax
+ 3c2:	eb db                	jmp    39f <strcmp+0x2f>
+ 3c4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3cf:	90                   	nop
+
+000003d0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 3d6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 3d9:	74 15                	je     3f0 <strlen+0x20>
+ 3db:	31 c0                	xor    %eax,%eax
+ 3dd:	8d 76 00             	lea    0x0(%esi),%esi
+ 3e0:	83 c0 01             	add    $0x1,%eax
+ 3e3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 3e7:	89 c1                	mov    %eax,%ecx
+ 3e9:	75 f5                	jne    3e0 <strlen+0x10>
+    ;
+  return n;
+}
+ 3eb:	89 c8                	mov    %ecx,%eax
+ 3ed:	5d                   	pop    %ebp
+ 3ee:	c3                   	ret
+ 3ef:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 3f0:	31 c9                	xor    %ecx,%ecx
+}
+ 3f2:	5d                   	pop    %ebp
+ 3f3:	89 c8                	mov    %ecx,%eax
+ 3f5:	c3                   	ret
+ 3f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3fd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000400 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 407:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 40a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40d:	89 d7                	mov    %edx,%edi
+ 40f:	fc                   	cld
+ 410:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 412:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 415:	89 d0                	mov    %edx,%eax
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+ 419:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000420 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	8b 45 08             	mov    0x8(%ebp),%eax
+ 426:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 42a:	0f b6 10             	movzbl (%eax),%edx
+ 42d:	84 d2                	test   %dl,%dl
+ 42f:	75 12                	jne    443 <strchr+0x23>
+ 431:	eb 1d                	jmp    450 <strchr+0x30>
+ 433:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 437:	90                   	nop
+ 438:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 43c:	83 c0 01             	add    $0x1,%eax
+ 43f:	84 d2                	test   %dl,%dl
+ 441:	74 0d                	je     450 <strchr+0x30>
+    if(*s == c)
+ 443:	38 d1                	cmp    %dl,%cl
+ 445:	75 f1                	jne    438 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 447:	5d                   	pop    %ebp
+ 448:	c3                   	ret
+ 449:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 450:	31 c0                	xor    %eax,%eax
+}
+ 452:	5d                   	pop    %ebp
+ 453:	c3                   	ret
+ 454:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 45f:	90                   	nop
+
+00000460 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 465:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 468:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 469:	31 db                	xor    %ebx,%ebx
+{
+ 46b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 46e:	eb 27                	jmp    497 <gets+0x37>
+    cc = read(0, &c, 1);
+ 470:	83 ec 04             	sub    $0x4,%esp
+ 473:	6a 01                	push   $0x1
+ 475:	56                   	push   %esi
+ 476:	6a 00                	push   $0x0
+ 478:	e8 cf 02 00 00       	call   74c <read>
+    if(cc < 1)
+ 47d:	83 c4 10             	add    $0x10,%esp
+ 480:	85 c0                	test   %eax,%eax
+ 482:	7e 1d                	jle    4a1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 484:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 48f:	3c 0a                	cmp    $0xa,%al
+ 491:	74 10                	je     4a3 <gets+0x43>
+ 493:	3c 0d                	cmp    $0xd,%al
+ 495:	74 0c                	je     4a3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 497:	89 df                	mov    %ebx,%edi
+ 499:	83 c3 01             	add    $0x1,%ebx
+ 49c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 49f:	7c cf                	jl     470 <gets+0x10>
+ 4a1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 4aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 4ad:	5b                   	pop    %ebx
+ 4ae:	5e                   	pop    %esi
+ 4af:	5f                   	pop    %edi
+ 4b0:	5d                   	pop    %ebp
+ 4b1:	c3                   	ret
+ 4b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004c0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+ 4c3:	56                   	push   %esi
+ 4c4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	6a 00                	push   $0x0
+ 4ca:	ff 75 08             	push   0x8(%ebp)
+ 4cd:	e8 a2 02 00 00       	call   774 <open>
+  if(fd < 0)
+ 4d2:	83 c4 10             	add    $0x10,%esp
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	78 27                	js     500 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	ff 75 0c             	push   0xc(%ebp)
+ 4df:	89 c3                	mov    %eax,%ebx
+ 4e1:	50                   	push   %eax
+ 4e2:	e8 a5 02 00 00       	call   78c <fstat>
+  close(fd);
+ 4e7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 4ea:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 4ec:	e8 6b 02 00 00       	call   75c <close>
+  return r;
+ 4f1:	83 c4 10             	add    $0x10,%esp
+}
+ 4f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4f7:	89 f0                	mov    %esi,%eax
+ 4f9:	5b                   	pop    %ebx
+ 4fa:	5e                   	pop    %esi
+ 4fb:	5d                   	pop    %ebp
+ 4fc:	c3                   	ret
+ 4fd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 500:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 505:	eb ed                	jmp    4f4 <stat+0x34>
+ 507:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	53                   	push   %ebx
+ 514:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 517:	0f be 02             	movsbl (%edx),%eax
+ 51a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 51d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 520:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 525:	77 1e                	ja     545 <atoi+0x35>
+ 527:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 52e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 530:	83 c2 01             	add    $0x1,%edx
+ 533:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 536:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 53a:	0f be 02             	movsbl (%edx),%eax
+ 53d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 540:	80 fb 09             	cmp    $0x9,%bl
+ 543:	76 eb                	jbe    530 <atoi+0x20>
+  return n;
+}
+ 545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 548:	89 c8                	mov    %ecx,%eax
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	57                   	push   %edi
+ 554:	56                   	push   %esi
+ 555:	8b 45 10             	mov    0x10(%ebp),%eax
+ 558:	8b 55 08             	mov    0x8(%ebp),%edx
+ 55b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 55e:	85 c0                	test   %eax,%eax
+ 560:	7e 13                	jle    575 <memmove+0x25>
+ 562:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 564:	89 d7                	mov    %edx,%edi
+ 566:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 570:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 571:	39 f8                	cmp    %edi,%eax
+ 573:	75 fb                	jne    570 <memmove+0x20>
+  return vdst;
+}
+ 575:	5e                   	pop    %esi
+ 576:	89 d0                	mov    %edx,%eax
+ 578:	5f                   	pop    %edi
+ 579:	5d                   	pop    %ebp
+ 57a:	c3                   	ret
+ 57b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 57f:	90                   	nop
+
+00000580 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 580:	55                   	push   %ebp
+ 581:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 583:	8b 45 08             	mov    0x8(%ebp),%eax
+ 586:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 58c:	5d                   	pop    %ebp
+ 58d:	c3                   	ret
+ 58e:	66 90                	xchg   %ax,%ax
+
+00000590 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 590:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 591:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 596:	89 e5                	mov    %esp,%ebp
+ 598:	8b 55 08             	mov    0x8(%ebp),%edx
+ 59b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 59f:	90                   	nop
+ 5a0:	89 c8                	mov    %ecx,%eax
+ 5a2:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 5a5:	85 c0                	test   %eax,%eax
+ 5a7:	75 f7                	jne    5a0 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 5a9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 5ae:	5d                   	pop    %ebp
+ 5af:	c3                   	ret
+
+000005b0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	31 c0                	xor    %eax,%eax
+ 5b3:	89 e5                	mov    %esp,%ebp
+ 5b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 5b8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 5bd:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 5c0:	5d                   	pop    %ebp
+ 5c1:	c3                   	ret
+ 5c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 5c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000005d0 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 5d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5dc:	5d                   	pop    %ebp
+ 5dd:	c3                   	ret
+ 5de:	66 90                	xchg   %ax,%ax
+
+000005e0 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5e6:	89 e5                	mov    %esp,%ebp
+ 5e8:	56                   	push   %esi
+ 5e9:	53                   	push   %ebx
+ 5ea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 5ed:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 5f0:	85 c0                	test   %eax,%eax
+ 5f2:	74 2d                	je     621 <mutex_lock+0x41>
+ 5f4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5f9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 5fc:	85 c0                	test   %eax,%eax
+ 5fe:	74 21                	je     621 <mutex_lock+0x41>
+ 600:	be 02 00 00 00       	mov    $0x2,%esi
+ 605:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 608:	83 ec 04             	sub    $0x4,%esp
+ 60b:	6a 02                	push   $0x2
+ 60d:	6a 00                	push   $0x0
+ 60f:	53                   	push   %ebx
+ 610:	e8 37 02 00 00       	call   84c <futex>
+ 615:	89 f0                	mov    %esi,%eax
+ 617:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 61a:	83 c4 10             	add    $0x10,%esp
+ 61d:	85 c0                	test   %eax,%eax
+ 61f:	75 e7                	jne    608 <mutex_lock+0x28>
+}
+ 621:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 624:	5b                   	pop    %ebx
+ 625:	5e                   	pop    %esi
+ 626:	5d                   	pop    %ebp
+ 627:	c3                   	ret
+ 628:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 62f:	90                   	nop
+
+00000630 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 630:	55                   	push   %ebp
+ 631:	31 c0                	xor    %eax,%eax
+ 633:	89 e5                	mov    %esp,%ebp
+ 635:	83 ec 08             	sub    $0x8,%esp
+ 638:	8b 55 08             	mov    0x8(%ebp),%edx
+ 63b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 63e:	83 f8 02             	cmp    $0x2,%eax
+ 641:	74 05                	je     648 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 643:	c9                   	leave
+ 644:	c3                   	ret
+ 645:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 648:	83 ec 04             	sub    $0x4,%esp
+ 64b:	6a 01                	push   $0x1
+ 64d:	6a 01                	push   $0x1
+ 64f:	52                   	push   %edx
+ 650:	e8 f7 01 00 00       	call   84c <futex>
+ 655:	83 c4 10             	add    $0x10,%esp
+}
+ 658:	c9                   	leave
+ 659:	c3                   	ret
+ 65a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000660 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 660:	55                   	push   %ebp
+ 661:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 663:	8b 45 08             	mov    0x8(%ebp),%eax
+ 666:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 66c:	5d                   	pop    %ebp
+ 66d:	c3                   	ret
+ 66e:	66 90                	xchg   %ax,%ax
+
+00000670 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 670:	55                   	push   %ebp
+ 671:	31 c0                	xor    %eax,%eax
+ 673:	89 e5                	mov    %esp,%ebp
+ 675:	57                   	push   %edi
+ 676:	56                   	push   %esi
+ 677:	53                   	push   %ebx
+ 678:	83 ec 0c             	sub    $0xc,%esp
+ 67b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 67e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 681:	8b 3e                	mov    (%esi),%edi
+ 683:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 686:	83 f8 02             	cmp    $0x2,%eax
+ 689:	74 4d                	je     6d8 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 68b:	83 ec 04             	sub    $0x4,%esp
+ 68e:	57                   	push   %edi
+ 68f:	6a 00                	push   $0x0
+ 691:	56                   	push   %esi
+ 692:	e8 b5 01 00 00       	call   84c <futex>
+ 697:	b8 02 00 00 00       	mov    $0x2,%eax
+ 69c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 69f:	83 c4 10             	add    $0x10,%esp
+ 6a2:	85 c0                	test   %eax,%eax
+ 6a4:	74 23                	je     6c9 <cond_wait+0x59>
+ 6a6:	be 02 00 00 00       	mov    $0x2,%esi
+ 6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 6b0:	83 ec 04             	sub    $0x4,%esp
+ 6b3:	6a 02                	push   $0x2
+ 6b5:	6a 00                	push   $0x0
+ 6b7:	53                   	push   %ebx
+ 6b8:	e8 8f 01 00 00       	call   84c <futex>
+ 6bd:	89 f0                	mov    %esi,%eax
+ 6bf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 6c2:	83 c4 10             	add    $0x10,%esp
+ 6c5:	85 c0                	test   %eax,%eax
+ 6c7:	75 e7                	jne    6b0 <cond_wait+0x40>
+}
+ 6c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6cc:	5b                   	pop    %ebx
+ 6cd:	5e                   	pop    %esi
+ 6ce:	5f                   	pop    %edi
+ 6cf:	5d                   	pop    %ebp
+ 6d0:	c3                   	ret
+ 6d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 6d8:	83 ec 04             	sub    $0x4,%esp
+ 6db:	6a 01                	push   $0x1
+ 6dd:	6a 01                	push   $0x1
+ 6df:	53                   	push   %ebx
+ 6e0:	e8 67 01 00 00       	call   84c <futex>
+ 6e5:	83 c4 10             	add    $0x10,%esp
+ 6e8:	eb a1                	jmp    68b <cond_wait+0x1b>
+ 6ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000006f0 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 6f0:	55                   	push   %ebp
+ 6f1:	89 e5                	mov    %esp,%ebp
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 6f9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 6fd:	6a 01                	push   $0x1
+ 6ff:	6a 01                	push   $0x1
+ 701:	50                   	push   %eax
+ 702:	e8 45 01 00 00       	call   84c <futex>
+}
+ 707:	83 c4 10             	add    $0x10,%esp
+ 70a:	c9                   	leave
+ 70b:	c3                   	ret
+ 70c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000710 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 710:	55                   	push   %ebp
+ 711:	89 e5                	mov    %esp,%ebp
+ 713:	83 ec 0c             	sub    $0xc,%esp
+ 716:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 719:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 71d:	6a ff                	push   $0xffffffff
+ 71f:	6a 01                	push   $0x1
+ 721:	50                   	push   %eax
+ 722:	e8 25 01 00 00       	call   84c <futex>
+}
+ 727:	83 c4 10             	add    $0x10,%esp
+ 72a:	c9                   	leave
+ 72b:	c3                   	ret
+
+0000072c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 72c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <exit>:
+SYSCALL(exit)
+ 734:	b8 02 00 00 00       	mov    $0x2,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <wait>:
+SYSCALL(wait)
+ 73c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <pipe>:
+SYSCALL(pipe)
+ 744:	b8 04 00 00 00       	mov    $0x4,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <read>:
+SYSCALL(read)
+ 74c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <write>:
+SYSCALL(write)
+ 754:	b8 10 00 00 00       	mov    $0x10,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <close>:
+SYSCALL(close)
+ 75c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <kill>:
+SYSCALL(kill)
+ 764:	b8 06 00 00 00       	mov    $0x6,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <exec>:
+SYSCALL(exec)
+ 76c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 771:	cd 40                	int    $0x40
+ 773:	c3                   	ret
+
+00000774 <open>:
+SYSCALL(open)
+ 774:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 779:	cd 40                	int    $0x40
+ 77b:	c3                   	ret
+
+0000077c <mknod>:
+SYSCALL(mknod)
+ 77c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 781:	cd 40                	int    $0x40
+ 783:	c3                   	ret
+
+00000784 <unlink>:
+SYSCALL(unlink)
+ 784:	b8 12 00 00 00       	mov    $0x12,%eax
+ 789:	cd 40                	int    $0x40
+ 78b:	c3                   	ret
+
+0000078c <fstat>:
+SYSCALL(fstat)
+ 78c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 791:	cd 40                	int    $0x40
+ 793:	c3                   	ret
+
+00000794 <link>:
+SYSCALL(link)
+ 794:	b8 13 00 00 00       	mov    $0x13,%eax
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <mkdir>:
+SYSCALL(mkdir)
+ 79c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7a1:	cd 40                	int    $0x40
+ 7a3:	c3                   	ret
+
+000007a4 <chdir>:
+SYSCALL(chdir)
+ 7a4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7a9:	cd 40                	int    $0x40
+ 7ab:	c3                   	ret
+
+000007ac <dup>:
+SYSCALL(dup)
+ 7ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7b1:	cd 40                	int    $0x40
+ 7b3:	c3                   	ret
+
+000007b4 <getpid>:
+SYSCALL(getpid)
+ 7b4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7b9:	cd 40                	int    $0x40
+ 7bb:	c3                   	ret
+
+000007bc <sbrk>:
+SYSCALL(sbrk)
+ 7bc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7c1:	cd 40                	int    $0x40
+ 7c3:	c3                   	ret
+
+000007c4 <sleep>:
+SYSCALL(sleep)
+ 7c4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7c9:	cd 40                	int    $0x40
+ 7cb:	c3                   	ret
+
+000007cc <uptime>:
+SYSCALL(uptime)
+ 7cc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7d1:	cd 40                	int    $0x40
+ 7d3:	c3                   	ret
+
+000007d4 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 7d4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7d9:	cd 40                	int    $0x40
+ 7db:	c3                   	ret
+
+000007dc <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 7dc:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7e1:	cd 40                	int    $0x40
+ 7e3:	c3                   	ret
+
+000007e4 <wmap>:
+SYSCALL(wmap)
+ 7e4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7e9:	cd 40                	int    $0x40
+ 7eb:	c3                   	ret
+
+000007ec <wunmap>:
+SYSCALL(wunmap)
+ 7ec:	b8 17 00 00 00       	mov    $0x17,%eax
+ 7f1:	cd 40                	int    $0x40
+ 7f3:	c3                   	ret
+
+000007f4 <wremap>:
+SYSCALL(wremap)
+ 7f4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 7f9:	cd 40                	int    $0x40
+ 7fb:	c3                   	ret
+
+000007fc <wmlock>:
+SYSCALL(wmlock)
+ 7fc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 801:	cd 40                	int    $0x40
+ 803:	c3                   	ret
+
+00000804 <wmunlock>:
+SYSCALL(wmunlock)
+ 804:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 809:	cd 40                	int    $0x40
+ 80b:	c3                   	ret
+
+0000080c <wmapoff>:
+SYSCALL(wmapoff)
+ 80c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 811:	cd 40                	int    $0x40
+ 813:	c3                   	ret
+
+00000814 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 814:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 819:	cd 40                	int    $0x40
+ 81b:	c3                   	ret
+
+0000081c <setpriority>:
+SYSCALL(setpriority)
+ 81c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 821:	cd 40                	int    $0x40
+ 823:	c3                   	ret
+
+00000824 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 824:	b8 20 00 00 00       	mov    $0x20,%eax
+ 829:	cd 40                	int    $0x40
+ 82b:	c3                   	ret
+
+0000082c <settickets>:
+SYSCALL(settickets)
+ 82c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 831:	cd 40                	int    $0x40
+ 833:	c3                   	ret
+
+00000834 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 834:	b8 22 00 00 00       	mov    $0x22,%eax
+ 839:	cd 40                	int    $0x40
+ 83b:	c3                   	ret
+
+0000083c <clone>:
+SYSCALL(clone)
+ 83c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 841:	cd 40                	int    $0x40
+ 843:	c3                   	ret
+
+00000844 <join>:
+SYSCALL(join)
+ 844:	b8 24 00 00 00       	mov    $0x24,%eax
+ 849:	cd 40                	int    $0x40
+ 84b:	c3                   	ret
+
+0000084c <futex>:
+SYSCALL(futex)
+ 84c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 851:	cd 40                	int    $0x40
+ 853:	c3                   	ret
+
+00000854 <setaffinity>:
+SYSCALL(setaffinity)
+ 854:	b8 26 00 00 00       	mov    $0x26,%eax
+ 859:	cd 40                	int    $0x40
+ 85b:	c3                   	ret
+
+0000085c <getaffinity>:
+SYSCALL(getaffinity)
+ 85c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 861:	cd 40                	int    $0x40
+ 863:	c3                   	ret
+
+00000864 <bcstat>:
+SYSCALL(bcstat)
+ 864:	b8 29 00 00 00       	mov    $0x29,%eax
+ 869:	cd 40                	int    $0x40
+ 86b:	c3                   	ret
+
+0000086c <dropcache>:
+SYSCALL(dropcache)
+ 86c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 871:	cd 40                	int    $0x40
+ 873:	c3                   	ret
+
+00000874 <setiosched>:
+SYSCALL(setiosched)
+ 874:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 879:	cd 40                	int    $0x40
+ 87b:	c3                   	ret
+
+0000087c <iostat>:
+SYSCALL(iostat)
+ 87c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 881:	cd 40                	int    $0x40
+ 883:	c3                   	ret
+
+00000884 <fsync>:
+SYSCALL(fsync)
+ 884:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 889:	cd 40                	int    $0x40
+ 88b:	c3                   	ret
+
+0000088c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 88c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 88d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 892:	cd 40                	int    $0x40
+ 894:	ff e1                	jmp    *%ecx
+ 896:	66 90                	xchg   %ax,%ax
+ 898:	66 90                	xchg   %ax,%ax
+ 89a:	66 90                	xchg   %ax,%ax
+ 89c:	66 90                	xchg   %ax,%ax
+ 89e:	66 90                	xchg   %ax,%ax
+
+000008a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8a0:	55                   	push   %ebp
+ 8a1:	89 e5                	mov    %esp,%ebp
+ 8a3:	57                   	push   %edi
+ 8a4:	56                   	push   %esi
+ 8a5:	53                   	push   %ebx
+ 8a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 8a8:	89 d1                	mov    %edx,%ecx
+{
+ 8aa:	83 ec 3c             	sub    $0x3c,%esp
+ 8ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 8b0:	85 d2                	test   %edx,%edx
+ 8b2:	0f 89 80 00 00 00    	jns    938 <printint+0x98>
+ 8b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 8bc:	74 7a                	je     938 <printint+0x98>
+    x = -xx;
+ 8be:	f7 d9                	neg    %ecx
+    neg = 1;
+ 8c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 8c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 8c8:	31 f6                	xor    %esi,%esi
+ 8ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 8d0:	89 c8                	mov    %ecx,%eax
+ 8d2:	31 d2                	xor    %edx,%edx
+ 8d4:	89 f7                	mov    %esi,%edi
+ 8d6:	f7 f3                	div    %ebx
+ 8d8:	8d 76 01             	lea    0x1(%esi),%esi
+ 8db:	0f b6 92 d4 0e 00 00 	movzbl 0xed4(%edx),%edx
+ 8e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 8e6:	89 ca                	mov    %ecx,%edx
+ 8e8:	89 c1                	mov    %eax,%ecx
+ 8ea:	39 da                	cmp    %ebx,%edx
+ 8ec:	73 e2                	jae    8d0 <printint+0x30>
+  if(neg)
+ 8ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 8f1:	85 c0                	test   %eax,%eax
+ 8f3:	74 07                	je     8fc <printint+0x5c>
+    buf[i++] = '-';
+ 8f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 8fa:	89 f7                	mov    %esi,%edi
+ 8fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 8ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 902:	01 df                	add    %ebx,%edi
+ 904:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 908:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 90b:	83 ec 04             	sub    $0x4,%esp
+ 90e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 911:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 914:	6a 01                	push   $0x1
+ 916:	50                   	push   %eax
+ 917:	56                   	push   %esi
+ 918:	e8 37 fe ff ff       	call   754 <write>
+  while(--i >= 0)
+ 91d:	89 f8                	mov    %edi,%eax
+ 91f:	83 c4 10             	add    $0x10,%esp
+ 922:	83 ef 01             	sub    $0x1,%edi
+ 925:	39 d8                	cmp    %ebx,%eax
+ 927:	75 df                	jne    908 <printint+0x68>
+}
+ 929:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 92c:	5b                   	pop    %ebx
+ 92d:	5e                   	pop    %esi
+ 92e:	5f                   	pop    %edi
+ 92f:	5d                   	pop    %ebp
+ 930:	c3                   	ret
+ 931:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 938:	31 c0                	xor    %eax,%eax
+ 93a:	eb 89                	jmp    8c5 <printint+0x25>
+ 93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000940 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 940:	55                   	push   %ebp
+ 941:	89 e5                	mov    %esp,%ebp
+ 943:	57                   	push   %edi
+ 944:	56                   	push   %esi
+ 945:	53                   	push   %ebx
+ 946:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 949:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 94c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 94f:	0f b6 1e             	movzbl (%esi),%ebx
+ 952:	83 c6 01             	add    $0x1,%esi
+ 955:	84 db                	test   %bl,%bl
+ 957:	74 67                	je     9c0 <printf+0x80>
+ 959:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 95c:	31 d2                	xor    %edx,%edx
+ 95e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 961:	eb 34                	jmp    997 <printf+0x57>
+ 963:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 967:	90                   	nop
+ 968:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 96b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 970:	83 f8 25             	cmp    $0x25,%eax
+ 973:	74 18                	je     98d <printf+0x4d>
+  write(fd, &c, 1);
+ 975:	83 ec 04             	sub    $0x4,%esp
+ 978:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 97b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 97e:	6a 01                	push   $0x1
+ 980:	50                   	push   %eax
+ 981:	57                   	push   %edi
+ 982:	e8 cd fd ff ff       	call   754 <write>
+ 987:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 98a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 98d:	0f b6 1e             	movzbl (%esi),%ebx
+ 990:	83 c6 01             	add    $0x1,%esi
+ 993:	84 db                	test   %bl,%bl
+ 995:	74 29                	je     9c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 997:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 99a:	85 d2                	test   %edx,%edx
+ 99c:	74 ca                	je     968 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 99e:	83 fa 25             	cmp    $0x25,%edx
+ 9a1:	75 ea                	jne    98d <printf+0x4d>
+      if(c == 'd'){
+ 9a3:	83 f8 25             	cmp    $0x25,%eax
+ 9a6:	0f 84 24 01 00 00    	je     ad0 <printf+0x190>
+ 9ac:	83 e8 63             	sub    $0x63,%eax
+ 9af:	83 f8 15             	cmp    $0x15,%eax
+ 9b2:	77 1c                	ja     9d0 <printf+0x90>
+ 9b4:	ff 24 85 7c 0e 00 00 	jmp    *0xe7c(,%eax,4)
+ 9bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 9bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 9c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 9c3:	5b                   	pop    %ebx
+ 9c4:	5e                   	pop    %esi
+ 9c5:	5f                   	pop    %edi
+ 9c6:	5d                   	pop    %ebp
+ 9c7:	c3                   	ret
+ 9c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cf:	90                   	nop
+  write(fd, &c, 1);
+ 9d0:	83 ec 04             	sub    $0x4,%esp
+ 9d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 9da:	6a 01                	push   $0x1
+ 9dc:	52                   	push   %edx
+ 9dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 9e0:	57                   	push   %edi
+ 9e1:	e8 6e fd ff ff       	call   754 <write>
+ 9e6:	83 c4 0c             	add    $0xc,%esp
+ 9e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9ec:	6a 01                	push   $0x1
+ 9ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 9f1:	52                   	push   %edx
+ 9f2:	57                   	push   %edi
+ 9f3:	e8 5c fd ff ff       	call   754 <write>
+        putc(fd, c);
+ 9f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9fb:	31 d2                	xor    %edx,%edx
+ 9fd:	eb 8e                	jmp    98d <printf+0x4d>
+ 9ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ a00:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a03:	83 ec 0c             	sub    $0xc,%esp
+ a06:	b9 10 00 00 00       	mov    $0x10,%ecx
+ a0b:	8b 13                	mov    (%ebx),%edx
+ a0d:	6a 00                	push   $0x0
+ a0f:	89 f8                	mov    %edi,%eax
+        ap++;
+ a11:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ a14:	e8 87 fe ff ff       	call   8a0 <printint>
+        ap++;
+ a19:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a1c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a1f:	31 d2                	xor    %edx,%edx
+ a21:	e9 67 ff ff ff       	jmp    98d <printf+0x4d>
+ a26:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ a30:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ a33:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ a35:	83 c0 04             	add    $0x4,%eax
+ a38:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ a3b:	85 db                	test   %ebx,%ebx
+ a3d:	0f 84 9d 00 00 00    	je     ae0 <printf+0x1a0>
+        while(*s != 0){
+ a43:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ a46:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ a48:	84 c0                	test   %al,%al
+ a4a:	0f 84 3d ff ff ff    	je     98d <printf+0x4d>
+ a50:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a53:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ a56:	89 de                	mov    %ebx,%esi
+ a58:	89 d3                	mov    %edx,%ebx
+ a5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ a60:	83 ec 04             	sub    $0x4,%esp
+ a63:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ a66:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ a69:	6a 01                	push   $0x1
+ a6b:	53                   	push   %ebx
+ a6c:	57                   	push   %edi
+ a6d:	e8 e2 fc ff ff       	call   754 <write>
+        while(*s != 0){
+ a72:	0f b6 06             	movzbl (%esi),%eax
+ a75:	83 c4 10             	add    $0x10,%esp
+ a78:	84 c0                	test   %al,%al
+ a7a:	75 e4                	jne    a60 <printf+0x120>
+      state = 0;
+ a7c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ a7f:	31 d2                	xor    %edx,%edx
+ a81:	e9 07 ff ff ff       	jmp    98d <printf+0x4d>
+ a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ a90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ a93:	83 ec 0c             	sub    $0xc,%esp
+ a96:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ a9b:	8b 13                	mov    (%ebx),%edx
+ a9d:	6a 01                	push   $0x1
+ a9f:	e9 6b ff ff ff       	jmp    a0f <printf+0xcf>
+ aa4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ aa8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ aab:	83 ec 04             	sub    $0x4,%esp
+ aae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ ab1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ ab3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ ab6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ ab9:	6a 01                	push   $0x1
+ abb:	52                   	push   %edx
+ abc:	57                   	push   %edi
+ abd:	e8 92 fc ff ff       	call   754 <write>
+        ap++;
+ ac2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ ac5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ ac8:	31 d2                	xor    %edx,%edx
+ aca:	e9 be fe ff ff       	jmp    98d <printf+0x4d>
+ acf:	90                   	nop
+  write(fd, &c, 1);
+ ad0:	83 ec 04             	sub    $0x4,%esp
+ ad3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ ad6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ ad9:	6a 01                	push   $0x1
+ adb:	e9 11 ff ff ff       	jmp    9f1 <printf+0xb1>
+ ae0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ ae5:	bb 72 0e 00 00       	mov    $0xe72,%ebx
+ aea:	e9 61 ff ff ff       	jmp    a50 <printf+0x110>
+ aef:	90                   	nop
+
+00000af0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ af0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ af1:	a1 f0 13 00 00       	mov    0x13f0,%eax
+{
+ af6:	89 e5                	mov    %esp,%ebp
+ af8:	57                   	push   %edi
+ af9:	56                   	push   %esi
+ afa:	53                   	push   %ebx
+ afb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ afe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b08:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b0a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b0c:	39 ca                	cmp    %ecx,%edx
+ b0e:	73 30                	jae    b40 <free+0x50>
+ b10:	39 c1                	cmp    %eax,%ecx
+ b12:	72 04                	jb     b18 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b14:	39 c2                	cmp    %eax,%edx
+ b16:	72 f0                	jb     b08 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b18:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ b1b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ b1e:	39 f8                	cmp    %edi,%eax
+ b20:	74 2e                	je     b50 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b22:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ b25:	8b 42 04             	mov    0x4(%edx),%eax
+ b28:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b2b:	39 f1                	cmp    %esi,%ecx
+ b2d:	74 38                	je     b67 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ b2f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ b31:	5b                   	pop    %ebx
+  freep = p;
+ b32:	89 15 f0 13 00 00    	mov    %edx,0x13f0
+}
+ b38:	5e                   	pop    %esi
+ b39:	5f                   	pop    %edi
+ b3a:	5d                   	pop    %ebp
+ b3b:	c3                   	ret
+ b3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b40:	39 c1                	cmp    %eax,%ecx
+ b42:	72 d0                	jb     b14 <free+0x24>
+ b44:	eb c2                	jmp    b08 <free+0x18>
+ b46:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b4d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ b50:	03 70 04             	add    0x4(%eax),%esi
+ b53:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b56:	8b 02                	mov    (%edx),%eax
+ b58:	8b 00                	mov    (%eax),%eax
+ b5a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ b5d:	8b 42 04             	mov    0x4(%edx),%eax
+ b60:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ b63:	39 f1                	cmp    %esi,%ecx
+ b65:	75 c8                	jne    b2f <free+0x3f>
+    p->s.size += bp->s.size;
+ b67:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ b6a:	89 15 f0 13 00 00    	mov    %edx,0x13f0
+    p->s.size += bp->s.size;
+ b70:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ b73:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ b76:	89 0a                	mov    %ecx,(%edx)
+}
+ b78:	5b                   	pop    %ebx
+ b79:	5e                   	pop    %esi
+ b7a:	5f                   	pop    %edi
+ b7b:	5d                   	pop    %ebp
+ b7c:	c3                   	ret
+ b7d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000b80 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	57                   	push   %edi
+ b84:	56                   	push   %esi
+ b85:	53                   	push   %ebx
+ b86:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ b8c:	8b 15 f0 13 00 00    	mov    0x13f0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b92:	8d 78 07             	lea    0x7(%eax),%edi
+ b95:	c1 ef 03             	shr    $0x3,%edi
+ b98:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ b9b:	85 d2                	test   %edx,%edx
+ b9d:	0f 84 8d 00 00 00    	je     c30 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ba3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ba5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ba8:	39 f9                	cmp    %edi,%ecx
+ baa:	73 64                	jae    c10 <malloc+0x90>
+  if(nu < 4096)
+ bac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ bb1:	39 df                	cmp    %ebx,%edi
+ bb3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ bb6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ bbd:	eb 0a                	jmp    bc9 <malloc+0x49>
+ bbf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bc0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ bc2:	8b 48 04             	mov    0x4(%eax),%ecx
+ bc5:	39 f9                	cmp    %edi,%ecx
+ bc7:	73 47                	jae    c10 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ bc9:	89 c2                	mov    %eax,%edx
+ bcb:	39 05 f0 13 00 00    	cmp    %eax,0x13f0
+ bd1:	75 ed                	jne    bc0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ bd3:	83 ec 0c             	sub    $0xc,%esp
+ bd6:	56                   	push   %esi
+ bd7:	e8 e0 fb ff ff       	call   7bc <sbrk>
+  if(p == (char*)-1)
+ bdc:	83 c4 10             	add    $0x10,%esp
+ bdf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ be2:	74 1c                	je     c00 <malloc+0x80>
+  hp->s.size = nu;
+ be4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ be7:	83 ec 0c             	sub    $0xc,%esp
+ bea:	83 c0 08             	add    $0x8,%eax
+ bed:	50                   	push   %eax
+ bee:	e8 fd fe ff ff       	call   af0 <free>
+  return freep;
+ bf3:	8b 15 f0 13 00 00    	mov    0x13f0,%edx
+      if((p = morecore(nunits)) == 0)
+ bf9:	83 c4 10             	add    $0x10,%esp
+ bfc:	85 d2                	test   %edx,%edx
+ bfe:	75 c0                	jne    bc0 <malloc+0x40>
+        return 0;
+  }
+}
+ c00:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ c03:	31 c0                	xor    %eax,%eax
+}
+ c05:	5b                   	pop    %ebx
+ c06:	5e                   	pop    %esi
+ c07:	5f                   	pop    %edi
+ c08:	5d                   	pop    %ebp
+ c09:	c3                   	ret
+ c0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ c10:	39 cf                	cmp    %ecx,%edi
+ c12:	74 4c                	je     c60 <malloc+0xe0>
+        p->s.size -= nunits;
+ c14:	29 f9                	sub    %edi,%ecx
+ c16:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ c19:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ c1c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ c1f:	89 15 f0 13 00 00    	mov    %edx,0x13f0
+}
+ c25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ c28:	83 c0 08             	add    $0x8,%eax
+}
+ c2b:	5b                   	pop    %ebx
+ c2c:	5e                   	pop    %esi
+ c2d:	5f                   	pop    %edi
+ c2e:	5d                   	pop    %ebp
+ c2f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ c30:	c7 05 f0 13 00 00 f4 	movl   $0x13f4,0x13f0
+ c37:	13 00 00 
+    base.s.size = 0;
+ c3a:	b8 f4 13 00 00       	mov    $0x13f4,%eax
+    base.s.ptr = freep = prevp = &base;
+ c3f:	c7 05 f4 13 00 00 f4 	movl   $0x13f4,0x13f4
+ c46:	13 00 00 
+    base.s.size = 0;
+ c49:	c7 05 f8 13 00 00 00 	movl   $0x0,0x13f8
+ c50:	00 00 00 
+    if(p->s.size >= nunits){
+ c53:	e9 54 ff ff ff       	jmp    bac <malloc+0x2c>
+ c58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c5f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ c60:	8b 08                	mov    (%eax),%ecx
+ c62:	89 0a                	mov    %ecx,(%edx)
+ c64:	eb b9                	jmp    c1f <malloc+0x9f>
+ c66:	66 90                	xchg   %ax,%ax
+ c68:	66 90                	xchg   %ax,%ax
+ c6a:	66 90                	xchg   %ax,%ax
+ c6c:	66 90                	xchg   %ax,%ax
+ c6e:	66 90                	xchg   %ax,%ax
+
+00000c70 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ c70:	55                   	push   %ebp
+ c71:	89 e5                	mov    %esp,%ebp
+ c73:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ c76:	8b 45 08             	mov    0x8(%ebp),%eax
+ c79:	c1 e0 04             	shl    $0x4,%eax
+ c7c:	ff b0 2c 14 00 00    	push   0x142c(%eax)
+ c82:	05 20 14 00 00       	add    $0x1420,%eax
+ c87:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ c8a:	e8 a5 fa ff ff       	call   734 <exit>
+ c8f:	90                   	nop
+
+00000c90 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ c90:	55                   	push   %ebp
+ c91:	89 e5                	mov    %esp,%ebp
+ c93:	57                   	push   %edi
+ c94:	56                   	push   %esi
+ c95:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ c96:	31 db                	xor    %ebx,%ebx
+{
+ c98:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ c9b:	68 00 14 00 00       	push   $0x1400
+ ca0:	e8 eb f8 ff ff       	call   590 <lock_acquire>
+ ca5:	83 c4 10             	add    $0x10,%esp
+ ca8:	eb 12                	jmp    cbc <thread_create+0x2c>
+ caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ cb0:	83 c3 01             	add    $0x1,%ebx
+ cb3:	83 fb 40             	cmp    $0x40,%ebx
+ cb6:	0f 84 c4 00 00 00    	je     d80 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ cbc:	89 de                	mov    %ebx,%esi
+ cbe:	c1 e6 04             	shl    $0x4,%esi
+ cc1:	8b 96 20 14 00 00    	mov    0x1420(%esi),%edx
+ cc7:	85 d2                	test   %edx,%edx
+ cc9:	75 e5                	jne    cb0 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ ccb:	83 ec 0c             	sub    $0xc,%esp
+ cce:	68 00 20 00 00       	push   $0x2000
+ cd3:	e8 a8 fe ff ff       	call   b80 <malloc>
+ cd8:	83 c4 10             	add    $0x10,%esp
+ cdb:	85 c0                	test   %eax,%eax
+ cdd:	0f 84 9d 00 00 00    	je     d80 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ ce3:	89 86 24 14 00 00    	mov    %eax,0x1424(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ ce9:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ cee:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ cf1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ cf6:	89 86 20 14 00 00    	mov    %eax,0x1420(%esi)
+  threads[i].fn = fn;
+ cfc:	8b 45 08             	mov    0x8(%ebp),%eax
+ cff:	89 86 28 14 00 00    	mov    %eax,0x1428(%esi)
+  threads[i].arg = arg;
+ d05:	8b 45 0c             	mov    0xc(%ebp),%eax
+ d08:	89 86 2c 14 00 00    	mov    %eax,0x142c(%esi)
+  lock_release(&threadslock);
+ d0e:	68 00 14 00 00       	push   $0x1400
+ d13:	e8 98 f8 ff ff       	call   5b0 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ d18:	83 c4 0c             	add    $0xc,%esp
+ d1b:	ff b6 20 14 00 00    	push   0x1420(%esi)
+ d21:	53                   	push   %ebx
+ d22:	68 70 0c 00 00       	push   $0xc70
+ d27:	e8 10 fb ff ff       	call   83c <clone>
+ d2c:	83 c4 10             	add    $0x10,%esp
+ d2f:	85 c0                	test   %eax,%eax
+ d31:	78 0d                	js     d40 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ d33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d36:	5b                   	pop    %ebx
+ d37:	5e                   	pop    %esi
+ d38:	5f                   	pop    %edi
+ d39:	5d                   	pop    %ebp
+ d3a:	c3                   	ret
+ d3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ d3f:	90                   	nop
+    lock_acquire(&threadslock);
+ d40:	83 ec 0c             	sub    $0xc,%esp
+ d43:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ d46:	68 00 14 00 00       	push   $0x1400
+ d4b:	e8 40 f8 ff ff       	call   590 <lock_acquire>
+    free(threads[i].block);
+ d50:	58                   	pop    %eax
+ d51:	ff b6 24 14 00 00    	push   0x1424(%esi)
+ d57:	e8 94 fd ff ff       	call   af0 <free>
+    threads[i].stack = 0;
+ d5c:	c7 86 20 14 00 00 00 	movl   $0x0,0x1420(%esi)
+ d63:	00 00 00 
+    lock_release(&threadslock);
+ d66:	c7 04 24 00 14 00 00 	movl   $0x1400,(%esp)
+ d6d:	e8 3e f8 ff ff       	call   5b0 <lock_release>
+ d72:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d75:	83 c4 10             	add    $0x10,%esp
+}
+ d78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ d7b:	5b                   	pop    %ebx
+ d7c:	5e                   	pop    %esi
+ d7d:	5f                   	pop    %edi
+ d7e:	5d                   	pop    %ebp
+ d7f:	c3                   	ret
+    lock_release(&threadslock);
+ d80:	83 ec 0c             	sub    $0xc,%esp
+ d83:	68 00 14 00 00       	push   $0x1400
+ d88:	e8 23 f8 ff ff       	call   5b0 <lock_release>
+    return -1;
+ d8d:	83 c4 10             	add    $0x10,%esp
+ d90:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d95:	eb 9c                	jmp    d33 <thread_create+0xa3>
+ d97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d9e:	66 90                	xchg   %ax,%ax
+
+00000da0 <thread_join>:
+
+int
+thread_join(void)
+{
+ da0:	55                   	push   %ebp
+ da1:	89 e5                	mov    %esp,%ebp
+ da3:	56                   	push   %esi
+ da4:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ da5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ da8:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ dab:	50                   	push   %eax
+ dac:	e8 93 fa ff ff       	call   844 <join>
+ db1:	83 c4 10             	add    $0x10,%esp
+ db4:	85 c0                	test   %eax,%eax
+ db6:	78 69                	js     e21 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ db8:	83 ec 0c             	sub    $0xc,%esp
+ dbb:	89 c6                	mov    %eax,%esi
+ dbd:	68 00 14 00 00       	push   $0x1400
+ dc2:	e8 c9 f7 ff ff       	call   590 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ dc7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ dca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ dcd:	31 c0                	xor    %eax,%eax
+ dcf:	eb 0f                	jmp    de0 <thread_join+0x40>
+ dd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ dd8:	83 c0 01             	add    $0x1,%eax
+ ddb:	83 f8 40             	cmp    $0x40,%eax
+ dde:	74 28                	je     e08 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ de0:	89 c3                	mov    %eax,%ebx
+ de2:	c1 e3 04             	shl    $0x4,%ebx
+ de5:	39 93 20 14 00 00    	cmp    %edx,0x1420(%ebx)
+ deb:	75 eb                	jne    dd8 <thread_join+0x38>
+      free(threads[i].block);
+ ded:	83 ec 0c             	sub    $0xc,%esp
+ df0:	ff b3 24 14 00 00    	push   0x1424(%ebx)
+ df6:	e8 f5 fc ff ff       	call   af0 <free>
+      threads[i].stack = 0;
+      break;
+ dfb:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ dfe:	c7 83 20 14 00 00 00 	movl   $0x0,0x1420(%ebx)
+ e05:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ e08:	83 ec 0c             	sub    $0xc,%esp
+ e0b:	68 00 14 00 00       	push   $0x1400
+ e10:	e8 9b f7 ff ff       	call   5b0 <lock_release>
+  return pid;
+ e15:	83 c4 10             	add    $0x10,%esp
+}
+ e18:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ e1b:	89 f0                	mov    %esi,%eax
+ e1d:	5b                   	pop    %ebx
+ e1e:	5e                   	pop    %esi
+ e1f:	5d                   	pop    %ebp
+ e20:	c3                   	ret
+    return -1;
+ e21:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ e26:	eb f0                	jmp    e18 <thread_join+0x78>
@@ -12,8 +12,10 @@
 #include "sleeplock.h"
 #include "fs.h"
 #include "buf.h"
+#include "bcache.h"
+#include "iosched.h"
 
-extern uchar _binary_fs_img_start[], _binary_fs_img_size[];
+extern uchar _binary_memfs_img_start[], _binary_memfs_img_size[];
 
 static int disksize;
 static uchar *memdisk;
@@ -21,8 +23,8 @@ static uchar *memdisk;
 void
 ideinit(void)
 {
-  memdisk = _binary_fs_img_start;
-  disksize = (uint)_binary_fs_img_size/BSIZE;
+  memdisk = _binary_memfs_img_start;
+  disksize = (uint)_binary_memfs_img_size/BSIZE;
 }
 
 // Interrupt handler.
@@ -58,3 +60,47 @@ iderw(struct buf *b)
     memmove(b->data, p, BSIZE);
   b->flags |= B_VALID;
 }
+
+// There is no queue to batch requests in, so just do b and then
+// the async bufs one at a time.
+void
+iderwv(struct buf *b, struct buf **async, int n)
+{
+  int i;
+
+  if(b)
+    iderw(b);
+  for(i = 0; i < n; i++){
+    iderw(async[i]);
+    if(async[i]->flags & B_ASYNC)
+      bdone(async[i]);
+  }
+}
+
+// iderwv has already done it.
+void
+iderwait(struct buf *b)
+{
+}
+
+void
+idestat(struct bcstat *st)
+{
+  st->diskintrs = 0;
+  st->diskblocks = 0;
+}
+
+// Requests are done as they come, so there is nothing to schedule.
+int
+idesetsched(int policy)
+{
+  if(policy != IOSCHED_FIFO && policy != IOSCHED_CSCAN)
+    return -1;
+  return IOSCHED_FIFO;
+}
+
+void
+ideiostat(struct iostat *st)
+{
+  memset(st, 0, sizeof(*st));
+}
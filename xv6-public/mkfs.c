@@ -17,18 +17,24 @@
 
 #define NINODES 200
 
+// The block size is chosen at run time; the macros in fs.h that
+// depend on it use this variable instead.
+int bsize = BSIZE;
+#undef BSIZE
+#define BSIZE bsize
+
 // Disk layout:
 // [ boot block | sb block | log | inode blocks | free bit map | data blocks ]
 
-int nbitmap = FSSIZE/(BSIZE*8) + 1;
-int ninodeblocks = NINODES / IPB + 1;
-int nlog = LOGSIZE;
+uint fssize = FSSIZE;  // Size of the image in blocks
+int nbitmap;  // Number of bitmap blocks
+int ninodeblocks;
+int nlog;     // Number of log blocks, headers included
 int nmeta;    // Number of meta blocks (boot, sb, nlog, inode, bitmap)
 int nblocks;  // Number of data blocks
 
 int fsfd;
 struct superblock sb;
-char zeroes[BSIZE];
 uint freeinode = 1;
 uint freeblock;
 
@@ -64,22 +70,51 @@ xint(uint x)
   return y;
 }
 
+void
+usage(void)
+{
+  fprintf(stderr, "Usage: mkfs [-s blocks] [-b blocksize] fs.img files...\n");
+  exit(1);
+}
+
 int
 main(int argc, char *argv[])
 {
-  int i, cc, fd;
+  int i, cc, fd, c;
   uint rootino, inum, off;
   struct dirent de;
-  char buf[BSIZE];
   struct dinode din;
 
 
   static_assert(sizeof(int) == 4, "Integers must be 4 bytes!");
 
-  if(argc < 2){
-    fprintf(stderr, "Usage: mkfs fs.img files...\n");
+  while((c = getopt(argc, argv, "s:b:")) != -1){
+    switch(c){
+    case 's':
+      fssize = strtoul(optarg, 0, 0);
+      break;
+    case 'b':
+      bsize = atoi(optarg);
+      break;
+    default:
+      usage();
+    }
+  }
+  argc -= optind - 1;
+  argv += optind - 1;
+  if(argc < 2)
+    usage();
+  if(bsize < 512 || bsize > 4096 || (bsize & (bsize-1)) != 0){
+    fprintf(stderr, "mkfs: block size must be a power of 2 from 512 to 4096\n");
     exit(1);
   }
+  // LBA28, the limit of the IDE driver, addresses 128GB.
+  if(fssize < 64 || (unsigned long long)fssize * bsize > (1ULL << 37)){
+    fprintf(stderr, "mkfs: bad file system size\n");
+    exit(1);
+  }
+
+  char buf[BSIZE];
 
   assert((BSIZE % sizeof(struct dinode)) == 0);
   assert((BSIZE % sizeof(struct dirent)) == 0);
@@ -90,25 +125,42 @@ main(int argc, char *argv[])
     exit(1);
   }
 
-  // 1 fs block = 1 disk sector
+  // The kernel uses at most LOGSIZE log blocks, and needs room
+  // for a few ops.
+  nlog = fssize/16;
+  if(nlog > LOGSIZE + 1)
+    nlog = LOGSIZE + 1;
+  if(nlog < 3*MAXOPBLOCKS)
+    nlog = 3*MAXOPBLOCKS;
+  nbitmap = fssize/BPB + 1;
+  ninodeblocks = NINODES / IPB + 1;
   nmeta = 2 + nlog + ninodeblocks + nbitmap;
-  nblocks = FSSIZE - nmeta;
+  nblocks = fssize - nmeta;
+  if(nblocks <= 0){
+    fprintf(stderr, "mkfs: %u blocks is too small\n", fssize);
+    exit(1);
+  }
 
-  sb.size = xint(FSSIZE);
+  sb.size = xint(fssize);
   sb.nblocks = xint(nblocks);
   sb.ninodes = xint(NINODES);
   sb.nlog = xint(nlog);
   sb.logstart = xint(2);
   sb.inodestart = xint(2+nlog);
   sb.bmapstart = xint(2+nlog+ninodeblocks);
+  sb.version = xint(FSVERSION);
+  sb.bsize = xint(bsize);
 
-  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d\n",
-         nmeta, nlog, ninodeblocks, nbitmap, nblocks, FSSIZE);
+  printf("nmeta %d (boot, super, log blocks %u inode blocks %u, bitmap blocks %u) blocks %d total %d of %d bytes\n",
+         nmeta, nlog, ninodeblocks, nbitmap, nblocks, fssize, bsize);
 
   freeblock = nmeta;     // the first free block that we can allocate
 
-  for(i = 0; i < FSSIZE; i++)
-    wsect(i, zeroes);
+  // The image starts out all zeroes, without writing them.
+  if(ftruncate(fsfd, (off_t)fssize * BSIZE) < 0){
+    perror("ftruncate");
+    exit(1);
+  }
 
   memset(buf, 0, sizeof(buf));
   memmove(buf, &sb, sizeof(sb));
@@ -170,7 +222,7 @@ main(int argc, char *argv[])
 void
 wsect(uint sec, void *buf)
 {
-  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+  if(lseek(fsfd, (off_t)sec * BSIZE, 0) != (off_t)sec * BSIZE){
     perror("lseek");
     exit(1);
   }
@@ -210,7 +262,7 @@ rinode(uint inum, struct dinode *ip)
 void
 rsect(uint sec, void *buf)
 {
-  if(lseek(fsfd, sec * BSIZE, 0) != sec * BSIZE){
+  if(lseek(fsfd, (off_t)sec * BSIZE, 0) != (off_t)sec * BSIZE){
     perror("lseek");
     exit(1);
   }
@@ -238,20 +290,62 @@ void
 balloc(int used)
 {
   uchar buf[BSIZE];
-  int i;
+  int i, b;
 
   printf("balloc: first %d blocks have been allocated\n", used);
-  assert(used < BSIZE*8);
-  bzero(buf, BSIZE);
-  for(i = 0; i < used; i++){
-    buf[i/8] = buf[i/8] | (0x1 << (i%8));
+  assert(used < fssize);
+  for(b = 0; b < used; b += BPB){
+    bzero(buf, BSIZE);
+    for(i = b; i < used && i < b + BPB; i++){
+      buf[(i-b)/8] = buf[(i-b)/8] | (0x1 << (i%8));
+    }
+    printf("balloc: write bitmap block at sector %d\n", xint(sb.bmapstart) + b/BPB);
+    wsect(xint(sb.bmapstart) + b/BPB, buf);
   }
-  printf("balloc: write bitmap block at sector %d\n", sb.bmapstart);
-  wsect(sb.bmapstart, buf);
 }
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
+// Return the block holding block fbn of the file, allocating it
+// and any indirect blocks on the way, as bmap in fs.c does.
+uint
+bmap(struct dinode *din, uint fbn)
+{
+  uint indirect[NINDIRECT];
+  uint addr, span;
+  int level;
+
+  if(fbn < NDIRECT){
+    if(xint(din->addrs[fbn]) == 0){
+      din->addrs[fbn] = xint(freeblock++);
+    }
+    return xint(din->addrs[fbn]);
+  }
+  fbn -= NDIRECT;
+
+  span = 1;
+  for(level = 0; fbn >= span*NINDIRECT; level++){
+    assert(level < NLEVEL-1);
+    fbn -= span*NINDIRECT;
+    span *= NINDIRECT;
+  }
+
+  if(xint(din->addrs[NDIRECT+level]) == 0){
+    din->addrs[NDIRECT+level] = xint(freeblock++);
+  }
+  addr = xint(din->addrs[NDIRECT+level]);
+  for(; span > 0; span /= NINDIRECT){
+    rsect(addr, (char*)indirect);
+    if(indirect[fbn/span] == 0){
+      indirect[fbn/span] = xint(freeblock++);
+      wsect(addr, (char*)indirect);
+    }
+    addr = xint(indirect[fbn/span]);
+    fbn %= span;
+  }
+  return addr;
+}
+
 void
 iappend(uint inum, void *xp, int n)
 {
@@ -259,7 +353,6 @@ iappend(uint inum, void *xp, int n)
   uint fbn, off, n1;
   struct dinode din;
   char buf[BSIZE];
-  uint indirect[NINDIRECT];
   uint x;
 
   rinode(inum, &din);
@@ -268,22 +361,8 @@ iappend(uint inum, void *xp, int n)
   while(n > 0){
     fbn = off / BSIZE;
     assert(fbn < MAXFILE);
-    if(fbn < NDIRECT){
-      if(xint(din.addrs[fbn]) == 0){
-        din.addrs[fbn] = xint(freeblock++);
-      }
-      x = xint(din.addrs[fbn]);
-    } else {
-      if(xint(din.addrs[NDIRECT]) == 0){
-        din.addrs[NDIRECT] = xint(freeblock++);
-      }
-      rsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      if(indirect[fbn - NDIRECT] == 0){
-        indirect[fbn - NDIRECT] = xint(freeblock++);
-        wsect(xint(din.addrs[NDIRECT]), (char*)indirect);
-      }
-      x = xint(indirect[fbn-NDIRECT]);
-    }
+    x = bmap(&din, fbn);
+    assert(x < fssize);
     n1 = min(n, (fbn + 1) * BSIZE - off);
     rsect(x, buf);
     bcopy(p, buf + off - (fbn * BSIZE), n1);
@@ -1,4 +1,4 @@
-#define NPROC        64  // maximum number of processes
+#define NPROC      4096  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
 #define NOFILE       16  // open files per process
@@ -8,7 +8,15 @@
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
 #define MAXOPBLOCKS  10  // max # of blocks any FS op writes
-#define LOGSIZE      (MAXOPBLOCKS*3)  // max data blocks in on-disk log
-#define NBUF         (MAXOPBLOCKS*3)  // size of disk block cache
-#define FSSIZE       1000  // size of file system in blocks
+#define LOGSIZE       512  // max data blocks used from the on-disk log
+#define LOGFLUSHTICKS   3  // ticks a transaction stays open for more ops
+#define NBUF         (MAXOPBLOCKS*3)  // minimum size of disk block cache
+#define BCACHEPCT      10  // percent of free memory for the block cache
+#define RABLOCKS       16  // blocks read ahead of a sequential reader
+#define IOSCHEDPOLICY   1  // disk scheduling at boot: 0 FIFO, 1 C-SCAN
+#define IOMAXWAIT      50  // ms a disk request may wait before it goes next
+#define FSSIZE       4096  // size of file system mkfs makes, in blocks
+#define MAXPINNED     256  // max wmlock-pinned pages per process
+#define BOOSTTICKS    100  // ticks between MLFQ priority boosts
+#define SCHEDPOLICY     0  // policy at boot: 0 MLFQ, 1 stride
 
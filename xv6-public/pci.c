@@ -0,0 +1,83 @@
+// PCI configuration space access, through the legacy 0xcf8/0xcfc
+// ports.  QEMU's PC puts every device on bus 0, so only that bus
+// is scanned.
+
+#include "types.h"
+#include "defs.h"
+#include "x86.h"
+#include "pci.h"
+
+#define PCI_ADDR 0xcf8
+#define PCI_DATA 0xcfc
+
+static uint
+confaddr(int bus, int dev, int func, int off)
+{
+  return 0x80000000 | (bus<<16) | (dev<<11) | (func<<8) | (off & 0xfc);
+}
+
+uint
+pciread(struct pcidev *d, int off)
+{
+  outl(PCI_ADDR, confaddr(d->bus, d->dev, d->func, off));
+  return inl(PCI_DATA);
+}
+
+void
+pciwrite(struct pcidev *d, int off, uint val)
+{
+  outl(PCI_ADDR, confaddr(d->bus, d->dev, d->func, off));
+  outl(PCI_DATA, val);
+}
+
+// Fill in d for the first function on bus 0 with the given vendor
+// and device ids, or class and subclass if vendor is 0.
+// Return 0 if found, -1 if not.
+static int
+pcifind(ushort vendor, ushort device, int class, int subclass,
+        struct pcidev *d)
+{
+  uint id, cl;
+  int i;
+
+  d->bus = 0;
+  for(d->dev = 0; d->dev < 32; d->dev++){
+    for(d->func = 0; d->func < 8; d->func++){
+      id = pciread(d, PCI_ID);
+      if((id & 0xffff) == 0xffff)
+        continue;
+      cl = pciread(d, PCI_CLASS);
+      if(vendor ? (id & 0xffff) != vendor || (id >> 16) != device
+                : (cl >> 24) != class || ((cl >> 16) & 0xff) != subclass)
+        continue;
+      d->vendor = id & 0xffff;
+      d->device = id >> 16;
+      d->class = cl >> 24;
+      d->subclass = (cl >> 16) & 0xff;
+      for(i = 0; i < 6; i++)
+        d->bar[i] = pciread(d, PCI_BAR0 + 4*i);
+      d->irq = pciread(d, PCI_INTR) & 0xff;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+int
+pcifindid(ushort vendor, ushort device, struct pcidev *d)
+{
+  return pcifind(vendor, device, 0, 0, d);
+}
+
+int
+pcifindclass(int class, int subclass, struct pcidev *d)
+{
+  return pcifind(0, 0, class, subclass, d);
+}
+
+// Set bits in d's command register, e.g. to enable bus mastering.
+void
+pcienable(struct pcidev *d, uint bits)
+{
+  pciwrite(d, PCI_CMD, pciread(d, PCI_CMD) | bits);
+}
@@ -0,0 +1,28 @@
+// PCI configuration space.
+
+struct pcidev {
+  uchar bus;
+  uchar dev;
+  uchar func;
+  ushort vendor;
+  ushort device;
+  uchar class;
+  uchar subclass;
+  uint bar[6];   // base address registers as read
+  uchar irq;     // legacy interrupt line
+};
+
+// Configuration space offsets
+#define PCI_ID        0x00  // vendor in low half, device in high
+#define PCI_CMD       0x04  // command in low half, status in high
+#define PCI_CLASS     0x08  // class, subclass, prog-if, revision
+#define PCI_BAR0      0x10
+#define PCI_INTR      0x3c  // interrupt line in low byte
+
+// Bits in the command register
+#define PCI_CMD_IO     0x1  // respond to I/O space accesses
+#define PCI_CMD_MEM    0x2  // respond to memory space accesses
+#define PCI_CMD_MASTER 0x4  // may act as bus master (DMA)
+
+#define PCI_CLASS_STORAGE 0x01
+#define PCI_SUBCLASS_IDE  0x01
@@ -6,24 +6,265 @@
 #include "x86.h"
 #include "proc.h"
 #include "spinlock.h"
-
+#include "sleeplock.h"
+#include "slab.h"
+
+// ptable.lock only serializes process lifecycle: allocation, exit,
+// wait and reparenting. A process's run state is protected by its own
+// p->lock, and RUNNABLE processes sit on per-CPU run queues.
+// Procs come from a slab; live ones are found by pid through a hash
+// table, and by parent through each process's list of children.
+#define NPIDHASH 256
 struct {
   struct spinlock lock;
-  struct proc proc[NPROC];
+  struct slab slab;
+  int nproc;                   // # of procs allocated
+  struct proc *pidhash[NPIDHASH]; // Linked through p->hashnext
 } ptable;
 
+#define PIDHASH(pid) (&ptable.pidhash[(uint)(pid) % NPIDHASH])
+
+// Per-CPU multilevel feedback queue of RUNNABLE processes:
+// one FIFO per priority level, highest level served first.
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NPRIO];    // Next to run at each level
+  struct proc *tail[NPRIO];
+  int n;                       // # of queued processes
+  uint vpass;                  // Pass of the last process dispatched
+};
+
+static struct runq runqs[NCPU];
+
+// Sleeping processes, hashed by wait channel, so that wakeup
+// only looks at the processes sleeping on its channel (and on
+// any channels that happen to share the bucket).
+#define NWAITQ 64
+struct waitq {
+  struct spinlock lock;
+  struct proc *head;           // Linked through p->wqnext
+};
+
+static struct waitq waitqs[NWAITQ];
+
+#define WAITQ(chan) (&waitqs[((uint)(chan) * 2654435761u) >> 26])
+
+// Futex locks, hashed by the kernel address of the futex word.
+#define NFUTEXLOCK 16
+
+static struct spinlock futexlocks[NFUTEXLOCK];
+
+#define FUTEXLOCK(word) (&futexlocks[((uint)(word) * 2654435761u) >> 28])
+
+// Timer ticks a process may run at each level before demotion.
+static int quantum[NPRIO] = { 1, 2, 4, 8 };
+
+// Stride of a process holding a single ticket.
+#define STRIDE1 (1<<16)
+
+// SCHED_MLFQ or SCHED_STRIDE; see setschedpolicy.
+static int schedpolicy = SCHEDPOLICY;
+
+// Number of priority boosts so far.  A process that was off the
+// run queues at a boost catches up, by comparing its p->boost,
+// the next time it is queued or charged a tick; see catchup.
+static uint boosts;
+
+// Pass values wrap, so compare them by signed difference.
+#define PASSLT(a, b) ((int)((a) - (b)) < 0)
+
+// CPUs dedicated to a single process by setaffinity.  Written
+// under ptable.lock; never covers every CPU.
+static uint reservedcpus;
+
+#define ALLCPUS ((1u << ncpu) - 1)
+
+// Address spaces, also from a slab.  ref, nlive and the list of
+// procs are protected by ptable.lock.
+static struct slab vmslab;
+
+// Descriptor tables, also from a slab.
+static struct slab fdtslab;
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
+static void
+procctor(void *p)
+{
+  initlock(&((struct proc*)p)->lock, "proc");
+}
+
+static void
+vmctor(void *vm)
+{
+  initsleeplock(&((struct vmspace*)vm)->lock, "vmspace");
+}
+
+static void
+fdtctor(void *fdt)
+{
+  initlock(&((struct fdtable*)fdt)->lock, "fdtable");
+}
 
 void
 pinit(void)
 {
+  int i;
+
   initlock(&ptable.lock, "ptable");
+  slabinit(&ptable.slab, "proc", sizeof(struct proc), procctor);
+  slabinit(&vmslab, "vmspace", sizeof(struct vmspace), vmctor);
+  slabinit(&fdtslab, "fdtable", sizeof(struct fdtable), fdtctor);
+  for(i = 0; i < NCPU; i++)
+    initlock(&runqs[i].lock, "runq");
+  for(i = 0; i < NWAITQ; i++)
+    initlock(&waitqs[i].lock, "waitq");
+  for(i = 0; i < NFUTEXLOCK; i++)
+    initlock(&futexlocks[i], "futex");
+}
+
+// Allocate the vmspace for a new address space pgdir, with one
+// user, which the caller then links in with vmjoin.
+struct vmspace*
+allocvm(pde_t *pgdir)
+{
+  struct vmspace *vm;
+
+  if((vm = slaballoc(&vmslab)) == 0)
+    return 0;
+  vm->ref = 1;
+  vm->nlive = 1;
+  vm->procs = 0;
+  vm->pgdir = pgdir;
+  memset(&vm->wmap, 0, sizeof(vm->wmap));
+  vm->nextmapid = 0;
+  vm->npinned = 0;
+  vm->ndead = 0;
+  return vm;
+}
+
+// Add p to the procs of vm.  Caller must hold ptable.lock.
+static void
+vmjoin(struct proc *p, struct vmspace *vm)
+{
+  p->vm = vm;
+  p->vmnext = vm->procs;
+  vm->procs = p;
+}
+
+// Take p off the procs of its vmspace, and free the vmspace if p
+// was its last user.  Caller must hold ptable.lock.
+static void
+vmleave(struct proc *p)
+{
+  struct vmspace *vm = p->vm;
+  struct proc **pp;
+
+  for(pp = &vm->procs; *pp != p; pp = &(*pp)->vmnext)
+    ;
+  *pp = p->vmnext;
+  p->vmnext = 0;
+  p->vm = 0;
+  if(--vm->ref == 0){
+    freevm(vm->pgdir);
+    slabfree(&vmslab, vm);
+  }
+}
+
+// Allocate a descriptor table with one user, holding new references
+// to the open files of from, or none if from is 0.
+static struct fdtable*
+copyfdt(struct fdtable *from)
+{
+  struct fdtable *fdt;
+  int fd;
+
+  if((fdt = slaballoc(&fdtslab)) == 0)
+    return 0;
+  fdt->ref = 1;
+  memset(fdt->ofile, 0, sizeof(fdt->ofile));
+  if(from){
+    acquire(&from->lock);
+    for(fd = 0; fd < NOFILE; fd++)
+      if(from->ofile[fd])
+        fdt->ofile[fd] = filedup(from->ofile[fd]);
+    release(&from->lock);
+  }
+  return fdt;
+}
+
+// Drop p's use of its descriptor table.  The last user closes
+// the open files and frees the table.
+static void
+putfdt(struct proc *p)
+{
+  struct fdtable *fdt = p->fdt;
+  int fd, last;
+
+  p->fdt = 0;
+  acquire(&fdt->lock);
+  last = --fdt->ref == 0;
+  release(&fdt->lock);
+  if(!last)
+    return;
+  for(fd = 0; fd < NOFILE; fd++){
+    if(fdt->ofile[fd]){
+      fileclose(fdt->ofile[fd]);
+      fdt->ofile[fd] = 0;
+    }
+  }
+  slabfree(&fdtslab, fdt);
+}
+
+// Give p a descriptor table of its own if it shares one with
+// other threads, for exec.  Returns -1 if out of memory.
+int
+unsharefdt(struct proc *p)
+{
+  struct fdtable *fdt;
+
+  if(p->fdt->ref == 1)
+    return 0;
+  if((fdt = copyfdt(p->fdt)) == 0)
+    return -1;
+  putfdt(p);
+  p->fdt = fdt;
+  return 0;
+}
+
+// Move p into its new address space pgdir, for exec.  If other
+// threads still live in the old one, p leaves it to them and takes
+// spare, a vmspace from allocvm, and 0 is returned; with no spare
+// that fails and -1 is returned.  Otherwise p keeps its vmspace,
+// the spare if any is freed, and 1 is returned: the old pgdir is
+// the caller's to free.  vmexec(0, 0, spare) just frees spare.
+int
+vmexec(struct proc *p, pde_t *pgdir, struct vmspace *spare)
+{
+  acquire(&ptable.lock);
+  if(p && p->vm->nlive > 1){
+    if(spare == 0){
+      release(&ptable.lock);
+      return -1;
+    }
+    p->vm->nlive--;
+    vmleave(p);
+    vmjoin(p, spare);
+    if(p->vforked)
+      wakeup(p->parent);  // the parent may have its address space back
+    release(&ptable.lock);
+    return 0;
+  }
+  if(spare)
+    slabfree(&vmslab, spare);
+  if(p)
+    p->vm->pgdir = pgdir;
+  release(&ptable.lock);
+  return 1;
 }
 
 // Must be called with interrupts disabled
@@ -65,35 +306,358 @@ myproc(void) {
   return p;
 }
 
-//PAGEBREAK: 32
-// Look in the process table for an UNUSED proc.
-// If found, change state to EMBRYO and initialize
-// state required to run in the kernel.
-// Otherwise return 0.
+//PAGEBREAK: 20
+// CPUs p may run on: its affinity, less the CPUs dedicated to
+// other processes.  Should that leave nothing, any CPU that is
+// not dedicated will do.
+static uint
+cpumask(struct proc *p)
+{
+  uint m;
+
+  if(p->dedicated)
+    return p->affinity;
+  m = p->affinity & ~reservedcpus & ALLCPUS;
+  return m ? m : ~reservedcpus & ALLCPUS;
+}
+
+// Apply any priority boost p missed while off the run queues.
+// Caller must hold p->lock.
+static void
+catchup(struct proc *p)
+{
+  if(p->boost == boosts)
+    return;
+  p->boost = boosts;
+  if(!p->prio_pinned){
+    p->priority = 0;
+    p->slice = 0;
+  }
+}
+
+// Append p to level l of rq.  Caller must hold rq->lock.
+static void
+runqpush(struct runq *rq, struct proc *p, int l)
+{
+  p->rqnext = 0;
+  if(rq->tail[l])
+    rq->tail[l]->rqnext = p;
+  else
+    rq->head[l] = p;
+  rq->tail[l] = p;
+}
+
+// Unlink p, which follows prev (0 if p is the head), from
+// level l of rq.  Caller must hold rq->lock.
+static void
+runqunlink(struct runq *rq, int l, struct proc *prev, struct proc *p)
+{
+  if(prev)
+    prev->rqnext = p->rqnext;
+  else
+    rq->head[l] = p->rqnext;
+  if(rq->tail[l] == p)
+    rq->tail[l] = prev;
+  rq->n--;
+  p->rqnext = 0;
+}
+
+// Get a CPU to run work just queued on CPU i: CPU i itself if it
+// is halted, or else any halted CPU that p may run on, which will
+// steal the work if CPU i is busy with some other process.
+static void
+kickidle(int i, struct proc *p)
+{
+  int j;
+  uint m;
+
+  if(!cpus[i].idle){
+    if(cpus[i].proc == 0 || cpus[i].proc == p)
+      return;  // CPU i will get to it shortly
+    m = cpumask(p);
+    for(j = 0; j < ncpu; j++)
+      if(cpus[j].idle && (m & (1 << j)))
+        break;
+    if(j == ncpu)
+      return;
+    i = j;
+  }
+  if(i != cpuid())
+    lapicwake(cpus[i].apicid);
+}
+
+// Mark p RUNNABLE and append it to the run queue of the CPU it last
+// ran on, which is most likely to still have its state cached.
+// If p may no longer run there, it goes to the least loaded CPU
+// it may run on.  Caller must hold p->lock.
+static void
+makerunnable(struct proc *p)
+{
+  struct runq *rq;
+  uint m;
+  int i;
+
+  if(!holding(&p->lock))
+    panic("makerunnable");
+  p->state = RUNNABLE;
+  catchup(p);
+  m = cpumask(p);
+  if((m & (1 << p->cpu)) == 0){
+    p->cpu = -1;
+    for(i = 0; i < ncpu; i++)
+      if((m & (1 << i)) && (p->cpu < 0 || runqs[i].n < runqs[p->cpu].n))
+        p->cpu = i;
+  }
+  rq = &runqs[p->cpu];
+  acquire(&rq->lock);
+  // A process that slept must not bank credit for the time it
+  // was away, or it would monopolize the CPU on waking.
+  if(PASSLT(p->pass, rq->vpass))
+    p->pass = rq->vpass;
+  runqpush(rq, p, p->priority);
+  rq->n++;
+  release(&rq->lock);
+  kickidle(p->cpu, p);
+}
+
+// Pop the next process for CPU self to run from CPU i's run queue,
+// or return 0.  Only processes that may run on self are considered.
+// Under MLFQ that is the first of them at the highest level;
+// under stride scheduling it is the one with the least pass.
 static struct proc*
-allocproc(void)
+runqget(int i, int self)
+{
+  struct runq *rq = &runqs[i];
+  struct proc *p, *prev, *best, *bestprev;
+  int l, bestl;
+
+  if(rq->n == 0)  // racy peek; saves taking the lock when idle
+    return 0;
+  best = bestprev = 0;
+  bestl = 0;
+  acquire(&rq->lock);
+  for(l = 0; l < NPRIO; l++){
+    prev = 0;
+    for(p = rq->head[l]; p; prev = p, p = p->rqnext){
+      if((cpumask(p) & (1 << self)) == 0)
+        continue;
+      if(best == 0 || PASSLT(p->pass, best->pass)){
+        best = p;
+        bestprev = prev;
+        bestl = l;
+      }
+      if(schedpolicy == SCHED_MLFQ)
+        break;
+    }
+    if(best && schedpolicy == SCHED_MLFQ)
+      break;
+  }
+  if(best){
+    runqunlink(rq, bestl, bestprev, best);
+    rq->vpass = best->pass;
+  }
+  release(&rq->lock);
+  return best;
+}
+
+// Unlink p from its run queue.  Returns 0 if p was not queued,
+// e.g. because a scheduler has already popped it.
+// Caller must hold p->lock.
+static int
+runqremove(struct proc *p)
 {
+  struct runq *rq = &runqs[p->cpu];
+  struct proc *q, *prev;
+  int l;
+
+  acquire(&rq->lock);
+  for(l = 0; l < NPRIO; l++){
+    prev = 0;
+    for(q = rq->head[l]; q; prev = q, q = q->rqnext){
+      if(q == p){
+        runqunlink(rq, l, prev, p);
+        release(&rq->lock);
+        return 1;
+      }
+    }
+  }
+  release(&rq->lock);
+  return 0;
+}
+
+// Does CPU i's run queue hold anything CPU self may run?
+static int
+runqhas(int i, int self)
+{
+  struct runq *rq = &runqs[i];
   struct proc *p;
-  char *sp;
+  int l, found;
 
-  acquire(&ptable.lock);
+  if(rq->n == 0)
+    return 0;
+  found = 0;
+  acquire(&rq->lock);
+  for(l = 0; l < NPRIO && !found; l++)
+    for(p = rq->head[l]; p && !found; p = p->rqnext)
+      found = (cpumask(p) & (1 << self)) != 0;
+  release(&rq->lock);
+  return found;
+}
+
+// Move the processes that may not run on CPU i off its run queue,
+// as when i has just been dedicated to one process.
+static void
+runqmigrate(int i)
+{
+  struct runq *rq = &runqs[i];
+  struct proc *p, *prev;
+  int l;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == UNUSED)
-      goto found;
+  for(;;){
+    if(rq->n == 0)
+      return;
+    acquire(&rq->lock);
+    for(l = 0; l < NPRIO; l++){
+      prev = 0;
+      for(p = rq->head[l]; p; prev = p, p = p->rqnext)
+        if((cpumask(p) & (1 << i)) == 0)
+          goto found;
+    }
+    release(&rq->lock);
+    return;
+
+  found:
+    runqunlink(rq, l, prev, p);
+    release(&rq->lock);
+    acquire(&p->lock);  // waits for p to finish switching out
+    makerunnable(p);
+    release(&p->lock);
+  }
+}
 
-  release(&ptable.lock);
+// Called by an idle CPU: take a process from the busiest other
+// run queue, or failing that, since everything there may be
+// pinned elsewhere, from any other.
+static struct proc*
+runqsteal(int self)
+{
+  struct proc *p;
+  int i, busiest;
+
+  busiest = -1;
+  for(i = 0; i < ncpu; i++){
+    if(i == self || runqs[i].n == 0)
+      continue;
+    if(busiest < 0 || runqs[i].n > runqs[busiest].n)
+      busiest = i;
+  }
+  if(busiest < 0)
+    return 0;
+  if((p = runqget(busiest, self)) != 0)
+    return p;
+  for(i = 0; i < ncpu; i++)
+    if(i != self && i != busiest && (p = runqget(i, self)) != 0)
+      return p;
+  return 0;
+}
+
+//PAGEBREAK: 32
+// Return the live proc with the given pid, or 0.
+// Caller must hold ptable.lock.
+static struct proc*
+findproc(int pid)
+{
+  struct proc *p;
+
+  for(p = *PIDHASH(pid); p; p = p->hashnext)
+    if(p->pid == pid)
+      return p;
   return 0;
+}
+
+// Make p a child of parent.  Caller must hold ptable.lock.
+static void
+adopt(struct proc *parent, struct proc *p)
+{
+  p->parent = parent;
+  p->sibling = parent->children;
+  parent->children = p;
+}
+
+// Take p out of the pid hash and off its parent's children, and
+// give it back to the slab.  Caller must hold ptable.lock.
+static void
+freeproc(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = PIDHASH(p->pid); *pp != p; pp = &(*pp)->hashnext)
+    ;
+  *pp = p->hashnext;
+  if(p->parent){
+    for(pp = &p->parent->children; *pp != p; pp = &(*pp)->sibling)
+      ;
+    *pp = p->sibling;
+  }
+  p->pid = 0;
+  p->parent = 0;
+  p->state = UNUSED;
+  ptable.nproc--;
+  slabfree(&ptable.slab, p);
+}
+
+// Allocate a proc from the slab, change its state to EMBRYO
+// and initialize state required to run in the kernel.
+// Return 0 if out of memory or at NPROC processes.
+static struct proc*
+allocproc(void)
+{
+  struct proc *p, **pp;
+  char *sp;
+
+  if((p = slaballoc(&ptable.slab)) == 0)
+    return 0;
+  acquire(&ptable.lock);
+  if(ptable.nproc >= NPROC){
+    release(&ptable.lock);
+    slabfree(&ptable.slab, p);
+    return 0;
+  }
+  ptable.nproc++;
 
-found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  pp = PIDHASH(p->pid);
+  p->hashnext = *pp;
+  *pp = p;
+  p->parent = 0;
+  p->children = 0;
+  p->sibling = 0;
+  p->killed = 0;
+  p->chan = 0;
+  p->name[0] = 0;
+  p->ustack = 0;
+  p->vm = 0;
+  p->fdt = 0;
+  p->boost = boosts;
+  p->priority = 0;
+  p->prio_pinned = 0;
+  p->slice = 0;
+  memset(p->ticks, 0, sizeof(p->ticks));
+  p->tickets = DEFTICKETS;
+  p->stride = STRIDE1 / DEFTICKETS;
+  p->pass = 0;
+  p->affinity = ~0;
+  p->dedicated = 0;
+  p->vforked = 0;
 
   release(&ptable.lock);
 
   // Allocate kernel stack.
   if((p->kstack = kalloc()) == 0){
-    p->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
     return 0;
   }
   sp = p->kstack + KSTACKSIZE;
@@ -115,12 +679,50 @@ found:
   return p;
 }
 
+// Start a kernel process called name running fn, which must never
+// return.  It has a page table with just the kernel mappings.
+// Returns its pid, or -1 if out of memory.
+int
+kproc(char *name, void (*fn)(void))
+{
+  struct proc *p;
+  struct vmspace *vm;
+
+  if((p = allocproc()) == 0)
+    return -1;
+  if((p->pgdir = setupkvm()) == 0 || (vm = allocvm(p->pgdir)) == 0){
+    if(p->pgdir)
+      freevm(p->pgdir);
+    kfree(p->kstack);
+    p->kstack = 0;
+    acquire(&ptable.lock);
+    freeproc(p);
+    release(&ptable.lock);
+    return -1;
+  }
+  acquire(&ptable.lock);
+  vmjoin(p, vm);
+  release(&ptable.lock);
+  p->sz = 0;
+  safestrcpy(p->name, name, sizeof(p->name));
+
+  // Have forkret return into fn instead of trapret.
+  *(uint*)(p->context + 1) = (uint)fn;
+
+  acquire(&p->lock);
+  p->cpu = cpuid();
+  makerunnable(p);
+  release(&p->lock);
+  return p->pid;
+}
+
 //PAGEBREAK: 32
 // Set up first user process.
 void
 userinit(void)
 {
   struct proc *p;
+  struct vmspace *vm;
   extern char _binary_initcode_start[], _binary_initcode_size[];
 
   p = allocproc();
@@ -128,6 +730,13 @@ userinit(void)
   initproc = p;
   if((p->pgdir = setupkvm()) == 0)
     panic("userinit: out of memory?");
+  if((vm = allocvm(p->pgdir)) == 0)
+    panic("userinit: no vmspace");
+  if((p->fdt = copyfdt(0)) == 0)
+    panic("userinit: no fdtable");
+  acquire(&ptable.lock);
+  vmjoin(p, vm);
+  release(&ptable.lock);
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
   p->sz = PGSIZE;
   memset(p->tf, 0, sizeof(*p->tf));
@@ -142,15 +751,14 @@ userinit(void)
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
 
-  // this assignment to p->state lets other cores
-  // run this process. the acquire forces the above
-  // writes to be visible, and the lock is also needed
-  // because the assignment might not be atomic.
-  acquire(&ptable.lock);
-
-  p->state = RUNNABLE;
-
-  release(&ptable.lock);
+  // queueing p lets other cores run this process.
+  // the acquire forces the above writes to be visible,
+  // and the lock is also needed because the assignment
+  // might not be atomic.
+  acquire(&p->lock);
+  p->cpu = cpuid();
+  makerunnable(p);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
@@ -160,17 +768,35 @@ growproc(int n)
 {
   uint sz;
   struct proc *curproc = myproc();
+  struct vmspace *vm = curproc->vm;
+  struct proc *p;
 
+  acquiresleep(&vm->lock);
   sz = curproc->sz;
   if(n > 0){
-    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if((sz = allocuvm(curproc->pgdir, sz, sz + n)) == 0){
+      releasesleep(&vm->lock);
       return -1;
+    }
   } else if(n < 0){
-    if((sz = deallocuvm(curproc->pgdir, sz, sz + n)) == 0)
+    if(sz + n > sz){
+      releasesleep(&vm->lock);
       return -1;
+    }
+    // Other threads may still reach the frames through their
+    // TLBs, so they are freed only after the flush.
+    unmapuvm(curproc->pgdir, PGROUNDUP(sz + n), sz);
+    flushuvm(curproc);
+    reapuvm(curproc->pgdir, PGROUNDUP(sz + n), sz);
+    sz += n;
   }
-  curproc->sz = sz;
-  switchuvm(curproc);
+  // Every thread sharing the address space sees the new size.
+  acquire(&ptable.lock);
+  for(p = vm->procs; p; p = p->vmnext)
+    p->sz = sz;
+  release(&ptable.lock);
+  releasesleep(&vm->lock);
+  flushuvm(curproc);
   return 0;
 }
 
@@ -182,64 +808,92 @@ fork(void)
 {
   int i, pid;
   struct proc *np;
+  struct vmspace *vm;
   struct proc *curproc = myproc();
 
   // Allocate process.
   if((np = allocproc()) == 0){
     return -1;
   }
+  if((np->fdt = copyfdt(curproc->fdt)) == 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
 
-  // Copy process state from proc.
-  if((np->pgdir = copyuvm(curproc->pgdir, curproc->sz)) == 0){
+  // Copy process state from proc.  Hold the address space still
+  // in case other threads of curproc are changing it.
+  acquiresleep(&curproc->vm->lock);
+  np->pgdir = copyuvm(curproc->pgdir, curproc->sz);
+  // The child gets copies of the resident pages of private wmap
+  // regions, and shares the very frames of MAP_SHARED ones.
+  for(i = 0; np->pgdir && i < curproc->vm->wmap.total_mmaps; i++){
+    uint start = curproc->vm->wmap.addr[i];
+    uint end = PGROUNDUP(start + curproc->vm->wmap.length[i]);
+    if(copyuvmrange(np->pgdir, curproc->pgdir, start, end,
+                    curproc->vm->wmap.shared[i]) < 0){
+      freevm(np->pgdir);
+      np->pgdir = 0;
+    }
+  }
+  if(np->pgdir == 0 || (vm = allocvm(np->pgdir)) == 0){
+    releasesleep(&curproc->vm->lock);
+    if(np->pgdir)
+      freevm(np->pgdir);
+    putfdt(np);
     kfree(np->kstack);
     np->kstack = 0;
-    np->state = UNUSED;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
     return -1;
   }
+  acquire(&ptable.lock);
+  vmjoin(np, vm);
+  adopt(curproc, np);
+  release(&ptable.lock);
   np->sz = curproc->sz;
-  np->parent = curproc;
   *np->tf = *curproc->tf;
 
   // Added P4
-  for (int i = 0; i < curproc->wmap.total_mmaps; i++) {
-    np->wmap.addr[i] = curproc->wmap.addr[i];
-    if (!curproc->wmap.shared[i]) {
-      // Alloc new momory for child
-      char *mem = kalloc();
-      cprintf("new mem: %x; old mem virt: %x\n", mem, curproc->wmap.addr[i]);
-      // Copy mem
-      memmove(mem, (void*)np->wmap.addr[i], PGSIZE);
-      // Unmap old page
-      pte_t* oldpg = walkpgdir(np->pgdir, (void*)np->wmap.addr[i], 0);
-      *oldpg = 0;
-      // Map new page
-      mappages(np->pgdir, (void*)np->wmap.addr[i], PGSIZE, V2P(mem), PTE_W | PTE_U);
-    }
-    np->wmap.anon[i] = curproc->wmap.anon[i];
-    np->wmap.fptr[i] = curproc->wmap.fptr[i];
-    np->wmap.length[i] = curproc->wmap.length[i];
-    np->wmap.n_loaded_pages[i] = curproc->wmap.n_loaded_pages[i];
-    np->wmap.shared[i] = curproc->wmap.shared[i];
-    np->wmap.total_mmaps = curproc->wmap.total_mmaps;
+  for (int i = 0; i < curproc->vm->wmap.total_mmaps; i++) {
+    np->vm->wmap.addr[i] = curproc->vm->wmap.addr[i];
+    np->vm->wmap.anon[i] = curproc->vm->wmap.anon[i];
+    np->vm->wmap.fptr[i] = curproc->vm->wmap.fptr[i];
+    if (np->vm->wmap.fptr[i])
+      filedup(np->vm->wmap.fptr[i]);
+    np->vm->wmap.offset[i] = curproc->vm->wmap.offset[i];
+    np->vm->wmap.length[i] = curproc->vm->wmap.length[i];
+    np->vm->wmap.n_loaded_pages[i] = curproc->vm->wmap.n_loaded_pages[i];
+    np->vm->wmap.shared[i] = curproc->vm->wmap.shared[i];
+    np->vm->wmap.mapid[i] = curproc->vm->wmap.mapid[i];
+    np->vm->wmap.total_mmaps = curproc->vm->wmap.total_mmaps;
   }
+  np->vm->nextmapid = curproc->vm->nextmapid;
+  releasesleep(&curproc->vm->lock);
 
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
-  for(i = 0; i < NOFILE; i++)
-    if(curproc->ofile[i])
-      np->ofile[i] = filedup(curproc->ofile[i]);
   np->cwd = idup(curproc->cwd);
 
   safestrcpy(np->name, curproc->name, sizeof(curproc->name));
 
-  pid = np->pid;
+  // The child inherits its parent's share of the CPU.
+  np->tickets = curproc->tickets;
+  np->stride = curproc->stride;
+  np->pass = curproc->pass;
+  np->affinity = curproc->affinity;
 
-  acquire(&ptable.lock);
+  pid = np->pid;
 
-  np->state = RUNNABLE;
-
-  release(&ptable.lock);
+  acquire(&np->lock);
+  np->cpu = cpuid();
+  makerunnable(np);
+  release(&np->lock);
 
   return pid;
 }
@@ -252,24 +906,34 @@ exit(void)
 {
   struct proc *curproc = myproc();
   struct proc *p;
-  int fd;
+  int last;
 
   if(curproc == initproc)
     panic("init exiting");
 
-  // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd]){
-      fileclose(curproc->ofile[fd]);
-      curproc->ofile[fd] = 0;
-    }
-  }
+  // The last thread out closes all open files.
+  putfdt(curproc);
+
+  // The last thread out tears down the shared wmap regions;
+  // the pgdir itself goes when the last thread is reaped.
+  acquire(&ptable.lock);
+  last = --curproc->vm->nlive == 0;
+  release(&ptable.lock);
 
-  // Added P4 - Remove all mappings
-  for (int i = 0; i < curproc->wmap.total_mmaps; i++) {
-    cprintf("Exit debug: Invalidating %x\n", curproc->wmap.addr[i]);
-    freevm(curproc->pgdir);
+  // Added P4 - Remove all mappings, dropping any wmlock pins first
+  for (int i = 0; last && i < curproc->vm->wmap.total_mmaps; i++) {
+    uint start = curproc->vm->wmap.addr[i];
+    uint end = PGROUNDUP(start + curproc->vm->wmap.length[i]);
+    if (!curproc->vm->wmap.anon[i] && curproc->vm->wmap.shared[i])
+      wmapwriteback(curproc, curproc->vm->wmap.fptr[i], start, end,
+                    curproc->vm->wmap.offset[i]);
+    if (curproc->vm->wmap.fptr[i])
+      fileclose(curproc->vm->wmap.fptr[i]);
+    curproc->vm->npinned -= unpinuvm(curproc->pgdir, start, end);
+    deallocuvm(curproc->pgdir, end, start);
   }
+  if (last)
+    curproc->vm->wmap.total_mmaps = 0;
 
   begin_op();
   iput(curproc->cwd);
@@ -279,24 +943,57 @@ exit(void)
   acquire(&ptable.lock);
 
   // Parent might be sleeping in wait().
-  wakeup1(curproc->parent);
+  wakeup(curproc->parent);
 
   // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == curproc){
+  if((p = curproc->children) != 0){
+    for(;; p = p->sibling){
       p->parent = initproc;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup(initproc);
+      if(p->sibling == 0)
+        break;
     }
+    p->sibling = initproc->children;
+    initproc->children = curproc->children;
+    curproc->children = 0;
+  }
+
+  // Give back any CPU we had to ourselves.
+  if(curproc->dedicated){
+    reservedcpus &= ~curproc->affinity;
+    curproc->dedicated = 0;
   }
 
-  // Jump into the scheduler, never to return.
+  // Jump into the scheduler, never to return. wait() cannot
+  // reap us until the scheduler drops p->lock after the switch.
+  acquire(&curproc->lock);
   curproc->state = ZOMBIE;
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
 
+// Free what is left of ZOMBIE p and return its pid.  Its address
+// space goes with the last thread using it.
+// Caller must hold ptable.lock, but not p->lock.
+static int
+reap(struct proc *p)
+{
+  int pid;
+
+  pid = p->pid;
+  kfree(p->kstack);
+  p->kstack = 0;
+  vmleave(p);
+  p->pgdir = 0;
+  freeproc(p);
+  return pid;
+}
+
 // Wait for a child process to exit and return its pid.
+// Threads are not waited for; see join.  A vfork child is
+// waited for even before it leaves the parent's address space.
 // Return -1 if this process has no children.
 int
 wait(void)
@@ -307,26 +1004,22 @@ wait(void)
   
   acquire(&ptable.lock);
   for(;;){
-    // Scan through table looking for exited children.
+    // Scan through our children looking for exited ones.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != curproc)
+    for(p = curproc->children; p; p = p->sibling){
+      if(p->vm == curproc->vm && !p->vforked)
         continue;
       havekids = 1;
+      // p->lock is held until p has switched out for good.
+      acquire(&p->lock);
       if(p->state == ZOMBIE){
         // Found one.
-        pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
-        p->state = UNUSED;
+        release(&p->lock);
+        pid = reap(p);
         release(&ptable.lock);
         return pid;
       }
+      release(&p->lock);
     }
 
     // No point waiting if we don't have any children.
@@ -335,11 +1028,229 @@ wait(void)
       return -1;
     }
 
-    // Wait for children to exit.  (See wakeup1 call in proc_exit.)
+    // Wait for children to exit.  (See wakeup call in proc_exit.)
     sleep(curproc, &ptable.lock);  //DOC: wait-sleep
   }
 }
 
+// Create a thread that shares the current process's address
+// space, wmap regions and descriptor table, and starts running
+// fn(arg) on the one-page user stack at stack.
+// Returns the new thread's pid.
+int
+clone(void (*fn)(void*), void *arg, void *stack)
+{
+  int pid;
+  uint sp, ustack[2];
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  if((uint)stack % PGSIZE != 0 || (uint)stack + PGSIZE > curproc->sz ||
+     (uint)stack + PGSIZE < (uint)stack)
+    return -1;
+
+  // Build fn's frame: a fake return PC, so that a thread returning
+  // from fn faults rather than running off its stack, then arg.
+  ustack[0] = 0xffffffff;
+  ustack[1] = (uint)arg;
+  sp = (uint)stack + PGSIZE - sizeof(ustack);
+  if(copyout(curproc->pgdir, sp, ustack, sizeof(ustack)) < 0)
+    return -1;
+
+  // Allocate process.
+  if((np = allocproc()) == 0)
+    return -1;
+
+  acquire(&ptable.lock);
+  curproc->vm->ref++;
+  curproc->vm->nlive++;
+  vmjoin(np, curproc->vm);
+  adopt(curproc, np);
+  release(&ptable.lock);
+  acquire(&curproc->fdt->lock);
+  curproc->fdt->ref++;
+  release(&curproc->fdt->lock);
+  np->fdt = curproc->fdt;
+  np->pgdir = curproc->pgdir;
+  np->sz = curproc->sz;
+  np->ustack = stack;
+  *np->tf = *curproc->tf;
+  np->tf->eax = 0;
+  np->tf->esp = sp;
+  np->tf->eip = (uint)fn;
+
+  np->cwd = idup(curproc->cwd);
+
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+
+  np->tickets = curproc->tickets;
+  np->stride = curproc->stride;
+  np->pass = curproc->pass;
+  np->affinity = curproc->affinity;
+
+  pid = np->pid;
+
+  acquire(&np->lock);
+  np->cpu = cpuid();
+  makerunnable(np);
+  release(&np->lock);
+
+  return pid;
+}
+
+// Like fork, but the child borrows the parent's address space
+// instead of copying it, and the parent sleeps until the child
+// gives it back by calling exec or exit.  The child runs on the
+// parent's stack, so it should do little but set up for exec.
+int
+vfork(void)
+{
+  int pid;
+  struct proc *np;
+  struct proc *curproc = myproc();
+
+  // Allocate process.
+  if((np = allocproc()) == 0)
+    return -1;
+  if((np->fdt = copyfdt(curproc->fdt)) == 0){
+    kfree(np->kstack);
+    np->kstack = 0;
+    acquire(&ptable.lock);
+    freeproc(np);
+    release(&ptable.lock);
+    return -1;
+  }
+
+  acquire(&ptable.lock);
+  curproc->vm->ref++;
+  curproc->vm->nlive++;
+  vmjoin(np, curproc->vm);
+  adopt(curproc, np);
+  release(&ptable.lock);
+  np->pgdir = curproc->pgdir;
+  np->sz = curproc->sz;
+  np->vforked = 1;
+  *np->tf = *curproc->tf;
+
+  // Clear %eax so that vfork returns 0 in the child.
+  np->tf->eax = 0;
+
+  np->cwd = idup(curproc->cwd);
+
+  safestrcpy(np->name, curproc->name, sizeof(curproc->name));
+
+  np->tickets = curproc->tickets;
+  np->stride = curproc->stride;
+  np->pass = curproc->pass;
+  np->affinity = curproc->affinity;
+
+  pid = np->pid;
+
+  acquire(&ptable.lock);
+  acquire(&np->lock);
+  np->cpu = cpuid();
+  makerunnable(np);
+  release(&np->lock);
+  // exec (in vmexec) and exit wake us once the child is out.
+  while(np->vm == curproc->vm && np->state != ZOMBIE)
+    sleep(curproc, &ptable.lock);
+  release(&ptable.lock);
+
+  return pid;
+}
+
+// Wait for a thread created by this process to exit, and return
+// its pid and, in *stack, the user stack it was given.
+// Return -1 if this process has no threads.
+int
+join(void **stack)
+{
+  struct proc *p;
+  int havekids, pid;
+  struct proc *curproc = myproc();
+
+  acquire(&ptable.lock);
+  for(;;){
+    // Scan through our children looking for exited threads.
+    havekids = 0;
+    for(p = curproc->children; p; p = p->sibling){
+      if(p->vm != curproc->vm || p->vforked)
+        continue;
+      havekids = 1;
+      acquire(&p->lock);
+      if(p->state == ZOMBIE){
+        release(&p->lock);
+        *stack = p->ustack;
+        pid = reap(p);
+        release(&ptable.lock);
+        return pid;
+      }
+      release(&p->lock);
+    }
+
+    if(!havekids || curproc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+
+    sleep(curproc, &ptable.lock);
+  }
+}
+
+// Flush stale TLB entries for p's address space after changing
+// its page table: on this CPU, and on any other CPU running one
+// of its threads, which is interrupted and waited for.
+void
+flushuvm(struct proc *p)
+{
+  struct proc *q;
+  int i, self;
+
+  switchuvm(p);
+  pushcli();
+  self = cpuid();
+  for(i = 0; i < ncpu; i++){
+    q = cpus[i].proc;
+    if(i == self || q == 0 || q->pgdir != p->pgdir)
+      continue;
+    cpus[i].tlbflush = 1;
+    lapicwake(cpus[i].apicid);
+  }
+  popcli();
+  for(i = 0; i < ncpu; i++)
+    while(cpus[i].tlbflush)
+      ;
+}
+
+// Halt this CPU until an interrupt arrives, rather than spin
+// looking for work.  CPU 0 keeps the clock, arming a one-shot timer
+// for the next sys_sleep deadline; other idle CPUs disarm their
+// timers entirely and wait for kickidle.
+static void
+idle(struct cpu *c, int id)
+{
+  uint now;
+  int i, n;
+
+  cli();
+  // Publish c->idle before the final look at the run queues,
+  // so that any later makerunnable is sure to kick us.
+  xchg(&c->idle, 1);
+  for(i = 0; i < ncpu; i++)
+    if(runqhas(i, id))
+      goto out;
+  if(id == 0){
+    now = lapicticks();
+    n = nextwake ? (int)(nextwake - now) : 0;
+    lapiconeshot(nextwake == 0 ? 0 : n > 0 ? n : 1);
+  } else
+    lapiconeshot(0);
+  stihlt();
+  lapicperiodic();
+out:
+  c->idle = 0;
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
@@ -348,43 +1259,52 @@ wait(void)
 //  - swtch to start running that process
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
+// Processes come off this CPU's own run queue in O(1); when that
+// is empty the CPU steals from the busiest other queue.  A CPU
+// dedicated to one process first pushes any other process that
+// was queued on it while it was being dedicated elsewhere.
 void
 scheduler(void)
 {
   struct proc *p;
   struct cpu *c = mycpu();
+  int id = cpuid();
   c->proc = 0;
   
   for(;;){
     // Enable interrupts on this processor.
     sti();
 
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
-        continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      c->proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-
-      swtch(&(c->scheduler), p->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      c->proc = 0;
+    if(reservedcpus & (1 << id))
+      runqmigrate(id);
+    if((p = runqget(id, id)) == 0 && (p = runqsteal(id)) == 0){
+      idle(c, id);
+      continue;
     }
-    release(&ptable.lock);
 
+    // Switch to chosen process.  It is the process's job
+    // to release p->lock and then reacquire it
+    // before jumping back to us.  If p is still
+    // switching out on another CPU, this waits for it.
+    acquire(&p->lock);
+    if(p->state != RUNNABLE)
+      panic("scheduler: not runnable");
+    c->proc = p;
+    p->cpu = id;
+    switchuvm(p);
+    p->state = RUNNING;
+
+    swtch(&(c->scheduler), p->context);
+    switchkvm();
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    c->proc = 0;
+    release(&p->lock);
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only p->lock
 // and have changed proc->state. Saves and restores
 // intena because intena is a property of this
 // kernel thread, not this CPU. It should
@@ -397,8 +1317,8 @@ sched(void)
   int intena;
   struct proc *p = myproc();
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&p->lock))
+    panic("sched p->lock");
   if(mycpu()->ncli != 1)
     panic("sched locks");
   if(p->state == RUNNING)
@@ -414,10 +1334,12 @@ sched(void)
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  myproc()->state = RUNNABLE;
+  struct proc *p = myproc();
+
+  acquire(&p->lock);  //DOC: yieldlock
+  makerunnable(p);
   sched();
-  release(&ptable.lock);
+  release(&p->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -426,8 +1348,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding p->lock from scheduler.
+  release(&myproc()->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -447,6 +1369,8 @@ void
 sleep(void *chan, struct spinlock *lk)
 {
   struct proc *p = myproc();
+  struct waitq *wq;
+  struct proc **pp;
   
   if(p == 0)
     panic("sleep");
@@ -454,19 +1378,26 @@ sleep(void *chan, struct spinlock *lk)
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
+  // Must acquire p->lock in order to
   // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
+  // Once we are on chan's wait queue, we can be
   // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
+  // (wakeup searches the queue with its lock held),
   // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
+  wq = WAITQ(chan);
+  acquire(&wq->lock);  //DOC: sleeplock1
+  acquire(&p->lock);
   // Go to sleep.
   p->chan = chan;
   p->state = SLEEPING;
+  // Join at the tail, so that wakeupn wakes the longest sleepers.
+  for(pp = &wq->head; *pp; pp = &(*pp)->wqnext)
+    ;
+  p->wqnext = 0;
+  *pp = p;
+  p->inwq = 1;
+  release(lk);
+  release(&wq->lock);
 
   sched();
 
@@ -474,32 +1405,123 @@ sleep(void *chan, struct spinlock *lk)
   p->chan = 0;
 
   // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
-  }
+  release(&p->lock);  //DOC: sleeplock2
+  acquire(lk);
 }
 
 //PAGEBREAK!
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
+// Wake up to n processes sleeping on chan, or all of them if
+// n < 0, and return how many were woken.
+// Sleepers are unlinked from the wait queue first and made
+// runnable after its lock is dropped; whoever unlinks a
+// process is the one that wakes it.
+static int
+wakeupn(void *chan, int n)
 {
-  struct proc *p;
+  struct waitq *wq = WAITQ(chan);
+  struct proc **pp, *p, *woken;
+  int nwoken;
+
+  if(wq->head == 0 || n == 0)  // racy peek; sleepers join before releasing lk
+    return 0;
+  woken = 0;
+  nwoken = 0;
+  acquire(&wq->lock);
+  for(pp = &wq->head; (p = *pp) != 0 && nwoken != n; ){
+    if(p->chan != chan){
+      pp = &p->wqnext;
+      continue;
+    }
+    *pp = p->wqnext;
+    p->inwq = 0;
+    p->wqnext = woken;
+    woken = p;
+    nwoken++;
+  }
+  release(&wq->lock);
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  while((p = woken) != 0){
+    woken = p->wqnext;
+    acquire(&p->lock);  // waits for p to finish switching out
+    makerunnable(p);
+    release(&p->lock);
+  }
+  return nwoken;
 }
 
 // Wake up all processes sleeping on chan.
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  wakeupn(chan, -1);
+}
+
+// Futex waiters sleep on the kernel address of the futex word, so
+// processes that map the same physical page meet on one channel.
+// The futex lock orders WAIT's check of the word against WAKE.
+int
+futexwait(uint *word, uint val)
+{
+  struct spinlock *lk = FUTEXLOCK(word);
+
+  acquire(lk);
+  if(*word != val){
+    release(lk);
+    return -1;
+  }
+  sleep(word, lk);
+  release(lk);
+  return 0;
+}
+
+// Wake up to n processes waiting on word; return how many.
+int
+futexwake(uint *word, int n)
+{
+  struct spinlock *lk = FUTEXLOCK(word);
+
+  acquire(lk);
+  n = wakeupn(word, n);
+  release(lk);
+  return n;
+}
+
+// Wake p, which has been killed, if it is asleep.
+static void
+wakekilled(struct proc *p)
+{
+  struct waitq *wq;
+  struct proc **pp;
+  void *chan;
+  int found;
+
+  for(;;){
+    acquire(&p->lock);
+    chan = p->state == SLEEPING ? p->chan : 0;
+    release(&p->lock);
+    if(chan == 0)
+      return;
+    wq = WAITQ(chan);
+    acquire(&wq->lock);
+    found = p->inwq && p->chan == chan;
+    if(found){
+      for(pp = &wq->head; *pp != p; pp = &(*pp)->wqnext)
+        ;
+      *pp = p->wqnext;
+      p->inwq = 0;
+    }
+    release(&wq->lock);
+    if(found){
+      acquire(&p->lock);
+      makerunnable(p);
+      release(&p->lock);
+      return;
+    }
+    // Not queued on chan: either a wakeup has already taken
+    // p off it, or p woke and is now asleep on another channel.
+    if(p->chan == chan)
+      return;
+  }
 }
 
 // Kill the process with the given pid.
@@ -511,18 +1533,242 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
+  if((p = findproc(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  acquire(&p->lock);
+  p->killed = 1;
+  release(&p->lock);
+  // Wake process from sleep if necessary.
+  wakekilled(p);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Charge the running process p for one timer tick.  Returns 1 if p
+// should give up the CPU: either it has used its whole slice at
+// this level, in which case it is also demoted, or a process of
+// higher priority is waiting on its run queue.  Under stride
+// scheduling p advances its pass and always yields, so that the
+// process with the least pass runs next.
+int
+schedtick(struct proc *p)
+{
+  struct runq *rq;
+  int l, resched;
+
+  resched = 0;
+  acquire(&p->lock);
+  catchup(p);
+  p->ticks[p->priority]++;
+  if((cpumask(p) & (1 << p->cpu)) == 0)
+    resched = 1;  // moved off this CPU by setaffinity
+  if(schedpolicy == SCHED_STRIDE){
+    p->pass += p->stride;
+    resched = 1;
+  } else if(++p->slice >= quantum[p->priority]){
+    if(!p->prio_pinned && p->priority < NPRIO-1)
+      p->priority++;
+    p->slice = 0;
+    resched = 1;
+  } else {
+    // Racy peek; at worst p runs one tick too long.
+    rq = &runqs[p->cpu];
+    for(l = 0; l < p->priority; l++)
+      if(rq->head[l])
+        resched = 1;
+  }
+  release(&p->lock);
+  return resched;
+}
+
+// Move every process whose level is not pinned back to the top
+// level, so that CPU-bound jobs sunk to the bottom cannot starve.
+// Called from the timer interrupt every BOOSTTICKS ticks.
+void
+priboost(void)
+{
+  struct proc *p, *next;
+  struct runq *rq;
+  int i, l;
+
+  // Processes off the run queues catch up later.
+  boosts++;
+
+  // Queued processes: splice the lower levels onto level 0.
+  for(i = 0; i < ncpu; i++){
+    rq = &runqs[i];
+    acquire(&rq->lock);
+    for(l = 1; l < NPRIO; l++){
+      p = rq->head[l];
+      rq->head[l] = rq->tail[l] = 0;
+      for(; p; p = next){
+        next = p->rqnext;
+        p->boost = boosts;
+        if(!p->prio_pinned){
+          p->priority = 0;
+          p->slice = 0;
+        }
+        runqpush(rq, p, p->priority);
+      }
+    }
+    release(&rq->lock);
+  }
+}
+
+// Pin process pid at MLFQ level prio, or hand it back to
+// feedback scheduling if prio is -1.
+int
+setpriority(int pid, int prio)
+{
+  struct proc *p;
+  int queued;
+
+  if(prio < -1 || prio >= NPRIO)
+    return -1;
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  acquire(&p->lock);
+  // A queued process must move to its new level's queue.
+  queued = p->state == RUNNABLE && runqremove(p);
+  p->prio_pinned = prio >= 0;
+  if(prio >= 0)
+    p->priority = prio;
+  p->slice = 0;
+  if(queued)
+    makerunnable(p);
+  release(&p->lock);
+  release(&ptable.lock);
+  return 0;
+}
+
+// Give the current process a proportional share of
+// tickets / (sum of all runnable tickets) under SCHED_STRIDE.
+int
+settickets(int tickets)
+{
+  struct proc *p = myproc();
+
+  if(tickets < 1 || tickets > MAXTICKETS)
+    return -1;
+  acquire(&p->lock);
+  p->tickets = tickets;
+  p->stride = STRIDE1 / tickets;
+  release(&p->lock);
+  return 0;
+}
+
+// Restrict process pid to the CPUs in mask.  With AFF_DEDICATE,
+// mask names a single CPU that pid is then the only process to
+// run on; at least one CPU must stay free for everything else.
+// Without it, pid gives up any CPU it had to itself.
+int
+setaffinity(int pid, uint mask, int flags)
+{
+  struct proc *p;
+  uint reserved;
+  int i, queued;
+
+  mask &= ALLCPUS;
+  if(mask == 0 || (flags & ~AFF_DEDICATE))
+    return -1;
+  if((flags & AFF_DEDICATE) && (mask & (mask - 1)))
+    return -1;
+
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) == 0 || p->state == ZOMBIE){
+    release(&ptable.lock);
+    return -1;
+  }
+  reserved = reservedcpus;
+  if(p->dedicated)
+    reserved &= ~p->affinity;
+  if(flags & AFF_DEDICATE){
+    if((reserved & mask) || (reserved | mask) == ALLCPUS){
       release(&ptable.lock);
-      return 0;
+      return -1;
     }
+    reserved |= mask;
   }
+  acquire(&p->lock);
+  // A queued process must move to a CPU it may now run on.
+  queued = p->state == RUNNABLE && runqremove(p);
+  p->affinity = mask;
+  p->dedicated = (flags & AFF_DEDICATE) != 0;
+  reservedcpus = reserved;
+  if(queued)
+    makerunnable(p);
+  release(&p->lock);
   release(&ptable.lock);
-  return -1;
+
+  if(flags & AFF_DEDICATE)
+    for(i = 0; i < ncpu; i++)
+      if(mask & (1 << i))
+        runqmigrate(i);
+  if(p == myproc())
+    yield();  // get onto an allowed CPU now
+  return 0;
+}
+
+// Return the CPUs process pid may run on, or -1.
+int
+getaffinity(int pid)
+{
+  struct proc *p;
+  int mask;
+
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) == 0 || p->state == ZOMBIE){
+    release(&ptable.lock);
+    return -1;
+  }
+  mask = p->affinity & ALLCPUS;
+  release(&ptable.lock);
+  return mask;
+}
+
+// Switch every CPU to scheduling policy SCHED_MLFQ or SCHED_STRIDE.
+// Returns the previous policy.
+int
+setschedpolicy(int policy)
+{
+  int old;
+
+  if(policy != SCHED_MLFQ && policy != SCHED_STRIDE)
+    return -1;
+  old = schedpolicy;
+  schedpolicy = policy;
+  return old;
+}
+
+// Copy out the scheduling state of process pid.
+int
+getschedinfo(int pid, struct schedinfo *si)
+{
+  struct proc *p;
+
+  acquire(&ptable.lock);
+  if((p = findproc(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  acquire(&p->lock);
+  catchup(p);
+  si->priority = p->priority;
+  si->pinned = p->prio_pinned;
+  si->slice = p->slice;
+  memmove(si->ticks, p->ticks, sizeof(si->ticks));
+  si->tickets = p->tickets;
+  si->pass = p->pass;
+  si->cpu = p->cpu;
+  si->dedicated = p->dedicated;
+  release(&p->lock);
+  release(&ptable.lock);
+  return 0;
 }
 
 //PAGEBREAK: 36
@@ -540,24 +1786,26 @@ procdump(void)
   [RUNNING]   "run   ",
   [ZOMBIE]    "zombie"
   };
-  int i;
+  int i, h;
   struct proc *p;
   char *state;
   uint pc[10];
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->state == UNUSED)
-      continue;
-    if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
-      state = states[p->state];
-    else
-      state = "???";
-    cprintf("%d %s %s", p->pid, state, p->name);
-    if(p->state == SLEEPING){
-      getcallerpcs((uint*)p->context->ebp+2, pc);
-      for(i=0; i<10 && pc[i] != 0; i++)
-        cprintf(" %p", pc[i]);
+  for(h = 0; h < NPIDHASH; h++){
+    for(p = ptable.pidhash[h]; p; p = p->hashnext){
+      if(p->state == UNUSED)
+        continue;
+      if(p->state >= 0 && p->state < NELEM(states) && states[p->state])
+        state = states[p->state];
+      else
+        state = "???";
+      cprintf("%d %s %s", p->pid, state, p->name);
+      if(p->state == SLEEPING){
+        getcallerpcs((uint*)p->context->ebp+2, pc);
+        for(i=0; i<10 && pc[i] != 0; i++)
+          cprintf(" %p", pc[i]);
+      }
+      cprintf("\n");
     }
-    cprintf("\n");
   }
 }
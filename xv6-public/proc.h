@@ -1,4 +1,7 @@
 #include "wmap.h"
+#include "sched.h"
+#include "spinlock.h"
+#include "sleeplock.h"
 
 // Per-CPU state
 struct cpu {
@@ -10,6 +13,8 @@ struct cpu {
   int ncli;                    // Depth of pushcli nesting.
   int intena;                  // Were interrupts enabled before pushcli?
   struct proc *proc;           // The process running on this cpu or null
+  volatile uint idle;          // Halted, waiting for work?
+  volatile uint tlbflush;      // Asked by flushuvm to reload %cr3
 };
 
 extern struct cpu cpus[NCPU];
@@ -36,24 +41,73 @@ struct context {
 
 enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
-// Per-process state
+// Per-process state; priority, slice and pass of a queued process
+// are guarded by its run queue lock instead of p->lock
 struct proc {
+  struct spinlock lock;        // Protects state, chan, killed and rqnext
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
   enum procstate state;        // Process state
   int pid;                     // Process ID
   struct proc *parent;         // Parent process
+  struct proc *children;       // Its children, linked through sibling
+  struct proc *sibling;        // Next child of the same parent
+  struct proc *hashnext;       // Next in the pid hash chain
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct proc *wqnext;         // Next on chan's wait queue
+  int inwq;                    // On a wait queue?  (guarded by its lock)
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
+  struct fdtable *fdt;         // Open files, shared by threads
   struct inode *cwd;           // Current directory
   char name[16];               // Process name (debugging)
+  struct proc *rqnext;         // Next on the run queue
+  int cpu;                     // CPU whose run queue it last joined
+  int priority;                // MLFQ level, 0 is highest
+  int prio_pinned;             // If non-zero, setpriority fixed the level
+  int slice;                   // Ticks used at the current level
+  int ticks[NPRIO];            // Ticks run at each level
+  int tickets;                 // Stride share of the CPU
+  uint stride;                 // STRIDE1 / tickets
+  uint pass;                   // Stride virtual time; least runs next
+  uint boost;                  // Priority boosts applied so far
+  uint affinity;               // Mask of CPUs it may run on
+  int dedicated;               // Has the CPU in affinity to itself?
+
+  void *ustack;                // Thread's user stack, returned by join
+  struct vmspace *vm;          // Address space, shared by threads
+  struct proc *vmnext;         // Next proc using vm
+  int vforked;                 // Made by vfork; may share parent's vm
+  int logres;                  // Log blocks its FS op reserved, unused
+};
+
+// Address-space state shared by the threads created with clone.
+// The threads also share pgdir and keep identical copies of sz.
+struct vmspace {
+  int ref;                     // # of procs using pgdir, until reaped
+  int nlive;                   // # of those that have not exited
+  struct proc *procs;          // The procs, linked through vmnext
+  pde_t *pgdir;                // Freed when ref drops to 0
+  struct sleeplock lock;       // Serializes wmap calls, faults, sbrk;
+                               // never held across file I/O
 
   // Added for P4
   struct wmapinfo wmap;
+  int nextmapid;               // Tells apart the regions of wmap calls
+  int npinned;                 // # of pages pinned by wmlock
+  struct file *dead[MAX_WMMAP_INFO]; // Unmapped files, closed after lock
+  int ndead;
+};
+
+// Descriptor table, shared by the threads created with clone.  It is
+// separate from struct vmspace because a vfork child borrows its
+// parent's address space but has descriptors of its own.
+struct fdtable {
+  struct spinlock lock;        // Guards ref and ofile
+  int ref;                     // # of live procs using it
+  struct file *ofile[NOFILE];  // Open files
 };
 
 // Process memory is laid out contiguously, low addresses first:
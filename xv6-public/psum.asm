@@ -0,0 +1,2039 @@
+
+_psum:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  lock_release(&sumlock);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	b8 00 00 04 00       	mov    $0x40000,%eax
+   c:	ff 71 fc             	push   -0x4(%ecx)
+   f:	55                   	push   %ebp
+  10:	89 e5                	mov    %esp,%ebp
+  12:	57                   	push   %edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	bb 04 00 00 00       	mov    $0x4,%ebx
+  1a:	51                   	push   %ecx
+  1b:	83 ec 18             	sub    $0x18,%esp
+  1e:	8b 31                	mov    (%ecx),%esi
+  20:	8b 79 04             	mov    0x4(%ecx),%edi
+  int maxthreads, i, start, elapsed, base;
+  uint expect;
+
+  maxthreads = 4;
+  n = 1 << 18;
+  23:	c7 05 2c 13 00 00 00 	movl   $0x40000,0x132c
+  2a:	00 04 00 
+  if(argc > 1)
+  2d:	83 fe 01             	cmp    $0x1,%esi
+  30:	0f 8f c6 00 00 00    	jg     fc <main+0xfc>
+    n = atoi(argv[2]);
+  if(maxthreads < 1 || n < 1){
+    printf(2, "usage: psum [maxthreads [nints]]\n");
+    exit();
+  }
+  if((data = malloc(n * sizeof(int))) == 0){
+  36:	83 ec 0c             	sub    $0xc,%esp
+  39:	c1 e0 02             	shl    $0x2,%eax
+  3c:	50                   	push   %eax
+  3d:	e8 6e 0a 00 00       	call   ab0 <malloc>
+  42:	83 c4 10             	add    $0x10,%esp
+  45:	a3 30 13 00 00       	mov    %eax,0x1330
+  4a:	85 c0                	test   %eax,%eax
+  4c:	0f 84 75 01 00 00    	je     1c7 <main+0x1c7>
+    printf(2, "psum: out of memory\n");
+    exit();
+  }
+  expect = 0;
+  52:	31 c9                	xor    %ecx,%ecx
+  for(i = 0; i < n; i++){
+  54:	31 d2                	xor    %edx,%edx
+  56:	83 3d 2c 13 00 00 00 	cmpl   $0x0,0x132c
+  5d:	7e 1a                	jle    79 <main+0x79>
+  5f:	90                   	nop
+    data[i] = i & 0xff;
+  60:	0f b6 f2             	movzbl %dl,%esi
+  63:	89 34 90             	mov    %esi,(%eax,%edx,4)
+    expect += data[i];
+  66:	a1 30 13 00 00       	mov    0x1330,%eax
+  6b:	03 0c 90             	add    (%eax,%edx,4),%ecx
+  for(i = 0; i < n; i++){
+  6e:	83 c2 01             	add    $0x1,%edx
+  71:	39 15 2c 13 00 00    	cmp    %edx,0x132c
+  77:	7f e7                	jg     60 <main+0x60>
+  }
+  expect *= ROUNDS;
+  79:	6b c1 14             	imul   $0x14,%ecx,%eax
+  lock_init(&sumlock);
+  7c:	83 ec 0c             	sub    $0xc,%esp
+
+  base = 0;
+  7f:	31 ff                	xor    %edi,%edi
+  expect *= ROUNDS;
+  81:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  lock_init(&sumlock);
+  84:	68 20 13 00 00       	push   $0x1320
+  89:	e8 22 04 00 00       	call   4b0 <lock_init>
+  for(nthreads = 1; nthreads <= maxthreads; nthreads *= 2){
+  8e:	83 c4 10             	add    $0x10,%esp
+  91:	b8 01 00 00 00       	mov    $0x1,%eax
+  96:	a3 28 13 00 00       	mov    %eax,0x1328
+  9b:	39 c3                	cmp    %eax,%ebx
+  9d:	0f 8c 37 01 00 00    	jl     1da <main+0x1da>
+    total = 0;
+  a3:	31 f6                	xor    %esi,%esi
+  a5:	89 35 24 13 00 00    	mov    %esi,0x1324
+    start = uptime();
+    for(i = 0; i < nthreads; i++){
+  ab:	31 f6                	xor    %esi,%esi
+    start = uptime();
+  ad:	e8 4a 06 00 00       	call   6fc <uptime>
+    for(i = 0; i < nthreads; i++){
+  b2:	83 3d 28 13 00 00 00 	cmpl   $0x0,0x1328
+    start = uptime();
+  b9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    for(i = 0; i < nthreads; i++){
+  bc:	7f 16                	jg     d4 <main+0xd4>
+  be:	e9 9d 00 00 00       	jmp    160 <main+0x160>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	a1 28 13 00 00       	mov    0x1328,%eax
+  cd:	83 c6 01             	add    $0x1,%esi
+  d0:	39 f0                	cmp    %esi,%eax
+  d2:	7e 76                	jle    14a <main+0x14a>
+      if(thread_create(worker, (void*)i) < 0){
+  d4:	83 ec 08             	sub    $0x8,%esp
+  d7:	56                   	push   %esi
+  d8:	68 e0 01 00 00       	push   $0x1e0
+  dd:	e8 de 0a 00 00       	call   bc0 <thread_create>
+  e2:	83 c4 10             	add    $0x10,%esp
+  e5:	85 c0                	test   %eax,%eax
+  e7:	79 df                	jns    c8 <main+0xc8>
+        printf(2, "psum: thread_create failed\n");
+  e9:	51                   	push   %ecx
+  ea:	51                   	push   %ecx
+  eb:	68 78 0d 00 00       	push   $0xd78
+  f0:	6a 02                	push   $0x2
+  f2:	e8 79 07 00 00       	call   870 <printf>
+        exit();
+  f7:	e8 68 05 00 00       	call   664 <exit>
+    maxthreads = atoi(argv[1]);
+  fc:	83 ec 0c             	sub    $0xc,%esp
+  ff:	ff 77 04             	push   0x4(%edi)
+ 102:	e8 39 03 00 00       	call   440 <atoi>
+  if(argc > 2)
+ 107:	83 c4 10             	add    $0x10,%esp
+    maxthreads = atoi(argv[1]);
+ 10a:	89 c3                	mov    %eax,%ebx
+  if(argc > 2)
+ 10c:	83 fe 02             	cmp    $0x2,%esi
+ 10f:	74 13                	je     124 <main+0x124>
+    n = atoi(argv[2]);
+ 111:	83 ec 0c             	sub    $0xc,%esp
+ 114:	ff 77 08             	push   0x8(%edi)
+ 117:	e8 24 03 00 00       	call   440 <atoi>
+ 11c:	83 c4 10             	add    $0x10,%esp
+ 11f:	a3 2c 13 00 00       	mov    %eax,0x132c
+  if(maxthreads < 1 || n < 1){
+ 124:	85 db                	test   %ebx,%ebx
+ 126:	7f 14                	jg     13c <main+0x13c>
+    printf(2, "usage: psum [maxthreads [nints]]\n");
+ 128:	83 ec 08             	sub    $0x8,%esp
+ 12b:	68 94 0d 00 00       	push   $0xd94
+ 130:	6a 02                	push   $0x2
+ 132:	e8 39 07 00 00       	call   870 <printf>
+    exit();
+ 137:	e8 28 05 00 00       	call   664 <exit>
+  if(maxthreads < 1 || n < 1){
+ 13c:	a1 2c 13 00 00       	mov    0x132c,%eax
+ 141:	85 c0                	test   %eax,%eax
+ 143:	7e e3                	jle    128 <main+0x128>
+ 145:	e9 ec fe ff ff       	jmp    36 <main+0x36>
+      }
+    }
+    for(i = 0; i < nthreads; i++)
+ 14a:	85 c0                	test   %eax,%eax
+ 14c:	7e 12                	jle    160 <main+0x160>
+ 14e:	31 f6                	xor    %esi,%esi
+      thread_join();
+ 150:	e8 7b 0b 00 00       	call   cd0 <thread_join>
+    for(i = 0; i < nthreads; i++)
+ 155:	83 c6 01             	add    $0x1,%esi
+ 158:	39 35 28 13 00 00    	cmp    %esi,0x1328
+ 15e:	7f f0                	jg     150 <main+0x150>
+    elapsed = uptime() - start;
+ 160:	e8 97 05 00 00       	call   6fc <uptime>
+    if(elapsed == 0)
+ 165:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 168:	29 c8                	sub    %ecx,%eax
+ 16a:	89 c1                	mov    %eax,%ecx
+ 16c:	75 05                	jne    173 <main+0x173>
+      elapsed = 1;
+ 16e:	b9 01 00 00 00       	mov    $0x1,%ecx
+    if(base == 0)
+      base = elapsed;
+ 173:	85 ff                	test   %edi,%edi
+    printf(1, "psum: %d threads: %d ticks, speedup x%d.%d%s\n",
+ 175:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 178:	ba 93 0d 00 00       	mov    $0xd93,%edx
+ 17d:	be 0a 00 00 00       	mov    $0xa,%esi
+      base = elapsed;
+ 182:	0f 44 f9             	cmove  %ecx,%edi
+    printf(1, "psum: %d threads: %d ticks, speedup x%d.%d%s\n",
+ 185:	39 05 24 13 00 00    	cmp    %eax,0x1324
+ 18b:	b8 58 0d 00 00       	mov    $0xd58,%eax
+ 190:	0f 44 c2             	cmove  %edx,%eax
+ 193:	52                   	push   %edx
+ 194:	50                   	push   %eax
+           nthreads, elapsed, base / elapsed, (base * 10 / elapsed) % 10,
+ 195:	6b c7 0a             	imul   $0xa,%edi,%eax
+ 198:	99                   	cltd
+ 199:	f7 f9                	idiv   %ecx
+    printf(1, "psum: %d threads: %d ticks, speedup x%d.%d%s\n",
+ 19b:	99                   	cltd
+ 19c:	f7 fe                	idiv   %esi
+ 19e:	89 f8                	mov    %edi,%eax
+ 1a0:	52                   	push   %edx
+ 1a1:	99                   	cltd
+ 1a2:	f7 f9                	idiv   %ecx
+ 1a4:	50                   	push   %eax
+ 1a5:	51                   	push   %ecx
+ 1a6:	ff 35 28 13 00 00    	push   0x1328
+ 1ac:	68 b8 0d 00 00       	push   $0xdb8
+ 1b1:	6a 01                	push   $0x1
+ 1b3:	e8 b8 06 00 00       	call   870 <printf>
+  for(nthreads = 1; nthreads <= maxthreads; nthreads *= 2){
+ 1b8:	a1 28 13 00 00       	mov    0x1328,%eax
+ 1bd:	83 c4 20             	add    $0x20,%esp
+ 1c0:	01 c0                	add    %eax,%eax
+ 1c2:	e9 cf fe ff ff       	jmp    96 <main+0x96>
+    printf(2, "psum: out of memory\n");
+ 1c7:	57                   	push   %edi
+ 1c8:	57                   	push   %edi
+ 1c9:	68 63 0d 00 00       	push   $0xd63
+ 1ce:	6a 02                	push   $0x2
+ 1d0:	e8 9b 06 00 00       	call   870 <printf>
+    exit();
+ 1d5:	e8 8a 04 00 00       	call   664 <exit>
+           total == expect ? "" : " WRONG SUM");
+  }
+  exit();
+ 1da:	e8 85 04 00 00       	call   664 <exit>
+ 1df:	90                   	nop
+
+000001e0 <worker>:
+{
+ 1e0:	55                   	push   %ebp
+ 1e1:	89 e5                	mov    %esp,%ebp
+ 1e3:	57                   	push   %edi
+ 1e4:	56                   	push   %esi
+ 1e5:	53                   	push   %ebx
+ 1e6:	83 ec 1c             	sub    $0x1c,%esp
+  lo = n / nthreads * id;
+ 1e9:	8b 0d 2c 13 00 00    	mov    0x132c,%ecx
+ 1ef:	8b 1d 28 13 00 00    	mov    0x1328,%ebx
+{
+ 1f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  lo = n / nthreads * id;
+ 1f8:	89 c8                	mov    %ecx,%eax
+ 1fa:	99                   	cltd
+ 1fb:	f7 fb                	idiv   %ebx
+  hi = id == nthreads-1 ? n : lo + n / nthreads;
+ 1fd:	83 eb 01             	sub    $0x1,%ebx
+  lo = n / nthreads * id;
+ 200:	89 c7                	mov    %eax,%edi
+ 202:	0f af fe             	imul   %esi,%edi
+  hi = id == nthreads-1 ? n : lo + n / nthreads;
+ 205:	01 f8                	add    %edi,%eax
+ 207:	39 de                	cmp    %ebx,%esi
+ 209:	0f 45 c8             	cmovne %eax,%ecx
+      s += data[i];
+ 20c:	a1 30 13 00 00       	mov    0x1330,%eax
+  s = 0;
+ 211:	31 db                	xor    %ebx,%ebx
+ 213:	8d 34 b8             	lea    (%eax,%edi,4),%esi
+ 216:	8d 14 88             	lea    (%eax,%ecx,4),%edx
+ 219:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+      s += data[i];
+ 21c:	be 14 00 00 00       	mov    $0x14,%esi
+ 221:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    for(i = lo; i < hi; i++)
+ 228:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 22b:	39 f9                	cmp    %edi,%ecx
+ 22d:	7e 0a                	jle    239 <worker+0x59>
+ 22f:	90                   	nop
+      s += data[i];
+ 230:	03 18                	add    (%eax),%ebx
+    for(i = lo; i < hi; i++)
+ 232:	83 c0 04             	add    $0x4,%eax
+ 235:	39 d0                	cmp    %edx,%eax
+ 237:	75 f7                	jne    230 <worker+0x50>
+  for(r = 0; r < ROUNDS; r++)
+ 239:	83 ee 01             	sub    $0x1,%esi
+ 23c:	75 ea                	jne    228 <worker+0x48>
+  lock_acquire(&sumlock);
+ 23e:	83 ec 0c             	sub    $0xc,%esp
+ 241:	68 20 13 00 00       	push   $0x1320
+ 246:	e8 75 02 00 00       	call   4c0 <lock_acquire>
+  total += s;
+ 24b:	01 1d 24 13 00 00    	add    %ebx,0x1324
+  lock_release(&sumlock);
+ 251:	83 c4 10             	add    $0x10,%esp
+ 254:	c7 45 08 20 13 00 00 	movl   $0x1320,0x8(%ebp)
+}
+ 25b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 25e:	5b                   	pop    %ebx
+ 25f:	5e                   	pop    %esi
+ 260:	5f                   	pop    %edi
+ 261:	5d                   	pop    %ebp
+  lock_release(&sumlock);
+ 262:	e9 79 02 00 00       	jmp    4e0 <lock_release>
+ 267:	66 90                	xchg   %ax,%ax
+ 269:	66 90                	xchg   %ax,%ax
+ 26b:	66 90                	xchg   %ax,%ax
+ 26d:	66 90                	xchg   %ax,%ax
+ 26f:	90                   	nop
+
+00000270 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 270:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 271:	31 c0                	xor    %eax,%eax
+{
+ 273:	89 e5                	mov    %esp,%ebp
+ 275:	53                   	push   %ebx
+ 276:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 279:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 280:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 284:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 287:	83 c0 01             	add    $0x1,%eax
+ 28a:	84 d2                	test   %dl,%dl
+ 28c:	75 f2                	jne    280 <strcpy+0x10>
+    ;
+  return os;
+}
+ 28e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 291:	89 c8                	mov    %ecx,%eax
+ 293:	c9                   	leave
+ 294:	c3                   	ret
+ 295:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002a0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	53                   	push   %ebx
+ 2a4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2aa:	0f b6 02             	movzbl (%edx),%eax
+ 2ad:	84 c0                	test   %al,%al
+ 2af:	75 17                	jne    2c8 <strcmp+0x28>
+ 2b1:	eb 3a                	jmp    2ed <strcmp+0x4d>
+ 2b3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2b7:	90                   	nop
+ 2b8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2bc:	83 c2 01             	add    $0x1,%edx
+ 2bf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2c2:	84 c0                	test   %al,%al
+ 2c4:	74 1a                	je     2e0 <strcmp+0x40>
+    p++, q++;
+ 2c6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2c8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2cb:	38 c3                	cmp    %al,%bl
+ 2cd:	74 e9                	je     2b8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2cf:	29 d8                	sub    %ebx,%eax
+}
+ 2d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2d4:	c9                   	leave
+ 2d5:	c3                   	ret
+ 2d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2dd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2e0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2e4:	31 c0                	xor    %eax,%eax
+ 2e6:	29 d8                	sub    %ebx,%eax
+}
+ 2e8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2eb:	c9                   	leave
+ 2ec:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2ed:	0f b6 19             	movzbl (%ecx),%ebx
+ 2f0:	31 c0                	xor    %eax,%eax
+ 2f2:	eb db                	jmp    2cf <strcmp+0x2f>
+ 2f4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2ff:	90                   	nop
+
+00000300 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 306:	80 3a 00             	cmpb   $0x0,(%edx)
+ 309:	74 15                	je     320 <strlen+0x20>
+ 30b:	31 c0                	xor    %eax,%eax
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+ 310:	83 c0 01             	add    $0x1,%eax
+ 313:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 317:	89 c1                	mov    %eax,%ecx
+ 319:	75 f5                	jne    310 <strlen+0x10>
+    ;
+  return n;
+}
+ 31b:	89 c8                	mov    %ecx,%eax
+ 31d:	5d                   	pop    %ebp
+ 31e:	c3                   	ret
+ 31f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 320:	31 c9                	xor    %ecx,%ecx
+}
+ 322:	5d                   	pop    %ebp
+ 323:	89 c8                	mov    %ecx,%eax
+ 325:	c3                   	ret
+ 326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 32d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000330 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	57                   	push   %edi
+ 334:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 337:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 33a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 33d:	89 d7                	mov    %edx,%edi
+ 33f:	fc                   	cld
+ 340:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 342:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 345:	89 d0                	mov    %edx,%eax
+ 347:	c9                   	leave
+ 348:	c3                   	ret
+ 349:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000350 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 35a:	0f b6 10             	movzbl (%eax),%edx
+ 35d:	84 d2                	test   %dl,%dl
+ 35f:	75 12                	jne    373 <strchr+0x23>
+ 361:	eb 1d                	jmp    380 <strchr+0x30>
+ 363:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 367:	90                   	nop
+ 368:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 36c:	83 c0 01             	add    $0x1,%eax
+ 36f:	84 d2                	test   %dl,%dl
+ 371:	74 0d                	je     380 <strchr+0x30>
+    if(*s == c)
+ 373:	38 d1                	cmp    %dl,%cl
+ 375:	75 f1                	jne    368 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 377:	5d                   	pop    %ebp
+ 378:	c3                   	ret
+ 379:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 380:	31 c0                	xor    %eax,%eax
+}
+ 382:	5d                   	pop    %ebp
+ 383:	c3                   	ret
+ 384:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 38b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 38f:	90                   	nop
+
+00000390 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 395:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 398:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 399:	31 db                	xor    %ebx,%ebx
+{
+ 39b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 39e:	eb 27                	jmp    3c7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	6a 01                	push   $0x1
+ 3a5:	56                   	push   %esi
+ 3a6:	6a 00                	push   $0x0
+ 3a8:	e8 cf 02 00 00       	call   67c <read>
+    if(cc < 1)
+ 3ad:	83 c4 10             	add    $0x10,%esp
+ 3b0:	85 c0                	test   %eax,%eax
+ 3b2:	7e 1d                	jle    3d1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3b4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3b8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3bb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3bf:	3c 0a                	cmp    $0xa,%al
+ 3c1:	74 10                	je     3d3 <gets+0x43>
+ 3c3:	3c 0d                	cmp    $0xd,%al
+ 3c5:	74 0c                	je     3d3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3c7:	89 df                	mov    %ebx,%edi
+ 3c9:	83 c3 01             	add    $0x1,%ebx
+ 3cc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3cf:	7c cf                	jl     3a0 <gets+0x10>
+ 3d1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3dd:	5b                   	pop    %ebx
+ 3de:	5e                   	pop    %esi
+ 3df:	5f                   	pop    %edi
+ 3e0:	5d                   	pop    %ebp
+ 3e1:	c3                   	ret
+ 3e2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3e9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003f0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	89 e5                	mov    %esp,%ebp
+ 3f3:	56                   	push   %esi
+ 3f4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3f5:	83 ec 08             	sub    $0x8,%esp
+ 3f8:	6a 00                	push   $0x0
+ 3fa:	ff 75 08             	push   0x8(%ebp)
+ 3fd:	e8 a2 02 00 00       	call   6a4 <open>
+  if(fd < 0)
+ 402:	83 c4 10             	add    $0x10,%esp
+ 405:	85 c0                	test   %eax,%eax
+ 407:	78 27                	js     430 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 409:	83 ec 08             	sub    $0x8,%esp
+ 40c:	ff 75 0c             	push   0xc(%ebp)
+ 40f:	89 c3                	mov    %eax,%ebx
+ 411:	50                   	push   %eax
+ 412:	e8 a5 02 00 00       	call   6bc <fstat>
+  close(fd);
+ 417:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 41a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 41c:	e8 6b 02 00 00       	call   68c <close>
+  return r;
+ 421:	83 c4 10             	add    $0x10,%esp
+}
+ 424:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 427:	89 f0                	mov    %esi,%eax
+ 429:	5b                   	pop    %ebx
+ 42a:	5e                   	pop    %esi
+ 42b:	5d                   	pop    %ebp
+ 42c:	c3                   	ret
+ 42d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 430:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 435:	eb ed                	jmp    424 <stat+0x34>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	53                   	push   %ebx
+ 444:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 447:	0f be 02             	movsbl (%edx),%eax
+ 44a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 44d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 450:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 455:	77 1e                	ja     475 <atoi+0x35>
+ 457:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 45e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 460:	83 c2 01             	add    $0x1,%edx
+ 463:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 466:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 46a:	0f be 02             	movsbl (%edx),%eax
+ 46d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 470:	80 fb 09             	cmp    $0x9,%bl
+ 473:	76 eb                	jbe    460 <atoi+0x20>
+  return n;
+}
+ 475:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 478:	89 c8                	mov    %ecx,%eax
+ 47a:	c9                   	leave
+ 47b:	c3                   	ret
+ 47c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+ 483:	57                   	push   %edi
+ 484:	56                   	push   %esi
+ 485:	8b 45 10             	mov    0x10(%ebp),%eax
+ 488:	8b 55 08             	mov    0x8(%ebp),%edx
+ 48b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 48e:	85 c0                	test   %eax,%eax
+ 490:	7e 13                	jle    4a5 <memmove+0x25>
+ 492:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 494:	89 d7                	mov    %edx,%edi
+ 496:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 49d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4a0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4a1:	39 f8                	cmp    %edi,%eax
+ 4a3:	75 fb                	jne    4a0 <memmove+0x20>
+  return vdst;
+}
+ 4a5:	5e                   	pop    %esi
+ 4a6:	89 d0                	mov    %edx,%eax
+ 4a8:	5f                   	pop    %edi
+ 4a9:	5d                   	pop    %ebp
+ 4aa:	c3                   	ret
+ 4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4af:	90                   	nop
+
+000004b0 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 4b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4bc:	5d                   	pop    %ebp
+ 4bd:	c3                   	ret
+ 4be:	66 90                	xchg   %ax,%ax
+
+000004c0 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 4c0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 4c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 4c6:	89 e5                	mov    %esp,%ebp
+ 4c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4cf:	90                   	nop
+ 4d0:	89 c8                	mov    %ecx,%eax
+ 4d2:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 4d5:	85 c0                	test   %eax,%eax
+ 4d7:	75 f7                	jne    4d0 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 4d9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 4de:	5d                   	pop    %ebp
+ 4df:	c3                   	ret
+
+000004e0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	31 c0                	xor    %eax,%eax
+ 4e3:	89 e5                	mov    %esp,%ebp
+ 4e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 4e8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 4ed:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 4f0:	5d                   	pop    %ebp
+ 4f1:	c3                   	ret
+ 4f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000500 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 503:	8b 45 08             	mov    0x8(%ebp),%eax
+ 506:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 50c:	5d                   	pop    %ebp
+ 50d:	c3                   	ret
+ 50e:	66 90                	xchg   %ax,%ax
+
+00000510 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 510:	55                   	push   %ebp
+ 511:	b8 01 00 00 00       	mov    $0x1,%eax
+ 516:	89 e5                	mov    %esp,%ebp
+ 518:	56                   	push   %esi
+ 519:	53                   	push   %ebx
+ 51a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 51d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 520:	85 c0                	test   %eax,%eax
+ 522:	74 2d                	je     551 <mutex_lock+0x41>
+ 524:	b8 02 00 00 00       	mov    $0x2,%eax
+ 529:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 52c:	85 c0                	test   %eax,%eax
+ 52e:	74 21                	je     551 <mutex_lock+0x41>
+ 530:	be 02 00 00 00       	mov    $0x2,%esi
+ 535:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 538:	83 ec 04             	sub    $0x4,%esp
+ 53b:	6a 02                	push   $0x2
+ 53d:	6a 00                	push   $0x0
+ 53f:	53                   	push   %ebx
+ 540:	e8 37 02 00 00       	call   77c <futex>
+ 545:	89 f0                	mov    %esi,%eax
+ 547:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 54a:	83 c4 10             	add    $0x10,%esp
+ 54d:	85 c0                	test   %eax,%eax
+ 54f:	75 e7                	jne    538 <mutex_lock+0x28>
+}
+ 551:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 554:	5b                   	pop    %ebx
+ 555:	5e                   	pop    %esi
+ 556:	5d                   	pop    %ebp
+ 557:	c3                   	ret
+ 558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+
+00000560 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 560:	55                   	push   %ebp
+ 561:	31 c0                	xor    %eax,%eax
+ 563:	89 e5                	mov    %esp,%ebp
+ 565:	83 ec 08             	sub    $0x8,%esp
+ 568:	8b 55 08             	mov    0x8(%ebp),%edx
+ 56b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 56e:	83 f8 02             	cmp    $0x2,%eax
+ 571:	74 05                	je     578 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 573:	c9                   	leave
+ 574:	c3                   	ret
+ 575:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 578:	83 ec 04             	sub    $0x4,%esp
+ 57b:	6a 01                	push   $0x1
+ 57d:	6a 01                	push   $0x1
+ 57f:	52                   	push   %edx
+ 580:	e8 f7 01 00 00       	call   77c <futex>
+ 585:	83 c4 10             	add    $0x10,%esp
+}
+ 588:	c9                   	leave
+ 589:	c3                   	ret
+ 58a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000590 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 593:	8b 45 08             	mov    0x8(%ebp),%eax
+ 596:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 59c:	5d                   	pop    %ebp
+ 59d:	c3                   	ret
+ 59e:	66 90                	xchg   %ax,%ax
+
+000005a0 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	31 c0                	xor    %eax,%eax
+ 5a3:	89 e5                	mov    %esp,%ebp
+ 5a5:	57                   	push   %edi
+ 5a6:	56                   	push   %esi
+ 5a7:	53                   	push   %ebx
+ 5a8:	83 ec 0c             	sub    $0xc,%esp
+ 5ab:	8b 75 08             	mov    0x8(%ebp),%esi
+ 5ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 5b1:	8b 3e                	mov    (%esi),%edi
+ 5b3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 5b6:	83 f8 02             	cmp    $0x2,%eax
+ 5b9:	74 4d                	je     608 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 5bb:	83 ec 04             	sub    $0x4,%esp
+ 5be:	57                   	push   %edi
+ 5bf:	6a 00                	push   $0x0
+ 5c1:	56                   	push   %esi
+ 5c2:	e8 b5 01 00 00       	call   77c <futex>
+ 5c7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5cc:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 5cf:	83 c4 10             	add    $0x10,%esp
+ 5d2:	85 c0                	test   %eax,%eax
+ 5d4:	74 23                	je     5f9 <cond_wait+0x59>
+ 5d6:	be 02 00 00 00       	mov    $0x2,%esi
+ 5db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5df:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 5e0:	83 ec 04             	sub    $0x4,%esp
+ 5e3:	6a 02                	push   $0x2
+ 5e5:	6a 00                	push   $0x0
+ 5e7:	53                   	push   %ebx
+ 5e8:	e8 8f 01 00 00       	call   77c <futex>
+ 5ed:	89 f0                	mov    %esi,%eax
+ 5ef:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 5f2:	83 c4 10             	add    $0x10,%esp
+ 5f5:	85 c0                	test   %eax,%eax
+ 5f7:	75 e7                	jne    5e0 <cond_wait+0x40>
+}
+ 5f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5fc:	5b                   	pop    %ebx
+ 5fd:	5e                   	pop    %esi
+ 5fe:	5f                   	pop    %edi
+ 5ff:	5d                   	pop    %ebp
+ 600:	c3                   	ret
+ 601:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 608:	83 ec 04             	sub    $0x4,%esp
+ 60b:	6a 01                	push   $0x1
+ 60d:	6a 01                	push   $0x1
+ 60f:	53                   	push   %ebx
+ 610:	e8 67 01 00 00       	call   77c <futex>
+ 615:	83 c4 10             	add    $0x10,%esp
+ 618:	eb a1                	jmp    5bb <cond_wait+0x1b>
+ 61a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000620 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	83 ec 0c             	sub    $0xc,%esp
+ 626:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 629:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 62d:	6a 01                	push   $0x1
+ 62f:	6a 01                	push   $0x1
+ 631:	50                   	push   %eax
+ 632:	e8 45 01 00 00       	call   77c <futex>
+}
+ 637:	83 c4 10             	add    $0x10,%esp
+ 63a:	c9                   	leave
+ 63b:	c3                   	ret
+ 63c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000640 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 640:	55                   	push   %ebp
+ 641:	89 e5                	mov    %esp,%ebp
+ 643:	83 ec 0c             	sub    $0xc,%esp
+ 646:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 649:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 64d:	6a ff                	push   $0xffffffff
+ 64f:	6a 01                	push   $0x1
+ 651:	50                   	push   %eax
+ 652:	e8 25 01 00 00       	call   77c <futex>
+}
+ 657:	83 c4 10             	add    $0x10,%esp
+ 65a:	c9                   	leave
+ 65b:	c3                   	ret
+
+0000065c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 65c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <exit>:
+SYSCALL(exit)
+ 664:	b8 02 00 00 00       	mov    $0x2,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <wait>:
+SYSCALL(wait)
+ 66c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <pipe>:
+SYSCALL(pipe)
+ 674:	b8 04 00 00 00       	mov    $0x4,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <read>:
+SYSCALL(read)
+ 67c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <write>:
+SYSCALL(write)
+ 684:	b8 10 00 00 00       	mov    $0x10,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <close>:
+SYSCALL(close)
+ 68c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <kill>:
+SYSCALL(kill)
+ 694:	b8 06 00 00 00       	mov    $0x6,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <exec>:
+SYSCALL(exec)
+ 69c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <open>:
+SYSCALL(open)
+ 6a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <mknod>:
+SYSCALL(mknod)
+ 6ac:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <unlink>:
+SYSCALL(unlink)
+ 6b4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <fstat>:
+SYSCALL(fstat)
+ 6bc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <link>:
+SYSCALL(link)
+ 6c4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <mkdir>:
+SYSCALL(mkdir)
+ 6cc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <chdir>:
+SYSCALL(chdir)
+ 6d4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <dup>:
+SYSCALL(dup)
+ 6dc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <getpid>:
+SYSCALL(getpid)
+ 6e4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <sbrk>:
+SYSCALL(sbrk)
+ 6ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <sleep>:
+SYSCALL(sleep)
+ 6f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <uptime>:
+SYSCALL(uptime)
+ 6fc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 704:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 70c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <wmap>:
+SYSCALL(wmap)
+ 714:	b8 16 00 00 00       	mov    $0x16,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <wunmap>:
+SYSCALL(wunmap)
+ 71c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <wremap>:
+SYSCALL(wremap)
+ 724:	b8 18 00 00 00       	mov    $0x18,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <wmlock>:
+SYSCALL(wmlock)
+ 72c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <wmunlock>:
+SYSCALL(wmunlock)
+ 734:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <wmapoff>:
+SYSCALL(wmapoff)
+ 73c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 744:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <setpriority>:
+SYSCALL(setpriority)
+ 74c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 754:	b8 20 00 00 00       	mov    $0x20,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <settickets>:
+SYSCALL(settickets)
+ 75c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 764:	b8 22 00 00 00       	mov    $0x22,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <clone>:
+SYSCALL(clone)
+ 76c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 771:	cd 40                	int    $0x40
+ 773:	c3                   	ret
+
+00000774 <join>:
+SYSCALL(join)
+ 774:	b8 24 00 00 00       	mov    $0x24,%eax
+ 779:	cd 40                	int    $0x40
+ 77b:	c3                   	ret
+
+0000077c <futex>:
+SYSCALL(futex)
+ 77c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 781:	cd 40                	int    $0x40
+ 783:	c3                   	ret
+
+00000784 <setaffinity>:
+SYSCALL(setaffinity)
+ 784:	b8 26 00 00 00       	mov    $0x26,%eax
+ 789:	cd 40                	int    $0x40
+ 78b:	c3                   	ret
+
+0000078c <getaffinity>:
+SYSCALL(getaffinity)
+ 78c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 791:	cd 40                	int    $0x40
+ 793:	c3                   	ret
+
+00000794 <bcstat>:
+SYSCALL(bcstat)
+ 794:	b8 29 00 00 00       	mov    $0x29,%eax
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <dropcache>:
+SYSCALL(dropcache)
+ 79c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7a1:	cd 40                	int    $0x40
+ 7a3:	c3                   	ret
+
+000007a4 <setiosched>:
+SYSCALL(setiosched)
+ 7a4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7a9:	cd 40                	int    $0x40
+ 7ab:	c3                   	ret
+
+000007ac <iostat>:
+SYSCALL(iostat)
+ 7ac:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7b1:	cd 40                	int    $0x40
+ 7b3:	c3                   	ret
+
+000007b4 <fsync>:
+SYSCALL(fsync)
+ 7b4:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7b9:	cd 40                	int    $0x40
+ 7bb:	c3                   	ret
+
+000007bc <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 7bc:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 7bd:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 7c2:	cd 40                	int    $0x40
+ 7c4:	ff e1                	jmp    *%ecx
+ 7c6:	66 90                	xchg   %ax,%ax
+ 7c8:	66 90                	xchg   %ax,%ax
+ 7ca:	66 90                	xchg   %ax,%ax
+ 7cc:	66 90                	xchg   %ax,%ax
+ 7ce:	66 90                	xchg   %ax,%ax
+
+000007d0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7d0:	55                   	push   %ebp
+ 7d1:	89 e5                	mov    %esp,%ebp
+ 7d3:	57                   	push   %edi
+ 7d4:	56                   	push   %esi
+ 7d5:	53                   	push   %ebx
+ 7d6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7d8:	89 d1                	mov    %edx,%ecx
+{
+ 7da:	83 ec 3c             	sub    $0x3c,%esp
+ 7dd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7e0:	85 d2                	test   %edx,%edx
+ 7e2:	0f 89 80 00 00 00    	jns    868 <printint+0x98>
+ 7e8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7ec:	74 7a                	je     868 <printint+0x98>
+    x = -xx;
+ 7ee:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7f5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7f8:	31 f6                	xor    %esi,%esi
+ 7fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 800:	89 c8                	mov    %ecx,%eax
+ 802:	31 d2                	xor    %edx,%edx
+ 804:	89 f7                	mov    %esi,%edi
+ 806:	f7 f3                	div    %ebx
+ 808:	8d 76 01             	lea    0x1(%esi),%esi
+ 80b:	0f b6 92 48 0e 00 00 	movzbl 0xe48(%edx),%edx
+ 812:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 816:	89 ca                	mov    %ecx,%edx
+ 818:	89 c1                	mov    %eax,%ecx
+ 81a:	39 da                	cmp    %ebx,%edx
+ 81c:	73 e2                	jae    800 <printint+0x30>
+  if(neg)
+ 81e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 821:	85 c0                	test   %eax,%eax
+ 823:	74 07                	je     82c <printint+0x5c>
+    buf[i++] = '-';
+ 825:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 82a:	89 f7                	mov    %esi,%edi
+ 82c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 82f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 832:	01 df                	add    %ebx,%edi
+ 834:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 838:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 83b:	83 ec 04             	sub    $0x4,%esp
+ 83e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 841:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 844:	6a 01                	push   $0x1
+ 846:	50                   	push   %eax
+ 847:	56                   	push   %esi
+ 848:	e8 37 fe ff ff       	call   684 <write>
+  while(--i >= 0)
+ 84d:	89 f8                	mov    %edi,%eax
+ 84f:	83 c4 10             	add    $0x10,%esp
+ 852:	83 ef 01             	sub    $0x1,%edi
+ 855:	39 d8                	cmp    %ebx,%eax
+ 857:	75 df                	jne    838 <printint+0x68>
+}
+ 859:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 85c:	5b                   	pop    %ebx
+ 85d:	5e                   	pop    %esi
+ 85e:	5f                   	pop    %edi
+ 85f:	5d                   	pop    %ebp
+ 860:	c3                   	ret
+ 861:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 868:	31 c0                	xor    %eax,%eax
+ 86a:	eb 89                	jmp    7f5 <printint+0x25>
+ 86c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000870 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	53                   	push   %ebx
+ 876:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 879:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 87c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 87f:	0f b6 1e             	movzbl (%esi),%ebx
+ 882:	83 c6 01             	add    $0x1,%esi
+ 885:	84 db                	test   %bl,%bl
+ 887:	74 67                	je     8f0 <printf+0x80>
+ 889:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 88c:	31 d2                	xor    %edx,%edx
+ 88e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 891:	eb 34                	jmp    8c7 <printf+0x57>
+ 893:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 897:	90                   	nop
+ 898:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 89b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8a0:	83 f8 25             	cmp    $0x25,%eax
+ 8a3:	74 18                	je     8bd <printf+0x4d>
+  write(fd, &c, 1);
+ 8a5:	83 ec 04             	sub    $0x4,%esp
+ 8a8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8ab:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8ae:	6a 01                	push   $0x1
+ 8b0:	50                   	push   %eax
+ 8b1:	57                   	push   %edi
+ 8b2:	e8 cd fd ff ff       	call   684 <write>
+ 8b7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8ba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8bd:	0f b6 1e             	movzbl (%esi),%ebx
+ 8c0:	83 c6 01             	add    $0x1,%esi
+ 8c3:	84 db                	test   %bl,%bl
+ 8c5:	74 29                	je     8f0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8c7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8ca:	85 d2                	test   %edx,%edx
+ 8cc:	74 ca                	je     898 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8ce:	83 fa 25             	cmp    $0x25,%edx
+ 8d1:	75 ea                	jne    8bd <printf+0x4d>
+      if(c == 'd'){
+ 8d3:	83 f8 25             	cmp    $0x25,%eax
+ 8d6:	0f 84 24 01 00 00    	je     a00 <printf+0x190>
+ 8dc:	83 e8 63             	sub    $0x63,%eax
+ 8df:	83 f8 15             	cmp    $0x15,%eax
+ 8e2:	77 1c                	ja     900 <printf+0x90>
+ 8e4:	ff 24 85 f0 0d 00 00 	jmp    *0xdf0(,%eax,4)
+ 8eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ef:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8f3:	5b                   	pop    %ebx
+ 8f4:	5e                   	pop    %esi
+ 8f5:	5f                   	pop    %edi
+ 8f6:	5d                   	pop    %ebp
+ 8f7:	c3                   	ret
+ 8f8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+  write(fd, &c, 1);
+ 900:	83 ec 04             	sub    $0x4,%esp
+ 903:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 906:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 90a:	6a 01                	push   $0x1
+ 90c:	52                   	push   %edx
+ 90d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 910:	57                   	push   %edi
+ 911:	e8 6e fd ff ff       	call   684 <write>
+ 916:	83 c4 0c             	add    $0xc,%esp
+ 919:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 91c:	6a 01                	push   $0x1
+ 91e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 921:	52                   	push   %edx
+ 922:	57                   	push   %edi
+ 923:	e8 5c fd ff ff       	call   684 <write>
+        putc(fd, c);
+ 928:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 92b:	31 d2                	xor    %edx,%edx
+ 92d:	eb 8e                	jmp    8bd <printf+0x4d>
+ 92f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 930:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 933:	83 ec 0c             	sub    $0xc,%esp
+ 936:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 93b:	8b 13                	mov    (%ebx),%edx
+ 93d:	6a 00                	push   $0x0
+ 93f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 941:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 944:	e8 87 fe ff ff       	call   7d0 <printint>
+        ap++;
+ 949:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 94c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 94f:	31 d2                	xor    %edx,%edx
+ 951:	e9 67 ff ff ff       	jmp    8bd <printf+0x4d>
+ 956:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 95d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 960:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 963:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 965:	83 c0 04             	add    $0x4,%eax
+ 968:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 96b:	85 db                	test   %ebx,%ebx
+ 96d:	0f 84 9d 00 00 00    	je     a10 <printf+0x1a0>
+        while(*s != 0){
+ 973:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 976:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 978:	84 c0                	test   %al,%al
+ 97a:	0f 84 3d ff ff ff    	je     8bd <printf+0x4d>
+ 980:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 983:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 986:	89 de                	mov    %ebx,%esi
+ 988:	89 d3                	mov    %edx,%ebx
+ 98a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 990:	83 ec 04             	sub    $0x4,%esp
+ 993:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 996:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 999:	6a 01                	push   $0x1
+ 99b:	53                   	push   %ebx
+ 99c:	57                   	push   %edi
+ 99d:	e8 e2 fc ff ff       	call   684 <write>
+        while(*s != 0){
+ 9a2:	0f b6 06             	movzbl (%esi),%eax
+ 9a5:	83 c4 10             	add    $0x10,%esp
+ 9a8:	84 c0                	test   %al,%al
+ 9aa:	75 e4                	jne    990 <printf+0x120>
+      state = 0;
+ 9ac:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9af:	31 d2                	xor    %edx,%edx
+ 9b1:	e9 07 ff ff ff       	jmp    8bd <printf+0x4d>
+ 9b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9c0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9c3:	83 ec 0c             	sub    $0xc,%esp
+ 9c6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9cb:	8b 13                	mov    (%ebx),%edx
+ 9cd:	6a 01                	push   $0x1
+ 9cf:	e9 6b ff ff ff       	jmp    93f <printf+0xcf>
+ 9d4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9d8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9db:	83 ec 04             	sub    $0x4,%esp
+ 9de:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9e1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9e3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9e6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9e9:	6a 01                	push   $0x1
+ 9eb:	52                   	push   %edx
+ 9ec:	57                   	push   %edi
+ 9ed:	e8 92 fc ff ff       	call   684 <write>
+        ap++;
+ 9f2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9f5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9f8:	31 d2                	xor    %edx,%edx
+ 9fa:	e9 be fe ff ff       	jmp    8bd <printf+0x4d>
+ 9ff:	90                   	nop
+  write(fd, &c, 1);
+ a00:	83 ec 04             	sub    $0x4,%esp
+ a03:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a06:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a09:	6a 01                	push   $0x1
+ a0b:	e9 11 ff ff ff       	jmp    921 <printf+0xb1>
+ a10:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a15:	bb e6 0d 00 00       	mov    $0xde6,%ebx
+ a1a:	e9 61 ff ff ff       	jmp    980 <printf+0x110>
+ a1f:	90                   	nop
+
+00000a20 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a20:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a21:	a1 34 13 00 00       	mov    0x1334,%eax
+{
+ a26:	89 e5                	mov    %esp,%ebp
+ a28:	57                   	push   %edi
+ a29:	56                   	push   %esi
+ a2a:	53                   	push   %ebx
+ a2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a2e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a38:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a3a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a3c:	39 ca                	cmp    %ecx,%edx
+ a3e:	73 30                	jae    a70 <free+0x50>
+ a40:	39 c1                	cmp    %eax,%ecx
+ a42:	72 04                	jb     a48 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a44:	39 c2                	cmp    %eax,%edx
+ a46:	72 f0                	jb     a38 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a48:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a4b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a4e:	39 f8                	cmp    %edi,%eax
+ a50:	74 2e                	je     a80 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a52:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a55:	8b 42 04             	mov    0x4(%edx),%eax
+ a58:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a5b:	39 f1                	cmp    %esi,%ecx
+ a5d:	74 38                	je     a97 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a5f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a61:	5b                   	pop    %ebx
+  freep = p;
+ a62:	89 15 34 13 00 00    	mov    %edx,0x1334
+}
+ a68:	5e                   	pop    %esi
+ a69:	5f                   	pop    %edi
+ a6a:	5d                   	pop    %ebp
+ a6b:	c3                   	ret
+ a6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a70:	39 c1                	cmp    %eax,%ecx
+ a72:	72 d0                	jb     a44 <free+0x24>
+ a74:	eb c2                	jmp    a38 <free+0x18>
+ a76:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a7d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a80:	03 70 04             	add    0x4(%eax),%esi
+ a83:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a86:	8b 02                	mov    (%edx),%eax
+ a88:	8b 00                	mov    (%eax),%eax
+ a8a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a8d:	8b 42 04             	mov    0x4(%edx),%eax
+ a90:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a93:	39 f1                	cmp    %esi,%ecx
+ a95:	75 c8                	jne    a5f <free+0x3f>
+    p->s.size += bp->s.size;
+ a97:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a9a:	89 15 34 13 00 00    	mov    %edx,0x1334
+    p->s.size += bp->s.size;
+ aa0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ aa3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ aa6:	89 0a                	mov    %ecx,(%edx)
+}
+ aa8:	5b                   	pop    %ebx
+ aa9:	5e                   	pop    %esi
+ aaa:	5f                   	pop    %edi
+ aab:	5d                   	pop    %ebp
+ aac:	c3                   	ret
+ aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ab0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	57                   	push   %edi
+ ab4:	56                   	push   %esi
+ ab5:	53                   	push   %ebx
+ ab6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ abc:	8b 15 34 13 00 00    	mov    0x1334,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ac2:	8d 78 07             	lea    0x7(%eax),%edi
+ ac5:	c1 ef 03             	shr    $0x3,%edi
+ ac8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ acb:	85 d2                	test   %edx,%edx
+ acd:	0f 84 8d 00 00 00    	je     b60 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ad3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ad5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ad8:	39 f9                	cmp    %edi,%ecx
+ ada:	73 64                	jae    b40 <malloc+0x90>
+  if(nu < 4096)
+ adc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ae1:	39 df                	cmp    %ebx,%edi
+ ae3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ae6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ aed:	eb 0a                	jmp    af9 <malloc+0x49>
+ aef:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ af0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ af2:	8b 48 04             	mov    0x4(%eax),%ecx
+ af5:	39 f9                	cmp    %edi,%ecx
+ af7:	73 47                	jae    b40 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ af9:	89 c2                	mov    %eax,%edx
+ afb:	39 05 34 13 00 00    	cmp    %eax,0x1334
+ b01:	75 ed                	jne    af0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b03:	83 ec 0c             	sub    $0xc,%esp
+ b06:	56                   	push   %esi
+ b07:	e8 e0 fb ff ff       	call   6ec <sbrk>
+  if(p == (char*)-1)
+ b0c:	83 c4 10             	add    $0x10,%esp
+ b0f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b12:	74 1c                	je     b30 <malloc+0x80>
+  hp->s.size = nu;
+ b14:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b17:	83 ec 0c             	sub    $0xc,%esp
+ b1a:	83 c0 08             	add    $0x8,%eax
+ b1d:	50                   	push   %eax
+ b1e:	e8 fd fe ff ff       	call   a20 <free>
+  return freep;
+ b23:	8b 15 34 13 00 00    	mov    0x1334,%edx
+      if((p = morecore(nunits)) == 0)
+ b29:	83 c4 10             	add    $0x10,%esp
+ b2c:	85 d2                	test   %edx,%edx
+ b2e:	75 c0                	jne    af0 <malloc+0x40>
+        return 0;
+  }
+}
+ b30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b33:	31 c0                	xor    %eax,%eax
+}
+ b35:	5b                   	pop    %ebx
+ b36:	5e                   	pop    %esi
+ b37:	5f                   	pop    %edi
+ b38:	5d                   	pop    %ebp
+ b39:	c3                   	ret
+ b3a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b40:	39 cf                	cmp    %ecx,%edi
+ b42:	74 4c                	je     b90 <malloc+0xe0>
+        p->s.size -= nunits;
+ b44:	29 f9                	sub    %edi,%ecx
+ b46:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b49:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b4c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b4f:	89 15 34 13 00 00    	mov    %edx,0x1334
+}
+ b55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b58:	83 c0 08             	add    $0x8,%eax
+}
+ b5b:	5b                   	pop    %ebx
+ b5c:	5e                   	pop    %esi
+ b5d:	5f                   	pop    %edi
+ b5e:	5d                   	pop    %ebp
+ b5f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b60:	c7 05 34 13 00 00 38 	movl   $0x1338,0x1334
+ b67:	13 00 00 
+    base.s.size = 0;
+ b6a:	b8 38 13 00 00       	mov    $0x1338,%eax
+    base.s.ptr = freep = prevp = &base;
+ b6f:	c7 05 38 13 00 00 38 	movl   $0x1338,0x1338
+ b76:	13 00 00 
+    base.s.size = 0;
+ b79:	c7 05 3c 13 00 00 00 	movl   $0x0,0x133c
+ b80:	00 00 00 
+    if(p->s.size >= nunits){
+ b83:	e9 54 ff ff ff       	jmp    adc <malloc+0x2c>
+ b88:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b8f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b90:	8b 08                	mov    (%eax),%ecx
+ b92:	89 0a                	mov    %ecx,(%edx)
+ b94:	eb b9                	jmp    b4f <malloc+0x9f>
+ b96:	66 90                	xchg   %ax,%ax
+ b98:	66 90                	xchg   %ax,%ax
+ b9a:	66 90                	xchg   %ax,%ax
+ b9c:	66 90                	xchg   %ax,%ax
+ b9e:	66 90                	xchg   %ax,%ax
+
+00000ba0 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ ba6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba9:	c1 e0 04             	shl    $0x4,%eax
+ bac:	ff b0 6c 13 00 00    	push   0x136c(%eax)
+ bb2:	05 60 13 00 00       	add    $0x1360,%eax
+ bb7:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ bba:	e8 a5 fa ff ff       	call   664 <exit>
+ bbf:	90                   	nop
+
+00000bc0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ bc0:	55                   	push   %ebp
+ bc1:	89 e5                	mov    %esp,%ebp
+ bc3:	57                   	push   %edi
+ bc4:	56                   	push   %esi
+ bc5:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ bc6:	31 db                	xor    %ebx,%ebx
+{
+ bc8:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ bcb:	68 40 13 00 00       	push   $0x1340
+ bd0:	e8 eb f8 ff ff       	call   4c0 <lock_acquire>
+ bd5:	83 c4 10             	add    $0x10,%esp
+ bd8:	eb 12                	jmp    bec <thread_create+0x2c>
+ bda:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ be0:	83 c3 01             	add    $0x1,%ebx
+ be3:	83 fb 40             	cmp    $0x40,%ebx
+ be6:	0f 84 c4 00 00 00    	je     cb0 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ bec:	89 de                	mov    %ebx,%esi
+ bee:	c1 e6 04             	shl    $0x4,%esi
+ bf1:	8b 96 60 13 00 00    	mov    0x1360(%esi),%edx
+ bf7:	85 d2                	test   %edx,%edx
+ bf9:	75 e5                	jne    be0 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ bfb:	83 ec 0c             	sub    $0xc,%esp
+ bfe:	68 00 20 00 00       	push   $0x2000
+ c03:	e8 a8 fe ff ff       	call   ab0 <malloc>
+ c08:	83 c4 10             	add    $0x10,%esp
+ c0b:	85 c0                	test   %eax,%eax
+ c0d:	0f 84 9d 00 00 00    	je     cb0 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ c13:	89 86 64 13 00 00    	mov    %eax,0x1364(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ c19:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ c1e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ c21:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ c26:	89 86 60 13 00 00    	mov    %eax,0x1360(%esi)
+  threads[i].fn = fn;
+ c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c2f:	89 86 68 13 00 00    	mov    %eax,0x1368(%esi)
+  threads[i].arg = arg;
+ c35:	8b 45 0c             	mov    0xc(%ebp),%eax
+ c38:	89 86 6c 13 00 00    	mov    %eax,0x136c(%esi)
+  lock_release(&threadslock);
+ c3e:	68 40 13 00 00       	push   $0x1340
+ c43:	e8 98 f8 ff ff       	call   4e0 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ c48:	83 c4 0c             	add    $0xc,%esp
+ c4b:	ff b6 60 13 00 00    	push   0x1360(%esi)
+ c51:	53                   	push   %ebx
+ c52:	68 a0 0b 00 00       	push   $0xba0
+ c57:	e8 10 fb ff ff       	call   76c <clone>
+ c5c:	83 c4 10             	add    $0x10,%esp
+ c5f:	85 c0                	test   %eax,%eax
+ c61:	78 0d                	js     c70 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ c63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c66:	5b                   	pop    %ebx
+ c67:	5e                   	pop    %esi
+ c68:	5f                   	pop    %edi
+ c69:	5d                   	pop    %ebp
+ c6a:	c3                   	ret
+ c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c6f:	90                   	nop
+    lock_acquire(&threadslock);
+ c70:	83 ec 0c             	sub    $0xc,%esp
+ c73:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ c76:	68 40 13 00 00       	push   $0x1340
+ c7b:	e8 40 f8 ff ff       	call   4c0 <lock_acquire>
+    free(threads[i].block);
+ c80:	58                   	pop    %eax
+ c81:	ff b6 64 13 00 00    	push   0x1364(%esi)
+ c87:	e8 94 fd ff ff       	call   a20 <free>
+    threads[i].stack = 0;
+ c8c:	c7 86 60 13 00 00 00 	movl   $0x0,0x1360(%esi)
+ c93:	00 00 00 
+    lock_release(&threadslock);
+ c96:	c7 04 24 40 13 00 00 	movl   $0x1340,(%esp)
+ c9d:	e8 3e f8 ff ff       	call   4e0 <lock_release>
+ ca2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ca5:	83 c4 10             	add    $0x10,%esp
+}
+ ca8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cab:	5b                   	pop    %ebx
+ cac:	5e                   	pop    %esi
+ cad:	5f                   	pop    %edi
+ cae:	5d                   	pop    %ebp
+ caf:	c3                   	ret
+    lock_release(&threadslock);
+ cb0:	83 ec 0c             	sub    $0xc,%esp
+ cb3:	68 40 13 00 00       	push   $0x1340
+ cb8:	e8 23 f8 ff ff       	call   4e0 <lock_release>
+    return -1;
+ cbd:	83 c4 10             	add    $0x10,%esp
+ cc0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ cc5:	eb 9c                	jmp    c63 <thread_create+0xa3>
+ cc7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cce:	66 90                	xchg   %ax,%ax
+
+00000cd0 <thread_join>:
+
+int
+thread_join(void)
+{
+ cd0:	55                   	push   %ebp
+ cd1:	89 e5                	mov    %esp,%ebp
+ cd3:	56                   	push   %esi
+ cd4:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ cd5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ cd8:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ cdb:	50                   	push   %eax
+ cdc:	e8 93 fa ff ff       	call   774 <join>
+ ce1:	83 c4 10             	add    $0x10,%esp
+ ce4:	85 c0                	test   %eax,%eax
+ ce6:	78 69                	js     d51 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ ce8:	83 ec 0c             	sub    $0xc,%esp
+ ceb:	89 c6                	mov    %eax,%esi
+ ced:	68 40 13 00 00       	push   $0x1340
+ cf2:	e8 c9 f7 ff ff       	call   4c0 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ cf7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ cfa:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ cfd:	31 c0                	xor    %eax,%eax
+ cff:	eb 0f                	jmp    d10 <thread_join+0x40>
+ d01:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d08:	83 c0 01             	add    $0x1,%eax
+ d0b:	83 f8 40             	cmp    $0x40,%eax
+ d0e:	74 28                	je     d38 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ d10:	89 c3                	mov    %eax,%ebx
+ d12:	c1 e3 04             	shl    $0x4,%ebx
+ d15:	39 93 60 13 00 00    	cmp    %edx,0x1360(%ebx)
+ d1b:	75 eb                	jne    d08 <thread_join+0x38>
+      free(threads[i].block);
+ d1d:	83 ec 0c             	sub    $0xc,%esp
+ d20:	ff b3 64 13 00 00    	push   0x1364(%ebx)
+ d26:	e8 f5 fc ff ff       	call   a20 <free>
+      threads[i].stack = 0;
+      break;
+ d2b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ d2e:	c7 83 60 13 00 00 00 	movl   $0x0,0x1360(%ebx)
+ d35:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ d38:	83 ec 0c             	sub    $0xc,%esp
+ d3b:	68 40 13 00 00       	push   $0x1340
+ d40:	e8 9b f7 ff ff       	call   4e0 <lock_release>
+  return pid;
+ d45:	83 c4 10             	add    $0x10,%esp
+}
+ d48:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d4b:	89 f0                	mov    %esi,%eax
+ d4d:	5b                   	pop    %ebx
+ d4e:	5e                   	pop    %esi
+ d4f:	5d                   	pop    %ebp
+ d50:	c3                   	ret
+    return -1;
+ d51:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ d56:	eb f0                	jmp    d48 <thread_join+0x78>
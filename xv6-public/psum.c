@@ -0,0 +1,87 @@
+// Parallel-sum benchmark for clone/join threads.
+// Sums an array with 1, 2, 4, ... threads, up to the number
+// given, and prints the time each run took.
+//
+// usage: psum [maxthreads [nints]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define ROUNDS 20  // passes over the array per run
+
+int *data;
+int n, nthreads;
+uint total;
+lock_t sumlock;
+
+void
+worker(void *arg)
+{
+  int id, i, r, lo, hi;
+  uint s;
+
+  id = (int)arg;
+  lo = n / nthreads * id;
+  hi = id == nthreads-1 ? n : lo + n / nthreads;
+  s = 0;
+  for(r = 0; r < ROUNDS; r++)
+    for(i = lo; i < hi; i++)
+      s += data[i];
+
+  lock_acquire(&sumlock);
+  total += s;
+  lock_release(&sumlock);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int maxthreads, i, start, elapsed, base;
+  uint expect;
+
+  maxthreads = 4;
+  n = 1 << 18;
+  if(argc > 1)
+    maxthreads = atoi(argv[1]);
+  if(argc > 2)
+    n = atoi(argv[2]);
+  if(maxthreads < 1 || n < 1){
+    printf(2, "usage: psum [maxthreads [nints]]\n");
+    exit();
+  }
+  if((data = malloc(n * sizeof(int))) == 0){
+    printf(2, "psum: out of memory\n");
+    exit();
+  }
+  expect = 0;
+  for(i = 0; i < n; i++){
+    data[i] = i & 0xff;
+    expect += data[i];
+  }
+  expect *= ROUNDS;
+  lock_init(&sumlock);
+
+  base = 0;
+  for(nthreads = 1; nthreads <= maxthreads; nthreads *= 2){
+    total = 0;
+    start = uptime();
+    for(i = 0; i < nthreads; i++){
+      if(thread_create(worker, (void*)i) < 0){
+        printf(2, "psum: thread_create failed\n");
+        exit();
+      }
+    }
+    for(i = 0; i < nthreads; i++)
+      thread_join();
+    elapsed = uptime() - start;
+    if(elapsed == 0)
+      elapsed = 1;
+    if(base == 0)
+      base = elapsed;
+    printf(1, "psum: %d threads: %d ticks, speedup x%d.%d%s\n",
+           nthreads, elapsed, base / elapsed, (base * 10 / elapsed) % 10,
+           total == expect ? "" : " WRONG SUM");
+  }
+  exit();
+}
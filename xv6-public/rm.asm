@@ -0,0 +1,1814 @@
+
+_rm:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 01 00 00 00       	mov    $0x1,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1c:	8b 31                	mov    (%ecx),%esi
+  1e:	83 c3 04             	add    $0x4,%ebx
+  int i;
+
+  if(argc < 2){
+  21:	83 fe 01             	cmp    $0x1,%esi
+  24:	7f 14                	jg     3a <main+0x3a>
+  26:	eb 3a                	jmp    62 <main+0x62>
+  28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+    printf(2, "Usage: rm files...\n");
+    exit();
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	83 c7 01             	add    $0x1,%edi
+  33:	83 c3 04             	add    $0x4,%ebx
+  36:	39 fe                	cmp    %edi,%esi
+  38:	74 23                	je     5d <main+0x5d>
+    if(unlink(argv[i]) < 0){
+  3a:	83 ec 0c             	sub    $0xc,%esp
+  3d:	ff 33                	push   (%ebx)
+  3f:	e8 80 04 00 00       	call   4c4 <unlink>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	85 c0                	test   %eax,%eax
+  49:	79 e5                	jns    30 <main+0x30>
+      printf(2, "rm: %s failed to delete\n", argv[i]);
+  4b:	50                   	push   %eax
+  4c:	ff 33                	push   (%ebx)
+  4e:	68 7c 0b 00 00       	push   $0xb7c
+  53:	6a 02                	push   $0x2
+  55:	e8 26 06 00 00       	call   680 <printf>
+      break;
+  5a:	83 c4 10             	add    $0x10,%esp
+    }
+  }
+
+  exit();
+  5d:	e8 12 04 00 00       	call   474 <exit>
+    printf(2, "Usage: rm files...\n");
+  62:	52                   	push   %edx
+  63:	52                   	push   %edx
+  64:	68 68 0b 00 00       	push   $0xb68
+  69:	6a 02                	push   $0x2
+  6b:	e8 10 06 00 00       	call   680 <printf>
+    exit();
+  70:	e8 ff 03 00 00       	call   474 <exit>
+  75:	66 90                	xchg   %ax,%ax
+  77:	66 90                	xchg   %ax,%ax
+  79:	66 90                	xchg   %ax,%ax
+  7b:	66 90                	xchg   %ax,%ax
+  7d:	66 90                	xchg   %ax,%ax
+  7f:	90                   	nop
+
+00000080 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  80:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  81:	31 c0                	xor    %eax,%eax
+{
+  83:	89 e5                	mov    %esp,%ebp
+  85:	53                   	push   %ebx
+  86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  97:	83 c0 01             	add    $0x1,%eax
+  9a:	84 d2                	test   %dl,%dl
+  9c:	75 f2                	jne    90 <strcpy+0x10>
+    ;
+  return os;
+}
+  9e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  a1:	89 c8                	mov    %ecx,%eax
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+  a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000000b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  b0:	55                   	push   %ebp
+  b1:	89 e5                	mov    %esp,%ebp
+  b3:	53                   	push   %ebx
+  b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  ba:	0f b6 02             	movzbl (%edx),%eax
+  bd:	84 c0                	test   %al,%al
+  bf:	75 17                	jne    d8 <strcmp+0x28>
+  c1:	eb 3a                	jmp    fd <strcmp+0x4d>
+  c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  c7:	90                   	nop
+  c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  cc:	83 c2 01             	add    $0x1,%edx
+  cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  d2:	84 c0                	test   %al,%al
+  d4:	74 1a                	je     f0 <strcmp+0x40>
+    p++, q++;
+  d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  d8:	0f b6 19             	movzbl (%ecx),%ebx
+  db:	38 c3                	cmp    %al,%bl
+  dd:	74 e9                	je     c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  df:	29 d8                	sub    %ebx,%eax
+}
+  e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  e4:	c9                   	leave
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  f4:	31 c0                	xor    %eax,%eax
+  f6:	29 d8                	sub    %ebx,%eax
+}
+  f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  fb:	c9                   	leave
+  fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 100:	31 c0                	xor    %eax,%eax
+ 102:	eb db                	jmp    df <strcmp+0x2f>
+ 104:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 10b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 10f:	90                   	nop
+
+00000110 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 116:	80 3a 00             	cmpb   $0x0,(%edx)
+ 119:	74 15                	je     130 <strlen+0x20>
+ 11b:	31 c0                	xor    %eax,%eax
+ 11d:	8d 76 00             	lea    0x0(%esi),%esi
+ 120:	83 c0 01             	add    $0x1,%eax
+ 123:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 127:	89 c1                	mov    %eax,%ecx
+ 129:	75 f5                	jne    120 <strlen+0x10>
+    ;
+  return n;
+}
+ 12b:	89 c8                	mov    %ecx,%eax
+ 12d:	5d                   	pop    %ebp
+ 12e:	c3                   	ret
+ 12f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 130:	31 c9                	xor    %ecx,%ecx
+}
+ 132:	5d                   	pop    %ebp
+ 133:	89 c8                	mov    %ecx,%eax
+ 135:	c3                   	ret
+ 136:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000140 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 140:	55                   	push   %ebp
+ 141:	89 e5                	mov    %esp,%ebp
+ 143:	57                   	push   %edi
+ 144:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 147:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	89 d7                	mov    %edx,%edi
+ 14f:	fc                   	cld
+ 150:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 152:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 155:	89 d0                	mov    %edx,%eax
+ 157:	c9                   	leave
+ 158:	c3                   	ret
+ 159:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000160 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	8b 45 08             	mov    0x8(%ebp),%eax
+ 166:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 16a:	0f b6 10             	movzbl (%eax),%edx
+ 16d:	84 d2                	test   %dl,%dl
+ 16f:	75 12                	jne    183 <strchr+0x23>
+ 171:	eb 1d                	jmp    190 <strchr+0x30>
+ 173:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 177:	90                   	nop
+ 178:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 17c:	83 c0 01             	add    $0x1,%eax
+ 17f:	84 d2                	test   %dl,%dl
+ 181:	74 0d                	je     190 <strchr+0x30>
+    if(*s == c)
+ 183:	38 d1                	cmp    %dl,%cl
+ 185:	75 f1                	jne    178 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 187:	5d                   	pop    %ebp
+ 188:	c3                   	ret
+ 189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 190:	31 c0                	xor    %eax,%eax
+}
+ 192:	5d                   	pop    %ebp
+ 193:	c3                   	ret
+ 194:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 19b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 19f:	90                   	nop
+
+000001a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 1a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 1a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 1a9:	31 db                	xor    %ebx,%ebx
+{
+ 1ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 1ae:	eb 27                	jmp    1d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 1b0:	83 ec 04             	sub    $0x4,%esp
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	56                   	push   %esi
+ 1b6:	6a 00                	push   $0x0
+ 1b8:	e8 cf 02 00 00       	call   48c <read>
+    if(cc < 1)
+ 1bd:	83 c4 10             	add    $0x10,%esp
+ 1c0:	85 c0                	test   %eax,%eax
+ 1c2:	7e 1d                	jle    1e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 1c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 1c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 1cf:	3c 0a                	cmp    $0xa,%al
+ 1d1:	74 10                	je     1e3 <gets+0x43>
+ 1d3:	3c 0d                	cmp    $0xd,%al
+ 1d5:	74 0c                	je     1e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 1d7:	89 df                	mov    %ebx,%edi
+ 1d9:	83 c3 01             	add    $0x1,%ebx
+ 1dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 1df:	7c cf                	jl     1b0 <gets+0x10>
+ 1e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 1e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 1ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1ed:	5b                   	pop    %ebx
+ 1ee:	5e                   	pop    %esi
+ 1ef:	5f                   	pop    %edi
+ 1f0:	5d                   	pop    %ebp
+ 1f1:	c3                   	ret
+ 1f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000200 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	56                   	push   %esi
+ 204:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 205:	83 ec 08             	sub    $0x8,%esp
+ 208:	6a 00                	push   $0x0
+ 20a:	ff 75 08             	push   0x8(%ebp)
+ 20d:	e8 a2 02 00 00       	call   4b4 <open>
+  if(fd < 0)
+ 212:	83 c4 10             	add    $0x10,%esp
+ 215:	85 c0                	test   %eax,%eax
+ 217:	78 27                	js     240 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	ff 75 0c             	push   0xc(%ebp)
+ 21f:	89 c3                	mov    %eax,%ebx
+ 221:	50                   	push   %eax
+ 222:	e8 a5 02 00 00       	call   4cc <fstat>
+  close(fd);
+ 227:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 22a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 22c:	e8 6b 02 00 00       	call   49c <close>
+  return r;
+ 231:	83 c4 10             	add    $0x10,%esp
+}
+ 234:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 237:	89 f0                	mov    %esi,%eax
+ 239:	5b                   	pop    %ebx
+ 23a:	5e                   	pop    %esi
+ 23b:	5d                   	pop    %ebp
+ 23c:	c3                   	ret
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 245:	eb ed                	jmp    234 <stat+0x34>
+ 247:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 250:	55                   	push   %ebp
+ 251:	89 e5                	mov    %esp,%ebp
+ 253:	53                   	push   %ebx
+ 254:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 257:	0f be 02             	movsbl (%edx),%eax
+ 25a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 25d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 260:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 265:	77 1e                	ja     285 <atoi+0x35>
+ 267:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 26e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 270:	83 c2 01             	add    $0x1,%edx
+ 273:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 276:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 27a:	0f be 02             	movsbl (%edx),%eax
+ 27d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 280:	80 fb 09             	cmp    $0x9,%bl
+ 283:	76 eb                	jbe    270 <atoi+0x20>
+  return n;
+}
+ 285:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 288:	89 c8                	mov    %ecx,%eax
+ 28a:	c9                   	leave
+ 28b:	c3                   	ret
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000290 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	8b 45 10             	mov    0x10(%ebp),%eax
+ 298:	8b 55 08             	mov    0x8(%ebp),%edx
+ 29b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 29e:	85 c0                	test   %eax,%eax
+ 2a0:	7e 13                	jle    2b5 <memmove+0x25>
+ 2a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 2a4:	89 d7                	mov    %edx,%edi
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 2b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 2b1:	39 f8                	cmp    %edi,%eax
+ 2b3:	75 fb                	jne    2b0 <memmove+0x20>
+  return vdst;
+}
+ 2b5:	5e                   	pop    %esi
+ 2b6:	89 d0                	mov    %edx,%eax
+ 2b8:	5f                   	pop    %edi
+ 2b9:	5d                   	pop    %ebp
+ 2ba:	c3                   	ret
+ 2bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2bf:	90                   	nop
+
+000002c0 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2cc:	5d                   	pop    %ebp
+ 2cd:	c3                   	ret
+ 2ce:	66 90                	xchg   %ax,%ax
+
+000002d0 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 2d0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 2d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 2d6:	89 e5                	mov    %esp,%ebp
+ 2d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+ 2e0:	89 c8                	mov    %ecx,%eax
+ 2e2:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 2e5:	85 c0                	test   %eax,%eax
+ 2e7:	75 f7                	jne    2e0 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 2e9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 2ee:	5d                   	pop    %ebp
+ 2ef:	c3                   	ret
+
+000002f0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	31 c0                	xor    %eax,%eax
+ 2f3:	89 e5                	mov    %esp,%ebp
+ 2f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 2f8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 2fd:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 300:	5d                   	pop    %ebp
+ 301:	c3                   	ret
+ 302:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 309:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000310 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 313:	8b 45 08             	mov    0x8(%ebp),%eax
+ 316:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 31c:	5d                   	pop    %ebp
+ 31d:	c3                   	ret
+ 31e:	66 90                	xchg   %ax,%ax
+
+00000320 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 320:	55                   	push   %ebp
+ 321:	b8 01 00 00 00       	mov    $0x1,%eax
+ 326:	89 e5                	mov    %esp,%ebp
+ 328:	56                   	push   %esi
+ 329:	53                   	push   %ebx
+ 32a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 32d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 330:	85 c0                	test   %eax,%eax
+ 332:	74 2d                	je     361 <mutex_lock+0x41>
+ 334:	b8 02 00 00 00       	mov    $0x2,%eax
+ 339:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 33c:	85 c0                	test   %eax,%eax
+ 33e:	74 21                	je     361 <mutex_lock+0x41>
+ 340:	be 02 00 00 00       	mov    $0x2,%esi
+ 345:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 348:	83 ec 04             	sub    $0x4,%esp
+ 34b:	6a 02                	push   $0x2
+ 34d:	6a 00                	push   $0x0
+ 34f:	53                   	push   %ebx
+ 350:	e8 37 02 00 00       	call   58c <futex>
+ 355:	89 f0                	mov    %esi,%eax
+ 357:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 35a:	83 c4 10             	add    $0x10,%esp
+ 35d:	85 c0                	test   %eax,%eax
+ 35f:	75 e7                	jne    348 <mutex_lock+0x28>
+}
+ 361:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 364:	5b                   	pop    %ebx
+ 365:	5e                   	pop    %esi
+ 366:	5d                   	pop    %ebp
+ 367:	c3                   	ret
+ 368:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 370:	55                   	push   %ebp
+ 371:	31 c0                	xor    %eax,%eax
+ 373:	89 e5                	mov    %esp,%ebp
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	8b 55 08             	mov    0x8(%ebp),%edx
+ 37b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 37e:	83 f8 02             	cmp    $0x2,%eax
+ 381:	74 05                	je     388 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 383:	c9                   	leave
+ 384:	c3                   	ret
+ 385:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 388:	83 ec 04             	sub    $0x4,%esp
+ 38b:	6a 01                	push   $0x1
+ 38d:	6a 01                	push   $0x1
+ 38f:	52                   	push   %edx
+ 390:	e8 f7 01 00 00       	call   58c <futex>
+ 395:	83 c4 10             	add    $0x10,%esp
+}
+ 398:	c9                   	leave
+ 399:	c3                   	ret
+ 39a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003a0 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3ac:	5d                   	pop    %ebp
+ 3ad:	c3                   	ret
+ 3ae:	66 90                	xchg   %ax,%ax
+
+000003b0 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	31 c0                	xor    %eax,%eax
+ 3b3:	89 e5                	mov    %esp,%ebp
+ 3b5:	57                   	push   %edi
+ 3b6:	56                   	push   %esi
+ 3b7:	53                   	push   %ebx
+ 3b8:	83 ec 0c             	sub    $0xc,%esp
+ 3bb:	8b 75 08             	mov    0x8(%ebp),%esi
+ 3be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 3c1:	8b 3e                	mov    (%esi),%edi
+ 3c3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 3c6:	83 f8 02             	cmp    $0x2,%eax
+ 3c9:	74 4d                	je     418 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 3cb:	83 ec 04             	sub    $0x4,%esp
+ 3ce:	57                   	push   %edi
+ 3cf:	6a 00                	push   $0x0
+ 3d1:	56                   	push   %esi
+ 3d2:	e8 b5 01 00 00       	call   58c <futex>
+ 3d7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 3dc:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 3df:	83 c4 10             	add    $0x10,%esp
+ 3e2:	85 c0                	test   %eax,%eax
+ 3e4:	74 23                	je     409 <cond_wait+0x59>
+ 3e6:	be 02 00 00 00       	mov    $0x2,%esi
+ 3eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3ef:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3f0:	83 ec 04             	sub    $0x4,%esp
+ 3f3:	6a 02                	push   $0x2
+ 3f5:	6a 00                	push   $0x0
+ 3f7:	53                   	push   %ebx
+ 3f8:	e8 8f 01 00 00       	call   58c <futex>
+ 3fd:	89 f0                	mov    %esi,%eax
+ 3ff:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 402:	83 c4 10             	add    $0x10,%esp
+ 405:	85 c0                	test   %eax,%eax
+ 407:	75 e7                	jne    3f0 <cond_wait+0x40>
+}
+ 409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 40c:	5b                   	pop    %ebx
+ 40d:	5e                   	pop    %esi
+ 40e:	5f                   	pop    %edi
+ 40f:	5d                   	pop    %ebp
+ 410:	c3                   	ret
+ 411:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 418:	83 ec 04             	sub    $0x4,%esp
+ 41b:	6a 01                	push   $0x1
+ 41d:	6a 01                	push   $0x1
+ 41f:	53                   	push   %ebx
+ 420:	e8 67 01 00 00       	call   58c <futex>
+ 425:	83 c4 10             	add    $0x10,%esp
+ 428:	eb a1                	jmp    3cb <cond_wait+0x1b>
+ 42a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000430 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+ 433:	83 ec 0c             	sub    $0xc,%esp
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 439:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 43d:	6a 01                	push   $0x1
+ 43f:	6a 01                	push   $0x1
+ 441:	50                   	push   %eax
+ 442:	e8 45 01 00 00       	call   58c <futex>
+}
+ 447:	83 c4 10             	add    $0x10,%esp
+ 44a:	c9                   	leave
+ 44b:	c3                   	ret
+ 44c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000450 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	83 ec 0c             	sub    $0xc,%esp
+ 456:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 459:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 45d:	6a ff                	push   $0xffffffff
+ 45f:	6a 01                	push   $0x1
+ 461:	50                   	push   %eax
+ 462:	e8 25 01 00 00       	call   58c <futex>
+}
+ 467:	83 c4 10             	add    $0x10,%esp
+ 46a:	c9                   	leave
+ 46b:	c3                   	ret
+
+0000046c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 46c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <exit>:
+SYSCALL(exit)
+ 474:	b8 02 00 00 00       	mov    $0x2,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <wait>:
+SYSCALL(wait)
+ 47c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <pipe>:
+SYSCALL(pipe)
+ 484:	b8 04 00 00 00       	mov    $0x4,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <read>:
+SYSCALL(read)
+ 48c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <write>:
+SYSCALL(write)
+ 494:	b8 10 00 00 00       	mov    $0x10,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <close>:
+SYSCALL(close)
+ 49c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <kill>:
+SYSCALL(kill)
+ 4a4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <exec>:
+SYSCALL(exec)
+ 4ac:	b8 07 00 00 00       	mov    $0x7,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <open>:
+SYSCALL(open)
+ 4b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <mknod>:
+SYSCALL(mknod)
+ 4bc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <unlink>:
+SYSCALL(unlink)
+ 4c4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <fstat>:
+SYSCALL(fstat)
+ 4cc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <link>:
+SYSCALL(link)
+ 4d4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <mkdir>:
+SYSCALL(mkdir)
+ 4dc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <chdir>:
+SYSCALL(chdir)
+ 4e4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <dup>:
+SYSCALL(dup)
+ 4ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <getpid>:
+SYSCALL(getpid)
+ 4f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <sbrk>:
+SYSCALL(sbrk)
+ 4fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <sleep>:
+SYSCALL(sleep)
+ 504:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <uptime>:
+SYSCALL(uptime)
+ 50c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 514:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 51c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <wmap>:
+SYSCALL(wmap)
+ 524:	b8 16 00 00 00       	mov    $0x16,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <wunmap>:
+SYSCALL(wunmap)
+ 52c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <wremap>:
+SYSCALL(wremap)
+ 534:	b8 18 00 00 00       	mov    $0x18,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <wmlock>:
+SYSCALL(wmlock)
+ 53c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <wmunlock>:
+SYSCALL(wmunlock)
+ 544:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <wmapoff>:
+SYSCALL(wmapoff)
+ 54c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 554:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <setpriority>:
+SYSCALL(setpriority)
+ 55c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 564:	b8 20 00 00 00       	mov    $0x20,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <settickets>:
+SYSCALL(settickets)
+ 56c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 574:	b8 22 00 00 00       	mov    $0x22,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <clone>:
+SYSCALL(clone)
+ 57c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <join>:
+SYSCALL(join)
+ 584:	b8 24 00 00 00       	mov    $0x24,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <futex>:
+SYSCALL(futex)
+ 58c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <setaffinity>:
+SYSCALL(setaffinity)
+ 594:	b8 26 00 00 00       	mov    $0x26,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <getaffinity>:
+SYSCALL(getaffinity)
+ 59c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <bcstat>:
+SYSCALL(bcstat)
+ 5a4:	b8 29 00 00 00       	mov    $0x29,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <dropcache>:
+SYSCALL(dropcache)
+ 5ac:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <setiosched>:
+SYSCALL(setiosched)
+ 5b4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <iostat>:
+SYSCALL(iostat)
+ 5bc:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 5c1:	cd 40                	int    $0x40
+ 5c3:	c3                   	ret
+
+000005c4 <fsync>:
+SYSCALL(fsync)
+ 5c4:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 5c9:	cd 40                	int    $0x40
+ 5cb:	c3                   	ret
+
+000005cc <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 5cc:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 5cd:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 5d2:	cd 40                	int    $0x40
+ 5d4:	ff e1                	jmp    *%ecx
+ 5d6:	66 90                	xchg   %ax,%ax
+ 5d8:	66 90                	xchg   %ax,%ax
+ 5da:	66 90                	xchg   %ax,%ax
+ 5dc:	66 90                	xchg   %ax,%ax
+ 5de:	66 90                	xchg   %ax,%ax
+
+000005e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 5e0:	55                   	push   %ebp
+ 5e1:	89 e5                	mov    %esp,%ebp
+ 5e3:	57                   	push   %edi
+ 5e4:	56                   	push   %esi
+ 5e5:	53                   	push   %ebx
+ 5e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 5e8:	89 d1                	mov    %edx,%ecx
+{
+ 5ea:	83 ec 3c             	sub    $0x3c,%esp
+ 5ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5f0:	85 d2                	test   %edx,%edx
+ 5f2:	0f 89 80 00 00 00    	jns    678 <printint+0x98>
+ 5f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5fc:	74 7a                	je     678 <printint+0x98>
+    x = -xx;
+ 5fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 600:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 605:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 608:	31 f6                	xor    %esi,%esi
+ 60a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 610:	89 c8                	mov    %ecx,%eax
+ 612:	31 d2                	xor    %edx,%edx
+ 614:	89 f7                	mov    %esi,%edi
+ 616:	f7 f3                	div    %ebx
+ 618:	8d 76 01             	lea    0x1(%esi),%esi
+ 61b:	0f b6 92 f4 0b 00 00 	movzbl 0xbf4(%edx),%edx
+ 622:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 626:	89 ca                	mov    %ecx,%edx
+ 628:	89 c1                	mov    %eax,%ecx
+ 62a:	39 da                	cmp    %ebx,%edx
+ 62c:	73 e2                	jae    610 <printint+0x30>
+  if(neg)
+ 62e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 631:	85 c0                	test   %eax,%eax
+ 633:	74 07                	je     63c <printint+0x5c>
+    buf[i++] = '-';
+ 635:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 63a:	89 f7                	mov    %esi,%edi
+ 63c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 63f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 642:	01 df                	add    %ebx,%edi
+ 644:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 648:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 64b:	83 ec 04             	sub    $0x4,%esp
+ 64e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 651:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 654:	6a 01                	push   $0x1
+ 656:	50                   	push   %eax
+ 657:	56                   	push   %esi
+ 658:	e8 37 fe ff ff       	call   494 <write>
+  while(--i >= 0)
+ 65d:	89 f8                	mov    %edi,%eax
+ 65f:	83 c4 10             	add    $0x10,%esp
+ 662:	83 ef 01             	sub    $0x1,%edi
+ 665:	39 d8                	cmp    %ebx,%eax
+ 667:	75 df                	jne    648 <printint+0x68>
+}
+ 669:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 66c:	5b                   	pop    %ebx
+ 66d:	5e                   	pop    %esi
+ 66e:	5f                   	pop    %edi
+ 66f:	5d                   	pop    %ebp
+ 670:	c3                   	ret
+ 671:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 678:	31 c0                	xor    %eax,%eax
+ 67a:	eb 89                	jmp    605 <printint+0x25>
+ 67c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000680 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 680:	55                   	push   %ebp
+ 681:	89 e5                	mov    %esp,%ebp
+ 683:	57                   	push   %edi
+ 684:	56                   	push   %esi
+ 685:	53                   	push   %ebx
+ 686:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 689:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 68c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 68f:	0f b6 1e             	movzbl (%esi),%ebx
+ 692:	83 c6 01             	add    $0x1,%esi
+ 695:	84 db                	test   %bl,%bl
+ 697:	74 67                	je     700 <printf+0x80>
+ 699:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 69c:	31 d2                	xor    %edx,%edx
+ 69e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 6a1:	eb 34                	jmp    6d7 <printf+0x57>
+ 6a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6a7:	90                   	nop
+ 6a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 6ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 6b0:	83 f8 25             	cmp    $0x25,%eax
+ 6b3:	74 18                	je     6cd <printf+0x4d>
+  write(fd, &c, 1);
+ 6b5:	83 ec 04             	sub    $0x4,%esp
+ 6b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 6bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6be:	6a 01                	push   $0x1
+ 6c0:	50                   	push   %eax
+ 6c1:	57                   	push   %edi
+ 6c2:	e8 cd fd ff ff       	call   494 <write>
+ 6c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 6ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 6cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 6d0:	83 c6 01             	add    $0x1,%esi
+ 6d3:	84 db                	test   %bl,%bl
+ 6d5:	74 29                	je     700 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 6d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 6da:	85 d2                	test   %edx,%edx
+ 6dc:	74 ca                	je     6a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 6de:	83 fa 25             	cmp    $0x25,%edx
+ 6e1:	75 ea                	jne    6cd <printf+0x4d>
+      if(c == 'd'){
+ 6e3:	83 f8 25             	cmp    $0x25,%eax
+ 6e6:	0f 84 24 01 00 00    	je     810 <printf+0x190>
+ 6ec:	83 e8 63             	sub    $0x63,%eax
+ 6ef:	83 f8 15             	cmp    $0x15,%eax
+ 6f2:	77 1c                	ja     710 <printf+0x90>
+ 6f4:	ff 24 85 9c 0b 00 00 	jmp    *0xb9c(,%eax,4)
+ 6fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 700:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 703:	5b                   	pop    %ebx
+ 704:	5e                   	pop    %esi
+ 705:	5f                   	pop    %edi
+ 706:	5d                   	pop    %ebp
+ 707:	c3                   	ret
+ 708:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 70f:	90                   	nop
+  write(fd, &c, 1);
+ 710:	83 ec 04             	sub    $0x4,%esp
+ 713:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 716:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 71a:	6a 01                	push   $0x1
+ 71c:	52                   	push   %edx
+ 71d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 720:	57                   	push   %edi
+ 721:	e8 6e fd ff ff       	call   494 <write>
+ 726:	83 c4 0c             	add    $0xc,%esp
+ 729:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 72c:	6a 01                	push   $0x1
+ 72e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 731:	52                   	push   %edx
+ 732:	57                   	push   %edi
+ 733:	e8 5c fd ff ff       	call   494 <write>
+        putc(fd, c);
+ 738:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 73b:	31 d2                	xor    %edx,%edx
+ 73d:	eb 8e                	jmp    6cd <printf+0x4d>
+ 73f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 740:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 743:	83 ec 0c             	sub    $0xc,%esp
+ 746:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 74b:	8b 13                	mov    (%ebx),%edx
+ 74d:	6a 00                	push   $0x0
+ 74f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 751:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 754:	e8 87 fe ff ff       	call   5e0 <printint>
+        ap++;
+ 759:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 75c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 75f:	31 d2                	xor    %edx,%edx
+ 761:	e9 67 ff ff ff       	jmp    6cd <printf+0x4d>
+ 766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 76d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 770:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 773:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 775:	83 c0 04             	add    $0x4,%eax
+ 778:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 77b:	85 db                	test   %ebx,%ebx
+ 77d:	0f 84 9d 00 00 00    	je     820 <printf+0x1a0>
+        while(*s != 0){
+ 783:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 786:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 788:	84 c0                	test   %al,%al
+ 78a:	0f 84 3d ff ff ff    	je     6cd <printf+0x4d>
+ 790:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 793:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 796:	89 de                	mov    %ebx,%esi
+ 798:	89 d3                	mov    %edx,%ebx
+ 79a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 7a0:	83 ec 04             	sub    $0x4,%esp
+ 7a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 7a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	53                   	push   %ebx
+ 7ac:	57                   	push   %edi
+ 7ad:	e8 e2 fc ff ff       	call   494 <write>
+        while(*s != 0){
+ 7b2:	0f b6 06             	movzbl (%esi),%eax
+ 7b5:	83 c4 10             	add    $0x10,%esp
+ 7b8:	84 c0                	test   %al,%al
+ 7ba:	75 e4                	jne    7a0 <printf+0x120>
+      state = 0;
+ 7bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 7bf:	31 d2                	xor    %edx,%edx
+ 7c1:	e9 07 ff ff ff       	jmp    6cd <printf+0x4d>
+ 7c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 7d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 7d3:	83 ec 0c             	sub    $0xc,%esp
+ 7d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 7db:	8b 13                	mov    (%ebx),%edx
+ 7dd:	6a 01                	push   $0x1
+ 7df:	e9 6b ff ff ff       	jmp    74f <printf+0xcf>
+ 7e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 7e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 7eb:	83 ec 04             	sub    $0x4,%esp
+ 7ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7f9:	6a 01                	push   $0x1
+ 7fb:	52                   	push   %edx
+ 7fc:	57                   	push   %edi
+ 7fd:	e8 92 fc ff ff       	call   494 <write>
+        ap++;
+ 802:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 805:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 808:	31 d2                	xor    %edx,%edx
+ 80a:	e9 be fe ff ff       	jmp    6cd <printf+0x4d>
+ 80f:	90                   	nop
+  write(fd, &c, 1);
+ 810:	83 ec 04             	sub    $0x4,%esp
+ 813:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 816:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 819:	6a 01                	push   $0x1
+ 81b:	e9 11 ff ff ff       	jmp    731 <printf+0xb1>
+ 820:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 825:	bb 95 0b 00 00       	mov    $0xb95,%ebx
+ 82a:	e9 61 ff ff ff       	jmp    790 <printf+0x110>
+ 82f:	90                   	nop
+
+00000830 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 830:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 831:	a1 a0 10 00 00       	mov    0x10a0,%eax
+{
+ 836:	89 e5                	mov    %esp,%ebp
+ 838:	57                   	push   %edi
+ 839:	56                   	push   %esi
+ 83a:	53                   	push   %ebx
+ 83b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 83e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 848:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 84a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 84c:	39 ca                	cmp    %ecx,%edx
+ 84e:	73 30                	jae    880 <free+0x50>
+ 850:	39 c1                	cmp    %eax,%ecx
+ 852:	72 04                	jb     858 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 854:	39 c2                	cmp    %eax,%edx
+ 856:	72 f0                	jb     848 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 858:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 85b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 85e:	39 f8                	cmp    %edi,%eax
+ 860:	74 2e                	je     890 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 862:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 865:	8b 42 04             	mov    0x4(%edx),%eax
+ 868:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 86b:	39 f1                	cmp    %esi,%ecx
+ 86d:	74 38                	je     8a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 86f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 871:	5b                   	pop    %ebx
+  freep = p;
+ 872:	89 15 a0 10 00 00    	mov    %edx,0x10a0
+}
+ 878:	5e                   	pop    %esi
+ 879:	5f                   	pop    %edi
+ 87a:	5d                   	pop    %ebp
+ 87b:	c3                   	ret
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 880:	39 c1                	cmp    %eax,%ecx
+ 882:	72 d0                	jb     854 <free+0x24>
+ 884:	eb c2                	jmp    848 <free+0x18>
+ 886:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 88d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 890:	03 70 04             	add    0x4(%eax),%esi
+ 893:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 896:	8b 02                	mov    (%edx),%eax
+ 898:	8b 00                	mov    (%eax),%eax
+ 89a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 89d:	8b 42 04             	mov    0x4(%edx),%eax
+ 8a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 8a3:	39 f1                	cmp    %esi,%ecx
+ 8a5:	75 c8                	jne    86f <free+0x3f>
+    p->s.size += bp->s.size;
+ 8a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 8aa:	89 15 a0 10 00 00    	mov    %edx,0x10a0
+    p->s.size += bp->s.size;
+ 8b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 8b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 8b6:	89 0a                	mov    %ecx,(%edx)
+}
+ 8b8:	5b                   	pop    %ebx
+ 8b9:	5e                   	pop    %esi
+ 8ba:	5f                   	pop    %edi
+ 8bb:	5d                   	pop    %ebp
+ 8bc:	c3                   	ret
+ 8bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000008c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 8c0:	55                   	push   %ebp
+ 8c1:	89 e5                	mov    %esp,%ebp
+ 8c3:	57                   	push   %edi
+ 8c4:	56                   	push   %esi
+ 8c5:	53                   	push   %ebx
+ 8c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 8cc:	8b 15 a0 10 00 00    	mov    0x10a0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 8d2:	8d 78 07             	lea    0x7(%eax),%edi
+ 8d5:	c1 ef 03             	shr    $0x3,%edi
+ 8d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 8db:	85 d2                	test   %edx,%edx
+ 8dd:	0f 84 8d 00 00 00    	je     970 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8e5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8e8:	39 f9                	cmp    %edi,%ecx
+ 8ea:	73 64                	jae    950 <malloc+0x90>
+  if(nu < 4096)
+ 8ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8f1:	39 df                	cmp    %ebx,%edi
+ 8f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8fd:	eb 0a                	jmp    909 <malloc+0x49>
+ 8ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 900:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 902:	8b 48 04             	mov    0x4(%eax),%ecx
+ 905:	39 f9                	cmp    %edi,%ecx
+ 907:	73 47                	jae    950 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 909:	89 c2                	mov    %eax,%edx
+ 90b:	39 05 a0 10 00 00    	cmp    %eax,0x10a0
+ 911:	75 ed                	jne    900 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	56                   	push   %esi
+ 917:	e8 e0 fb ff ff       	call   4fc <sbrk>
+  if(p == (char*)-1)
+ 91c:	83 c4 10             	add    $0x10,%esp
+ 91f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 922:	74 1c                	je     940 <malloc+0x80>
+  hp->s.size = nu;
+ 924:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 927:	83 ec 0c             	sub    $0xc,%esp
+ 92a:	83 c0 08             	add    $0x8,%eax
+ 92d:	50                   	push   %eax
+ 92e:	e8 fd fe ff ff       	call   830 <free>
+  return freep;
+ 933:	8b 15 a0 10 00 00    	mov    0x10a0,%edx
+      if((p = morecore(nunits)) == 0)
+ 939:	83 c4 10             	add    $0x10,%esp
+ 93c:	85 d2                	test   %edx,%edx
+ 93e:	75 c0                	jne    900 <malloc+0x40>
+        return 0;
+  }
+}
+ 940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 943:	31 c0                	xor    %eax,%eax
+}
+ 945:	5b                   	pop    %ebx
+ 946:	5e                   	pop    %esi
+ 947:	5f                   	pop    %edi
+ 948:	5d                   	pop    %ebp
+ 949:	c3                   	ret
+ 94a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 950:	39 cf                	cmp    %ecx,%edi
+ 952:	74 4c                	je     9a0 <malloc+0xe0>
+        p->s.size -= nunits;
+ 954:	29 f9                	sub    %edi,%ecx
+ 956:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 959:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 95c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 95f:	89 15 a0 10 00 00    	mov    %edx,0x10a0
+}
+ 965:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 968:	83 c0 08             	add    $0x8,%eax
+}
+ 96b:	5b                   	pop    %ebx
+ 96c:	5e                   	pop    %esi
+ 96d:	5f                   	pop    %edi
+ 96e:	5d                   	pop    %ebp
+ 96f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 970:	c7 05 a0 10 00 00 a4 	movl   $0x10a4,0x10a0
+ 977:	10 00 00 
+    base.s.size = 0;
+ 97a:	b8 a4 10 00 00       	mov    $0x10a4,%eax
+    base.s.ptr = freep = prevp = &base;
+ 97f:	c7 05 a4 10 00 00 a4 	movl   $0x10a4,0x10a4
+ 986:	10 00 00 
+    base.s.size = 0;
+ 989:	c7 05 a8 10 00 00 00 	movl   $0x0,0x10a8
+ 990:	00 00 00 
+    if(p->s.size >= nunits){
+ 993:	e9 54 ff ff ff       	jmp    8ec <malloc+0x2c>
+ 998:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 9a0:	8b 08                	mov    (%eax),%ecx
+ 9a2:	89 0a                	mov    %ecx,(%edx)
+ 9a4:	eb b9                	jmp    95f <malloc+0x9f>
+ 9a6:	66 90                	xchg   %ax,%ax
+ 9a8:	66 90                	xchg   %ax,%ax
+ 9aa:	66 90                	xchg   %ax,%ax
+ 9ac:	66 90                	xchg   %ax,%ax
+ 9ae:	66 90                	xchg   %ax,%ax
+
+000009b0 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ 9b0:	55                   	push   %ebp
+ 9b1:	89 e5                	mov    %esp,%ebp
+ 9b3:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ 9b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9b9:	c1 e0 04             	shl    $0x4,%eax
+ 9bc:	ff b0 ec 10 00 00    	push   0x10ec(%eax)
+ 9c2:	05 e0 10 00 00       	add    $0x10e0,%eax
+ 9c7:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ 9ca:	e8 a5 fa ff ff       	call   474 <exit>
+ 9cf:	90                   	nop
+
+000009d0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 9d0:	55                   	push   %ebp
+ 9d1:	89 e5                	mov    %esp,%ebp
+ 9d3:	57                   	push   %edi
+ 9d4:	56                   	push   %esi
+ 9d5:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ 9d6:	31 db                	xor    %ebx,%ebx
+{
+ 9d8:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ 9db:	68 c0 10 00 00       	push   $0x10c0
+ 9e0:	e8 eb f8 ff ff       	call   2d0 <lock_acquire>
+ 9e5:	83 c4 10             	add    $0x10,%esp
+ 9e8:	eb 12                	jmp    9fc <thread_create+0x2c>
+ 9ea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ 9f0:	83 c3 01             	add    $0x1,%ebx
+ 9f3:	83 fb 40             	cmp    $0x40,%ebx
+ 9f6:	0f 84 c4 00 00 00    	je     ac0 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ 9fc:	89 de                	mov    %ebx,%esi
+ 9fe:	c1 e6 04             	shl    $0x4,%esi
+ a01:	8b 96 e0 10 00 00    	mov    0x10e0(%esi),%edx
+ a07:	85 d2                	test   %edx,%edx
+ a09:	75 e5                	jne    9f0 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ a0b:	83 ec 0c             	sub    $0xc,%esp
+ a0e:	68 00 20 00 00       	push   $0x2000
+ a13:	e8 a8 fe ff ff       	call   8c0 <malloc>
+ a18:	83 c4 10             	add    $0x10,%esp
+ a1b:	85 c0                	test   %eax,%eax
+ a1d:	0f 84 9d 00 00 00    	je     ac0 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ a23:	89 86 e4 10 00 00    	mov    %eax,0x10e4(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ a29:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ a2e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ a31:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ a36:	89 86 e0 10 00 00    	mov    %eax,0x10e0(%esi)
+  threads[i].fn = fn;
+ a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+ a3f:	89 86 e8 10 00 00    	mov    %eax,0x10e8(%esi)
+  threads[i].arg = arg;
+ a45:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a48:	89 86 ec 10 00 00    	mov    %eax,0x10ec(%esi)
+  lock_release(&threadslock);
+ a4e:	68 c0 10 00 00       	push   $0x10c0
+ a53:	e8 98 f8 ff ff       	call   2f0 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ a58:	83 c4 0c             	add    $0xc,%esp
+ a5b:	ff b6 e0 10 00 00    	push   0x10e0(%esi)
+ a61:	53                   	push   %ebx
+ a62:	68 b0 09 00 00       	push   $0x9b0
+ a67:	e8 10 fb ff ff       	call   57c <clone>
+ a6c:	83 c4 10             	add    $0x10,%esp
+ a6f:	85 c0                	test   %eax,%eax
+ a71:	78 0d                	js     a80 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ a73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a76:	5b                   	pop    %ebx
+ a77:	5e                   	pop    %esi
+ a78:	5f                   	pop    %edi
+ a79:	5d                   	pop    %ebp
+ a7a:	c3                   	ret
+ a7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a7f:	90                   	nop
+    lock_acquire(&threadslock);
+ a80:	83 ec 0c             	sub    $0xc,%esp
+ a83:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ a86:	68 c0 10 00 00       	push   $0x10c0
+ a8b:	e8 40 f8 ff ff       	call   2d0 <lock_acquire>
+    free(threads[i].block);
+ a90:	58                   	pop    %eax
+ a91:	ff b6 e4 10 00 00    	push   0x10e4(%esi)
+ a97:	e8 94 fd ff ff       	call   830 <free>
+    threads[i].stack = 0;
+ a9c:	c7 86 e0 10 00 00 00 	movl   $0x0,0x10e0(%esi)
+ aa3:	00 00 00 
+    lock_release(&threadslock);
+ aa6:	c7 04 24 c0 10 00 00 	movl   $0x10c0,(%esp)
+ aad:	e8 3e f8 ff ff       	call   2f0 <lock_release>
+ ab2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ab5:	83 c4 10             	add    $0x10,%esp
+}
+ ab8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ abb:	5b                   	pop    %ebx
+ abc:	5e                   	pop    %esi
+ abd:	5f                   	pop    %edi
+ abe:	5d                   	pop    %ebp
+ abf:	c3                   	ret
+    lock_release(&threadslock);
+ ac0:	83 ec 0c             	sub    $0xc,%esp
+ ac3:	68 c0 10 00 00       	push   $0x10c0
+ ac8:	e8 23 f8 ff ff       	call   2f0 <lock_release>
+    return -1;
+ acd:	83 c4 10             	add    $0x10,%esp
+ ad0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ad5:	eb 9c                	jmp    a73 <thread_create+0xa3>
+ ad7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ade:	66 90                	xchg   %ax,%ax
+
+00000ae0 <thread_join>:
+
+int
+thread_join(void)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	56                   	push   %esi
+ ae4:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ ae5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ ae8:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ aeb:	50                   	push   %eax
+ aec:	e8 93 fa ff ff       	call   584 <join>
+ af1:	83 c4 10             	add    $0x10,%esp
+ af4:	85 c0                	test   %eax,%eax
+ af6:	78 69                	js     b61 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ af8:	83 ec 0c             	sub    $0xc,%esp
+ afb:	89 c6                	mov    %eax,%esi
+ afd:	68 c0 10 00 00       	push   $0x10c0
+ b02:	e8 c9 f7 ff ff       	call   2d0 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ b07:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ b0a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ b0d:	31 c0                	xor    %eax,%eax
+ b0f:	eb 0f                	jmp    b20 <thread_join+0x40>
+ b11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b18:	83 c0 01             	add    $0x1,%eax
+ b1b:	83 f8 40             	cmp    $0x40,%eax
+ b1e:	74 28                	je     b48 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ b20:	89 c3                	mov    %eax,%ebx
+ b22:	c1 e3 04             	shl    $0x4,%ebx
+ b25:	39 93 e0 10 00 00    	cmp    %edx,0x10e0(%ebx)
+ b2b:	75 eb                	jne    b18 <thread_join+0x38>
+      free(threads[i].block);
+ b2d:	83 ec 0c             	sub    $0xc,%esp
+ b30:	ff b3 e4 10 00 00    	push   0x10e4(%ebx)
+ b36:	e8 f5 fc ff ff       	call   830 <free>
+      threads[i].stack = 0;
+      break;
+ b3b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ b3e:	c7 83 e0 10 00 00 00 	movl   $0x0,0x10e0(%ebx)
+ b45:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ b48:	83 ec 0c             	sub    $0xc,%esp
+ b4b:	68 c0 10 00 00       	push   $0x10c0
+ b50:	e8 9b f7 ff ff       	call   2f0 <lock_release>
+  return pid;
+ b55:	83 c4 10             	add    $0x10,%esp
+}
+ b58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b5b:	89 f0                	mov    %esi,%eax
+ b5d:	5b                   	pop    %ebx
+ b5e:	5e                   	pop    %esi
+ b5f:	5d                   	pop    %ebp
+ b60:	c3                   	ret
+    return -1;
+ b61:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ b66:	eb f0                	jmp    b58 <thread_join+0x78>
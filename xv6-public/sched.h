@@ -0,0 +1,30 @@
+#ifndef SCHED
+#define SCHED
+
+// MLFQ priority levels; 0 is the highest.
+#define NPRIO 4
+
+// Scheduling policies for `setschedpolicy`
+#define SCHED_MLFQ   0 // Multilevel feedback queue
+#define SCHED_STRIDE 1 // Proportional share by tickets
+
+// Tickets a process starts with, and the most it may hold
+#define DEFTICKETS 100
+#define MAXTICKETS 10000
+
+// Flags for `setaffinity`
+#define AFF_DEDICATE 1 // Reserve the one CPU in mask for the process
+
+// for `getschedinfo`
+struct schedinfo {
+    int priority;     // Current MLFQ level
+    int pinned;       // 1 if setpriority fixed the level
+    int slice;        // Ticks used so far at the current level
+    int ticks[NPRIO]; // Timer ticks spent running at each level
+    int tickets;      // Stride-scheduling share
+    uint pass;        // Stride-scheduling virtual time
+    int cpu;          // CPU it last ran on
+    int dedicated;    // 1 if it has a CPU to itself
+};
+
+#endif
@@ -0,0 +1,2041 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	bf 04 00 00 00       	mov    $0x4,%edi
+  13:	56                   	push   %esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 28             	sub    $0x28,%esp
+  19:	8b 19                	mov    (%ecx),%ebx
+  1b:	8b 71 04             	mov    0x4(%ecx),%esi
+  int pairs, rounds, i, start, elapsed;
+  int ab[2], ba[2];
+
+  pairs = 4;
+  rounds = 2000;
+  1e:	c7 45 d4 d0 07 00 00 	movl   $0x7d0,-0x2c(%ebp)
+  if(argc > 1)
+  25:	83 fb 01             	cmp    $0x1,%ebx
+  28:	0f 8f a6 00 00 00    	jg     d4 <main+0xd4>
+  if(pairs < 1 || rounds < 1){
+    printf(2, "usage: schedbench [pairs [rounds]]\n");
+    exit();
+  }
+
+  printf(1, "schedbench: %d pairs x %d rounds\n", pairs, rounds);
+  2e:	ff 75 d4             	push   -0x2c(%ebp)
+  start = uptime();
+  for(i = 0; i < pairs; i++){
+  31:	31 db                	xor    %ebx,%ebx
+  33:	8d 75 d8             	lea    -0x28(%ebp),%esi
+  printf(1, "schedbench: %d pairs x %d rounds\n", pairs, rounds);
+  36:	57                   	push   %edi
+  37:	68 5c 0d 00 00       	push   $0xd5c
+  3c:	6a 01                	push   $0x1
+  3e:	e8 0d 08 00 00       	call   850 <printf>
+  start = uptime();
+  43:	e8 94 06 00 00       	call   6dc <uptime>
+  48:	83 c4 10             	add    $0x10,%esp
+  4b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for(i = 0; i < pairs; i++){
+  4e:	eb 61                	jmp    b1 <main+0xb1>
+    if(pipe(ab) < 0 || pipe(ba) < 0){
+  50:	83 ec 0c             	sub    $0xc,%esp
+  53:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  56:	50                   	push   %eax
+  57:	e8 f8 05 00 00       	call   654 <pipe>
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	85 c0                	test   %eax,%eax
+  61:	78 5e                	js     c1 <main+0xc1>
+      printf(2, "schedbench: pipe failed\n");
+      exit();
+    }
+    if(fork() == 0){
+  63:	e8 d4 05 00 00       	call   63c <fork>
+  68:	85 c0                	test   %eax,%eax
+  6a:	0f 84 ab 00 00 00    	je     11b <main+0x11b>
+      pingpong(ba[0], ab[1], rounds, 1);
+      exit();
+    }
+    if(fork() == 0){
+  70:	e8 c7 05 00 00       	call   63c <fork>
+  75:	85 c0                	test   %eax,%eax
+  77:	0f 84 b3 00 00 00    	je     130 <main+0x130>
+      pingpong(ab[0], ba[1], rounds, 0);
+      exit();
+    }
+    close(ab[0]);
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	ff 75 d8             	push   -0x28(%ebp)
+  for(i = 0; i < pairs; i++){
+  83:	83 c3 01             	add    $0x1,%ebx
+    close(ab[0]);
+  86:	e8 e1 05 00 00       	call   66c <close>
+    close(ab[1]);
+  8b:	58                   	pop    %eax
+  8c:	ff 75 dc             	push   -0x24(%ebp)
+  8f:	e8 d8 05 00 00       	call   66c <close>
+    close(ba[0]);
+  94:	5a                   	pop    %edx
+  95:	ff 75 e0             	push   -0x20(%ebp)
+  98:	e8 cf 05 00 00       	call   66c <close>
+    close(ba[1]);
+  9d:	59                   	pop    %ecx
+  9e:	ff 75 e4             	push   -0x1c(%ebp)
+  a1:	e8 c6 05 00 00       	call   66c <close>
+  for(i = 0; i < pairs; i++){
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	39 fb                	cmp    %edi,%ebx
+  ab:	0f 84 94 00 00 00    	je     145 <main+0x145>
+    if(pipe(ab) < 0 || pipe(ba) < 0){
+  b1:	83 ec 0c             	sub    $0xc,%esp
+  b4:	56                   	push   %esi
+  b5:	e8 9a 05 00 00       	call   654 <pipe>
+  ba:	83 c4 10             	add    $0x10,%esp
+  bd:	85 c0                	test   %eax,%eax
+  bf:	79 8f                	jns    50 <main+0x50>
+      printf(2, "schedbench: pipe failed\n");
+  c1:	53                   	push   %ebx
+  c2:	53                   	push   %ebx
+  c3:	68 b6 0d 00 00       	push   $0xdb6
+  c8:	6a 02                	push   $0x2
+  ca:	e8 81 07 00 00       	call   850 <printf>
+      exit();
+  cf:	e8 70 05 00 00       	call   644 <exit>
+    pairs = atoi(argv[1]);
+  d4:	83 ec 0c             	sub    $0xc,%esp
+  d7:	ff 76 04             	push   0x4(%esi)
+  da:	e8 41 03 00 00       	call   420 <atoi>
+  if(argc > 2)
+  df:	83 c4 10             	add    $0x10,%esp
+    pairs = atoi(argv[1]);
+  e2:	89 c7                	mov    %eax,%edi
+  if(argc > 2)
+  e4:	83 fb 02             	cmp    $0x2,%ebx
+  e7:	74 11                	je     fa <main+0xfa>
+    rounds = atoi(argv[2]);
+  e9:	83 ec 0c             	sub    $0xc,%esp
+  ec:	ff 76 08             	push   0x8(%esi)
+  ef:	e8 2c 03 00 00       	call   420 <atoi>
+  f4:	83 c4 10             	add    $0x10,%esp
+  f7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(pairs < 1 || rounds < 1){
+  fa:	85 ff                	test   %edi,%edi
+  fc:	7e 0a                	jle    108 <main+0x108>
+  fe:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+ 102:	0f 8f 26 ff ff ff    	jg     2e <main+0x2e>
+    printf(2, "usage: schedbench [pairs [rounds]]\n");
+ 108:	56                   	push   %esi
+ 109:	56                   	push   %esi
+ 10a:	68 38 0d 00 00       	push   $0xd38
+ 10f:	6a 02                	push   $0x2
+ 111:	e8 3a 07 00 00       	call   850 <printf>
+    exit();
+ 116:	e8 29 05 00 00       	call   644 <exit>
+      pingpong(ba[0], ab[1], rounds, 1);
+ 11b:	6a 01                	push   $0x1
+ 11d:	ff 75 d4             	push   -0x2c(%ebp)
+ 120:	ff 75 dc             	push   -0x24(%ebp)
+ 123:	ff 75 e0             	push   -0x20(%ebp)
+ 126:	e8 75 00 00 00       	call   1a0 <pingpong>
+      exit();
+ 12b:	e8 14 05 00 00       	call   644 <exit>
+      pingpong(ab[0], ba[1], rounds, 0);
+ 130:	6a 00                	push   $0x0
+ 132:	ff 75 d4             	push   -0x2c(%ebp)
+ 135:	ff 75 e4             	push   -0x1c(%ebp)
+ 138:	ff 75 d8             	push   -0x28(%ebp)
+ 13b:	e8 60 00 00 00       	call   1a0 <pingpong>
+      exit();
+ 140:	e8 ff 04 00 00       	call   644 <exit>
+  }
+  for(i = 0; i < 2*pairs; i++)
+ 145:	8d 1c 3f             	lea    (%edi,%edi,1),%ebx
+ 148:	31 f6                	xor    %esi,%esi
+ 14a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    wait();
+ 150:	e8 f7 04 00 00       	call   64c <wait>
+  for(i = 0; i < 2*pairs; i++)
+ 155:	83 c6 01             	add    $0x1,%esi
+ 158:	39 de                	cmp    %ebx,%esi
+ 15a:	75 f4                	jne    150 <main+0x150>
+  elapsed = uptime() - start;
+ 15c:	e8 7b 05 00 00       	call   6dc <uptime>
+  if(elapsed == 0)
+ 161:	8b 55 d0             	mov    -0x30(%ebp),%edx
+ 164:	29 d0                	sub    %edx,%eax
+ 166:	89 c1                	mov    %eax,%ecx
+ 168:	75 05                	jne    16f <main+0x16f>
+    elapsed = 1;
+ 16a:	b9 01 00 00 00       	mov    $0x1,%ecx
+
+  // uptime() counts 100Hz timer ticks.
+  printf(1, "schedbench: %d switches in %d ticks, %d switches/sec\n",
+         2*pairs*rounds, elapsed, 2*pairs*rounds*100/elapsed);
+ 16f:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  printf(1, "schedbench: %d switches in %d ticks, %d switches/sec\n",
+ 172:	83 ec 0c             	sub    $0xc,%esp
+         2*pairs*rounds, elapsed, 2*pairs*rounds*100/elapsed);
+ 175:	0f af df             	imul   %edi,%ebx
+ 178:	69 c3 c8 00 00 00    	imul   $0xc8,%ebx,%eax
+  printf(1, "schedbench: %d switches in %d ticks, %d switches/sec\n",
+ 17e:	99                   	cltd
+ 17f:	f7 f9                	idiv   %ecx
+ 181:	8d 14 1b             	lea    (%ebx,%ebx,1),%edx
+ 184:	50                   	push   %eax
+ 185:	51                   	push   %ecx
+ 186:	52                   	push   %edx
+ 187:	68 80 0d 00 00       	push   $0xd80
+ 18c:	6a 01                	push   $0x1
+ 18e:	e8 bd 06 00 00       	call   850 <printf>
+  exit();
+ 193:	83 c4 20             	add    $0x20,%esp
+ 196:	e8 a9 04 00 00       	call   644 <exit>
+ 19b:	66 90                	xchg   %ax,%ax
+ 19d:	66 90                	xchg   %ax,%ax
+ 19f:	90                   	nop
+
+000001a0 <pingpong>:
+{
+ 1a0:	55                   	push   %ebp
+ 1a1:	89 e5                	mov    %esp,%ebp
+ 1a3:	57                   	push   %edi
+ 1a4:	56                   	push   %esi
+ 1a5:	53                   	push   %ebx
+ 1a6:	83 ec 1c             	sub    $0x1c,%esp
+  for(i = 0; i < rounds; i++){
+ 1a9:	8b 45 10             	mov    0x10(%ebp),%eax
+{
+ 1ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  c = 0;
+ 1af:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+{
+ 1b3:	8b 75 14             	mov    0x14(%ebp),%esi
+  for(i = 0; i < rounds; i++){
+ 1b6:	85 c0                	test   %eax,%eax
+ 1b8:	7e 39                	jle    1f3 <pingpong+0x53>
+    if(first && write(wfd, &c, 1) != 1)
+ 1ba:	85 f6                	test   %esi,%esi
+ 1bc:	75 42                	jne    200 <pingpong+0x60>
+ 1be:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+    if(read(rfd, &c, 1) != 1)
+ 1c1:	83 ec 04             	sub    $0x4,%esp
+ 1c4:	6a 01                	push   $0x1
+ 1c6:	53                   	push   %ebx
+ 1c7:	57                   	push   %edi
+ 1c8:	e8 8f 04 00 00       	call   65c <read>
+ 1cd:	83 c4 10             	add    $0x10,%esp
+ 1d0:	83 f8 01             	cmp    $0x1,%eax
+ 1d3:	75 1e                	jne    1f3 <pingpong+0x53>
+    if(!first && write(wfd, &c, 1) != 1)
+ 1d5:	83 ec 04             	sub    $0x4,%esp
+ 1d8:	6a 01                	push   $0x1
+ 1da:	53                   	push   %ebx
+ 1db:	ff 75 0c             	push   0xc(%ebp)
+ 1de:	e8 81 04 00 00       	call   664 <write>
+ 1e3:	83 c4 10             	add    $0x10,%esp
+ 1e6:	83 f8 01             	cmp    $0x1,%eax
+ 1e9:	75 08                	jne    1f3 <pingpong+0x53>
+  for(i = 0; i < rounds; i++){
+ 1eb:	83 c6 01             	add    $0x1,%esi
+ 1ee:	39 75 10             	cmp    %esi,0x10(%ebp)
+ 1f1:	75 ce                	jne    1c1 <pingpong+0x21>
+}
+ 1f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 1f6:	5b                   	pop    %ebx
+ 1f7:	5e                   	pop    %esi
+ 1f8:	5f                   	pop    %edi
+ 1f9:	5d                   	pop    %ebp
+ 1fa:	c3                   	ret
+ 1fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1ff:	90                   	nop
+  for(i = 0; i < rounds; i++){
+ 200:	31 f6                	xor    %esi,%esi
+ 202:	8d 5d e7             	lea    -0x19(%ebp),%ebx
+ 205:	eb 25                	jmp    22c <pingpong+0x8c>
+ 207:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20e:	66 90                	xchg   %ax,%ax
+    if(read(rfd, &c, 1) != 1)
+ 210:	83 ec 04             	sub    $0x4,%esp
+ 213:	6a 01                	push   $0x1
+ 215:	53                   	push   %ebx
+ 216:	57                   	push   %edi
+ 217:	e8 40 04 00 00       	call   65c <read>
+ 21c:	83 c4 10             	add    $0x10,%esp
+ 21f:	83 f8 01             	cmp    $0x1,%eax
+ 222:	75 cf                	jne    1f3 <pingpong+0x53>
+  for(i = 0; i < rounds; i++){
+ 224:	83 c6 01             	add    $0x1,%esi
+ 227:	3b 75 10             	cmp    0x10(%ebp),%esi
+ 22a:	74 c7                	je     1f3 <pingpong+0x53>
+    if(first && write(wfd, &c, 1) != 1)
+ 22c:	83 ec 04             	sub    $0x4,%esp
+ 22f:	6a 01                	push   $0x1
+ 231:	53                   	push   %ebx
+ 232:	ff 75 0c             	push   0xc(%ebp)
+ 235:	e8 2a 04 00 00       	call   664 <write>
+ 23a:	83 c4 10             	add    $0x10,%esp
+ 23d:	83 f8 01             	cmp    $0x1,%eax
+ 240:	74 ce                	je     210 <pingpong+0x70>
+}
+ 242:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 245:	5b                   	pop    %ebx
+ 246:	5e                   	pop    %esi
+ 247:	5f                   	pop    %edi
+ 248:	5d                   	pop    %ebp
+ 249:	c3                   	ret
+ 24a:	66 90                	xchg   %ax,%ax
+ 24c:	66 90                	xchg   %ax,%ax
+ 24e:	66 90                	xchg   %ax,%ax
+
+00000250 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 250:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 251:	31 c0                	xor    %eax,%eax
+{
+ 253:	89 e5                	mov    %esp,%ebp
+ 255:	53                   	push   %ebx
+ 256:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 25c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 260:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 264:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 267:	83 c0 01             	add    $0x1,%eax
+ 26a:	84 d2                	test   %dl,%dl
+ 26c:	75 f2                	jne    260 <strcpy+0x10>
+    ;
+  return os;
+}
+ 26e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 271:	89 c8                	mov    %ecx,%eax
+ 273:	c9                   	leave
+ 274:	c3                   	ret
+ 275:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000280 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	53                   	push   %ebx
+ 284:	8b 55 08             	mov    0x8(%ebp),%edx
+ 287:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 28a:	0f b6 02             	movzbl (%edx),%eax
+ 28d:	84 c0                	test   %al,%al
+ 28f:	75 17                	jne    2a8 <strcmp+0x28>
+ 291:	eb 3a                	jmp    2cd <strcmp+0x4d>
+ 293:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 297:	90                   	nop
+ 298:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 29c:	83 c2 01             	add    $0x1,%edx
+ 29f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2a2:	84 c0                	test   %al,%al
+ 2a4:	74 1a                	je     2c0 <strcmp+0x40>
+    p++, q++;
+ 2a6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2a8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2ab:	38 c3                	cmp    %al,%bl
+ 2ad:	74 e9                	je     298 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2af:	29 d8                	sub    %ebx,%eax
+}
+ 2b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2b4:	c9                   	leave
+ 2b5:	c3                   	ret
+ 2b6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2bd:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2c0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2c4:	31 c0                	xor    %eax,%eax
+ 2c6:	29 d8                	sub    %ebx,%eax
+}
+ 2c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2cd:	0f b6 19             	movzbl (%ecx),%ebx
+ 2d0:	31 c0                	xor    %eax,%eax
+ 2d2:	eb db                	jmp    2af <strcmp+0x2f>
+ 2d4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2df:	90                   	nop
+
+000002e0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 2e0:	55                   	push   %ebp
+ 2e1:	89 e5                	mov    %esp,%ebp
+ 2e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 2e6:	80 3a 00             	cmpb   $0x0,(%edx)
+ 2e9:	74 15                	je     300 <strlen+0x20>
+ 2eb:	31 c0                	xor    %eax,%eax
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+ 2f0:	83 c0 01             	add    $0x1,%eax
+ 2f3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 2f7:	89 c1                	mov    %eax,%ecx
+ 2f9:	75 f5                	jne    2f0 <strlen+0x10>
+    ;
+  return n;
+}
+ 2fb:	89 c8                	mov    %ecx,%eax
+ 2fd:	5d                   	pop    %ebp
+ 2fe:	c3                   	ret
+ 2ff:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 300:	31 c9                	xor    %ecx,%ecx
+}
+ 302:	5d                   	pop    %ebp
+ 303:	89 c8                	mov    %ecx,%eax
+ 305:	c3                   	ret
+ 306:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000310 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 317:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 31a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 31d:	89 d7                	mov    %edx,%edi
+ 31f:	fc                   	cld
+ 320:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 322:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 325:	89 d0                	mov    %edx,%eax
+ 327:	c9                   	leave
+ 328:	c3                   	ret
+ 329:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 330:	55                   	push   %ebp
+ 331:	89 e5                	mov    %esp,%ebp
+ 333:	8b 45 08             	mov    0x8(%ebp),%eax
+ 336:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 33a:	0f b6 10             	movzbl (%eax),%edx
+ 33d:	84 d2                	test   %dl,%dl
+ 33f:	75 12                	jne    353 <strchr+0x23>
+ 341:	eb 1d                	jmp    360 <strchr+0x30>
+ 343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 347:	90                   	nop
+ 348:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 34c:	83 c0 01             	add    $0x1,%eax
+ 34f:	84 d2                	test   %dl,%dl
+ 351:	74 0d                	je     360 <strchr+0x30>
+    if(*s == c)
+ 353:	38 d1                	cmp    %dl,%cl
+ 355:	75 f1                	jne    348 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 357:	5d                   	pop    %ebp
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 360:	31 c0                	xor    %eax,%eax
+}
+ 362:	5d                   	pop    %ebp
+ 363:	c3                   	ret
+ 364:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 36f:	90                   	nop
+
+00000370 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	57                   	push   %edi
+ 374:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 375:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 378:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 379:	31 db                	xor    %ebx,%ebx
+{
+ 37b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 37e:	eb 27                	jmp    3a7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 380:	83 ec 04             	sub    $0x4,%esp
+ 383:	6a 01                	push   $0x1
+ 385:	56                   	push   %esi
+ 386:	6a 00                	push   $0x0
+ 388:	e8 cf 02 00 00       	call   65c <read>
+    if(cc < 1)
+ 38d:	83 c4 10             	add    $0x10,%esp
+ 390:	85 c0                	test   %eax,%eax
+ 392:	7e 1d                	jle    3b1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 394:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 39f:	3c 0a                	cmp    $0xa,%al
+ 3a1:	74 10                	je     3b3 <gets+0x43>
+ 3a3:	3c 0d                	cmp    $0xd,%al
+ 3a5:	74 0c                	je     3b3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3a7:	89 df                	mov    %ebx,%edi
+ 3a9:	83 c3 01             	add    $0x1,%ebx
+ 3ac:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3af:	7c cf                	jl     380 <gets+0x10>
+ 3b1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bd:	5b                   	pop    %ebx
+ 3be:	5e                   	pop    %esi
+ 3bf:	5f                   	pop    %edi
+ 3c0:	5d                   	pop    %ebp
+ 3c1:	c3                   	ret
+ 3c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000003d0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 3d0:	55                   	push   %ebp
+ 3d1:	89 e5                	mov    %esp,%ebp
+ 3d3:	56                   	push   %esi
+ 3d4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 3d5:	83 ec 08             	sub    $0x8,%esp
+ 3d8:	6a 00                	push   $0x0
+ 3da:	ff 75 08             	push   0x8(%ebp)
+ 3dd:	e8 a2 02 00 00       	call   684 <open>
+  if(fd < 0)
+ 3e2:	83 c4 10             	add    $0x10,%esp
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	78 27                	js     410 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 3e9:	83 ec 08             	sub    $0x8,%esp
+ 3ec:	ff 75 0c             	push   0xc(%ebp)
+ 3ef:	89 c3                	mov    %eax,%ebx
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 a5 02 00 00       	call   69c <fstat>
+  close(fd);
+ 3f7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 3fa:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 3fc:	e8 6b 02 00 00       	call   66c <close>
+  return r;
+ 401:	83 c4 10             	add    $0x10,%esp
+}
+ 404:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 407:	89 f0                	mov    %esi,%eax
+ 409:	5b                   	pop    %ebx
+ 40a:	5e                   	pop    %esi
+ 40b:	5d                   	pop    %ebp
+ 40c:	c3                   	ret
+ 40d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 410:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 415:	eb ed                	jmp    404 <stat+0x34>
+ 417:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	53                   	push   %ebx
+ 424:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 427:	0f be 02             	movsbl (%edx),%eax
+ 42a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 42d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 435:	77 1e                	ja     455 <atoi+0x35>
+ 437:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 43e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 440:	83 c2 01             	add    $0x1,%edx
+ 443:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 446:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 44a:	0f be 02             	movsbl (%edx),%eax
+ 44d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 450:	80 fb 09             	cmp    $0x9,%bl
+ 453:	76 eb                	jbe    440 <atoi+0x20>
+  return n;
+}
+ 455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 458:	89 c8                	mov    %ecx,%eax
+ 45a:	c9                   	leave
+ 45b:	c3                   	ret
+ 45c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000460 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	57                   	push   %edi
+ 464:	56                   	push   %esi
+ 465:	8b 45 10             	mov    0x10(%ebp),%eax
+ 468:	8b 55 08             	mov    0x8(%ebp),%edx
+ 46b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 46e:	85 c0                	test   %eax,%eax
+ 470:	7e 13                	jle    485 <memmove+0x25>
+ 472:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 474:	89 d7                	mov    %edx,%edi
+ 476:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 47d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 480:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 481:	39 f8                	cmp    %edi,%eax
+ 483:	75 fb                	jne    480 <memmove+0x20>
+  return vdst;
+}
+ 485:	5e                   	pop    %esi
+ 486:	89 d0                	mov    %edx,%eax
+ 488:	5f                   	pop    %edi
+ 489:	5d                   	pop    %ebp
+ 48a:	c3                   	ret
+ 48b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 48f:	90                   	nop
+
+00000490 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 493:	8b 45 08             	mov    0x8(%ebp),%eax
+ 496:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 49c:	5d                   	pop    %ebp
+ 49d:	c3                   	ret
+ 49e:	66 90                	xchg   %ax,%ax
+
+000004a0 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 4a0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 4a1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 4a6:	89 e5                	mov    %esp,%ebp
+ 4a8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4af:	90                   	nop
+ 4b0:	89 c8                	mov    %ecx,%eax
+ 4b2:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 4b5:	85 c0                	test   %eax,%eax
+ 4b7:	75 f7                	jne    4b0 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 4b9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 4be:	5d                   	pop    %ebp
+ 4bf:	c3                   	ret
+
+000004c0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	31 c0                	xor    %eax,%eax
+ 4c3:	89 e5                	mov    %esp,%ebp
+ 4c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 4c8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 4cd:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 4d0:	5d                   	pop    %ebp
+ 4d1:	c3                   	ret
+ 4d2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000004e0 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 4e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4ec:	5d                   	pop    %ebp
+ 4ed:	c3                   	ret
+ 4ee:	66 90                	xchg   %ax,%ax
+
+000004f0 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 4f6:	89 e5                	mov    %esp,%ebp
+ 4f8:	56                   	push   %esi
+ 4f9:	53                   	push   %ebx
+ 4fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 4fd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 500:	85 c0                	test   %eax,%eax
+ 502:	74 2d                	je     531 <mutex_lock+0x41>
+ 504:	b8 02 00 00 00       	mov    $0x2,%eax
+ 509:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 50c:	85 c0                	test   %eax,%eax
+ 50e:	74 21                	je     531 <mutex_lock+0x41>
+ 510:	be 02 00 00 00       	mov    $0x2,%esi
+ 515:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 518:	83 ec 04             	sub    $0x4,%esp
+ 51b:	6a 02                	push   $0x2
+ 51d:	6a 00                	push   $0x0
+ 51f:	53                   	push   %ebx
+ 520:	e8 37 02 00 00       	call   75c <futex>
+ 525:	89 f0                	mov    %esi,%eax
+ 527:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 52a:	83 c4 10             	add    $0x10,%esp
+ 52d:	85 c0                	test   %eax,%eax
+ 52f:	75 e7                	jne    518 <mutex_lock+0x28>
+}
+ 531:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 534:	5b                   	pop    %ebx
+ 535:	5e                   	pop    %esi
+ 536:	5d                   	pop    %ebp
+ 537:	c3                   	ret
+ 538:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 53f:	90                   	nop
+
+00000540 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 540:	55                   	push   %ebp
+ 541:	31 c0                	xor    %eax,%eax
+ 543:	89 e5                	mov    %esp,%ebp
+ 545:	83 ec 08             	sub    $0x8,%esp
+ 548:	8b 55 08             	mov    0x8(%ebp),%edx
+ 54b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 54e:	83 f8 02             	cmp    $0x2,%eax
+ 551:	74 05                	je     558 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 553:	c9                   	leave
+ 554:	c3                   	ret
+ 555:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 558:	83 ec 04             	sub    $0x4,%esp
+ 55b:	6a 01                	push   $0x1
+ 55d:	6a 01                	push   $0x1
+ 55f:	52                   	push   %edx
+ 560:	e8 f7 01 00 00       	call   75c <futex>
+ 565:	83 c4 10             	add    $0x10,%esp
+}
+ 568:	c9                   	leave
+ 569:	c3                   	ret
+ 56a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000570 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 570:	55                   	push   %ebp
+ 571:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 573:	8b 45 08             	mov    0x8(%ebp),%eax
+ 576:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 57c:	5d                   	pop    %ebp
+ 57d:	c3                   	ret
+ 57e:	66 90                	xchg   %ax,%ax
+
+00000580 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 580:	55                   	push   %ebp
+ 581:	31 c0                	xor    %eax,%eax
+ 583:	89 e5                	mov    %esp,%ebp
+ 585:	57                   	push   %edi
+ 586:	56                   	push   %esi
+ 587:	53                   	push   %ebx
+ 588:	83 ec 0c             	sub    $0xc,%esp
+ 58b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 58e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 591:	8b 3e                	mov    (%esi),%edi
+ 593:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 596:	83 f8 02             	cmp    $0x2,%eax
+ 599:	74 4d                	je     5e8 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 59b:	83 ec 04             	sub    $0x4,%esp
+ 59e:	57                   	push   %edi
+ 59f:	6a 00                	push   $0x0
+ 5a1:	56                   	push   %esi
+ 5a2:	e8 b5 01 00 00       	call   75c <futex>
+ 5a7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5ac:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 5af:	83 c4 10             	add    $0x10,%esp
+ 5b2:	85 c0                	test   %eax,%eax
+ 5b4:	74 23                	je     5d9 <cond_wait+0x59>
+ 5b6:	be 02 00 00 00       	mov    $0x2,%esi
+ 5bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5bf:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 5c0:	83 ec 04             	sub    $0x4,%esp
+ 5c3:	6a 02                	push   $0x2
+ 5c5:	6a 00                	push   $0x0
+ 5c7:	53                   	push   %ebx
+ 5c8:	e8 8f 01 00 00       	call   75c <futex>
+ 5cd:	89 f0                	mov    %esi,%eax
+ 5cf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 5d2:	83 c4 10             	add    $0x10,%esp
+ 5d5:	85 c0                	test   %eax,%eax
+ 5d7:	75 e7                	jne    5c0 <cond_wait+0x40>
+}
+ 5d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 5dc:	5b                   	pop    %ebx
+ 5dd:	5e                   	pop    %esi
+ 5de:	5f                   	pop    %edi
+ 5df:	5d                   	pop    %ebp
+ 5e0:	c3                   	ret
+ 5e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 5e8:	83 ec 04             	sub    $0x4,%esp
+ 5eb:	6a 01                	push   $0x1
+ 5ed:	6a 01                	push   $0x1
+ 5ef:	53                   	push   %ebx
+ 5f0:	e8 67 01 00 00       	call   75c <futex>
+ 5f5:	83 c4 10             	add    $0x10,%esp
+ 5f8:	eb a1                	jmp    59b <cond_wait+0x1b>
+ 5fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000600 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 600:	55                   	push   %ebp
+ 601:	89 e5                	mov    %esp,%ebp
+ 603:	83 ec 0c             	sub    $0xc,%esp
+ 606:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 609:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 60d:	6a 01                	push   $0x1
+ 60f:	6a 01                	push   $0x1
+ 611:	50                   	push   %eax
+ 612:	e8 45 01 00 00       	call   75c <futex>
+}
+ 617:	83 c4 10             	add    $0x10,%esp
+ 61a:	c9                   	leave
+ 61b:	c3                   	ret
+ 61c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000620 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 620:	55                   	push   %ebp
+ 621:	89 e5                	mov    %esp,%ebp
+ 623:	83 ec 0c             	sub    $0xc,%esp
+ 626:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 629:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 62d:	6a ff                	push   $0xffffffff
+ 62f:	6a 01                	push   $0x1
+ 631:	50                   	push   %eax
+ 632:	e8 25 01 00 00       	call   75c <futex>
+}
+ 637:	83 c4 10             	add    $0x10,%esp
+ 63a:	c9                   	leave
+ 63b:	c3                   	ret
+
+0000063c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 63c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <exit>:
+SYSCALL(exit)
+ 644:	b8 02 00 00 00       	mov    $0x2,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <wait>:
+SYSCALL(wait)
+ 64c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <pipe>:
+SYSCALL(pipe)
+ 654:	b8 04 00 00 00       	mov    $0x4,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <read>:
+SYSCALL(read)
+ 65c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <write>:
+SYSCALL(write)
+ 664:	b8 10 00 00 00       	mov    $0x10,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <close>:
+SYSCALL(close)
+ 66c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <kill>:
+SYSCALL(kill)
+ 674:	b8 06 00 00 00       	mov    $0x6,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <exec>:
+SYSCALL(exec)
+ 67c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <open>:
+SYSCALL(open)
+ 684:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <mknod>:
+SYSCALL(mknod)
+ 68c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <unlink>:
+SYSCALL(unlink)
+ 694:	b8 12 00 00 00       	mov    $0x12,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <fstat>:
+SYSCALL(fstat)
+ 69c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <link>:
+SYSCALL(link)
+ 6a4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <mkdir>:
+SYSCALL(mkdir)
+ 6ac:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <chdir>:
+SYSCALL(chdir)
+ 6b4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <dup>:
+SYSCALL(dup)
+ 6bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <getpid>:
+SYSCALL(getpid)
+ 6c4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <sbrk>:
+SYSCALL(sbrk)
+ 6cc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <sleep>:
+SYSCALL(sleep)
+ 6d4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <uptime>:
+SYSCALL(uptime)
+ 6dc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 6e4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 6ec:	b8 19 00 00 00       	mov    $0x19,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <wmap>:
+SYSCALL(wmap)
+ 6f4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <wunmap>:
+SYSCALL(wunmap)
+ 6fc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <wremap>:
+SYSCALL(wremap)
+ 704:	b8 18 00 00 00       	mov    $0x18,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <wmlock>:
+SYSCALL(wmlock)
+ 70c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <wmunlock>:
+SYSCALL(wmunlock)
+ 714:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <wmapoff>:
+SYSCALL(wmapoff)
+ 71c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 724:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <setpriority>:
+SYSCALL(setpriority)
+ 72c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 734:	b8 20 00 00 00       	mov    $0x20,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <settickets>:
+SYSCALL(settickets)
+ 73c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 744:	b8 22 00 00 00       	mov    $0x22,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <clone>:
+SYSCALL(clone)
+ 74c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <join>:
+SYSCALL(join)
+ 754:	b8 24 00 00 00       	mov    $0x24,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <futex>:
+SYSCALL(futex)
+ 75c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <setaffinity>:
+SYSCALL(setaffinity)
+ 764:	b8 26 00 00 00       	mov    $0x26,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <getaffinity>:
+SYSCALL(getaffinity)
+ 76c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 771:	cd 40                	int    $0x40
+ 773:	c3                   	ret
+
+00000774 <bcstat>:
+SYSCALL(bcstat)
+ 774:	b8 29 00 00 00       	mov    $0x29,%eax
+ 779:	cd 40                	int    $0x40
+ 77b:	c3                   	ret
+
+0000077c <dropcache>:
+SYSCALL(dropcache)
+ 77c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 781:	cd 40                	int    $0x40
+ 783:	c3                   	ret
+
+00000784 <setiosched>:
+SYSCALL(setiosched)
+ 784:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 789:	cd 40                	int    $0x40
+ 78b:	c3                   	ret
+
+0000078c <iostat>:
+SYSCALL(iostat)
+ 78c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 791:	cd 40                	int    $0x40
+ 793:	c3                   	ret
+
+00000794 <fsync>:
+SYSCALL(fsync)
+ 794:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 79c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 79d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 7a2:	cd 40                	int    $0x40
+ 7a4:	ff e1                	jmp    *%ecx
+ 7a6:	66 90                	xchg   %ax,%ax
+ 7a8:	66 90                	xchg   %ax,%ax
+ 7aa:	66 90                	xchg   %ax,%ax
+ 7ac:	66 90                	xchg   %ax,%ax
+ 7ae:	66 90                	xchg   %ax,%ax
+
+000007b0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7b0:	55                   	push   %ebp
+ 7b1:	89 e5                	mov    %esp,%ebp
+ 7b3:	57                   	push   %edi
+ 7b4:	56                   	push   %esi
+ 7b5:	53                   	push   %ebx
+ 7b6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7b8:	89 d1                	mov    %edx,%ecx
+{
+ 7ba:	83 ec 3c             	sub    $0x3c,%esp
+ 7bd:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7c0:	85 d2                	test   %edx,%edx
+ 7c2:	0f 89 80 00 00 00    	jns    848 <printint+0x98>
+ 7c8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7cc:	74 7a                	je     848 <printint+0x98>
+    x = -xx;
+ 7ce:	f7 d9                	neg    %ecx
+    neg = 1;
+ 7d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 7d5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 7d8:	31 f6                	xor    %esi,%esi
+ 7da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 7e0:	89 c8                	mov    %ecx,%eax
+ 7e2:	31 d2                	xor    %edx,%edx
+ 7e4:	89 f7                	mov    %esi,%edi
+ 7e6:	f7 f3                	div    %ebx
+ 7e8:	8d 76 01             	lea    0x1(%esi),%esi
+ 7eb:	0f b6 92 30 0e 00 00 	movzbl 0xe30(%edx),%edx
+ 7f2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 7f6:	89 ca                	mov    %ecx,%edx
+ 7f8:	89 c1                	mov    %eax,%ecx
+ 7fa:	39 da                	cmp    %ebx,%edx
+ 7fc:	73 e2                	jae    7e0 <printint+0x30>
+  if(neg)
+ 7fe:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 801:	85 c0                	test   %eax,%eax
+ 803:	74 07                	je     80c <printint+0x5c>
+    buf[i++] = '-';
+ 805:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 80a:	89 f7                	mov    %esi,%edi
+ 80c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 80f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 812:	01 df                	add    %ebx,%edi
+ 814:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 818:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 81b:	83 ec 04             	sub    $0x4,%esp
+ 81e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 821:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 824:	6a 01                	push   $0x1
+ 826:	50                   	push   %eax
+ 827:	56                   	push   %esi
+ 828:	e8 37 fe ff ff       	call   664 <write>
+  while(--i >= 0)
+ 82d:	89 f8                	mov    %edi,%eax
+ 82f:	83 c4 10             	add    $0x10,%esp
+ 832:	83 ef 01             	sub    $0x1,%edi
+ 835:	39 d8                	cmp    %ebx,%eax
+ 837:	75 df                	jne    818 <printint+0x68>
+}
+ 839:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 83c:	5b                   	pop    %ebx
+ 83d:	5e                   	pop    %esi
+ 83e:	5f                   	pop    %edi
+ 83f:	5d                   	pop    %ebp
+ 840:	c3                   	ret
+ 841:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 848:	31 c0                	xor    %eax,%eax
+ 84a:	eb 89                	jmp    7d5 <printint+0x25>
+ 84c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000850 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 850:	55                   	push   %ebp
+ 851:	89 e5                	mov    %esp,%ebp
+ 853:	57                   	push   %edi
+ 854:	56                   	push   %esi
+ 855:	53                   	push   %ebx
+ 856:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 859:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 85c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 85f:	0f b6 1e             	movzbl (%esi),%ebx
+ 862:	83 c6 01             	add    $0x1,%esi
+ 865:	84 db                	test   %bl,%bl
+ 867:	74 67                	je     8d0 <printf+0x80>
+ 869:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 86c:	31 d2                	xor    %edx,%edx
+ 86e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 871:	eb 34                	jmp    8a7 <printf+0x57>
+ 873:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 877:	90                   	nop
+ 878:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 87b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 880:	83 f8 25             	cmp    $0x25,%eax
+ 883:	74 18                	je     89d <printf+0x4d>
+  write(fd, &c, 1);
+ 885:	83 ec 04             	sub    $0x4,%esp
+ 888:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 88b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 88e:	6a 01                	push   $0x1
+ 890:	50                   	push   %eax
+ 891:	57                   	push   %edi
+ 892:	e8 cd fd ff ff       	call   664 <write>
+ 897:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 89a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 89d:	0f b6 1e             	movzbl (%esi),%ebx
+ 8a0:	83 c6 01             	add    $0x1,%esi
+ 8a3:	84 db                	test   %bl,%bl
+ 8a5:	74 29                	je     8d0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8a7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8aa:	85 d2                	test   %edx,%edx
+ 8ac:	74 ca                	je     878 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8ae:	83 fa 25             	cmp    $0x25,%edx
+ 8b1:	75 ea                	jne    89d <printf+0x4d>
+      if(c == 'd'){
+ 8b3:	83 f8 25             	cmp    $0x25,%eax
+ 8b6:	0f 84 24 01 00 00    	je     9e0 <printf+0x190>
+ 8bc:	83 e8 63             	sub    $0x63,%eax
+ 8bf:	83 f8 15             	cmp    $0x15,%eax
+ 8c2:	77 1c                	ja     8e0 <printf+0x90>
+ 8c4:	ff 24 85 d8 0d 00 00 	jmp    *0xdd8(,%eax,4)
+ 8cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8cf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 8d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 8d3:	5b                   	pop    %ebx
+ 8d4:	5e                   	pop    %esi
+ 8d5:	5f                   	pop    %edi
+ 8d6:	5d                   	pop    %ebp
+ 8d7:	c3                   	ret
+ 8d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8df:	90                   	nop
+  write(fd, &c, 1);
+ 8e0:	83 ec 04             	sub    $0x4,%esp
+ 8e3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 8e6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 8ea:	6a 01                	push   $0x1
+ 8ec:	52                   	push   %edx
+ 8ed:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 8f0:	57                   	push   %edi
+ 8f1:	e8 6e fd ff ff       	call   664 <write>
+ 8f6:	83 c4 0c             	add    $0xc,%esp
+ 8f9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8fc:	6a 01                	push   $0x1
+ 8fe:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 901:	52                   	push   %edx
+ 902:	57                   	push   %edi
+ 903:	e8 5c fd ff ff       	call   664 <write>
+        putc(fd, c);
+ 908:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 90b:	31 d2                	xor    %edx,%edx
+ 90d:	eb 8e                	jmp    89d <printf+0x4d>
+ 90f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 910:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 913:	83 ec 0c             	sub    $0xc,%esp
+ 916:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 91b:	8b 13                	mov    (%ebx),%edx
+ 91d:	6a 00                	push   $0x0
+ 91f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 921:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 924:	e8 87 fe ff ff       	call   7b0 <printint>
+        ap++;
+ 929:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 92c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 92f:	31 d2                	xor    %edx,%edx
+ 931:	e9 67 ff ff ff       	jmp    89d <printf+0x4d>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 940:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 943:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 945:	83 c0 04             	add    $0x4,%eax
+ 948:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 94b:	85 db                	test   %ebx,%ebx
+ 94d:	0f 84 9d 00 00 00    	je     9f0 <printf+0x1a0>
+        while(*s != 0){
+ 953:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 956:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 958:	84 c0                	test   %al,%al
+ 95a:	0f 84 3d ff ff ff    	je     89d <printf+0x4d>
+ 960:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 963:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 966:	89 de                	mov    %ebx,%esi
+ 968:	89 d3                	mov    %edx,%ebx
+ 96a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 970:	83 ec 04             	sub    $0x4,%esp
+ 973:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 976:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 979:	6a 01                	push   $0x1
+ 97b:	53                   	push   %ebx
+ 97c:	57                   	push   %edi
+ 97d:	e8 e2 fc ff ff       	call   664 <write>
+        while(*s != 0){
+ 982:	0f b6 06             	movzbl (%esi),%eax
+ 985:	83 c4 10             	add    $0x10,%esp
+ 988:	84 c0                	test   %al,%al
+ 98a:	75 e4                	jne    970 <printf+0x120>
+      state = 0;
+ 98c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 98f:	31 d2                	xor    %edx,%edx
+ 991:	e9 07 ff ff ff       	jmp    89d <printf+0x4d>
+ 996:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 99d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9a0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9a3:	83 ec 0c             	sub    $0xc,%esp
+ 9a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9ab:	8b 13                	mov    (%ebx),%edx
+ 9ad:	6a 01                	push   $0x1
+ 9af:	e9 6b ff ff ff       	jmp    91f <printf+0xcf>
+ 9b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9b8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9bb:	83 ec 04             	sub    $0x4,%esp
+ 9be:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9c1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9c3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9c6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9c9:	6a 01                	push   $0x1
+ 9cb:	52                   	push   %edx
+ 9cc:	57                   	push   %edi
+ 9cd:	e8 92 fc ff ff       	call   664 <write>
+        ap++;
+ 9d2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 9d5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 9d8:	31 d2                	xor    %edx,%edx
+ 9da:	e9 be fe ff ff       	jmp    89d <printf+0x4d>
+ 9df:	90                   	nop
+  write(fd, &c, 1);
+ 9e0:	83 ec 04             	sub    $0x4,%esp
+ 9e3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 9e6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 9e9:	6a 01                	push   $0x1
+ 9eb:	e9 11 ff ff ff       	jmp    901 <printf+0xb1>
+ 9f0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 9f5:	bb cf 0d 00 00       	mov    $0xdcf,%ebx
+ 9fa:	e9 61 ff ff ff       	jmp    960 <printf+0x110>
+ 9ff:	90                   	nop
+
+00000a00 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a00:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a01:	a1 00 13 00 00       	mov    0x1300,%eax
+{
+ a06:	89 e5                	mov    %esp,%ebp
+ a08:	57                   	push   %edi
+ a09:	56                   	push   %esi
+ a0a:	53                   	push   %ebx
+ a0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a0e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a18:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a1a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a1c:	39 ca                	cmp    %ecx,%edx
+ a1e:	73 30                	jae    a50 <free+0x50>
+ a20:	39 c1                	cmp    %eax,%ecx
+ a22:	72 04                	jb     a28 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a24:	39 c2                	cmp    %eax,%edx
+ a26:	72 f0                	jb     a18 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a28:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a2b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a2e:	39 f8                	cmp    %edi,%eax
+ a30:	74 2e                	je     a60 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a32:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a35:	8b 42 04             	mov    0x4(%edx),%eax
+ a38:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a3b:	39 f1                	cmp    %esi,%ecx
+ a3d:	74 38                	je     a77 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a3f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a41:	5b                   	pop    %ebx
+  freep = p;
+ a42:	89 15 00 13 00 00    	mov    %edx,0x1300
+}
+ a48:	5e                   	pop    %esi
+ a49:	5f                   	pop    %edi
+ a4a:	5d                   	pop    %ebp
+ a4b:	c3                   	ret
+ a4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a50:	39 c1                	cmp    %eax,%ecx
+ a52:	72 d0                	jb     a24 <free+0x24>
+ a54:	eb c2                	jmp    a18 <free+0x18>
+ a56:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a5d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a60:	03 70 04             	add    0x4(%eax),%esi
+ a63:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a66:	8b 02                	mov    (%edx),%eax
+ a68:	8b 00                	mov    (%eax),%eax
+ a6a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a6d:	8b 42 04             	mov    0x4(%edx),%eax
+ a70:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a73:	39 f1                	cmp    %esi,%ecx
+ a75:	75 c8                	jne    a3f <free+0x3f>
+    p->s.size += bp->s.size;
+ a77:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a7a:	89 15 00 13 00 00    	mov    %edx,0x1300
+    p->s.size += bp->s.size;
+ a80:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a83:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a86:	89 0a                	mov    %ecx,(%edx)
+}
+ a88:	5b                   	pop    %ebx
+ a89:	5e                   	pop    %esi
+ a8a:	5f                   	pop    %edi
+ a8b:	5d                   	pop    %ebp
+ a8c:	c3                   	ret
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a90 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	57                   	push   %edi
+ a94:	56                   	push   %esi
+ a95:	53                   	push   %ebx
+ a96:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a99:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a9c:	8b 15 00 13 00 00    	mov    0x1300,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ aa2:	8d 78 07             	lea    0x7(%eax),%edi
+ aa5:	c1 ef 03             	shr    $0x3,%edi
+ aa8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ aab:	85 d2                	test   %edx,%edx
+ aad:	0f 84 8d 00 00 00    	je     b40 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ab3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ab5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ab8:	39 f9                	cmp    %edi,%ecx
+ aba:	73 64                	jae    b20 <malloc+0x90>
+  if(nu < 4096)
+ abc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ ac1:	39 df                	cmp    %ebx,%edi
+ ac3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ ac6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ acd:	eb 0a                	jmp    ad9 <malloc+0x49>
+ acf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ad0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ad2:	8b 48 04             	mov    0x4(%eax),%ecx
+ ad5:	39 f9                	cmp    %edi,%ecx
+ ad7:	73 47                	jae    b20 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ ad9:	89 c2                	mov    %eax,%edx
+ adb:	39 05 00 13 00 00    	cmp    %eax,0x1300
+ ae1:	75 ed                	jne    ad0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ ae3:	83 ec 0c             	sub    $0xc,%esp
+ ae6:	56                   	push   %esi
+ ae7:	e8 e0 fb ff ff       	call   6cc <sbrk>
+  if(p == (char*)-1)
+ aec:	83 c4 10             	add    $0x10,%esp
+ aef:	83 f8 ff             	cmp    $0xffffffff,%eax
+ af2:	74 1c                	je     b10 <malloc+0x80>
+  hp->s.size = nu;
+ af4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ af7:	83 ec 0c             	sub    $0xc,%esp
+ afa:	83 c0 08             	add    $0x8,%eax
+ afd:	50                   	push   %eax
+ afe:	e8 fd fe ff ff       	call   a00 <free>
+  return freep;
+ b03:	8b 15 00 13 00 00    	mov    0x1300,%edx
+      if((p = morecore(nunits)) == 0)
+ b09:	83 c4 10             	add    $0x10,%esp
+ b0c:	85 d2                	test   %edx,%edx
+ b0e:	75 c0                	jne    ad0 <malloc+0x40>
+        return 0;
+  }
+}
+ b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b13:	31 c0                	xor    %eax,%eax
+}
+ b15:	5b                   	pop    %ebx
+ b16:	5e                   	pop    %esi
+ b17:	5f                   	pop    %edi
+ b18:	5d                   	pop    %ebp
+ b19:	c3                   	ret
+ b1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b20:	39 cf                	cmp    %ecx,%edi
+ b22:	74 4c                	je     b70 <malloc+0xe0>
+        p->s.size -= nunits;
+ b24:	29 f9                	sub    %edi,%ecx
+ b26:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b29:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b2c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b2f:	89 15 00 13 00 00    	mov    %edx,0x1300
+}
+ b35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b38:	83 c0 08             	add    $0x8,%eax
+}
+ b3b:	5b                   	pop    %ebx
+ b3c:	5e                   	pop    %esi
+ b3d:	5f                   	pop    %edi
+ b3e:	5d                   	pop    %ebp
+ b3f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b40:	c7 05 00 13 00 00 04 	movl   $0x1304,0x1300
+ b47:	13 00 00 
+    base.s.size = 0;
+ b4a:	b8 04 13 00 00       	mov    $0x1304,%eax
+    base.s.ptr = freep = prevp = &base;
+ b4f:	c7 05 04 13 00 00 04 	movl   $0x1304,0x1304
+ b56:	13 00 00 
+    base.s.size = 0;
+ b59:	c7 05 08 13 00 00 00 	movl   $0x0,0x1308
+ b60:	00 00 00 
+    if(p->s.size >= nunits){
+ b63:	e9 54 ff ff ff       	jmp    abc <malloc+0x2c>
+ b68:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b6f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b70:	8b 08                	mov    (%eax),%ecx
+ b72:	89 0a                	mov    %ecx,(%edx)
+ b74:	eb b9                	jmp    b2f <malloc+0x9f>
+ b76:	66 90                	xchg   %ax,%ax
+ b78:	66 90                	xchg   %ax,%ax
+ b7a:	66 90                	xchg   %ax,%ax
+ b7c:	66 90                	xchg   %ax,%ax
+ b7e:	66 90                	xchg   %ax,%ax
+
+00000b80 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ b80:	55                   	push   %ebp
+ b81:	89 e5                	mov    %esp,%ebp
+ b83:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ b86:	8b 45 08             	mov    0x8(%ebp),%eax
+ b89:	c1 e0 04             	shl    $0x4,%eax
+ b8c:	ff b0 4c 13 00 00    	push   0x134c(%eax)
+ b92:	05 40 13 00 00       	add    $0x1340,%eax
+ b97:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ b9a:	e8 a5 fa ff ff       	call   644 <exit>
+ b9f:	90                   	nop
+
+00000ba0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ ba0:	55                   	push   %ebp
+ ba1:	89 e5                	mov    %esp,%ebp
+ ba3:	57                   	push   %edi
+ ba4:	56                   	push   %esi
+ ba5:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ ba6:	31 db                	xor    %ebx,%ebx
+{
+ ba8:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ bab:	68 20 13 00 00       	push   $0x1320
+ bb0:	e8 eb f8 ff ff       	call   4a0 <lock_acquire>
+ bb5:	83 c4 10             	add    $0x10,%esp
+ bb8:	eb 12                	jmp    bcc <thread_create+0x2c>
+ bba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ bc0:	83 c3 01             	add    $0x1,%ebx
+ bc3:	83 fb 40             	cmp    $0x40,%ebx
+ bc6:	0f 84 c4 00 00 00    	je     c90 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ bcc:	89 de                	mov    %ebx,%esi
+ bce:	c1 e6 04             	shl    $0x4,%esi
+ bd1:	8b 96 40 13 00 00    	mov    0x1340(%esi),%edx
+ bd7:	85 d2                	test   %edx,%edx
+ bd9:	75 e5                	jne    bc0 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ bdb:	83 ec 0c             	sub    $0xc,%esp
+ bde:	68 00 20 00 00       	push   $0x2000
+ be3:	e8 a8 fe ff ff       	call   a90 <malloc>
+ be8:	83 c4 10             	add    $0x10,%esp
+ beb:	85 c0                	test   %eax,%eax
+ bed:	0f 84 9d 00 00 00    	je     c90 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ bf3:	89 86 44 13 00 00    	mov    %eax,0x1344(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ bf9:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ bfe:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ c01:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ c06:	89 86 40 13 00 00    	mov    %eax,0x1340(%esi)
+  threads[i].fn = fn;
+ c0c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c0f:	89 86 48 13 00 00    	mov    %eax,0x1348(%esi)
+  threads[i].arg = arg;
+ c15:	8b 45 0c             	mov    0xc(%ebp),%eax
+ c18:	89 86 4c 13 00 00    	mov    %eax,0x134c(%esi)
+  lock_release(&threadslock);
+ c1e:	68 20 13 00 00       	push   $0x1320
+ c23:	e8 98 f8 ff ff       	call   4c0 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ c28:	83 c4 0c             	add    $0xc,%esp
+ c2b:	ff b6 40 13 00 00    	push   0x1340(%esi)
+ c31:	53                   	push   %ebx
+ c32:	68 80 0b 00 00       	push   $0xb80
+ c37:	e8 10 fb ff ff       	call   74c <clone>
+ c3c:	83 c4 10             	add    $0x10,%esp
+ c3f:	85 c0                	test   %eax,%eax
+ c41:	78 0d                	js     c50 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ c43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c46:	5b                   	pop    %ebx
+ c47:	5e                   	pop    %esi
+ c48:	5f                   	pop    %edi
+ c49:	5d                   	pop    %ebp
+ c4a:	c3                   	ret
+ c4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c4f:	90                   	nop
+    lock_acquire(&threadslock);
+ c50:	83 ec 0c             	sub    $0xc,%esp
+ c53:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ c56:	68 20 13 00 00       	push   $0x1320
+ c5b:	e8 40 f8 ff ff       	call   4a0 <lock_acquire>
+    free(threads[i].block);
+ c60:	58                   	pop    %eax
+ c61:	ff b6 44 13 00 00    	push   0x1344(%esi)
+ c67:	e8 94 fd ff ff       	call   a00 <free>
+    threads[i].stack = 0;
+ c6c:	c7 86 40 13 00 00 00 	movl   $0x0,0x1340(%esi)
+ c73:	00 00 00 
+    lock_release(&threadslock);
+ c76:	c7 04 24 20 13 00 00 	movl   $0x1320,(%esp)
+ c7d:	e8 3e f8 ff ff       	call   4c0 <lock_release>
+ c82:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c85:	83 c4 10             	add    $0x10,%esp
+}
+ c88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c8b:	5b                   	pop    %ebx
+ c8c:	5e                   	pop    %esi
+ c8d:	5f                   	pop    %edi
+ c8e:	5d                   	pop    %ebp
+ c8f:	c3                   	ret
+    lock_release(&threadslock);
+ c90:	83 ec 0c             	sub    $0xc,%esp
+ c93:	68 20 13 00 00       	push   $0x1320
+ c98:	e8 23 f8 ff ff       	call   4c0 <lock_release>
+    return -1;
+ c9d:	83 c4 10             	add    $0x10,%esp
+ ca0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ ca5:	eb 9c                	jmp    c43 <thread_create+0xa3>
+ ca7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cae:	66 90                	xchg   %ax,%ax
+
+00000cb0 <thread_join>:
+
+int
+thread_join(void)
+{
+ cb0:	55                   	push   %ebp
+ cb1:	89 e5                	mov    %esp,%ebp
+ cb3:	56                   	push   %esi
+ cb4:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ cb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ cb8:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ cbb:	50                   	push   %eax
+ cbc:	e8 93 fa ff ff       	call   754 <join>
+ cc1:	83 c4 10             	add    $0x10,%esp
+ cc4:	85 c0                	test   %eax,%eax
+ cc6:	78 69                	js     d31 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ cc8:	83 ec 0c             	sub    $0xc,%esp
+ ccb:	89 c6                	mov    %eax,%esi
+ ccd:	68 20 13 00 00       	push   $0x1320
+ cd2:	e8 c9 f7 ff ff       	call   4a0 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ cd7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ cda:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ cdd:	31 c0                	xor    %eax,%eax
+ cdf:	eb 0f                	jmp    cf0 <thread_join+0x40>
+ ce1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ce8:	83 c0 01             	add    $0x1,%eax
+ ceb:	83 f8 40             	cmp    $0x40,%eax
+ cee:	74 28                	je     d18 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ cf0:	89 c3                	mov    %eax,%ebx
+ cf2:	c1 e3 04             	shl    $0x4,%ebx
+ cf5:	39 93 40 13 00 00    	cmp    %edx,0x1340(%ebx)
+ cfb:	75 eb                	jne    ce8 <thread_join+0x38>
+      free(threads[i].block);
+ cfd:	83 ec 0c             	sub    $0xc,%esp
+ d00:	ff b3 44 13 00 00    	push   0x1344(%ebx)
+ d06:	e8 f5 fc ff ff       	call   a00 <free>
+      threads[i].stack = 0;
+      break;
+ d0b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ d0e:	c7 83 40 13 00 00 00 	movl   $0x0,0x1340(%ebx)
+ d15:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ d18:	83 ec 0c             	sub    $0xc,%esp
+ d1b:	68 20 13 00 00       	push   $0x1320
+ d20:	e8 9b f7 ff ff       	call   4c0 <lock_release>
+  return pid;
+ d25:	83 c4 10             	add    $0x10,%esp
+}
+ d28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d2b:	89 f0                	mov    %esi,%eax
+ d2d:	5b                   	pop    %ebx
+ d2e:	5e                   	pop    %esi
+ d2f:	5d                   	pop    %ebp
+ d30:	c3                   	ret
+    return -1;
+ d31:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ d36:	eb f0                	jmp    d28 <thread_join+0x78>
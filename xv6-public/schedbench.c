@@ -0,0 +1,77 @@
+// Scheduler scaling benchmark.
+// Runs N pairs of processes that ping-pong a byte over two pipes,
+// so every round trip costs two sleeps, two wakeups and two context
+// switches.  Prints aggregate switches per second; compare the
+// figure under make qemu CPUS=1, 2, 4 and 8.
+//
+// usage: schedbench [pairs [rounds]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+void
+pingpong(int rfd, int wfd, int rounds, int first)
+{
+  char c;
+  int i;
+
+  c = 0;
+  for(i = 0; i < rounds; i++){
+    if(first && write(wfd, &c, 1) != 1)
+      break;
+    if(read(rfd, &c, 1) != 1)
+      break;
+    if(!first && write(wfd, &c, 1) != 1)
+      break;
+  }
+}
+
+int
+main(int argc, char *argv[])
+{
+  int pairs, rounds, i, start, elapsed;
+  int ab[2], ba[2];
+
+  pairs = 4;
+  rounds = 2000;
+  if(argc > 1)
+    pairs = atoi(argv[1]);
+  if(argc > 2)
+    rounds = atoi(argv[2]);
+  if(pairs < 1 || rounds < 1){
+    printf(2, "usage: schedbench [pairs [rounds]]\n");
+    exit();
+  }
+
+  printf(1, "schedbench: %d pairs x %d rounds\n", pairs, rounds);
+  start = uptime();
+  for(i = 0; i < pairs; i++){
+    if(pipe(ab) < 0 || pipe(ba) < 0){
+      printf(2, "schedbench: pipe failed\n");
+      exit();
+    }
+    if(fork() == 0){
+      pingpong(ba[0], ab[1], rounds, 1);
+      exit();
+    }
+    if(fork() == 0){
+      pingpong(ab[0], ba[1], rounds, 0);
+      exit();
+    }
+    close(ab[0]);
+    close(ab[1]);
+    close(ba[0]);
+    close(ba[1]);
+  }
+  for(i = 0; i < 2*pairs; i++)
+    wait();
+  elapsed = uptime() - start;
+  if(elapsed == 0)
+    elapsed = 1;
+
+  // uptime() counts 100Hz timer ticks.
+  printf(1, "schedbench: %d switches in %d ticks, %d switches/sec\n",
+         2*pairs*rounds, elapsed, 2*pairs*rounds*100/elapsed);
+  exit();
+}
@@ -0,0 +1,1991 @@
+
+_seqread:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 58             	sub    $0x58,%esp
+  char *name;
+  int fd, n, tot, start, elapsed;
+  uint cmds, blocks;
+
+  name = scratch;
+  if(argc > 1)
+  14:	83 39 01             	cmpl   $0x1,(%ecx)
+{
+  17:	8b 41 04             	mov    0x4(%ecx),%eax
+  if(argc > 1)
+  1a:	0f 8e e8 00 00 00    	jle    108 <main+0x108>
+    name = argv[1];
+  20:	8b 78 04             	mov    0x4(%eax),%edi
+  else
+    mkscratch();
+  if((fd = open(name, O_RDONLY)) < 0){
+  23:	83 ec 08             	sub    $0x8,%esp
+  26:	6a 00                	push   $0x0
+  28:	57                   	push   %edi
+  29:	e8 f6 05 00 00       	call   624 <open>
+  2e:	83 c4 10             	add    $0x10,%esp
+  31:	89 c6                	mov    %eax,%esi
+  33:	85 c0                	test   %eax,%eax
+  35:	0f 88 ba 00 00 00    	js     f5 <main+0xf5>
+    printf(2, "seqread: cannot open %s\n", name);
+    exit();
+  }
+
+  dropcache();
+  3b:	e8 dc 06 00 00       	call   71c <dropcache>
+  bcstat(&before);
+  40:	83 ec 0c             	sub    $0xc,%esp
+  43:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  start = uptime();
+  tot = 0;
+  46:	31 db                	xor    %ebx,%ebx
+  bcstat(&before);
+  48:	50                   	push   %eax
+  49:	e8 c6 06 00 00       	call   714 <bcstat>
+  start = uptime();
+  4e:	e8 29 06 00 00       	call   67c <uptime>
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  53:	83 c4 10             	add    $0x10,%esp
+  start = uptime();
+  56:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  59:	eb 07                	jmp    62 <main+0x62>
+  5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  5f:	90                   	nop
+    tot += n;
+  60:	01 c3                	add    %eax,%ebx
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  62:	83 ec 04             	sub    $0x4,%esp
+  65:	68 00 10 00 00       	push   $0x1000
+  6a:	68 e0 12 00 00       	push   $0x12e0
+  6f:	56                   	push   %esi
+  70:	e8 87 05 00 00       	call   5fc <read>
+  75:	83 c4 10             	add    $0x10,%esp
+  78:	85 c0                	test   %eax,%eax
+  7a:	7f e4                	jg     60 <main+0x60>
+  elapsed = uptime() - start;
+  7c:	e8 fb 05 00 00       	call   67c <uptime>
+  81:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+  bcstat(&after);
+  84:	83 ec 0c             	sub    $0xc,%esp
+  elapsed = uptime() - start;
+  87:	29 d0                	sub    %edx,%eax
+  89:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  bcstat(&after);
+  8c:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8f:	50                   	push   %eax
+  90:	e8 7f 06 00 00       	call   714 <bcstat>
+  close(fd);
+  95:	89 34 24             	mov    %esi,(%esp)
+  98:	e8 6f 05 00 00       	call   60c <close>
+
+  cmds = after.diskintrs - before.diskintrs;
+  blocks = after.diskblocks - before.diskblocks;
+  9d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmds = after.diskintrs - before.diskintrs;
+  a0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  a3:	2b 4d c0             	sub    -0x40(%ebp),%ecx
+  blocks = after.diskblocks - before.diskblocks;
+  a6:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  cmds = after.diskintrs - before.diskintrs;
+  a9:	89 4d a0             	mov    %ecx,-0x60(%ebp)
+  blocks = after.diskblocks - before.diskblocks;
+  ac:	89 55 9c             	mov    %edx,-0x64(%ebp)
+  printf(1, "seqread: %s: %d bytes in %d ticks\n", name, tot, elapsed);
+  af:	5a                   	pop    %edx
+  b0:	ff 75 a4             	push   -0x5c(%ebp)
+  b3:	53                   	push   %ebx
+  b4:	57                   	push   %edi
+  b5:	68 28 0d 00 00       	push   $0xd28
+  ba:	6a 01                	push   $0x1
+  bc:	e8 2f 07 00 00       	call   7f0 <printf>
+  printf(1, "seqread: %d misses, %d blocks read ahead\n",
+  c1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  c4:	83 c4 20             	add    $0x20,%esp
+  c7:	2b 45 bc             	sub    -0x44(%ebp),%eax
+  ca:	50                   	push   %eax
+  cb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  ce:	2b 45 b4             	sub    -0x4c(%ebp),%eax
+  d1:	50                   	push   %eax
+  d2:	68 4c 0d 00 00       	push   $0xd4c
+  d7:	6a 01                	push   $0x1
+  d9:	e8 12 07 00 00       	call   7f0 <printf>
+         after.misses - before.misses, after.rablocks - before.rablocks);
+  if(cmds > 0)
+  de:	8b 4d a0             	mov    -0x60(%ebp),%ecx
+  e1:	83 c4 10             	add    $0x10,%esp
+  e4:	85 c9                	test   %ecx,%ecx
+  e6:	75 2f                	jne    117 <main+0x117>
+    printf(1, "seqread: %d disk commands for %d blocks, %d.%d blocks each\n",
+           cmds, blocks, blocks / cmds, blocks * 10 / cmds % 10);
+  if(name == scratch)
+  e8:	81 ff d0 12 00 00    	cmp    $0x12d0,%edi
+  ee:	74 59                	je     149 <main+0x149>
+    unlink(scratch);
+  exit();
+  f0:	e8 ef 04 00 00       	call   5e4 <exit>
+    printf(2, "seqread: cannot open %s\n", name);
+  f5:	51                   	push   %ecx
+  f6:	57                   	push   %edi
+  f7:	68 0d 0d 00 00       	push   $0xd0d
+  fc:	6a 02                	push   $0x2
+  fe:	e8 ed 06 00 00       	call   7f0 <printf>
+    exit();
+ 103:	e8 dc 04 00 00       	call   5e4 <exit>
+    mkscratch();
+ 108:	e8 53 00 00 00       	call   160 <mkscratch>
+  name = scratch;
+ 10d:	bf d0 12 00 00       	mov    $0x12d0,%edi
+ 112:	e9 0c ff ff ff       	jmp    23 <main+0x23>
+  blocks = after.diskblocks - before.diskblocks;
+ 117:	8b 5d 9c             	mov    -0x64(%ebp),%ebx
+    printf(1, "seqread: %d disk commands for %d blocks, %d.%d blocks each\n",
+ 11a:	50                   	push   %eax
+           cmds, blocks, blocks / cmds, blocks * 10 / cmds % 10);
+ 11b:	31 d2                	xor    %edx,%edx
+    printf(1, "seqread: %d disk commands for %d blocks, %d.%d blocks each\n",
+ 11d:	50                   	push   %eax
+  blocks = after.diskblocks - before.diskblocks;
+ 11e:	29 f3                	sub    %esi,%ebx
+    printf(1, "seqread: %d disk commands for %d blocks, %d.%d blocks each\n",
+ 120:	be 0a 00 00 00       	mov    $0xa,%esi
+           cmds, blocks, blocks / cmds, blocks * 10 / cmds % 10);
+ 125:	6b c3 0a             	imul   $0xa,%ebx,%eax
+ 128:	f7 f1                	div    %ecx
+    printf(1, "seqread: %d disk commands for %d blocks, %d.%d blocks each\n",
+ 12a:	31 d2                	xor    %edx,%edx
+ 12c:	f7 f6                	div    %esi
+ 12e:	89 d8                	mov    %ebx,%eax
+ 130:	52                   	push   %edx
+ 131:	31 d2                	xor    %edx,%edx
+ 133:	f7 f1                	div    %ecx
+ 135:	50                   	push   %eax
+ 136:	53                   	push   %ebx
+ 137:	51                   	push   %ecx
+ 138:	68 78 0d 00 00       	push   $0xd78
+ 13d:	6a 01                	push   $0x1
+ 13f:	e8 ac 06 00 00       	call   7f0 <printf>
+ 144:	83 c4 20             	add    $0x20,%esp
+ 147:	eb 9f                	jmp    e8 <main+0xe8>
+    unlink(scratch);
+ 149:	83 ec 0c             	sub    $0xc,%esp
+ 14c:	68 d0 12 00 00       	push   $0x12d0
+ 151:	e8 de 04 00 00       	call   634 <unlink>
+ 156:	83 c4 10             	add    $0x10,%esp
+ 159:	eb 95                	jmp    f0 <main+0xf0>
+ 15b:	66 90                	xchg   %ax,%ax
+ 15d:	66 90                	xchg   %ax,%ax
+ 15f:	90                   	nop
+
+00000160 <mkscratch>:
+{
+ 160:	55                   	push   %ebp
+ 161:	89 e5                	mov    %esp,%ebp
+ 163:	56                   	push   %esi
+ 164:	53                   	push   %ebx
+  if((fd = open(scratch, O_CREATE | O_RDWR)) < 0){
+ 165:	83 ec 08             	sub    $0x8,%esp
+ 168:	68 02 02 00 00       	push   $0x202
+ 16d:	68 d0 12 00 00       	push   $0x12d0
+ 172:	e8 ad 04 00 00       	call   624 <open>
+ 177:	83 c4 10             	add    $0x10,%esp
+ 17a:	85 c0                	test   %eax,%eax
+ 17c:	78 58                	js     1d6 <mkscratch+0x76>
+ 17e:	89 c6                	mov    %eax,%esi
+ 180:	bb 80 00 00 00       	mov    $0x80,%ebx
+ 185:	8d 76 00             	lea    0x0(%esi),%esi
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+ 188:	83 ec 04             	sub    $0x4,%esp
+ 18b:	68 00 10 00 00       	push   $0x1000
+ 190:	68 e0 12 00 00       	push   $0x12e0
+ 195:	56                   	push   %esi
+ 196:	e8 69 04 00 00       	call   604 <write>
+ 19b:	83 c4 10             	add    $0x10,%esp
+ 19e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+ 1a3:	75 18                	jne    1bd <mkscratch+0x5d>
+  for(i = 0; i < NBLK; i++){
+ 1a5:	83 eb 01             	sub    $0x1,%ebx
+ 1a8:	75 de                	jne    188 <mkscratch+0x28>
+  close(fd);
+ 1aa:	83 ec 0c             	sub    $0xc,%esp
+ 1ad:	56                   	push   %esi
+ 1ae:	e8 59 04 00 00       	call   60c <close>
+}
+ 1b3:	83 c4 10             	add    $0x10,%esp
+ 1b6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1b9:	5b                   	pop    %ebx
+ 1ba:	5e                   	pop    %esi
+ 1bb:	5d                   	pop    %ebp
+ 1bc:	c3                   	ret
+      printf(2, "seqread: write %s failed\n", scratch);
+ 1bd:	83 ec 04             	sub    $0x4,%esp
+ 1c0:	68 d0 12 00 00       	push   $0x12d0
+ 1c5:	68 f3 0c 00 00       	push   $0xcf3
+ 1ca:	6a 02                	push   $0x2
+ 1cc:	e8 1f 06 00 00       	call   7f0 <printf>
+      exit();
+ 1d1:	e8 0e 04 00 00       	call   5e4 <exit>
+    printf(2, "seqread: create %s failed\n", scratch);
+ 1d6:	50                   	push   %eax
+ 1d7:	68 d0 12 00 00       	push   $0x12d0
+ 1dc:	68 d8 0c 00 00       	push   $0xcd8
+ 1e1:	6a 02                	push   $0x2
+ 1e3:	e8 08 06 00 00       	call   7f0 <printf>
+    exit();
+ 1e8:	e8 f7 03 00 00       	call   5e4 <exit>
+ 1ed:	66 90                	xchg   %ax,%ax
+ 1ef:	90                   	nop
+
+000001f0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 1f0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 1f1:	31 c0                	xor    %eax,%eax
+{
+ 1f3:	89 e5                	mov    %esp,%ebp
+ 1f5:	53                   	push   %ebx
+ 1f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 1fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 200:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 204:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 207:	83 c0 01             	add    $0x1,%eax
+ 20a:	84 d2                	test   %dl,%dl
+ 20c:	75 f2                	jne    200 <strcpy+0x10>
+    ;
+  return os;
+}
+ 20e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 211:	89 c8                	mov    %ecx,%eax
+ 213:	c9                   	leave
+ 214:	c3                   	ret
+ 215:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000220 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 220:	55                   	push   %ebp
+ 221:	89 e5                	mov    %esp,%ebp
+ 223:	53                   	push   %ebx
+ 224:	8b 55 08             	mov    0x8(%ebp),%edx
+ 227:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 22a:	0f b6 02             	movzbl (%edx),%eax
+ 22d:	84 c0                	test   %al,%al
+ 22f:	75 17                	jne    248 <strcmp+0x28>
+ 231:	eb 3a                	jmp    26d <strcmp+0x4d>
+ 233:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 237:	90                   	nop
+ 238:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 23c:	83 c2 01             	add    $0x1,%edx
+ 23f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 242:	84 c0                	test   %al,%al
+ 244:	74 1a                	je     260 <strcmp+0x40>
+    p++, q++;
+ 246:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 248:	0f b6 19             	movzbl (%ecx),%ebx
+ 24b:	38 c3                	cmp    %al,%bl
+ 24d:	74 e9                	je     238 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 24f:	29 d8                	sub    %ebx,%eax
+}
+ 251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 254:	c9                   	leave
+ 255:	c3                   	ret
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 260:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 264:	31 c0                	xor    %eax,%eax
+ 266:	29 d8                	sub    %ebx,%eax
+}
+ 268:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 26b:	c9                   	leave
+ 26c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 26d:	0f b6 19             	movzbl (%ecx),%ebx
+ 270:	31 c0                	xor    %eax,%eax
+ 272:	eb db                	jmp    24f <strcmp+0x2f>
+ 274:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 27b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 27f:	90                   	nop
+
+00000280 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 280:	55                   	push   %ebp
+ 281:	89 e5                	mov    %esp,%ebp
+ 283:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 286:	80 3a 00             	cmpb   $0x0,(%edx)
+ 289:	74 15                	je     2a0 <strlen+0x20>
+ 28b:	31 c0                	xor    %eax,%eax
+ 28d:	8d 76 00             	lea    0x0(%esi),%esi
+ 290:	83 c0 01             	add    $0x1,%eax
+ 293:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 297:	89 c1                	mov    %eax,%ecx
+ 299:	75 f5                	jne    290 <strlen+0x10>
+    ;
+  return n;
+}
+ 29b:	89 c8                	mov    %ecx,%eax
+ 29d:	5d                   	pop    %ebp
+ 29e:	c3                   	ret
+ 29f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 2a0:	31 c9                	xor    %ecx,%ecx
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	89 c8                	mov    %ecx,%eax
+ 2a5:	c3                   	ret
+ 2a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000002b0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	57                   	push   %edi
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 2b7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 2ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bd:	89 d7                	mov    %edx,%edi
+ 2bf:	fc                   	cld
+ 2c0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 2c2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 2c5:	89 d0                	mov    %edx,%eax
+ 2c7:	c9                   	leave
+ 2c8:	c3                   	ret
+ 2c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002d0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	89 e5                	mov    %esp,%ebp
+ 2d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 2da:	0f b6 10             	movzbl (%eax),%edx
+ 2dd:	84 d2                	test   %dl,%dl
+ 2df:	75 12                	jne    2f3 <strchr+0x23>
+ 2e1:	eb 1d                	jmp    300 <strchr+0x30>
+ 2e3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2e7:	90                   	nop
+ 2e8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 2ec:	83 c0 01             	add    $0x1,%eax
+ 2ef:	84 d2                	test   %dl,%dl
+ 2f1:	74 0d                	je     300 <strchr+0x30>
+    if(*s == c)
+ 2f3:	38 d1                	cmp    %dl,%cl
+ 2f5:	75 f1                	jne    2e8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 2f7:	5d                   	pop    %ebp
+ 2f8:	c3                   	ret
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 300:	31 c0                	xor    %eax,%eax
+}
+ 302:	5d                   	pop    %ebp
+ 303:	c3                   	ret
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	57                   	push   %edi
+ 314:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 315:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 318:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 319:	31 db                	xor    %ebx,%ebx
+{
+ 31b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 31e:	eb 27                	jmp    347 <gets+0x37>
+    cc = read(0, &c, 1);
+ 320:	83 ec 04             	sub    $0x4,%esp
+ 323:	6a 01                	push   $0x1
+ 325:	56                   	push   %esi
+ 326:	6a 00                	push   $0x0
+ 328:	e8 cf 02 00 00       	call   5fc <read>
+    if(cc < 1)
+ 32d:	83 c4 10             	add    $0x10,%esp
+ 330:	85 c0                	test   %eax,%eax
+ 332:	7e 1d                	jle    351 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 334:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 338:	8b 55 08             	mov    0x8(%ebp),%edx
+ 33b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 33f:	3c 0a                	cmp    $0xa,%al
+ 341:	74 10                	je     353 <gets+0x43>
+ 343:	3c 0d                	cmp    $0xd,%al
+ 345:	74 0c                	je     353 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 347:	89 df                	mov    %ebx,%edi
+ 349:	83 c3 01             	add    $0x1,%ebx
+ 34c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 34f:	7c cf                	jl     320 <gets+0x10>
+ 351:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 35a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 35d:	5b                   	pop    %ebx
+ 35e:	5e                   	pop    %esi
+ 35f:	5f                   	pop    %edi
+ 360:	5d                   	pop    %ebp
+ 361:	c3                   	ret
+ 362:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 369:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000370 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 370:	55                   	push   %ebp
+ 371:	89 e5                	mov    %esp,%ebp
+ 373:	56                   	push   %esi
+ 374:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 375:	83 ec 08             	sub    $0x8,%esp
+ 378:	6a 00                	push   $0x0
+ 37a:	ff 75 08             	push   0x8(%ebp)
+ 37d:	e8 a2 02 00 00       	call   624 <open>
+  if(fd < 0)
+ 382:	83 c4 10             	add    $0x10,%esp
+ 385:	85 c0                	test   %eax,%eax
+ 387:	78 27                	js     3b0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 389:	83 ec 08             	sub    $0x8,%esp
+ 38c:	ff 75 0c             	push   0xc(%ebp)
+ 38f:	89 c3                	mov    %eax,%ebx
+ 391:	50                   	push   %eax
+ 392:	e8 a5 02 00 00       	call   63c <fstat>
+  close(fd);
+ 397:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 39a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 39c:	e8 6b 02 00 00       	call   60c <close>
+  return r;
+ 3a1:	83 c4 10             	add    $0x10,%esp
+}
+ 3a4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 3a7:	89 f0                	mov    %esi,%eax
+ 3a9:	5b                   	pop    %ebx
+ 3aa:	5e                   	pop    %esi
+ 3ab:	5d                   	pop    %ebp
+ 3ac:	c3                   	ret
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 3b0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 3b5:	eb ed                	jmp    3a4 <stat+0x34>
+ 3b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3be:	66 90                	xchg   %ax,%ax
+
+000003c0 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	53                   	push   %ebx
+ 3c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 3c7:	0f be 02             	movsbl (%edx),%eax
+ 3ca:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 3cd:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 3d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 3d5:	77 1e                	ja     3f5 <atoi+0x35>
+ 3d7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3de:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 3e0:	83 c2 01             	add    $0x1,%edx
+ 3e3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 3e6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 3ea:	0f be 02             	movsbl (%edx),%eax
+ 3ed:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 3f0:	80 fb 09             	cmp    $0x9,%bl
+ 3f3:	76 eb                	jbe    3e0 <atoi+0x20>
+  return n;
+}
+ 3f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3f8:	89 c8                	mov    %ecx,%eax
+ 3fa:	c9                   	leave
+ 3fb:	c3                   	ret
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	57                   	push   %edi
+ 404:	56                   	push   %esi
+ 405:	8b 45 10             	mov    0x10(%ebp),%eax
+ 408:	8b 55 08             	mov    0x8(%ebp),%edx
+ 40b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 40e:	85 c0                	test   %eax,%eax
+ 410:	7e 13                	jle    425 <memmove+0x25>
+ 412:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 414:	89 d7                	mov    %edx,%edi
+ 416:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 41d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 420:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 421:	39 f8                	cmp    %edi,%eax
+ 423:	75 fb                	jne    420 <memmove+0x20>
+  return vdst;
+}
+ 425:	5e                   	pop    %esi
+ 426:	89 d0                	mov    %edx,%eax
+ 428:	5f                   	pop    %edi
+ 429:	5d                   	pop    %ebp
+ 42a:	c3                   	ret
+ 42b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 42f:	90                   	nop
+
+00000430 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 430:	55                   	push   %ebp
+ 431:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 433:	8b 45 08             	mov    0x8(%ebp),%eax
+ 436:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 43c:	5d                   	pop    %ebp
+ 43d:	c3                   	ret
+ 43e:	66 90                	xchg   %ax,%ax
+
+00000440 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 440:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 441:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 446:	89 e5                	mov    %esp,%ebp
+ 448:	8b 55 08             	mov    0x8(%ebp),%edx
+ 44b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 44f:	90                   	nop
+ 450:	89 c8                	mov    %ecx,%eax
+ 452:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 455:	85 c0                	test   %eax,%eax
+ 457:	75 f7                	jne    450 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 459:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 45e:	5d                   	pop    %ebp
+ 45f:	c3                   	ret
+
+00000460 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 460:	55                   	push   %ebp
+ 461:	31 c0                	xor    %eax,%eax
+ 463:	89 e5                	mov    %esp,%ebp
+ 465:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 468:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 46d:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 470:	5d                   	pop    %ebp
+ 471:	c3                   	ret
+ 472:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 479:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000480 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 480:	55                   	push   %ebp
+ 481:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 48c:	5d                   	pop    %ebp
+ 48d:	c3                   	ret
+ 48e:	66 90                	xchg   %ax,%ax
+
+00000490 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 490:	55                   	push   %ebp
+ 491:	b8 01 00 00 00       	mov    $0x1,%eax
+ 496:	89 e5                	mov    %esp,%ebp
+ 498:	56                   	push   %esi
+ 499:	53                   	push   %ebx
+ 49a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 49d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 4a0:	85 c0                	test   %eax,%eax
+ 4a2:	74 2d                	je     4d1 <mutex_lock+0x41>
+ 4a4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4a9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 4ac:	85 c0                	test   %eax,%eax
+ 4ae:	74 21                	je     4d1 <mutex_lock+0x41>
+ 4b0:	be 02 00 00 00       	mov    $0x2,%esi
+ 4b5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 4b8:	83 ec 04             	sub    $0x4,%esp
+ 4bb:	6a 02                	push   $0x2
+ 4bd:	6a 00                	push   $0x0
+ 4bf:	53                   	push   %ebx
+ 4c0:	e8 37 02 00 00       	call   6fc <futex>
+ 4c5:	89 f0                	mov    %esi,%eax
+ 4c7:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 4ca:	83 c4 10             	add    $0x10,%esp
+ 4cd:	85 c0                	test   %eax,%eax
+ 4cf:	75 e7                	jne    4b8 <mutex_lock+0x28>
+}
+ 4d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 4d4:	5b                   	pop    %ebx
+ 4d5:	5e                   	pop    %esi
+ 4d6:	5d                   	pop    %ebp
+ 4d7:	c3                   	ret
+ 4d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+
+000004e0 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 4e0:	55                   	push   %ebp
+ 4e1:	31 c0                	xor    %eax,%eax
+ 4e3:	89 e5                	mov    %esp,%ebp
+ 4e5:	83 ec 08             	sub    $0x8,%esp
+ 4e8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4eb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 4ee:	83 f8 02             	cmp    $0x2,%eax
+ 4f1:	74 05                	je     4f8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 4f3:	c9                   	leave
+ 4f4:	c3                   	ret
+ 4f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 4f8:	83 ec 04             	sub    $0x4,%esp
+ 4fb:	6a 01                	push   $0x1
+ 4fd:	6a 01                	push   $0x1
+ 4ff:	52                   	push   %edx
+ 500:	e8 f7 01 00 00       	call   6fc <futex>
+ 505:	83 c4 10             	add    $0x10,%esp
+}
+ 508:	c9                   	leave
+ 509:	c3                   	ret
+ 50a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000510 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 513:	8b 45 08             	mov    0x8(%ebp),%eax
+ 516:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 51c:	5d                   	pop    %ebp
+ 51d:	c3                   	ret
+ 51e:	66 90                	xchg   %ax,%ax
+
+00000520 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 520:	55                   	push   %ebp
+ 521:	31 c0                	xor    %eax,%eax
+ 523:	89 e5                	mov    %esp,%ebp
+ 525:	57                   	push   %edi
+ 526:	56                   	push   %esi
+ 527:	53                   	push   %ebx
+ 528:	83 ec 0c             	sub    $0xc,%esp
+ 52b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 52e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 531:	8b 3e                	mov    (%esi),%edi
+ 533:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 536:	83 f8 02             	cmp    $0x2,%eax
+ 539:	74 4d                	je     588 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 53b:	83 ec 04             	sub    $0x4,%esp
+ 53e:	57                   	push   %edi
+ 53f:	6a 00                	push   $0x0
+ 541:	56                   	push   %esi
+ 542:	e8 b5 01 00 00       	call   6fc <futex>
+ 547:	b8 02 00 00 00       	mov    $0x2,%eax
+ 54c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 54f:	83 c4 10             	add    $0x10,%esp
+ 552:	85 c0                	test   %eax,%eax
+ 554:	74 23                	je     579 <cond_wait+0x59>
+ 556:	be 02 00 00 00       	mov    $0x2,%esi
+ 55b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 55f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 560:	83 ec 04             	sub    $0x4,%esp
+ 563:	6a 02                	push   $0x2
+ 565:	6a 00                	push   $0x0
+ 567:	53                   	push   %ebx
+ 568:	e8 8f 01 00 00       	call   6fc <futex>
+ 56d:	89 f0                	mov    %esi,%eax
+ 56f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 572:	83 c4 10             	add    $0x10,%esp
+ 575:	85 c0                	test   %eax,%eax
+ 577:	75 e7                	jne    560 <cond_wait+0x40>
+}
+ 579:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 57c:	5b                   	pop    %ebx
+ 57d:	5e                   	pop    %esi
+ 57e:	5f                   	pop    %edi
+ 57f:	5d                   	pop    %ebp
+ 580:	c3                   	ret
+ 581:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 588:	83 ec 04             	sub    $0x4,%esp
+ 58b:	6a 01                	push   $0x1
+ 58d:	6a 01                	push   $0x1
+ 58f:	53                   	push   %ebx
+ 590:	e8 67 01 00 00       	call   6fc <futex>
+ 595:	83 c4 10             	add    $0x10,%esp
+ 598:	eb a1                	jmp    53b <cond_wait+0x1b>
+ 59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005a0 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+ 5a3:	83 ec 0c             	sub    $0xc,%esp
+ 5a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 5a9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 5ad:	6a 01                	push   $0x1
+ 5af:	6a 01                	push   $0x1
+ 5b1:	50                   	push   %eax
+ 5b2:	e8 45 01 00 00       	call   6fc <futex>
+}
+ 5b7:	83 c4 10             	add    $0x10,%esp
+ 5ba:	c9                   	leave
+ 5bb:	c3                   	ret
+ 5bc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000005c0 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+ 5c3:	83 ec 0c             	sub    $0xc,%esp
+ 5c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 5c9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 5cd:	6a ff                	push   $0xffffffff
+ 5cf:	6a 01                	push   $0x1
+ 5d1:	50                   	push   %eax
+ 5d2:	e8 25 01 00 00       	call   6fc <futex>
+}
+ 5d7:	83 c4 10             	add    $0x10,%esp
+ 5da:	c9                   	leave
+ 5db:	c3                   	ret
+
+000005dc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 5dc:	b8 01 00 00 00       	mov    $0x1,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <exit>:
+SYSCALL(exit)
+ 5e4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <wait>:
+SYSCALL(wait)
+ 5ec:	b8 03 00 00 00       	mov    $0x3,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <pipe>:
+SYSCALL(pipe)
+ 5f4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <read>:
+SYSCALL(read)
+ 5fc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <write>:
+SYSCALL(write)
+ 604:	b8 10 00 00 00       	mov    $0x10,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <close>:
+SYSCALL(close)
+ 60c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <kill>:
+SYSCALL(kill)
+ 614:	b8 06 00 00 00       	mov    $0x6,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <exec>:
+SYSCALL(exec)
+ 61c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <open>:
+SYSCALL(open)
+ 624:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <mknod>:
+SYSCALL(mknod)
+ 62c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <unlink>:
+SYSCALL(unlink)
+ 634:	b8 12 00 00 00       	mov    $0x12,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <fstat>:
+SYSCALL(fstat)
+ 63c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <link>:
+SYSCALL(link)
+ 644:	b8 13 00 00 00       	mov    $0x13,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <mkdir>:
+SYSCALL(mkdir)
+ 64c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <chdir>:
+SYSCALL(chdir)
+ 654:	b8 09 00 00 00       	mov    $0x9,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <dup>:
+SYSCALL(dup)
+ 65c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <getpid>:
+SYSCALL(getpid)
+ 664:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <sbrk>:
+SYSCALL(sbrk)
+ 66c:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <sleep>:
+SYSCALL(sleep)
+ 674:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <uptime>:
+SYSCALL(uptime)
+ 67c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 684:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 68c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <wmap>:
+SYSCALL(wmap)
+ 694:	b8 16 00 00 00       	mov    $0x16,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <wunmap>:
+SYSCALL(wunmap)
+ 69c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <wremap>:
+SYSCALL(wremap)
+ 6a4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <wmlock>:
+SYSCALL(wmlock)
+ 6ac:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <wmunlock>:
+SYSCALL(wmunlock)
+ 6b4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <wmapoff>:
+SYSCALL(wmapoff)
+ 6bc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 6c4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <setpriority>:
+SYSCALL(setpriority)
+ 6cc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 6d4:	b8 20 00 00 00       	mov    $0x20,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <settickets>:
+SYSCALL(settickets)
+ 6dc:	b8 21 00 00 00       	mov    $0x21,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 6e4:	b8 22 00 00 00       	mov    $0x22,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <clone>:
+SYSCALL(clone)
+ 6ec:	b8 23 00 00 00       	mov    $0x23,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <join>:
+SYSCALL(join)
+ 6f4:	b8 24 00 00 00       	mov    $0x24,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <futex>:
+SYSCALL(futex)
+ 6fc:	b8 25 00 00 00       	mov    $0x25,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <setaffinity>:
+SYSCALL(setaffinity)
+ 704:	b8 26 00 00 00       	mov    $0x26,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <getaffinity>:
+SYSCALL(getaffinity)
+ 70c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <bcstat>:
+SYSCALL(bcstat)
+ 714:	b8 29 00 00 00       	mov    $0x29,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <dropcache>:
+SYSCALL(dropcache)
+ 71c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <setiosched>:
+SYSCALL(setiosched)
+ 724:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <iostat>:
+SYSCALL(iostat)
+ 72c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <fsync>:
+SYSCALL(fsync)
+ 734:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 73c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 73d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 742:	cd 40                	int    $0x40
+ 744:	ff e1                	jmp    *%ecx
+ 746:	66 90                	xchg   %ax,%ax
+ 748:	66 90                	xchg   %ax,%ax
+ 74a:	66 90                	xchg   %ax,%ax
+ 74c:	66 90                	xchg   %ax,%ax
+ 74e:	66 90                	xchg   %ax,%ax
+
+00000750 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 750:	55                   	push   %ebp
+ 751:	89 e5                	mov    %esp,%ebp
+ 753:	57                   	push   %edi
+ 754:	56                   	push   %esi
+ 755:	53                   	push   %ebx
+ 756:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 758:	89 d1                	mov    %edx,%ecx
+{
+ 75a:	83 ec 3c             	sub    $0x3c,%esp
+ 75d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 760:	85 d2                	test   %edx,%edx
+ 762:	0f 89 80 00 00 00    	jns    7e8 <printint+0x98>
+ 768:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 76c:	74 7a                	je     7e8 <printint+0x98>
+    x = -xx;
+ 76e:	f7 d9                	neg    %ecx
+    neg = 1;
+ 770:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 775:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 778:	31 f6                	xor    %esi,%esi
+ 77a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 780:	89 c8                	mov    %ecx,%eax
+ 782:	31 d2                	xor    %edx,%edx
+ 784:	89 f7                	mov    %esi,%edi
+ 786:	f7 f3                	div    %ebx
+ 788:	8d 76 01             	lea    0x1(%esi),%esi
+ 78b:	0f b6 92 14 0e 00 00 	movzbl 0xe14(%edx),%edx
+ 792:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 796:	89 ca                	mov    %ecx,%edx
+ 798:	89 c1                	mov    %eax,%ecx
+ 79a:	39 da                	cmp    %ebx,%edx
+ 79c:	73 e2                	jae    780 <printint+0x30>
+  if(neg)
+ 79e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 7a1:	85 c0                	test   %eax,%eax
+ 7a3:	74 07                	je     7ac <printint+0x5c>
+    buf[i++] = '-';
+ 7a5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 7aa:	89 f7                	mov    %esi,%edi
+ 7ac:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 7af:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 7b2:	01 df                	add    %ebx,%edi
+ 7b4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 7b8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 7bb:	83 ec 04             	sub    $0x4,%esp
+ 7be:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 7c1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 7c4:	6a 01                	push   $0x1
+ 7c6:	50                   	push   %eax
+ 7c7:	56                   	push   %esi
+ 7c8:	e8 37 fe ff ff       	call   604 <write>
+  while(--i >= 0)
+ 7cd:	89 f8                	mov    %edi,%eax
+ 7cf:	83 c4 10             	add    $0x10,%esp
+ 7d2:	83 ef 01             	sub    $0x1,%edi
+ 7d5:	39 d8                	cmp    %ebx,%eax
+ 7d7:	75 df                	jne    7b8 <printint+0x68>
+}
+ 7d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 7dc:	5b                   	pop    %ebx
+ 7dd:	5e                   	pop    %esi
+ 7de:	5f                   	pop    %edi
+ 7df:	5d                   	pop    %ebp
+ 7e0:	c3                   	ret
+ 7e1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 7e8:	31 c0                	xor    %eax,%eax
+ 7ea:	eb 89                	jmp    775 <printint+0x25>
+ 7ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000007f0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 7f0:	55                   	push   %ebp
+ 7f1:	89 e5                	mov    %esp,%ebp
+ 7f3:	57                   	push   %edi
+ 7f4:	56                   	push   %esi
+ 7f5:	53                   	push   %ebx
+ 7f6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 7f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 7fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 7ff:	0f b6 1e             	movzbl (%esi),%ebx
+ 802:	83 c6 01             	add    $0x1,%esi
+ 805:	84 db                	test   %bl,%bl
+ 807:	74 67                	je     870 <printf+0x80>
+ 809:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 80c:	31 d2                	xor    %edx,%edx
+ 80e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 811:	eb 34                	jmp    847 <printf+0x57>
+ 813:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 817:	90                   	nop
+ 818:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 81b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 820:	83 f8 25             	cmp    $0x25,%eax
+ 823:	74 18                	je     83d <printf+0x4d>
+  write(fd, &c, 1);
+ 825:	83 ec 04             	sub    $0x4,%esp
+ 828:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 82b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 82e:	6a 01                	push   $0x1
+ 830:	50                   	push   %eax
+ 831:	57                   	push   %edi
+ 832:	e8 cd fd ff ff       	call   604 <write>
+ 837:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 83a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 83d:	0f b6 1e             	movzbl (%esi),%ebx
+ 840:	83 c6 01             	add    $0x1,%esi
+ 843:	84 db                	test   %bl,%bl
+ 845:	74 29                	je     870 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 847:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 84a:	85 d2                	test   %edx,%edx
+ 84c:	74 ca                	je     818 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 84e:	83 fa 25             	cmp    $0x25,%edx
+ 851:	75 ea                	jne    83d <printf+0x4d>
+      if(c == 'd'){
+ 853:	83 f8 25             	cmp    $0x25,%eax
+ 856:	0f 84 24 01 00 00    	je     980 <printf+0x190>
+ 85c:	83 e8 63             	sub    $0x63,%eax
+ 85f:	83 f8 15             	cmp    $0x15,%eax
+ 862:	77 1c                	ja     880 <printf+0x90>
+ 864:	ff 24 85 bc 0d 00 00 	jmp    *0xdbc(,%eax,4)
+ 86b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 86f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 870:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 873:	5b                   	pop    %ebx
+ 874:	5e                   	pop    %esi
+ 875:	5f                   	pop    %edi
+ 876:	5d                   	pop    %ebp
+ 877:	c3                   	ret
+ 878:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 87f:	90                   	nop
+  write(fd, &c, 1);
+ 880:	83 ec 04             	sub    $0x4,%esp
+ 883:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 886:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 88a:	6a 01                	push   $0x1
+ 88c:	52                   	push   %edx
+ 88d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 890:	57                   	push   %edi
+ 891:	e8 6e fd ff ff       	call   604 <write>
+ 896:	83 c4 0c             	add    $0xc,%esp
+ 899:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 89c:	6a 01                	push   $0x1
+ 89e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 8a1:	52                   	push   %edx
+ 8a2:	57                   	push   %edi
+ 8a3:	e8 5c fd ff ff       	call   604 <write>
+        putc(fd, c);
+ 8a8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8ab:	31 d2                	xor    %edx,%edx
+ 8ad:	eb 8e                	jmp    83d <printf+0x4d>
+ 8af:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 8b0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8b3:	83 ec 0c             	sub    $0xc,%esp
+ 8b6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 8bb:	8b 13                	mov    (%ebx),%edx
+ 8bd:	6a 00                	push   $0x0
+ 8bf:	89 f8                	mov    %edi,%eax
+        ap++;
+ 8c1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 8c4:	e8 87 fe ff ff       	call   750 <printint>
+        ap++;
+ 8c9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 8cc:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 8cf:	31 d2                	xor    %edx,%edx
+ 8d1:	e9 67 ff ff ff       	jmp    83d <printf+0x4d>
+ 8d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8dd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 8e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 8e3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 8e5:	83 c0 04             	add    $0x4,%eax
+ 8e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 8eb:	85 db                	test   %ebx,%ebx
+ 8ed:	0f 84 9d 00 00 00    	je     990 <printf+0x1a0>
+        while(*s != 0){
+ 8f3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 8f6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 8f8:	84 c0                	test   %al,%al
+ 8fa:	0f 84 3d ff ff ff    	je     83d <printf+0x4d>
+ 900:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 903:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 906:	89 de                	mov    %ebx,%esi
+ 908:	89 d3                	mov    %edx,%ebx
+ 90a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 916:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 919:	6a 01                	push   $0x1
+ 91b:	53                   	push   %ebx
+ 91c:	57                   	push   %edi
+ 91d:	e8 e2 fc ff ff       	call   604 <write>
+        while(*s != 0){
+ 922:	0f b6 06             	movzbl (%esi),%eax
+ 925:	83 c4 10             	add    $0x10,%esp
+ 928:	84 c0                	test   %al,%al
+ 92a:	75 e4                	jne    910 <printf+0x120>
+      state = 0;
+ 92c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 92f:	31 d2                	xor    %edx,%edx
+ 931:	e9 07 ff ff ff       	jmp    83d <printf+0x4d>
+ 936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 93d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 940:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 94b:	8b 13                	mov    (%ebx),%edx
+ 94d:	6a 01                	push   $0x1
+ 94f:	e9 6b ff ff ff       	jmp    8bf <printf+0xcf>
+ 954:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 958:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 95b:	83 ec 04             	sub    $0x4,%esp
+ 95e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 961:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 963:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 966:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 969:	6a 01                	push   $0x1
+ 96b:	52                   	push   %edx
+ 96c:	57                   	push   %edi
+ 96d:	e8 92 fc ff ff       	call   604 <write>
+        ap++;
+ 972:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 975:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 978:	31 d2                	xor    %edx,%edx
+ 97a:	e9 be fe ff ff       	jmp    83d <printf+0x4d>
+ 97f:	90                   	nop
+  write(fd, &c, 1);
+ 980:	83 ec 04             	sub    $0x4,%esp
+ 983:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 986:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 989:	6a 01                	push   $0x1
+ 98b:	e9 11 ff ff ff       	jmp    8a1 <printf+0xb1>
+ 990:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 995:	bb b4 0d 00 00       	mov    $0xdb4,%ebx
+ 99a:	e9 61 ff ff ff       	jmp    900 <printf+0x110>
+ 99f:	90                   	nop
+
+000009a0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9a0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9a1:	a1 e0 22 00 00       	mov    0x22e0,%eax
+{
+ 9a6:	89 e5                	mov    %esp,%ebp
+ 9a8:	57                   	push   %edi
+ 9a9:	56                   	push   %esi
+ 9aa:	53                   	push   %ebx
+ 9ab:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 9ae:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9b1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9b8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ba:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9bc:	39 ca                	cmp    %ecx,%edx
+ 9be:	73 30                	jae    9f0 <free+0x50>
+ 9c0:	39 c1                	cmp    %eax,%ecx
+ 9c2:	72 04                	jb     9c8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9c4:	39 c2                	cmp    %eax,%edx
+ 9c6:	72 f0                	jb     9b8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 9c8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 9cb:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 9ce:	39 f8                	cmp    %edi,%eax
+ 9d0:	74 2e                	je     a00 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 9d2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 9d5:	8b 42 04             	mov    0x4(%edx),%eax
+ 9d8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9db:	39 f1                	cmp    %esi,%ecx
+ 9dd:	74 38                	je     a17 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 9df:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 9e1:	5b                   	pop    %ebx
+  freep = p;
+ 9e2:	89 15 e0 22 00 00    	mov    %edx,0x22e0
+}
+ 9e8:	5e                   	pop    %esi
+ 9e9:	5f                   	pop    %edi
+ 9ea:	5d                   	pop    %ebp
+ 9eb:	c3                   	ret
+ 9ec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9f0:	39 c1                	cmp    %eax,%ecx
+ 9f2:	72 d0                	jb     9c4 <free+0x24>
+ 9f4:	eb c2                	jmp    9b8 <free+0x18>
+ 9f6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9fd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a00:	03 70 04             	add    0x4(%eax),%esi
+ a03:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a06:	8b 02                	mov    (%edx),%eax
+ a08:	8b 00                	mov    (%eax),%eax
+ a0a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a0d:	8b 42 04             	mov    0x4(%edx),%eax
+ a10:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a13:	39 f1                	cmp    %esi,%ecx
+ a15:	75 c8                	jne    9df <free+0x3f>
+    p->s.size += bp->s.size;
+ a17:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ a1a:	89 15 e0 22 00 00    	mov    %edx,0x22e0
+    p->s.size += bp->s.size;
+ a20:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ a23:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ a26:	89 0a                	mov    %ecx,(%edx)
+}
+ a28:	5b                   	pop    %ebx
+ a29:	5e                   	pop    %esi
+ a2a:	5f                   	pop    %edi
+ a2b:	5d                   	pop    %ebp
+ a2c:	c3                   	ret
+ a2d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000a30 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ a30:	55                   	push   %ebp
+ a31:	89 e5                	mov    %esp,%ebp
+ a33:	57                   	push   %edi
+ a34:	56                   	push   %esi
+ a35:	53                   	push   %ebx
+ a36:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a39:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ a3c:	8b 15 e0 22 00 00    	mov    0x22e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ a42:	8d 78 07             	lea    0x7(%eax),%edi
+ a45:	c1 ef 03             	shr    $0x3,%edi
+ a48:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ a4b:	85 d2                	test   %edx,%edx
+ a4d:	0f 84 8d 00 00 00    	je     ae0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a53:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a55:	8b 48 04             	mov    0x4(%eax),%ecx
+ a58:	39 f9                	cmp    %edi,%ecx
+ a5a:	73 64                	jae    ac0 <malloc+0x90>
+  if(nu < 4096)
+ a5c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ a61:	39 df                	cmp    %ebx,%edi
+ a63:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ a66:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ a6d:	eb 0a                	jmp    a79 <malloc+0x49>
+ a6f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a70:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a72:	8b 48 04             	mov    0x4(%eax),%ecx
+ a75:	39 f9                	cmp    %edi,%ecx
+ a77:	73 47                	jae    ac0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a79:	89 c2                	mov    %eax,%edx
+ a7b:	39 05 e0 22 00 00    	cmp    %eax,0x22e0
+ a81:	75 ed                	jne    a70 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a83:	83 ec 0c             	sub    $0xc,%esp
+ a86:	56                   	push   %esi
+ a87:	e8 e0 fb ff ff       	call   66c <sbrk>
+  if(p == (char*)-1)
+ a8c:	83 c4 10             	add    $0x10,%esp
+ a8f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a92:	74 1c                	je     ab0 <malloc+0x80>
+  hp->s.size = nu;
+ a94:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a97:	83 ec 0c             	sub    $0xc,%esp
+ a9a:	83 c0 08             	add    $0x8,%eax
+ a9d:	50                   	push   %eax
+ a9e:	e8 fd fe ff ff       	call   9a0 <free>
+  return freep;
+ aa3:	8b 15 e0 22 00 00    	mov    0x22e0,%edx
+      if((p = morecore(nunits)) == 0)
+ aa9:	83 c4 10             	add    $0x10,%esp
+ aac:	85 d2                	test   %edx,%edx
+ aae:	75 c0                	jne    a70 <malloc+0x40>
+        return 0;
+  }
+}
+ ab0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ ab3:	31 c0                	xor    %eax,%eax
+}
+ ab5:	5b                   	pop    %ebx
+ ab6:	5e                   	pop    %esi
+ ab7:	5f                   	pop    %edi
+ ab8:	5d                   	pop    %ebp
+ ab9:	c3                   	ret
+ aba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ ac0:	39 cf                	cmp    %ecx,%edi
+ ac2:	74 4c                	je     b10 <malloc+0xe0>
+        p->s.size -= nunits;
+ ac4:	29 f9                	sub    %edi,%ecx
+ ac6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ ac9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ acc:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ acf:	89 15 e0 22 00 00    	mov    %edx,0x22e0
+}
+ ad5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ ad8:	83 c0 08             	add    $0x8,%eax
+}
+ adb:	5b                   	pop    %ebx
+ adc:	5e                   	pop    %esi
+ add:	5f                   	pop    %edi
+ ade:	5d                   	pop    %ebp
+ adf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ ae0:	c7 05 e0 22 00 00 e4 	movl   $0x22e4,0x22e0
+ ae7:	22 00 00 
+    base.s.size = 0;
+ aea:	b8 e4 22 00 00       	mov    $0x22e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ aef:	c7 05 e4 22 00 00 e4 	movl   $0x22e4,0x22e4
+ af6:	22 00 00 
+    base.s.size = 0;
+ af9:	c7 05 e8 22 00 00 00 	movl   $0x0,0x22e8
+ b00:	00 00 00 
+    if(p->s.size >= nunits){
+ b03:	e9 54 ff ff ff       	jmp    a5c <malloc+0x2c>
+ b08:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b0f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ b10:	8b 08                	mov    (%eax),%ecx
+ b12:	89 0a                	mov    %ecx,(%edx)
+ b14:	eb b9                	jmp    acf <malloc+0x9f>
+ b16:	66 90                	xchg   %ax,%ax
+ b18:	66 90                	xchg   %ax,%ax
+ b1a:	66 90                	xchg   %ax,%ax
+ b1c:	66 90                	xchg   %ax,%ax
+ b1e:	66 90                	xchg   %ax,%ax
+
+00000b20 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ b20:	55                   	push   %ebp
+ b21:	89 e5                	mov    %esp,%ebp
+ b23:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ b26:	8b 45 08             	mov    0x8(%ebp),%eax
+ b29:	c1 e0 04             	shl    $0x4,%eax
+ b2c:	ff b0 2c 23 00 00    	push   0x232c(%eax)
+ b32:	05 20 23 00 00       	add    $0x2320,%eax
+ b37:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ b3a:	e8 a5 fa ff ff       	call   5e4 <exit>
+ b3f:	90                   	nop
+
+00000b40 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ b40:	55                   	push   %ebp
+ b41:	89 e5                	mov    %esp,%ebp
+ b43:	57                   	push   %edi
+ b44:	56                   	push   %esi
+ b45:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ b46:	31 db                	xor    %ebx,%ebx
+{
+ b48:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ b4b:	68 00 23 00 00       	push   $0x2300
+ b50:	e8 eb f8 ff ff       	call   440 <lock_acquire>
+ b55:	83 c4 10             	add    $0x10,%esp
+ b58:	eb 12                	jmp    b6c <thread_create+0x2c>
+ b5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ b60:	83 c3 01             	add    $0x1,%ebx
+ b63:	83 fb 40             	cmp    $0x40,%ebx
+ b66:	0f 84 c4 00 00 00    	je     c30 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ b6c:	89 de                	mov    %ebx,%esi
+ b6e:	c1 e6 04             	shl    $0x4,%esi
+ b71:	8b 96 20 23 00 00    	mov    0x2320(%esi),%edx
+ b77:	85 d2                	test   %edx,%edx
+ b79:	75 e5                	jne    b60 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ b7b:	83 ec 0c             	sub    $0xc,%esp
+ b7e:	68 00 20 00 00       	push   $0x2000
+ b83:	e8 a8 fe ff ff       	call   a30 <malloc>
+ b88:	83 c4 10             	add    $0x10,%esp
+ b8b:	85 c0                	test   %eax,%eax
+ b8d:	0f 84 9d 00 00 00    	je     c30 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ b93:	89 86 24 23 00 00    	mov    %eax,0x2324(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ b99:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ b9e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ ba1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ ba6:	89 86 20 23 00 00    	mov    %eax,0x2320(%esi)
+  threads[i].fn = fn;
+ bac:	8b 45 08             	mov    0x8(%ebp),%eax
+ baf:	89 86 28 23 00 00    	mov    %eax,0x2328(%esi)
+  threads[i].arg = arg;
+ bb5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ bb8:	89 86 2c 23 00 00    	mov    %eax,0x232c(%esi)
+  lock_release(&threadslock);
+ bbe:	68 00 23 00 00       	push   $0x2300
+ bc3:	e8 98 f8 ff ff       	call   460 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ bc8:	83 c4 0c             	add    $0xc,%esp
+ bcb:	ff b6 20 23 00 00    	push   0x2320(%esi)
+ bd1:	53                   	push   %ebx
+ bd2:	68 20 0b 00 00       	push   $0xb20
+ bd7:	e8 10 fb ff ff       	call   6ec <clone>
+ bdc:	83 c4 10             	add    $0x10,%esp
+ bdf:	85 c0                	test   %eax,%eax
+ be1:	78 0d                	js     bf0 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ be3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ be6:	5b                   	pop    %ebx
+ be7:	5e                   	pop    %esi
+ be8:	5f                   	pop    %edi
+ be9:	5d                   	pop    %ebp
+ bea:	c3                   	ret
+ beb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ bef:	90                   	nop
+    lock_acquire(&threadslock);
+ bf0:	83 ec 0c             	sub    $0xc,%esp
+ bf3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ bf6:	68 00 23 00 00       	push   $0x2300
+ bfb:	e8 40 f8 ff ff       	call   440 <lock_acquire>
+    free(threads[i].block);
+ c00:	58                   	pop    %eax
+ c01:	ff b6 24 23 00 00    	push   0x2324(%esi)
+ c07:	e8 94 fd ff ff       	call   9a0 <free>
+    threads[i].stack = 0;
+ c0c:	c7 86 20 23 00 00 00 	movl   $0x0,0x2320(%esi)
+ c13:	00 00 00 
+    lock_release(&threadslock);
+ c16:	c7 04 24 00 23 00 00 	movl   $0x2300,(%esp)
+ c1d:	e8 3e f8 ff ff       	call   460 <lock_release>
+ c22:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c25:	83 c4 10             	add    $0x10,%esp
+}
+ c28:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c2b:	5b                   	pop    %ebx
+ c2c:	5e                   	pop    %esi
+ c2d:	5f                   	pop    %edi
+ c2e:	5d                   	pop    %ebp
+ c2f:	c3                   	ret
+    lock_release(&threadslock);
+ c30:	83 ec 0c             	sub    $0xc,%esp
+ c33:	68 00 23 00 00       	push   $0x2300
+ c38:	e8 23 f8 ff ff       	call   460 <lock_release>
+    return -1;
+ c3d:	83 c4 10             	add    $0x10,%esp
+ c40:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c45:	eb 9c                	jmp    be3 <thread_create+0xa3>
+ c47:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c4e:	66 90                	xchg   %ax,%ax
+
+00000c50 <thread_join>:
+
+int
+thread_join(void)
+{
+ c50:	55                   	push   %ebp
+ c51:	89 e5                	mov    %esp,%ebp
+ c53:	56                   	push   %esi
+ c54:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ c55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ c58:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ c5b:	50                   	push   %eax
+ c5c:	e8 93 fa ff ff       	call   6f4 <join>
+ c61:	83 c4 10             	add    $0x10,%esp
+ c64:	85 c0                	test   %eax,%eax
+ c66:	78 69                	js     cd1 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ c68:	83 ec 0c             	sub    $0xc,%esp
+ c6b:	89 c6                	mov    %eax,%esi
+ c6d:	68 00 23 00 00       	push   $0x2300
+ c72:	e8 c9 f7 ff ff       	call   440 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ c77:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ c7a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ c7d:	31 c0                	xor    %eax,%eax
+ c7f:	eb 0f                	jmp    c90 <thread_join+0x40>
+ c81:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c88:	83 c0 01             	add    $0x1,%eax
+ c8b:	83 f8 40             	cmp    $0x40,%eax
+ c8e:	74 28                	je     cb8 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ c90:	89 c3                	mov    %eax,%ebx
+ c92:	c1 e3 04             	shl    $0x4,%ebx
+ c95:	39 93 20 23 00 00    	cmp    %edx,0x2320(%ebx)
+ c9b:	75 eb                	jne    c88 <thread_join+0x38>
+      free(threads[i].block);
+ c9d:	83 ec 0c             	sub    $0xc,%esp
+ ca0:	ff b3 24 23 00 00    	push   0x2324(%ebx)
+ ca6:	e8 f5 fc ff ff       	call   9a0 <free>
+      threads[i].stack = 0;
+      break;
+ cab:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ cae:	c7 83 20 23 00 00 00 	movl   $0x0,0x2320(%ebx)
+ cb5:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ cb8:	83 ec 0c             	sub    $0xc,%esp
+ cbb:	68 00 23 00 00       	push   $0x2300
+ cc0:	e8 9b f7 ff ff       	call   460 <lock_release>
+  return pid;
+ cc5:	83 c4 10             	add    $0x10,%esp
+}
+ cc8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ ccb:	89 f0                	mov    %esi,%eax
+ ccd:	5b                   	pop    %ebx
+ cce:	5e                   	pop    %esi
+ ccf:	5d                   	pop    %ebp
+ cd0:	c3                   	ret
+    return -1;
+ cd1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ cd6:	eb f0                	jmp    cc8 <thread_join+0x78>
@@ -0,0 +1,77 @@
+// Sequential read benchmark.
+// Empties the buffer cache and reads a file from start to end, then
+// prints how long that took and how many disk commands it needed;
+// with readahead, each command should move several blocks.  With no
+// argument it reads a scratch file it writes first.
+//
+// usage: seqread [file]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+#include "fs.h"
+
+#define NBLK 128  // blocks in the scratch file
+
+char buf[BSIZE];
+char scratch[] = "seqread.tmp";
+
+void
+mkscratch(void)
+{
+  int fd, i;
+
+  if((fd = open(scratch, O_CREATE | O_RDWR)) < 0){
+    printf(2, "seqread: create %s failed\n", scratch);
+    exit();
+  }
+  for(i = 0; i < NBLK; i++){
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+      printf(2, "seqread: write %s failed\n", scratch);
+      exit();
+    }
+  }
+  close(fd);
+}
+
+int
+main(int argc, char *argv[])
+{
+  struct bcstat before, after;
+  char *name;
+  int fd, n, tot, start, elapsed;
+  uint cmds, blocks;
+
+  name = scratch;
+  if(argc > 1)
+    name = argv[1];
+  else
+    mkscratch();
+  if((fd = open(name, O_RDONLY)) < 0){
+    printf(2, "seqread: cannot open %s\n", name);
+    exit();
+  }
+
+  dropcache();
+  bcstat(&before);
+  start = uptime();
+  tot = 0;
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+    tot += n;
+  elapsed = uptime() - start;
+  bcstat(&after);
+  close(fd);
+
+  cmds = after.diskintrs - before.diskintrs;
+  blocks = after.diskblocks - before.diskblocks;
+  printf(1, "seqread: %s: %d bytes in %d ticks\n", name, tot, elapsed);
+  printf(1, "seqread: %d misses, %d blocks read ahead\n",
+         after.misses - before.misses, after.rablocks - before.rablocks);
+  if(cmds > 0)
+    printf(1, "seqread: %d disk commands for %d blocks, %d.%d blocks each\n",
+           cmds, blocks, blocks / cmds, blocks * 10 / cmds % 10);
+  if(name == scratch)
+    unlink(scratch);
+  exit();
+}
@@ -0,0 +1,3426 @@
+
+_sh:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  return 0;
+}
+
+int
+main(void)
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	53                   	push   %ebx
+       e:	51                   	push   %ecx
+  static char buf[100];
+  int fd, pid;
+
+  // Ensure that three file descriptors are open.
+  while((fd = open("console", O_RDWR)) >= 0){
+       f:	eb 10                	jmp    21 <main+0x21>
+      11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(fd >= 3){
+      18:	83 f8 02             	cmp    $0x2,%eax
+      1b:	0f 8f aa 00 00 00    	jg     cb <main+0xcb>
+  while((fd = open("console", O_RDWR)) >= 0){
+      21:	83 ec 08             	sub    $0x8,%esp
+      24:	6a 02                	push   $0x2
+      26:	68 c4 17 00 00       	push   $0x17c4
+      2b:	e8 44 10 00 00       	call   1074 <open>
+      30:	83 c4 10             	add    $0x10,%esp
+      33:	85 c0                	test   %eax,%eax
+      35:	79 e1                	jns    18 <main+0x18>
+      37:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      3e:	66 90                	xchg   %ax,%ax
+      break;
+    }
+  }
+
+  // Read and run input commands.
+  while(getcmd(buf, sizeof(buf)) >= 0){
+      40:	83 ec 08             	sub    $0x8,%esp
+      43:	6a 64                	push   $0x64
+      45:	68 80 20 00 00       	push   $0x2080
+      4a:	e8 d1 00 00 00       	call   120 <getcmd>
+      4f:	83 c4 10             	add    $0x10,%esp
+      52:	85 c0                	test   %eax,%eax
+      54:	0f 88 b3 00 00 00    	js     10d <main+0x10d>
+    if(buf[0] == 'c' && buf[1] == 'd' && buf[2] == ' '){
+      5a:	bb 80 20 00 00       	mov    $0x2080,%ebx
+      5f:	80 3b 63             	cmpb   $0x63,(%ebx)
+      62:	75 44                	jne    a8 <main+0xa8>
+      64:	80 7b 01 64          	cmpb   $0x64,0x1(%ebx)
+      68:	75 3e                	jne    a8 <main+0xa8>
+      6a:	80 7b 02 20          	cmpb   $0x20,0x2(%ebx)
+      6e:	75 38                	jne    a8 <main+0xa8>
+      // Chdir must be called by the parent, not the child.
+      buf[strlen(buf)-1] = 0;  // chop \n
+      70:	83 ec 0c             	sub    $0xc,%esp
+      73:	53                   	push   %ebx
+      74:	e8 57 0c 00 00       	call   cd0 <strlen>
+      if(chdir(buf+3) < 0)
+      79:	c7 04 24 83 20 00 00 	movl   $0x2083,(%esp)
+      buf[strlen(buf)-1] = 0;  // chop \n
+      80:	c6 44 03 ff 00       	movb   $0x0,-0x1(%ebx,%eax,1)
+      if(chdir(buf+3) < 0)
+      85:	e8 1a 10 00 00       	call   10a4 <chdir>
+      8a:	83 c4 10             	add    $0x10,%esp
+      8d:	85 c0                	test   %eax,%eax
+      8f:	79 af                	jns    40 <main+0x40>
+        printf(2, "cannot cd %s\n", buf+3);
+      91:	52                   	push   %edx
+      92:	68 83 20 00 00       	push   $0x2083
+      97:	68 cc 17 00 00       	push   $0x17cc
+      9c:	6a 02                	push   $0x2
+      9e:	e8 9d 11 00 00       	call   1240 <printf>
+      a3:	83 c4 10             	add    $0x10,%esp
+      a6:	eb 98                	jmp    40 <main+0x40>
+      continue;
+    }
+    // Most commands go straight to exec, so lend the child our
+    // address space rather than have fork copy it.
+    if((pid = vfork()) == 0){
+      a8:	e8 df 10 00 00       	call   118c <vfork>
+      ad:	85 c0                	test   %eax,%eax
+      af:	75 2b                	jne    dc <main+0xdc>
+      vforkcmd = parsecmd(buf);
+      b1:	83 ec 0c             	sub    $0xc,%esp
+      b4:	68 80 20 00 00       	push   $0x2080
+      b9:	e8 92 0a 00 00       	call   b50 <parsecmd>
+      be:	a3 60 20 00 00       	mov    %eax,0x2060
+      runcmd(vforkcmd);
+      c3:	89 04 24             	mov    %eax,(%esp)
+      c6:	e8 d5 00 00 00       	call   1a0 <runcmd>
+      close(fd);
+      cb:	83 ec 0c             	sub    $0xc,%esp
+      ce:	50                   	push   %eax
+      cf:	e8 88 0f 00 00       	call   105c <close>
+      d4:	83 c4 10             	add    $0x10,%esp
+      d7:	e9 64 ff ff ff       	jmp    40 <main+0x40>
+    }
+    if(pid < 0)
+      dc:	78 22                	js     100 <main+0x100>
+      panic("vfork");
+    wait();
+      de:	e8 59 0f 00 00       	call   103c <wait>
+    freecmd(vforkcmd);
+      e3:	83 ec 0c             	sub    $0xc,%esp
+      e6:	ff 35 60 20 00 00    	push   0x2060
+      ec:	e8 cf 0a 00 00       	call   bc0 <freecmd>
+    vforkcmd = 0;
+      f1:	31 c0                	xor    %eax,%eax
+    freecmd(vforkcmd);
+      f3:	83 c4 10             	add    $0x10,%esp
+    vforkcmd = 0;
+      f6:	a3 60 20 00 00       	mov    %eax,0x2060
+      fb:	e9 40 ff ff ff       	jmp    40 <main+0x40>
+      panic("vfork");
+     100:	83 ec 0c             	sub    $0xc,%esp
+     103:	68 da 17 00 00       	push   $0x17da
+     108:	e8 53 00 00 00       	call   160 <panic>
+  }
+  exit();
+     10d:	e8 22 0f 00 00       	call   1034 <exit>
+     112:	66 90                	xchg   %ax,%ax
+     114:	66 90                	xchg   %ax,%ax
+     116:	66 90                	xchg   %ax,%ax
+     118:	66 90                	xchg   %ax,%ax
+     11a:	66 90                	xchg   %ax,%ax
+     11c:	66 90                	xchg   %ax,%ax
+     11e:	66 90                	xchg   %ax,%ax
+
+00000120 <getcmd>:
+{
+     120:	55                   	push   %ebp
+     121:	89 e5                	mov    %esp,%ebp
+     123:	56                   	push   %esi
+     124:	53                   	push   %ebx
+     125:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     128:	8b 75 0c             	mov    0xc(%ebp),%esi
+  printf(2, "$ ");
+     12b:	83 ec 08             	sub    $0x8,%esp
+     12e:	68 28 17 00 00       	push   $0x1728
+     133:	6a 02                	push   $0x2
+     135:	e8 06 11 00 00       	call   1240 <printf>
+  memset(buf, 0, nbuf);
+     13a:	83 c4 0c             	add    $0xc,%esp
+     13d:	56                   	push   %esi
+     13e:	6a 00                	push   $0x0
+     140:	53                   	push   %ebx
+     141:	e8 ba 0b 00 00       	call   d00 <memset>
+  gets(buf, nbuf);
+     146:	58                   	pop    %eax
+     147:	5a                   	pop    %edx
+     148:	56                   	push   %esi
+     149:	53                   	push   %ebx
+     14a:	e8 11 0c 00 00       	call   d60 <gets>
+  if(buf[0] == 0) // EOF
+     14f:	83 c4 10             	add    $0x10,%esp
+     152:	80 3b 01             	cmpb   $0x1,(%ebx)
+     155:	19 c0                	sbb    %eax,%eax
+}
+     157:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     15a:	5b                   	pop    %ebx
+     15b:	5e                   	pop    %esi
+     15c:	5d                   	pop    %ebp
+     15d:	c3                   	ret
+     15e:	66 90                	xchg   %ax,%ax
+
+00000160 <panic>:
+}
+
+void
+panic(char *s)
+{
+     160:	55                   	push   %ebp
+     161:	89 e5                	mov    %esp,%ebp
+     163:	83 ec 0c             	sub    $0xc,%esp
+  printf(2, "%s\n", s);
+     166:	ff 75 08             	push   0x8(%ebp)
+     169:	68 c0 17 00 00       	push   $0x17c0
+     16e:	6a 02                	push   $0x2
+     170:	e8 cb 10 00 00       	call   1240 <printf>
+  exit();
+     175:	e8 ba 0e 00 00       	call   1034 <exit>
+     17a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000180 <fork1>:
+}
+
+int
+fork1(void)
+{
+     180:	55                   	push   %ebp
+     181:	89 e5                	mov    %esp,%ebp
+     183:	83 ec 08             	sub    $0x8,%esp
+  int pid;
+
+  pid = fork();
+     186:	e8 a1 0e 00 00       	call   102c <fork>
+  if(pid == -1)
+     18b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     18e:	74 02                	je     192 <fork1+0x12>
+    panic("fork");
+  return pid;
+}
+     190:	c9                   	leave
+     191:	c3                   	ret
+    panic("fork");
+     192:	83 ec 0c             	sub    $0xc,%esp
+     195:	68 db 17 00 00       	push   $0x17db
+     19a:	e8 c1 ff ff ff       	call   160 <panic>
+     19f:	90                   	nop
+
+000001a0 <runcmd>:
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	53                   	push   %ebx
+     1a4:	83 ec 14             	sub    $0x14,%esp
+     1a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if(cmd == 0)
+     1aa:	85 db                	test   %ebx,%ebx
+     1ac:	74 42                	je     1f0 <runcmd+0x50>
+  switch(cmd->type){
+     1ae:	83 3b 05             	cmpl   $0x5,(%ebx)
+     1b1:	0f 87 e3 00 00 00    	ja     29a <runcmd+0xfa>
+     1b7:	8b 03                	mov    (%ebx),%eax
+     1b9:	ff 24 85 e0 17 00 00 	jmp    *0x17e0(,%eax,4)
+    if(ecmd->argv[0] == 0)
+     1c0:	8b 43 04             	mov    0x4(%ebx),%eax
+     1c3:	85 c0                	test   %eax,%eax
+     1c5:	74 29                	je     1f0 <runcmd+0x50>
+    exec(ecmd->argv[0], ecmd->argv);
+     1c7:	8d 53 04             	lea    0x4(%ebx),%edx
+     1ca:	51                   	push   %ecx
+     1cb:	51                   	push   %ecx
+     1cc:	52                   	push   %edx
+     1cd:	50                   	push   %eax
+     1ce:	e8 99 0e 00 00       	call   106c <exec>
+    printf(2, "exec %s failed\n", ecmd->argv[0]);
+     1d3:	83 c4 0c             	add    $0xc,%esp
+     1d6:	ff 73 04             	push   0x4(%ebx)
+     1d9:	68 32 17 00 00       	push   $0x1732
+     1de:	6a 02                	push   $0x2
+     1e0:	e8 5b 10 00 00       	call   1240 <printf>
+    break;
+     1e5:	83 c4 10             	add    $0x10,%esp
+     1e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     1ef:	90                   	nop
+    exit();
+     1f0:	e8 3f 0e 00 00       	call   1034 <exit>
+    if(fork1() == 0)
+     1f5:	e8 86 ff ff ff       	call   180 <fork1>
+     1fa:	85 c0                	test   %eax,%eax
+     1fc:	75 f2                	jne    1f0 <runcmd+0x50>
+     1fe:	e9 8c 00 00 00       	jmp    28f <runcmd+0xef>
+    if(pipe(p) < 0)
+     203:	83 ec 0c             	sub    $0xc,%esp
+     206:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     209:	50                   	push   %eax
+     20a:	e8 35 0e 00 00       	call   1044 <pipe>
+     20f:	83 c4 10             	add    $0x10,%esp
+     212:	85 c0                	test   %eax,%eax
+     214:	0f 88 a2 00 00 00    	js     2bc <runcmd+0x11c>
+    if(fork1() == 0){
+     21a:	e8 61 ff ff ff       	call   180 <fork1>
+     21f:	85 c0                	test   %eax,%eax
+     221:	0f 84 a2 00 00 00    	je     2c9 <runcmd+0x129>
+    if(fork1() == 0){
+     227:	e8 54 ff ff ff       	call   180 <fork1>
+     22c:	85 c0                	test   %eax,%eax
+     22e:	0f 84 c3 00 00 00    	je     2f7 <runcmd+0x157>
+    close(p[0]);
+     234:	83 ec 0c             	sub    $0xc,%esp
+     237:	ff 75 f0             	push   -0x10(%ebp)
+     23a:	e8 1d 0e 00 00       	call   105c <close>
+    close(p[1]);
+     23f:	58                   	pop    %eax
+     240:	ff 75 f4             	push   -0xc(%ebp)
+     243:	e8 14 0e 00 00       	call   105c <close>
+    wait();
+     248:	e8 ef 0d 00 00       	call   103c <wait>
+    wait();
+     24d:	e8 ea 0d 00 00       	call   103c <wait>
+    break;
+     252:	83 c4 10             	add    $0x10,%esp
+     255:	eb 99                	jmp    1f0 <runcmd+0x50>
+    if(fork1() == 0)
+     257:	e8 24 ff ff ff       	call   180 <fork1>
+     25c:	85 c0                	test   %eax,%eax
+     25e:	74 2f                	je     28f <runcmd+0xef>
+    wait();
+     260:	e8 d7 0d 00 00       	call   103c <wait>
+    runcmd(lcmd->right);
+     265:	83 ec 0c             	sub    $0xc,%esp
+     268:	ff 73 08             	push   0x8(%ebx)
+     26b:	e8 30 ff ff ff       	call   1a0 <runcmd>
+    close(rcmd->fd);
+     270:	83 ec 0c             	sub    $0xc,%esp
+     273:	ff 73 14             	push   0x14(%ebx)
+     276:	e8 e1 0d 00 00       	call   105c <close>
+    if(open(rcmd->file, rcmd->mode) < 0){
+     27b:	58                   	pop    %eax
+     27c:	5a                   	pop    %edx
+     27d:	ff 73 10             	push   0x10(%ebx)
+     280:	ff 73 08             	push   0x8(%ebx)
+     283:	e8 ec 0d 00 00       	call   1074 <open>
+     288:	83 c4 10             	add    $0x10,%esp
+     28b:	85 c0                	test   %eax,%eax
+     28d:	78 18                	js     2a7 <runcmd+0x107>
+      runcmd(bcmd->cmd);
+     28f:	83 ec 0c             	sub    $0xc,%esp
+     292:	ff 73 04             	push   0x4(%ebx)
+     295:	e8 06 ff ff ff       	call   1a0 <runcmd>
+    panic("runcmd");
+     29a:	83 ec 0c             	sub    $0xc,%esp
+     29d:	68 2b 17 00 00       	push   $0x172b
+     2a2:	e8 b9 fe ff ff       	call   160 <panic>
+      printf(2, "open %s failed\n", rcmd->file);
+     2a7:	51                   	push   %ecx
+     2a8:	ff 73 08             	push   0x8(%ebx)
+     2ab:	68 42 17 00 00       	push   $0x1742
+     2b0:	6a 02                	push   $0x2
+     2b2:	e8 89 0f 00 00       	call   1240 <printf>
+      exit();
+     2b7:	e8 78 0d 00 00       	call   1034 <exit>
+      panic("pipe");
+     2bc:	83 ec 0c             	sub    $0xc,%esp
+     2bf:	68 52 17 00 00       	push   $0x1752
+     2c4:	e8 97 fe ff ff       	call   160 <panic>
+      close(1);
+     2c9:	83 ec 0c             	sub    $0xc,%esp
+     2cc:	6a 01                	push   $0x1
+     2ce:	e8 89 0d 00 00       	call   105c <close>
+      dup(p[1]);
+     2d3:	58                   	pop    %eax
+     2d4:	ff 75 f4             	push   -0xc(%ebp)
+     2d7:	e8 d0 0d 00 00       	call   10ac <dup>
+      close(p[0]);
+     2dc:	58                   	pop    %eax
+     2dd:	ff 75 f0             	push   -0x10(%ebp)
+     2e0:	e8 77 0d 00 00       	call   105c <close>
+      close(p[1]);
+     2e5:	58                   	pop    %eax
+     2e6:	ff 75 f4             	push   -0xc(%ebp)
+     2e9:	e8 6e 0d 00 00       	call   105c <close>
+      runcmd(pcmd->left);
+     2ee:	5a                   	pop    %edx
+     2ef:	ff 73 04             	push   0x4(%ebx)
+     2f2:	e8 a9 fe ff ff       	call   1a0 <runcmd>
+      close(0);
+     2f7:	83 ec 0c             	sub    $0xc,%esp
+     2fa:	6a 00                	push   $0x0
+     2fc:	e8 5b 0d 00 00       	call   105c <close>
+      dup(p[0]);
+     301:	5a                   	pop    %edx
+     302:	ff 75 f0             	push   -0x10(%ebp)
+     305:	e8 a2 0d 00 00       	call   10ac <dup>
+      close(p[0]);
+     30a:	59                   	pop    %ecx
+     30b:	ff 75 f0             	push   -0x10(%ebp)
+     30e:	e8 49 0d 00 00       	call   105c <close>
+      close(p[1]);
+     313:	58                   	pop    %eax
+     314:	ff 75 f4             	push   -0xc(%ebp)
+     317:	e8 40 0d 00 00       	call   105c <close>
+      runcmd(pcmd->right);
+     31c:	58                   	pop    %eax
+     31d:	ff 73 08             	push   0x8(%ebx)
+     320:	e8 7b fe ff ff       	call   1a0 <runcmd>
+     325:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     32c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000330 <execcmd>:
+//PAGEBREAK!
+// Constructors
+
+struct cmd*
+execcmd(void)
+{
+     330:	55                   	push   %ebp
+     331:	89 e5                	mov    %esp,%ebp
+     333:	53                   	push   %ebx
+     334:	83 ec 10             	sub    $0x10,%esp
+  struct execcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     337:	6a 54                	push   $0x54
+     339:	e8 42 11 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     33e:	83 c4 0c             	add    $0xc,%esp
+     341:	6a 54                	push   $0x54
+  cmd = malloc(sizeof(*cmd));
+     343:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     345:	6a 00                	push   $0x0
+     347:	50                   	push   %eax
+     348:	e8 b3 09 00 00       	call   d00 <memset>
+  cmd->type = EXEC;
+     34d:	c7 03 01 00 00 00    	movl   $0x1,(%ebx)
+  return (struct cmd*)cmd;
+}
+     353:	89 d8                	mov    %ebx,%eax
+     355:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     358:	c9                   	leave
+     359:	c3                   	ret
+     35a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000360 <redircmd>:
+
+struct cmd*
+redircmd(struct cmd *subcmd, char *file, char *efile, int mode, int fd)
+{
+     360:	55                   	push   %ebp
+     361:	89 e5                	mov    %esp,%ebp
+     363:	53                   	push   %ebx
+     364:	83 ec 10             	sub    $0x10,%esp
+  struct redircmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     367:	6a 18                	push   $0x18
+     369:	e8 12 11 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     36e:	83 c4 0c             	add    $0xc,%esp
+     371:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     373:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     375:	6a 00                	push   $0x0
+     377:	50                   	push   %eax
+     378:	e8 83 09 00 00       	call   d00 <memset>
+  cmd->type = REDIR;
+  cmd->cmd = subcmd;
+     37d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = REDIR;
+     380:	c7 03 02 00 00 00    	movl   $0x2,(%ebx)
+  cmd->cmd = subcmd;
+     386:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->file = file;
+     389:	8b 45 0c             	mov    0xc(%ebp),%eax
+     38c:	89 43 08             	mov    %eax,0x8(%ebx)
+  cmd->efile = efile;
+     38f:	8b 45 10             	mov    0x10(%ebp),%eax
+     392:	89 43 0c             	mov    %eax,0xc(%ebx)
+  cmd->mode = mode;
+     395:	8b 45 14             	mov    0x14(%ebp),%eax
+     398:	89 43 10             	mov    %eax,0x10(%ebx)
+  cmd->fd = fd;
+     39b:	8b 45 18             	mov    0x18(%ebp),%eax
+     39e:	89 43 14             	mov    %eax,0x14(%ebx)
+  return (struct cmd*)cmd;
+}
+     3a1:	89 d8                	mov    %ebx,%eax
+     3a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3a6:	c9                   	leave
+     3a7:	c3                   	ret
+     3a8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3af:	90                   	nop
+
+000003b0 <pipecmd>:
+
+struct cmd*
+pipecmd(struct cmd *left, struct cmd *right)
+{
+     3b0:	55                   	push   %ebp
+     3b1:	89 e5                	mov    %esp,%ebp
+     3b3:	53                   	push   %ebx
+     3b4:	83 ec 10             	sub    $0x10,%esp
+  struct pipecmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3b7:	6a 0c                	push   $0xc
+     3b9:	e8 c2 10 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3be:	83 c4 0c             	add    $0xc,%esp
+     3c1:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     3c3:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     3c5:	6a 00                	push   $0x0
+     3c7:	50                   	push   %eax
+     3c8:	e8 33 09 00 00       	call   d00 <memset>
+  cmd->type = PIPE;
+  cmd->left = left;
+     3cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = PIPE;
+     3d0:	c7 03 03 00 00 00    	movl   $0x3,(%ebx)
+  cmd->left = left;
+     3d6:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     3d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+     3dc:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     3df:	89 d8                	mov    %ebx,%eax
+     3e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     3e4:	c9                   	leave
+     3e5:	c3                   	ret
+     3e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     3ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000003f0 <listcmd>:
+
+struct cmd*
+listcmd(struct cmd *left, struct cmd *right)
+{
+     3f0:	55                   	push   %ebp
+     3f1:	89 e5                	mov    %esp,%ebp
+     3f3:	53                   	push   %ebx
+     3f4:	83 ec 10             	sub    $0x10,%esp
+  struct listcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     3f7:	6a 0c                	push   $0xc
+     3f9:	e8 82 10 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     3fe:	83 c4 0c             	add    $0xc,%esp
+     401:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     403:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     405:	6a 00                	push   $0x0
+     407:	50                   	push   %eax
+     408:	e8 f3 08 00 00       	call   d00 <memset>
+  cmd->type = LIST;
+  cmd->left = left;
+     40d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = LIST;
+     410:	c7 03 04 00 00 00    	movl   $0x4,(%ebx)
+  cmd->left = left;
+     416:	89 43 04             	mov    %eax,0x4(%ebx)
+  cmd->right = right;
+     419:	8b 45 0c             	mov    0xc(%ebp),%eax
+     41c:	89 43 08             	mov    %eax,0x8(%ebx)
+  return (struct cmd*)cmd;
+}
+     41f:	89 d8                	mov    %ebx,%eax
+     421:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     424:	c9                   	leave
+     425:	c3                   	ret
+     426:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     42d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000430 <backcmd>:
+
+struct cmd*
+backcmd(struct cmd *subcmd)
+{
+     430:	55                   	push   %ebp
+     431:	89 e5                	mov    %esp,%ebp
+     433:	53                   	push   %ebx
+     434:	83 ec 10             	sub    $0x10,%esp
+  struct backcmd *cmd;
+
+  cmd = malloc(sizeof(*cmd));
+     437:	6a 08                	push   $0x8
+     439:	e8 42 10 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     43e:	83 c4 0c             	add    $0xc,%esp
+     441:	6a 08                	push   $0x8
+  cmd = malloc(sizeof(*cmd));
+     443:	89 c3                	mov    %eax,%ebx
+  memset(cmd, 0, sizeof(*cmd));
+     445:	6a 00                	push   $0x0
+     447:	50                   	push   %eax
+     448:	e8 b3 08 00 00       	call   d00 <memset>
+  cmd->type = BACK;
+  cmd->cmd = subcmd;
+     44d:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->type = BACK;
+     450:	c7 03 05 00 00 00    	movl   $0x5,(%ebx)
+  cmd->cmd = subcmd;
+     456:	89 43 04             	mov    %eax,0x4(%ebx)
+  return (struct cmd*)cmd;
+}
+     459:	89 d8                	mov    %ebx,%eax
+     45b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     45e:	c9                   	leave
+     45f:	c3                   	ret
+
+00000460 <gettoken>:
+char whitespace[] = " \t\r\n\v";
+char symbols[] = "<|>&;()";
+
+int
+gettoken(char **ps, char *es, char **q, char **eq)
+{
+     460:	55                   	push   %ebp
+     461:	89 e5                	mov    %esp,%ebp
+     463:	57                   	push   %edi
+     464:	56                   	push   %esi
+     465:	53                   	push   %ebx
+     466:	83 ec 0c             	sub    $0xc,%esp
+  char *s;
+  int ret;
+
+  s = *ps;
+     469:	8b 45 08             	mov    0x8(%ebp),%eax
+{
+     46c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     46f:	8b 75 10             	mov    0x10(%ebp),%esi
+  s = *ps;
+     472:	8b 38                	mov    (%eax),%edi
+  while(s < es && strchr(whitespace, *s))
+     474:	39 df                	cmp    %ebx,%edi
+     476:	72 0f                	jb     487 <gettoken+0x27>
+     478:	eb 25                	jmp    49f <gettoken+0x3f>
+     47a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    s++;
+     480:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     483:	39 fb                	cmp    %edi,%ebx
+     485:	74 18                	je     49f <gettoken+0x3f>
+     487:	0f be 07             	movsbl (%edi),%eax
+     48a:	83 ec 08             	sub    $0x8,%esp
+     48d:	50                   	push   %eax
+     48e:	68 48 20 00 00       	push   $0x2048
+     493:	e8 88 08 00 00       	call   d20 <strchr>
+     498:	83 c4 10             	add    $0x10,%esp
+     49b:	85 c0                	test   %eax,%eax
+     49d:	75 e1                	jne    480 <gettoken+0x20>
+  if(q)
+     49f:	85 f6                	test   %esi,%esi
+     4a1:	74 02                	je     4a5 <gettoken+0x45>
+    *q = s;
+     4a3:	89 3e                	mov    %edi,(%esi)
+  ret = *s;
+     4a5:	0f b6 07             	movzbl (%edi),%eax
+  switch(*s){
+     4a8:	3c 3c                	cmp    $0x3c,%al
+     4aa:	0f 8f d0 00 00 00    	jg     580 <gettoken+0x120>
+     4b0:	3c 3a                	cmp    $0x3a,%al
+     4b2:	0f 8f bc 00 00 00    	jg     574 <gettoken+0x114>
+     4b8:	84 c0                	test   %al,%al
+     4ba:	75 44                	jne    500 <gettoken+0xa0>
+     4bc:	31 f6                	xor    %esi,%esi
+    ret = 'a';
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+      s++;
+    break;
+  }
+  if(eq)
+     4be:	8b 4d 14             	mov    0x14(%ebp),%ecx
+     4c1:	85 c9                	test   %ecx,%ecx
+     4c3:	74 05                	je     4ca <gettoken+0x6a>
+    *eq = s;
+     4c5:	8b 45 14             	mov    0x14(%ebp),%eax
+     4c8:	89 38                	mov    %edi,(%eax)
+
+  while(s < es && strchr(whitespace, *s))
+     4ca:	39 df                	cmp    %ebx,%edi
+     4cc:	72 09                	jb     4d7 <gettoken+0x77>
+     4ce:	eb 1f                	jmp    4ef <gettoken+0x8f>
+    s++;
+     4d0:	83 c7 01             	add    $0x1,%edi
+  while(s < es && strchr(whitespace, *s))
+     4d3:	39 fb                	cmp    %edi,%ebx
+     4d5:	74 18                	je     4ef <gettoken+0x8f>
+     4d7:	0f be 07             	movsbl (%edi),%eax
+     4da:	83 ec 08             	sub    $0x8,%esp
+     4dd:	50                   	push   %eax
+     4de:	68 48 20 00 00       	push   $0x2048
+     4e3:	e8 38 08 00 00       	call   d20 <strchr>
+     4e8:	83 c4 10             	add    $0x10,%esp
+     4eb:	85 c0                	test   %eax,%eax
+     4ed:	75 e1                	jne    4d0 <gettoken+0x70>
+  *ps = s;
+     4ef:	8b 45 08             	mov    0x8(%ebp),%eax
+     4f2:	89 38                	mov    %edi,(%eax)
+  return ret;
+}
+     4f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     4f7:	89 f0                	mov    %esi,%eax
+     4f9:	5b                   	pop    %ebx
+     4fa:	5e                   	pop    %esi
+     4fb:	5f                   	pop    %edi
+     4fc:	5d                   	pop    %ebp
+     4fd:	c3                   	ret
+     4fe:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     500:	79 66                	jns    568 <gettoken+0x108>
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     502:	39 df                	cmp    %ebx,%edi
+     504:	72 39                	jb     53f <gettoken+0xdf>
+  if(eq)
+     506:	8b 55 14             	mov    0x14(%ebp),%edx
+     509:	85 d2                	test   %edx,%edx
+     50b:	0f 84 b3 00 00 00    	je     5c4 <gettoken+0x164>
+    *eq = s;
+     511:	8b 45 14             	mov    0x14(%ebp),%eax
+     514:	89 38                	mov    %edi,(%eax)
+  while(s < es && strchr(whitespace, *s))
+     516:	e9 a9 00 00 00       	jmp    5c4 <gettoken+0x164>
+     51b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     51f:	90                   	nop
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     520:	0f be 07             	movsbl (%edi),%eax
+     523:	83 ec 08             	sub    $0x8,%esp
+     526:	50                   	push   %eax
+     527:	68 40 20 00 00       	push   $0x2040
+     52c:	e8 ef 07 00 00       	call   d20 <strchr>
+     531:	83 c4 10             	add    $0x10,%esp
+     534:	85 c0                	test   %eax,%eax
+     536:	75 1f                	jne    557 <gettoken+0xf7>
+      s++;
+     538:	83 c7 01             	add    $0x1,%edi
+    while(s < es && !strchr(whitespace, *s) && !strchr(symbols, *s))
+     53b:	39 fb                	cmp    %edi,%ebx
+     53d:	74 77                	je     5b6 <gettoken+0x156>
+     53f:	0f be 07             	movsbl (%edi),%eax
+     542:	83 ec 08             	sub    $0x8,%esp
+     545:	50                   	push   %eax
+     546:	68 48 20 00 00       	push   $0x2048
+     54b:	e8 d0 07 00 00       	call   d20 <strchr>
+     550:	83 c4 10             	add    $0x10,%esp
+     553:	85 c0                	test   %eax,%eax
+     555:	74 c9                	je     520 <gettoken+0xc0>
+    ret = 'a';
+     557:	be 61 00 00 00       	mov    $0x61,%esi
+     55c:	e9 5d ff ff ff       	jmp    4be <gettoken+0x5e>
+     561:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  switch(*s){
+     568:	3c 26                	cmp    $0x26,%al
+     56a:	74 08                	je     574 <gettoken+0x114>
+     56c:	8d 48 d8             	lea    -0x28(%eax),%ecx
+     56f:	80 f9 01             	cmp    $0x1,%cl
+     572:	77 8e                	ja     502 <gettoken+0xa2>
+  ret = *s;
+     574:	0f be f0             	movsbl %al,%esi
+    s++;
+     577:	83 c7 01             	add    $0x1,%edi
+    break;
+     57a:	e9 3f ff ff ff       	jmp    4be <gettoken+0x5e>
+     57f:	90                   	nop
+  switch(*s){
+     580:	3c 3e                	cmp    $0x3e,%al
+     582:	75 1c                	jne    5a0 <gettoken+0x140>
+    if(*s == '>'){
+     584:	80 7f 01 3e          	cmpb   $0x3e,0x1(%edi)
+     588:	74 1f                	je     5a9 <gettoken+0x149>
+    s++;
+     58a:	83 c7 01             	add    $0x1,%edi
+  ret = *s;
+     58d:	be 3e 00 00 00       	mov    $0x3e,%esi
+     592:	e9 27 ff ff ff       	jmp    4be <gettoken+0x5e>
+     597:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     59e:	66 90                	xchg   %ax,%ax
+  switch(*s){
+     5a0:	3c 7c                	cmp    $0x7c,%al
+     5a2:	74 d0                	je     574 <gettoken+0x114>
+     5a4:	e9 59 ff ff ff       	jmp    502 <gettoken+0xa2>
+      s++;
+     5a9:	83 c7 02             	add    $0x2,%edi
+      ret = '+';
+     5ac:	be 2b 00 00 00       	mov    $0x2b,%esi
+     5b1:	e9 08 ff ff ff       	jmp    4be <gettoken+0x5e>
+  if(eq)
+     5b6:	8b 45 14             	mov    0x14(%ebp),%eax
+     5b9:	85 c0                	test   %eax,%eax
+     5bb:	74 05                	je     5c2 <gettoken+0x162>
+    *eq = s;
+     5bd:	8b 45 14             	mov    0x14(%ebp),%eax
+     5c0:	89 18                	mov    %ebx,(%eax)
+      s++;
+     5c2:	89 df                	mov    %ebx,%edi
+    ret = 'a';
+     5c4:	be 61 00 00 00       	mov    $0x61,%esi
+     5c9:	e9 21 ff ff ff       	jmp    4ef <gettoken+0x8f>
+     5ce:	66 90                	xchg   %ax,%ax
+
+000005d0 <peek>:
+
+int
+peek(char **ps, char *es, char *toks)
+{
+     5d0:	55                   	push   %ebp
+     5d1:	89 e5                	mov    %esp,%ebp
+     5d3:	57                   	push   %edi
+     5d4:	56                   	push   %esi
+     5d5:	53                   	push   %ebx
+     5d6:	83 ec 0c             	sub    $0xc,%esp
+     5d9:	8b 7d 08             	mov    0x8(%ebp),%edi
+     5dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *s;
+
+  s = *ps;
+     5df:	8b 1f                	mov    (%edi),%ebx
+  while(s < es && strchr(whitespace, *s))
+     5e1:	39 f3                	cmp    %esi,%ebx
+     5e3:	72 12                	jb     5f7 <peek+0x27>
+     5e5:	eb 28                	jmp    60f <peek+0x3f>
+     5e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     5ee:	66 90                	xchg   %ax,%ax
+    s++;
+     5f0:	83 c3 01             	add    $0x1,%ebx
+  while(s < es && strchr(whitespace, *s))
+     5f3:	39 de                	cmp    %ebx,%esi
+     5f5:	74 18                	je     60f <peek+0x3f>
+     5f7:	0f be 03             	movsbl (%ebx),%eax
+     5fa:	83 ec 08             	sub    $0x8,%esp
+     5fd:	50                   	push   %eax
+     5fe:	68 48 20 00 00       	push   $0x2048
+     603:	e8 18 07 00 00       	call   d20 <strchr>
+     608:	83 c4 10             	add    $0x10,%esp
+     60b:	85 c0                	test   %eax,%eax
+     60d:	75 e1                	jne    5f0 <peek+0x20>
+  *ps = s;
+     60f:	89 1f                	mov    %ebx,(%edi)
+  return *s && strchr(toks, *s);
+     611:	0f be 03             	movsbl (%ebx),%eax
+     614:	31 d2                	xor    %edx,%edx
+     616:	84 c0                	test   %al,%al
+     618:	75 0e                	jne    628 <peek+0x58>
+}
+     61a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     61d:	89 d0                	mov    %edx,%eax
+     61f:	5b                   	pop    %ebx
+     620:	5e                   	pop    %esi
+     621:	5f                   	pop    %edi
+     622:	5d                   	pop    %ebp
+     623:	c3                   	ret
+     624:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  return *s && strchr(toks, *s);
+     628:	83 ec 08             	sub    $0x8,%esp
+     62b:	50                   	push   %eax
+     62c:	ff 75 10             	push   0x10(%ebp)
+     62f:	e8 ec 06 00 00       	call   d20 <strchr>
+     634:	83 c4 10             	add    $0x10,%esp
+     637:	31 d2                	xor    %edx,%edx
+     639:	85 c0                	test   %eax,%eax
+     63b:	0f 95 c2             	setne  %dl
+}
+     63e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     641:	5b                   	pop    %ebx
+     642:	89 d0                	mov    %edx,%eax
+     644:	5e                   	pop    %esi
+     645:	5f                   	pop    %edi
+     646:	5d                   	pop    %ebp
+     647:	c3                   	ret
+     648:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     64f:	90                   	nop
+
+00000650 <parseredirs>:
+  return cmd;
+}
+
+struct cmd*
+parseredirs(struct cmd *cmd, char **ps, char *es)
+{
+     650:	55                   	push   %ebp
+     651:	89 e5                	mov    %esp,%ebp
+     653:	57                   	push   %edi
+     654:	56                   	push   %esi
+     655:	53                   	push   %ebx
+     656:	83 ec 2c             	sub    $0x2c,%esp
+     659:	8b 75 0c             	mov    0xc(%ebp),%esi
+     65c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int tok;
+  char *q, *eq;
+
+  while(peek(ps, es, "<>")){
+     65f:	90                   	nop
+     660:	83 ec 04             	sub    $0x4,%esp
+     663:	68 74 17 00 00       	push   $0x1774
+     668:	53                   	push   %ebx
+     669:	56                   	push   %esi
+     66a:	e8 61 ff ff ff       	call   5d0 <peek>
+     66f:	83 c4 10             	add    $0x10,%esp
+     672:	85 c0                	test   %eax,%eax
+     674:	0f 84 f6 00 00 00    	je     770 <parseredirs+0x120>
+    tok = gettoken(ps, es, 0, 0);
+     67a:	6a 00                	push   $0x0
+     67c:	6a 00                	push   $0x0
+     67e:	53                   	push   %ebx
+     67f:	56                   	push   %esi
+     680:	e8 db fd ff ff       	call   460 <gettoken>
+     685:	89 c7                	mov    %eax,%edi
+    if(gettoken(ps, es, &q, &eq) != 'a')
+     687:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     68a:	50                   	push   %eax
+     68b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     68e:	50                   	push   %eax
+     68f:	53                   	push   %ebx
+     690:	56                   	push   %esi
+     691:	e8 ca fd ff ff       	call   460 <gettoken>
+     696:	83 c4 20             	add    $0x20,%esp
+     699:	83 f8 61             	cmp    $0x61,%eax
+     69c:	0f 85 d9 00 00 00    	jne    77b <parseredirs+0x12b>
+      panic("missing file for redirection");
+    switch(tok){
+     6a2:	83 ff 3c             	cmp    $0x3c,%edi
+     6a5:	74 69                	je     710 <parseredirs+0xc0>
+     6a7:	83 ff 3e             	cmp    $0x3e,%edi
+     6aa:	74 05                	je     6b1 <parseredirs+0x61>
+     6ac:	83 ff 2b             	cmp    $0x2b,%edi
+     6af:	75 af                	jne    660 <parseredirs+0x10>
+      break;
+    case '>':
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+      break;
+    case '+':  // >>
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6b1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     6b4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     6b7:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_WRONLY|O_CREATE, 1);
+     6ba:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     6bd:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     6c0:	6a 18                	push   $0x18
+     6c2:	e8 b9 0d 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     6c7:	83 c4 0c             	add    $0xc,%esp
+     6ca:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     6cc:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     6ce:	6a 00                	push   $0x0
+     6d0:	50                   	push   %eax
+     6d1:	e8 2a 06 00 00       	call   d00 <memset>
+  cmd->type = REDIR;
+     6d6:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+  cmd->cmd = subcmd;
+     6dc:	8b 45 08             	mov    0x8(%ebp),%eax
+      break;
+     6df:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     6e2:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     6e5:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     6e8:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     6eb:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->mode = mode;
+     6ee:	c7 47 10 01 02 00 00 	movl   $0x201,0x10(%edi)
+  cmd->efile = efile;
+     6f5:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->fd = fd;
+     6f8:	c7 47 14 01 00 00 00 	movl   $0x1,0x14(%edi)
+      break;
+     6ff:	89 7d 08             	mov    %edi,0x8(%ebp)
+     702:	e9 59 ff ff ff       	jmp    660 <parseredirs+0x10>
+     707:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70e:	66 90                	xchg   %ax,%ax
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     710:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     713:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  cmd = malloc(sizeof(*cmd));
+     716:	83 ec 0c             	sub    $0xc,%esp
+      cmd = redircmd(cmd, q, eq, O_RDONLY, 0);
+     719:	89 55 d0             	mov    %edx,-0x30(%ebp)
+     71c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  cmd = malloc(sizeof(*cmd));
+     71f:	6a 18                	push   $0x18
+     721:	e8 5a 0d 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     726:	83 c4 0c             	add    $0xc,%esp
+     729:	6a 18                	push   $0x18
+  cmd = malloc(sizeof(*cmd));
+     72b:	89 c7                	mov    %eax,%edi
+  memset(cmd, 0, sizeof(*cmd));
+     72d:	6a 00                	push   $0x0
+     72f:	50                   	push   %eax
+     730:	e8 cb 05 00 00       	call   d00 <memset>
+  cmd->cmd = subcmd;
+     735:	8b 45 08             	mov    0x8(%ebp),%eax
+  cmd->file = file;
+     738:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+      break;
+     73b:	89 7d 08             	mov    %edi,0x8(%ebp)
+  cmd->efile = efile;
+     73e:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  cmd->type = REDIR;
+     741:	c7 07 02 00 00 00    	movl   $0x2,(%edi)
+      break;
+     747:	83 c4 10             	add    $0x10,%esp
+  cmd->cmd = subcmd;
+     74a:	89 47 04             	mov    %eax,0x4(%edi)
+  cmd->file = file;
+     74d:	89 4f 08             	mov    %ecx,0x8(%edi)
+  cmd->efile = efile;
+     750:	89 57 0c             	mov    %edx,0xc(%edi)
+  cmd->mode = mode;
+     753:	c7 47 10 00 00 00 00 	movl   $0x0,0x10(%edi)
+  cmd->fd = fd;
+     75a:	c7 47 14 00 00 00 00 	movl   $0x0,0x14(%edi)
+      break;
+     761:	e9 fa fe ff ff       	jmp    660 <parseredirs+0x10>
+     766:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     76d:	8d 76 00             	lea    0x0(%esi),%esi
+    }
+  }
+  return cmd;
+}
+     770:	8b 45 08             	mov    0x8(%ebp),%eax
+     773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     776:	5b                   	pop    %ebx
+     777:	5e                   	pop    %esi
+     778:	5f                   	pop    %edi
+     779:	5d                   	pop    %ebp
+     77a:	c3                   	ret
+      panic("missing file for redirection");
+     77b:	83 ec 0c             	sub    $0xc,%esp
+     77e:	68 57 17 00 00       	push   $0x1757
+     783:	e8 d8 f9 ff ff       	call   160 <panic>
+     788:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     78f:	90                   	nop
+
+00000790 <parseexec>:
+  return cmd;
+}
+
+struct cmd*
+parseexec(char **ps, char *es)
+{
+     790:	55                   	push   %ebp
+     791:	89 e5                	mov    %esp,%ebp
+     793:	57                   	push   %edi
+     794:	56                   	push   %esi
+     795:	53                   	push   %ebx
+     796:	83 ec 30             	sub    $0x30,%esp
+     799:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     79c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *q, *eq;
+  int tok, argc;
+  struct execcmd *cmd;
+  struct cmd *ret;
+
+  if(peek(ps, es, "("))
+     79f:	68 77 17 00 00       	push   $0x1777
+     7a4:	56                   	push   %esi
+     7a5:	53                   	push   %ebx
+     7a6:	e8 25 fe ff ff       	call   5d0 <peek>
+     7ab:	83 c4 10             	add    $0x10,%esp
+     7ae:	85 c0                	test   %eax,%eax
+     7b0:	0f 85 aa 00 00 00    	jne    860 <parseexec+0xd0>
+  cmd = malloc(sizeof(*cmd));
+     7b6:	83 ec 0c             	sub    $0xc,%esp
+     7b9:	89 c7                	mov    %eax,%edi
+     7bb:	6a 54                	push   $0x54
+     7bd:	e8 be 0c 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     7c2:	83 c4 0c             	add    $0xc,%esp
+     7c5:	6a 54                	push   $0x54
+     7c7:	6a 00                	push   $0x0
+     7c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     7cc:	50                   	push   %eax
+     7cd:	e8 2e 05 00 00       	call   d00 <memset>
+  cmd->type = EXEC;
+     7d2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+
+  ret = execcmd();
+  cmd = (struct execcmd*)ret;
+
+  argc = 0;
+  ret = parseredirs(ret, ps, es);
+     7d5:	83 c4 0c             	add    $0xc,%esp
+  cmd->type = EXEC;
+     7d8:	c7 00 01 00 00 00    	movl   $0x1,(%eax)
+  ret = parseredirs(ret, ps, es);
+     7de:	56                   	push   %esi
+     7df:	53                   	push   %ebx
+     7e0:	50                   	push   %eax
+     7e1:	e8 6a fe ff ff       	call   650 <parseredirs>
+  while(!peek(ps, es, "|)&;")){
+     7e6:	83 c4 10             	add    $0x10,%esp
+  ret = parseredirs(ret, ps, es);
+     7e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     7ec:	eb 15                	jmp    803 <parseexec+0x73>
+     7ee:	66 90                	xchg   %ax,%ax
+    cmd->argv[argc] = q;
+    cmd->eargv[argc] = eq;
+    argc++;
+    if(argc >= MAXARGS)
+      panic("too many args");
+    ret = parseredirs(ret, ps, es);
+     7f0:	83 ec 04             	sub    $0x4,%esp
+     7f3:	56                   	push   %esi
+     7f4:	53                   	push   %ebx
+     7f5:	ff 75 d4             	push   -0x2c(%ebp)
+     7f8:	e8 53 fe ff ff       	call   650 <parseredirs>
+     7fd:	83 c4 10             	add    $0x10,%esp
+     800:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  while(!peek(ps, es, "|)&;")){
+     803:	83 ec 04             	sub    $0x4,%esp
+     806:	68 8e 17 00 00       	push   $0x178e
+     80b:	56                   	push   %esi
+     80c:	53                   	push   %ebx
+     80d:	e8 be fd ff ff       	call   5d0 <peek>
+     812:	83 c4 10             	add    $0x10,%esp
+     815:	85 c0                	test   %eax,%eax
+     817:	75 5f                	jne    878 <parseexec+0xe8>
+    if((tok=gettoken(ps, es, &q, &eq)) == 0)
+     819:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     81c:	50                   	push   %eax
+     81d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+     820:	50                   	push   %eax
+     821:	56                   	push   %esi
+     822:	53                   	push   %ebx
+     823:	e8 38 fc ff ff       	call   460 <gettoken>
+     828:	83 c4 10             	add    $0x10,%esp
+     82b:	85 c0                	test   %eax,%eax
+     82d:	74 49                	je     878 <parseexec+0xe8>
+    if(tok != 'a')
+     82f:	83 f8 61             	cmp    $0x61,%eax
+     832:	75 62                	jne    896 <parseexec+0x106>
+    cmd->argv[argc] = q;
+     834:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     837:	8b 55 d0             	mov    -0x30(%ebp),%edx
+     83a:	89 44 ba 04          	mov    %eax,0x4(%edx,%edi,4)
+    cmd->eargv[argc] = eq;
+     83e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     841:	89 44 ba 2c          	mov    %eax,0x2c(%edx,%edi,4)
+    argc++;
+     845:	83 c7 01             	add    $0x1,%edi
+    if(argc >= MAXARGS)
+     848:	83 ff 0a             	cmp    $0xa,%edi
+     84b:	75 a3                	jne    7f0 <parseexec+0x60>
+      panic("too many args");
+     84d:	83 ec 0c             	sub    $0xc,%esp
+     850:	68 80 17 00 00       	push   $0x1780
+     855:	e8 06 f9 ff ff       	call   160 <panic>
+     85a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    return parseblock(ps, es);
+     860:	89 75 0c             	mov    %esi,0xc(%ebp)
+     863:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  }
+  cmd->argv[argc] = 0;
+  cmd->eargv[argc] = 0;
+  return ret;
+}
+     866:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     869:	5b                   	pop    %ebx
+     86a:	5e                   	pop    %esi
+     86b:	5f                   	pop    %edi
+     86c:	5d                   	pop    %ebp
+    return parseblock(ps, es);
+     86d:	e9 ae 01 00 00       	jmp    a20 <parseblock>
+     872:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  cmd->argv[argc] = 0;
+     878:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     87b:	c7 44 b8 04 00 00 00 	movl   $0x0,0x4(%eax,%edi,4)
+     882:	00 
+  cmd->eargv[argc] = 0;
+     883:	c7 44 b8 2c 00 00 00 	movl   $0x0,0x2c(%eax,%edi,4)
+     88a:	00 
+}
+     88b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     88e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     891:	5b                   	pop    %ebx
+     892:	5e                   	pop    %esi
+     893:	5f                   	pop    %edi
+     894:	5d                   	pop    %ebp
+     895:	c3                   	ret
+      panic("syntax");
+     896:	83 ec 0c             	sub    $0xc,%esp
+     899:	68 79 17 00 00       	push   $0x1779
+     89e:	e8 bd f8 ff ff       	call   160 <panic>
+     8a3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008b0 <parsepipe>:
+{
+     8b0:	55                   	push   %ebp
+     8b1:	89 e5                	mov    %esp,%ebp
+     8b3:	57                   	push   %edi
+     8b4:	56                   	push   %esi
+     8b5:	53                   	push   %ebx
+     8b6:	83 ec 14             	sub    $0x14,%esp
+     8b9:	8b 75 08             	mov    0x8(%ebp),%esi
+     8bc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parseexec(ps, es);
+     8bf:	57                   	push   %edi
+     8c0:	56                   	push   %esi
+     8c1:	e8 ca fe ff ff       	call   790 <parseexec>
+  if(peek(ps, es, "|")){
+     8c6:	83 c4 0c             	add    $0xc,%esp
+     8c9:	68 93 17 00 00       	push   $0x1793
+  cmd = parseexec(ps, es);
+     8ce:	89 c3                	mov    %eax,%ebx
+  if(peek(ps, es, "|")){
+     8d0:	57                   	push   %edi
+     8d1:	56                   	push   %esi
+     8d2:	e8 f9 fc ff ff       	call   5d0 <peek>
+     8d7:	83 c4 10             	add    $0x10,%esp
+     8da:	85 c0                	test   %eax,%eax
+     8dc:	75 12                	jne    8f0 <parsepipe+0x40>
+}
+     8de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     8e1:	89 d8                	mov    %ebx,%eax
+     8e3:	5b                   	pop    %ebx
+     8e4:	5e                   	pop    %esi
+     8e5:	5f                   	pop    %edi
+     8e6:	5d                   	pop    %ebp
+     8e7:	c3                   	ret
+     8e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8ef:	90                   	nop
+    gettoken(ps, es, 0, 0);
+     8f0:	6a 00                	push   $0x0
+     8f2:	6a 00                	push   $0x0
+     8f4:	57                   	push   %edi
+     8f5:	56                   	push   %esi
+     8f6:	e8 65 fb ff ff       	call   460 <gettoken>
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     8fb:	58                   	pop    %eax
+     8fc:	5a                   	pop    %edx
+     8fd:	57                   	push   %edi
+     8fe:	56                   	push   %esi
+     8ff:	e8 ac ff ff ff       	call   8b0 <parsepipe>
+  cmd = malloc(sizeof(*cmd));
+     904:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = pipecmd(cmd, parsepipe(ps, es));
+     90b:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     90d:	e8 6e 0b 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     912:	83 c4 0c             	add    $0xc,%esp
+     915:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     917:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     919:	6a 00                	push   $0x0
+     91b:	50                   	push   %eax
+     91c:	e8 df 03 00 00       	call   d00 <memset>
+  cmd->left = left;
+     921:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     924:	83 c4 10             	add    $0x10,%esp
+     927:	89 f3                	mov    %esi,%ebx
+  cmd->type = PIPE;
+     929:	c7 06 03 00 00 00    	movl   $0x3,(%esi)
+}
+     92f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     931:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     934:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     937:	5b                   	pop    %ebx
+     938:	5e                   	pop    %esi
+     939:	5f                   	pop    %edi
+     93a:	5d                   	pop    %ebp
+     93b:	c3                   	ret
+     93c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000940 <parseline>:
+{
+     940:	55                   	push   %ebp
+     941:	89 e5                	mov    %esp,%ebp
+     943:	57                   	push   %edi
+     944:	56                   	push   %esi
+     945:	53                   	push   %ebx
+     946:	83 ec 24             	sub    $0x24,%esp
+     949:	8b 75 08             	mov    0x8(%ebp),%esi
+     94c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  cmd = parsepipe(ps, es);
+     94f:	57                   	push   %edi
+     950:	56                   	push   %esi
+     951:	e8 5a ff ff ff       	call   8b0 <parsepipe>
+  while(peek(ps, es, "&")){
+     956:	83 c4 10             	add    $0x10,%esp
+  cmd = parsepipe(ps, es);
+     959:	89 c3                	mov    %eax,%ebx
+  while(peek(ps, es, "&")){
+     95b:	eb 3b                	jmp    998 <parseline+0x58>
+     95d:	8d 76 00             	lea    0x0(%esi),%esi
+    gettoken(ps, es, 0, 0);
+     960:	6a 00                	push   $0x0
+     962:	6a 00                	push   $0x0
+     964:	57                   	push   %edi
+     965:	56                   	push   %esi
+     966:	e8 f5 fa ff ff       	call   460 <gettoken>
+  cmd = malloc(sizeof(*cmd));
+     96b:	c7 04 24 08 00 00 00 	movl   $0x8,(%esp)
+     972:	e8 09 0b 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     977:	83 c4 0c             	add    $0xc,%esp
+     97a:	6a 08                	push   $0x8
+     97c:	6a 00                	push   $0x0
+     97e:	50                   	push   %eax
+     97f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+     982:	e8 79 03 00 00       	call   d00 <memset>
+  cmd->type = BACK;
+     987:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  cmd->cmd = subcmd;
+     98a:	83 c4 10             	add    $0x10,%esp
+  cmd->type = BACK;
+     98d:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+  cmd->cmd = subcmd;
+     993:	89 5a 04             	mov    %ebx,0x4(%edx)
+     996:	89 d3                	mov    %edx,%ebx
+  while(peek(ps, es, "&")){
+     998:	83 ec 04             	sub    $0x4,%esp
+     99b:	68 95 17 00 00       	push   $0x1795
+     9a0:	57                   	push   %edi
+     9a1:	56                   	push   %esi
+     9a2:	e8 29 fc ff ff       	call   5d0 <peek>
+     9a7:	83 c4 10             	add    $0x10,%esp
+     9aa:	85 c0                	test   %eax,%eax
+     9ac:	75 b2                	jne    960 <parseline+0x20>
+  if(peek(ps, es, ";")){
+     9ae:	83 ec 04             	sub    $0x4,%esp
+     9b1:	68 91 17 00 00       	push   $0x1791
+     9b6:	57                   	push   %edi
+     9b7:	56                   	push   %esi
+     9b8:	e8 13 fc ff ff       	call   5d0 <peek>
+     9bd:	83 c4 10             	add    $0x10,%esp
+     9c0:	85 c0                	test   %eax,%eax
+     9c2:	75 0c                	jne    9d0 <parseline+0x90>
+}
+     9c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     9c7:	89 d8                	mov    %ebx,%eax
+     9c9:	5b                   	pop    %ebx
+     9ca:	5e                   	pop    %esi
+     9cb:	5f                   	pop    %edi
+     9cc:	5d                   	pop    %ebp
+     9cd:	c3                   	ret
+     9ce:	66 90                	xchg   %ax,%ax
+    gettoken(ps, es, 0, 0);
+     9d0:	6a 00                	push   $0x0
+     9d2:	6a 00                	push   $0x0
+     9d4:	57                   	push   %edi
+     9d5:	56                   	push   %esi
+     9d6:	e8 85 fa ff ff       	call   460 <gettoken>
+    cmd = listcmd(cmd, parseline(ps, es));
+     9db:	58                   	pop    %eax
+     9dc:	5a                   	pop    %edx
+     9dd:	57                   	push   %edi
+     9de:	56                   	push   %esi
+     9df:	e8 5c ff ff ff       	call   940 <parseline>
+  cmd = malloc(sizeof(*cmd));
+     9e4:	c7 04 24 0c 00 00 00 	movl   $0xc,(%esp)
+    cmd = listcmd(cmd, parseline(ps, es));
+     9eb:	89 c7                	mov    %eax,%edi
+  cmd = malloc(sizeof(*cmd));
+     9ed:	e8 8e 0a 00 00       	call   1480 <malloc>
+  memset(cmd, 0, sizeof(*cmd));
+     9f2:	83 c4 0c             	add    $0xc,%esp
+     9f5:	6a 0c                	push   $0xc
+  cmd = malloc(sizeof(*cmd));
+     9f7:	89 c6                	mov    %eax,%esi
+  memset(cmd, 0, sizeof(*cmd));
+     9f9:	6a 00                	push   $0x0
+     9fb:	50                   	push   %eax
+     9fc:	e8 ff 02 00 00       	call   d00 <memset>
+  cmd->left = left;
+     a01:	89 5e 04             	mov    %ebx,0x4(%esi)
+  cmd->right = right;
+     a04:	83 c4 10             	add    $0x10,%esp
+     a07:	89 f3                	mov    %esi,%ebx
+  cmd->type = LIST;
+     a09:	c7 06 04 00 00 00    	movl   $0x4,(%esi)
+}
+     a0f:	89 d8                	mov    %ebx,%eax
+  cmd->right = right;
+     a11:	89 7e 08             	mov    %edi,0x8(%esi)
+}
+     a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a17:	5b                   	pop    %ebx
+     a18:	5e                   	pop    %esi
+     a19:	5f                   	pop    %edi
+     a1a:	5d                   	pop    %ebp
+     a1b:	c3                   	ret
+     a1c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000a20 <parseblock>:
+{
+     a20:	55                   	push   %ebp
+     a21:	89 e5                	mov    %esp,%ebp
+     a23:	57                   	push   %edi
+     a24:	56                   	push   %esi
+     a25:	53                   	push   %ebx
+     a26:	83 ec 10             	sub    $0x10,%esp
+     a29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     a2c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if(!peek(ps, es, "("))
+     a2f:	68 77 17 00 00       	push   $0x1777
+     a34:	56                   	push   %esi
+     a35:	53                   	push   %ebx
+     a36:	e8 95 fb ff ff       	call   5d0 <peek>
+     a3b:	83 c4 10             	add    $0x10,%esp
+     a3e:	85 c0                	test   %eax,%eax
+     a40:	74 4a                	je     a8c <parseblock+0x6c>
+  gettoken(ps, es, 0, 0);
+     a42:	6a 00                	push   $0x0
+     a44:	6a 00                	push   $0x0
+     a46:	56                   	push   %esi
+     a47:	53                   	push   %ebx
+     a48:	e8 13 fa ff ff       	call   460 <gettoken>
+  cmd = parseline(ps, es);
+     a4d:	58                   	pop    %eax
+     a4e:	5a                   	pop    %edx
+     a4f:	56                   	push   %esi
+     a50:	53                   	push   %ebx
+     a51:	e8 ea fe ff ff       	call   940 <parseline>
+  if(!peek(ps, es, ")"))
+     a56:	83 c4 0c             	add    $0xc,%esp
+     a59:	68 b3 17 00 00       	push   $0x17b3
+  cmd = parseline(ps, es);
+     a5e:	89 c7                	mov    %eax,%edi
+  if(!peek(ps, es, ")"))
+     a60:	56                   	push   %esi
+     a61:	53                   	push   %ebx
+     a62:	e8 69 fb ff ff       	call   5d0 <peek>
+     a67:	83 c4 10             	add    $0x10,%esp
+     a6a:	85 c0                	test   %eax,%eax
+     a6c:	74 2b                	je     a99 <parseblock+0x79>
+  gettoken(ps, es, 0, 0);
+     a6e:	6a 00                	push   $0x0
+     a70:	6a 00                	push   $0x0
+     a72:	56                   	push   %esi
+     a73:	53                   	push   %ebx
+     a74:	e8 e7 f9 ff ff       	call   460 <gettoken>
+  cmd = parseredirs(cmd, ps, es);
+     a79:	83 c4 0c             	add    $0xc,%esp
+     a7c:	56                   	push   %esi
+     a7d:	53                   	push   %ebx
+     a7e:	57                   	push   %edi
+     a7f:	e8 cc fb ff ff       	call   650 <parseredirs>
+}
+     a84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a87:	5b                   	pop    %ebx
+     a88:	5e                   	pop    %esi
+     a89:	5f                   	pop    %edi
+     a8a:	5d                   	pop    %ebp
+     a8b:	c3                   	ret
+    panic("parseblock");
+     a8c:	83 ec 0c             	sub    $0xc,%esp
+     a8f:	68 97 17 00 00       	push   $0x1797
+     a94:	e8 c7 f6 ff ff       	call   160 <panic>
+    panic("syntax - missing )");
+     a99:	83 ec 0c             	sub    $0xc,%esp
+     a9c:	68 a2 17 00 00       	push   $0x17a2
+     aa1:	e8 ba f6 ff ff       	call   160 <panic>
+     aa6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     aad:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ab0 <nulterminate>:
+
+// NUL-terminate all the counted strings.
+struct cmd*
+nulterminate(struct cmd *cmd)
+{
+     ab0:	55                   	push   %ebp
+     ab1:	89 e5                	mov    %esp,%ebp
+     ab3:	53                   	push   %ebx
+     ab4:	83 ec 04             	sub    $0x4,%esp
+     ab7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct execcmd *ecmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     aba:	85 db                	test   %ebx,%ebx
+     abc:	0f 84 7e 00 00 00    	je     b40 <nulterminate+0x90>
+    return 0;
+
+  switch(cmd->type){
+     ac2:	83 3b 05             	cmpl   $0x5,(%ebx)
+     ac5:	77 20                	ja     ae7 <nulterminate+0x37>
+     ac7:	8b 03                	mov    (%ebx),%eax
+     ac9:	ff 24 85 f8 17 00 00 	jmp    *0x17f8(,%eax,4)
+    nulterminate(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    nulterminate(lcmd->left);
+     ad0:	83 ec 0c             	sub    $0xc,%esp
+     ad3:	ff 73 04             	push   0x4(%ebx)
+     ad6:	e8 d5 ff ff ff       	call   ab0 <nulterminate>
+    nulterminate(lcmd->right);
+     adb:	58                   	pop    %eax
+     adc:	ff 73 08             	push   0x8(%ebx)
+     adf:	e8 cc ff ff ff       	call   ab0 <nulterminate>
+    break;
+     ae4:	83 c4 10             	add    $0x10,%esp
+    return 0;
+     ae7:	89 d8                	mov    %ebx,%eax
+    bcmd = (struct backcmd*)cmd;
+    nulterminate(bcmd->cmd);
+    break;
+  }
+  return cmd;
+}
+     ae9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     aec:	c9                   	leave
+     aed:	c3                   	ret
+     aee:	66 90                	xchg   %ax,%ax
+    nulterminate(bcmd->cmd);
+     af0:	83 ec 0c             	sub    $0xc,%esp
+     af3:	ff 73 04             	push   0x4(%ebx)
+     af6:	e8 b5 ff ff ff       	call   ab0 <nulterminate>
+    break;
+     afb:	83 c4 10             	add    $0x10,%esp
+     afe:	eb e7                	jmp    ae7 <nulterminate+0x37>
+    for(i=0; ecmd->argv[i]; i++)
+     b00:	8b 4b 04             	mov    0x4(%ebx),%ecx
+     b03:	8d 43 08             	lea    0x8(%ebx),%eax
+     b06:	85 c9                	test   %ecx,%ecx
+     b08:	74 dd                	je     ae7 <nulterminate+0x37>
+     b0a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      *ecmd->eargv[i] = 0;
+     b10:	8b 50 24             	mov    0x24(%eax),%edx
+    for(i=0; ecmd->argv[i]; i++)
+     b13:	83 c0 04             	add    $0x4,%eax
+      *ecmd->eargv[i] = 0;
+     b16:	c6 02 00             	movb   $0x0,(%edx)
+    for(i=0; ecmd->argv[i]; i++)
+     b19:	8b 50 fc             	mov    -0x4(%eax),%edx
+     b1c:	85 d2                	test   %edx,%edx
+     b1e:	75 f0                	jne    b10 <nulterminate+0x60>
+     b20:	eb c5                	jmp    ae7 <nulterminate+0x37>
+     b22:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    nulterminate(rcmd->cmd);
+     b28:	83 ec 0c             	sub    $0xc,%esp
+     b2b:	ff 73 04             	push   0x4(%ebx)
+     b2e:	e8 7d ff ff ff       	call   ab0 <nulterminate>
+    *rcmd->efile = 0;
+     b33:	8b 43 0c             	mov    0xc(%ebx),%eax
+    break;
+     b36:	83 c4 10             	add    $0x10,%esp
+    *rcmd->efile = 0;
+     b39:	c6 00 00             	movb   $0x0,(%eax)
+    break;
+     b3c:	eb a9                	jmp    ae7 <nulterminate+0x37>
+     b3e:	66 90                	xchg   %ax,%ax
+    return 0;
+     b40:	31 c0                	xor    %eax,%eax
+     b42:	eb a5                	jmp    ae9 <nulterminate+0x39>
+     b44:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     b4f:	90                   	nop
+
+00000b50 <parsecmd>:
+{
+     b50:	55                   	push   %ebp
+     b51:	89 e5                	mov    %esp,%ebp
+     b53:	57                   	push   %edi
+     b54:	56                   	push   %esi
+  cmd = parseline(&s, es);
+     b55:	8d 7d 08             	lea    0x8(%ebp),%edi
+{
+     b58:	53                   	push   %ebx
+     b59:	83 ec 18             	sub    $0x18,%esp
+  es = s + strlen(s);
+     b5c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     b5f:	53                   	push   %ebx
+     b60:	e8 6b 01 00 00       	call   cd0 <strlen>
+  cmd = parseline(&s, es);
+     b65:	59                   	pop    %ecx
+     b66:	5e                   	pop    %esi
+  es = s + strlen(s);
+     b67:	01 c3                	add    %eax,%ebx
+  cmd = parseline(&s, es);
+     b69:	53                   	push   %ebx
+     b6a:	57                   	push   %edi
+     b6b:	e8 d0 fd ff ff       	call   940 <parseline>
+  peek(&s, es, "");
+     b70:	83 c4 0c             	add    $0xc,%esp
+     b73:	68 41 17 00 00       	push   $0x1741
+  cmd = parseline(&s, es);
+     b78:	89 c6                	mov    %eax,%esi
+  peek(&s, es, "");
+     b7a:	53                   	push   %ebx
+     b7b:	57                   	push   %edi
+     b7c:	e8 4f fa ff ff       	call   5d0 <peek>
+  if(s != es){
+     b81:	8b 45 08             	mov    0x8(%ebp),%eax
+     b84:	83 c4 10             	add    $0x10,%esp
+     b87:	39 d8                	cmp    %ebx,%eax
+     b89:	75 13                	jne    b9e <parsecmd+0x4e>
+  nulterminate(cmd);
+     b8b:	83 ec 0c             	sub    $0xc,%esp
+     b8e:	56                   	push   %esi
+     b8f:	e8 1c ff ff ff       	call   ab0 <nulterminate>
+}
+     b94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     b97:	89 f0                	mov    %esi,%eax
+     b99:	5b                   	pop    %ebx
+     b9a:	5e                   	pop    %esi
+     b9b:	5f                   	pop    %edi
+     b9c:	5d                   	pop    %ebp
+     b9d:	c3                   	ret
+    printf(2, "leftovers: %s\n", s);
+     b9e:	52                   	push   %edx
+     b9f:	50                   	push   %eax
+     ba0:	68 b5 17 00 00       	push   $0x17b5
+     ba5:	6a 02                	push   $0x2
+     ba7:	e8 94 06 00 00       	call   1240 <printf>
+    panic("syntax");
+     bac:	c7 04 24 79 17 00 00 	movl   $0x1779,(%esp)
+     bb3:	e8 a8 f5 ff ff       	call   160 <panic>
+     bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     bbf:	90                   	nop
+
+00000bc0 <freecmd>:
+
+// Free the nodes of a command built by parsecmd.
+void
+freecmd(struct cmd *cmd)
+{
+     bc0:	55                   	push   %ebp
+     bc1:	89 e5                	mov    %esp,%ebp
+     bc3:	53                   	push   %ebx
+     bc4:	83 ec 04             	sub    $0x4,%esp
+     bc7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct backcmd *bcmd;
+  struct listcmd *lcmd;
+  struct pipecmd *pcmd;
+  struct redircmd *rcmd;
+
+  if(cmd == 0)
+     bca:	85 db                	test   %ebx,%ebx
+     bcc:	74 62                	je     c30 <freecmd+0x70>
+    return;
+
+  switch(cmd->type){
+     bce:	8b 03                	mov    (%ebx),%eax
+     bd0:	83 f8 04             	cmp    $0x4,%eax
+     bd3:	74 0c                	je     be1 <freecmd+0x21>
+     bd5:	7f 31                	jg     c08 <freecmd+0x48>
+     bd7:	83 f8 02             	cmp    $0x2,%eax
+     bda:	74 31                	je     c0d <freecmd+0x4d>
+     bdc:	83 f8 03             	cmp    $0x3,%eax
+     bdf:	75 17                	jne    bf8 <freecmd+0x38>
+    freecmd(pcmd->right);
+    break;
+
+  case LIST:
+    lcmd = (struct listcmd*)cmd;
+    freecmd(lcmd->left);
+     be1:	83 ec 0c             	sub    $0xc,%esp
+     be4:	ff 73 04             	push   0x4(%ebx)
+     be7:	e8 d4 ff ff ff       	call   bc0 <freecmd>
+    freecmd(lcmd->right);
+     bec:	58                   	pop    %eax
+     bed:	ff 73 08             	push   0x8(%ebx)
+     bf0:	e8 cb ff ff ff       	call   bc0 <freecmd>
+    break;
+     bf5:	83 c4 10             	add    $0x10,%esp
+  case BACK:
+    bcmd = (struct backcmd*)cmd;
+    freecmd(bcmd->cmd);
+    break;
+  }
+  free(cmd);
+     bf8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+}
+     bfb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     bfe:	c9                   	leave
+  free(cmd);
+     bff:	e9 ec 07 00 00       	jmp    13f0 <free>
+     c04:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  switch(cmd->type){
+     c08:	83 f8 05             	cmp    $0x5,%eax
+     c0b:	75 eb                	jne    bf8 <freecmd+0x38>
+    freecmd(bcmd->cmd);
+     c0d:	83 ec 0c             	sub    $0xc,%esp
+     c10:	ff 73 04             	push   0x4(%ebx)
+     c13:	e8 a8 ff ff ff       	call   bc0 <freecmd>
+  free(cmd);
+     c18:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    break;
+     c1b:	83 c4 10             	add    $0x10,%esp
+}
+     c1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c21:	c9                   	leave
+  free(cmd);
+     c22:	e9 c9 07 00 00       	jmp    13f0 <free>
+     c27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c2e:	66 90                	xchg   %ax,%ax
+}
+     c30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c33:	c9                   	leave
+     c34:	c3                   	ret
+     c35:	66 90                	xchg   %ax,%ax
+     c37:	66 90                	xchg   %ax,%ax
+     c39:	66 90                	xchg   %ax,%ax
+     c3b:	66 90                	xchg   %ax,%ax
+     c3d:	66 90                	xchg   %ax,%ax
+     c3f:	90                   	nop
+
+00000c40 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+     c40:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+     c41:	31 c0                	xor    %eax,%eax
+{
+     c43:	89 e5                	mov    %esp,%ebp
+     c45:	53                   	push   %ebx
+     c46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     c49:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+     c4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+     c50:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+     c54:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+     c57:	83 c0 01             	add    $0x1,%eax
+     c5a:	84 d2                	test   %dl,%dl
+     c5c:	75 f2                	jne    c50 <strcpy+0x10>
+    ;
+  return os;
+}
+     c5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     c61:	89 c8                	mov    %ecx,%eax
+     c63:	c9                   	leave
+     c64:	c3                   	ret
+     c65:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     c6c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000c70 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+     c70:	55                   	push   %ebp
+     c71:	89 e5                	mov    %esp,%ebp
+     c73:	53                   	push   %ebx
+     c74:	8b 55 08             	mov    0x8(%ebp),%edx
+     c77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+     c7a:	0f b6 02             	movzbl (%edx),%eax
+     c7d:	84 c0                	test   %al,%al
+     c7f:	75 17                	jne    c98 <strcmp+0x28>
+     c81:	eb 3a                	jmp    cbd <strcmp+0x4d>
+     c83:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c87:	90                   	nop
+     c88:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+     c8c:	83 c2 01             	add    $0x1,%edx
+     c8f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+     c92:	84 c0                	test   %al,%al
+     c94:	74 1a                	je     cb0 <strcmp+0x40>
+    p++, q++;
+     c96:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+     c98:	0f b6 19             	movzbl (%ecx),%ebx
+     c9b:	38 c3                	cmp    %al,%bl
+     c9d:	74 e9                	je     c88 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+     c9f:	29 d8                	sub    %ebx,%eax
+}
+     ca1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     ca4:	c9                   	leave
+     ca5:	c3                   	ret
+     ca6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cad:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+     cb0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+     cb4:	31 c0                	xor    %eax,%eax
+     cb6:	29 d8                	sub    %ebx,%eax
+}
+     cb8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     cbb:	c9                   	leave
+     cbc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+     cbd:	0f b6 19             	movzbl (%ecx),%ebx
+     cc0:	31 c0                	xor    %eax,%eax
+     cc2:	eb db                	jmp    c9f <strcmp+0x2f>
+     cc4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ccb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     ccf:	90                   	nop
+
+00000cd0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+     cd0:	55                   	push   %ebp
+     cd1:	89 e5                	mov    %esp,%ebp
+     cd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+     cd6:	80 3a 00             	cmpb   $0x0,(%edx)
+     cd9:	74 15                	je     cf0 <strlen+0x20>
+     cdb:	31 c0                	xor    %eax,%eax
+     cdd:	8d 76 00             	lea    0x0(%esi),%esi
+     ce0:	83 c0 01             	add    $0x1,%eax
+     ce3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+     ce7:	89 c1                	mov    %eax,%ecx
+     ce9:	75 f5                	jne    ce0 <strlen+0x10>
+    ;
+  return n;
+}
+     ceb:	89 c8                	mov    %ecx,%eax
+     ced:	5d                   	pop    %ebp
+     cee:	c3                   	ret
+     cef:	90                   	nop
+  for(n = 0; s[n]; n++)
+     cf0:	31 c9                	xor    %ecx,%ecx
+}
+     cf2:	5d                   	pop    %ebp
+     cf3:	89 c8                	mov    %ecx,%eax
+     cf5:	c3                   	ret
+     cf6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     cfd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000d00 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+     d00:	55                   	push   %ebp
+     d01:	89 e5                	mov    %esp,%ebp
+     d03:	57                   	push   %edi
+     d04:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+     d07:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     d0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     d0d:	89 d7                	mov    %edx,%edi
+     d0f:	fc                   	cld
+     d10:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+     d12:	8b 7d fc             	mov    -0x4(%ebp),%edi
+     d15:	89 d0                	mov    %edx,%eax
+     d17:	c9                   	leave
+     d18:	c3                   	ret
+     d19:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000d20 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+     d20:	55                   	push   %ebp
+     d21:	89 e5                	mov    %esp,%ebp
+     d23:	8b 45 08             	mov    0x8(%ebp),%eax
+     d26:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+     d2a:	0f b6 10             	movzbl (%eax),%edx
+     d2d:	84 d2                	test   %dl,%dl
+     d2f:	75 12                	jne    d43 <strchr+0x23>
+     d31:	eb 1d                	jmp    d50 <strchr+0x30>
+     d33:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d37:	90                   	nop
+     d38:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+     d3c:	83 c0 01             	add    $0x1,%eax
+     d3f:	84 d2                	test   %dl,%dl
+     d41:	74 0d                	je     d50 <strchr+0x30>
+    if(*s == c)
+     d43:	38 d1                	cmp    %dl,%cl
+     d45:	75 f1                	jne    d38 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+     d47:	5d                   	pop    %ebp
+     d48:	c3                   	ret
+     d49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+     d50:	31 c0                	xor    %eax,%eax
+}
+     d52:	5d                   	pop    %ebp
+     d53:	c3                   	ret
+     d54:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     d5b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     d5f:	90                   	nop
+
+00000d60 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+     d60:	55                   	push   %ebp
+     d61:	89 e5                	mov    %esp,%ebp
+     d63:	57                   	push   %edi
+     d64:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+     d65:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+     d68:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+     d69:	31 db                	xor    %ebx,%ebx
+{
+     d6b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+     d6e:	eb 27                	jmp    d97 <gets+0x37>
+    cc = read(0, &c, 1);
+     d70:	83 ec 04             	sub    $0x4,%esp
+     d73:	6a 01                	push   $0x1
+     d75:	56                   	push   %esi
+     d76:	6a 00                	push   $0x0
+     d78:	e8 cf 02 00 00       	call   104c <read>
+    if(cc < 1)
+     d7d:	83 c4 10             	add    $0x10,%esp
+     d80:	85 c0                	test   %eax,%eax
+     d82:	7e 1d                	jle    da1 <gets+0x41>
+      break;
+    buf[i++] = c;
+     d84:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+     d88:	8b 55 08             	mov    0x8(%ebp),%edx
+     d8b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+     d8f:	3c 0a                	cmp    $0xa,%al
+     d91:	74 10                	je     da3 <gets+0x43>
+     d93:	3c 0d                	cmp    $0xd,%al
+     d95:	74 0c                	je     da3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+     d97:	89 df                	mov    %ebx,%edi
+     d99:	83 c3 01             	add    $0x1,%ebx
+     d9c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+     d9f:	7c cf                	jl     d70 <gets+0x10>
+     da1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+     da3:	8b 45 08             	mov    0x8(%ebp),%eax
+     da6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+     daa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     dad:	5b                   	pop    %ebx
+     dae:	5e                   	pop    %esi
+     daf:	5f                   	pop    %edi
+     db0:	5d                   	pop    %ebp
+     db1:	c3                   	ret
+     db2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     db9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000dc0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+     dc0:	55                   	push   %ebp
+     dc1:	89 e5                	mov    %esp,%ebp
+     dc3:	56                   	push   %esi
+     dc4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+     dc5:	83 ec 08             	sub    $0x8,%esp
+     dc8:	6a 00                	push   $0x0
+     dca:	ff 75 08             	push   0x8(%ebp)
+     dcd:	e8 a2 02 00 00       	call   1074 <open>
+  if(fd < 0)
+     dd2:	83 c4 10             	add    $0x10,%esp
+     dd5:	85 c0                	test   %eax,%eax
+     dd7:	78 27                	js     e00 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+     dd9:	83 ec 08             	sub    $0x8,%esp
+     ddc:	ff 75 0c             	push   0xc(%ebp)
+     ddf:	89 c3                	mov    %eax,%ebx
+     de1:	50                   	push   %eax
+     de2:	e8 a5 02 00 00       	call   108c <fstat>
+  close(fd);
+     de7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+     dea:	89 c6                	mov    %eax,%esi
+  close(fd);
+     dec:	e8 6b 02 00 00       	call   105c <close>
+  return r;
+     df1:	83 c4 10             	add    $0x10,%esp
+}
+     df4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     df7:	89 f0                	mov    %esi,%eax
+     df9:	5b                   	pop    %ebx
+     dfa:	5e                   	pop    %esi
+     dfb:	5d                   	pop    %ebp
+     dfc:	c3                   	ret
+     dfd:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+     e00:	be ff ff ff ff       	mov    $0xffffffff,%esi
+     e05:	eb ed                	jmp    df4 <stat+0x34>
+     e07:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e0e:	66 90                	xchg   %ax,%ax
+
+00000e10 <atoi>:
+
+int
+atoi(const char *s)
+{
+     e10:	55                   	push   %ebp
+     e11:	89 e5                	mov    %esp,%ebp
+     e13:	53                   	push   %ebx
+     e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+     e17:	0f be 02             	movsbl (%edx),%eax
+     e1a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+     e1d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+     e20:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+     e25:	77 1e                	ja     e45 <atoi+0x35>
+     e27:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e2e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+     e30:	83 c2 01             	add    $0x1,%edx
+     e33:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+     e36:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+     e3a:	0f be 02             	movsbl (%edx),%eax
+     e3d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+     e40:	80 fb 09             	cmp    $0x9,%bl
+     e43:	76 eb                	jbe    e30 <atoi+0x20>
+  return n;
+}
+     e45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     e48:	89 c8                	mov    %ecx,%eax
+     e4a:	c9                   	leave
+     e4b:	c3                   	ret
+     e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000e50 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+     e50:	55                   	push   %ebp
+     e51:	89 e5                	mov    %esp,%ebp
+     e53:	57                   	push   %edi
+     e54:	56                   	push   %esi
+     e55:	8b 45 10             	mov    0x10(%ebp),%eax
+     e58:	8b 55 08             	mov    0x8(%ebp),%edx
+     e5b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+     e5e:	85 c0                	test   %eax,%eax
+     e60:	7e 13                	jle    e75 <memmove+0x25>
+     e62:	01 d0                	add    %edx,%eax
+  dst = vdst;
+     e64:	89 d7                	mov    %edx,%edi
+     e66:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e6d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+     e70:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+     e71:	39 f8                	cmp    %edi,%eax
+     e73:	75 fb                	jne    e70 <memmove+0x20>
+  return vdst;
+}
+     e75:	5e                   	pop    %esi
+     e76:	89 d0                	mov    %edx,%eax
+     e78:	5f                   	pop    %edi
+     e79:	5d                   	pop    %ebp
+     e7a:	c3                   	ret
+     e7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e7f:	90                   	nop
+
+00000e80 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+     e83:	8b 45 08             	mov    0x8(%ebp),%eax
+     e86:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     e8c:	5d                   	pop    %ebp
+     e8d:	c3                   	ret
+     e8e:	66 90                	xchg   %ax,%ax
+
+00000e90 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+     e90:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+     e91:	b9 01 00 00 00       	mov    $0x1,%ecx
+     e96:	89 e5                	mov    %esp,%ebp
+     e98:	8b 55 08             	mov    0x8(%ebp),%edx
+     e9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     e9f:	90                   	nop
+     ea0:	89 c8                	mov    %ecx,%eax
+     ea2:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+     ea5:	85 c0                	test   %eax,%eax
+     ea7:	75 f7                	jne    ea0 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+     ea9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+     eae:	5d                   	pop    %ebp
+     eaf:	c3                   	ret
+
+00000eb0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+     eb0:	55                   	push   %ebp
+     eb1:	31 c0                	xor    %eax,%eax
+     eb3:	89 e5                	mov    %esp,%ebp
+     eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+     eb8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+     ebd:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+     ec0:	5d                   	pop    %ebp
+     ec1:	c3                   	ret
+     ec2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     ec9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000ed0 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+     ed0:	55                   	push   %ebp
+     ed1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     ed3:	8b 45 08             	mov    0x8(%ebp),%eax
+     ed6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     edc:	5d                   	pop    %ebp
+     edd:	c3                   	ret
+     ede:	66 90                	xchg   %ax,%ax
+
+00000ee0 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+     ee0:	55                   	push   %ebp
+     ee1:	b8 01 00 00 00       	mov    $0x1,%eax
+     ee6:	89 e5                	mov    %esp,%ebp
+     ee8:	56                   	push   %esi
+     ee9:	53                   	push   %ebx
+     eea:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     eed:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+     ef0:	85 c0                	test   %eax,%eax
+     ef2:	74 2d                	je     f21 <mutex_lock+0x41>
+     ef4:	b8 02 00 00 00       	mov    $0x2,%eax
+     ef9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+     efc:	85 c0                	test   %eax,%eax
+     efe:	74 21                	je     f21 <mutex_lock+0x41>
+     f00:	be 02 00 00 00       	mov    $0x2,%esi
+     f05:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+     f08:	83 ec 04             	sub    $0x4,%esp
+     f0b:	6a 02                	push   $0x2
+     f0d:	6a 00                	push   $0x0
+     f0f:	53                   	push   %ebx
+     f10:	e8 37 02 00 00       	call   114c <futex>
+     f15:	89 f0                	mov    %esi,%eax
+     f17:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     f1a:	83 c4 10             	add    $0x10,%esp
+     f1d:	85 c0                	test   %eax,%eax
+     f1f:	75 e7                	jne    f08 <mutex_lock+0x28>
+}
+     f21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     f24:	5b                   	pop    %ebx
+     f25:	5e                   	pop    %esi
+     f26:	5d                   	pop    %ebp
+     f27:	c3                   	ret
+     f28:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     f2f:	90                   	nop
+
+00000f30 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+     f30:	55                   	push   %ebp
+     f31:	31 c0                	xor    %eax,%eax
+     f33:	89 e5                	mov    %esp,%ebp
+     f35:	83 ec 08             	sub    $0x8,%esp
+     f38:	8b 55 08             	mov    0x8(%ebp),%edx
+     f3b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+     f3e:	83 f8 02             	cmp    $0x2,%eax
+     f41:	74 05                	je     f48 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+     f43:	c9                   	leave
+     f44:	c3                   	ret
+     f45:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     f48:	83 ec 04             	sub    $0x4,%esp
+     f4b:	6a 01                	push   $0x1
+     f4d:	6a 01                	push   $0x1
+     f4f:	52                   	push   %edx
+     f50:	e8 f7 01 00 00       	call   114c <futex>
+     f55:	83 c4 10             	add    $0x10,%esp
+}
+     f58:	c9                   	leave
+     f59:	c3                   	ret
+     f5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000f60 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+     f60:	55                   	push   %ebp
+     f61:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     f63:	8b 45 08             	mov    0x8(%ebp),%eax
+     f66:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     f6c:	5d                   	pop    %ebp
+     f6d:	c3                   	ret
+     f6e:	66 90                	xchg   %ax,%ax
+
+00000f70 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+     f70:	55                   	push   %ebp
+     f71:	31 c0                	xor    %eax,%eax
+     f73:	89 e5                	mov    %esp,%ebp
+     f75:	57                   	push   %edi
+     f76:	56                   	push   %esi
+     f77:	53                   	push   %ebx
+     f78:	83 ec 0c             	sub    $0xc,%esp
+     f7b:	8b 75 08             	mov    0x8(%ebp),%esi
+     f7e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+     f81:	8b 3e                	mov    (%esi),%edi
+     f83:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+     f86:	83 f8 02             	cmp    $0x2,%eax
+     f89:	74 4d                	je     fd8 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+     f8b:	83 ec 04             	sub    $0x4,%esp
+     f8e:	57                   	push   %edi
+     f8f:	6a 00                	push   $0x0
+     f91:	56                   	push   %esi
+     f92:	e8 b5 01 00 00       	call   114c <futex>
+     f97:	b8 02 00 00 00       	mov    $0x2,%eax
+     f9c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+     f9f:	83 c4 10             	add    $0x10,%esp
+     fa2:	85 c0                	test   %eax,%eax
+     fa4:	74 23                	je     fc9 <cond_wait+0x59>
+     fa6:	be 02 00 00 00       	mov    $0x2,%esi
+     fab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     faf:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+     fb0:	83 ec 04             	sub    $0x4,%esp
+     fb3:	6a 02                	push   $0x2
+     fb5:	6a 00                	push   $0x0
+     fb7:	53                   	push   %ebx
+     fb8:	e8 8f 01 00 00       	call   114c <futex>
+     fbd:	89 f0                	mov    %esi,%eax
+     fbf:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+     fc2:	83 c4 10             	add    $0x10,%esp
+     fc5:	85 c0                	test   %eax,%eax
+     fc7:	75 e7                	jne    fb0 <cond_wait+0x40>
+}
+     fc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     fcc:	5b                   	pop    %ebx
+     fcd:	5e                   	pop    %esi
+     fce:	5f                   	pop    %edi
+     fcf:	5d                   	pop    %ebp
+     fd0:	c3                   	ret
+     fd1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+     fd8:	83 ec 04             	sub    $0x4,%esp
+     fdb:	6a 01                	push   $0x1
+     fdd:	6a 01                	push   $0x1
+     fdf:	53                   	push   %ebx
+     fe0:	e8 67 01 00 00       	call   114c <futex>
+     fe5:	83 c4 10             	add    $0x10,%esp
+     fe8:	eb a1                	jmp    f8b <cond_wait+0x1b>
+     fea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000ff0 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+     ff0:	55                   	push   %ebp
+     ff1:	89 e5                	mov    %esp,%ebp
+     ff3:	83 ec 0c             	sub    $0xc,%esp
+     ff6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+     ff9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+     ffd:	6a 01                	push   $0x1
+     fff:	6a 01                	push   $0x1
+    1001:	50                   	push   %eax
+    1002:	e8 45 01 00 00       	call   114c <futex>
+}
+    1007:	83 c4 10             	add    $0x10,%esp
+    100a:	c9                   	leave
+    100b:	c3                   	ret
+    100c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001010 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    1010:	55                   	push   %ebp
+    1011:	89 e5                	mov    %esp,%ebp
+    1013:	83 ec 0c             	sub    $0xc,%esp
+    1016:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    1019:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+    101d:	6a ff                	push   $0xffffffff
+    101f:	6a 01                	push   $0x1
+    1021:	50                   	push   %eax
+    1022:	e8 25 01 00 00       	call   114c <futex>
+}
+    1027:	83 c4 10             	add    $0x10,%esp
+    102a:	c9                   	leave
+    102b:	c3                   	ret
+
+0000102c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    102c:	b8 01 00 00 00       	mov    $0x1,%eax
+    1031:	cd 40                	int    $0x40
+    1033:	c3                   	ret
+
+00001034 <exit>:
+SYSCALL(exit)
+    1034:	b8 02 00 00 00       	mov    $0x2,%eax
+    1039:	cd 40                	int    $0x40
+    103b:	c3                   	ret
+
+0000103c <wait>:
+SYSCALL(wait)
+    103c:	b8 03 00 00 00       	mov    $0x3,%eax
+    1041:	cd 40                	int    $0x40
+    1043:	c3                   	ret
+
+00001044 <pipe>:
+SYSCALL(pipe)
+    1044:	b8 04 00 00 00       	mov    $0x4,%eax
+    1049:	cd 40                	int    $0x40
+    104b:	c3                   	ret
+
+0000104c <read>:
+SYSCALL(read)
+    104c:	b8 05 00 00 00       	mov    $0x5,%eax
+    1051:	cd 40                	int    $0x40
+    1053:	c3                   	ret
+
+00001054 <write>:
+SYSCALL(write)
+    1054:	b8 10 00 00 00       	mov    $0x10,%eax
+    1059:	cd 40                	int    $0x40
+    105b:	c3                   	ret
+
+0000105c <close>:
+SYSCALL(close)
+    105c:	b8 15 00 00 00       	mov    $0x15,%eax
+    1061:	cd 40                	int    $0x40
+    1063:	c3                   	ret
+
+00001064 <kill>:
+SYSCALL(kill)
+    1064:	b8 06 00 00 00       	mov    $0x6,%eax
+    1069:	cd 40                	int    $0x40
+    106b:	c3                   	ret
+
+0000106c <exec>:
+SYSCALL(exec)
+    106c:	b8 07 00 00 00       	mov    $0x7,%eax
+    1071:	cd 40                	int    $0x40
+    1073:	c3                   	ret
+
+00001074 <open>:
+SYSCALL(open)
+    1074:	b8 0f 00 00 00       	mov    $0xf,%eax
+    1079:	cd 40                	int    $0x40
+    107b:	c3                   	ret
+
+0000107c <mknod>:
+SYSCALL(mknod)
+    107c:	b8 11 00 00 00       	mov    $0x11,%eax
+    1081:	cd 40                	int    $0x40
+    1083:	c3                   	ret
+
+00001084 <unlink>:
+SYSCALL(unlink)
+    1084:	b8 12 00 00 00       	mov    $0x12,%eax
+    1089:	cd 40                	int    $0x40
+    108b:	c3                   	ret
+
+0000108c <fstat>:
+SYSCALL(fstat)
+    108c:	b8 08 00 00 00       	mov    $0x8,%eax
+    1091:	cd 40                	int    $0x40
+    1093:	c3                   	ret
+
+00001094 <link>:
+SYSCALL(link)
+    1094:	b8 13 00 00 00       	mov    $0x13,%eax
+    1099:	cd 40                	int    $0x40
+    109b:	c3                   	ret
+
+0000109c <mkdir>:
+SYSCALL(mkdir)
+    109c:	b8 14 00 00 00       	mov    $0x14,%eax
+    10a1:	cd 40                	int    $0x40
+    10a3:	c3                   	ret
+
+000010a4 <chdir>:
+SYSCALL(chdir)
+    10a4:	b8 09 00 00 00       	mov    $0x9,%eax
+    10a9:	cd 40                	int    $0x40
+    10ab:	c3                   	ret
+
+000010ac <dup>:
+SYSCALL(dup)
+    10ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+    10b1:	cd 40                	int    $0x40
+    10b3:	c3                   	ret
+
+000010b4 <getpid>:
+SYSCALL(getpid)
+    10b4:	b8 0b 00 00 00       	mov    $0xb,%eax
+    10b9:	cd 40                	int    $0x40
+    10bb:	c3                   	ret
+
+000010bc <sbrk>:
+SYSCALL(sbrk)
+    10bc:	b8 0c 00 00 00       	mov    $0xc,%eax
+    10c1:	cd 40                	int    $0x40
+    10c3:	c3                   	ret
+
+000010c4 <sleep>:
+SYSCALL(sleep)
+    10c4:	b8 0d 00 00 00       	mov    $0xd,%eax
+    10c9:	cd 40                	int    $0x40
+    10cb:	c3                   	ret
+
+000010cc <uptime>:
+SYSCALL(uptime)
+    10cc:	b8 0e 00 00 00       	mov    $0xe,%eax
+    10d1:	cd 40                	int    $0x40
+    10d3:	c3                   	ret
+
+000010d4 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+    10d4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    10d9:	cd 40                	int    $0x40
+    10db:	c3                   	ret
+
+000010dc <getwmapinfo>:
+SYSCALL(getwmapinfo)
+    10dc:	b8 19 00 00 00       	mov    $0x19,%eax
+    10e1:	cd 40                	int    $0x40
+    10e3:	c3                   	ret
+
+000010e4 <wmap>:
+SYSCALL(wmap)
+    10e4:	b8 16 00 00 00       	mov    $0x16,%eax
+    10e9:	cd 40                	int    $0x40
+    10eb:	c3                   	ret
+
+000010ec <wunmap>:
+SYSCALL(wunmap)
+    10ec:	b8 17 00 00 00       	mov    $0x17,%eax
+    10f1:	cd 40                	int    $0x40
+    10f3:	c3                   	ret
+
+000010f4 <wremap>:
+SYSCALL(wremap)
+    10f4:	b8 18 00 00 00       	mov    $0x18,%eax
+    10f9:	cd 40                	int    $0x40
+    10fb:	c3                   	ret
+
+000010fc <wmlock>:
+SYSCALL(wmlock)
+    10fc:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    1101:	cd 40                	int    $0x40
+    1103:	c3                   	ret
+
+00001104 <wmunlock>:
+SYSCALL(wmunlock)
+    1104:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    1109:	cd 40                	int    $0x40
+    110b:	c3                   	ret
+
+0000110c <wmapoff>:
+SYSCALL(wmapoff)
+    110c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    1111:	cd 40                	int    $0x40
+    1113:	c3                   	ret
+
+00001114 <wunmaprange>:
+SYSCALL(wunmaprange)
+    1114:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    1119:	cd 40                	int    $0x40
+    111b:	c3                   	ret
+
+0000111c <setpriority>:
+SYSCALL(setpriority)
+    111c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    1121:	cd 40                	int    $0x40
+    1123:	c3                   	ret
+
+00001124 <getschedinfo>:
+SYSCALL(getschedinfo)
+    1124:	b8 20 00 00 00       	mov    $0x20,%eax
+    1129:	cd 40                	int    $0x40
+    112b:	c3                   	ret
+
+0000112c <settickets>:
+SYSCALL(settickets)
+    112c:	b8 21 00 00 00       	mov    $0x21,%eax
+    1131:	cd 40                	int    $0x40
+    1133:	c3                   	ret
+
+00001134 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+    1134:	b8 22 00 00 00       	mov    $0x22,%eax
+    1139:	cd 40                	int    $0x40
+    113b:	c3                   	ret
+
+0000113c <clone>:
+SYSCALL(clone)
+    113c:	b8 23 00 00 00       	mov    $0x23,%eax
+    1141:	cd 40                	int    $0x40
+    1143:	c3                   	ret
+
+00001144 <join>:
+SYSCALL(join)
+    1144:	b8 24 00 00 00       	mov    $0x24,%eax
+    1149:	cd 40                	int    $0x40
+    114b:	c3                   	ret
+
+0000114c <futex>:
+SYSCALL(futex)
+    114c:	b8 25 00 00 00       	mov    $0x25,%eax
+    1151:	cd 40                	int    $0x40
+    1153:	c3                   	ret
+
+00001154 <setaffinity>:
+SYSCALL(setaffinity)
+    1154:	b8 26 00 00 00       	mov    $0x26,%eax
+    1159:	cd 40                	int    $0x40
+    115b:	c3                   	ret
+
+0000115c <getaffinity>:
+SYSCALL(getaffinity)
+    115c:	b8 27 00 00 00       	mov    $0x27,%eax
+    1161:	cd 40                	int    $0x40
+    1163:	c3                   	ret
+
+00001164 <bcstat>:
+SYSCALL(bcstat)
+    1164:	b8 29 00 00 00       	mov    $0x29,%eax
+    1169:	cd 40                	int    $0x40
+    116b:	c3                   	ret
+
+0000116c <dropcache>:
+SYSCALL(dropcache)
+    116c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    1171:	cd 40                	int    $0x40
+    1173:	c3                   	ret
+
+00001174 <setiosched>:
+SYSCALL(setiosched)
+    1174:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    1179:	cd 40                	int    $0x40
+    117b:	c3                   	ret
+
+0000117c <iostat>:
+SYSCALL(iostat)
+    117c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    1181:	cd 40                	int    $0x40
+    1183:	c3                   	ret
+
+00001184 <fsync>:
+SYSCALL(fsync)
+    1184:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    1189:	cd 40                	int    $0x40
+    118b:	c3                   	ret
+
+0000118c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+    118c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+    118d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+    1192:	cd 40                	int    $0x40
+    1194:	ff e1                	jmp    *%ecx
+    1196:	66 90                	xchg   %ax,%ax
+    1198:	66 90                	xchg   %ax,%ax
+    119a:	66 90                	xchg   %ax,%ax
+    119c:	66 90                	xchg   %ax,%ax
+    119e:	66 90                	xchg   %ax,%ax
+
+000011a0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    11a0:	55                   	push   %ebp
+    11a1:	89 e5                	mov    %esp,%ebp
+    11a3:	57                   	push   %edi
+    11a4:	56                   	push   %esi
+    11a5:	53                   	push   %ebx
+    11a6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    11a8:	89 d1                	mov    %edx,%ecx
+{
+    11aa:	83 ec 3c             	sub    $0x3c,%esp
+    11ad:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    11b0:	85 d2                	test   %edx,%edx
+    11b2:	0f 89 80 00 00 00    	jns    1238 <printint+0x98>
+    11b8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    11bc:	74 7a                	je     1238 <printint+0x98>
+    x = -xx;
+    11be:	f7 d9                	neg    %ecx
+    neg = 1;
+    11c0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    11c5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    11c8:	31 f6                	xor    %esi,%esi
+    11ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    11d0:	89 c8                	mov    %ecx,%eax
+    11d2:	31 d2                	xor    %edx,%edx
+    11d4:	89 f7                	mov    %esi,%edi
+    11d6:	f7 f3                	div    %ebx
+    11d8:	8d 76 01             	lea    0x1(%esi),%esi
+    11db:	0f b6 92 70 18 00 00 	movzbl 0x1870(%edx),%edx
+    11e2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    11e6:	89 ca                	mov    %ecx,%edx
+    11e8:	89 c1                	mov    %eax,%ecx
+    11ea:	39 da                	cmp    %ebx,%edx
+    11ec:	73 e2                	jae    11d0 <printint+0x30>
+  if(neg)
+    11ee:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    11f1:	85 c0                	test   %eax,%eax
+    11f3:	74 07                	je     11fc <printint+0x5c>
+    buf[i++] = '-';
+    11f5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    11fa:	89 f7                	mov    %esi,%edi
+    11fc:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    11ff:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    1202:	01 df                	add    %ebx,%edi
+    1204:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    1208:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    120b:	83 ec 04             	sub    $0x4,%esp
+    120e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    1211:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    1214:	6a 01                	push   $0x1
+    1216:	50                   	push   %eax
+    1217:	56                   	push   %esi
+    1218:	e8 37 fe ff ff       	call   1054 <write>
+  while(--i >= 0)
+    121d:	89 f8                	mov    %edi,%eax
+    121f:	83 c4 10             	add    $0x10,%esp
+    1222:	83 ef 01             	sub    $0x1,%edi
+    1225:	39 d8                	cmp    %ebx,%eax
+    1227:	75 df                	jne    1208 <printint+0x68>
+}
+    1229:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    122c:	5b                   	pop    %ebx
+    122d:	5e                   	pop    %esi
+    122e:	5f                   	pop    %edi
+    122f:	5d                   	pop    %ebp
+    1230:	c3                   	ret
+    1231:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    1238:	31 c0                	xor    %eax,%eax
+    123a:	eb 89                	jmp    11c5 <printint+0x25>
+    123c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001240 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    1240:	55                   	push   %ebp
+    1241:	89 e5                	mov    %esp,%ebp
+    1243:	57                   	push   %edi
+    1244:	56                   	push   %esi
+    1245:	53                   	push   %ebx
+    1246:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    1249:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    124c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    124f:	0f b6 1e             	movzbl (%esi),%ebx
+    1252:	83 c6 01             	add    $0x1,%esi
+    1255:	84 db                	test   %bl,%bl
+    1257:	74 67                	je     12c0 <printf+0x80>
+    1259:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    125c:	31 d2                	xor    %edx,%edx
+    125e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    1261:	eb 34                	jmp    1297 <printf+0x57>
+    1263:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    1267:	90                   	nop
+    1268:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    126b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    1270:	83 f8 25             	cmp    $0x25,%eax
+    1273:	74 18                	je     128d <printf+0x4d>
+  write(fd, &c, 1);
+    1275:	83 ec 04             	sub    $0x4,%esp
+    1278:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    127b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    127e:	6a 01                	push   $0x1
+    1280:	50                   	push   %eax
+    1281:	57                   	push   %edi
+    1282:	e8 cd fd ff ff       	call   1054 <write>
+    1287:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    128a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    128d:	0f b6 1e             	movzbl (%esi),%ebx
+    1290:	83 c6 01             	add    $0x1,%esi
+    1293:	84 db                	test   %bl,%bl
+    1295:	74 29                	je     12c0 <printf+0x80>
+    c = fmt[i] & 0xff;
+    1297:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    129a:	85 d2                	test   %edx,%edx
+    129c:	74 ca                	je     1268 <printf+0x28>
+      }
+    } else if(state == '%'){
+    129e:	83 fa 25             	cmp    $0x25,%edx
+    12a1:	75 ea                	jne    128d <printf+0x4d>
+      if(c == 'd'){
+    12a3:	83 f8 25             	cmp    $0x25,%eax
+    12a6:	0f 84 24 01 00 00    	je     13d0 <printf+0x190>
+    12ac:	83 e8 63             	sub    $0x63,%eax
+    12af:	83 f8 15             	cmp    $0x15,%eax
+    12b2:	77 1c                	ja     12d0 <printf+0x90>
+    12b4:	ff 24 85 18 18 00 00 	jmp    *0x1818(,%eax,4)
+    12bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    12bf:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    12c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    12c3:	5b                   	pop    %ebx
+    12c4:	5e                   	pop    %esi
+    12c5:	5f                   	pop    %edi
+    12c6:	5d                   	pop    %ebp
+    12c7:	c3                   	ret
+    12c8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    12cf:	90                   	nop
+  write(fd, &c, 1);
+    12d0:	83 ec 04             	sub    $0x4,%esp
+    12d3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    12d6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    12da:	6a 01                	push   $0x1
+    12dc:	52                   	push   %edx
+    12dd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    12e0:	57                   	push   %edi
+    12e1:	e8 6e fd ff ff       	call   1054 <write>
+    12e6:	83 c4 0c             	add    $0xc,%esp
+    12e9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    12ec:	6a 01                	push   $0x1
+    12ee:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    12f1:	52                   	push   %edx
+    12f2:	57                   	push   %edi
+    12f3:	e8 5c fd ff ff       	call   1054 <write>
+        putc(fd, c);
+    12f8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    12fb:	31 d2                	xor    %edx,%edx
+    12fd:	eb 8e                	jmp    128d <printf+0x4d>
+    12ff:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    1300:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1303:	83 ec 0c             	sub    $0xc,%esp
+    1306:	b9 10 00 00 00       	mov    $0x10,%ecx
+    130b:	8b 13                	mov    (%ebx),%edx
+    130d:	6a 00                	push   $0x0
+    130f:	89 f8                	mov    %edi,%eax
+        ap++;
+    1311:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    1314:	e8 87 fe ff ff       	call   11a0 <printint>
+        ap++;
+    1319:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    131c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    131f:	31 d2                	xor    %edx,%edx
+    1321:	e9 67 ff ff ff       	jmp    128d <printf+0x4d>
+    1326:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    132d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    1330:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    1333:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    1335:	83 c0 04             	add    $0x4,%eax
+    1338:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    133b:	85 db                	test   %ebx,%ebx
+    133d:	0f 84 9d 00 00 00    	je     13e0 <printf+0x1a0>
+        while(*s != 0){
+    1343:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    1346:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    1348:	84 c0                	test   %al,%al
+    134a:	0f 84 3d ff ff ff    	je     128d <printf+0x4d>
+    1350:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    1353:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    1356:	89 de                	mov    %ebx,%esi
+    1358:	89 d3                	mov    %edx,%ebx
+    135a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    1360:	83 ec 04             	sub    $0x4,%esp
+    1363:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    1366:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    1369:	6a 01                	push   $0x1
+    136b:	53                   	push   %ebx
+    136c:	57                   	push   %edi
+    136d:	e8 e2 fc ff ff       	call   1054 <write>
+        while(*s != 0){
+    1372:	0f b6 06             	movzbl (%esi),%eax
+    1375:	83 c4 10             	add    $0x10,%esp
+    1378:	84 c0                	test   %al,%al
+    137a:	75 e4                	jne    1360 <printf+0x120>
+      state = 0;
+    137c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    137f:	31 d2                	xor    %edx,%edx
+    1381:	e9 07 ff ff ff       	jmp    128d <printf+0x4d>
+    1386:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    138d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    1390:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    1393:	83 ec 0c             	sub    $0xc,%esp
+    1396:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    139b:	8b 13                	mov    (%ebx),%edx
+    139d:	6a 01                	push   $0x1
+    139f:	e9 6b ff ff ff       	jmp    130f <printf+0xcf>
+    13a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    13a8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    13ab:	83 ec 04             	sub    $0x4,%esp
+    13ae:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    13b1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    13b3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    13b6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    13b9:	6a 01                	push   $0x1
+    13bb:	52                   	push   %edx
+    13bc:	57                   	push   %edi
+    13bd:	e8 92 fc ff ff       	call   1054 <write>
+        ap++;
+    13c2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    13c5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    13c8:	31 d2                	xor    %edx,%edx
+    13ca:	e9 be fe ff ff       	jmp    128d <printf+0x4d>
+    13cf:	90                   	nop
+  write(fd, &c, 1);
+    13d0:	83 ec 04             	sub    $0x4,%esp
+    13d3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    13d6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    13d9:	6a 01                	push   $0x1
+    13db:	e9 11 ff ff ff       	jmp    12f1 <printf+0xb1>
+    13e0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    13e5:	bb 10 18 00 00       	mov    $0x1810,%ebx
+    13ea:	e9 61 ff ff ff       	jmp    1350 <printf+0x110>
+    13ef:	90                   	nop
+
+000013f0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    13f0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    13f1:	a1 e4 20 00 00       	mov    0x20e4,%eax
+{
+    13f6:	89 e5                	mov    %esp,%ebp
+    13f8:	57                   	push   %edi
+    13f9:	56                   	push   %esi
+    13fa:	53                   	push   %ebx
+    13fb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    13fe:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    1401:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1408:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    140a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    140c:	39 ca                	cmp    %ecx,%edx
+    140e:	73 30                	jae    1440 <free+0x50>
+    1410:	39 c1                	cmp    %eax,%ecx
+    1412:	72 04                	jb     1418 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1414:	39 c2                	cmp    %eax,%edx
+    1416:	72 f0                	jb     1408 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    1418:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    141b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    141e:	39 f8                	cmp    %edi,%eax
+    1420:	74 2e                	je     1450 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1422:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    1425:	8b 42 04             	mov    0x4(%edx),%eax
+    1428:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    142b:	39 f1                	cmp    %esi,%ecx
+    142d:	74 38                	je     1467 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    142f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    1431:	5b                   	pop    %ebx
+  freep = p;
+    1432:	89 15 e4 20 00 00    	mov    %edx,0x20e4
+}
+    1438:	5e                   	pop    %esi
+    1439:	5f                   	pop    %edi
+    143a:	5d                   	pop    %ebp
+    143b:	c3                   	ret
+    143c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    1440:	39 c1                	cmp    %eax,%ecx
+    1442:	72 d0                	jb     1414 <free+0x24>
+    1444:	eb c2                	jmp    1408 <free+0x18>
+    1446:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    144d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    1450:	03 70 04             	add    0x4(%eax),%esi
+    1453:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    1456:	8b 02                	mov    (%edx),%eax
+    1458:	8b 00                	mov    (%eax),%eax
+    145a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    145d:	8b 42 04             	mov    0x4(%edx),%eax
+    1460:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    1463:	39 f1                	cmp    %esi,%ecx
+    1465:	75 c8                	jne    142f <free+0x3f>
+    p->s.size += bp->s.size;
+    1467:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    146a:	89 15 e4 20 00 00    	mov    %edx,0x20e4
+    p->s.size += bp->s.size;
+    1470:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    1473:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    1476:	89 0a                	mov    %ecx,(%edx)
+}
+    1478:	5b                   	pop    %ebx
+    1479:	5e                   	pop    %esi
+    147a:	5f                   	pop    %edi
+    147b:	5d                   	pop    %ebp
+    147c:	c3                   	ret
+    147d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001480 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    1480:	55                   	push   %ebp
+    1481:	89 e5                	mov    %esp,%ebp
+    1483:	57                   	push   %edi
+    1484:	56                   	push   %esi
+    1485:	53                   	push   %ebx
+    1486:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1489:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    148c:	8b 15 e4 20 00 00    	mov    0x20e4,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    1492:	8d 78 07             	lea    0x7(%eax),%edi
+    1495:	c1 ef 03             	shr    $0x3,%edi
+    1498:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    149b:	85 d2                	test   %edx,%edx
+    149d:	0f 84 8d 00 00 00    	je     1530 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    14a3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    14a5:	8b 48 04             	mov    0x4(%eax),%ecx
+    14a8:	39 f9                	cmp    %edi,%ecx
+    14aa:	73 64                	jae    1510 <malloc+0x90>
+  if(nu < 4096)
+    14ac:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    14b1:	39 df                	cmp    %ebx,%edi
+    14b3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    14b6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    14bd:	eb 0a                	jmp    14c9 <malloc+0x49>
+    14bf:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    14c0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    14c2:	8b 48 04             	mov    0x4(%eax),%ecx
+    14c5:	39 f9                	cmp    %edi,%ecx
+    14c7:	73 47                	jae    1510 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    14c9:	89 c2                	mov    %eax,%edx
+    14cb:	39 05 e4 20 00 00    	cmp    %eax,0x20e4
+    14d1:	75 ed                	jne    14c0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    14d3:	83 ec 0c             	sub    $0xc,%esp
+    14d6:	56                   	push   %esi
+    14d7:	e8 e0 fb ff ff       	call   10bc <sbrk>
+  if(p == (char*)-1)
+    14dc:	83 c4 10             	add    $0x10,%esp
+    14df:	83 f8 ff             	cmp    $0xffffffff,%eax
+    14e2:	74 1c                	je     1500 <malloc+0x80>
+  hp->s.size = nu;
+    14e4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    14e7:	83 ec 0c             	sub    $0xc,%esp
+    14ea:	83 c0 08             	add    $0x8,%eax
+    14ed:	50                   	push   %eax
+    14ee:	e8 fd fe ff ff       	call   13f0 <free>
+  return freep;
+    14f3:	8b 15 e4 20 00 00    	mov    0x20e4,%edx
+      if((p = morecore(nunits)) == 0)
+    14f9:	83 c4 10             	add    $0x10,%esp
+    14fc:	85 d2                	test   %edx,%edx
+    14fe:	75 c0                	jne    14c0 <malloc+0x40>
+        return 0;
+  }
+}
+    1500:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    1503:	31 c0                	xor    %eax,%eax
+}
+    1505:	5b                   	pop    %ebx
+    1506:	5e                   	pop    %esi
+    1507:	5f                   	pop    %edi
+    1508:	5d                   	pop    %ebp
+    1509:	c3                   	ret
+    150a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    1510:	39 cf                	cmp    %ecx,%edi
+    1512:	74 4c                	je     1560 <malloc+0xe0>
+        p->s.size -= nunits;
+    1514:	29 f9                	sub    %edi,%ecx
+    1516:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    1519:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    151c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    151f:	89 15 e4 20 00 00    	mov    %edx,0x20e4
+}
+    1525:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    1528:	83 c0 08             	add    $0x8,%eax
+}
+    152b:	5b                   	pop    %ebx
+    152c:	5e                   	pop    %esi
+    152d:	5f                   	pop    %edi
+    152e:	5d                   	pop    %ebp
+    152f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    1530:	c7 05 e4 20 00 00 e8 	movl   $0x20e8,0x20e4
+    1537:	20 00 00 
+    base.s.size = 0;
+    153a:	b8 e8 20 00 00       	mov    $0x20e8,%eax
+    base.s.ptr = freep = prevp = &base;
+    153f:	c7 05 e8 20 00 00 e8 	movl   $0x20e8,0x20e8
+    1546:	20 00 00 
+    base.s.size = 0;
+    1549:	c7 05 ec 20 00 00 00 	movl   $0x0,0x20ec
+    1550:	00 00 00 
+    if(p->s.size >= nunits){
+    1553:	e9 54 ff ff ff       	jmp    14ac <malloc+0x2c>
+    1558:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    155f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    1560:	8b 08                	mov    (%eax),%ecx
+    1562:	89 0a                	mov    %ecx,(%edx)
+    1564:	eb b9                	jmp    151f <malloc+0x9f>
+    1566:	66 90                	xchg   %ax,%ax
+    1568:	66 90                	xchg   %ax,%ax
+    156a:	66 90                	xchg   %ax,%ax
+    156c:	66 90                	xchg   %ax,%ax
+    156e:	66 90                	xchg   %ax,%ax
+
+00001570 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+    1570:	55                   	push   %ebp
+    1571:	89 e5                	mov    %esp,%ebp
+    1573:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+    1576:	8b 45 08             	mov    0x8(%ebp),%eax
+    1579:	c1 e0 04             	shl    $0x4,%eax
+    157c:	ff b0 2c 21 00 00    	push   0x212c(%eax)
+    1582:	05 20 21 00 00       	add    $0x2120,%eax
+    1587:	ff 50 08             	call   *0x8(%eax)
+  exit();
+    158a:	e8 a5 fa ff ff       	call   1034 <exit>
+    158f:	90                   	nop
+
+00001590 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1590:	55                   	push   %ebp
+    1591:	89 e5                	mov    %esp,%ebp
+    1593:	57                   	push   %edi
+    1594:	56                   	push   %esi
+    1595:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+    1596:	31 db                	xor    %ebx,%ebx
+{
+    1598:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+    159b:	68 00 21 00 00       	push   $0x2100
+    15a0:	e8 eb f8 ff ff       	call   e90 <lock_acquire>
+    15a5:	83 c4 10             	add    $0x10,%esp
+    15a8:	eb 12                	jmp    15bc <thread_create+0x2c>
+    15aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+    15b0:	83 c3 01             	add    $0x1,%ebx
+    15b3:	83 fb 40             	cmp    $0x40,%ebx
+    15b6:	0f 84 c4 00 00 00    	je     1680 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+    15bc:	89 de                	mov    %ebx,%esi
+    15be:	c1 e6 04             	shl    $0x4,%esi
+    15c1:	8b 96 20 21 00 00    	mov    0x2120(%esi),%edx
+    15c7:	85 d2                	test   %edx,%edx
+    15c9:	75 e5                	jne    15b0 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+    15cb:	83 ec 0c             	sub    $0xc,%esp
+    15ce:	68 00 20 00 00       	push   $0x2000
+    15d3:	e8 a8 fe ff ff       	call   1480 <malloc>
+    15d8:	83 c4 10             	add    $0x10,%esp
+    15db:	85 c0                	test   %eax,%eax
+    15dd:	0f 84 9d 00 00 00    	je     1680 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+    15e3:	89 86 24 21 00 00    	mov    %eax,0x2124(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+    15e9:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+    15ee:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+    15f1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    15f6:	89 86 20 21 00 00    	mov    %eax,0x2120(%esi)
+  threads[i].fn = fn;
+    15fc:	8b 45 08             	mov    0x8(%ebp),%eax
+    15ff:	89 86 28 21 00 00    	mov    %eax,0x2128(%esi)
+  threads[i].arg = arg;
+    1605:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1608:	89 86 2c 21 00 00    	mov    %eax,0x212c(%esi)
+  lock_release(&threadslock);
+    160e:	68 00 21 00 00       	push   $0x2100
+    1613:	e8 98 f8 ff ff       	call   eb0 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+    1618:	83 c4 0c             	add    $0xc,%esp
+    161b:	ff b6 20 21 00 00    	push   0x2120(%esi)
+    1621:	53                   	push   %ebx
+    1622:	68 70 15 00 00       	push   $0x1570
+    1627:	e8 10 fb ff ff       	call   113c <clone>
+    162c:	83 c4 10             	add    $0x10,%esp
+    162f:	85 c0                	test   %eax,%eax
+    1631:	78 0d                	js     1640 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+    1633:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1636:	5b                   	pop    %ebx
+    1637:	5e                   	pop    %esi
+    1638:	5f                   	pop    %edi
+    1639:	5d                   	pop    %ebp
+    163a:	c3                   	ret
+    163b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    163f:	90                   	nop
+    lock_acquire(&threadslock);
+    1640:	83 ec 0c             	sub    $0xc,%esp
+    1643:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    1646:	68 00 21 00 00       	push   $0x2100
+    164b:	e8 40 f8 ff ff       	call   e90 <lock_acquire>
+    free(threads[i].block);
+    1650:	58                   	pop    %eax
+    1651:	ff b6 24 21 00 00    	push   0x2124(%esi)
+    1657:	e8 94 fd ff ff       	call   13f0 <free>
+    threads[i].stack = 0;
+    165c:	c7 86 20 21 00 00 00 	movl   $0x0,0x2120(%esi)
+    1663:	00 00 00 
+    lock_release(&threadslock);
+    1666:	c7 04 24 00 21 00 00 	movl   $0x2100,(%esp)
+    166d:	e8 3e f8 ff ff       	call   eb0 <lock_release>
+    1672:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1675:	83 c4 10             	add    $0x10,%esp
+}
+    1678:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    167b:	5b                   	pop    %ebx
+    167c:	5e                   	pop    %esi
+    167d:	5f                   	pop    %edi
+    167e:	5d                   	pop    %ebp
+    167f:	c3                   	ret
+    lock_release(&threadslock);
+    1680:	83 ec 0c             	sub    $0xc,%esp
+    1683:	68 00 21 00 00       	push   $0x2100
+    1688:	e8 23 f8 ff ff       	call   eb0 <lock_release>
+    return -1;
+    168d:	83 c4 10             	add    $0x10,%esp
+    1690:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1695:	eb 9c                	jmp    1633 <thread_create+0xa3>
+    1697:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    169e:	66 90                	xchg   %ax,%ax
+
+000016a0 <thread_join>:
+
+int
+thread_join(void)
+{
+    16a0:	55                   	push   %ebp
+    16a1:	89 e5                	mov    %esp,%ebp
+    16a3:	56                   	push   %esi
+    16a4:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+    16a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    16a8:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+    16ab:	50                   	push   %eax
+    16ac:	e8 93 fa ff ff       	call   1144 <join>
+    16b1:	83 c4 10             	add    $0x10,%esp
+    16b4:	85 c0                	test   %eax,%eax
+    16b6:	78 69                	js     1721 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+    16b8:	83 ec 0c             	sub    $0xc,%esp
+    16bb:	89 c6                	mov    %eax,%esi
+    16bd:	68 00 21 00 00       	push   $0x2100
+    16c2:	e8 c9 f7 ff ff       	call   e90 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+    16c7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    16ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+    16cd:	31 c0                	xor    %eax,%eax
+    16cf:	eb 0f                	jmp    16e0 <thread_join+0x40>
+    16d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    16d8:	83 c0 01             	add    $0x1,%eax
+    16db:	83 f8 40             	cmp    $0x40,%eax
+    16de:	74 28                	je     1708 <thread_join+0x68>
+    if(threads[i].stack == stack){
+    16e0:	89 c3                	mov    %eax,%ebx
+    16e2:	c1 e3 04             	shl    $0x4,%ebx
+    16e5:	39 93 20 21 00 00    	cmp    %edx,0x2120(%ebx)
+    16eb:	75 eb                	jne    16d8 <thread_join+0x38>
+      free(threads[i].block);
+    16ed:	83 ec 0c             	sub    $0xc,%esp
+    16f0:	ff b3 24 21 00 00    	push   0x2124(%ebx)
+    16f6:	e8 f5 fc ff ff       	call   13f0 <free>
+      threads[i].stack = 0;
+      break;
+    16fb:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+    16fe:	c7 83 20 21 00 00 00 	movl   $0x0,0x2120(%ebx)
+    1705:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+    1708:	83 ec 0c             	sub    $0xc,%esp
+    170b:	68 00 21 00 00       	push   $0x2100
+    1710:	e8 9b f7 ff ff       	call   eb0 <lock_release>
+  return pid;
+    1715:	83 c4 10             	add    $0x10,%esp
+}
+    1718:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    171b:	89 f0                	mov    %esi,%eax
+    171d:	5b                   	pop    %ebx
+    171e:	5e                   	pop    %esi
+    171f:	5d                   	pop    %ebp
+    1720:	c3                   	ret
+    return -1;
+    1721:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    1726:	eb f0                	jmp    1718 <thread_join+0x78>
@@ -0,0 +1,68 @@
+// Slab allocator for fixed-size kernel objects; see slab.h.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "slab.h"
+
+// A free object is linked through a word just past its end,
+// leaving its constructed state untouched.
+#define LINK(s, obj) (*(void**)((char*)(obj) + (s)->size - sizeof(void*)))
+
+void
+slabinit(struct slab *s, char *name, uint size, void (*ctor)(void*))
+{
+  size = (size + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+  size += sizeof(void*);
+  if(size > PGSIZE)
+    panic("slabinit");
+  initlock(&s->lock, "slab");
+  s->name = name;
+  s->size = size;
+  s->ctor = ctor;
+  s->free = 0;
+  s->nalloc = 0;
+  s->npages = 0;
+}
+
+// Return a constructed object, or 0 if out of memory.
+void*
+slaballoc(struct slab *s)
+{
+  char *page, *obj;
+
+  acquire(&s->lock);
+  if(s->free == 0){
+    if((page = kalloc()) == 0){
+      release(&s->lock);
+      return 0;
+    }
+    memset(page, 0, PGSIZE);
+    for(obj = page; obj + s->size <= page + PGSIZE; obj += s->size){
+      if(s->ctor)
+        s->ctor(obj);
+      LINK(s, obj) = s->free;
+      s->free = obj;
+    }
+    s->npages++;
+  }
+  obj = s->free;
+  s->free = LINK(s, obj);
+  s->nalloc++;
+  release(&s->lock);
+  return obj;
+}
+
+// Return obj to s.  obj must be back in the state its constructor
+// left it in, e.g. with any lock in it released.
+void
+slabfree(struct slab *s, void *obj)
+{
+  acquire(&s->lock);
+  LINK(s, obj) = s->free;
+  s->free = obj;
+  s->nalloc--;
+  release(&s->lock);
+}
@@ -0,0 +1,20 @@
+#ifndef SLAB_H
+#define SLAB_H
+
+// Cache of fixed-size kernel objects, carved out of pages from
+// kalloc.  Each object is constructed once, when its page is
+// carved, and keeps that state while it sits on the free list,
+// so that e.g. a proc's spinlock need not be initialized again
+// on every reuse.  Pages are never given back to kalloc, so a
+// stale pointer into a slab always points at a valid object.
+struct slab {
+  struct spinlock lock;
+  char *name;                  // For debugging
+  uint size;                   // Bytes per object, including the link
+  void (*ctor)(void*);         // Constructor, or 0
+  void *free;                  // Free objects
+  int nalloc;                  // # of objects handed out
+  int npages;                  // # of pages carved
+};
+
+#endif
@@ -1,3 +1,6 @@
+#ifndef SLEEPLOCK_H
+#define SLEEPLOCK_H
+
 // Long-term locks for processes
 struct sleeplock {
   uint locked;       // Is the lock held?
@@ -8,3 +11,4 @@ struct sleeplock {
   int pid;           // Process holding lock
 };
 
+#endif
@@ -0,0 +1,2051 @@
+
+_stridetest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 40             	sub    $0x40,%esp
+  int fds[2], rfd[NCHILD], used[NCHILD];
+  int i, old, end, total, sum, expect, err, failed;
+
+  printf(1, "stridetest starting\n");
+  14:	68 d3 0d 00 00       	push   $0xdd3
+  19:	6a 01                	push   $0x1
+  1b:	e8 60 08 00 00       	call   880 <printf>
+  if((old = setschedpolicy(SCHED_STRIDE)) < 0){
+  20:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  27:	e8 48 07 00 00       	call   774 <setschedpolicy>
+  2c:	83 c4 10             	add    $0x10,%esp
+  2f:	85 c0                	test   %eax,%eax
+  31:	0f 88 4f 01 00 00    	js     186 <main+0x186>
+    printf(1, "stridetest: setschedpolicy failed\n");
+    exit();
+  }
+  // Outrank the spinners so we are sure to get to fork them all.
+  settickets(MAXTICKETS);
+  37:	83 ec 0c             	sub    $0xc,%esp
+  3a:	89 c6                	mov    %eax,%esi
+  3c:	8d 7d c8             	lea    -0x38(%ebp),%edi
+
+  end = uptime() + RUNTICKS;
+  for(i = 0; i < NCHILD; i++){
+  3f:	31 db                	xor    %ebx,%ebx
+  settickets(MAXTICKETS);
+  41:	68 10 27 00 00       	push   $0x2710
+  46:	e8 21 07 00 00       	call   76c <settickets>
+  end = uptime() + RUNTICKS;
+  4b:	e8 bc 06 00 00       	call   70c <uptime>
+  50:	83 c4 10             	add    $0x10,%esp
+  53:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    if(pipe(fds) < 0){
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	57                   	push   %edi
+  5a:	e8 25 06 00 00       	call   684 <pipe>
+  5f:	83 c4 10             	add    $0x10,%esp
+  62:	85 c0                	test   %eax,%eax
+  64:	0f 88 42 01 00 00    	js     1ac <main+0x1ac>
+      printf(1, "stridetest: pipe failed\n");
+      exit();
+    }
+    if(fork() == 0){
+  6a:	e8 fd 05 00 00       	call   66c <fork>
+  6f:	85 c0                	test   %eax,%eax
+  71:	0f 84 48 01 00 00    	je     1bf <main+0x1bf>
+      close(fds[0]);
+      spinner(tickets[i], end, fds[1]);
+    }
+    close(fds[1]);
+  77:	83 ec 0c             	sub    $0xc,%esp
+  7a:	ff 75 cc             	push   -0x34(%ebp)
+  7d:	e8 1a 06 00 00       	call   69c <close>
+    rfd[i] = fds[0];
+  82:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  for(i = 0; i < NCHILD; i++){
+  85:	83 c4 10             	add    $0x10,%esp
+    rfd[i] = fds[0];
+  88:	89 44 9d d0          	mov    %eax,-0x30(%ebp,%ebx,4)
+  for(i = 0; i < NCHILD; i++){
+  8c:	83 c3 01             	add    $0x1,%ebx
+  8f:	83 fb 03             	cmp    $0x3,%ebx
+  92:	75 c2                	jne    56 <main+0x56>
+  }
+  for(i = 0; i < NCHILD; i++)
+    wait();
+  94:	e8 e3 05 00 00       	call   67c <wait>
+  99:	31 db                	xor    %ebx,%ebx
+  9b:	e8 dc 05 00 00       	call   67c <wait>
+  a0:	e8 d7 05 00 00       	call   67c <wait>
+  for(i = 0; i < NCHILD; i++){
+    if(read(rfd[i], &used[i], sizeof(used[i])) != sizeof(used[i]))
+  a5:	8b 7c 1d d0          	mov    -0x30(%ebp,%ebx,1),%edi
+  a9:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  ac:	83 ec 04             	sub    $0x4,%esp
+  af:	01 d8                	add    %ebx,%eax
+  b1:	6a 04                	push   $0x4
+  b3:	50                   	push   %eax
+  b4:	57                   	push   %edi
+  b5:	e8 d2 05 00 00       	call   68c <read>
+  ba:	83 c4 10             	add    $0x10,%esp
+  bd:	83 f8 04             	cmp    $0x4,%eax
+  c0:	74 08                	je     ca <main+0xca>
+      used[i] = 0;
+  c2:	c7 44 1d dc 00 00 00 	movl   $0x0,-0x24(%ebp,%ebx,1)
+  c9:	00 
+    close(rfd[i]);
+  ca:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < NCHILD; i++){
+  cd:	83 c3 04             	add    $0x4,%ebx
+    close(rfd[i]);
+  d0:	57                   	push   %edi
+  d1:	e8 c6 05 00 00       	call   69c <close>
+  for(i = 0; i < NCHILD; i++){
+  d6:	83 c4 10             	add    $0x10,%esp
+  d9:	83 fb 0c             	cmp    $0xc,%ebx
+  dc:	75 c7                	jne    a5 <main+0xa5>
+  }
+  setschedpolicy(old);
+  de:	83 ec 0c             	sub    $0xc,%esp
+  e1:	56                   	push   %esi
+  e2:	e8 8d 06 00 00       	call   774 <setschedpolicy>
+
+  total = sum = 0;
+  for(i = 0; i < NCHILD; i++){
+    total += used[i];
+  e7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    sum += tickets[i];
+  }
+  failed = total == 0;
+  ea:	83 c4 10             	add    $0x10,%esp
+    total += used[i];
+  ed:	03 45 dc             	add    -0x24(%ebp),%eax
+    sum += tickets[i];
+  f0:	8b 15 34 13 00 00    	mov    0x1334,%edx
+  f6:	03 15 30 13 00 00    	add    0x1330,%edx
+  fc:	03 15 38 13 00 00    	add    0x1338,%edx
+  failed = total == 0;
+ 102:	03 45 e4             	add    -0x1c(%ebp),%eax
+ 105:	89 45 c0             	mov    %eax,-0x40(%ebp)
+ 108:	0f 94 c0             	sete   %al
+  for(i = 0; i < NCHILD; i++){
+ 10b:	31 ff                	xor    %edi,%edi
+  failed = total == 0;
+ 10d:	0f b6 c0             	movzbl %al,%eax
+    sum += tickets[i];
+ 110:	89 55 bc             	mov    %edx,-0x44(%ebp)
+  failed = total == 0;
+ 113:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    expect = total * tickets[i] / sum;
+ 116:	8b 45 c0             	mov    -0x40(%ebp),%eax
+ 119:	8b 0c bd 30 13 00 00 	mov    0x1330(,%edi,4),%ecx
+ 120:	0f af c1             	imul   %ecx,%eax
+ 123:	99                   	cltd
+ 124:	f7 7d bc             	idivl  -0x44(%ebp)
+ 127:	89 c3                	mov    %eax,%ebx
+    err = used[i] - expect;
+ 129:	8b 44 bd dc          	mov    -0x24(%ebp,%edi,4),%eax
+    if(err < 0)
+      err = -err;
+ 12d:	89 da                	mov    %ebx,%edx
+ 12f:	89 c6                	mov    %eax,%esi
+ 131:	29 c2                	sub    %eax,%edx
+ 133:	29 de                	sub    %ebx,%esi
+ 135:	0f 48 f2             	cmovs  %edx,%esi
+    printf(1, "tickets %d: ran %d ticks, expected %d\n",
+ 138:	83 ec 0c             	sub    $0xc,%esp
+ 13b:	53                   	push   %ebx
+ 13c:	50                   	push   %eax
+           tickets[i], used[i], expect);
+    if(err * 100 > expect * TOLERANCE)
+ 13d:	6b f6 64             	imul   $0x64,%esi,%esi
+    printf(1, "tickets %d: ran %d ticks, expected %d\n",
+ 140:	51                   	push   %ecx
+ 141:	68 ac 0d 00 00       	push   $0xdac
+ 146:	6a 01                	push   $0x1
+ 148:	e8 33 07 00 00       	call   880 <printf>
+    if(err * 100 > expect * TOLERANCE)
+ 14d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+ 150:	83 c4 20             	add    $0x20,%esp
+ 153:	c1 e0 02             	shl    $0x2,%eax
+      failed = 1;
+ 156:	39 c6                	cmp    %eax,%esi
+ 158:	b8 01 00 00 00       	mov    $0x1,%eax
+ 15d:	0f 4e 45 c4          	cmovle -0x3c(%ebp),%eax
+  for(i = 0; i < NCHILD; i++){
+ 161:	83 c7 01             	add    $0x1,%edi
+      failed = 1;
+ 164:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  for(i = 0; i < NCHILD; i++){
+ 167:	83 ff 03             	cmp    $0x3,%edi
+ 16a:	75 aa                	jne    116 <main+0x116>
+  }
+  if(failed)
+ 16c:	85 c0                	test   %eax,%eax
+ 16e:	74 29                	je     199 <main+0x199>
+    printf(1, "stridetest: FAILED\n");
+ 170:	52                   	push   %edx
+ 171:	52                   	push   %edx
+ 172:	68 01 0e 00 00       	push   $0xe01
+ 177:	6a 01                	push   $0x1
+ 179:	e8 02 07 00 00       	call   880 <printf>
+ 17e:	83 c4 10             	add    $0x10,%esp
+  else
+    printf(1, "stridetest ok\n");
+  exit();
+ 181:	e8 ee 04 00 00       	call   674 <exit>
+    printf(1, "stridetest: setschedpolicy failed\n");
+ 186:	53                   	push   %ebx
+ 187:	53                   	push   %ebx
+ 188:	68 88 0d 00 00       	push   $0xd88
+ 18d:	6a 01                	push   $0x1
+ 18f:	e8 ec 06 00 00       	call   880 <printf>
+    exit();
+ 194:	e8 db 04 00 00       	call   674 <exit>
+    printf(1, "stridetest ok\n");
+ 199:	50                   	push   %eax
+ 19a:	50                   	push   %eax
+ 19b:	68 15 0e 00 00       	push   $0xe15
+ 1a0:	6a 01                	push   $0x1
+ 1a2:	e8 d9 06 00 00       	call   880 <printf>
+ 1a7:	83 c4 10             	add    $0x10,%esp
+ 1aa:	eb d5                	jmp    181 <main+0x181>
+      printf(1, "stridetest: pipe failed\n");
+ 1ac:	51                   	push   %ecx
+ 1ad:	51                   	push   %ecx
+ 1ae:	68 e8 0d 00 00       	push   $0xde8
+ 1b3:	6a 01                	push   $0x1
+ 1b5:	e8 c6 06 00 00       	call   880 <printf>
+      exit();
+ 1ba:	e8 b5 04 00 00       	call   674 <exit>
+      close(fds[0]);
+ 1bf:	83 ec 0c             	sub    $0xc,%esp
+ 1c2:	ff 75 c8             	push   -0x38(%ebp)
+ 1c5:	e8 d2 04 00 00       	call   69c <close>
+      spinner(tickets[i], end, fds[1]);
+ 1ca:	83 c4 0c             	add    $0xc,%esp
+ 1cd:	ff 75 cc             	push   -0x34(%ebp)
+  end = uptime() + RUNTICKS;
+ 1d0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 1d3:	05 2c 01 00 00       	add    $0x12c,%eax
+      spinner(tickets[i], end, fds[1]);
+ 1d8:	50                   	push   %eax
+ 1d9:	ff 34 9d 30 13 00 00 	push   0x1330(,%ebx,4)
+ 1e0:	e8 0b 00 00 00       	call   1f0 <spinner>
+ 1e5:	66 90                	xchg   %ax,%ax
+ 1e7:	66 90                	xchg   %ax,%ax
+ 1e9:	66 90                	xchg   %ax,%ax
+ 1eb:	66 90                	xchg   %ax,%ax
+ 1ed:	66 90                	xchg   %ax,%ax
+ 1ef:	90                   	nop
+
+000001f0 <spinner>:
+{
+ 1f0:	55                   	push   %ebp
+ 1f1:	89 e5                	mov    %esp,%ebp
+ 1f3:	53                   	push   %ebx
+ 1f4:	83 ec 40             	sub    $0x40,%esp
+ 1f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if(settickets(n) < 0){
+ 1fa:	ff 75 08             	push   0x8(%ebp)
+ 1fd:	e8 6a 05 00 00       	call   76c <settickets>
+ 202:	83 c4 10             	add    $0x10,%esp
+ 205:	85 c0                	test   %eax,%eax
+ 207:	78 58                	js     261 <spinner+0x71>
+ 209:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while(uptime() < end)
+ 210:	e8 f7 04 00 00       	call   70c <uptime>
+ 215:	39 d8                	cmp    %ebx,%eax
+ 217:	7c f7                	jl     210 <spinner+0x20>
+  used = 0;
+ 219:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+  if(getschedinfo(getpid(), &si) == 0)
+ 220:	e8 cf 04 00 00       	call   6f4 <getpid>
+ 225:	83 ec 08             	sub    $0x8,%esp
+ 228:	8d 55 cc             	lea    -0x34(%ebp),%edx
+ 22b:	52                   	push   %edx
+ 22c:	50                   	push   %eax
+ 22d:	e8 32 05 00 00       	call   764 <getschedinfo>
+ 232:	83 c4 10             	add    $0x10,%esp
+ 235:	85 c0                	test   %eax,%eax
+ 237:	75 12                	jne    24b <spinner+0x5b>
+      used += si.ticks[i];
+ 239:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 23c:	03 45 c8             	add    -0x38(%ebp),%eax
+ 23f:	03 45 dc             	add    -0x24(%ebp),%eax
+ 242:	03 45 e0             	add    -0x20(%ebp),%eax
+ 245:	03 45 e4             	add    -0x1c(%ebp),%eax
+ 248:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  write(fd, &used, sizeof(used));
+ 24b:	83 ec 04             	sub    $0x4,%esp
+ 24e:	8d 45 c8             	lea    -0x38(%ebp),%eax
+ 251:	6a 04                	push   $0x4
+ 253:	50                   	push   %eax
+ 254:	ff 75 10             	push   0x10(%ebp)
+ 257:	e8 38 04 00 00       	call   694 <write>
+  exit();
+ 25c:	e8 13 04 00 00       	call   674 <exit>
+    printf(1, "stridetest: settickets failed\n");
+ 261:	50                   	push   %eax
+ 262:	50                   	push   %eax
+ 263:	68 68 0d 00 00       	push   $0xd68
+ 268:	6a 01                	push   $0x1
+ 26a:	e8 11 06 00 00       	call   880 <printf>
+    exit();
+ 26f:	e8 00 04 00 00       	call   674 <exit>
+ 274:	66 90                	xchg   %ax,%ax
+ 276:	66 90                	xchg   %ax,%ax
+ 278:	66 90                	xchg   %ax,%ax
+ 27a:	66 90                	xchg   %ax,%ax
+ 27c:	66 90                	xchg   %ax,%ax
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 280:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 281:	31 c0                	xor    %eax,%eax
+{
+ 283:	89 e5                	mov    %esp,%ebp
+ 285:	53                   	push   %ebx
+ 286:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 289:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 28c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 290:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 294:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 297:	83 c0 01             	add    $0x1,%eax
+ 29a:	84 d2                	test   %dl,%dl
+ 29c:	75 f2                	jne    290 <strcpy+0x10>
+    ;
+  return os;
+}
+ 29e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2a1:	89 c8                	mov    %ecx,%eax
+ 2a3:	c9                   	leave
+ 2a4:	c3                   	ret
+ 2a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000002b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 2b0:	55                   	push   %ebp
+ 2b1:	89 e5                	mov    %esp,%ebp
+ 2b3:	53                   	push   %ebx
+ 2b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 2ba:	0f b6 02             	movzbl (%edx),%eax
+ 2bd:	84 c0                	test   %al,%al
+ 2bf:	75 17                	jne    2d8 <strcmp+0x28>
+ 2c1:	eb 3a                	jmp    2fd <strcmp+0x4d>
+ 2c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 2c7:	90                   	nop
+ 2c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 2cc:	83 c2 01             	add    $0x1,%edx
+ 2cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 2d2:	84 c0                	test   %al,%al
+ 2d4:	74 1a                	je     2f0 <strcmp+0x40>
+    p++, q++;
+ 2d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 2d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 2db:	38 c3                	cmp    %al,%bl
+ 2dd:	74 e9                	je     2c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 2df:	29 d8                	sub    %ebx,%eax
+}
+ 2e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2e4:	c9                   	leave
+ 2e5:	c3                   	ret
+ 2e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 2f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 2f4:	31 c0                	xor    %eax,%eax
+ 2f6:	29 d8                	sub    %ebx,%eax
+}
+ 2f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2fb:	c9                   	leave
+ 2fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 2fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 300:	31 c0                	xor    %eax,%eax
+ 302:	eb db                	jmp    2df <strcmp+0x2f>
+ 304:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 30b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 30f:	90                   	nop
+
+00000310 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 310:	55                   	push   %ebp
+ 311:	89 e5                	mov    %esp,%ebp
+ 313:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 316:	80 3a 00             	cmpb   $0x0,(%edx)
+ 319:	74 15                	je     330 <strlen+0x20>
+ 31b:	31 c0                	xor    %eax,%eax
+ 31d:	8d 76 00             	lea    0x0(%esi),%esi
+ 320:	83 c0 01             	add    $0x1,%eax
+ 323:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 327:	89 c1                	mov    %eax,%ecx
+ 329:	75 f5                	jne    320 <strlen+0x10>
+    ;
+  return n;
+}
+ 32b:	89 c8                	mov    %ecx,%eax
+ 32d:	5d                   	pop    %ebp
+ 32e:	c3                   	ret
+ 32f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 330:	31 c9                	xor    %ecx,%ecx
+}
+ 332:	5d                   	pop    %ebp
+ 333:	89 c8                	mov    %ecx,%eax
+ 335:	c3                   	ret
+ 336:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000340 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	57                   	push   %edi
+ 344:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 347:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 34a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 34d:	89 d7                	mov    %edx,%edi
+ 34f:	fc                   	cld
+ 350:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 352:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 355:	89 d0                	mov    %edx,%eax
+ 357:	c9                   	leave
+ 358:	c3                   	ret
+ 359:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000360 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	8b 45 08             	mov    0x8(%ebp),%eax
+ 366:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 36a:	0f b6 10             	movzbl (%eax),%edx
+ 36d:	84 d2                	test   %dl,%dl
+ 36f:	75 12                	jne    383 <strchr+0x23>
+ 371:	eb 1d                	jmp    390 <strchr+0x30>
+ 373:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 377:	90                   	nop
+ 378:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 37c:	83 c0 01             	add    $0x1,%eax
+ 37f:	84 d2                	test   %dl,%dl
+ 381:	74 0d                	je     390 <strchr+0x30>
+    if(*s == c)
+ 383:	38 d1                	cmp    %dl,%cl
+ 385:	75 f1                	jne    378 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 387:	5d                   	pop    %ebp
+ 388:	c3                   	ret
+ 389:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 390:	31 c0                	xor    %eax,%eax
+}
+ 392:	5d                   	pop    %ebp
+ 393:	c3                   	ret
+ 394:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+
+000003a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 3a0:	55                   	push   %ebp
+ 3a1:	89 e5                	mov    %esp,%ebp
+ 3a3:	57                   	push   %edi
+ 3a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 3a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 3a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 3a9:	31 db                	xor    %ebx,%ebx
+{
+ 3ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 3ae:	eb 27                	jmp    3d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 3b0:	83 ec 04             	sub    $0x4,%esp
+ 3b3:	6a 01                	push   $0x1
+ 3b5:	56                   	push   %esi
+ 3b6:	6a 00                	push   $0x0
+ 3b8:	e8 cf 02 00 00       	call   68c <read>
+    if(cc < 1)
+ 3bd:	83 c4 10             	add    $0x10,%esp
+ 3c0:	85 c0                	test   %eax,%eax
+ 3c2:	7e 1d                	jle    3e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 3c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 3c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 3cf:	3c 0a                	cmp    $0xa,%al
+ 3d1:	74 10                	je     3e3 <gets+0x43>
+ 3d3:	3c 0d                	cmp    $0xd,%al
+ 3d5:	74 0c                	je     3e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 3d7:	89 df                	mov    %ebx,%edi
+ 3d9:	83 c3 01             	add    $0x1,%ebx
+ 3dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 3df:	7c cf                	jl     3b0 <gets+0x10>
+ 3e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 3ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3ed:	5b                   	pop    %ebx
+ 3ee:	5e                   	pop    %esi
+ 3ef:	5f                   	pop    %edi
+ 3f0:	5d                   	pop    %ebp
+ 3f1:	c3                   	ret
+ 3f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	56                   	push   %esi
+ 404:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 405:	83 ec 08             	sub    $0x8,%esp
+ 408:	6a 00                	push   $0x0
+ 40a:	ff 75 08             	push   0x8(%ebp)
+ 40d:	e8 a2 02 00 00       	call   6b4 <open>
+  if(fd < 0)
+ 412:	83 c4 10             	add    $0x10,%esp
+ 415:	85 c0                	test   %eax,%eax
+ 417:	78 27                	js     440 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 419:	83 ec 08             	sub    $0x8,%esp
+ 41c:	ff 75 0c             	push   0xc(%ebp)
+ 41f:	89 c3                	mov    %eax,%ebx
+ 421:	50                   	push   %eax
+ 422:	e8 a5 02 00 00       	call   6cc <fstat>
+  close(fd);
+ 427:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 42a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 42c:	e8 6b 02 00 00       	call   69c <close>
+  return r;
+ 431:	83 c4 10             	add    $0x10,%esp
+}
+ 434:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 437:	89 f0                	mov    %esi,%eax
+ 439:	5b                   	pop    %ebx
+ 43a:	5e                   	pop    %esi
+ 43b:	5d                   	pop    %ebp
+ 43c:	c3                   	ret
+ 43d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 440:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 445:	eb ed                	jmp    434 <stat+0x34>
+ 447:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 44e:	66 90                	xchg   %ax,%ax
+
+00000450 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 450:	55                   	push   %ebp
+ 451:	89 e5                	mov    %esp,%ebp
+ 453:	53                   	push   %ebx
+ 454:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 457:	0f be 02             	movsbl (%edx),%eax
+ 45a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 45d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 460:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 465:	77 1e                	ja     485 <atoi+0x35>
+ 467:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 470:	83 c2 01             	add    $0x1,%edx
+ 473:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 476:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 47a:	0f be 02             	movsbl (%edx),%eax
+ 47d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 480:	80 fb 09             	cmp    $0x9,%bl
+ 483:	76 eb                	jbe    470 <atoi+0x20>
+  return n;
+}
+ 485:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 488:	89 c8                	mov    %ecx,%eax
+ 48a:	c9                   	leave
+ 48b:	c3                   	ret
+ 48c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000490 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	57                   	push   %edi
+ 494:	56                   	push   %esi
+ 495:	8b 45 10             	mov    0x10(%ebp),%eax
+ 498:	8b 55 08             	mov    0x8(%ebp),%edx
+ 49b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 49e:	85 c0                	test   %eax,%eax
+ 4a0:	7e 13                	jle    4b5 <memmove+0x25>
+ 4a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 4a4:	89 d7                	mov    %edx,%edi
+ 4a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 4ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 4b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 4b1:	39 f8                	cmp    %edi,%eax
+ 4b3:	75 fb                	jne    4b0 <memmove+0x20>
+  return vdst;
+}
+ 4b5:	5e                   	pop    %esi
+ 4b6:	89 d0                	mov    %edx,%eax
+ 4b8:	5f                   	pop    %edi
+ 4b9:	5d                   	pop    %ebp
+ 4ba:	c3                   	ret
+ 4bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4bf:	90                   	nop
+
+000004c0 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 4c0:	55                   	push   %ebp
+ 4c1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4cc:	5d                   	pop    %ebp
+ 4cd:	c3                   	ret
+ 4ce:	66 90                	xchg   %ax,%ax
+
+000004d0 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 4d0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 4d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 4d6:	89 e5                	mov    %esp,%ebp
+ 4d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 4db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4df:	90                   	nop
+ 4e0:	89 c8                	mov    %ecx,%eax
+ 4e2:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 4e5:	85 c0                	test   %eax,%eax
+ 4e7:	75 f7                	jne    4e0 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 4e9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 4ee:	5d                   	pop    %ebp
+ 4ef:	c3                   	ret
+
+000004f0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 4f0:	55                   	push   %ebp
+ 4f1:	31 c0                	xor    %eax,%eax
+ 4f3:	89 e5                	mov    %esp,%ebp
+ 4f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 4f8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 4fd:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 500:	5d                   	pop    %ebp
+ 501:	c3                   	ret
+ 502:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 509:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000510 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 513:	8b 45 08             	mov    0x8(%ebp),%eax
+ 516:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 51c:	5d                   	pop    %ebp
+ 51d:	c3                   	ret
+ 51e:	66 90                	xchg   %ax,%ax
+
+00000520 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 520:	55                   	push   %ebp
+ 521:	b8 01 00 00 00       	mov    $0x1,%eax
+ 526:	89 e5                	mov    %esp,%ebp
+ 528:	56                   	push   %esi
+ 529:	53                   	push   %ebx
+ 52a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 52d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 530:	85 c0                	test   %eax,%eax
+ 532:	74 2d                	je     561 <mutex_lock+0x41>
+ 534:	b8 02 00 00 00       	mov    $0x2,%eax
+ 539:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 53c:	85 c0                	test   %eax,%eax
+ 53e:	74 21                	je     561 <mutex_lock+0x41>
+ 540:	be 02 00 00 00       	mov    $0x2,%esi
+ 545:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 548:	83 ec 04             	sub    $0x4,%esp
+ 54b:	6a 02                	push   $0x2
+ 54d:	6a 00                	push   $0x0
+ 54f:	53                   	push   %ebx
+ 550:	e8 37 02 00 00       	call   78c <futex>
+ 555:	89 f0                	mov    %esi,%eax
+ 557:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 55a:	83 c4 10             	add    $0x10,%esp
+ 55d:	85 c0                	test   %eax,%eax
+ 55f:	75 e7                	jne    548 <mutex_lock+0x28>
+}
+ 561:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 564:	5b                   	pop    %ebx
+ 565:	5e                   	pop    %esi
+ 566:	5d                   	pop    %ebp
+ 567:	c3                   	ret
+ 568:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 56f:	90                   	nop
+
+00000570 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 570:	55                   	push   %ebp
+ 571:	31 c0                	xor    %eax,%eax
+ 573:	89 e5                	mov    %esp,%ebp
+ 575:	83 ec 08             	sub    $0x8,%esp
+ 578:	8b 55 08             	mov    0x8(%ebp),%edx
+ 57b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 57e:	83 f8 02             	cmp    $0x2,%eax
+ 581:	74 05                	je     588 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 583:	c9                   	leave
+ 584:	c3                   	ret
+ 585:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 588:	83 ec 04             	sub    $0x4,%esp
+ 58b:	6a 01                	push   $0x1
+ 58d:	6a 01                	push   $0x1
+ 58f:	52                   	push   %edx
+ 590:	e8 f7 01 00 00       	call   78c <futex>
+ 595:	83 c4 10             	add    $0x10,%esp
+}
+ 598:	c9                   	leave
+ 599:	c3                   	ret
+ 59a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000005a0 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 5a0:	55                   	push   %ebp
+ 5a1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5ac:	5d                   	pop    %ebp
+ 5ad:	c3                   	ret
+ 5ae:	66 90                	xchg   %ax,%ax
+
+000005b0 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 5b0:	55                   	push   %ebp
+ 5b1:	31 c0                	xor    %eax,%eax
+ 5b3:	89 e5                	mov    %esp,%ebp
+ 5b5:	57                   	push   %edi
+ 5b6:	56                   	push   %esi
+ 5b7:	53                   	push   %ebx
+ 5b8:	83 ec 0c             	sub    $0xc,%esp
+ 5bb:	8b 75 08             	mov    0x8(%ebp),%esi
+ 5be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 5c1:	8b 3e                	mov    (%esi),%edi
+ 5c3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 5c6:	83 f8 02             	cmp    $0x2,%eax
+ 5c9:	74 4d                	je     618 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 5cb:	83 ec 04             	sub    $0x4,%esp
+ 5ce:	57                   	push   %edi
+ 5cf:	6a 00                	push   $0x0
+ 5d1:	56                   	push   %esi
+ 5d2:	e8 b5 01 00 00       	call   78c <futex>
+ 5d7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 5dc:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 5df:	83 c4 10             	add    $0x10,%esp
+ 5e2:	85 c0                	test   %eax,%eax
+ 5e4:	74 23                	je     609 <cond_wait+0x59>
+ 5e6:	be 02 00 00 00       	mov    $0x2,%esi
+ 5eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 5ef:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 5f0:	83 ec 04             	sub    $0x4,%esp
+ 5f3:	6a 02                	push   $0x2
+ 5f5:	6a 00                	push   $0x0
+ 5f7:	53                   	push   %ebx
+ 5f8:	e8 8f 01 00 00       	call   78c <futex>
+ 5fd:	89 f0                	mov    %esi,%eax
+ 5ff:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 602:	83 c4 10             	add    $0x10,%esp
+ 605:	85 c0                	test   %eax,%eax
+ 607:	75 e7                	jne    5f0 <cond_wait+0x40>
+}
+ 609:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 60c:	5b                   	pop    %ebx
+ 60d:	5e                   	pop    %esi
+ 60e:	5f                   	pop    %edi
+ 60f:	5d                   	pop    %ebp
+ 610:	c3                   	ret
+ 611:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 618:	83 ec 04             	sub    $0x4,%esp
+ 61b:	6a 01                	push   $0x1
+ 61d:	6a 01                	push   $0x1
+ 61f:	53                   	push   %ebx
+ 620:	e8 67 01 00 00       	call   78c <futex>
+ 625:	83 c4 10             	add    $0x10,%esp
+ 628:	eb a1                	jmp    5cb <cond_wait+0x1b>
+ 62a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000630 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	83 ec 0c             	sub    $0xc,%esp
+ 636:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 639:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 63d:	6a 01                	push   $0x1
+ 63f:	6a 01                	push   $0x1
+ 641:	50                   	push   %eax
+ 642:	e8 45 01 00 00       	call   78c <futex>
+}
+ 647:	83 c4 10             	add    $0x10,%esp
+ 64a:	c9                   	leave
+ 64b:	c3                   	ret
+ 64c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000650 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+ 653:	83 ec 0c             	sub    $0xc,%esp
+ 656:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 659:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 65d:	6a ff                	push   $0xffffffff
+ 65f:	6a 01                	push   $0x1
+ 661:	50                   	push   %eax
+ 662:	e8 25 01 00 00       	call   78c <futex>
+}
+ 667:	83 c4 10             	add    $0x10,%esp
+ 66a:	c9                   	leave
+ 66b:	c3                   	ret
+
+0000066c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 66c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <exit>:
+SYSCALL(exit)
+ 674:	b8 02 00 00 00       	mov    $0x2,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <wait>:
+SYSCALL(wait)
+ 67c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <pipe>:
+SYSCALL(pipe)
+ 684:	b8 04 00 00 00       	mov    $0x4,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <read>:
+SYSCALL(read)
+ 68c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <write>:
+SYSCALL(write)
+ 694:	b8 10 00 00 00       	mov    $0x10,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <close>:
+SYSCALL(close)
+ 69c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <kill>:
+SYSCALL(kill)
+ 6a4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <exec>:
+SYSCALL(exec)
+ 6ac:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <open>:
+SYSCALL(open)
+ 6b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <mknod>:
+SYSCALL(mknod)
+ 6bc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <unlink>:
+SYSCALL(unlink)
+ 6c4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <fstat>:
+SYSCALL(fstat)
+ 6cc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6d1:	cd 40                	int    $0x40
+ 6d3:	c3                   	ret
+
+000006d4 <link>:
+SYSCALL(link)
+ 6d4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6d9:	cd 40                	int    $0x40
+ 6db:	c3                   	ret
+
+000006dc <mkdir>:
+SYSCALL(mkdir)
+ 6dc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6e1:	cd 40                	int    $0x40
+ 6e3:	c3                   	ret
+
+000006e4 <chdir>:
+SYSCALL(chdir)
+ 6e4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6e9:	cd 40                	int    $0x40
+ 6eb:	c3                   	ret
+
+000006ec <dup>:
+SYSCALL(dup)
+ 6ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6f1:	cd 40                	int    $0x40
+ 6f3:	c3                   	ret
+
+000006f4 <getpid>:
+SYSCALL(getpid)
+ 6f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6f9:	cd 40                	int    $0x40
+ 6fb:	c3                   	ret
+
+000006fc <sbrk>:
+SYSCALL(sbrk)
+ 6fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 701:	cd 40                	int    $0x40
+ 703:	c3                   	ret
+
+00000704 <sleep>:
+SYSCALL(sleep)
+ 704:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 709:	cd 40                	int    $0x40
+ 70b:	c3                   	ret
+
+0000070c <uptime>:
+SYSCALL(uptime)
+ 70c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 711:	cd 40                	int    $0x40
+ 713:	c3                   	ret
+
+00000714 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 714:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 719:	cd 40                	int    $0x40
+ 71b:	c3                   	ret
+
+0000071c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 71c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 721:	cd 40                	int    $0x40
+ 723:	c3                   	ret
+
+00000724 <wmap>:
+SYSCALL(wmap)
+ 724:	b8 16 00 00 00       	mov    $0x16,%eax
+ 729:	cd 40                	int    $0x40
+ 72b:	c3                   	ret
+
+0000072c <wunmap>:
+SYSCALL(wunmap)
+ 72c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 731:	cd 40                	int    $0x40
+ 733:	c3                   	ret
+
+00000734 <wremap>:
+SYSCALL(wremap)
+ 734:	b8 18 00 00 00       	mov    $0x18,%eax
+ 739:	cd 40                	int    $0x40
+ 73b:	c3                   	ret
+
+0000073c <wmlock>:
+SYSCALL(wmlock)
+ 73c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 741:	cd 40                	int    $0x40
+ 743:	c3                   	ret
+
+00000744 <wmunlock>:
+SYSCALL(wmunlock)
+ 744:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 749:	cd 40                	int    $0x40
+ 74b:	c3                   	ret
+
+0000074c <wmapoff>:
+SYSCALL(wmapoff)
+ 74c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 751:	cd 40                	int    $0x40
+ 753:	c3                   	ret
+
+00000754 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 754:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 759:	cd 40                	int    $0x40
+ 75b:	c3                   	ret
+
+0000075c <setpriority>:
+SYSCALL(setpriority)
+ 75c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 761:	cd 40                	int    $0x40
+ 763:	c3                   	ret
+
+00000764 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 764:	b8 20 00 00 00       	mov    $0x20,%eax
+ 769:	cd 40                	int    $0x40
+ 76b:	c3                   	ret
+
+0000076c <settickets>:
+SYSCALL(settickets)
+ 76c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 771:	cd 40                	int    $0x40
+ 773:	c3                   	ret
+
+00000774 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 774:	b8 22 00 00 00       	mov    $0x22,%eax
+ 779:	cd 40                	int    $0x40
+ 77b:	c3                   	ret
+
+0000077c <clone>:
+SYSCALL(clone)
+ 77c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 781:	cd 40                	int    $0x40
+ 783:	c3                   	ret
+
+00000784 <join>:
+SYSCALL(join)
+ 784:	b8 24 00 00 00       	mov    $0x24,%eax
+ 789:	cd 40                	int    $0x40
+ 78b:	c3                   	ret
+
+0000078c <futex>:
+SYSCALL(futex)
+ 78c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 791:	cd 40                	int    $0x40
+ 793:	c3                   	ret
+
+00000794 <setaffinity>:
+SYSCALL(setaffinity)
+ 794:	b8 26 00 00 00       	mov    $0x26,%eax
+ 799:	cd 40                	int    $0x40
+ 79b:	c3                   	ret
+
+0000079c <getaffinity>:
+SYSCALL(getaffinity)
+ 79c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 7a1:	cd 40                	int    $0x40
+ 7a3:	c3                   	ret
+
+000007a4 <bcstat>:
+SYSCALL(bcstat)
+ 7a4:	b8 29 00 00 00       	mov    $0x29,%eax
+ 7a9:	cd 40                	int    $0x40
+ 7ab:	c3                   	ret
+
+000007ac <dropcache>:
+SYSCALL(dropcache)
+ 7ac:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 7b1:	cd 40                	int    $0x40
+ 7b3:	c3                   	ret
+
+000007b4 <setiosched>:
+SYSCALL(setiosched)
+ 7b4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 7b9:	cd 40                	int    $0x40
+ 7bb:	c3                   	ret
+
+000007bc <iostat>:
+SYSCALL(iostat)
+ 7bc:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 7c1:	cd 40                	int    $0x40
+ 7c3:	c3                   	ret
+
+000007c4 <fsync>:
+SYSCALL(fsync)
+ 7c4:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 7c9:	cd 40                	int    $0x40
+ 7cb:	c3                   	ret
+
+000007cc <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 7cc:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 7cd:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 7d2:	cd 40                	int    $0x40
+ 7d4:	ff e1                	jmp    *%ecx
+ 7d6:	66 90                	xchg   %ax,%ax
+ 7d8:	66 90                	xchg   %ax,%ax
+ 7da:	66 90                	xchg   %ax,%ax
+ 7dc:	66 90                	xchg   %ax,%ax
+ 7de:	66 90                	xchg   %ax,%ax
+
+000007e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7e0:	55                   	push   %ebp
+ 7e1:	89 e5                	mov    %esp,%ebp
+ 7e3:	57                   	push   %edi
+ 7e4:	56                   	push   %esi
+ 7e5:	53                   	push   %ebx
+ 7e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 7e8:	89 d1                	mov    %edx,%ecx
+{
+ 7ea:	83 ec 3c             	sub    $0x3c,%esp
+ 7ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 7f0:	85 d2                	test   %edx,%edx
+ 7f2:	0f 89 80 00 00 00    	jns    878 <printint+0x98>
+ 7f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 7fc:	74 7a                	je     878 <printint+0x98>
+    x = -xx;
+ 7fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 800:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 805:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 808:	31 f6                	xor    %esi,%esi
+ 80a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 810:	89 c8                	mov    %ecx,%eax
+ 812:	31 d2                	xor    %edx,%edx
+ 814:	89 f7                	mov    %esi,%edi
+ 816:	f7 f3                	div    %ebx
+ 818:	8d 76 01             	lea    0x1(%esi),%esi
+ 81b:	0f b6 92 84 0e 00 00 	movzbl 0xe84(%edx),%edx
+ 822:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 826:	89 ca                	mov    %ecx,%edx
+ 828:	89 c1                	mov    %eax,%ecx
+ 82a:	39 da                	cmp    %ebx,%edx
+ 82c:	73 e2                	jae    810 <printint+0x30>
+  if(neg)
+ 82e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 831:	85 c0                	test   %eax,%eax
+ 833:	74 07                	je     83c <printint+0x5c>
+    buf[i++] = '-';
+ 835:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 83a:	89 f7                	mov    %esi,%edi
+ 83c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 83f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 842:	01 df                	add    %ebx,%edi
+ 844:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 848:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 84b:	83 ec 04             	sub    $0x4,%esp
+ 84e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 851:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 854:	6a 01                	push   $0x1
+ 856:	50                   	push   %eax
+ 857:	56                   	push   %esi
+ 858:	e8 37 fe ff ff       	call   694 <write>
+  while(--i >= 0)
+ 85d:	89 f8                	mov    %edi,%eax
+ 85f:	83 c4 10             	add    $0x10,%esp
+ 862:	83 ef 01             	sub    $0x1,%edi
+ 865:	39 d8                	cmp    %ebx,%eax
+ 867:	75 df                	jne    848 <printint+0x68>
+}
+ 869:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 86c:	5b                   	pop    %ebx
+ 86d:	5e                   	pop    %esi
+ 86e:	5f                   	pop    %edi
+ 86f:	5d                   	pop    %ebp
+ 870:	c3                   	ret
+ 871:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 878:	31 c0                	xor    %eax,%eax
+ 87a:	eb 89                	jmp    805 <printint+0x25>
+ 87c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000880 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 880:	55                   	push   %ebp
+ 881:	89 e5                	mov    %esp,%ebp
+ 883:	57                   	push   %edi
+ 884:	56                   	push   %esi
+ 885:	53                   	push   %ebx
+ 886:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 889:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 88c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 88f:	0f b6 1e             	movzbl (%esi),%ebx
+ 892:	83 c6 01             	add    $0x1,%esi
+ 895:	84 db                	test   %bl,%bl
+ 897:	74 67                	je     900 <printf+0x80>
+ 899:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 89c:	31 d2                	xor    %edx,%edx
+ 89e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 8a1:	eb 34                	jmp    8d7 <printf+0x57>
+ 8a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8a7:	90                   	nop
+ 8a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 8ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 8b0:	83 f8 25             	cmp    $0x25,%eax
+ 8b3:	74 18                	je     8cd <printf+0x4d>
+  write(fd, &c, 1);
+ 8b5:	83 ec 04             	sub    $0x4,%esp
+ 8b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 8bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 8be:	6a 01                	push   $0x1
+ 8c0:	50                   	push   %eax
+ 8c1:	57                   	push   %edi
+ 8c2:	e8 cd fd ff ff       	call   694 <write>
+ 8c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 8ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 8cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 8d0:	83 c6 01             	add    $0x1,%esi
+ 8d3:	84 db                	test   %bl,%bl
+ 8d5:	74 29                	je     900 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 8d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 8da:	85 d2                	test   %edx,%edx
+ 8dc:	74 ca                	je     8a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 8de:	83 fa 25             	cmp    $0x25,%edx
+ 8e1:	75 ea                	jne    8cd <printf+0x4d>
+      if(c == 'd'){
+ 8e3:	83 f8 25             	cmp    $0x25,%eax
+ 8e6:	0f 84 24 01 00 00    	je     a10 <printf+0x190>
+ 8ec:	83 e8 63             	sub    $0x63,%eax
+ 8ef:	83 f8 15             	cmp    $0x15,%eax
+ 8f2:	77 1c                	ja     910 <printf+0x90>
+ 8f4:	ff 24 85 2c 0e 00 00 	jmp    *0xe2c(,%eax,4)
+ 8fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 8ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 900:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 903:	5b                   	pop    %ebx
+ 904:	5e                   	pop    %esi
+ 905:	5f                   	pop    %edi
+ 906:	5d                   	pop    %ebp
+ 907:	c3                   	ret
+ 908:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 90f:	90                   	nop
+  write(fd, &c, 1);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 916:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 91a:	6a 01                	push   $0x1
+ 91c:	52                   	push   %edx
+ 91d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 920:	57                   	push   %edi
+ 921:	e8 6e fd ff ff       	call   694 <write>
+ 926:	83 c4 0c             	add    $0xc,%esp
+ 929:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 92c:	6a 01                	push   $0x1
+ 92e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 931:	52                   	push   %edx
+ 932:	57                   	push   %edi
+ 933:	e8 5c fd ff ff       	call   694 <write>
+        putc(fd, c);
+ 938:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 93b:	31 d2                	xor    %edx,%edx
+ 93d:	eb 8e                	jmp    8cd <printf+0x4d>
+ 93f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 940:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 943:	83 ec 0c             	sub    $0xc,%esp
+ 946:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 94b:	8b 13                	mov    (%ebx),%edx
+ 94d:	6a 00                	push   $0x0
+ 94f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 951:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 954:	e8 87 fe ff ff       	call   7e0 <printint>
+        ap++;
+ 959:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 95c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 95f:	31 d2                	xor    %edx,%edx
+ 961:	e9 67 ff ff ff       	jmp    8cd <printf+0x4d>
+ 966:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 96d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 970:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 973:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 975:	83 c0 04             	add    $0x4,%eax
+ 978:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 97b:	85 db                	test   %ebx,%ebx
+ 97d:	0f 84 9d 00 00 00    	je     a20 <printf+0x1a0>
+        while(*s != 0){
+ 983:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 986:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 988:	84 c0                	test   %al,%al
+ 98a:	0f 84 3d ff ff ff    	je     8cd <printf+0x4d>
+ 990:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 993:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 996:	89 de                	mov    %ebx,%esi
+ 998:	89 d3                	mov    %edx,%ebx
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 9a0:	83 ec 04             	sub    $0x4,%esp
+ 9a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 9a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 9a9:	6a 01                	push   $0x1
+ 9ab:	53                   	push   %ebx
+ 9ac:	57                   	push   %edi
+ 9ad:	e8 e2 fc ff ff       	call   694 <write>
+        while(*s != 0){
+ 9b2:	0f b6 06             	movzbl (%esi),%eax
+ 9b5:	83 c4 10             	add    $0x10,%esp
+ 9b8:	84 c0                	test   %al,%al
+ 9ba:	75 e4                	jne    9a0 <printf+0x120>
+      state = 0;
+ 9bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 9bf:	31 d2                	xor    %edx,%edx
+ 9c1:	e9 07 ff ff ff       	jmp    8cd <printf+0x4d>
+ 9c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 9cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 9d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 9d3:	83 ec 0c             	sub    $0xc,%esp
+ 9d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 9db:	8b 13                	mov    (%ebx),%edx
+ 9dd:	6a 01                	push   $0x1
+ 9df:	e9 6b ff ff ff       	jmp    94f <printf+0xcf>
+ 9e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 9e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 9eb:	83 ec 04             	sub    $0x4,%esp
+ 9ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 9f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 9f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 9f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 9f9:	6a 01                	push   $0x1
+ 9fb:	52                   	push   %edx
+ 9fc:	57                   	push   %edi
+ 9fd:	e8 92 fc ff ff       	call   694 <write>
+        ap++;
+ a02:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ a05:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ a08:	31 d2                	xor    %edx,%edx
+ a0a:	e9 be fe ff ff       	jmp    8cd <printf+0x4d>
+ a0f:	90                   	nop
+  write(fd, &c, 1);
+ a10:	83 ec 04             	sub    $0x4,%esp
+ a13:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ a16:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ a19:	6a 01                	push   $0x1
+ a1b:	e9 11 ff ff ff       	jmp    931 <printf+0xb1>
+ a20:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ a25:	bb 24 0e 00 00       	mov    $0xe24,%ebx
+ a2a:	e9 61 ff ff ff       	jmp    990 <printf+0x110>
+ a2f:	90                   	nop
+
+00000a30 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a30:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a31:	a1 40 13 00 00       	mov    0x1340,%eax
+{
+ a36:	89 e5                	mov    %esp,%ebp
+ a38:	57                   	push   %edi
+ a39:	56                   	push   %esi
+ a3a:	53                   	push   %ebx
+ a3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ a3e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a41:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a48:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a4a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a4c:	39 ca                	cmp    %ecx,%edx
+ a4e:	73 30                	jae    a80 <free+0x50>
+ a50:	39 c1                	cmp    %eax,%ecx
+ a52:	72 04                	jb     a58 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a54:	39 c2                	cmp    %eax,%edx
+ a56:	72 f0                	jb     a48 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a58:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ a5b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ a5e:	39 f8                	cmp    %edi,%eax
+ a60:	74 2e                	je     a90 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a62:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ a65:	8b 42 04             	mov    0x4(%edx),%eax
+ a68:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ a6b:	39 f1                	cmp    %esi,%ecx
+ a6d:	74 38                	je     aa7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ a6f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ a71:	5b                   	pop    %ebx
+  freep = p;
+ a72:	89 15 40 13 00 00    	mov    %edx,0x1340
+}
+ a78:	5e                   	pop    %esi
+ a79:	5f                   	pop    %edi
+ a7a:	5d                   	pop    %ebp
+ a7b:	c3                   	ret
+ a7c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a80:	39 c1                	cmp    %eax,%ecx
+ a82:	72 d0                	jb     a54 <free+0x24>
+ a84:	eb c2                	jmp    a48 <free+0x18>
+ a86:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ a90:	03 70 04             	add    0x4(%eax),%esi
+ a93:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a96:	8b 02                	mov    (%edx),%eax
+ a98:	8b 00                	mov    (%eax),%eax
+ a9a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ a9d:	8b 42 04             	mov    0x4(%edx),%eax
+ aa0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ aa3:	39 f1                	cmp    %esi,%ecx
+ aa5:	75 c8                	jne    a6f <free+0x3f>
+    p->s.size += bp->s.size;
+ aa7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ aaa:	89 15 40 13 00 00    	mov    %edx,0x1340
+    p->s.size += bp->s.size;
+ ab0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ ab3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ ab6:	89 0a                	mov    %ecx,(%edx)
+}
+ ab8:	5b                   	pop    %ebx
+ ab9:	5e                   	pop    %esi
+ aba:	5f                   	pop    %edi
+ abb:	5d                   	pop    %ebp
+ abc:	c3                   	ret
+ abd:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000ac0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ ac0:	55                   	push   %ebp
+ ac1:	89 e5                	mov    %esp,%ebp
+ ac3:	57                   	push   %edi
+ ac4:	56                   	push   %esi
+ ac5:	53                   	push   %ebx
+ ac6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ac9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ acc:	8b 15 40 13 00 00    	mov    0x1340,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ad2:	8d 78 07             	lea    0x7(%eax),%edi
+ ad5:	c1 ef 03             	shr    $0x3,%edi
+ ad8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ adb:	85 d2                	test   %edx,%edx
+ add:	0f 84 8d 00 00 00    	je     b70 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ae3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ ae5:	8b 48 04             	mov    0x4(%eax),%ecx
+ ae8:	39 f9                	cmp    %edi,%ecx
+ aea:	73 64                	jae    b50 <malloc+0x90>
+  if(nu < 4096)
+ aec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ af1:	39 df                	cmp    %ebx,%edi
+ af3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ af6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ afd:	eb 0a                	jmp    b09 <malloc+0x49>
+ aff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b00:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ b02:	8b 48 04             	mov    0x4(%eax),%ecx
+ b05:	39 f9                	cmp    %edi,%ecx
+ b07:	73 47                	jae    b50 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ b09:	89 c2                	mov    %eax,%edx
+ b0b:	39 05 40 13 00 00    	cmp    %eax,0x1340
+ b11:	75 ed                	jne    b00 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ b13:	83 ec 0c             	sub    $0xc,%esp
+ b16:	56                   	push   %esi
+ b17:	e8 e0 fb ff ff       	call   6fc <sbrk>
+  if(p == (char*)-1)
+ b1c:	83 c4 10             	add    $0x10,%esp
+ b1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ b22:	74 1c                	je     b40 <malloc+0x80>
+  hp->s.size = nu;
+ b24:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ b27:	83 ec 0c             	sub    $0xc,%esp
+ b2a:	83 c0 08             	add    $0x8,%eax
+ b2d:	50                   	push   %eax
+ b2e:	e8 fd fe ff ff       	call   a30 <free>
+  return freep;
+ b33:	8b 15 40 13 00 00    	mov    0x1340,%edx
+      if((p = morecore(nunits)) == 0)
+ b39:	83 c4 10             	add    $0x10,%esp
+ b3c:	85 d2                	test   %edx,%edx
+ b3e:	75 c0                	jne    b00 <malloc+0x40>
+        return 0;
+  }
+}
+ b40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ b43:	31 c0                	xor    %eax,%eax
+}
+ b45:	5b                   	pop    %ebx
+ b46:	5e                   	pop    %esi
+ b47:	5f                   	pop    %edi
+ b48:	5d                   	pop    %ebp
+ b49:	c3                   	ret
+ b4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ b50:	39 cf                	cmp    %ecx,%edi
+ b52:	74 4c                	je     ba0 <malloc+0xe0>
+        p->s.size -= nunits;
+ b54:	29 f9                	sub    %edi,%ecx
+ b56:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ b59:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ b5c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ b5f:	89 15 40 13 00 00    	mov    %edx,0x1340
+}
+ b65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ b68:	83 c0 08             	add    $0x8,%eax
+}
+ b6b:	5b                   	pop    %ebx
+ b6c:	5e                   	pop    %esi
+ b6d:	5f                   	pop    %edi
+ b6e:	5d                   	pop    %ebp
+ b6f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ b70:	c7 05 40 13 00 00 44 	movl   $0x1344,0x1340
+ b77:	13 00 00 
+    base.s.size = 0;
+ b7a:	b8 44 13 00 00       	mov    $0x1344,%eax
+    base.s.ptr = freep = prevp = &base;
+ b7f:	c7 05 44 13 00 00 44 	movl   $0x1344,0x1344
+ b86:	13 00 00 
+    base.s.size = 0;
+ b89:	c7 05 48 13 00 00 00 	movl   $0x0,0x1348
+ b90:	00 00 00 
+    if(p->s.size >= nunits){
+ b93:	e9 54 ff ff ff       	jmp    aec <malloc+0x2c>
+ b98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ b9f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ ba0:	8b 08                	mov    (%eax),%ecx
+ ba2:	89 0a                	mov    %ecx,(%edx)
+ ba4:	eb b9                	jmp    b5f <malloc+0x9f>
+ ba6:	66 90                	xchg   %ax,%ax
+ ba8:	66 90                	xchg   %ax,%ax
+ baa:	66 90                	xchg   %ax,%ax
+ bac:	66 90                	xchg   %ax,%ax
+ bae:	66 90                	xchg   %ax,%ax
+
+00000bb0 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ bb0:	55                   	push   %ebp
+ bb1:	89 e5                	mov    %esp,%ebp
+ bb3:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ bb6:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb9:	c1 e0 04             	shl    $0x4,%eax
+ bbc:	ff b0 8c 13 00 00    	push   0x138c(%eax)
+ bc2:	05 80 13 00 00       	add    $0x1380,%eax
+ bc7:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ bca:	e8 a5 fa ff ff       	call   674 <exit>
+ bcf:	90                   	nop
+
+00000bd0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ bd0:	55                   	push   %ebp
+ bd1:	89 e5                	mov    %esp,%ebp
+ bd3:	57                   	push   %edi
+ bd4:	56                   	push   %esi
+ bd5:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ bd6:	31 db                	xor    %ebx,%ebx
+{
+ bd8:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ bdb:	68 60 13 00 00       	push   $0x1360
+ be0:	e8 eb f8 ff ff       	call   4d0 <lock_acquire>
+ be5:	83 c4 10             	add    $0x10,%esp
+ be8:	eb 12                	jmp    bfc <thread_create+0x2c>
+ bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ bf0:	83 c3 01             	add    $0x1,%ebx
+ bf3:	83 fb 40             	cmp    $0x40,%ebx
+ bf6:	0f 84 c4 00 00 00    	je     cc0 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ bfc:	89 de                	mov    %ebx,%esi
+ bfe:	c1 e6 04             	shl    $0x4,%esi
+ c01:	8b 96 80 13 00 00    	mov    0x1380(%esi),%edx
+ c07:	85 d2                	test   %edx,%edx
+ c09:	75 e5                	jne    bf0 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ c0b:	83 ec 0c             	sub    $0xc,%esp
+ c0e:	68 00 20 00 00       	push   $0x2000
+ c13:	e8 a8 fe ff ff       	call   ac0 <malloc>
+ c18:	83 c4 10             	add    $0x10,%esp
+ c1b:	85 c0                	test   %eax,%eax
+ c1d:	0f 84 9d 00 00 00    	je     cc0 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ c23:	89 86 84 13 00 00    	mov    %eax,0x1384(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ c29:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ c2e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ c31:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ c36:	89 86 80 13 00 00    	mov    %eax,0x1380(%esi)
+  threads[i].fn = fn;
+ c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3f:	89 86 88 13 00 00    	mov    %eax,0x1388(%esi)
+  threads[i].arg = arg;
+ c45:	8b 45 0c             	mov    0xc(%ebp),%eax
+ c48:	89 86 8c 13 00 00    	mov    %eax,0x138c(%esi)
+  lock_release(&threadslock);
+ c4e:	68 60 13 00 00       	push   $0x1360
+ c53:	e8 98 f8 ff ff       	call   4f0 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ c58:	83 c4 0c             	add    $0xc,%esp
+ c5b:	ff b6 80 13 00 00    	push   0x1380(%esi)
+ c61:	53                   	push   %ebx
+ c62:	68 b0 0b 00 00       	push   $0xbb0
+ c67:	e8 10 fb ff ff       	call   77c <clone>
+ c6c:	83 c4 10             	add    $0x10,%esp
+ c6f:	85 c0                	test   %eax,%eax
+ c71:	78 0d                	js     c80 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ c73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ c76:	5b                   	pop    %ebx
+ c77:	5e                   	pop    %esi
+ c78:	5f                   	pop    %edi
+ c79:	5d                   	pop    %ebp
+ c7a:	c3                   	ret
+ c7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ c7f:	90                   	nop
+    lock_acquire(&threadslock);
+ c80:	83 ec 0c             	sub    $0xc,%esp
+ c83:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ c86:	68 60 13 00 00       	push   $0x1360
+ c8b:	e8 40 f8 ff ff       	call   4d0 <lock_acquire>
+    free(threads[i].block);
+ c90:	58                   	pop    %eax
+ c91:	ff b6 84 13 00 00    	push   0x1384(%esi)
+ c97:	e8 94 fd ff ff       	call   a30 <free>
+    threads[i].stack = 0;
+ c9c:	c7 86 80 13 00 00 00 	movl   $0x0,0x1380(%esi)
+ ca3:	00 00 00 
+    lock_release(&threadslock);
+ ca6:	c7 04 24 60 13 00 00 	movl   $0x1360,(%esp)
+ cad:	e8 3e f8 ff ff       	call   4f0 <lock_release>
+ cb2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ cb5:	83 c4 10             	add    $0x10,%esp
+}
+ cb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ cbb:	5b                   	pop    %ebx
+ cbc:	5e                   	pop    %esi
+ cbd:	5f                   	pop    %edi
+ cbe:	5d                   	pop    %ebp
+ cbf:	c3                   	ret
+    lock_release(&threadslock);
+ cc0:	83 ec 0c             	sub    $0xc,%esp
+ cc3:	68 60 13 00 00       	push   $0x1360
+ cc8:	e8 23 f8 ff ff       	call   4f0 <lock_release>
+    return -1;
+ ccd:	83 c4 10             	add    $0x10,%esp
+ cd0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ cd5:	eb 9c                	jmp    c73 <thread_create+0xa3>
+ cd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ cde:	66 90                	xchg   %ax,%ax
+
+00000ce0 <thread_join>:
+
+int
+thread_join(void)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	89 e5                	mov    %esp,%ebp
+ ce3:	56                   	push   %esi
+ ce4:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ ce5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ ce8:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ ceb:	50                   	push   %eax
+ cec:	e8 93 fa ff ff       	call   784 <join>
+ cf1:	83 c4 10             	add    $0x10,%esp
+ cf4:	85 c0                	test   %eax,%eax
+ cf6:	78 69                	js     d61 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ cf8:	83 ec 0c             	sub    $0xc,%esp
+ cfb:	89 c6                	mov    %eax,%esi
+ cfd:	68 60 13 00 00       	push   $0x1360
+ d02:	e8 c9 f7 ff ff       	call   4d0 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ d07:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ d0a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ d0d:	31 c0                	xor    %eax,%eax
+ d0f:	eb 0f                	jmp    d20 <thread_join+0x40>
+ d11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ d18:	83 c0 01             	add    $0x1,%eax
+ d1b:	83 f8 40             	cmp    $0x40,%eax
+ d1e:	74 28                	je     d48 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ d20:	89 c3                	mov    %eax,%ebx
+ d22:	c1 e3 04             	shl    $0x4,%ebx
+ d25:	39 93 80 13 00 00    	cmp    %edx,0x1380(%ebx)
+ d2b:	75 eb                	jne    d18 <thread_join+0x38>
+      free(threads[i].block);
+ d2d:	83 ec 0c             	sub    $0xc,%esp
+ d30:	ff b3 84 13 00 00    	push   0x1384(%ebx)
+ d36:	e8 f5 fc ff ff       	call   a30 <free>
+      threads[i].stack = 0;
+      break;
+ d3b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ d3e:	c7 83 80 13 00 00 00 	movl   $0x0,0x1380(%ebx)
+ d45:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ d48:	83 ec 0c             	sub    $0xc,%esp
+ d4b:	68 60 13 00 00       	push   $0x1360
+ d50:	e8 9b f7 ff ff       	call   4f0 <lock_release>
+  return pid;
+ d55:	83 c4 10             	add    $0x10,%esp
+}
+ d58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ d5b:	89 f0                	mov    %esi,%eax
+ d5d:	5b                   	pop    %ebx
+ d5e:	5e                   	pop    %esi
+ d5f:	5d                   	pop    %ebp
+ d60:	c3                   	ret
+    return -1;
+ d61:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ d66:	eb f0                	jmp    d58 <thread_join+0x78>
@@ -0,0 +1,95 @@
+// Test that stride scheduling divides the CPU in proportion to
+// tickets.  Forks spinners holding 100, 200 and 300 tickets, lets
+// them compete for a while, and checks each one's measured ticks
+// against its expected share.  Run under make qemu CPUS=1: with
+// more CPUs than spinners every spinner simply gets a CPU.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define NCHILD    3
+#define RUNTICKS  300  // how long the spinners compete
+#define TOLERANCE 20   // allowed error, percent of the expected share
+
+int tickets[NCHILD] = { 100, 200, 300 };
+
+// Spin until uptime() reaches end, then report the ticks we ran.
+void
+spinner(int n, int end, int fd)
+{
+  struct schedinfo si;
+  int i, used;
+
+  if(settickets(n) < 0){
+    printf(1, "stridetest: settickets failed\n");
+    exit();
+  }
+  while(uptime() < end)
+    ;
+  used = 0;
+  if(getschedinfo(getpid(), &si) == 0)
+    for(i = 0; i < NPRIO; i++)
+      used += si.ticks[i];
+  write(fd, &used, sizeof(used));
+  exit();
+}
+
+int
+main(int argc, char *argv[])
+{
+  int fds[2], rfd[NCHILD], used[NCHILD];
+  int i, old, end, total, sum, expect, err, failed;
+
+  printf(1, "stridetest starting\n");
+  if((old = setschedpolicy(SCHED_STRIDE)) < 0){
+    printf(1, "stridetest: setschedpolicy failed\n");
+    exit();
+  }
+  // Outrank the spinners so we are sure to get to fork them all.
+  settickets(MAXTICKETS);
+
+  end = uptime() + RUNTICKS;
+  for(i = 0; i < NCHILD; i++){
+    if(pipe(fds) < 0){
+      printf(1, "stridetest: pipe failed\n");
+      exit();
+    }
+    if(fork() == 0){
+      close(fds[0]);
+      spinner(tickets[i], end, fds[1]);
+    }
+    close(fds[1]);
+    rfd[i] = fds[0];
+  }
+  for(i = 0; i < NCHILD; i++)
+    wait();
+  for(i = 0; i < NCHILD; i++){
+    if(read(rfd[i], &used[i], sizeof(used[i])) != sizeof(used[i]))
+      used[i] = 0;
+    close(rfd[i]);
+  }
+  setschedpolicy(old);
+
+  total = sum = 0;
+  for(i = 0; i < NCHILD; i++){
+    total += used[i];
+    sum += tickets[i];
+  }
+  failed = total == 0;
+  for(i = 0; i < NCHILD; i++){
+    expect = total * tickets[i] / sum;
+    err = used[i] - expect;
+    if(err < 0)
+      err = -err;
+    printf(1, "tickets %d: ran %d ticks, expected %d\n",
+           tickets[i], used[i], expect);
+    if(err * 100 > expect * TOLERANCE)
+      failed = 1;
+  }
+  if(failed)
+    printf(1, "stridetest: FAILED\n");
+  else
+    printf(1, "stridetest ok\n");
+  exit();
+}
@@ -108,6 +108,25 @@ extern int sys_getwmapinfo(void);
 extern int sys_wmap(void);
 extern int sys_wunmap(void);
 extern int sys_wremap(void);
+extern int sys_wmlock(void);
+extern int sys_wmunlock(void);
+extern int sys_wmapoff(void);
+extern int sys_wunmaprange(void);
+extern int sys_setpriority(void);
+extern int sys_getschedinfo(void);
+extern int sys_settickets(void);
+extern int sys_setschedpolicy(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex(void);
+extern int sys_setaffinity(void);
+extern int sys_getaffinity(void);
+extern int sys_vfork(void);
+extern int sys_bcstat(void);
+extern int sys_dropcache(void);
+extern int sys_setiosched(void);
+extern int sys_iostat(void);
+extern int sys_fsync(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]         sys_fork,
@@ -136,6 +155,25 @@ static int (*syscalls[])(void) = {
 [SYS_wmap]         sys_wmap,
 [SYS_wunmap]       sys_wunmap,
 [SYS_wremap]       sys_wremap,
+[SYS_wmlock]       sys_wmlock,
+[SYS_wmunlock]     sys_wmunlock,
+[SYS_wmapoff]      sys_wmapoff,
+[SYS_wunmaprange]  sys_wunmaprange,
+[SYS_setpriority]  sys_setpriority,
+[SYS_getschedinfo] sys_getschedinfo,
+[SYS_settickets]   sys_settickets,
+[SYS_setschedpolicy] sys_setschedpolicy,
+[SYS_clone]        sys_clone,
+[SYS_join]         sys_join,
+[SYS_futex]        sys_futex,
+[SYS_setaffinity]  sys_setaffinity,
+[SYS_getaffinity]  sys_getaffinity,
+[SYS_vfork]        sys_vfork,
+[SYS_bcstat]       sys_bcstat,
+[SYS_dropcache]    sys_dropcache,
+[SYS_setiosched]   sys_setiosched,
+[SYS_iostat]       sys_iostat,
+[SYS_fsync]        sys_fsync,
 };
 
 void
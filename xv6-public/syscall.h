@@ -24,4 +24,23 @@
 #define SYS_wunmap 23
 #define SYS_wremap 24
 #define SYS_getwmapinfo 25
-#define SYS_getpgdirinfo 26
\ No newline at end of file
+#define SYS_getpgdirinfo 26
+#define SYS_wmlock 27
+#define SYS_wmunlock 28
+#define SYS_wmapoff 29
+#define SYS_wunmaprange 30
+#define SYS_setpriority 31
+#define SYS_getschedinfo 32
+#define SYS_settickets 33
+#define SYS_setschedpolicy 34
+#define SYS_clone 35
+#define SYS_join 36
+#define SYS_futex 37
+#define SYS_setaffinity 38
+#define SYS_getaffinity 39
+#define SYS_vfork 40
+#define SYS_bcstat 41
+#define SYS_dropcache 42
+#define SYS_setiosched 43
+#define SYS_iostat 44
+#define SYS_fsync 45
\ No newline at end of file
@@ -15,6 +15,8 @@
 #include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
+#include "bcache.h"
+#include "iosched.h"
 
 // Fetch the nth word-sized system call argument as a file descriptor
 // and return both the descriptor and the corresponding struct file.
@@ -26,7 +28,7 @@ argfd(int n, int *pfd, struct file **pf)
 
   if(argint(n, &fd) < 0)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=myproc()->ofile[fd]) == 0)
+  if(fd < 0 || fd >= NOFILE || (f=myproc()->fdt->ofile[fd]) == 0)
     return -1;
   if(pfd)
     *pfd = fd;
@@ -41,14 +43,17 @@ static int
 fdalloc(struct file *f)
 {
   int fd;
-  struct proc *curproc = myproc();
+  struct fdtable *fdt = myproc()->fdt;
 
+  acquire(&fdt->lock);
   for(fd = 0; fd < NOFILE; fd++){
-    if(curproc->ofile[fd] == 0){
-      curproc->ofile[fd] = f;
+    if(fdt->ofile[fd] == 0){
+      fdt->ofile[fd] = f;
+      release(&fdt->lock);
       return fd;
     }
   }
+  release(&fdt->lock);
   return -1;
 }
 
@@ -95,10 +100,18 @@ sys_close(void)
 {
   int fd;
   struct file *f;
+  struct fdtable *fdt = myproc()->fdt;
 
   if(argfd(0, &fd, &f) < 0)
     return -1;
-  myproc()->ofile[fd] = 0;
+  // Another thread may have closed it meanwhile.
+  acquire(&fdt->lock);
+  if(fdt->ofile[fd] != f){
+    release(&fdt->lock);
+    return -1;
+  }
+  fdt->ofile[fd] = 0;
+  release(&fdt->lock);
   fileclose(f);
   return 0;
 }
@@ -433,7 +446,7 @@ sys_pipe(void)
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
     if(fd0 >= 0)
-      myproc()->ofile[fd0] = 0;
+      myproc()->fdt->ofile[fd0] = 0;
     fileclose(rf);
     fileclose(wf);
     return -1;
@@ -442,3 +455,64 @@ sys_pipe(void)
   fd[1] = fd1;
   return 0;
 }
+
+// Wait until every finished file system call, including the
+// writes to fd, is on disk.
+int
+sys_fsync(void)
+{
+  struct file *f;
+
+  if(argfd(0, 0, &f) < 0)
+    return -1;
+  log_flush();
+  return 0;
+}
+
+// Copy the buffer cache's statistics out to the user.
+int
+sys_bcstat(void)
+{
+  struct bcstat *st;
+  struct bcstat localst;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  bcstat(&localst);
+  if(copyout(myproc()->pgdir, (uint)st, (char*)&localst, sizeof(localst)) < 0)
+    return -1;
+  return 0;
+}
+
+// Empty the buffer cache of clean blocks, for benchmarks that
+// want to start cold.
+int
+sys_dropcache(void)
+{
+  bdrop();
+  return 0;
+}
+
+int
+sys_setiosched(void)
+{
+  int policy;
+
+  if(argint(0, &policy) < 0)
+    return -1;
+  return idesetsched(policy);
+}
+
+int
+sys_iostat(void)
+{
+  struct iostat *st;
+  struct iostat localst;
+
+  if(argptr(0, (void*)&st, sizeof(*st)) < 0)
+    return -1;
+  ideiostat(&localst);
+  if(copyout(myproc()->pgdir, (uint)st, (char*)&localst, sizeof(localst)) < 0)
+    return -1;
+  return 0;
+}
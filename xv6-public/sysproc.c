@@ -7,8 +7,14 @@
 #include "mmu.h"
 #include "proc.h"
 #include "wmap.h"
+#include "futex.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "file.h"
 
-#define PAGE_SIZE 4096
+#define WMAP_BASE 0x60000000 // Lowest address wmap may use
+#define WMAPSYNCTRIES 4      // Write-backs wmapsync tries before unmapping
 
 int
 sys_fork(void)
@@ -16,6 +22,12 @@ sys_fork(void)
   return fork();
 }
 
+int
+sys_vfork(void)
+{
+  return vfork();
+}
+
 int
 sys_exit(void)
 {
@@ -74,7 +86,8 @@ sys_sleep(void)
       release(&tickslock);
       return -1;
     }
-    sleep(&ticks, &tickslock);
+    tickwait(ticks0 + n);
+    sleep(tickchan(ticks0 + n), &tickslock);
   }
   release(&tickslock);
   return 0;
@@ -93,6 +106,148 @@ sys_uptime(void)
   return xticks;
 }
 
+// Pin a process at an MLFQ level; -1 unpins it.
+int
+sys_setpriority(void)
+{
+  int pid, prio;
+
+  if(argint(0, &pid) < 0 || argint(1, &prio) < 0)
+    return -1;
+  return setpriority(pid, prio);
+}
+
+int
+sys_getschedinfo(void)
+{
+  int pid;
+  struct schedinfo *info;
+  struct schedinfo localinfo;
+
+  if(argint(0, &pid) < 0 || argptr(1, (void*)&info, sizeof(*info)) < 0)
+    return -1;
+  if(getschedinfo(pid, &localinfo) < 0)
+    return -1;
+  if(copyout(myproc()->pgdir, (uint)info, (char*)&localinfo, sizeof(localinfo)) < 0)
+    return -1;
+  return 0;
+}
+
+int
+sys_settickets(void)
+{
+  int n;
+
+  if(argint(0, &n) < 0)
+    return -1;
+  return settickets(n);
+}
+
+// Select SCHED_MLFQ or SCHED_STRIDE; returns the old policy.
+int
+sys_setschedpolicy(void)
+{
+  int policy;
+
+  if(argint(0, &policy) < 0)
+    return -1;
+  return setschedpolicy(policy);
+}
+
+int
+sys_setaffinity(void)
+{
+  int pid, mask, flags;
+
+  if(argint(0, &pid) < 0 || argint(1, &mask) < 0 || argint(2, &flags) < 0)
+    return -1;
+  return setaffinity(pid, mask, flags);
+}
+
+int
+sys_getaffinity(void)
+{
+  int pid;
+
+  if(argint(0, &pid) < 0)
+    return -1;
+  return getaffinity(pid);
+}
+
+int
+sys_clone(void)
+{
+  void (*fn)(void*);
+  void *arg, *stack;
+
+  if(argint(0, (int*)&fn) < 0 || argint(1, (int*)&arg) < 0 ||
+     argint(2, (int*)&stack) < 0)
+    return -1;
+  return clone(fn, arg, stack);
+}
+
+int
+sys_join(void)
+{
+  void **stack;
+  void *ustack;
+  int pid;
+
+  if(argptr(0, (void*)&stack, sizeof(*stack)) < 0)
+    return -1;
+  if((pid = join(&ustack)) >= 0)
+    *stack = ustack;
+  return pid;
+}
+
+// Kernel address of the user word at addr, faulting in a wmap
+// page that has not been touched yet; 0 if there is no such word.
+static uint*
+futexword(struct proc *p, uint addr)
+{
+  char *page;
+
+  if(addr % sizeof(uint))
+    return 0;
+  acquiresleep(&p->vm->lock);
+  page = uva2ka(p->pgdir, (char*)addr);
+  releasesleep(&p->vm->lock);
+  if(page == 0 && wmapfault(p, addr) == 0){
+    acquiresleep(&p->vm->lock);
+    page = uva2ka(p->pgdir, (char*)addr);
+    releasesleep(&p->vm->lock);
+  }
+  if(page == 0)
+    return 0;
+  return (uint*)(page + addr % PGSIZE);
+}
+
+// futex(addr, op, val)
+// FUTEX_WAIT sleeps, if the word at addr still holds val, until a
+// FUTEX_WAKE on the same word; returns -1 at once if it does not.
+// FUTEX_WAKE wakes up to val waiters, all of them if val < 0, and
+// returns how many it woke.
+// Waiters are keyed by the word's physical page, so processes that
+// share it through a MAP_SHARED region can wait on each other.
+int
+sys_futex(void)
+{
+  int addr, op, val;
+  uint *word;
+
+  if(argint(0, &addr) < 0 || argint(1, &op) < 0 || argint(2, &val) < 0)
+    return -1;
+  if((word = futexword(myproc(), addr)) == 0)
+    return -1;
+  switch(op){
+  case FUTEX_WAIT:
+    return futexwait(word, val);
+  case FUTEX_WAKE:
+    return futexwake(word, val);
+  }
+  return -1;
+}
+
 //Custom Syscalls
 int
 sys_getpgdirinfo(void){
@@ -152,7 +307,10 @@ sys_getwmapinfo(void) {
   struct proc *myProc = myproc();
 
   // Copy from kernel to user space
-  if (copyout(myProc->pgdir, (uint)wminfo, (char *) & (myProc->wmap), sizeof(struct wmapinfo)) < 0)
+  acquiresleep(&myProc->vm->lock);
+  int ret = copyout(myProc->pgdir, (uint)wminfo, (char *) & (myProc->vm->wmap), sizeof(struct wmapinfo));
+  releasesleep(&myProc->vm->lock);
+  if (ret < 0)
   {
     return FAILED;
   }
@@ -160,144 +318,497 @@ sys_getwmapinfo(void) {
   return 0;
 }
 
-int
-sys_wmap(void) {
+// Return 1 if [addr, addr+len) leaves the wmap area or overlaps any
+// of p's regions other than skip.
+static int
+wmapcollides(struct proc *p, uint addr, uint len, int skip)
+{
+  len = PGROUNDUP(len);
+  if ((addr < WMAP_BASE) || (addr + len > KERNBASE) || (addr + len < addr)) {
+    return 1;
+  }
+  for (int i = 0; i < p->vm->wmap.total_mmaps; i++) {
+    uint start = p->vm->wmap.addr[i];
+    uint end = start + PGROUNDUP(p->vm->wmap.length[i]);
+    if ((i != skip) && (addr < end) && (start < addr + len)) {
+      return 1;
+    }
+  }
+  return 0;
+}
 
-  // Args
-  int addr;
-  if (argint(0, &addr) != 0) {
-    return FAILED;
+// Find the lowest free spot for len bytes, leaving a one page gap on
+// either side so that independent mappings are never placed back to
+// back (and so never merged). A free range can only start at
+// WMAP_BASE or just past an existing region, so only those are
+// tried. With align set, 4MB-aligned spots are preferred so that
+// moveuvm can hand over whole page tables. Returns 0 if full.
+static uint
+wmapfindfree(struct proc *p, uint len, int align)
+{
+  uint best = 0;
+
+  for (int pass = align ? 0 : 1; pass < 2 && best == 0; pass++) {
+    for (int i = -1; i < p->vm->wmap.total_mmaps; i++) {
+      uint a = WMAP_BASE;
+      if (i >= 0) {
+        a = PGROUNDUP(p->vm->wmap.addr[i] + p->vm->wmap.length[i]) + PGSIZE;
+      }
+      if (pass == 0) {
+        a = (a + PDSIZE - 1) & ~(PDSIZE - 1);
+      }
+      if (((best == 0) || (a < best)) && !wmapcollides(p, a, len + PGSIZE, -1)) {
+        best = a;
+      }
+    }
   }
-  int length; 
-  if (argint(1, &length) != 0) {
-    return FAILED;
+  return best;
+}
+
+// Count the resident pages of p in [start, end).
+static int
+wmapresident(struct proc *p, uint start, uint end)
+{
+  int n = 0;
+  for (uint va = start; va < end; va += PGSIZE) {
+    pte_t *pte = walkpgdir(p->pgdir, (void*)va, 0);
+    if (pte && (*pte & PTE_P)) {
+      n++;
+    }
   }
-  int flags;
-  if (argint(2, &flags) != 0) {
-    return FAILED;
+  return n;
+}
+
+// Remove slot i from p's region table, shifting the rest down.
+static void
+wmapremoveslot(struct proc *p, int finder)
+{
+  for (int i = finder; i < p->vm->wmap.total_mmaps - 1; i++)
+  {
+    p->vm->wmap.addr[i] = p->vm->wmap.addr[i + 1];
+    p->vm->wmap.length[i] = p->vm->wmap.length[i + 1];
+    p->vm->wmap.n_loaded_pages[i] = p->vm->wmap.n_loaded_pages[i + 1];
+    p->vm->wmap.anon[i] = p->vm->wmap.anon[i + 1];
+    // File backed mapping related elements -BW
+    p->vm->wmap.fptr[i] = p->vm->wmap.fptr[i + 1];
+    p->vm->wmap.shared[i] = p->vm->wmap.shared[i + 1];
+    p->vm->wmap.offset[i] = p->vm->wmap.offset[i + 1];
+    p->vm->wmap.mapid[i] = p->vm->wmap.mapid[i + 1];
   }
-  int fd;
-  if (argint(3, &fd) != 0) {
-    return FAILED;
+  p->vm->wmap.total_mmaps--;
+}
+
+// Can region j be joined onto the end of region i? Only pieces of one
+// mapping are joined, as a wremap that grows or moves a piece left over
+// by a partial unmap can bring them back together: separate wmap calls
+// stay separate regions, so that each can be unmapped and remapped by
+// its own address. Region i must end on a page boundary right where j
+// begins and, for files, at the offset j starts from.
+static int
+wmapcanmerge(struct proc *p, int i, int j)
+{
+  if (p->vm->wmap.mapid[i] != p->vm->wmap.mapid[j]) {
+    return 0;
+  }
+  if ((p->vm->wmap.length[i] % PGSIZE) ||
+      (p->vm->wmap.addr[i] + p->vm->wmap.length[i] != p->vm->wmap.addr[j])) {
+    return 0;
+  }
+  if (p->vm->wmap.anon[i]) {
+    return 1;
+  }
+  return p->vm->wmap.offset[i] + p->vm->wmap.length[i] == p->vm->wmap.offset[j];
+}
+
+// Drop p's reference to the file of a wmap region. The last close of
+// a file can write its inode, which must not happen under the vmspace
+// lock, so the file is only closed by wmapunlock.
+static void
+wmapdrop(struct proc *p, struct file *f)
+{
+  if (p->vm->ndead == MAX_WMMAP_INFO) {
+    panic("wmapdrop");
+  }
+  p->vm->dead[p->vm->ndead++] = f;
+}
+
+// Release the vmspace lock and close the files dropped under it.
+static void
+wmapunlock(struct proc *p)
+{
+  struct file *dead[MAX_WMMAP_INFO];
+  int n = p->vm->ndead;
+
+  memmove(dead, p->vm->dead, n * sizeof(dead[0]));
+  p->vm->ndead = 0;
+  releasesleep(&p->vm->lock);
+  while (n > 0) {
+    fileclose(dead[--n]);
+  }
+}
+
+// Write back the shared file pages of p in [start, end), one region at
+// a time in address order. Must be called without the vmspace lock,
+// which is only held to pick the next region.
+static void
+wmapflush(struct proc *p, uint start, uint end)
+{
+  struct file *f;
+  uint s = 0, e = 0, off = 0;
+
+  for (;;) {
+    f = 0;
+    acquiresleep(&p->vm->lock);
+    for (int i = 0; i < p->vm->wmap.total_mmaps; i++) {
+      uint rs = p->vm->wmap.addr[i];
+      uint re = PGROUNDUP(rs + p->vm->wmap.length[i]);
+      uint rstart = rs > start ? rs : start;
+      if (p->vm->wmap.anon[i] || !p->vm->wmap.shared[i] ||
+          (rstart >= re) || (rstart >= end) || (f && (rstart >= s))) {
+        continue;
+      }
+      f = p->vm->wmap.fptr[i];
+      s = rstart;
+      e = re < end ? re : end;
+      off = p->vm->wmap.offset[i] + (s - rs);
+    }
+    if (f) {
+      filedup(f);
+    }
+    releasesleep(&p->vm->lock);
+    if (f == 0) {
+      return;
+    }
+    wmapwriteback(p, f, s, e, off);
+    fileclose(f);
+    start = e;
+  }
+}
+
+// Clear the dirty bits of the resident MAP_SHARED file pages of p in
+// [start, end), flushing the TLBs if any were set so that the next
+// write to such a page sets its bit again. Returns 1 if any page has
+// been written since it was last written back. Caller holds the lock.
+static int
+wmapclean(struct proc *p, uint start, uint end)
+{
+  int dirty = 0;
+
+  for (int i = 0; i < p->vm->wmap.total_mmaps; i++) {
+    uint rs = p->vm->wmap.addr[i];
+    uint re = PGROUNDUP(rs + p->vm->wmap.length[i]);
+    if (p->vm->wmap.anon[i] || !p->vm->wmap.shared[i]) {
+      continue;
+    }
+    for (uint va = rs > start ? rs : start; va < re && va < end; va += PGSIZE) {
+      pte_t *pte = walkpgdir(p->pgdir, (void*)va, 0);
+      if (pte && (*pte & PTE_P) && (*pte & PTE_D)) {
+        *pte &= ~PTE_D;
+        dirty = 1;
+      }
+    }
+  }
+  if (dirty) {
+    flushuvm(p);
+  }
+  return dirty;
+}
+
+// Bring the file behind the shared pages of p in [start, end) up to
+// date before they are unmapped. Called and returns with the vmspace
+// lock held, but drops it while writing, and repeats as long as other
+// threads wrote to the range meanwhile. Returns 1 if the lock was
+// dropped, so that the caller looks its regions up again. The tries
+// are bounded: a thread that keeps writing to pages being unmapped
+// only loses what it writes during the last one.
+static int
+wmapsync(struct proc *p, uint start, uint end)
+{
+  int tries;
+
+  for (tries = 0; tries < WMAPSYNCTRIES && wmapclean(p, start, end); tries++) {
+    releasesleep(&p->vm->lock);
+    wmapflush(p, start, end);
+    acquiresleep(&p->vm->lock);
+  }
+  return tries > 0;
+}
+
+// Return the index of p's region starting at addr, or -1.
+static int
+wmapat(struct proc *p, uint addr)
+{
+  for (int i = 0; i < p->vm->wmap.total_mmaps; i++) {
+    if (p->vm->wmap.addr[i] == addr) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Record a new region as a mapping of its own. Takes a reference on f.
+static void
+wmapinsert(struct proc *p, uint addr, int length, int anon, int shared,
+           struct file *f, int offset, int loaded)
+{
+  // Set this map info
+  int thisMap = p->vm->wmap.total_mmaps;
+  p->vm->wmap.addr[thisMap] = addr;
+  p->vm->wmap.length[thisMap] = length;
+  p->vm->wmap.n_loaded_pages[thisMap] = loaded;
+  p->vm->wmap.total_mmaps++;
+  p->vm->wmap.anon[thisMap] = anon;
+
+  // Implementing File-Backed Mapping- BW
+  if (f) {
+    filedup(f); // Keep fd alive
   }
+  p->vm->wmap.fptr[thisMap] = f;
+  p->vm->wmap.shared[thisMap] = shared;
+  p->vm->wmap.offset[thisMap] = offset;
+  p->vm->wmap.mapid[thisMap] = p->vm->nextmapid++;
+}
+
+// Join region i with the pieces of the same mapping right before or
+// after it, if any, so that splits do not use up the table for good.
+static void
+wmapcoalesce(struct proc *p, int i)
+{
+  for (int j = 0; j < p->vm->wmap.total_mmaps; j++) {
+    if (j == i) {
+      continue;
+    }
+    int keep = i, gone = j;
+    if (wmapcanmerge(p, j, i)) {
+      keep = j;
+      gone = i;
+    } else if (!wmapcanmerge(p, i, j)) {
+      continue;
+    }
+    p->vm->wmap.length[keep] += p->vm->wmap.length[gone];
+    p->vm->wmap.n_loaded_pages[keep] += p->vm->wmap.n_loaded_pages[gone];
+    if (p->vm->wmap.fptr[gone]) {
+      wmapdrop(p, p->vm->wmap.fptr[gone]);
+    }
+    wmapremoveslot(p, gone);
+    // The joined region may meet another piece; start over
+    i = keep > gone ? keep - 1 : keep;
+    j = -1;
+  }
+}
+
+// Unmap the page-aligned range [start, end) from whatever regions it
+// touches. Regions wholly inside are removed, regions overlapping one
+// end are trimmed, and a region with the range strictly inside it is
+// split in two. Shared file pages must have been written back with
+// wmapsync first. Caller holds the vmspace lock.
+static int
+wmapunmap(struct proc *p, uint start, uint end)
+{
+  // A split needs a free slot; check before changing anything
+  for (int i = 0; i < p->vm->wmap.total_mmaps; i++) {
+    uint rs = p->vm->wmap.addr[i];
+    uint re = rs + p->vm->wmap.length[i];
+    if ((rs < start) && (end < re) &&
+        (p->vm->wmap.total_mmaps >= (MAX_WMMAP_INFO - 1))) {
+      return FAILED;
+    }
+  }
+
+  for (int i = 0; i < p->vm->wmap.total_mmaps; ) {
+    uint rs = p->vm->wmap.addr[i];
+    uint re = rs + p->vm->wmap.length[i];
+    uint s = rs > start ? rs : start;
+    uint e = PGROUNDUP(re) < end ? PGROUNDUP(re) : end;
+    if (s >= e) {
+      i++;
+      continue;
+    }
+
+    p->vm->wmap.n_loaded_pages[i] -= wmapresident(p, s, e);
+    // Unmapping drops any wmlock pins on the range
+    p->vm->npinned -= unpinuvm(p->pgdir, s, e);
+    unmapuvm(p->pgdir, s, e);
+
+    if ((s == rs) && (e >= re)) {
+      // Whole region
+      if (p->vm->wmap.fptr[i]) {
+        wmapdrop(p, p->vm->wmap.fptr[i]);
+      }
+      wmapremoveslot(p, i);
+      continue;
+    }
+    if (s == rs) {
+      // Head
+      p->vm->wmap.addr[i] = e;
+      p->vm->wmap.length[i] = re - e;
+      if (!p->vm->wmap.anon[i]) {
+        p->vm->wmap.offset[i] += e - rs;
+      }
+    } else if (e >= re) {
+      // Tail
+      p->vm->wmap.length[i] = s - rs;
+    } else {
+      // Middle: the part past the hole moves to a new slot
+      int j = p->vm->wmap.total_mmaps++;
+      p->vm->wmap.addr[j] = e;
+      p->vm->wmap.length[j] = re - e;
+      p->vm->wmap.n_loaded_pages[j] = wmapresident(p, e, PGROUNDUP(re));
+      p->vm->wmap.anon[j] = p->vm->wmap.anon[i];
+      p->vm->wmap.fptr[j] = p->vm->wmap.fptr[i];
+      if (p->vm->wmap.fptr[j]) {
+        filedup(p->vm->wmap.fptr[j]);
+      }
+      p->vm->wmap.shared[j] = p->vm->wmap.shared[i];
+      p->vm->wmap.offset[j] = p->vm->wmap.anon[i] ? 0 : p->vm->wmap.offset[i] + (e - rs);
+      p->vm->wmap.mapid[j] = p->vm->wmap.mapid[i];
+      p->vm->wmap.n_loaded_pages[i] -= p->vm->wmap.n_loaded_pages[j];
+      p->vm->wmap.length[i] = s - rs;
+    }
+    i++;
+  }
+  // Only free the frames once no TLB can reach them
+  flushuvm(p);
+  reapuvm(p->pgdir, start, end);
+  return SUCCESS;
+}
 
-  cprintf("wmap debug: addr=%x, len=%d, flags=%d, fd=%d\n", 
-    addr, length, flags, fd);
+// Shared body of wmap and wmapoff. offset is where in the file a
+// file-backed mapping starts and must be page aligned.
+static int
+dowmap(int addr, int length, int flags, int fd, int offset) {
 
-	// Vaildate length
+	// Vaildate length and offset
 	if (length <= 0) {
 		return FAILED;
 	}
+	if ((offset < 0) || (offset % PGSIZE)) {
+		return FAILED;
+	}
 
 	// Parse flags
-	if ((flags >= 16) | (flags < 0)) {
+	if (flags & ~(MAP_PRIVATE | MAP_SHARED | MAP_ANONYMOUS | MAP_FIXED | MAP_POPULATE)) {
 		return FAILED;
 	}
-  
-	int mapFixed = 0;
-	if (flags >= 8) {
-		mapFixed = 1;
-		flags -= 8;
-	}
-	int mapAnonymous = 0;
-	if (flags >= 4) {
-		mapAnonymous = 1;
-		flags -= 4;
-	}
-	int mapShared = 0;
-	if (flags >= 2) {
-		mapShared = 1;
-		flags -= 2;
-	}
+	int mapFixed = (flags & MAP_FIXED) != 0;
+	int mapAnonymous = (flags & MAP_ANONYMOUS) != 0;
+	int mapShared = (flags & MAP_SHARED) != 0;
+	int mapPopulate = (flags & MAP_POPULATE) != 0;
   // Private is true if shared isn't
-	if (flags >= 1) {
-		if (mapShared) {
-			return FAILED;
-		}
+	if ((flags & MAP_PRIVATE) && mapShared) {
+		return FAILED;
 	}
 
 	// Get own process pointer
 	struct proc* myProc = myproc();
 
-  int thisMap = myProc->wmap.total_mmaps;
-  if (thisMap >= (MAX_WMMAP_INFO - 1)) {
+  if (myProc->vm->wmap.total_mmaps >= (MAX_WMMAP_INFO - 1)) {
     // Too many maps
     return FAILED;
   }
 
   if (mapFixed) {
-
-    // Check addr within range
-    if ((addr < 0x60000000) || (addr > 0x80000000)) {
+    // Check addr is usable - can't move
+    if ((addr % PGSIZE) || wmapcollides(myProc, addr, length, -1)) {
       return FAILED;
     }
-
-    // Check for collisions - can't move
-    for (int i = 0; i < myproc()->wmap.total_mmaps; i++) {
-      int otherStart = myproc()->wmap.addr[i];
-      int otherEnd = otherStart + myproc()->wmap.length[i];
-      // Check if any other mapping starts or ends within the span of this mapping
-      if (((otherStart <= (addr + length - 1)) && (otherStart >= addr)) ||
-          ((otherEnd <= (addr + length - 1)) && (otherEnd >= addr))) {
-        cprintf("wmap debug: Failed due to insufficient space for fixed addr\n");
-        return FAILED;
-      }
-    }
-
   } else {
-
     // Completely ignore address suggestion
-    // Nothing's sorted, so we'll just decide space 
-    // is full when we hit the end while incrementing and
-    // failing to find a space with no collisions
-    addr = 0x60000000;
-
-    // Check for collisions
-    if (myProc->wmap.total_mmaps > 0) {
-      int recheck;
-      do {
-        recheck = 0;
-        for (int i = 0; i < myproc()->wmap.total_mmaps; i++) {
+    if ((addr = wmapfindfree(myProc, length, 0)) == 0) {
+      return FAILED;
+    }
+  }
 
-          int otherStart = myproc()->wmap.addr[i];
-          int otherEnd = otherStart + myproc()->wmap.length[i];
+  struct file *f = 0;
+  if (!mapAnonymous) {
+    if ((fd < 0) || (fd >= NOFILE) || ((f = myProc->fdt->ofile[fd]) == 0)) {
+      return FAILED;
+    }
+    // Only an inode can back a mapping, and it is read into the pages
+    if ((f->type != FD_INODE) || !f->readable) {
+      return FAILED;
+    }
+    // Shared pages are written back to the file
+    if (mapShared && !f->writable) {
+      return FAILED;
+    }
+  } else {
+    offset = 0;
+  }
 
-          // Check if any other mapping starts or ends within the span of this mapping
-          if (((otherStart <= (addr + length - 1)) && (otherStart >= addr - 1)) ||
-              ((otherEnd <= (addr + length - 1)) && (otherEnd >= addr - 1))) {
+  // MAP_POPULATE: allocate and map the whole region now instead of
+  // taking one fault per page later. A file's pages are read in by
+  // wmaplocked once the lock is dropped.
+  int populated = mapPopulate && mapAnonymous;
+  if (populated) {
+    if (populateuvm(myProc->pgdir, addr, length, PTE_W | PTE_U) < 0) {
+      return FAILED;
+    }
+  }
 
-            addr += PAGE_SIZE;
-            if ((addr + length) >= 0x80000000) {
-              cprintf("wmap debug: Failed due to insufficient space for non-fixed addr\n");
-              return FAILED;
-            } else {
-              recheck = 1;
-              break;
-            }
+  // Otherwise don't alloc yet (lazy)
+  wmapinsert(myProc, addr, length, mapAnonymous, mapShared, f, offset,
+    populated ? PGROUNDUP(length) / PGSIZE : 0);
 
-          }
-        }
-      } while (recheck);
+  return addr;
+};
 
+// The threads of a process share one wmap table, so its
+// users take turns through the vmspace lock.
+static int
+wmaplocked(int addr, int length, int flags, int fd, int offset) {
+  struct proc *p = myproc();
+  int i, id = 0;
+
+  acquiresleep(&p->vm->lock);
+  int ret = dowmap(addr, length, flags, fd, offset);
+  if (ret != FAILED) {
+    id = p->vm->wmap.mapid[wmapat(p, ret)];
+  }
+  wmapunlock(p);
+
+  // Reading a populated file mapping may sleep on the inode and the
+  // disk, so it is done without the lock. If it fails, the mapping is
+  // taken down again, unless another thread already replaced it.
+  if ((ret != FAILED) && (flags & MAP_POPULATE) && !(flags & MAP_ANONYMOUS) &&
+      (wmappopulate(p, ret, PGROUNDUP((uint)ret + length)) < 0)) {
+    acquiresleep(&p->vm->lock);
+    i = wmapat(p, ret);
+    if ((i != -1) && (p->vm->wmap.mapid[i] == id) &&
+        wmapsync(p, ret, PGROUNDUP((uint)ret + p->vm->wmap.length[i]))) {
+      i = wmapat(p, ret);
+    }
+    if ((i != -1) && (p->vm->wmap.mapid[i] == id)) {
+      wmapunmap(p, ret, PGROUNDUP((uint)ret + p->vm->wmap.length[i]));
     }
+    wmapunlock(p);
+    return FAILED;
   }
+  return ret;
+}
 
-  // Set this map info, but don't alloc yet (lazy)
-  myProc->wmap.addr[thisMap] = addr;
-  myProc->wmap.length[thisMap] = length;
-  myProc->wmap.n_loaded_pages[thisMap] = 0;
-  myProc->wmap.total_mmaps++;
-  myProc->wmap.anon[thisMap] = mapAnonymous;
+int
+sys_wmap(void) {
+  int addr, length, flags, fd;
 
-  // Implementing File-Backed Mapping- BW
-  if (!mapAnonymous) {
-    filedup(myProc->ofile[fd]); // Keep fd alive
+  if ((argint(0, &addr) < 0) || (argint(1, &length) < 0) ||
+      (argint(2, &flags) < 0) || (argint(3, &fd) < 0)) {
+    return FAILED;
   }
-  myProc->wmap.fptr[thisMap] = mapAnonymous ? 0 : myProc->ofile[fd];
-  myProc->wmap.shared[thisMap] = mapShared;
+  return wmaplocked(addr, length, flags, fd, 0);
+}
 
-  return addr;
-};
+int
+sys_wmapoff(void) {
+  int addr, length, flags, fd, offset;
+
+  if ((argint(0, &addr) < 0) || (argint(1, &length) < 0) ||
+      (argint(2, &flags) < 0) || (argint(3, &fd) < 0) ||
+      (argint(4, &offset) < 0)) {
+    return FAILED;
+  }
+  return wmaplocked(addr, length, flags, fd, offset);
+}
 
 int
 sys_wunmap(void) {
@@ -309,56 +820,94 @@ sys_wunmap(void) {
   }
 
   struct proc *currproc = myproc();
-  int finder = -1;
+  int ret = FAILED;
 
   //Try to find the mapping by the address
-  for (int i = 0; i < currproc->wmap.total_mmaps; i++)
-  {
-    if (currproc->wmap.addr[i] == addr)
-    {
-      finder = i;
-      break;
-    }
+  acquiresleep(&currproc->vm->lock);
+  int i = wmapat(currproc, addr);
+  if ((i != -1) && wmapsync(currproc, addr,
+        PGROUNDUP(addr + currproc->vm->wmap.length[i]))) {
+    i = wmapat(currproc, addr);
   }
+  if (i != -1) {
+    ret = wmapunmap(currproc, addr,
+      PGROUNDUP(addr + currproc->vm->wmap.length[i]));
+  }
+  wmapunlock(currproc);
+  return ret;
+}
 
-  if (finder == -1)
-  {
+int
+sys_wunmaprange(void) {
+  int addr;
+  int length;
+
+  if ((argint(0, &addr) < 0) || (argint(1, &length) < 0)) {
     return FAILED;
   }
+  if ((addr % PGSIZE) || (length <= 0) ||
+      ((uint)addr < WMAP_BASE) || ((uint)addr + length > KERNBASE)) {
+    return FAILED;
+  }
+  struct proc *p = myproc();
+  acquiresleep(&p->vm->lock);
+  wmapsync(p, addr, PGROUNDUP((uint)addr + length));
+  int ret = wmapunmap(p, addr, PGROUNDUP((uint)addr + length));
+  wmapunlock(p);
+  return ret;
+}
 
-  // START File backed mapping section
-  if (!currproc->wmap.anon[finder] && currproc->wmap.shared[finder])
-  {
-    struct file *f = currproc->wmap.fptr[finder];
+static int
+dowremap(int oldaddr, int oldsize, int newsize, int flags) {
 
-    if (f)
-    {
-      filewrite(f, (char *)addr,currproc->wmap.length[finder]);
+  struct proc *p = myproc();
+
+  // Find our index
+  int foundInd = -1;
+  for (int i = 0; i < p->vm->wmap.total_mmaps; i++) {
+    if ((p->vm->wmap.addr[i] == oldaddr) && (p->vm->wmap.length[i] == oldsize)) {
+      foundInd = i;
     }
   }
-  // END File backed mapping section
-
-  // Deallocate memory region
-  uint oldsz = currproc->wmap.addr[finder] + currproc->wmap.length[finder];
-  uint newsz = currproc->wmap.addr[finder];
-  if ((deallocuvm(currproc->pgdir, oldsz, newsz) == 0))
-  {
+  if (foundInd == -1) {
     return FAILED;
   }
 
-  //Remove mapping
-  for (int i = finder; i < currproc->wmap.total_mmaps -1; i++)
-  {
-    currproc->wmap.addr[i] = currproc->wmap.addr[i + 1];
-    currproc->wmap.length[i] = currproc->wmap.length[i + 1];
-    currproc->wmap.n_loaded_pages[i] = currproc->wmap.n_loaded_pages[i + 1];
-    currproc->wmap.anon[i] = currproc->wmap.anon[i + 1];
-    // File backed mapping related elements -BW
-    currproc->wmap.fptr[i] = currproc->wmap.fptr[i + 1];
-    currproc->wmap.shared[i] = currproc->wmap.shared[i];
+  // Grow or shrink in place if we can; only move if we have to
+  uint newaddr = oldaddr;
+  if (wmapcollides(p, oldaddr, newsize, foundInd)) {
+    if (!(flags & MREMAP_MAYMOVE)) {
+      return FAILED;
+    }
+    newaddr = wmapfindfree(p, newsize, (oldaddr % PDSIZE) == 0);
+    if (newaddr == 0) {
+      return FAILED;
+    }
   }
-  currproc->wmap.total_mmaps--;
-  return SUCCESS;
+
+  uint oldend = PGROUNDUP((uint)oldaddr + oldsize);
+  uint newend = PGROUNDUP((uint)oldaddr + newsize);
+
+  if (newend < oldend) {
+    // Shrink: free the frames past the new end, which sys_wremap
+    // has synced
+    p->vm->wmap.n_loaded_pages[foundInd] -= wmapresident(p, newend, oldend);
+    p->vm->npinned -= unpinuvm(p->pgdir, newend, oldend);
+    unmapuvm(p->pgdir, newend, oldend);
+  } else if (newaddr != oldaddr) {
+    // Move: hand the resident pages over to the new range as they
+    // are, so nothing has to be refaulted or copied
+    if (moveuvm(p->pgdir, oldaddr, newaddr, oldsize) < 0) {
+      return FAILED;
+    }
+  }
+  flushuvm(p);
+  reapuvm(p->pgdir, newend, oldend);
+
+  p->vm->wmap.addr[foundInd] = newaddr;
+  p->vm->wmap.length[foundInd] = newsize;
+  wmapcoalesce(p, foundInd);
+  return newaddr;
 }
 
 int
@@ -382,119 +931,107 @@ sys_wremap(void) {
     return FAILED;
   }
 
-  cprintf("wremap debug: oldaddr=%x, oldsize=%d, newsize=%d, flags=%d\n",
-    oldaddr, oldsize, newsize, flags);
+  if ((newsize <= 0) || (flags & ~MREMAP_MAYMOVE)) {
+    return FAILED;
+  }
 
-  // Find our index
-  int foundInd = -1;
-  for (int i = 0; i < myproc()->wmap.total_mmaps; i++) {
-    if (myproc()->wmap.addr[i] == oldaddr) {
-      foundInd = i;
+  // Write back the tail a shrink drops; dowremap then looks the
+  // region up under the same hold of the lock that shrinks it.
+  struct proc *p = myproc();
+  acquiresleep(&p->vm->lock);
+  if (newsize < oldsize) {
+    wmapsync(p, PGROUNDUP((uint)oldaddr + newsize),
+      PGROUNDUP((uint)oldaddr + oldsize));
+  }
+  int ret = dowremap(oldaddr, oldsize, newsize, flags);
+  wmapunlock(p);
+  return ret;
+}
+
+// Pin [addr, end) of p under the vmspace lock. Returns 1, pinning
+// nothing, if some page still has to be faulted in.
+static int
+dowmlock(struct proc *p, uint addr, uint end) {
+
+  // Every page must belong to a wmap region, and the pages not yet
+  // pinned must fit under the per-process limit.
+  int need = 0, missing = 0;
+  for (uint va = addr; va < end; va += PGSIZE) {
+    if (wmapfind(p, va) == -1) {
+      return FAILED;
+    }
+    pte_t *pte = walkpgdir(p->pgdir, (void*)va, 0);
+    if (!pte || !(*pte & PTE_PIN)) {
+      need++;
+    }
+    if (!pte || !(*pte & PTE_P)) {
+      missing++;
     }
   }
-  if (foundInd == -1) {
-    cprintf("wremap debug: Failed due to addr not found\n");
+  if (p->vm->npinned + need > MAXPINNED) {
     return FAILED;
   }
+  // Everything must be resident so a failure leaves nothing half pinned
+  if (missing) {
+    return 1;
+  }
 
-  if (flags == 0) {
-    // Check for collisions - can't move
-    for (int i = 0; i < myproc()->wmap.total_mmaps; i++) {
-      // Don't test collision with self - will always fail
-      if (i != foundInd) {
-        int otherStart = myproc()->wmap.addr[i];
-        int otherEnd = otherStart + myproc()->wmap.length[i];
-        // Check if any other mapping starts or ends within the span of this mapping
-        if (((otherStart <= (oldaddr + newsize - 1)) && (otherStart >= oldaddr)) ||
-            ((otherEnd <= (oldaddr + newsize - 1)) && (otherEnd >= oldaddr))) {
-          cprintf("wremap debug: Failed due to no space\n");
-          return FAILED;
-        }
-      }
+  for (uint va = addr; va < end; va += PGSIZE) {
+    pte_t *pte = walkpgdir(p->pgdir, (void*)va, 0);
+    if (!(*pte & PTE_PIN)) {
+      kpin(P2V(PTE_ADDR(*pte)));
+      *pte |= PTE_PIN;
+      p->vm->npinned++;
     }
+  }
+  return SUCCESS;
+}
 
-    // We're ok to expand
-    myproc()->wmap.length[foundInd] = newsize;
-    
-  } else if (flags == MREMAP_MAYMOVE) {
-
-    // Can we stay in place?
-    int canStay = 1;
-    for (int i = 0; i < myproc()->wmap.total_mmaps; i++) {
-      // Don't test collision with self - will always fail
-      if (i != foundInd) {
-        int otherStart = myproc()->wmap.addr[i];
-        int otherEnd = otherStart + myproc()->wmap.length[i];
-        // Check if any other mapping starts or ends within the span of this mapping
-        if (((otherStart <= (oldaddr + newsize - 1)) && (otherStart >= oldaddr)) ||
-            ((otherEnd <= (oldaddr + newsize - 1)) && (otherEnd >= oldaddr))) {
-          canStay = 0;
-          break;
-        }
+int
+sys_wmlock(void) {
+  int addr;
+  int length;
+  if ((argint(0, &addr) < 0) || (argint(1, &length) < 0)) {
+    return FAILED;
+  }
+  if ((addr % PGSIZE) || (length <= 0)) {
+    return FAILED;
+  }
+
+  struct proc *p = myproc();
+  uint end = PGROUNDUP((uint)addr + length);
+
+  // The faults read files and so cannot run under the lock; retry
+  // should another thread unmap a page before it is pinned.
+  for (;;) {
+    acquiresleep(&p->vm->lock);
+    int ret = dowmlock(p, addr, end);
+    releasesleep(&p->vm->lock);
+    if (ret != 1) {
+      return ret;
+    }
+    for (uint va = addr; va < end; va += PGSIZE) {
+      if (wmapfault(p, va) < 0) {
+        return FAILED;
       }
     }
+  }
+}
 
-    if (canStay) {
-
-      // Resize in place
-      myproc()->wmap.length[foundInd] = newsize;
-
-    } else {
-
-      // Start back at the top, so we know space is full 
-      // if we search past the end
-      oldaddr = 0x6000000;
-
-      int recheck;
-      do {
-        recheck = 0;
-
-        // Check for collisions, move if needed
-        for (int i = 0; i < myproc()->wmap.total_mmaps; i++) {
-          // Again, don't check for collision w/ self
-          if (i != foundInd) {
-
-            int otherStart = myproc()->wmap.addr[i];
-            int otherEnd = otherStart + myproc()->wmap.length[i];
-
-            // Check if any other mapping starts or ends within the span of this mapping
-            if (((otherStart <= (oldaddr + newsize)) && (otherStart >= oldaddr)) ||
-                ((otherEnd <= (oldaddr + newsize)) && (otherEnd >= oldaddr))) {
-
-              oldaddr += PAGE_SIZE;
-              if ((oldaddr + newsize) >= 0x80000000) {
-                cprintf("wremap debug: Failed due to no space\n");
-                return FAILED;
-              } else {
-                recheck = 1;
-                break;
-              } 
-            }
-          }
-        }
-      } while (recheck);
-      
-      myproc()->wmap.length[foundInd] = newsize;
-      myproc()->wmap.addr[foundInd] = oldaddr;
-
-    }
-    
-  } else {
-    cprintf("wremap debug: Failed due to bad flags\n");
+int
+sys_wmunlock(void) {
+  int addr;
+  int length;
+  if ((argint(0, &addr) < 0) || (argint(1, &length) < 0)) {
     return FAILED;
   }
-  
-  // De-alloc any yielded space
-  if (oldsize > newsize) {
-    for (int i = 0; i < ((oldsize - newsize) / PGSIZE); i++) {
-      int addr = oldaddr + newsize + (PGSIZE * i);
-      cprintf("rm %x\n", addr);
-      pde_t* pg = walkpgdir(myproc()->pgdir, 
-        (void*)addr, 0);
-      *pg = 0;
-    }
+  if ((addr % PGSIZE) || (length <= 0)) {
+    return FAILED;
   }
 
-  cprintf("wremap debug: Success, addr %x\n", oldaddr);
-  return oldaddr;
-}
\ No newline at end of file
+  struct proc *p = myproc();
+  acquiresleep(&p->vm->lock);
+  p->vm->npinned -= unpinuvm(p->pgdir, addr, PGROUNDUP((uint)addr + length));
+  releasesleep(&p->vm->lock);
+  return SUCCESS;
+}
@@ -17,6 +17,13 @@ struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
 struct spinlock tickslock;
 uint ticks;
+uint nextwake;  // Earliest tick a sys_sleep caller waits for, or 0
+
+// Timer wheel: a sys_sleep caller sleeps on the slot for its
+// deadline, so each tick wakes only the callers due then (and
+// those a whole number of turns later, who go back to sleep).
+#define NTICKWHEEL 64
+static char tickwheel[NTICKWHEEL];
 
 void
 tvinit(void)
@@ -36,10 +43,264 @@ idtinit(void)
   lidt(idt, sizeof(idt));
 }
 
+// Wait channel for a sys_sleep caller due to wake at deadline.
+void*
+tickchan(uint deadline)
+{
+  return &tickwheel[deadline % NTICKWHEEL];
+}
+
+// Record that a sys_sleep caller needs the clock to reach deadline.
+// Idle CPU 0 keeps the clock with a one-shot timer, so kick it to
+// re-arm if the deadline is earlier than the one it is waiting for.
+// Caller must hold tickslock.
+void
+tickwait(uint deadline)
+{
+  if(nextwake != 0 && (int)(deadline - nextwake) >= 0)
+    return;
+  nextwake = deadline;
+  __sync_synchronize();
+  if(cpus[0].idle)
+    lapicwake(cpus[0].apicid);
+}
+
+// Return the index of the wmap region of p containing va, or -1.
+int
+wmapfind(struct proc *p, uint va)
+{
+  struct wmapinfo *wm = &p->vm->wmap;
+
+  for (int i = 0; i < wm->total_mmaps; i++) {
+    uint start = wm->addr[i];
+    uint end = wm->addr[i] + wm->length[i];
+    if ((start <= va) && (va < end)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Return the file backing page va of p's wmap region i, or 0 for an
+// anonymous region, and set *off to the page's offset in the file.
+static struct file*
+wmapbacking(struct proc *p, int i, uint va, uint *off)
+{
+  *off = 0;
+  if (p->vm->wmap.anon[i] || p->vm->wmap.fptr[i]->ip == 0) {
+    return 0;
+  }
+  *off = p->vm->wmap.offset[i] + (va - p->vm->wmap.addr[i]);
+  return p->vm->wmap.fptr[i];
+}
+
+// Is page va of p mapped?
+static int
+wmapmapped(struct proc *p, uint va)
+{
+  pte_t *pte = walkpgdir(p->pgdir, (void*)va, 0);
+  return pte && (*pte & PTE_P);
+}
+
+// Lazily allocate the page containing va for one of p's wmap regions,
+// reading it in from the backing file if there is one. A page that is
+// already resident is left alone. Returns 0 on success, -1 if va is
+// not in any region or memory is exhausted.
+// Takes the vmspace lock itself, and drops it while the page is read:
+// the read may sleep on an inode held by a sibling thread that is
+// waiting for the lock. The region is looked up again afterwards, and
+// the fault retried if another thread changed it meanwhile.
+int
+wmapfault(struct proc *p, uint va)
+{
+  struct file *f, *g;
+  uint off, goff;
+  char *mem;
+  int i, r;
+
+  va = PGROUNDDOWN(va);
+  for (;;) {
+    acquiresleep(&p->vm->lock);
+    if ((i = wmapfind(p, va)) == -1) {
+      releasesleep(&p->vm->lock);
+      return -1;
+    }
+    if (wmapmapped(p, va)) {
+      releasesleep(&p->vm->lock);
+      return 0;
+    }
+    if ((f = wmapbacking(p, i, va, &off)) != 0) {
+      filedup(f);
+    }
+    releasesleep(&p->vm->lock);
+
+    // Alloc
+    if ((mem = kalloc()) == 0) {
+      if (f) {
+        fileclose(f);
+      }
+      return -1;
+    }
+    memset(mem, 0, PGSIZE);
+    if (f) {
+      ilock(f->ip);
+      readi(f->ip, mem, off, PGSIZE);
+      iunlock(f->ip);
+    }
+
+    acquiresleep(&p->vm->lock);
+    r = 1;
+    if ((i = wmapfind(p, va)) == -1) {
+      r = -1;
+    } else if (wmapmapped(p, va)) {
+      // Another thread faulted it in first
+      r = 0;
+    } else if (((g = wmapbacking(p, i, va, &goff)) == f) && (goff == off)) {
+      if (mappages(p->pgdir, (void*)va, PGSIZE, V2P(mem), PTE_W | PTE_U) < 0) {
+        r = -1;
+      } else {
+        p->vm->wmap.n_loaded_pages[i]++;
+        mem = 0;
+        r = 0;
+      }
+    }
+    releasesleep(&p->vm->lock);
+    if (mem) {
+      kfree(mem);
+    }
+    if (f) {
+      fileclose(f);
+    }
+    if (r != 1) {
+      return r;
+    }
+  }
+}
+
+// Read in and map all of [start, end), a page-aligned range inside one
+// of p's file-backed regions, for MAP_POPULATE. As in wmapfault the
+// file is read without the vmspace lock. The frames for a chunk of up
+// to 4MB are allocated and filled in one go, holding the inode lock
+// once, and then mapped in one pass after checking that the range
+// still belongs to the same mapping. Pages that other threads faulted
+// in meanwhile are kept. Returns 0, or -1 if memory ran out or the
+// mapping changed; the pages already mapped are then left in place.
+int
+wmappopulate(struct proc *p, uint start, uint end)
+{
+  struct file *f, *g;
+  char **mem;
+  uint va, off, goff;
+  int i, id, n, got, mapped, r;
+
+  acquiresleep(&p->vm->lock);
+  if (((i = wmapfind(p, start)) == -1) ||
+      ((f = wmapbacking(p, i, start, &off)) == 0)) {
+    releasesleep(&p->vm->lock);
+    return -1;
+  }
+  id = p->vm->wmap.mapid[i];
+  filedup(f);
+  releasesleep(&p->vm->lock);
+
+  // One page holds the frame pointers of a chunk
+  if ((mem = (char**)kalloc()) == 0) {
+    fileclose(f);
+    return -1;
+  }
+  r = 0;
+  for (va = start; (r == 0) && (va < end); va += n * PGSIZE, off += n * PGSIZE) {
+    n = (end - va) / PGSIZE;
+    if (n > PGSIZE / sizeof(char*)) {
+      n = PGSIZE / sizeof(char*);
+    }
+    for (got = 0; got < n; got++) {
+      if ((mem[got] = kalloc()) == 0) {
+        r = -1;
+        break;
+      }
+      memset(mem[got], 0, PGSIZE);
+    }
+
+    if (r == 0) {
+      ilock(f->ip);
+      for (i = 0; i < n; i++) {
+        readi(f->ip, mem[i], off + i * PGSIZE, PGSIZE);
+      }
+      iunlock(f->ip);
+
+      acquiresleep(&p->vm->lock);
+      r = -1;
+      if (((i = wmapfind(p, va)) != -1) && (p->vm->wmap.mapid[i] == id) &&
+          (va + n * PGSIZE <= PGROUNDUP(p->vm->wmap.addr[i] + p->vm->wmap.length[i])) &&
+          ((g = wmapbacking(p, i, va, &goff)) == f) && (goff == off)) {
+        if ((mapped = mapframes(p->pgdir, va, mem, n, PTE_W | PTE_U)) >= 0) {
+          p->vm->wmap.n_loaded_pages[i] += mapped;
+          r = 0;
+        }
+      }
+      releasesleep(&p->vm->lock);
+    }
+
+    for (i = 0; i < got; i++) {
+      if (mem[i]) {
+        kfree(mem[i]);
+      }
+    }
+  }
+  kfree((char*)mem);
+  fileclose(f);
+  return r;
+}
+
+// Write the resident pages of [start, end) of p back to f, start
+// being at file offset off. Pages that were never touched are skipped,
+// as is anything past end of file. Called without the vmspace lock,
+// which is only taken to find each page: the page is then written from
+// its frame, which an extra reference keeps alive should another
+// thread unmap it meanwhile.
+void
+wmapwriteback(struct proc *p, struct file *f, uint start, uint end, uint off)
+{
+  uint va, n, o;
+  char *mem;
+  pte_t *pte;
+
+  if (f == 0 || f->ip == 0 || !f->writable) {
+    return;
+  }
+
+  for (va = start; va < end; va += PGSIZE, off += PGSIZE) {
+    mem = 0;
+    acquiresleep(&p->vm->lock);
+    pte = walkpgdir(p->pgdir, (void*)va, 0);
+    if (pte && (*pte & PTE_P)) {
+      mem = P2V(PTE_ADDR(*pte));
+      kshare(mem);
+    }
+    releasesleep(&p->vm->lock);
+    if (mem == 0) {
+      continue;
+    }
+    n = end - va < PGSIZE ? end - va : PGSIZE;
+    if (off < f->ip->size) {
+      if (off + n > f->ip->size) {
+        n = f->ip->size - off;
+      }
+      o = off;
+      filewriteat(f, mem, n, &o);
+    }
+    kfree(mem);
+  }
+}
+
 //PAGEBREAK: 41
 void
 trap(struct trapframe *tf)
 {
+  uint now, old, t, va;
+  int boost, fault;
+
   if(tf->trapno == T_SYSCALL){
     if(myproc()->killed)
       exit();
@@ -52,11 +313,33 @@ trap(struct trapframe *tf)
 
   switch(tf->trapno){
   case T_IRQ0 + IRQ_TIMER:
-    if(cpuid() == 0){
-      acquire(&tickslock);
-      ticks++;
-      wakeup(&ticks);
-      release(&tickslock);
+    // Idle CPUs stop taking timer interrupts, so any CPU may
+    // advance the clock, and it may jump several ticks at once.
+    now = lapicticks();
+    boost = 0;
+    acquire(&tickslock);
+    if((int)(now - ticks) > 0){
+      boost = now/BOOSTTICKS != ticks/BOOSTTICKS;
+      old = ticks;
+      ticks = now;
+      if(nextwake != 0 && (int)(ticks - nextwake) >= 0)
+        nextwake = 0;
+      // Wake the wheel slots the clock has passed; a jump
+      // of a whole turn or more wakes every slot once.
+      for(t = old + 1; t != now + 1 && t - old <= NTICKWHEEL; t++)
+        wakeup(tickchan(t));
+    }
+    release(&tickslock);
+    if(boost)
+      priboost();
+    lapiceoi();
+    break;
+  case T_IRQ0 + IRQ_WAKE:
+    // Breaks an idle CPU out of hlt, and is also how flushuvm
+    // asks a CPU running a sibling thread to flush its TLB.
+    if(mycpu()->tlbflush){
+      lcr3(rcr3());
+      mycpu()->tlbflush = 0;
     }
     lapiceoi();
     break;
@@ -84,46 +367,21 @@ trap(struct trapframe *tf)
     
   // Added for P4
   case T_PGFLT:
-
-    uint faultAddr = rcr2();
-    struct wmapinfo *proc_wmap = &(myproc()->wmap);
-
-    int mapIndx = -1;
-    for (int i = 0; i < proc_wmap->total_mmaps; i++) {
-      uint start = proc_wmap->addr[i];
-      uint end = proc_wmap->addr[i] + proc_wmap->length[i];
-      if ((start <= faultAddr) && (end >= faultAddr)) {
-        mapIndx = i;
-      }
+    va = rcr2();
+    fault = wmapfault(myproc(), va);
+    if (fault < 0) {
+      cprintf("seg fault during access to %x\n", va);
+      exit();
     }
-
-    // Is mapped?
-    if (mapIndx != -1) {
-
-      // Alloc
-      int thispgaddr = PGROUNDDOWN(faultAddr);
-      char *mem = kalloc();
-      if (mem == 0){
-        break;
-      }
-      memset(mem, 0, PGSIZE);
-     if (!myproc()->wmap.anon[mapIndx]) {
-      struct file* fptr = myproc()->wmap.fptr[mapIndx];
-      int fileOffset = thispgaddr - proc_wmap->addr[mapIndx];
-      ilock(fptr->ip);
-      readi(fptr->ip, mem, fileOffset, PGSIZE);
-      iunlock(fptr->ip);
-    }
-    mappages(myproc()->pgdir, (void*)thispgaddr, PGSIZE, V2P(mem), PTE_W | PTE_U);
-    myproc()->wmap.n_loaded_pages[mapIndx]++;
-  } else {
-    cprintf("seg fault during access to %x\n", faultAddr);
-    exit();
-  }
-  break;
+    break;
 
   //PAGEBREAK: 13
   default:
+    // The virtio disk's IRQ is whatever the PCI BIOS gave it.
+    if(tf->trapno >= T_IRQ0 && virtiointr(tf->trapno - T_IRQ0)){
+      lapiceoi();
+      break;
+    }
     if(myproc() == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -144,10 +402,12 @@ trap(struct trapframe *tf)
   if(myproc() && myproc()->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Charge the process for the clock tick, and force it to give
+  // up the CPU once its MLFQ slice is spent or a higher-priority
+  // process is waiting.
   // If interrupts were on while locks held, would need to check nlock.
   if(myproc() && myproc()->state == RUNNING &&
-     tf->trapno == T_IRQ0+IRQ_TIMER)
+     tf->trapno == T_IRQ0+IRQ_TIMER && schedtick(myproc()))
     yield();
 
   // Check if the process has been killed since we yielded
@@ -104,3 +104,91 @@ memmove(void *vdst, const void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+  lk->locked = 0;
+}
+
+void
+lock_acquire(lock_t *lk)
+{
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+}
+
+void
+lock_release(lock_t *lk)
+{
+  __sync_synchronize();
+  xchg(&lk->locked, 0);
+}
+
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+  m->state = 0;
+}
+
+void
+mutex_lock(mutex_t *m)
+{
+  if(xchg(&m->state, 1) == 0)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+    futex(&m->state, FUTEX_WAIT, 2);
+}
+
+void
+mutex_unlock(mutex_t *m)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+
+// Condition variable on futex.  A waiter sleeps only while seq is
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+  c->seq = 0;
+}
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+  uint seq;
+
+  seq = c->seq;
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+    futex(&m->state, FUTEX_WAIT, 2);
+}
+
+void
+cond_signal(cond_t *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futex(&c->seq, FUTEX_WAKE, 1);
+}
+
+void
+cond_broadcast(cond_t *c)
+{
+  __sync_fetch_and_add(&c->seq, 1);
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+}
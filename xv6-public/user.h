@@ -1,7 +1,23 @@
 #include "wmap.h"
+#include "sched.h"
+#include "futex.h"
+#include "bcache.h"
+#include "iosched.h"
 struct stat;
 struct rtcdate;
 
+typedef struct {
+  uint locked;       // Is the lock held?
+} lock_t;
+
+typedef struct {
+  uint state;        // 0 free, 1 held, 2 held with waiters
+} mutex_t;
+
+typedef struct {
+  uint seq;          // Bumped by every signal and broadcast
+} cond_t;
+
 // system calls
 int fork(void);
 int exit(void) __attribute__((noreturn));
@@ -24,6 +40,10 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int clone(void(*)(void*), void*, void*);
+int join(void**);
+int futex(uint*, int, int);
+int vfork(void);
 
 // ulib.c
 int stat(const char*, struct stat*);
@@ -38,11 +58,40 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+void lock_init(lock_t*);
+void lock_acquire(lock_t*);
+void lock_release(lock_t*);
+void mutex_init(mutex_t*);
+void mutex_lock(mutex_t*);
+void mutex_unlock(mutex_t*);
+void cond_init(cond_t*);
+void cond_wait(cond_t*, mutex_t*);
+void cond_signal(cond_t*);
+void cond_broadcast(cond_t*);
+
+// uthread.c
+int thread_create(void(*)(void*), void*);
+int thread_join(void);
 
 
 //Custom syscalls
 int getpgdirinfo(struct pgdirinfo*);
 int getwmapinfo(struct wmapinfo*);
 uint wmap(uint addr, int length, int flags, int fd);
+uint wmapoff(uint addr, int length, int flags, int fd, int offset);
 uint wremap(uint oldaddr, int oldsize, int newsize, int flags);
-int wunmap(uint addr);
\ No newline at end of file
+int wunmap(uint addr);
+int wunmaprange(uint addr, int length);
+int wmlock(uint addr, int length);
+int wmunlock(uint addr, int length);
+int setpriority(int pid, int prio);
+int getschedinfo(int pid, struct schedinfo*);
+int settickets(int tickets);
+int setschedpolicy(int policy);
+int setaffinity(int pid, uint mask, int flags);
+int getaffinity(int pid);
+int bcstat(struct bcstat*);
+int dropcache(void);
+int setiosched(int policy);
+int iostat(struct iostat*);
+int fsync(int fd);
\ No newline at end of file
@@ -0,0 +1,7442 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  { 0, 0 },
+};
+
+int
+main(int argc, char *argv[])
+{
+       0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+       4:	83 e4 f0             	and    $0xfffffff0,%esp
+       7:	ff 71 fc             	push   -0x4(%ecx)
+       a:	55                   	push   %ebp
+       b:	89 e5                	mov    %esp,%ebp
+       d:	57                   	push   %edi
+       e:	56                   	push   %esi
+       f:	53                   	push   %ebx
+      10:	51                   	push   %ecx
+      11:	83 ec 18             	sub    $0x18,%esp
+      14:	8b 01                	mov    (%ecx),%eax
+      16:	8b 59 04             	mov    0x4(%ecx),%ebx
+      19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  int i, j;
+
+  // Run just the named tests, skipping the usertests.ran check
+  // so that benchmarks can run them again and again.
+  if(argc > 1){
+      1c:	83 f8 01             	cmp    $0x1,%eax
+      1f:	7e 75                	jle    96 <main+0x96>
+      21:	83 c3 04             	add    $0x4,%ebx
+    for(i = 1; i < argc; i++){
+      24:	be 01 00 00 00       	mov    $0x1,%esi
+      29:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(j = 0; named[j].name; j++)
+      30:	a1 40 68 00 00       	mov    0x6840,%eax
+      35:	85 c0                	test   %eax,%eax
+      37:	74 49                	je     82 <main+0x82>
+      39:	31 ff                	xor    %edi,%edi
+      3b:	eb 11                	jmp    4e <main+0x4e>
+      3d:	8d 76 00             	lea    0x0(%esi),%esi
+      40:	83 c7 01             	add    $0x1,%edi
+      43:	8b 04 fd 40 68 00 00 	mov    0x6840(,%edi,8),%eax
+      4a:	85 c0                	test   %eax,%eax
+      4c:	74 34                	je     82 <main+0x82>
+        if(strcmp(argv[i], named[j].name) == 0)
+      4e:	83 ec 08             	sub    $0x8,%esp
+      51:	50                   	push   %eax
+      52:	ff 33                	push   (%ebx)
+      54:	e8 a7 38 00 00       	call   3900 <strcmp>
+      59:	83 c4 10             	add    $0x10,%esp
+      5c:	85 c0                	test   %eax,%eax
+      5e:	75 e0                	jne    40 <main+0x40>
+          break;
+      if(named[j].name == 0){
+      60:	8b 04 fd 40 68 00 00 	mov    0x6840(,%edi,8),%eax
+      67:	85 c0                	test   %eax,%eax
+      69:	74 17                	je     82 <main+0x82>
+        printf(1, "usertests: no test %s\n", argv[i]);
+        exit();
+      }
+      named[j].fn();
+      6b:	ff 14 fd 44 68 00 00 	call   *0x6844(,%edi,8)
+    for(i = 1; i < argc; i++){
+      72:	83 c6 01             	add    $0x1,%esi
+      75:	83 c3 04             	add    $0x4,%ebx
+      78:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+      7b:	75 b3                	jne    30 <main+0x30>
+    }
+    exit();
+      7d:	e8 42 3c 00 00       	call   3cc4 <exit>
+        printf(1, "usertests: no test %s\n", argv[i]);
+      82:	50                   	push   %eax
+      83:	ff 33                	push   (%ebx)
+      85:	68 50 5c 00 00       	push   $0x5c50
+      8a:	6a 01                	push   $0x1
+      8c:	e8 3f 3e 00 00       	call   3ed0 <printf>
+        exit();
+      91:	e8 2e 3c 00 00       	call   3cc4 <exit>
+  }
+
+  printf(1, "usertests starting\n");
+      96:	53                   	push   %ebx
+      97:	53                   	push   %ebx
+      98:	68 2e 5c 00 00       	push   $0x5c2e
+      9d:	6a 01                	push   $0x1
+      9f:	e8 2c 3e 00 00       	call   3ed0 <printf>
+
+  if(open("usertests.ran", 0) >= 0){
+      a4:	5e                   	pop    %esi
+      a5:	5f                   	pop    %edi
+      a6:	6a 00                	push   $0x0
+      a8:	68 42 5c 00 00       	push   $0x5c42
+      ad:	e8 52 3c 00 00       	call   3d04 <open>
+      b2:	83 c4 10             	add    $0x10,%esp
+      b5:	85 c0                	test   %eax,%eax
+      b7:	78 13                	js     cc <main+0xcc>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+      b9:	51                   	push   %ecx
+      ba:	51                   	push   %ecx
+      bb:	68 d4 4b 00 00       	push   $0x4bd4
+      c0:	6a 01                	push   $0x1
+      c2:	e8 09 3e 00 00       	call   3ed0 <printf>
+    exit();
+      c7:	e8 f8 3b 00 00       	call   3cc4 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+      cc:	52                   	push   %edx
+      cd:	52                   	push   %edx
+      ce:	68 00 02 00 00       	push   $0x200
+      d3:	68 42 5c 00 00       	push   $0x5c42
+      d8:	e8 27 3c 00 00       	call   3d04 <open>
+      dd:	89 04 24             	mov    %eax,(%esp)
+      e0:	e8 07 3c 00 00       	call   3cec <close>
+
+  argptest();
+      e5:	e8 56 37 00 00       	call   3840 <argptest>
+  createdelete();
+      ea:	e8 61 01 00 00       	call   250 <createdelete>
+  linkunlink();
+      ef:	e8 8c 10 00 00       	call   1180 <linkunlink>
+  concreate();
+      f4:	e8 87 0d 00 00       	call   e80 <concreate>
+  fourfiles();
+      f9:	e8 a2 09 00 00       	call   aa0 <fourfiles>
+  sharedfd();
+      fe:	e8 dd 07 00 00       	call   8e0 <sharedfd>
+
+  bigargtest();
+     103:	e8 f8 33 00 00       	call   3500 <bigargtest>
+  bigwrite();
+     108:	e8 43 03 00 00       	call   450 <bigwrite>
+  bigargtest();
+     10d:	e8 ee 33 00 00       	call   3500 <bigargtest>
+  bsstest();
+     112:	e8 79 33 00 00       	call   3490 <bsstest>
+  sbrktest();
+     117:	e8 74 2e 00 00       	call   2f90 <sbrktest>
+  validatetest();
+     11c:	e8 bf 32 00 00       	call   33e0 <validatetest>
+  wmapadjacent();
+     121:	e8 4a 18 00 00       	call   1970 <wmapadjacent>
+
+  opentest();
+     126:	e8 25 1e 00 00       	call   1f50 <opentest>
+  writetest();
+     12b:	e8 00 04 00 00       	call   530 <writetest>
+  writetest1();
+     130:	e8 db 05 00 00       	call   710 <writetest1>
+  createtest();
+     135:	e8 66 00 00 00       	call   1a0 <createtest>
+
+  openiputtest();
+     13a:	e8 11 1d 00 00       	call   1e50 <openiputtest>
+  exitiputtest();
+     13f:	e8 0c 1c 00 00       	call   1d50 <exitiputtest>
+  iputtest();
+     144:	e8 27 1b 00 00       	call   1c70 <iputtest>
+
+  mem();
+     149:	e8 42 23 00 00       	call   2490 <mem>
+  pipe1();
+     14e:	e8 bd 1f 00 00       	call   2110 <pipe1>
+  preempt();
+     153:	e8 58 21 00 00       	call   22b0 <preempt>
+  exitwait();
+     158:	e8 b3 22 00 00       	call   2410 <exitwait>
+
+  rmdot();
+     15d:	e8 de 28 00 00       	call   2a40 <rmdot>
+  fourteen();
+     162:	e8 99 27 00 00       	call   2900 <fourteen>
+  bigfile();
+     167:	e8 44 0b 00 00       	call   cb0 <bigfile>
+  subdir();
+     16c:	e8 1f 11 00 00       	call   1290 <subdir>
+  linktest();
+     171:	e8 7a 25 00 00       	call   26f0 <linktest>
+  unlinkread();
+     176:	e8 e5 23 00 00       	call   2560 <unlinkread>
+  dirfile();
+     17b:	e8 40 2a 00 00       	call   2bc0 <dirfile>
+  iref();
+     180:	e8 3b 2c 00 00       	call   2dc0 <iref>
+  forktest();
+     185:	e8 56 2d 00 00       	call   2ee0 <forktest>
+  bigdir(); // slow
+     18a:	e8 b1 19 00 00       	call   1b40 <bigdir>
+
+  uio();
+     18f:	e8 3c 36 00 00       	call   37d0 <uio>
+
+  exectest();
+     194:	e8 27 1f 00 00       	call   20c0 <exectest>
+
+  exit();
+     199:	e8 26 3b 00 00       	call   3cc4 <exit>
+     19e:	66 90                	xchg   %ax,%ax
+
+000001a0 <createtest>:
+{
+     1a0:	55                   	push   %ebp
+     1a1:	89 e5                	mov    %esp,%ebp
+     1a3:	53                   	push   %ebx
+  name[2] = '\0';
+     1a4:	bb 30 00 00 00       	mov    $0x30,%ebx
+{
+     1a9:	83 ec 0c             	sub    $0xc,%esp
+  printf(stdout, "many creates, followed by unlink test\n");
+     1ac:	68 b8 43 00 00       	push   $0x43b8
+     1b1:	ff 35 b4 68 00 00    	push   0x68b4
+     1b7:	e8 14 3d 00 00       	call   3ed0 <printf>
+  name[0] = 'a';
+     1bc:	c6 05 f0 8f 00 00 61 	movb   $0x61,0x8ff0
+  name[2] = '\0';
+     1c3:	83 c4 10             	add    $0x10,%esp
+     1c6:	c6 05 f2 8f 00 00 00 	movb   $0x0,0x8ff2
+  for(i = 0; i < 52; i++){
+     1cd:	8d 76 00             	lea    0x0(%esi),%esi
+    fd = open(name, O_CREATE|O_RDWR);
+     1d0:	83 ec 08             	sub    $0x8,%esp
+    name[1] = '0' + i;
+     1d3:	88 1d f1 8f 00 00    	mov    %bl,0x8ff1
+  for(i = 0; i < 52; i++){
+     1d9:	83 c3 01             	add    $0x1,%ebx
+    fd = open(name, O_CREATE|O_RDWR);
+     1dc:	68 02 02 00 00       	push   $0x202
+     1e1:	68 f0 8f 00 00       	push   $0x8ff0
+     1e6:	e8 19 3b 00 00       	call   3d04 <open>
+    close(fd);
+     1eb:	89 04 24             	mov    %eax,(%esp)
+     1ee:	e8 f9 3a 00 00       	call   3cec <close>
+  for(i = 0; i < 52; i++){
+     1f3:	83 c4 10             	add    $0x10,%esp
+     1f6:	80 fb 64             	cmp    $0x64,%bl
+     1f9:	75 d5                	jne    1d0 <createtest+0x30>
+  name[0] = 'a';
+     1fb:	c6 05 f0 8f 00 00 61 	movb   $0x61,0x8ff0
+  name[2] = '\0';
+     202:	bb 30 00 00 00       	mov    $0x30,%ebx
+     207:	c6 05 f2 8f 00 00 00 	movb   $0x0,0x8ff2
+  for(i = 0; i < 52; i++){
+     20e:	66 90                	xchg   %ax,%ax
+    unlink(name);
+     210:	83 ec 0c             	sub    $0xc,%esp
+    name[1] = '0' + i;
+     213:	88 1d f1 8f 00 00    	mov    %bl,0x8ff1
+  for(i = 0; i < 52; i++){
+     219:	83 c3 01             	add    $0x1,%ebx
+    unlink(name);
+     21c:	68 f0 8f 00 00       	push   $0x8ff0
+     221:	e8 ee 3a 00 00       	call   3d14 <unlink>
+  for(i = 0; i < 52; i++){
+     226:	83 c4 10             	add    $0x10,%esp
+     229:	80 fb 64             	cmp    $0x64,%bl
+     22c:	75 e2                	jne    210 <createtest+0x70>
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     22e:	83 ec 08             	sub    $0x8,%esp
+     231:	68 e0 43 00 00       	push   $0x43e0
+     236:	ff 35 b4 68 00 00    	push   0x68b4
+     23c:	e8 8f 3c 00 00       	call   3ed0 <printf>
+}
+     241:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     244:	83 c4 10             	add    $0x10,%esp
+     247:	c9                   	leave
+     248:	c3                   	ret
+     249:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000250 <createdelete>:
+{
+     250:	55                   	push   %ebp
+     251:	89 e5                	mov    %esp,%ebp
+     253:	57                   	push   %edi
+     254:	56                   	push   %esi
+  for(pi = 0; pi < 4; pi++){
+     255:	31 f6                	xor    %esi,%esi
+{
+     257:	53                   	push   %ebx
+     258:	83 ec 44             	sub    $0x44,%esp
+  printf(1, "createdelete test\n");
+     25b:	68 fe 4b 00 00       	push   $0x4bfe
+     260:	6a 01                	push   $0x1
+     262:	e8 69 3c 00 00       	call   3ed0 <printf>
+     267:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+     26a:	e8 4d 3a 00 00       	call   3cbc <fork>
+     26f:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+     271:	85 c0                	test   %eax,%eax
+     273:	0f 88 ac 01 00 00    	js     425 <createdelete+0x1d5>
+    if(pid == 0){
+     279:	0f 84 01 01 00 00    	je     380 <createdelete+0x130>
+  for(pi = 0; pi < 4; pi++){
+     27f:	83 c6 01             	add    $0x1,%esi
+     282:	83 fe 04             	cmp    $0x4,%esi
+     285:	75 e3                	jne    26a <createdelete+0x1a>
+    wait();
+     287:	e8 40 3a 00 00       	call   3ccc <wait>
+  for(i = 0; i < N; i++){
+     28c:	31 ff                	xor    %edi,%edi
+     28e:	8d 75 c8             	lea    -0x38(%ebp),%esi
+    wait();
+     291:	e8 36 3a 00 00       	call   3ccc <wait>
+     296:	e8 31 3a 00 00       	call   3ccc <wait>
+     29b:	e8 2c 3a 00 00       	call   3ccc <wait>
+  name[0] = name[1] = name[2] = 0;
+     2a0:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  for(i = 0; i < N; i++){
+     2a4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      if((i == 0 || i >= N/2) && fd < 0){
+     2a8:	85 ff                	test   %edi,%edi
+      name[1] = '0' + i;
+     2aa:	8d 47 30             	lea    0x30(%edi),%eax
+      if((i == 0 || i >= N/2) && fd < 0){
+     2ad:	bb 70 00 00 00       	mov    $0x70,%ebx
+     2b2:	0f 94 c2             	sete   %dl
+     2b5:	83 ff 09             	cmp    $0x9,%edi
+      name[1] = '0' + i;
+     2b8:	88 45 c6             	mov    %al,-0x3a(%ebp)
+      if((i == 0 || i >= N/2) && fd < 0){
+     2bb:	0f 9f c0             	setg   %al
+     2be:	09 c2                	or     %eax,%edx
+     2c0:	88 55 c7             	mov    %dl,-0x39(%ebp)
+      name[1] = '0' + i;
+     2c3:	0f b6 45 c6          	movzbl -0x3a(%ebp),%eax
+      fd = open(name, 0);
+     2c7:	83 ec 08             	sub    $0x8,%esp
+      name[0] = 'p' + pi;
+     2ca:	88 5d c8             	mov    %bl,-0x38(%ebp)
+      name[1] = '0' + i;
+     2cd:	88 45 c9             	mov    %al,-0x37(%ebp)
+      fd = open(name, 0);
+     2d0:	6a 00                	push   $0x0
+     2d2:	56                   	push   %esi
+     2d3:	e8 2c 3a 00 00       	call   3d04 <open>
+      if((i == 0 || i >= N/2) && fd < 0){
+     2d8:	83 c4 10             	add    $0x10,%esp
+     2db:	80 7d c7 00          	cmpb   $0x0,-0x39(%ebp)
+     2df:	74 7f                	je     360 <createdelete+0x110>
+     2e1:	85 c0                	test   %eax,%eax
+     2e3:	0f 88 27 01 00 00    	js     410 <createdelete+0x1c0>
+        close(fd);
+     2e9:	83 ec 0c             	sub    $0xc,%esp
+     2ec:	50                   	push   %eax
+     2ed:	e8 fa 39 00 00       	call   3cec <close>
+     2f2:	83 c4 10             	add    $0x10,%esp
+    for(pi = 0; pi < 4; pi++){
+     2f5:	83 c3 01             	add    $0x1,%ebx
+     2f8:	80 fb 74             	cmp    $0x74,%bl
+     2fb:	75 c6                	jne    2c3 <createdelete+0x73>
+  for(i = 0; i < N; i++){
+     2fd:	83 c7 01             	add    $0x1,%edi
+     300:	83 ff 14             	cmp    $0x14,%edi
+     303:	75 a3                	jne    2a8 <createdelete+0x58>
+     305:	bf 70 00 00 00       	mov    $0x70,%edi
+     30a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      name[1] = '0' + i;
+     310:	8d 47 c0             	lea    -0x40(%edi),%eax
+     313:	bb 04 00 00 00       	mov    $0x4,%ebx
+     318:	88 45 c7             	mov    %al,-0x39(%ebp)
+      name[0] = 'p' + i;
+     31b:	89 f8                	mov    %edi,%eax
+      unlink(name);
+     31d:	83 ec 0c             	sub    $0xc,%esp
+      name[0] = 'p' + i;
+     320:	88 45 c8             	mov    %al,-0x38(%ebp)
+      name[1] = '0' + i;
+     323:	0f b6 45 c7          	movzbl -0x39(%ebp),%eax
+     327:	88 45 c9             	mov    %al,-0x37(%ebp)
+      unlink(name);
+     32a:	56                   	push   %esi
+     32b:	e8 e4 39 00 00       	call   3d14 <unlink>
+    for(pi = 0; pi < 4; pi++){
+     330:	83 c4 10             	add    $0x10,%esp
+     333:	83 eb 01             	sub    $0x1,%ebx
+     336:	75 e3                	jne    31b <createdelete+0xcb>
+  for(i = 0; i < N; i++){
+     338:	83 c7 01             	add    $0x1,%edi
+     33b:	89 f8                	mov    %edi,%eax
+     33d:	3c 84                	cmp    $0x84,%al
+     33f:	75 cf                	jne    310 <createdelete+0xc0>
+  printf(1, "createdelete ok\n");
+     341:	83 ec 08             	sub    $0x8,%esp
+     344:	68 20 4c 00 00       	push   $0x4c20
+     349:	6a 01                	push   $0x1
+     34b:	e8 80 3b 00 00       	call   3ed0 <printf>
+}
+     350:	83 c4 10             	add    $0x10,%esp
+     353:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     356:	5b                   	pop    %ebx
+     357:	5e                   	pop    %esi
+     358:	5f                   	pop    %edi
+     359:	5d                   	pop    %ebp
+     35a:	c3                   	ret
+     35b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     35f:	90                   	nop
+      } else if((i >= 1 && i < N/2) && fd >= 0){
+     360:	85 c0                	test   %eax,%eax
+     362:	78 91                	js     2f5 <createdelete+0xa5>
+        printf(1, "oops createdelete %s did exist\n", name);
+     364:	50                   	push   %eax
+     365:	56                   	push   %esi
+     366:	68 2c 44 00 00       	push   $0x442c
+     36b:	6a 01                	push   $0x1
+     36d:	e8 5e 3b 00 00       	call   3ed0 <printf>
+        exit();
+     372:	e8 4d 39 00 00       	call   3cc4 <exit>
+     377:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     37e:	66 90                	xchg   %ax,%ax
+      name[0] = 'p' + pi;
+     380:	8d 46 70             	lea    0x70(%esi),%eax
+      name[2] = '\0';
+     383:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+     387:	8d 75 c8             	lea    -0x38(%ebp),%esi
+      name[0] = 'p' + pi;
+     38a:	88 45 c8             	mov    %al,-0x38(%ebp)
+      for(i = 0; i < N; i++){
+     38d:	8d 76 00             	lea    0x0(%esi),%esi
+        fd = open(name, O_CREATE | O_RDWR);
+     390:	83 ec 08             	sub    $0x8,%esp
+        name[1] = '0' + i;
+     393:	8d 43 30             	lea    0x30(%ebx),%eax
+     396:	88 45 c9             	mov    %al,-0x37(%ebp)
+        fd = open(name, O_CREATE | O_RDWR);
+     399:	68 02 02 00 00       	push   $0x202
+     39e:	56                   	push   %esi
+     39f:	e8 60 39 00 00       	call   3d04 <open>
+        if(fd < 0){
+     3a4:	83 c4 10             	add    $0x10,%esp
+     3a7:	85 c0                	test   %eax,%eax
+     3a9:	0f 88 8a 00 00 00    	js     439 <createdelete+0x1e9>
+        close(fd);
+     3af:	83 ec 0c             	sub    $0xc,%esp
+     3b2:	50                   	push   %eax
+     3b3:	e8 34 39 00 00       	call   3cec <close>
+        if(i > 0 && (i % 2 ) == 0){
+     3b8:	83 c4 10             	add    $0x10,%esp
+     3bb:	85 db                	test   %ebx,%ebx
+     3bd:	74 19                	je     3d8 <createdelete+0x188>
+     3bf:	f6 c3 01             	test   $0x1,%bl
+     3c2:	74 1b                	je     3df <createdelete+0x18f>
+      for(i = 0; i < N; i++){
+     3c4:	83 c3 01             	add    $0x1,%ebx
+     3c7:	83 fb 14             	cmp    $0x14,%ebx
+     3ca:	75 c4                	jne    390 <createdelete+0x140>
+      exit();
+     3cc:	e8 f3 38 00 00       	call   3cc4 <exit>
+     3d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+      for(i = 0; i < N; i++){
+     3d8:	bb 01 00 00 00       	mov    $0x1,%ebx
+     3dd:	eb b1                	jmp    390 <createdelete+0x140>
+          name[1] = '0' + (i / 2);
+     3df:	89 d8                	mov    %ebx,%eax
+          if(unlink(name) < 0){
+     3e1:	83 ec 0c             	sub    $0xc,%esp
+          name[1] = '0' + (i / 2);
+     3e4:	d1 f8                	sar    %eax
+     3e6:	83 c0 30             	add    $0x30,%eax
+     3e9:	88 45 c9             	mov    %al,-0x37(%ebp)
+          if(unlink(name) < 0){
+     3ec:	56                   	push   %esi
+     3ed:	e8 22 39 00 00       	call   3d14 <unlink>
+     3f2:	83 c4 10             	add    $0x10,%esp
+     3f5:	85 c0                	test   %eax,%eax
+     3f7:	79 cb                	jns    3c4 <createdelete+0x174>
+            printf(1, "unlink failed\n");
+     3f9:	52                   	push   %edx
+     3fa:	52                   	push   %edx
+     3fb:	68 11 4c 00 00       	push   $0x4c11
+     400:	6a 01                	push   $0x1
+     402:	e8 c9 3a 00 00       	call   3ed0 <printf>
+            exit();
+     407:	e8 b8 38 00 00       	call   3cc4 <exit>
+     40c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "oops createdelete %s didn't exist\n", name);
+     410:	83 ec 04             	sub    $0x4,%esp
+     413:	56                   	push   %esi
+     414:	68 08 44 00 00       	push   $0x4408
+     419:	6a 01                	push   $0x1
+     41b:	e8 b0 3a 00 00       	call   3ed0 <printf>
+        exit();
+     420:	e8 9f 38 00 00       	call   3cc4 <exit>
+      printf(1, "fork failed\n");
+     425:	83 ec 08             	sub    $0x8,%esp
+     428:	68 81 5b 00 00       	push   $0x5b81
+     42d:	6a 01                	push   $0x1
+     42f:	e8 9c 3a 00 00       	call   3ed0 <printf>
+      exit();
+     434:	e8 8b 38 00 00       	call   3cc4 <exit>
+          printf(1, "create failed\n");
+     439:	83 ec 08             	sub    $0x8,%esp
+     43c:	68 59 53 00 00       	push   $0x5359
+     441:	6a 01                	push   $0x1
+     443:	e8 88 3a 00 00       	call   3ed0 <printf>
+          exit();
+     448:	e8 77 38 00 00       	call   3cc4 <exit>
+     44d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000450 <bigwrite>:
+{
+     450:	55                   	push   %ebp
+     451:	89 e5                	mov    %esp,%ebp
+     453:	56                   	push   %esi
+     454:	53                   	push   %ebx
+  for(sz = 499; sz < 12*512; sz += 471){
+     455:	bb f3 01 00 00       	mov    $0x1f3,%ebx
+  printf(1, "bigwrite test\n");
+     45a:	83 ec 08             	sub    $0x8,%esp
+     45d:	68 31 4c 00 00       	push   $0x4c31
+     462:	6a 01                	push   $0x1
+     464:	e8 67 3a 00 00       	call   3ed0 <printf>
+  unlink("bigwrite");
+     469:	c7 04 24 40 4c 00 00 	movl   $0x4c40,(%esp)
+     470:	e8 9f 38 00 00       	call   3d14 <unlink>
+     475:	83 c4 10             	add    $0x10,%esp
+     478:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     47f:	90                   	nop
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+     480:	83 ec 08             	sub    $0x8,%esp
+     483:	68 02 02 00 00       	push   $0x202
+     488:	68 40 4c 00 00       	push   $0x4c40
+     48d:	e8 72 38 00 00       	call   3d04 <open>
+    if(fd < 0){
+     492:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+     495:	89 c6                	mov    %eax,%esi
+    if(fd < 0){
+     497:	85 c0                	test   %eax,%eax
+     499:	78 7e                	js     519 <bigwrite+0xc9>
+      int cc = write(fd, buf, sz);
+     49b:	83 ec 04             	sub    $0x4,%esp
+     49e:	53                   	push   %ebx
+     49f:	68 00 90 00 00       	push   $0x9000
+     4a4:	50                   	push   %eax
+     4a5:	e8 3a 38 00 00       	call   3ce4 <write>
+      if(cc != sz){
+     4aa:	83 c4 10             	add    $0x10,%esp
+     4ad:	39 d8                	cmp    %ebx,%eax
+     4af:	75 55                	jne    506 <bigwrite+0xb6>
+      int cc = write(fd, buf, sz);
+     4b1:	83 ec 04             	sub    $0x4,%esp
+     4b4:	53                   	push   %ebx
+     4b5:	68 00 90 00 00       	push   $0x9000
+     4ba:	56                   	push   %esi
+     4bb:	e8 24 38 00 00       	call   3ce4 <write>
+      if(cc != sz){
+     4c0:	83 c4 10             	add    $0x10,%esp
+     4c3:	39 c3                	cmp    %eax,%ebx
+     4c5:	75 3f                	jne    506 <bigwrite+0xb6>
+    close(fd);
+     4c7:	83 ec 0c             	sub    $0xc,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+     4ca:	81 c3 d7 01 00 00    	add    $0x1d7,%ebx
+    close(fd);
+     4d0:	56                   	push   %esi
+     4d1:	e8 16 38 00 00       	call   3cec <close>
+    unlink("bigwrite");
+     4d6:	c7 04 24 40 4c 00 00 	movl   $0x4c40,(%esp)
+     4dd:	e8 32 38 00 00       	call   3d14 <unlink>
+  for(sz = 499; sz < 12*512; sz += 471){
+     4e2:	83 c4 10             	add    $0x10,%esp
+     4e5:	81 fb 07 18 00 00    	cmp    $0x1807,%ebx
+     4eb:	75 93                	jne    480 <bigwrite+0x30>
+  printf(1, "bigwrite ok\n");
+     4ed:	83 ec 08             	sub    $0x8,%esp
+     4f0:	68 73 4c 00 00       	push   $0x4c73
+     4f5:	6a 01                	push   $0x1
+     4f7:	e8 d4 39 00 00       	call   3ed0 <printf>
+}
+     4fc:	83 c4 10             	add    $0x10,%esp
+     4ff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     502:	5b                   	pop    %ebx
+     503:	5e                   	pop    %esi
+     504:	5d                   	pop    %ebp
+     505:	c3                   	ret
+        printf(1, "write(%d) ret %d\n", sz, cc);
+     506:	50                   	push   %eax
+     507:	53                   	push   %ebx
+     508:	68 61 4c 00 00       	push   $0x4c61
+     50d:	6a 01                	push   $0x1
+     50f:	e8 bc 39 00 00       	call   3ed0 <printf>
+        exit();
+     514:	e8 ab 37 00 00       	call   3cc4 <exit>
+      printf(1, "cannot create bigwrite\n");
+     519:	83 ec 08             	sub    $0x8,%esp
+     51c:	68 49 4c 00 00       	push   $0x4c49
+     521:	6a 01                	push   $0x1
+     523:	e8 a8 39 00 00       	call   3ed0 <printf>
+      exit();
+     528:	e8 97 37 00 00       	call   3cc4 <exit>
+     52d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000530 <writetest>:
+{
+     530:	55                   	push   %ebp
+     531:	89 e5                	mov    %esp,%ebp
+     533:	56                   	push   %esi
+     534:	53                   	push   %ebx
+  printf(stdout, "small file test\n");
+     535:	83 ec 08             	sub    $0x8,%esp
+     538:	68 80 4c 00 00       	push   $0x4c80
+     53d:	ff 35 b4 68 00 00    	push   0x68b4
+     543:	e8 88 39 00 00       	call   3ed0 <printf>
+  fd = open("small", O_CREATE|O_RDWR);
+     548:	58                   	pop    %eax
+     549:	5a                   	pop    %edx
+     54a:	68 02 02 00 00       	push   $0x202
+     54f:	68 91 4c 00 00       	push   $0x4c91
+     554:	e8 ab 37 00 00       	call   3d04 <open>
+  if(fd >= 0){
+     559:	83 c4 10             	add    $0x10,%esp
+     55c:	85 c0                	test   %eax,%eax
+     55e:	0f 88 88 01 00 00    	js     6ec <writetest+0x1bc>
+    printf(stdout, "creat small succeeded; ok\n");
+     564:	83 ec 08             	sub    $0x8,%esp
+     567:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 100; i++){
+     569:	31 db                	xor    %ebx,%ebx
+    printf(stdout, "creat small succeeded; ok\n");
+     56b:	68 97 4c 00 00       	push   $0x4c97
+     570:	ff 35 b4 68 00 00    	push   0x68b4
+     576:	e8 55 39 00 00       	call   3ed0 <printf>
+     57b:	83 c4 10             	add    $0x10,%esp
+     57e:	66 90                	xchg   %ax,%ax
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     580:	83 ec 04             	sub    $0x4,%esp
+     583:	6a 0a                	push   $0xa
+     585:	68 ce 4c 00 00       	push   $0x4cce
+     58a:	56                   	push   %esi
+     58b:	e8 54 37 00 00       	call   3ce4 <write>
+     590:	83 c4 10             	add    $0x10,%esp
+     593:	83 f8 0a             	cmp    $0xa,%eax
+     596:	0f 85 d9 00 00 00    	jne    675 <writetest+0x145>
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     59c:	83 ec 04             	sub    $0x4,%esp
+     59f:	6a 0a                	push   $0xa
+     5a1:	68 d9 4c 00 00       	push   $0x4cd9
+     5a6:	56                   	push   %esi
+     5a7:	e8 38 37 00 00       	call   3ce4 <write>
+     5ac:	83 c4 10             	add    $0x10,%esp
+     5af:	83 f8 0a             	cmp    $0xa,%eax
+     5b2:	0f 85 d6 00 00 00    	jne    68e <writetest+0x15e>
+  for(i = 0; i < 100; i++){
+     5b8:	83 c3 01             	add    $0x1,%ebx
+     5bb:	83 fb 64             	cmp    $0x64,%ebx
+     5be:	75 c0                	jne    580 <writetest+0x50>
+  printf(stdout, "writes ok\n");
+     5c0:	83 ec 08             	sub    $0x8,%esp
+     5c3:	68 e4 4c 00 00       	push   $0x4ce4
+     5c8:	ff 35 b4 68 00 00    	push   0x68b4
+     5ce:	e8 fd 38 00 00       	call   3ed0 <printf>
+  close(fd);
+     5d3:	89 34 24             	mov    %esi,(%esp)
+     5d6:	e8 11 37 00 00       	call   3cec <close>
+  fd = open("small", O_RDONLY);
+     5db:	5b                   	pop    %ebx
+     5dc:	5e                   	pop    %esi
+     5dd:	6a 00                	push   $0x0
+     5df:	68 91 4c 00 00       	push   $0x4c91
+     5e4:	e8 1b 37 00 00       	call   3d04 <open>
+  if(fd >= 0){
+     5e9:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     5ec:	89 c3                	mov    %eax,%ebx
+  if(fd >= 0){
+     5ee:	85 c0                	test   %eax,%eax
+     5f0:	0f 88 b1 00 00 00    	js     6a7 <writetest+0x177>
+    printf(stdout, "open small succeeded ok\n");
+     5f6:	83 ec 08             	sub    $0x8,%esp
+     5f9:	68 ef 4c 00 00       	push   $0x4cef
+     5fe:	ff 35 b4 68 00 00    	push   0x68b4
+     604:	e8 c7 38 00 00       	call   3ed0 <printf>
+  i = read(fd, buf, 2000);
+     609:	83 c4 0c             	add    $0xc,%esp
+     60c:	68 d0 07 00 00       	push   $0x7d0
+     611:	68 00 90 00 00       	push   $0x9000
+     616:	53                   	push   %ebx
+     617:	e8 c0 36 00 00       	call   3cdc <read>
+  if(i == 2000){
+     61c:	83 c4 10             	add    $0x10,%esp
+     61f:	3d d0 07 00 00       	cmp    $0x7d0,%eax
+     624:	0f 85 94 00 00 00    	jne    6be <writetest+0x18e>
+    printf(stdout, "read succeeded ok\n");
+     62a:	83 ec 08             	sub    $0x8,%esp
+     62d:	68 23 4d 00 00       	push   $0x4d23
+     632:	ff 35 b4 68 00 00    	push   0x68b4
+     638:	e8 93 38 00 00       	call   3ed0 <printf>
+  close(fd);
+     63d:	89 1c 24             	mov    %ebx,(%esp)
+     640:	e8 a7 36 00 00       	call   3cec <close>
+  if(unlink("small") < 0){
+     645:	c7 04 24 91 4c 00 00 	movl   $0x4c91,(%esp)
+     64c:	e8 c3 36 00 00       	call   3d14 <unlink>
+     651:	83 c4 10             	add    $0x10,%esp
+     654:	85 c0                	test   %eax,%eax
+     656:	78 7d                	js     6d5 <writetest+0x1a5>
+  printf(stdout, "small file test ok\n");
+     658:	83 ec 08             	sub    $0x8,%esp
+     65b:	68 4b 4d 00 00       	push   $0x4d4b
+     660:	ff 35 b4 68 00 00    	push   0x68b4
+     666:	e8 65 38 00 00       	call   3ed0 <printf>
+}
+     66b:	83 c4 10             	add    $0x10,%esp
+     66e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     671:	5b                   	pop    %ebx
+     672:	5e                   	pop    %esi
+     673:	5d                   	pop    %ebp
+     674:	c3                   	ret
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     675:	83 ec 04             	sub    $0x4,%esp
+     678:	53                   	push   %ebx
+     679:	68 4c 44 00 00       	push   $0x444c
+     67e:	ff 35 b4 68 00 00    	push   0x68b4
+     684:	e8 47 38 00 00       	call   3ed0 <printf>
+      exit();
+     689:	e8 36 36 00 00       	call   3cc4 <exit>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     68e:	83 ec 04             	sub    $0x4,%esp
+     691:	53                   	push   %ebx
+     692:	68 70 44 00 00       	push   $0x4470
+     697:	ff 35 b4 68 00 00    	push   0x68b4
+     69d:	e8 2e 38 00 00       	call   3ed0 <printf>
+      exit();
+     6a2:	e8 1d 36 00 00       	call   3cc4 <exit>
+    printf(stdout, "error: open small failed!\n");
+     6a7:	51                   	push   %ecx
+     6a8:	51                   	push   %ecx
+     6a9:	68 08 4d 00 00       	push   $0x4d08
+     6ae:	ff 35 b4 68 00 00    	push   0x68b4
+     6b4:	e8 17 38 00 00       	call   3ed0 <printf>
+    exit();
+     6b9:	e8 06 36 00 00       	call   3cc4 <exit>
+    printf(stdout, "read failed\n");
+     6be:	52                   	push   %edx
+     6bf:	52                   	push   %edx
+     6c0:	68 54 56 00 00       	push   $0x5654
+     6c5:	ff 35 b4 68 00 00    	push   0x68b4
+     6cb:	e8 00 38 00 00       	call   3ed0 <printf>
+    exit();
+     6d0:	e8 ef 35 00 00       	call   3cc4 <exit>
+    printf(stdout, "unlink small failed\n");
+     6d5:	50                   	push   %eax
+     6d6:	50                   	push   %eax
+     6d7:	68 36 4d 00 00       	push   $0x4d36
+     6dc:	ff 35 b4 68 00 00    	push   0x68b4
+     6e2:	e8 e9 37 00 00       	call   3ed0 <printf>
+    exit();
+     6e7:	e8 d8 35 00 00       	call   3cc4 <exit>
+    printf(stdout, "error: creat small failed!\n");
+     6ec:	50                   	push   %eax
+     6ed:	50                   	push   %eax
+     6ee:	68 b2 4c 00 00       	push   $0x4cb2
+     6f3:	ff 35 b4 68 00 00    	push   0x68b4
+     6f9:	e8 d2 37 00 00       	call   3ed0 <printf>
+    exit();
+     6fe:	e8 c1 35 00 00       	call   3cc4 <exit>
+     703:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000710 <writetest1>:
+{
+     710:	55                   	push   %ebp
+     711:	89 e5                	mov    %esp,%ebp
+     713:	56                   	push   %esi
+     714:	53                   	push   %ebx
+  printf(stdout, "big files test\n");
+     715:	83 ec 08             	sub    $0x8,%esp
+     718:	68 5f 4d 00 00       	push   $0x4d5f
+     71d:	ff 35 b4 68 00 00    	push   0x68b4
+     723:	e8 a8 37 00 00       	call   3ed0 <printf>
+  fd = open("big", O_CREATE|O_RDWR);
+     728:	58                   	pop    %eax
+     729:	5a                   	pop    %edx
+     72a:	68 02 02 00 00       	push   $0x202
+     72f:	68 d9 4d 00 00       	push   $0x4dd9
+     734:	e8 cb 35 00 00       	call   3d04 <open>
+  if(fd < 0){
+     739:	83 c4 10             	add    $0x10,%esp
+     73c:	85 c0                	test   %eax,%eax
+     73e:	0f 88 61 01 00 00    	js     8a5 <writetest1+0x195>
+     744:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < BIGBLOCKS; i++){
+     746:	31 db                	xor    %ebx,%ebx
+     748:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     74f:	90                   	nop
+    if(write(fd, buf, BSIZE) != BSIZE){
+     750:	83 ec 04             	sub    $0x4,%esp
+    ((int*)buf)[0] = i;
+     753:	89 1d 00 90 00 00    	mov    %ebx,0x9000
+    if(write(fd, buf, BSIZE) != BSIZE){
+     759:	68 00 10 00 00       	push   $0x1000
+     75e:	68 00 90 00 00       	push   $0x9000
+     763:	56                   	push   %esi
+     764:	e8 7b 35 00 00       	call   3ce4 <write>
+     769:	83 c4 10             	add    $0x10,%esp
+     76c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     771:	0f 85 b3 00 00 00    	jne    82a <writetest1+0x11a>
+  for(i = 0; i < BIGBLOCKS; i++){
+     777:	83 c3 01             	add    $0x1,%ebx
+     77a:	81 fb 0a 08 00 00    	cmp    $0x80a,%ebx
+     780:	75 ce                	jne    750 <writetest1+0x40>
+  close(fd);
+     782:	83 ec 0c             	sub    $0xc,%esp
+     785:	56                   	push   %esi
+     786:	e8 61 35 00 00       	call   3cec <close>
+  fd = open("big", O_RDONLY);
+     78b:	5b                   	pop    %ebx
+     78c:	5e                   	pop    %esi
+     78d:	6a 00                	push   $0x0
+     78f:	68 d9 4d 00 00       	push   $0x4dd9
+     794:	e8 6b 35 00 00       	call   3d04 <open>
+  if(fd < 0){
+     799:	83 c4 10             	add    $0x10,%esp
+  fd = open("big", O_RDONLY);
+     79c:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+     79e:	85 c0                	test   %eax,%eax
+     7a0:	0f 88 e8 00 00 00    	js     88e <writetest1+0x17e>
+  n = 0;
+     7a6:	31 f6                	xor    %esi,%esi
+     7a8:	eb 1d                	jmp    7c7 <writetest1+0xb7>
+     7aa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    } else if(i != BSIZE){
+     7b0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+     7b5:	0f 85 9f 00 00 00    	jne    85a <writetest1+0x14a>
+    if(((int*)buf)[0] != n){
+     7bb:	a1 00 90 00 00       	mov    0x9000,%eax
+     7c0:	39 f0                	cmp    %esi,%eax
+     7c2:	75 7f                	jne    843 <writetest1+0x133>
+    n++;
+     7c4:	83 c6 01             	add    $0x1,%esi
+    i = read(fd, buf, BSIZE);
+     7c7:	83 ec 04             	sub    $0x4,%esp
+     7ca:	68 00 10 00 00       	push   $0x1000
+     7cf:	68 00 90 00 00       	push   $0x9000
+     7d4:	53                   	push   %ebx
+     7d5:	e8 02 35 00 00       	call   3cdc <read>
+    if(i == 0){
+     7da:	83 c4 10             	add    $0x10,%esp
+     7dd:	85 c0                	test   %eax,%eax
+     7df:	75 cf                	jne    7b0 <writetest1+0xa0>
+      if(n == BIGBLOCKS - 1){
+     7e1:	81 fe 09 08 00 00    	cmp    $0x809,%esi
+     7e7:	0f 84 86 00 00 00    	je     873 <writetest1+0x163>
+  close(fd);
+     7ed:	83 ec 0c             	sub    $0xc,%esp
+     7f0:	53                   	push   %ebx
+     7f1:	e8 f6 34 00 00       	call   3cec <close>
+  if(unlink("big") < 0){
+     7f6:	c7 04 24 d9 4d 00 00 	movl   $0x4dd9,(%esp)
+     7fd:	e8 12 35 00 00       	call   3d14 <unlink>
+     802:	83 c4 10             	add    $0x10,%esp
+     805:	85 c0                	test   %eax,%eax
+     807:	0f 88 af 00 00 00    	js     8bc <writetest1+0x1ac>
+  printf(stdout, "big files ok\n");
+     80d:	83 ec 08             	sub    $0x8,%esp
+     810:	68 00 4e 00 00       	push   $0x4e00
+     815:	ff 35 b4 68 00 00    	push   0x68b4
+     81b:	e8 b0 36 00 00       	call   3ed0 <printf>
+}
+     820:	83 c4 10             	add    $0x10,%esp
+     823:	8d 65 f8             	lea    -0x8(%ebp),%esp
+     826:	5b                   	pop    %ebx
+     827:	5e                   	pop    %esi
+     828:	5d                   	pop    %ebp
+     829:	c3                   	ret
+      printf(stdout, "error: write big file failed\n", i);
+     82a:	83 ec 04             	sub    $0x4,%esp
+     82d:	53                   	push   %ebx
+     82e:	68 89 4d 00 00       	push   $0x4d89
+     833:	ff 35 b4 68 00 00    	push   0x68b4
+     839:	e8 92 36 00 00       	call   3ed0 <printf>
+      exit();
+     83e:	e8 81 34 00 00       	call   3cc4 <exit>
+      printf(stdout, "read content of block %d is %d\n",
+     843:	50                   	push   %eax
+     844:	56                   	push   %esi
+     845:	68 94 44 00 00       	push   $0x4494
+     84a:	ff 35 b4 68 00 00    	push   0x68b4
+     850:	e8 7b 36 00 00       	call   3ed0 <printf>
+      exit();
+     855:	e8 6a 34 00 00       	call   3cc4 <exit>
+      printf(stdout, "read failed %d\n", i);
+     85a:	83 ec 04             	sub    $0x4,%esp
+     85d:	50                   	push   %eax
+     85e:	68 dd 4d 00 00       	push   $0x4ddd
+     863:	ff 35 b4 68 00 00    	push   0x68b4
+     869:	e8 62 36 00 00       	call   3ed0 <printf>
+      exit();
+     86e:	e8 51 34 00 00       	call   3cc4 <exit>
+        printf(stdout, "read only %d blocks from big", n);
+     873:	52                   	push   %edx
+     874:	68 09 08 00 00       	push   $0x809
+     879:	68 c0 4d 00 00       	push   $0x4dc0
+     87e:	ff 35 b4 68 00 00    	push   0x68b4
+     884:	e8 47 36 00 00       	call   3ed0 <printf>
+        exit();
+     889:	e8 36 34 00 00       	call   3cc4 <exit>
+    printf(stdout, "error: open big failed!\n");
+     88e:	51                   	push   %ecx
+     88f:	51                   	push   %ecx
+     890:	68 a7 4d 00 00       	push   $0x4da7
+     895:	ff 35 b4 68 00 00    	push   0x68b4
+     89b:	e8 30 36 00 00       	call   3ed0 <printf>
+    exit();
+     8a0:	e8 1f 34 00 00       	call   3cc4 <exit>
+    printf(stdout, "error: creat big failed!\n");
+     8a5:	50                   	push   %eax
+     8a6:	50                   	push   %eax
+     8a7:	68 6f 4d 00 00       	push   $0x4d6f
+     8ac:	ff 35 b4 68 00 00    	push   0x68b4
+     8b2:	e8 19 36 00 00       	call   3ed0 <printf>
+    exit();
+     8b7:	e8 08 34 00 00       	call   3cc4 <exit>
+    printf(stdout, "unlink big failed\n");
+     8bc:	50                   	push   %eax
+     8bd:	50                   	push   %eax
+     8be:	68 ed 4d 00 00       	push   $0x4ded
+     8c3:	ff 35 b4 68 00 00    	push   0x68b4
+     8c9:	e8 02 36 00 00       	call   3ed0 <printf>
+    exit();
+     8ce:	e8 f1 33 00 00       	call   3cc4 <exit>
+     8d3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     8da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000008e0 <sharedfd>:
+{
+     8e0:	55                   	push   %ebp
+     8e1:	89 e5                	mov    %esp,%ebp
+     8e3:	57                   	push   %edi
+     8e4:	56                   	push   %esi
+     8e5:	53                   	push   %ebx
+     8e6:	83 ec 34             	sub    $0x34,%esp
+  printf(1, "sharedfd test\n");
+     8e9:	68 0e 4e 00 00       	push   $0x4e0e
+     8ee:	6a 01                	push   $0x1
+     8f0:	e8 db 35 00 00       	call   3ed0 <printf>
+  unlink("sharedfd");
+     8f5:	c7 04 24 1d 4e 00 00 	movl   $0x4e1d,(%esp)
+     8fc:	e8 13 34 00 00       	call   3d14 <unlink>
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+     901:	5b                   	pop    %ebx
+     902:	5e                   	pop    %esi
+     903:	68 02 02 00 00       	push   $0x202
+     908:	68 1d 4e 00 00       	push   $0x4e1d
+     90d:	e8 f2 33 00 00       	call   3d04 <open>
+  if(fd < 0){
+     912:	83 c4 10             	add    $0x10,%esp
+     915:	85 c0                	test   %eax,%eax
+     917:	0f 88 2a 01 00 00    	js     a47 <sharedfd+0x167>
+     91d:	89 c7                	mov    %eax,%edi
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     91f:	8d 75 de             	lea    -0x22(%ebp),%esi
+     922:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+  pid = fork();
+     927:	e8 90 33 00 00       	call   3cbc <fork>
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     92c:	83 f8 01             	cmp    $0x1,%eax
+  pid = fork();
+     92f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+     932:	19 c0                	sbb    %eax,%eax
+     934:	83 ec 04             	sub    $0x4,%esp
+     937:	83 e0 f3             	and    $0xfffffff3,%eax
+     93a:	6a 0a                	push   $0xa
+     93c:	83 c0 70             	add    $0x70,%eax
+     93f:	50                   	push   %eax
+     940:	56                   	push   %esi
+     941:	e8 4a 30 00 00       	call   3990 <memset>
+     946:	83 c4 10             	add    $0x10,%esp
+     949:	eb 0a                	jmp    955 <sharedfd+0x75>
+     94b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     94f:	90                   	nop
+  for(i = 0; i < 1000; i++){
+     950:	83 eb 01             	sub    $0x1,%ebx
+     953:	74 26                	je     97b <sharedfd+0x9b>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+     955:	83 ec 04             	sub    $0x4,%esp
+     958:	6a 0a                	push   $0xa
+     95a:	56                   	push   %esi
+     95b:	57                   	push   %edi
+     95c:	e8 83 33 00 00       	call   3ce4 <write>
+     961:	83 c4 10             	add    $0x10,%esp
+     964:	83 f8 0a             	cmp    $0xa,%eax
+     967:	74 e7                	je     950 <sharedfd+0x70>
+      printf(1, "fstests: write sharedfd failed\n");
+     969:	83 ec 08             	sub    $0x8,%esp
+     96c:	68 e0 44 00 00       	push   $0x44e0
+     971:	6a 01                	push   $0x1
+     973:	e8 58 35 00 00       	call   3ed0 <printf>
+      break;
+     978:	83 c4 10             	add    $0x10,%esp
+  if(pid == 0)
+     97b:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     97e:	85 c9                	test   %ecx,%ecx
+     980:	0f 84 f5 00 00 00    	je     a7b <sharedfd+0x19b>
+    wait();
+     986:	e8 41 33 00 00       	call   3ccc <wait>
+  close(fd);
+     98b:	83 ec 0c             	sub    $0xc,%esp
+  nc = np = 0;
+     98e:	31 db                	xor    %ebx,%ebx
+  close(fd);
+     990:	57                   	push   %edi
+     991:	8d 7d e8             	lea    -0x18(%ebp),%edi
+     994:	e8 53 33 00 00       	call   3cec <close>
+  fd = open("sharedfd", 0);
+     999:	58                   	pop    %eax
+     99a:	5a                   	pop    %edx
+     99b:	6a 00                	push   $0x0
+     99d:	68 1d 4e 00 00       	push   $0x4e1d
+     9a2:	e8 5d 33 00 00       	call   3d04 <open>
+  if(fd < 0){
+     9a7:	83 c4 10             	add    $0x10,%esp
+  nc = np = 0;
+     9aa:	31 d2                	xor    %edx,%edx
+  fd = open("sharedfd", 0);
+     9ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if(fd < 0){
+     9af:	85 c0                	test   %eax,%eax
+     9b1:	0f 88 aa 00 00 00    	js     a61 <sharedfd+0x181>
+     9b7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     9be:	66 90                	xchg   %ax,%ax
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+     9c0:	83 ec 04             	sub    $0x4,%esp
+     9c3:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+     9c6:	6a 0a                	push   $0xa
+     9c8:	56                   	push   %esi
+     9c9:	ff 75 d0             	push   -0x30(%ebp)
+     9cc:	e8 0b 33 00 00       	call   3cdc <read>
+     9d1:	83 c4 10             	add    $0x10,%esp
+     9d4:	85 c0                	test   %eax,%eax
+     9d6:	7e 28                	jle    a00 <sharedfd+0x120>
+     9d8:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     9db:	89 f0                	mov    %esi,%eax
+     9dd:	eb 13                	jmp    9f2 <sharedfd+0x112>
+     9df:	90                   	nop
+        np++;
+     9e0:	80 f9 70             	cmp    $0x70,%cl
+     9e3:	0f 94 c1             	sete   %cl
+     9e6:	0f b6 c9             	movzbl %cl,%ecx
+     9e9:	01 cb                	add    %ecx,%ebx
+    for(i = 0; i < sizeof(buf); i++){
+     9eb:	83 c0 01             	add    $0x1,%eax
+     9ee:	39 f8                	cmp    %edi,%eax
+     9f0:	74 ce                	je     9c0 <sharedfd+0xe0>
+      if(buf[i] == 'c')
+     9f2:	0f b6 08             	movzbl (%eax),%ecx
+     9f5:	80 f9 63             	cmp    $0x63,%cl
+     9f8:	75 e6                	jne    9e0 <sharedfd+0x100>
+        nc++;
+     9fa:	83 c2 01             	add    $0x1,%edx
+      if(buf[i] == 'p')
+     9fd:	eb ec                	jmp    9eb <sharedfd+0x10b>
+     9ff:	90                   	nop
+  close(fd);
+     a00:	83 ec 0c             	sub    $0xc,%esp
+     a03:	ff 75 d0             	push   -0x30(%ebp)
+     a06:	e8 e1 32 00 00       	call   3cec <close>
+  unlink("sharedfd");
+     a0b:	c7 04 24 1d 4e 00 00 	movl   $0x4e1d,(%esp)
+     a12:	e8 fd 32 00 00       	call   3d14 <unlink>
+  if(nc == 10000 && np == 10000){
+     a17:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+     a1a:	83 c4 10             	add    $0x10,%esp
+     a1d:	81 fa 10 27 00 00    	cmp    $0x2710,%edx
+     a23:	75 5b                	jne    a80 <sharedfd+0x1a0>
+     a25:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+     a2b:	75 53                	jne    a80 <sharedfd+0x1a0>
+    printf(1, "sharedfd ok\n");
+     a2d:	83 ec 08             	sub    $0x8,%esp
+     a30:	68 26 4e 00 00       	push   $0x4e26
+     a35:	6a 01                	push   $0x1
+     a37:	e8 94 34 00 00       	call   3ed0 <printf>
+     a3c:	83 c4 10             	add    $0x10,%esp
+}
+     a3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a42:	5b                   	pop    %ebx
+     a43:	5e                   	pop    %esi
+     a44:	5f                   	pop    %edi
+     a45:	5d                   	pop    %ebp
+     a46:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for writing");
+     a47:	83 ec 08             	sub    $0x8,%esp
+     a4a:	68 b4 44 00 00       	push   $0x44b4
+     a4f:	6a 01                	push   $0x1
+     a51:	e8 7a 34 00 00       	call   3ed0 <printf>
+    return;
+     a56:	83 c4 10             	add    $0x10,%esp
+}
+     a59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a5c:	5b                   	pop    %ebx
+     a5d:	5e                   	pop    %esi
+     a5e:	5f                   	pop    %edi
+     a5f:	5d                   	pop    %ebp
+     a60:	c3                   	ret
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+     a61:	83 ec 08             	sub    $0x8,%esp
+     a64:	68 00 45 00 00       	push   $0x4500
+     a69:	6a 01                	push   $0x1
+     a6b:	e8 60 34 00 00       	call   3ed0 <printf>
+    return;
+     a70:	83 c4 10             	add    $0x10,%esp
+}
+     a73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     a76:	5b                   	pop    %ebx
+     a77:	5e                   	pop    %esi
+     a78:	5f                   	pop    %edi
+     a79:	5d                   	pop    %ebp
+     a7a:	c3                   	ret
+    exit();
+     a7b:	e8 44 32 00 00       	call   3cc4 <exit>
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+     a80:	53                   	push   %ebx
+     a81:	52                   	push   %edx
+     a82:	68 33 4e 00 00       	push   $0x4e33
+     a87:	6a 01                	push   $0x1
+     a89:	e8 42 34 00 00       	call   3ed0 <printf>
+    exit();
+     a8e:	e8 31 32 00 00       	call   3cc4 <exit>
+     a93:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     a9a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000aa0 <fourfiles>:
+{
+     aa0:	55                   	push   %ebp
+     aa1:	89 e5                	mov    %esp,%ebp
+     aa3:	57                   	push   %edi
+     aa4:	56                   	push   %esi
+     aa5:	53                   	push   %ebx
+  for(pi = 0; pi < 4; pi++){
+     aa6:	31 db                	xor    %ebx,%ebx
+{
+     aa8:	83 ec 34             	sub    $0x34,%esp
+  char *names[] = { "f0", "f1", "f2", "f3" };
+     aab:	c7 45 d8 48 4e 00 00 	movl   $0x4e48,-0x28(%ebp)
+     ab2:	c7 45 dc fe 56 00 00 	movl   $0x56fe,-0x24(%ebp)
+     ab9:	c7 45 e0 02 57 00 00 	movl   $0x5702,-0x20(%ebp)
+     ac0:	c7 45 e4 4b 4e 00 00 	movl   $0x4e4b,-0x1c(%ebp)
+  printf(1, "fourfiles test\n");
+     ac7:	68 4e 4e 00 00       	push   $0x4e4e
+     acc:	6a 01                	push   $0x1
+     ace:	e8 fd 33 00 00       	call   3ed0 <printf>
+     ad3:	83 c4 10             	add    $0x10,%esp
+    fname = names[pi];
+     ad6:	8b 74 9d d8          	mov    -0x28(%ebp,%ebx,4),%esi
+    unlink(fname);
+     ada:	83 ec 0c             	sub    $0xc,%esp
+     add:	56                   	push   %esi
+     ade:	e8 31 32 00 00       	call   3d14 <unlink>
+    pid = fork();
+     ae3:	e8 d4 31 00 00       	call   3cbc <fork>
+    if(pid < 0){
+     ae8:	83 c4 10             	add    $0x10,%esp
+     aeb:	85 c0                	test   %eax,%eax
+     aed:	0f 88 7d 01 00 00    	js     c70 <fourfiles+0x1d0>
+    if(pid == 0){
+     af3:	0f 84 03 01 00 00    	je     bfc <fourfiles+0x15c>
+  for(pi = 0; pi < 4; pi++){
+     af9:	83 c3 01             	add    $0x1,%ebx
+     afc:	83 fb 04             	cmp    $0x4,%ebx
+     aff:	75 d5                	jne    ad6 <fourfiles+0x36>
+    wait();
+     b01:	e8 c6 31 00 00       	call   3ccc <wait>
+  for(i = 0; i < 2; i++){
+     b06:	31 f6                	xor    %esi,%esi
+    wait();
+     b08:	e8 bf 31 00 00       	call   3ccc <wait>
+     b0d:	e8 ba 31 00 00       	call   3ccc <wait>
+     b12:	e8 b5 31 00 00       	call   3ccc <wait>
+    fname = names[i];
+     b17:	8b 5c b5 d8          	mov    -0x28(%ebp,%esi,4),%ebx
+    fd = open(fname, 0);
+     b1b:	83 ec 08             	sub    $0x8,%esp
+    total = 0;
+     b1e:	31 ff                	xor    %edi,%edi
+    fd = open(fname, 0);
+     b20:	6a 00                	push   $0x0
+     b22:	53                   	push   %ebx
+     b23:	e8 dc 31 00 00       	call   3d04 <open>
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+     b28:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+     b2b:	83 c4 10             	add    $0x10,%esp
+     b2e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     b31:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b38:	83 ec 04             	sub    $0x4,%esp
+     b3b:	68 00 20 00 00       	push   $0x2000
+     b40:	68 00 90 00 00       	push   $0x9000
+     b45:	ff 75 d4             	push   -0x2c(%ebp)
+     b48:	e8 8f 31 00 00       	call   3cdc <read>
+     b4d:	83 c4 10             	add    $0x10,%esp
+     b50:	89 c3                	mov    %eax,%ebx
+     b52:	85 c0                	test   %eax,%eax
+     b54:	7e 28                	jle    b7e <fourfiles+0xde>
+      for(j = 0; j < n; j++){
+     b56:	31 c0                	xor    %eax,%eax
+     b58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     b5f:	90                   	nop
+        if(buf[j] != '0'+i){
+     b60:	83 fe 01             	cmp    $0x1,%esi
+     b63:	0f be 88 00 90 00 00 	movsbl 0x9000(%eax),%ecx
+     b6a:	19 d2                	sbb    %edx,%edx
+     b6c:	83 c2 31             	add    $0x31,%edx
+     b6f:	39 d1                	cmp    %edx,%ecx
+     b71:	75 75                	jne    be8 <fourfiles+0x148>
+      for(j = 0; j < n; j++){
+     b73:	83 c0 01             	add    $0x1,%eax
+     b76:	39 c3                	cmp    %eax,%ebx
+     b78:	75 e6                	jne    b60 <fourfiles+0xc0>
+      total += n;
+     b7a:	01 df                	add    %ebx,%edi
+     b7c:	eb ba                	jmp    b38 <fourfiles+0x98>
+    close(fd);
+     b7e:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+     b81:	83 ec 0c             	sub    $0xc,%esp
+     b84:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+     b87:	51                   	push   %ecx
+     b88:	e8 5f 31 00 00       	call   3cec <close>
+    if(total != 12*500){
+     b8d:	83 c4 10             	add    $0x10,%esp
+     b90:	81 ff 70 17 00 00    	cmp    $0x1770,%edi
+     b96:	0f 85 e8 00 00 00    	jne    c84 <fourfiles+0x1e4>
+    unlink(fname);
+     b9c:	83 ec 0c             	sub    $0xc,%esp
+     b9f:	53                   	push   %ebx
+     ba0:	e8 6f 31 00 00       	call   3d14 <unlink>
+  for(i = 0; i < 2; i++){
+     ba5:	83 c4 10             	add    $0x10,%esp
+     ba8:	85 f6                	test   %esi,%esi
+     baa:	75 0a                	jne    bb6 <fourfiles+0x116>
+     bac:	be 01 00 00 00       	mov    $0x1,%esi
+     bb1:	e9 61 ff ff ff       	jmp    b17 <fourfiles+0x77>
+    unlink(names[i]);
+     bb6:	83 ec 0c             	sub    $0xc,%esp
+     bb9:	68 02 57 00 00       	push   $0x5702
+     bbe:	e8 51 31 00 00       	call   3d14 <unlink>
+     bc3:	c7 04 24 4b 4e 00 00 	movl   $0x4e4b,(%esp)
+     bca:	e8 45 31 00 00       	call   3d14 <unlink>
+  printf(1, "fourfiles ok\n");
+     bcf:	58                   	pop    %eax
+     bd0:	5a                   	pop    %edx
+     bd1:	68 8c 4e 00 00       	push   $0x4e8c
+     bd6:	6a 01                	push   $0x1
+     bd8:	e8 f3 32 00 00       	call   3ed0 <printf>
+}
+     bdd:	83 c4 10             	add    $0x10,%esp
+     be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     be3:	5b                   	pop    %ebx
+     be4:	5e                   	pop    %esi
+     be5:	5f                   	pop    %edi
+     be6:	5d                   	pop    %ebp
+     be7:	c3                   	ret
+          printf(1, "wrong char\n");
+     be8:	83 ec 08             	sub    $0x8,%esp
+     beb:	68 6f 4e 00 00       	push   $0x4e6f
+     bf0:	6a 01                	push   $0x1
+     bf2:	e8 d9 32 00 00       	call   3ed0 <printf>
+          exit();
+     bf7:	e8 c8 30 00 00       	call   3cc4 <exit>
+      fd = open(fname, O_CREATE | O_RDWR);
+     bfc:	83 ec 08             	sub    $0x8,%esp
+     bff:	68 02 02 00 00       	push   $0x202
+     c04:	56                   	push   %esi
+     c05:	e8 fa 30 00 00       	call   3d04 <open>
+      if(fd < 0){
+     c0a:	83 c4 10             	add    $0x10,%esp
+      fd = open(fname, O_CREATE | O_RDWR);
+     c0d:	89 c6                	mov    %eax,%esi
+      if(fd < 0){
+     c0f:	85 c0                	test   %eax,%eax
+     c11:	78 45                	js     c58 <fourfiles+0x1b8>
+      memset(buf, '0'+pi, 512);
+     c13:	83 ec 04             	sub    $0x4,%esp
+     c16:	83 c3 30             	add    $0x30,%ebx
+     c19:	68 00 02 00 00       	push   $0x200
+     c1e:	53                   	push   %ebx
+     c1f:	bb 0c 00 00 00       	mov    $0xc,%ebx
+     c24:	68 00 90 00 00       	push   $0x9000
+     c29:	e8 62 2d 00 00       	call   3990 <memset>
+     c2e:	83 c4 10             	add    $0x10,%esp
+        if((n = write(fd, buf, 500)) != 500){
+     c31:	83 ec 04             	sub    $0x4,%esp
+     c34:	68 f4 01 00 00       	push   $0x1f4
+     c39:	68 00 90 00 00       	push   $0x9000
+     c3e:	56                   	push   %esi
+     c3f:	e8 a0 30 00 00       	call   3ce4 <write>
+     c44:	83 c4 10             	add    $0x10,%esp
+     c47:	3d f4 01 00 00       	cmp    $0x1f4,%eax
+     c4c:	75 49                	jne    c97 <fourfiles+0x1f7>
+      for(i = 0; i < 12; i++){
+     c4e:	83 eb 01             	sub    $0x1,%ebx
+     c51:	75 de                	jne    c31 <fourfiles+0x191>
+      exit();
+     c53:	e8 6c 30 00 00       	call   3cc4 <exit>
+        printf(1, "create failed\n");
+     c58:	56                   	push   %esi
+     c59:	56                   	push   %esi
+     c5a:	68 59 53 00 00       	push   $0x5359
+     c5f:	6a 01                	push   $0x1
+     c61:	e8 6a 32 00 00       	call   3ed0 <printf>
+        exit();
+     c66:	e8 59 30 00 00       	call   3cc4 <exit>
+     c6b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     c6f:	90                   	nop
+      printf(1, "fork failed\n");
+     c70:	83 ec 08             	sub    $0x8,%esp
+     c73:	68 81 5b 00 00       	push   $0x5b81
+     c78:	6a 01                	push   $0x1
+     c7a:	e8 51 32 00 00       	call   3ed0 <printf>
+      exit();
+     c7f:	e8 40 30 00 00       	call   3cc4 <exit>
+      printf(1, "wrong length %d\n", total);
+     c84:	51                   	push   %ecx
+     c85:	57                   	push   %edi
+     c86:	68 7b 4e 00 00       	push   $0x4e7b
+     c8b:	6a 01                	push   $0x1
+     c8d:	e8 3e 32 00 00       	call   3ed0 <printf>
+      exit();
+     c92:	e8 2d 30 00 00       	call   3cc4 <exit>
+          printf(1, "write failed %d\n", n);
+     c97:	53                   	push   %ebx
+     c98:	50                   	push   %eax
+     c99:	68 5e 4e 00 00       	push   $0x4e5e
+     c9e:	6a 01                	push   $0x1
+     ca0:	e8 2b 32 00 00       	call   3ed0 <printf>
+          exit();
+     ca5:	e8 1a 30 00 00       	call   3cc4 <exit>
+     caa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000cb0 <bigfile>:
+{
+     cb0:	55                   	push   %ebp
+     cb1:	89 e5                	mov    %esp,%ebp
+     cb3:	57                   	push   %edi
+     cb4:	56                   	push   %esi
+     cb5:	53                   	push   %ebx
+     cb6:	83 ec 14             	sub    $0x14,%esp
+  printf(1, "bigfile test\n");
+     cb9:	68 9a 4e 00 00       	push   $0x4e9a
+     cbe:	6a 01                	push   $0x1
+     cc0:	e8 0b 32 00 00       	call   3ed0 <printf>
+  unlink("bigfile");
+     cc5:	c7 04 24 b6 4e 00 00 	movl   $0x4eb6,(%esp)
+     ccc:	e8 43 30 00 00       	call   3d14 <unlink>
+  fd = open("bigfile", O_CREATE | O_RDWR);
+     cd1:	58                   	pop    %eax
+     cd2:	5a                   	pop    %edx
+     cd3:	68 02 02 00 00       	push   $0x202
+     cd8:	68 b6 4e 00 00       	push   $0x4eb6
+     cdd:	e8 22 30 00 00       	call   3d04 <open>
+  if(fd < 0){
+     ce2:	83 c4 10             	add    $0x10,%esp
+     ce5:	85 c0                	test   %eax,%eax
+     ce7:	0f 88 5e 01 00 00    	js     e4b <bigfile+0x19b>
+     ced:	89 c6                	mov    %eax,%esi
+  for(i = 0; i < 20; i++){
+     cef:	31 db                	xor    %ebx,%ebx
+     cf1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    memset(buf, i, 600);
+     cf8:	83 ec 04             	sub    $0x4,%esp
+     cfb:	68 58 02 00 00       	push   $0x258
+     d00:	53                   	push   %ebx
+     d01:	68 00 90 00 00       	push   $0x9000
+     d06:	e8 85 2c 00 00       	call   3990 <memset>
+    if(write(fd, buf, 600) != 600){
+     d0b:	83 c4 0c             	add    $0xc,%esp
+     d0e:	68 58 02 00 00       	push   $0x258
+     d13:	68 00 90 00 00       	push   $0x9000
+     d18:	56                   	push   %esi
+     d19:	e8 c6 2f 00 00       	call   3ce4 <write>
+     d1e:	83 c4 10             	add    $0x10,%esp
+     d21:	3d 58 02 00 00       	cmp    $0x258,%eax
+     d26:	0f 85 f8 00 00 00    	jne    e24 <bigfile+0x174>
+  for(i = 0; i < 20; i++){
+     d2c:	83 c3 01             	add    $0x1,%ebx
+     d2f:	83 fb 14             	cmp    $0x14,%ebx
+     d32:	75 c4                	jne    cf8 <bigfile+0x48>
+  close(fd);
+     d34:	83 ec 0c             	sub    $0xc,%esp
+     d37:	56                   	push   %esi
+     d38:	e8 af 2f 00 00       	call   3cec <close>
+  fd = open("bigfile", 0);
+     d3d:	5e                   	pop    %esi
+     d3e:	5f                   	pop    %edi
+     d3f:	6a 00                	push   $0x0
+     d41:	68 b6 4e 00 00       	push   $0x4eb6
+     d46:	e8 b9 2f 00 00       	call   3d04 <open>
+  if(fd < 0){
+     d4b:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", 0);
+     d4e:	89 c6                	mov    %eax,%esi
+  if(fd < 0){
+     d50:	85 c0                	test   %eax,%eax
+     d52:	0f 88 e0 00 00 00    	js     e38 <bigfile+0x188>
+  total = 0;
+     d58:	31 db                	xor    %ebx,%ebx
+  for(i = 0; ; i++){
+     d5a:	31 ff                	xor    %edi,%edi
+     d5c:	eb 30                	jmp    d8e <bigfile+0xde>
+     d5e:	66 90                	xchg   %ax,%ax
+    if(cc != 300){
+     d60:	3d 2c 01 00 00       	cmp    $0x12c,%eax
+     d65:	0f 85 91 00 00 00    	jne    dfc <bigfile+0x14c>
+    if(buf[0] != i/2 || buf[299] != i/2){
+     d6b:	89 fa                	mov    %edi,%edx
+     d6d:	0f be 05 00 90 00 00 	movsbl 0x9000,%eax
+     d74:	d1 fa                	sar    %edx
+     d76:	39 d0                	cmp    %edx,%eax
+     d78:	75 6e                	jne    de8 <bigfile+0x138>
+     d7a:	0f be 15 2b 91 00 00 	movsbl 0x912b,%edx
+     d81:	39 d0                	cmp    %edx,%eax
+     d83:	75 63                	jne    de8 <bigfile+0x138>
+    total += cc;
+     d85:	81 c3 2c 01 00 00    	add    $0x12c,%ebx
+  for(i = 0; ; i++){
+     d8b:	83 c7 01             	add    $0x1,%edi
+    cc = read(fd, buf, 300);
+     d8e:	83 ec 04             	sub    $0x4,%esp
+     d91:	68 2c 01 00 00       	push   $0x12c
+     d96:	68 00 90 00 00       	push   $0x9000
+     d9b:	56                   	push   %esi
+     d9c:	e8 3b 2f 00 00       	call   3cdc <read>
+    if(cc < 0){
+     da1:	83 c4 10             	add    $0x10,%esp
+     da4:	85 c0                	test   %eax,%eax
+     da6:	78 68                	js     e10 <bigfile+0x160>
+    if(cc == 0)
+     da8:	75 b6                	jne    d60 <bigfile+0xb0>
+  close(fd);
+     daa:	83 ec 0c             	sub    $0xc,%esp
+     dad:	56                   	push   %esi
+     dae:	e8 39 2f 00 00       	call   3cec <close>
+  if(total != 20*600){
+     db3:	83 c4 10             	add    $0x10,%esp
+     db6:	81 fb e0 2e 00 00    	cmp    $0x2ee0,%ebx
+     dbc:	0f 85 9c 00 00 00    	jne    e5e <bigfile+0x1ae>
+  unlink("bigfile");
+     dc2:	83 ec 0c             	sub    $0xc,%esp
+     dc5:	68 b6 4e 00 00       	push   $0x4eb6
+     dca:	e8 45 2f 00 00       	call   3d14 <unlink>
+  printf(1, "bigfile test ok\n");
+     dcf:	58                   	pop    %eax
+     dd0:	5a                   	pop    %edx
+     dd1:	68 45 4f 00 00       	push   $0x4f45
+     dd6:	6a 01                	push   $0x1
+     dd8:	e8 f3 30 00 00       	call   3ed0 <printf>
+}
+     ddd:	83 c4 10             	add    $0x10,%esp
+     de0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+     de3:	5b                   	pop    %ebx
+     de4:	5e                   	pop    %esi
+     de5:	5f                   	pop    %edi
+     de6:	5d                   	pop    %ebp
+     de7:	c3                   	ret
+      printf(1, "read bigfile wrong data\n");
+     de8:	83 ec 08             	sub    $0x8,%esp
+     deb:	68 12 4f 00 00       	push   $0x4f12
+     df0:	6a 01                	push   $0x1
+     df2:	e8 d9 30 00 00       	call   3ed0 <printf>
+      exit();
+     df7:	e8 c8 2e 00 00       	call   3cc4 <exit>
+      printf(1, "short read bigfile\n");
+     dfc:	83 ec 08             	sub    $0x8,%esp
+     dff:	68 fe 4e 00 00       	push   $0x4efe
+     e04:	6a 01                	push   $0x1
+     e06:	e8 c5 30 00 00       	call   3ed0 <printf>
+      exit();
+     e0b:	e8 b4 2e 00 00       	call   3cc4 <exit>
+      printf(1, "read bigfile failed\n");
+     e10:	83 ec 08             	sub    $0x8,%esp
+     e13:	68 e9 4e 00 00       	push   $0x4ee9
+     e18:	6a 01                	push   $0x1
+     e1a:	e8 b1 30 00 00       	call   3ed0 <printf>
+      exit();
+     e1f:	e8 a0 2e 00 00       	call   3cc4 <exit>
+      printf(1, "write bigfile failed\n");
+     e24:	83 ec 08             	sub    $0x8,%esp
+     e27:	68 be 4e 00 00       	push   $0x4ebe
+     e2c:	6a 01                	push   $0x1
+     e2e:	e8 9d 30 00 00       	call   3ed0 <printf>
+      exit();
+     e33:	e8 8c 2e 00 00       	call   3cc4 <exit>
+    printf(1, "cannot open bigfile\n");
+     e38:	53                   	push   %ebx
+     e39:	53                   	push   %ebx
+     e3a:	68 d4 4e 00 00       	push   $0x4ed4
+     e3f:	6a 01                	push   $0x1
+     e41:	e8 8a 30 00 00       	call   3ed0 <printf>
+    exit();
+     e46:	e8 79 2e 00 00       	call   3cc4 <exit>
+    printf(1, "cannot create bigfile");
+     e4b:	50                   	push   %eax
+     e4c:	50                   	push   %eax
+     e4d:	68 a8 4e 00 00       	push   $0x4ea8
+     e52:	6a 01                	push   $0x1
+     e54:	e8 77 30 00 00       	call   3ed0 <printf>
+    exit();
+     e59:	e8 66 2e 00 00       	call   3cc4 <exit>
+    printf(1, "read bigfile wrong total\n");
+     e5e:	51                   	push   %ecx
+     e5f:	51                   	push   %ecx
+     e60:	68 2b 4f 00 00       	push   $0x4f2b
+     e65:	6a 01                	push   $0x1
+     e67:	e8 64 30 00 00       	call   3ed0 <printf>
+    exit();
+     e6c:	e8 53 2e 00 00       	call   3cc4 <exit>
+     e71:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e78:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     e7f:	90                   	nop
+
+00000e80 <concreate>:
+{
+     e80:	55                   	push   %ebp
+     e81:	89 e5                	mov    %esp,%ebp
+     e83:	57                   	push   %edi
+     e84:	56                   	push   %esi
+  for(i = 0; i < 40; i++){
+     e85:	31 f6                	xor    %esi,%esi
+{
+     e87:	53                   	push   %ebx
+     e88:	8d 5d ad             	lea    -0x53(%ebp),%ebx
+     e8b:	83 ec 64             	sub    $0x64,%esp
+  printf(1, "concreate test\n");
+     e8e:	68 56 4f 00 00       	push   $0x4f56
+     e93:	6a 01                	push   $0x1
+     e95:	e8 36 30 00 00       	call   3ed0 <printf>
+  file[0] = 'C';
+     e9a:	c6 45 ad 43          	movb   $0x43,-0x53(%ebp)
+  file[2] = '\0';
+     e9e:	83 c4 10             	add    $0x10,%esp
+     ea1:	c6 45 af 00          	movb   $0x0,-0x51(%ebp)
+  for(i = 0; i < 40; i++){
+     ea5:	eb 48                	jmp    eef <concreate+0x6f>
+     ea7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+     eae:	66 90                	xchg   %ax,%ax
+     eb0:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+    if(pid && (i % 3) == 1){
+     eb6:	3d ab aa aa aa       	cmp    $0xaaaaaaab,%eax
+     ebb:	0f 83 8f 00 00 00    	jae    f50 <concreate+0xd0>
+      fd = open(file, O_CREATE | O_RDWR);
+     ec1:	83 ec 08             	sub    $0x8,%esp
+     ec4:	68 02 02 00 00       	push   $0x202
+     ec9:	53                   	push   %ebx
+     eca:	e8 35 2e 00 00       	call   3d04 <open>
+      if(fd < 0){
+     ecf:	83 c4 10             	add    $0x10,%esp
+     ed2:	85 c0                	test   %eax,%eax
+     ed4:	78 5f                	js     f35 <concreate+0xb5>
+      close(fd);
+     ed6:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 40; i++){
+     ed9:	83 c6 01             	add    $0x1,%esi
+      close(fd);
+     edc:	50                   	push   %eax
+     edd:	e8 0a 2e 00 00       	call   3cec <close>
+     ee2:	83 c4 10             	add    $0x10,%esp
+      wait();
+     ee5:	e8 e2 2d 00 00       	call   3ccc <wait>
+  for(i = 0; i < 40; i++){
+     eea:	83 fe 28             	cmp    $0x28,%esi
+     eed:	74 7f                	je     f6e <concreate+0xee>
+    unlink(file);
+     eef:	83 ec 0c             	sub    $0xc,%esp
+    file[1] = '0' + i;
+     ef2:	8d 46 30             	lea    0x30(%esi),%eax
+     ef5:	88 45 ae             	mov    %al,-0x52(%ebp)
+    unlink(file);
+     ef8:	53                   	push   %ebx
+     ef9:	e8 16 2e 00 00       	call   3d14 <unlink>
+    pid = fork();
+     efe:	e8 b9 2d 00 00       	call   3cbc <fork>
+    if(pid && (i % 3) == 1){
+     f03:	83 c4 10             	add    $0x10,%esp
+     f06:	85 c0                	test   %eax,%eax
+     f08:	75 a6                	jne    eb0 <concreate+0x30>
+      link("C0", file);
+     f0a:	69 f6 cd cc cc cc    	imul   $0xcccccccd,%esi,%esi
+    } else if(pid == 0 && (i % 5) == 1){
+     f10:	81 fe cd cc cc cc    	cmp    $0xcccccccd,%esi
+     f16:	0f 83 d4 00 00 00    	jae    ff0 <concreate+0x170>
+      fd = open(file, O_CREATE | O_RDWR);
+     f1c:	83 ec 08             	sub    $0x8,%esp
+     f1f:	68 02 02 00 00       	push   $0x202
+     f24:	53                   	push   %ebx
+     f25:	e8 da 2d 00 00       	call   3d04 <open>
+      if(fd < 0){
+     f2a:	83 c4 10             	add    $0x10,%esp
+     f2d:	85 c0                	test   %eax,%eax
+     f2f:	0f 89 ee 01 00 00    	jns    1123 <concreate+0x2a3>
+        printf(1, "concreate create %s failed\n", file);
+     f35:	83 ec 04             	sub    $0x4,%esp
+     f38:	53                   	push   %ebx
+     f39:	68 69 4f 00 00       	push   $0x4f69
+     f3e:	6a 01                	push   $0x1
+     f40:	e8 8b 2f 00 00       	call   3ed0 <printf>
+        exit();
+     f45:	e8 7a 2d 00 00       	call   3cc4 <exit>
+     f4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      link("C0", file);
+     f50:	83 ec 08             	sub    $0x8,%esp
+  for(i = 0; i < 40; i++){
+     f53:	83 c6 01             	add    $0x1,%esi
+      link("C0", file);
+     f56:	53                   	push   %ebx
+     f57:	68 66 4f 00 00       	push   $0x4f66
+     f5c:	e8 c3 2d 00 00       	call   3d24 <link>
+     f61:	83 c4 10             	add    $0x10,%esp
+      wait();
+     f64:	e8 63 2d 00 00       	call   3ccc <wait>
+  for(i = 0; i < 40; i++){
+     f69:	83 fe 28             	cmp    $0x28,%esi
+     f6c:	75 81                	jne    eef <concreate+0x6f>
+  memset(fa, 0, sizeof(fa));
+     f6e:	83 ec 04             	sub    $0x4,%esp
+     f71:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     f74:	6a 28                	push   $0x28
+     f76:	6a 00                	push   $0x0
+     f78:	50                   	push   %eax
+     f79:	e8 12 2a 00 00       	call   3990 <memset>
+  fd = open(".", 0);
+     f7e:	5e                   	pop    %esi
+     f7f:	5f                   	pop    %edi
+     f80:	6a 00                	push   $0x0
+     f82:	68 19 51 00 00       	push   $0x5119
+     f87:	8d 7d b0             	lea    -0x50(%ebp),%edi
+     f8a:	e8 75 2d 00 00       	call   3d04 <open>
+  n = 0;
+     f8f:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+     f96:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+     f99:	89 c6                	mov    %eax,%esi
+  while(read(fd, &de, sizeof(de)) > 0){
+     f9b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+     f9f:	90                   	nop
+     fa0:	83 ec 04             	sub    $0x4,%esp
+     fa3:	6a 10                	push   $0x10
+     fa5:	57                   	push   %edi
+     fa6:	56                   	push   %esi
+     fa7:	e8 30 2d 00 00       	call   3cdc <read>
+     fac:	83 c4 10             	add    $0x10,%esp
+     faf:	85 c0                	test   %eax,%eax
+     fb1:	7e 5d                	jle    1010 <concreate+0x190>
+    if(de.inum == 0)
+     fb3:	66 83 7d b0 00       	cmpw   $0x0,-0x50(%ebp)
+     fb8:	74 e6                	je     fa0 <concreate+0x120>
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+     fba:	80 7d b2 43          	cmpb   $0x43,-0x4e(%ebp)
+     fbe:	75 e0                	jne    fa0 <concreate+0x120>
+     fc0:	80 7d b4 00          	cmpb   $0x0,-0x4c(%ebp)
+     fc4:	75 da                	jne    fa0 <concreate+0x120>
+      i = de.name[1] - '0';
+     fc6:	0f be 45 b3          	movsbl -0x4d(%ebp),%eax
+     fca:	83 e8 30             	sub    $0x30,%eax
+      if(i < 0 || i >= sizeof(fa)){
+     fcd:	83 f8 27             	cmp    $0x27,%eax
+     fd0:	0f 87 5e 01 00 00    	ja     1134 <concreate+0x2b4>
+      if(fa[i]){
+     fd6:	80 7c 05 c0 00       	cmpb   $0x0,-0x40(%ebp,%eax,1)
+     fdb:	0f 85 7e 01 00 00    	jne    115f <concreate+0x2df>
+      n++;
+     fe1:	83 45 a4 01          	addl   $0x1,-0x5c(%ebp)
+      fa[i] = 1;
+     fe5:	c6 44 05 c0 01       	movb   $0x1,-0x40(%ebp,%eax,1)
+      n++;
+     fea:	eb b4                	jmp    fa0 <concreate+0x120>
+     fec:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      link("C0", file);
+     ff0:	83 ec 08             	sub    $0x8,%esp
+     ff3:	53                   	push   %ebx
+     ff4:	68 66 4f 00 00       	push   $0x4f66
+     ff9:	e8 26 2d 00 00       	call   3d24 <link>
+     ffe:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1001:	e8 be 2c 00 00       	call   3cc4 <exit>
+    1006:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    100d:	8d 76 00             	lea    0x0(%esi),%esi
+  close(fd);
+    1010:	83 ec 0c             	sub    $0xc,%esp
+    1013:	56                   	push   %esi
+    1014:	e8 d3 2c 00 00       	call   3cec <close>
+  if(n != 40){
+    1019:	83 c4 10             	add    $0x10,%esp
+    101c:	83 7d a4 28          	cmpl   $0x28,-0x5c(%ebp)
+    1020:	0f 85 26 01 00 00    	jne    114c <concreate+0x2cc>
+  for(i = 0; i < 40; i++){
+    1026:	31 f6                	xor    %esi,%esi
+    1028:	eb 48                	jmp    1072 <concreate+0x1f2>
+    102a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+       ((i % 3) == 1 && pid != 0)){
+    1030:	85 ff                	test   %edi,%edi
+    1032:	74 05                	je     1039 <concreate+0x1b9>
+    1034:	83 f8 01             	cmp    $0x1,%eax
+    1037:	74 68                	je     10a1 <concreate+0x221>
+      unlink(file);
+    1039:	83 ec 0c             	sub    $0xc,%esp
+    103c:	53                   	push   %ebx
+    103d:	e8 d2 2c 00 00       	call   3d14 <unlink>
+      unlink(file);
+    1042:	89 1c 24             	mov    %ebx,(%esp)
+    1045:	e8 ca 2c 00 00       	call   3d14 <unlink>
+      unlink(file);
+    104a:	89 1c 24             	mov    %ebx,(%esp)
+    104d:	e8 c2 2c 00 00       	call   3d14 <unlink>
+      unlink(file);
+    1052:	89 1c 24             	mov    %ebx,(%esp)
+    1055:	e8 ba 2c 00 00       	call   3d14 <unlink>
+    105a:	83 c4 10             	add    $0x10,%esp
+    if(pid == 0)
+    105d:	85 ff                	test   %edi,%edi
+    105f:	74 a0                	je     1001 <concreate+0x181>
+      wait();
+    1061:	e8 66 2c 00 00       	call   3ccc <wait>
+  for(i = 0; i < 40; i++){
+    1066:	83 c6 01             	add    $0x1,%esi
+    1069:	83 fe 28             	cmp    $0x28,%esi
+    106c:	0f 84 86 00 00 00    	je     10f8 <concreate+0x278>
+    file[1] = '0' + i;
+    1072:	8d 46 30             	lea    0x30(%esi),%eax
+    1075:	88 45 ae             	mov    %al,-0x52(%ebp)
+    pid = fork();
+    1078:	e8 3f 2c 00 00       	call   3cbc <fork>
+    107d:	89 c7                	mov    %eax,%edi
+    if(pid < 0){
+    107f:	85 c0                	test   %eax,%eax
+    1081:	0f 88 88 00 00 00    	js     110f <concreate+0x28f>
+    if(((i % 3) == 0 && pid == 0) ||
+    1087:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+    108c:	f7 e6                	mul    %esi
+    108e:	89 d0                	mov    %edx,%eax
+    1090:	83 e2 fe             	and    $0xfffffffe,%edx
+    1093:	d1 e8                	shr    %eax
+    1095:	01 c2                	add    %eax,%edx
+    1097:	89 f0                	mov    %esi,%eax
+    1099:	29 d0                	sub    %edx,%eax
+    109b:	89 c1                	mov    %eax,%ecx
+    109d:	09 f9                	or     %edi,%ecx
+    109f:	75 8f                	jne    1030 <concreate+0x1b0>
+      close(open(file, 0));
+    10a1:	83 ec 08             	sub    $0x8,%esp
+    10a4:	6a 00                	push   $0x0
+    10a6:	53                   	push   %ebx
+    10a7:	e8 58 2c 00 00       	call   3d04 <open>
+    10ac:	89 04 24             	mov    %eax,(%esp)
+    10af:	e8 38 2c 00 00       	call   3cec <close>
+      close(open(file, 0));
+    10b4:	58                   	pop    %eax
+    10b5:	5a                   	pop    %edx
+    10b6:	6a 00                	push   $0x0
+    10b8:	53                   	push   %ebx
+    10b9:	e8 46 2c 00 00       	call   3d04 <open>
+    10be:	89 04 24             	mov    %eax,(%esp)
+    10c1:	e8 26 2c 00 00       	call   3cec <close>
+      close(open(file, 0));
+    10c6:	59                   	pop    %ecx
+    10c7:	58                   	pop    %eax
+    10c8:	6a 00                	push   $0x0
+    10ca:	53                   	push   %ebx
+    10cb:	e8 34 2c 00 00       	call   3d04 <open>
+    10d0:	89 04 24             	mov    %eax,(%esp)
+    10d3:	e8 14 2c 00 00       	call   3cec <close>
+      close(open(file, 0));
+    10d8:	58                   	pop    %eax
+    10d9:	5a                   	pop    %edx
+    10da:	6a 00                	push   $0x0
+    10dc:	53                   	push   %ebx
+    10dd:	e8 22 2c 00 00       	call   3d04 <open>
+    10e2:	89 04 24             	mov    %eax,(%esp)
+    10e5:	e8 02 2c 00 00       	call   3cec <close>
+    10ea:	83 c4 10             	add    $0x10,%esp
+    10ed:	e9 6b ff ff ff       	jmp    105d <concreate+0x1dd>
+    10f2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  printf(1, "concreate ok\n");
+    10f8:	83 ec 08             	sub    $0x8,%esp
+    10fb:	68 bb 4f 00 00       	push   $0x4fbb
+    1100:	6a 01                	push   $0x1
+    1102:	e8 c9 2d 00 00       	call   3ed0 <printf>
+}
+    1107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    110a:	5b                   	pop    %ebx
+    110b:	5e                   	pop    %esi
+    110c:	5f                   	pop    %edi
+    110d:	5d                   	pop    %ebp
+    110e:	c3                   	ret
+      printf(1, "fork failed\n");
+    110f:	83 ec 08             	sub    $0x8,%esp
+    1112:	68 81 5b 00 00       	push   $0x5b81
+    1117:	6a 01                	push   $0x1
+    1119:	e8 b2 2d 00 00       	call   3ed0 <printf>
+      exit();
+    111e:	e8 a1 2b 00 00       	call   3cc4 <exit>
+      close(fd);
+    1123:	83 ec 0c             	sub    $0xc,%esp
+    1126:	50                   	push   %eax
+    1127:	e8 c0 2b 00 00       	call   3cec <close>
+    112c:	83 c4 10             	add    $0x10,%esp
+    112f:	e9 cd fe ff ff       	jmp    1001 <concreate+0x181>
+        printf(1, "concreate weird file %s\n", de.name);
+    1134:	83 ec 04             	sub    $0x4,%esp
+    1137:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    113a:	50                   	push   %eax
+    113b:	68 85 4f 00 00       	push   $0x4f85
+    1140:	6a 01                	push   $0x1
+    1142:	e8 89 2d 00 00       	call   3ed0 <printf>
+        exit();
+    1147:	e8 78 2b 00 00       	call   3cc4 <exit>
+    printf(1, "concreate not enough files in directory listing\n");
+    114c:	51                   	push   %ecx
+    114d:	51                   	push   %ecx
+    114e:	68 2c 45 00 00       	push   $0x452c
+    1153:	6a 01                	push   $0x1
+    1155:	e8 76 2d 00 00       	call   3ed0 <printf>
+    exit();
+    115a:	e8 65 2b 00 00       	call   3cc4 <exit>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    115f:	83 ec 04             	sub    $0x4,%esp
+    1162:	8d 45 b2             	lea    -0x4e(%ebp),%eax
+    1165:	50                   	push   %eax
+    1166:	68 9e 4f 00 00       	push   $0x4f9e
+    116b:	6a 01                	push   $0x1
+    116d:	e8 5e 2d 00 00       	call   3ed0 <printf>
+        exit();
+    1172:	e8 4d 2b 00 00       	call   3cc4 <exit>
+    1177:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    117e:	66 90                	xchg   %ax,%ax
+
+00001180 <linkunlink>:
+{
+    1180:	55                   	push   %ebp
+    1181:	89 e5                	mov    %esp,%ebp
+    1183:	57                   	push   %edi
+    1184:	56                   	push   %esi
+    1185:	53                   	push   %ebx
+    1186:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "linkunlink test\n");
+    1189:	68 c9 4f 00 00       	push   $0x4fc9
+    118e:	6a 01                	push   $0x1
+    1190:	e8 3b 2d 00 00       	call   3ed0 <printf>
+  unlink("x");
+    1195:	c7 04 24 fc 51 00 00 	movl   $0x51fc,(%esp)
+    119c:	e8 73 2b 00 00       	call   3d14 <unlink>
+  pid = fork();
+    11a1:	e8 16 2b 00 00       	call   3cbc <fork>
+  if(pid < 0){
+    11a6:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    11a9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(pid < 0){
+    11ac:	85 c0                	test   %eax,%eax
+    11ae:	0f 88 b6 00 00 00    	js     126a <linkunlink+0xea>
+  unsigned int x = (pid ? 1 : 97);
+    11b4:	83 7d e4 01          	cmpl   $0x1,-0x1c(%ebp)
+    11b8:	bb 64 00 00 00       	mov    $0x64,%ebx
+    if((x % 3) == 0){
+    11bd:	be ab aa aa aa       	mov    $0xaaaaaaab,%esi
+  unsigned int x = (pid ? 1 : 97);
+    11c2:	19 ff                	sbb    %edi,%edi
+    11c4:	83 e7 60             	and    $0x60,%edi
+    11c7:	83 c7 01             	add    $0x1,%edi
+    11ca:	eb 1e                	jmp    11ea <linkunlink+0x6a>
+    11cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    } else if((x % 3) == 1){
+    11d0:	83 f8 01             	cmp    $0x1,%eax
+    11d3:	74 7b                	je     1250 <linkunlink+0xd0>
+      unlink("x");
+    11d5:	83 ec 0c             	sub    $0xc,%esp
+    11d8:	68 fc 51 00 00       	push   $0x51fc
+    11dd:	e8 32 2b 00 00       	call   3d14 <unlink>
+    11e2:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    11e5:	83 eb 01             	sub    $0x1,%ebx
+    11e8:	74 41                	je     122b <linkunlink+0xab>
+    x = x * 1103515245 + 12345;
+    11ea:	69 cf 6d 4e c6 41    	imul   $0x41c64e6d,%edi,%ecx
+    11f0:	8d b9 39 30 00 00    	lea    0x3039(%ecx),%edi
+    if((x % 3) == 0){
+    11f6:	89 f8                	mov    %edi,%eax
+    11f8:	f7 e6                	mul    %esi
+    11fa:	89 d0                	mov    %edx,%eax
+    11fc:	83 e2 fe             	and    $0xfffffffe,%edx
+    11ff:	d1 e8                	shr    %eax
+    1201:	01 c2                	add    %eax,%edx
+    1203:	89 f8                	mov    %edi,%eax
+    1205:	29 d0                	sub    %edx,%eax
+    1207:	75 c7                	jne    11d0 <linkunlink+0x50>
+      close(open("x", O_RDWR | O_CREATE));
+    1209:	83 ec 08             	sub    $0x8,%esp
+    120c:	68 02 02 00 00       	push   $0x202
+    1211:	68 fc 51 00 00       	push   $0x51fc
+    1216:	e8 e9 2a 00 00       	call   3d04 <open>
+    121b:	89 04 24             	mov    %eax,(%esp)
+    121e:	e8 c9 2a 00 00       	call   3cec <close>
+    1223:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    1226:	83 eb 01             	sub    $0x1,%ebx
+    1229:	75 bf                	jne    11ea <linkunlink+0x6a>
+  if(pid)
+    122b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    122e:	85 c0                	test   %eax,%eax
+    1230:	74 4b                	je     127d <linkunlink+0xfd>
+    wait();
+    1232:	e8 95 2a 00 00       	call   3ccc <wait>
+  printf(1, "linkunlink ok\n");
+    1237:	83 ec 08             	sub    $0x8,%esp
+    123a:	68 de 4f 00 00       	push   $0x4fde
+    123f:	6a 01                	push   $0x1
+    1241:	e8 8a 2c 00 00       	call   3ed0 <printf>
+}
+    1246:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1249:	5b                   	pop    %ebx
+    124a:	5e                   	pop    %esi
+    124b:	5f                   	pop    %edi
+    124c:	5d                   	pop    %ebp
+    124d:	c3                   	ret
+    124e:	66 90                	xchg   %ax,%ax
+      link("cat", "x");
+    1250:	83 ec 08             	sub    $0x8,%esp
+    1253:	68 fc 51 00 00       	push   $0x51fc
+    1258:	68 da 4f 00 00       	push   $0x4fda
+    125d:	e8 c2 2a 00 00       	call   3d24 <link>
+    1262:	83 c4 10             	add    $0x10,%esp
+    1265:	e9 7b ff ff ff       	jmp    11e5 <linkunlink+0x65>
+    printf(1, "fork failed\n");
+    126a:	52                   	push   %edx
+    126b:	52                   	push   %edx
+    126c:	68 81 5b 00 00       	push   $0x5b81
+    1271:	6a 01                	push   $0x1
+    1273:	e8 58 2c 00 00       	call   3ed0 <printf>
+    exit();
+    1278:	e8 47 2a 00 00       	call   3cc4 <exit>
+    exit();
+    127d:	e8 42 2a 00 00       	call   3cc4 <exit>
+    1282:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00001290 <subdir>:
+{
+    1290:	55                   	push   %ebp
+    1291:	89 e5                	mov    %esp,%ebp
+    1293:	53                   	push   %ebx
+    1294:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "subdir test\n");
+    1297:	68 ed 4f 00 00       	push   $0x4fed
+    129c:	6a 01                	push   $0x1
+    129e:	e8 2d 2c 00 00       	call   3ed0 <printf>
+  unlink("ff");
+    12a3:	c7 04 24 76 50 00 00 	movl   $0x5076,(%esp)
+    12aa:	e8 65 2a 00 00       	call   3d14 <unlink>
+  if(mkdir("dd") != 0){
+    12af:	c7 04 24 13 51 00 00 	movl   $0x5113,(%esp)
+    12b6:	e8 71 2a 00 00       	call   3d2c <mkdir>
+    12bb:	83 c4 10             	add    $0x10,%esp
+    12be:	85 c0                	test   %eax,%eax
+    12c0:	0f 85 b3 05 00 00    	jne    1879 <subdir+0x5e9>
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    12c6:	83 ec 08             	sub    $0x8,%esp
+    12c9:	68 02 02 00 00       	push   $0x202
+    12ce:	68 4c 50 00 00       	push   $0x504c
+    12d3:	e8 2c 2a 00 00       	call   3d04 <open>
+  if(fd < 0){
+    12d8:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    12db:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    12dd:	85 c0                	test   %eax,%eax
+    12df:	0f 88 81 05 00 00    	js     1866 <subdir+0x5d6>
+  write(fd, "ff", 2);
+    12e5:	83 ec 04             	sub    $0x4,%esp
+    12e8:	6a 02                	push   $0x2
+    12ea:	68 76 50 00 00       	push   $0x5076
+    12ef:	50                   	push   %eax
+    12f0:	e8 ef 29 00 00       	call   3ce4 <write>
+  close(fd);
+    12f5:	89 1c 24             	mov    %ebx,(%esp)
+    12f8:	e8 ef 29 00 00       	call   3cec <close>
+  if(unlink("dd") >= 0){
+    12fd:	c7 04 24 13 51 00 00 	movl   $0x5113,(%esp)
+    1304:	e8 0b 2a 00 00       	call   3d14 <unlink>
+    1309:	83 c4 10             	add    $0x10,%esp
+    130c:	85 c0                	test   %eax,%eax
+    130e:	0f 89 3f 05 00 00    	jns    1853 <subdir+0x5c3>
+  if(mkdir("/dd/dd") != 0){
+    1314:	83 ec 0c             	sub    $0xc,%esp
+    1317:	68 27 50 00 00       	push   $0x5027
+    131c:	e8 0b 2a 00 00       	call   3d2c <mkdir>
+    1321:	83 c4 10             	add    $0x10,%esp
+    1324:	85 c0                	test   %eax,%eax
+    1326:	0f 85 14 05 00 00    	jne    1840 <subdir+0x5b0>
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    132c:	83 ec 08             	sub    $0x8,%esp
+    132f:	68 02 02 00 00       	push   $0x202
+    1334:	68 49 50 00 00       	push   $0x5049
+    1339:	e8 c6 29 00 00       	call   3d04 <open>
+  if(fd < 0){
+    133e:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    1341:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1343:	85 c0                	test   %eax,%eax
+    1345:	0f 88 24 04 00 00    	js     176f <subdir+0x4df>
+  write(fd, "FF", 2);
+    134b:	83 ec 04             	sub    $0x4,%esp
+    134e:	6a 02                	push   $0x2
+    1350:	68 6a 50 00 00       	push   $0x506a
+    1355:	50                   	push   %eax
+    1356:	e8 89 29 00 00       	call   3ce4 <write>
+  close(fd);
+    135b:	89 1c 24             	mov    %ebx,(%esp)
+    135e:	e8 89 29 00 00       	call   3cec <close>
+  fd = open("dd/dd/../ff", 0);
+    1363:	58                   	pop    %eax
+    1364:	5a                   	pop    %edx
+    1365:	6a 00                	push   $0x0
+    1367:	68 6d 50 00 00       	push   $0x506d
+    136c:	e8 93 29 00 00       	call   3d04 <open>
+  if(fd < 0){
+    1371:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/../ff", 0);
+    1374:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1376:	85 c0                	test   %eax,%eax
+    1378:	0f 88 de 03 00 00    	js     175c <subdir+0x4cc>
+  cc = read(fd, buf, sizeof(buf));
+    137e:	83 ec 04             	sub    $0x4,%esp
+    1381:	68 00 20 00 00       	push   $0x2000
+    1386:	68 00 90 00 00       	push   $0x9000
+    138b:	50                   	push   %eax
+    138c:	e8 4b 29 00 00       	call   3cdc <read>
+  if(cc != 2 || buf[0] != 'f'){
+    1391:	83 c4 10             	add    $0x10,%esp
+    1394:	83 f8 02             	cmp    $0x2,%eax
+    1397:	0f 85 3a 03 00 00    	jne    16d7 <subdir+0x447>
+    139d:	80 3d 00 90 00 00 66 	cmpb   $0x66,0x9000
+    13a4:	0f 85 2d 03 00 00    	jne    16d7 <subdir+0x447>
+  close(fd);
+    13aa:	83 ec 0c             	sub    $0xc,%esp
+    13ad:	53                   	push   %ebx
+    13ae:	e8 39 29 00 00       	call   3cec <close>
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    13b3:	59                   	pop    %ecx
+    13b4:	5b                   	pop    %ebx
+    13b5:	68 ad 50 00 00       	push   $0x50ad
+    13ba:	68 49 50 00 00       	push   $0x5049
+    13bf:	e8 60 29 00 00       	call   3d24 <link>
+    13c4:	83 c4 10             	add    $0x10,%esp
+    13c7:	85 c0                	test   %eax,%eax
+    13c9:	0f 85 c6 03 00 00    	jne    1795 <subdir+0x505>
+  if(unlink("dd/dd/ff") != 0){
+    13cf:	83 ec 0c             	sub    $0xc,%esp
+    13d2:	68 49 50 00 00       	push   $0x5049
+    13d7:	e8 38 29 00 00       	call   3d14 <unlink>
+    13dc:	83 c4 10             	add    $0x10,%esp
+    13df:	85 c0                	test   %eax,%eax
+    13e1:	0f 85 16 03 00 00    	jne    16fd <subdir+0x46d>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    13e7:	83 ec 08             	sub    $0x8,%esp
+    13ea:	6a 00                	push   $0x0
+    13ec:	68 49 50 00 00       	push   $0x5049
+    13f1:	e8 0e 29 00 00       	call   3d04 <open>
+    13f6:	83 c4 10             	add    $0x10,%esp
+    13f9:	85 c0                	test   %eax,%eax
+    13fb:	0f 89 2c 04 00 00    	jns    182d <subdir+0x59d>
+  if(chdir("dd") != 0){
+    1401:	83 ec 0c             	sub    $0xc,%esp
+    1404:	68 13 51 00 00       	push   $0x5113
+    1409:	e8 26 29 00 00       	call   3d34 <chdir>
+    140e:	83 c4 10             	add    $0x10,%esp
+    1411:	85 c0                	test   %eax,%eax
+    1413:	0f 85 01 04 00 00    	jne    181a <subdir+0x58a>
+  if(chdir("dd/../../dd") != 0){
+    1419:	83 ec 0c             	sub    $0xc,%esp
+    141c:	68 e1 50 00 00       	push   $0x50e1
+    1421:	e8 0e 29 00 00       	call   3d34 <chdir>
+    1426:	83 c4 10             	add    $0x10,%esp
+    1429:	85 c0                	test   %eax,%eax
+    142b:	0f 85 b9 02 00 00    	jne    16ea <subdir+0x45a>
+  if(chdir("dd/../../../dd") != 0){
+    1431:	83 ec 0c             	sub    $0xc,%esp
+    1434:	68 07 51 00 00       	push   $0x5107
+    1439:	e8 f6 28 00 00       	call   3d34 <chdir>
+    143e:	83 c4 10             	add    $0x10,%esp
+    1441:	85 c0                	test   %eax,%eax
+    1443:	0f 85 a1 02 00 00    	jne    16ea <subdir+0x45a>
+  if(chdir("./..") != 0){
+    1449:	83 ec 0c             	sub    $0xc,%esp
+    144c:	68 16 51 00 00       	push   $0x5116
+    1451:	e8 de 28 00 00       	call   3d34 <chdir>
+    1456:	83 c4 10             	add    $0x10,%esp
+    1459:	85 c0                	test   %eax,%eax
+    145b:	0f 85 21 03 00 00    	jne    1782 <subdir+0x4f2>
+  fd = open("dd/dd/ffff", 0);
+    1461:	83 ec 08             	sub    $0x8,%esp
+    1464:	6a 00                	push   $0x0
+    1466:	68 ad 50 00 00       	push   $0x50ad
+    146b:	e8 94 28 00 00       	call   3d04 <open>
+  if(fd < 0){
+    1470:	83 c4 10             	add    $0x10,%esp
+  fd = open("dd/dd/ffff", 0);
+    1473:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    1475:	85 c0                	test   %eax,%eax
+    1477:	0f 88 e0 04 00 00    	js     195d <subdir+0x6cd>
+  if(read(fd, buf, sizeof(buf)) != 2){
+    147d:	83 ec 04             	sub    $0x4,%esp
+    1480:	68 00 20 00 00       	push   $0x2000
+    1485:	68 00 90 00 00       	push   $0x9000
+    148a:	50                   	push   %eax
+    148b:	e8 4c 28 00 00       	call   3cdc <read>
+    1490:	83 c4 10             	add    $0x10,%esp
+    1493:	83 f8 02             	cmp    $0x2,%eax
+    1496:	0f 85 ae 04 00 00    	jne    194a <subdir+0x6ba>
+  close(fd);
+    149c:	83 ec 0c             	sub    $0xc,%esp
+    149f:	53                   	push   %ebx
+    14a0:	e8 47 28 00 00       	call   3cec <close>
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    14a5:	58                   	pop    %eax
+    14a6:	5a                   	pop    %edx
+    14a7:	6a 00                	push   $0x0
+    14a9:	68 49 50 00 00       	push   $0x5049
+    14ae:	e8 51 28 00 00       	call   3d04 <open>
+    14b3:	83 c4 10             	add    $0x10,%esp
+    14b6:	85 c0                	test   %eax,%eax
+    14b8:	0f 89 65 02 00 00    	jns    1723 <subdir+0x493>
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    14be:	83 ec 08             	sub    $0x8,%esp
+    14c1:	68 02 02 00 00       	push   $0x202
+    14c6:	68 61 51 00 00       	push   $0x5161
+    14cb:	e8 34 28 00 00       	call   3d04 <open>
+    14d0:	83 c4 10             	add    $0x10,%esp
+    14d3:	85 c0                	test   %eax,%eax
+    14d5:	0f 89 35 02 00 00    	jns    1710 <subdir+0x480>
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    14db:	83 ec 08             	sub    $0x8,%esp
+    14de:	68 02 02 00 00       	push   $0x202
+    14e3:	68 86 51 00 00       	push   $0x5186
+    14e8:	e8 17 28 00 00       	call   3d04 <open>
+    14ed:	83 c4 10             	add    $0x10,%esp
+    14f0:	85 c0                	test   %eax,%eax
+    14f2:	0f 89 0f 03 00 00    	jns    1807 <subdir+0x577>
+  if(open("dd", O_CREATE) >= 0){
+    14f8:	83 ec 08             	sub    $0x8,%esp
+    14fb:	68 00 02 00 00       	push   $0x200
+    1500:	68 13 51 00 00       	push   $0x5113
+    1505:	e8 fa 27 00 00       	call   3d04 <open>
+    150a:	83 c4 10             	add    $0x10,%esp
+    150d:	85 c0                	test   %eax,%eax
+    150f:	0f 89 df 02 00 00    	jns    17f4 <subdir+0x564>
+  if(open("dd", O_RDWR) >= 0){
+    1515:	83 ec 08             	sub    $0x8,%esp
+    1518:	6a 02                	push   $0x2
+    151a:	68 13 51 00 00       	push   $0x5113
+    151f:	e8 e0 27 00 00       	call   3d04 <open>
+    1524:	83 c4 10             	add    $0x10,%esp
+    1527:	85 c0                	test   %eax,%eax
+    1529:	0f 89 b2 02 00 00    	jns    17e1 <subdir+0x551>
+  if(open("dd", O_WRONLY) >= 0){
+    152f:	83 ec 08             	sub    $0x8,%esp
+    1532:	6a 01                	push   $0x1
+    1534:	68 13 51 00 00       	push   $0x5113
+    1539:	e8 c6 27 00 00       	call   3d04 <open>
+    153e:	83 c4 10             	add    $0x10,%esp
+    1541:	85 c0                	test   %eax,%eax
+    1543:	0f 89 85 02 00 00    	jns    17ce <subdir+0x53e>
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    1549:	83 ec 08             	sub    $0x8,%esp
+    154c:	68 f5 51 00 00       	push   $0x51f5
+    1551:	68 61 51 00 00       	push   $0x5161
+    1556:	e8 c9 27 00 00       	call   3d24 <link>
+    155b:	83 c4 10             	add    $0x10,%esp
+    155e:	85 c0                	test   %eax,%eax
+    1560:	0f 84 55 02 00 00    	je     17bb <subdir+0x52b>
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    1566:	83 ec 08             	sub    $0x8,%esp
+    1569:	68 f5 51 00 00       	push   $0x51f5
+    156e:	68 86 51 00 00       	push   $0x5186
+    1573:	e8 ac 27 00 00       	call   3d24 <link>
+    1578:	83 c4 10             	add    $0x10,%esp
+    157b:	85 c0                	test   %eax,%eax
+    157d:	0f 84 25 02 00 00    	je     17a8 <subdir+0x518>
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    1583:	83 ec 08             	sub    $0x8,%esp
+    1586:	68 ad 50 00 00       	push   $0x50ad
+    158b:	68 4c 50 00 00       	push   $0x504c
+    1590:	e8 8f 27 00 00       	call   3d24 <link>
+    1595:	83 c4 10             	add    $0x10,%esp
+    1598:	85 c0                	test   %eax,%eax
+    159a:	0f 84 a9 01 00 00    	je     1749 <subdir+0x4b9>
+  if(mkdir("dd/ff/ff") == 0){
+    15a0:	83 ec 0c             	sub    $0xc,%esp
+    15a3:	68 61 51 00 00       	push   $0x5161
+    15a8:	e8 7f 27 00 00       	call   3d2c <mkdir>
+    15ad:	83 c4 10             	add    $0x10,%esp
+    15b0:	85 c0                	test   %eax,%eax
+    15b2:	0f 84 7e 01 00 00    	je     1736 <subdir+0x4a6>
+  if(mkdir("dd/xx/ff") == 0){
+    15b8:	83 ec 0c             	sub    $0xc,%esp
+    15bb:	68 86 51 00 00       	push   $0x5186
+    15c0:	e8 67 27 00 00       	call   3d2c <mkdir>
+    15c5:	83 c4 10             	add    $0x10,%esp
+    15c8:	85 c0                	test   %eax,%eax
+    15ca:	0f 84 67 03 00 00    	je     1937 <subdir+0x6a7>
+  if(mkdir("dd/dd/ffff") == 0){
+    15d0:	83 ec 0c             	sub    $0xc,%esp
+    15d3:	68 ad 50 00 00       	push   $0x50ad
+    15d8:	e8 4f 27 00 00       	call   3d2c <mkdir>
+    15dd:	83 c4 10             	add    $0x10,%esp
+    15e0:	85 c0                	test   %eax,%eax
+    15e2:	0f 84 3c 03 00 00    	je     1924 <subdir+0x694>
+  if(unlink("dd/xx/ff") == 0){
+    15e8:	83 ec 0c             	sub    $0xc,%esp
+    15eb:	68 86 51 00 00       	push   $0x5186
+    15f0:	e8 1f 27 00 00       	call   3d14 <unlink>
+    15f5:	83 c4 10             	add    $0x10,%esp
+    15f8:	85 c0                	test   %eax,%eax
+    15fa:	0f 84 11 03 00 00    	je     1911 <subdir+0x681>
+  if(unlink("dd/ff/ff") == 0){
+    1600:	83 ec 0c             	sub    $0xc,%esp
+    1603:	68 61 51 00 00       	push   $0x5161
+    1608:	e8 07 27 00 00       	call   3d14 <unlink>
+    160d:	83 c4 10             	add    $0x10,%esp
+    1610:	85 c0                	test   %eax,%eax
+    1612:	0f 84 e6 02 00 00    	je     18fe <subdir+0x66e>
+  if(chdir("dd/ff") == 0){
+    1618:	83 ec 0c             	sub    $0xc,%esp
+    161b:	68 4c 50 00 00       	push   $0x504c
+    1620:	e8 0f 27 00 00       	call   3d34 <chdir>
+    1625:	83 c4 10             	add    $0x10,%esp
+    1628:	85 c0                	test   %eax,%eax
+    162a:	0f 84 bb 02 00 00    	je     18eb <subdir+0x65b>
+  if(chdir("dd/xx") == 0){
+    1630:	83 ec 0c             	sub    $0xc,%esp
+    1633:	68 f8 51 00 00       	push   $0x51f8
+    1638:	e8 f7 26 00 00       	call   3d34 <chdir>
+    163d:	83 c4 10             	add    $0x10,%esp
+    1640:	85 c0                	test   %eax,%eax
+    1642:	0f 84 90 02 00 00    	je     18d8 <subdir+0x648>
+  if(unlink("dd/dd/ffff") != 0){
+    1648:	83 ec 0c             	sub    $0xc,%esp
+    164b:	68 ad 50 00 00       	push   $0x50ad
+    1650:	e8 bf 26 00 00       	call   3d14 <unlink>
+    1655:	83 c4 10             	add    $0x10,%esp
+    1658:	85 c0                	test   %eax,%eax
+    165a:	0f 85 9d 00 00 00    	jne    16fd <subdir+0x46d>
+  if(unlink("dd/ff") != 0){
+    1660:	83 ec 0c             	sub    $0xc,%esp
+    1663:	68 4c 50 00 00       	push   $0x504c
+    1668:	e8 a7 26 00 00       	call   3d14 <unlink>
+    166d:	83 c4 10             	add    $0x10,%esp
+    1670:	85 c0                	test   %eax,%eax
+    1672:	0f 85 4d 02 00 00    	jne    18c5 <subdir+0x635>
+  if(unlink("dd") == 0){
+    1678:	83 ec 0c             	sub    $0xc,%esp
+    167b:	68 13 51 00 00       	push   $0x5113
+    1680:	e8 8f 26 00 00       	call   3d14 <unlink>
+    1685:	83 c4 10             	add    $0x10,%esp
+    1688:	85 c0                	test   %eax,%eax
+    168a:	0f 84 22 02 00 00    	je     18b2 <subdir+0x622>
+  if(unlink("dd/dd") < 0){
+    1690:	83 ec 0c             	sub    $0xc,%esp
+    1693:	68 28 50 00 00       	push   $0x5028
+    1698:	e8 77 26 00 00       	call   3d14 <unlink>
+    169d:	83 c4 10             	add    $0x10,%esp
+    16a0:	85 c0                	test   %eax,%eax
+    16a2:	0f 88 f7 01 00 00    	js     189f <subdir+0x60f>
+  if(unlink("dd") < 0){
+    16a8:	83 ec 0c             	sub    $0xc,%esp
+    16ab:	68 13 51 00 00       	push   $0x5113
+    16b0:	e8 5f 26 00 00       	call   3d14 <unlink>
+    16b5:	83 c4 10             	add    $0x10,%esp
+    16b8:	85 c0                	test   %eax,%eax
+    16ba:	0f 88 cc 01 00 00    	js     188c <subdir+0x5fc>
+  printf(1, "subdir ok\n");
+    16c0:	83 ec 08             	sub    $0x8,%esp
+    16c3:	68 f5 52 00 00       	push   $0x52f5
+    16c8:	6a 01                	push   $0x1
+    16ca:	e8 01 28 00 00       	call   3ed0 <printf>
+}
+    16cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    16d2:	83 c4 10             	add    $0x10,%esp
+    16d5:	c9                   	leave
+    16d6:	c3                   	ret
+    printf(1, "dd/dd/../ff wrong content\n");
+    16d7:	50                   	push   %eax
+    16d8:	50                   	push   %eax
+    16d9:	68 92 50 00 00       	push   $0x5092
+    16de:	6a 01                	push   $0x1
+    16e0:	e8 eb 27 00 00       	call   3ed0 <printf>
+    exit();
+    16e5:	e8 da 25 00 00       	call   3cc4 <exit>
+    printf(1, "chdir dd/../../dd failed\n");
+    16ea:	50                   	push   %eax
+    16eb:	50                   	push   %eax
+    16ec:	68 ed 50 00 00       	push   $0x50ed
+    16f1:	6a 01                	push   $0x1
+    16f3:	e8 d8 27 00 00       	call   3ed0 <printf>
+    exit();
+    16f8:	e8 c7 25 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dd/dd/ff failed\n");
+    16fd:	50                   	push   %eax
+    16fe:	50                   	push   %eax
+    16ff:	68 b8 50 00 00       	push   $0x50b8
+    1704:	6a 01                	push   $0x1
+    1706:	e8 c5 27 00 00       	call   3ed0 <printf>
+    exit();
+    170b:	e8 b4 25 00 00       	call   3cc4 <exit>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    1710:	51                   	push   %ecx
+    1711:	51                   	push   %ecx
+    1712:	68 6a 51 00 00       	push   $0x516a
+    1717:	6a 01                	push   $0x1
+    1719:	e8 b2 27 00 00       	call   3ed0 <printf>
+    exit();
+    171e:	e8 a1 25 00 00       	call   3cc4 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    1723:	53                   	push   %ebx
+    1724:	53                   	push   %ebx
+    1725:	68 d0 45 00 00       	push   $0x45d0
+    172a:	6a 01                	push   $0x1
+    172c:	e8 9f 27 00 00       	call   3ed0 <printf>
+    exit();
+    1731:	e8 8e 25 00 00       	call   3cc4 <exit>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    1736:	51                   	push   %ecx
+    1737:	51                   	push   %ecx
+    1738:	68 fe 51 00 00       	push   $0x51fe
+    173d:	6a 01                	push   $0x1
+    173f:	e8 8c 27 00 00       	call   3ed0 <printf>
+    exit();
+    1744:	e8 7b 25 00 00       	call   3cc4 <exit>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    1749:	53                   	push   %ebx
+    174a:	53                   	push   %ebx
+    174b:	68 40 46 00 00       	push   $0x4640
+    1750:	6a 01                	push   $0x1
+    1752:	e8 79 27 00 00       	call   3ed0 <printf>
+    exit();
+    1757:	e8 68 25 00 00       	call   3cc4 <exit>
+    printf(1, "open dd/dd/../ff failed\n");
+    175c:	50                   	push   %eax
+    175d:	50                   	push   %eax
+    175e:	68 79 50 00 00       	push   $0x5079
+    1763:	6a 01                	push   $0x1
+    1765:	e8 66 27 00 00       	call   3ed0 <printf>
+    exit();
+    176a:	e8 55 25 00 00       	call   3cc4 <exit>
+    printf(1, "create dd/dd/ff failed\n");
+    176f:	51                   	push   %ecx
+    1770:	51                   	push   %ecx
+    1771:	68 52 50 00 00       	push   $0x5052
+    1776:	6a 01                	push   $0x1
+    1778:	e8 53 27 00 00       	call   3ed0 <printf>
+    exit();
+    177d:	e8 42 25 00 00       	call   3cc4 <exit>
+    printf(1, "chdir ./.. failed\n");
+    1782:	50                   	push   %eax
+    1783:	50                   	push   %eax
+    1784:	68 1b 51 00 00       	push   $0x511b
+    1789:	6a 01                	push   $0x1
+    178b:	e8 40 27 00 00       	call   3ed0 <printf>
+    exit();
+    1790:	e8 2f 25 00 00       	call   3cc4 <exit>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    1795:	52                   	push   %edx
+    1796:	52                   	push   %edx
+    1797:	68 88 45 00 00       	push   $0x4588
+    179c:	6a 01                	push   $0x1
+    179e:	e8 2d 27 00 00       	call   3ed0 <printf>
+    exit();
+    17a3:	e8 1c 25 00 00       	call   3cc4 <exit>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    17a8:	50                   	push   %eax
+    17a9:	50                   	push   %eax
+    17aa:	68 1c 46 00 00       	push   $0x461c
+    17af:	6a 01                	push   $0x1
+    17b1:	e8 1a 27 00 00       	call   3ed0 <printf>
+    exit();
+    17b6:	e8 09 25 00 00       	call   3cc4 <exit>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    17bb:	50                   	push   %eax
+    17bc:	50                   	push   %eax
+    17bd:	68 f8 45 00 00       	push   $0x45f8
+    17c2:	6a 01                	push   $0x1
+    17c4:	e8 07 27 00 00       	call   3ed0 <printf>
+    exit();
+    17c9:	e8 f6 24 00 00       	call   3cc4 <exit>
+    printf(1, "open dd wronly succeeded!\n");
+    17ce:	50                   	push   %eax
+    17cf:	50                   	push   %eax
+    17d0:	68 da 51 00 00       	push   $0x51da
+    17d5:	6a 01                	push   $0x1
+    17d7:	e8 f4 26 00 00       	call   3ed0 <printf>
+    exit();
+    17dc:	e8 e3 24 00 00       	call   3cc4 <exit>
+    printf(1, "open dd rdwr succeeded!\n");
+    17e1:	50                   	push   %eax
+    17e2:	50                   	push   %eax
+    17e3:	68 c1 51 00 00       	push   $0x51c1
+    17e8:	6a 01                	push   $0x1
+    17ea:	e8 e1 26 00 00       	call   3ed0 <printf>
+    exit();
+    17ef:	e8 d0 24 00 00       	call   3cc4 <exit>
+    printf(1, "create dd succeeded!\n");
+    17f4:	50                   	push   %eax
+    17f5:	50                   	push   %eax
+    17f6:	68 ab 51 00 00       	push   $0x51ab
+    17fb:	6a 01                	push   $0x1
+    17fd:	e8 ce 26 00 00       	call   3ed0 <printf>
+    exit();
+    1802:	e8 bd 24 00 00       	call   3cc4 <exit>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    1807:	52                   	push   %edx
+    1808:	52                   	push   %edx
+    1809:	68 8f 51 00 00       	push   $0x518f
+    180e:	6a 01                	push   $0x1
+    1810:	e8 bb 26 00 00       	call   3ed0 <printf>
+    exit();
+    1815:	e8 aa 24 00 00       	call   3cc4 <exit>
+    printf(1, "chdir dd failed\n");
+    181a:	50                   	push   %eax
+    181b:	50                   	push   %eax
+    181c:	68 d0 50 00 00       	push   $0x50d0
+    1821:	6a 01                	push   $0x1
+    1823:	e8 a8 26 00 00       	call   3ed0 <printf>
+    exit();
+    1828:	e8 97 24 00 00       	call   3cc4 <exit>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    182d:	50                   	push   %eax
+    182e:	50                   	push   %eax
+    182f:	68 ac 45 00 00       	push   $0x45ac
+    1834:	6a 01                	push   $0x1
+    1836:	e8 95 26 00 00       	call   3ed0 <printf>
+    exit();
+    183b:	e8 84 24 00 00       	call   3cc4 <exit>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    1840:	53                   	push   %ebx
+    1841:	53                   	push   %ebx
+    1842:	68 2e 50 00 00       	push   $0x502e
+    1847:	6a 01                	push   $0x1
+    1849:	e8 82 26 00 00       	call   3ed0 <printf>
+    exit();
+    184e:	e8 71 24 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    1853:	50                   	push   %eax
+    1854:	50                   	push   %eax
+    1855:	68 60 45 00 00       	push   $0x4560
+    185a:	6a 01                	push   $0x1
+    185c:	e8 6f 26 00 00       	call   3ed0 <printf>
+    exit();
+    1861:	e8 5e 24 00 00       	call   3cc4 <exit>
+    printf(1, "create dd/ff failed\n");
+    1866:	50                   	push   %eax
+    1867:	50                   	push   %eax
+    1868:	68 12 50 00 00       	push   $0x5012
+    186d:	6a 01                	push   $0x1
+    186f:	e8 5c 26 00 00       	call   3ed0 <printf>
+    exit();
+    1874:	e8 4b 24 00 00       	call   3cc4 <exit>
+    printf(1, "subdir mkdir dd failed\n");
+    1879:	50                   	push   %eax
+    187a:	50                   	push   %eax
+    187b:	68 fa 4f 00 00       	push   $0x4ffa
+    1880:	6a 01                	push   $0x1
+    1882:	e8 49 26 00 00       	call   3ed0 <printf>
+    exit();
+    1887:	e8 38 24 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dd failed\n");
+    188c:	50                   	push   %eax
+    188d:	50                   	push   %eax
+    188e:	68 e3 52 00 00       	push   $0x52e3
+    1893:	6a 01                	push   $0x1
+    1895:	e8 36 26 00 00       	call   3ed0 <printf>
+    exit();
+    189a:	e8 25 24 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dd/dd failed\n");
+    189f:	52                   	push   %edx
+    18a0:	52                   	push   %edx
+    18a1:	68 ce 52 00 00       	push   $0x52ce
+    18a6:	6a 01                	push   $0x1
+    18a8:	e8 23 26 00 00       	call   3ed0 <printf>
+    exit();
+    18ad:	e8 12 24 00 00       	call   3cc4 <exit>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    18b2:	51                   	push   %ecx
+    18b3:	51                   	push   %ecx
+    18b4:	68 64 46 00 00       	push   $0x4664
+    18b9:	6a 01                	push   $0x1
+    18bb:	e8 10 26 00 00       	call   3ed0 <printf>
+    exit();
+    18c0:	e8 ff 23 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dd/ff failed\n");
+    18c5:	53                   	push   %ebx
+    18c6:	53                   	push   %ebx
+    18c7:	68 b9 52 00 00       	push   $0x52b9
+    18cc:	6a 01                	push   $0x1
+    18ce:	e8 fd 25 00 00       	call   3ed0 <printf>
+    exit();
+    18d3:	e8 ec 23 00 00       	call   3cc4 <exit>
+    printf(1, "chdir dd/xx succeeded!\n");
+    18d8:	50                   	push   %eax
+    18d9:	50                   	push   %eax
+    18da:	68 a1 52 00 00       	push   $0x52a1
+    18df:	6a 01                	push   $0x1
+    18e1:	e8 ea 25 00 00       	call   3ed0 <printf>
+    exit();
+    18e6:	e8 d9 23 00 00       	call   3cc4 <exit>
+    printf(1, "chdir dd/ff succeeded!\n");
+    18eb:	50                   	push   %eax
+    18ec:	50                   	push   %eax
+    18ed:	68 89 52 00 00       	push   $0x5289
+    18f2:	6a 01                	push   $0x1
+    18f4:	e8 d7 25 00 00       	call   3ed0 <printf>
+    exit();
+    18f9:	e8 c6 23 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    18fe:	50                   	push   %eax
+    18ff:	50                   	push   %eax
+    1900:	68 6d 52 00 00       	push   $0x526d
+    1905:	6a 01                	push   $0x1
+    1907:	e8 c4 25 00 00       	call   3ed0 <printf>
+    exit();
+    190c:	e8 b3 23 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    1911:	50                   	push   %eax
+    1912:	50                   	push   %eax
+    1913:	68 51 52 00 00       	push   $0x5251
+    1918:	6a 01                	push   $0x1
+    191a:	e8 b1 25 00 00       	call   3ed0 <printf>
+    exit();
+    191f:	e8 a0 23 00 00       	call   3cc4 <exit>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    1924:	50                   	push   %eax
+    1925:	50                   	push   %eax
+    1926:	68 34 52 00 00       	push   $0x5234
+    192b:	6a 01                	push   $0x1
+    192d:	e8 9e 25 00 00       	call   3ed0 <printf>
+    exit();
+    1932:	e8 8d 23 00 00       	call   3cc4 <exit>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    1937:	52                   	push   %edx
+    1938:	52                   	push   %edx
+    1939:	68 19 52 00 00       	push   $0x5219
+    193e:	6a 01                	push   $0x1
+    1940:	e8 8b 25 00 00       	call   3ed0 <printf>
+    exit();
+    1945:	e8 7a 23 00 00       	call   3cc4 <exit>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    194a:	51                   	push   %ecx
+    194b:	51                   	push   %ecx
+    194c:	68 46 51 00 00       	push   $0x5146
+    1951:	6a 01                	push   $0x1
+    1953:	e8 78 25 00 00       	call   3ed0 <printf>
+    exit();
+    1958:	e8 67 23 00 00       	call   3cc4 <exit>
+    printf(1, "open dd/dd/ffff failed\n");
+    195d:	53                   	push   %ebx
+    195e:	53                   	push   %ebx
+    195f:	68 2e 51 00 00       	push   $0x512e
+    1964:	6a 01                	push   $0x1
+    1966:	e8 65 25 00 00       	call   3ed0 <printf>
+    exit();
+    196b:	e8 54 23 00 00       	call   3cc4 <exit>
+
+00001970 <wmapadjacent>:
+{
+    1970:	55                   	push   %ebp
+    1971:	89 e5                	mov    %esp,%ebp
+    1973:	53                   	push   %ebx
+    1974:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+  printf(stdout, "wmap adjacent test\n");
+    197a:	68 00 53 00 00       	push   $0x5300
+    197f:	ff 35 b4 68 00 00    	push   0x68b4
+    1985:	e8 46 25 00 00       	call   3ed0 <printf>
+  if(wmap((uint)a, 4096, MAP_FIXED|MAP_ANONYMOUS|MAP_PRIVATE, -1) != (uint)a ||
+    198a:	6a ff                	push   $0xffffffff
+    198c:	6a 0d                	push   $0xd
+    198e:	68 00 10 00 00       	push   $0x1000
+    1993:	68 00 00 00 60       	push   $0x60000000
+    1998:	e8 d7 23 00 00       	call   3d74 <wmap>
+    199d:	83 c4 20             	add    $0x20,%esp
+    19a0:	3d 00 00 00 60       	cmp    $0x60000000,%eax
+    19a5:	0f 85 39 01 00 00    	jne    1ae4 <wmapadjacent+0x174>
+     wmap((uint)b, 4096, MAP_FIXED|MAP_ANONYMOUS|MAP_PRIVATE, -1) != (uint)b){
+    19ab:	6a ff                	push   $0xffffffff
+    19ad:	6a 0d                	push   $0xd
+    19af:	68 00 10 00 00       	push   $0x1000
+    19b4:	68 00 10 00 60       	push   $0x60001000
+    19b9:	e8 b6 23 00 00       	call   3d74 <wmap>
+  if(wmap((uint)a, 4096, MAP_FIXED|MAP_ANONYMOUS|MAP_PRIVATE, -1) != (uint)a ||
+    19be:	83 c4 10             	add    $0x10,%esp
+    19c1:	3d 00 10 00 60       	cmp    $0x60001000,%eax
+    19c6:	0f 85 18 01 00 00    	jne    1ae4 <wmapadjacent+0x174>
+  if(getwmapinfo(&info) < 0 || info.total_mmaps != 2){
+    19cc:	83 ec 0c             	sub    $0xc,%esp
+    19cf:	8d 9d f4 fd ff ff    	lea    -0x20c(%ebp),%ebx
+    19d5:	53                   	push   %ebx
+    19d6:	e8 91 23 00 00       	call   3d6c <getwmapinfo>
+    19db:	83 c4 10             	add    $0x10,%esp
+    19de:	85 c0                	test   %eax,%eax
+    19e0:	0f 88 15 01 00 00    	js     1afb <wmapadjacent+0x18b>
+    19e6:	83 bd f4 fd ff ff 02 	cmpl   $0x2,-0x20c(%ebp)
+    19ed:	0f 85 08 01 00 00    	jne    1afb <wmapadjacent+0x18b>
+  a[0] = 'a';
+    19f3:	c6 05 00 00 00 60 61 	movb   $0x61,0x60000000
+  b[0] = 'b';
+    19fa:	c6 05 00 10 00 60 62 	movb   $0x62,0x60001000
+  if(wremap((uint)b, 4096, 4096, 0) != (uint)b){
+    1a01:	6a 00                	push   $0x0
+    1a03:	68 00 10 00 00       	push   $0x1000
+    1a08:	68 00 10 00 00       	push   $0x1000
+    1a0d:	68 00 10 00 60       	push   $0x60001000
+    1a12:	e8 6d 23 00 00       	call   3d84 <wremap>
+    1a17:	83 c4 10             	add    $0x10,%esp
+    1a1a:	3d 00 10 00 60       	cmp    $0x60001000,%eax
+    1a1f:	0f 85 04 01 00 00    	jne    1b29 <wmapadjacent+0x1b9>
+  if(wunmap((uint)b) != 0){
+    1a25:	83 ec 0c             	sub    $0xc,%esp
+    1a28:	68 00 10 00 60       	push   $0x60001000
+    1a2d:	e8 4a 23 00 00       	call   3d7c <wunmap>
+    1a32:	83 c4 10             	add    $0x10,%esp
+    1a35:	85 c0                	test   %eax,%eax
+    1a37:	0f 85 d5 00 00 00    	jne    1b12 <wmapadjacent+0x1a2>
+  if(getwmapinfo(&info) < 0 || info.total_mmaps != 1 ||
+    1a3d:	83 ec 0c             	sub    $0xc,%esp
+    1a40:	53                   	push   %ebx
+    1a41:	e8 26 23 00 00       	call   3d6c <getwmapinfo>
+    1a46:	83 c4 10             	add    $0x10,%esp
+    1a49:	85 c0                	test   %eax,%eax
+    1a4b:	78 67                	js     1ab4 <wmapadjacent+0x144>
+    1a4d:	83 bd f4 fd ff ff 01 	cmpl   $0x1,-0x20c(%ebp)
+    1a54:	75 5e                	jne    1ab4 <wmapadjacent+0x144>
+    1a56:	81 bd f8 fd ff ff 00 	cmpl   $0x60000000,-0x208(%ebp)
+    1a5d:	00 00 60 
+    1a60:	75 52                	jne    1ab4 <wmapadjacent+0x144>
+     info.addr[0] != (int)a || a[0] != 'a'){
+    1a62:	80 3d 00 00 00 60 61 	cmpb   $0x61,0x60000000
+    1a69:	75 49                	jne    1ab4 <wmapadjacent+0x144>
+  if(wunmap((uint)a) != 0 || getwmapinfo(&info) < 0 || info.total_mmaps != 0){
+    1a6b:	83 ec 0c             	sub    $0xc,%esp
+    1a6e:	68 00 00 00 60       	push   $0x60000000
+    1a73:	e8 04 23 00 00       	call   3d7c <wunmap>
+    1a78:	83 c4 10             	add    $0x10,%esp
+    1a7b:	85 c0                	test   %eax,%eax
+    1a7d:	75 4d                	jne    1acc <wmapadjacent+0x15c>
+    1a7f:	83 ec 0c             	sub    $0xc,%esp
+    1a82:	53                   	push   %ebx
+    1a83:	e8 e4 22 00 00       	call   3d6c <getwmapinfo>
+    1a88:	83 c4 10             	add    $0x10,%esp
+    1a8b:	85 c0                	test   %eax,%eax
+    1a8d:	78 3d                	js     1acc <wmapadjacent+0x15c>
+    1a8f:	8b 95 f4 fd ff ff    	mov    -0x20c(%ebp),%edx
+  printf(stdout, "wmap adjacent ok\n");
+    1a95:	a1 b4 68 00 00       	mov    0x68b4,%eax
+  if(wunmap((uint)a) != 0 || getwmapinfo(&info) < 0 || info.total_mmaps != 0){
+    1a9a:	85 d2                	test   %edx,%edx
+    1a9c:	75 2e                	jne    1acc <wmapadjacent+0x15c>
+  printf(stdout, "wmap adjacent ok\n");
+    1a9e:	83 ec 08             	sub    $0x8,%esp
+    1aa1:	68 30 53 00 00       	push   $0x5330
+    1aa6:	50                   	push   %eax
+    1aa7:	e8 24 24 00 00       	call   3ed0 <printf>
+}
+    1aac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1aaf:	83 c4 10             	add    $0x10,%esp
+    1ab2:	c9                   	leave
+    1ab3:	c3                   	ret
+    printf(stdout, "wmap adjacent: first map lost\n");
+    1ab4:	83 ec 08             	sub    $0x8,%esp
+    1ab7:	68 08 47 00 00       	push   $0x4708
+    1abc:	ff 35 b4 68 00 00    	push   0x68b4
+    1ac2:	e8 09 24 00 00       	call   3ed0 <printf>
+    exit();
+    1ac7:	e8 f8 21 00 00       	call   3cc4 <exit>
+    printf(stdout, "wmap adjacent: wunmap of the first map failed\n");
+    1acc:	83 ec 08             	sub    $0x8,%esp
+    1acf:	68 28 47 00 00       	push   $0x4728
+    1ad4:	ff 35 b4 68 00 00    	push   0x68b4
+    1ada:	e8 f1 23 00 00       	call   3ed0 <printf>
+    exit();
+    1adf:	e8 e0 21 00 00       	call   3cc4 <exit>
+    printf(stdout, "wmap adjacent: wmap failed\n");
+    1ae4:	50                   	push   %eax
+    1ae5:	50                   	push   %eax
+    1ae6:	68 14 53 00 00       	push   $0x5314
+    1aeb:	ff 35 b4 68 00 00    	push   0x68b4
+    1af1:	e8 da 23 00 00       	call   3ed0 <printf>
+    exit();
+    1af6:	e8 c9 21 00 00       	call   3cc4 <exit>
+    printf(stdout, "wmap adjacent: maps were merged\n");
+    1afb:	50                   	push   %eax
+    1afc:	50                   	push   %eax
+    1afd:	68 84 46 00 00       	push   $0x4684
+    1b02:	ff 35 b4 68 00 00    	push   0x68b4
+    1b08:	e8 c3 23 00 00       	call   3ed0 <printf>
+    exit();
+    1b0d:	e8 b2 21 00 00       	call   3cc4 <exit>
+    printf(stdout, "wmap adjacent: wunmap of the second map failed\n");
+    1b12:	51                   	push   %ecx
+    1b13:	51                   	push   %ecx
+    1b14:	68 d8 46 00 00       	push   $0x46d8
+    1b19:	ff 35 b4 68 00 00    	push   0x68b4
+    1b1f:	e8 ac 23 00 00       	call   3ed0 <printf>
+    exit();
+    1b24:	e8 9b 21 00 00       	call   3cc4 <exit>
+    printf(stdout, "wmap adjacent: wremap of the second map failed\n");
+    1b29:	53                   	push   %ebx
+    1b2a:	53                   	push   %ebx
+    1b2b:	68 a8 46 00 00       	push   $0x46a8
+    1b30:	ff 35 b4 68 00 00    	push   0x68b4
+    1b36:	e8 95 23 00 00       	call   3ed0 <printf>
+    exit();
+    1b3b:	e8 84 21 00 00       	call   3cc4 <exit>
+
+00001b40 <bigdir>:
+{
+    1b40:	55                   	push   %ebp
+    1b41:	89 e5                	mov    %esp,%ebp
+    1b43:	57                   	push   %edi
+    1b44:	56                   	push   %esi
+    1b45:	53                   	push   %ebx
+    1b46:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "bigdir test\n");
+    1b49:	68 42 53 00 00       	push   $0x5342
+    1b4e:	6a 01                	push   $0x1
+    1b50:	e8 7b 23 00 00       	call   3ed0 <printf>
+  unlink("bd");
+    1b55:	c7 04 24 4f 53 00 00 	movl   $0x534f,(%esp)
+    1b5c:	e8 b3 21 00 00       	call   3d14 <unlink>
+  fd = open("bd", O_CREATE);
+    1b61:	5a                   	pop    %edx
+    1b62:	59                   	pop    %ecx
+    1b63:	68 00 02 00 00       	push   $0x200
+    1b68:	68 4f 53 00 00       	push   $0x534f
+    1b6d:	e8 92 21 00 00       	call   3d04 <open>
+  if(fd < 0){
+    1b72:	83 c4 10             	add    $0x10,%esp
+    1b75:	85 c0                	test   %eax,%eax
+    1b77:	0f 88 de 00 00 00    	js     1c5b <bigdir+0x11b>
+  close(fd);
+    1b7d:	83 ec 0c             	sub    $0xc,%esp
+  for(i = 0; i < 500; i++){
+    1b80:	31 f6                	xor    %esi,%esi
+    1b82:	8d 7d de             	lea    -0x22(%ebp),%edi
+  close(fd);
+    1b85:	50                   	push   %eax
+    1b86:	e8 61 21 00 00       	call   3cec <close>
+    1b8b:	83 c4 10             	add    $0x10,%esp
+    1b8e:	66 90                	xchg   %ax,%ax
+    name[1] = '0' + (i / 64);
+    1b90:	89 f0                	mov    %esi,%eax
+    if(link("bd", name) != 0){
+    1b92:	83 ec 08             	sub    $0x8,%esp
+    name[0] = 'x';
+    1b95:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1b99:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1b9c:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1ba0:	83 c0 30             	add    $0x30,%eax
+    1ba3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1ba6:	89 f0                	mov    %esi,%eax
+    1ba8:	83 e0 3f             	and    $0x3f,%eax
+    1bab:	83 c0 30             	add    $0x30,%eax
+    1bae:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(link("bd", name) != 0){
+    1bb1:	57                   	push   %edi
+    1bb2:	68 4f 53 00 00       	push   $0x534f
+    1bb7:	e8 68 21 00 00       	call   3d24 <link>
+    1bbc:	83 c4 10             	add    $0x10,%esp
+    1bbf:	89 c3                	mov    %eax,%ebx
+    1bc1:	85 c0                	test   %eax,%eax
+    1bc3:	75 6e                	jne    1c33 <bigdir+0xf3>
+  for(i = 0; i < 500; i++){
+    1bc5:	83 c6 01             	add    $0x1,%esi
+    1bc8:	81 fe f4 01 00 00    	cmp    $0x1f4,%esi
+    1bce:	75 c0                	jne    1b90 <bigdir+0x50>
+  unlink("bd");
+    1bd0:	83 ec 0c             	sub    $0xc,%esp
+    1bd3:	68 4f 53 00 00       	push   $0x534f
+    1bd8:	e8 37 21 00 00       	call   3d14 <unlink>
+    1bdd:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + (i / 64);
+    1be0:	89 d8                	mov    %ebx,%eax
+    if(unlink(name) != 0){
+    1be2:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'x';
+    1be5:	c6 45 de 78          	movb   $0x78,-0x22(%ebp)
+    name[1] = '0' + (i / 64);
+    1be9:	c1 f8 06             	sar    $0x6,%eax
+    name[3] = '\0';
+    1bec:	c6 45 e1 00          	movb   $0x0,-0x1f(%ebp)
+    name[1] = '0' + (i / 64);
+    1bf0:	83 c0 30             	add    $0x30,%eax
+    1bf3:	88 45 df             	mov    %al,-0x21(%ebp)
+    name[2] = '0' + (i % 64);
+    1bf6:	89 d8                	mov    %ebx,%eax
+    1bf8:	83 e0 3f             	and    $0x3f,%eax
+    1bfb:	83 c0 30             	add    $0x30,%eax
+    1bfe:	88 45 e0             	mov    %al,-0x20(%ebp)
+    if(unlink(name) != 0){
+    1c01:	57                   	push   %edi
+    1c02:	e8 0d 21 00 00       	call   3d14 <unlink>
+    1c07:	83 c4 10             	add    $0x10,%esp
+    1c0a:	85 c0                	test   %eax,%eax
+    1c0c:	75 39                	jne    1c47 <bigdir+0x107>
+  for(i = 0; i < 500; i++){
+    1c0e:	83 c3 01             	add    $0x1,%ebx
+    1c11:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+    1c17:	75 c7                	jne    1be0 <bigdir+0xa0>
+  printf(1, "bigdir ok\n");
+    1c19:	83 ec 08             	sub    $0x8,%esp
+    1c1c:	68 91 53 00 00       	push   $0x5391
+    1c21:	6a 01                	push   $0x1
+    1c23:	e8 a8 22 00 00       	call   3ed0 <printf>
+    1c28:	83 c4 10             	add    $0x10,%esp
+}
+    1c2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    1c2e:	5b                   	pop    %ebx
+    1c2f:	5e                   	pop    %esi
+    1c30:	5f                   	pop    %edi
+    1c31:	5d                   	pop    %ebp
+    1c32:	c3                   	ret
+      printf(1, "bigdir link failed\n");
+    1c33:	83 ec 08             	sub    $0x8,%esp
+    1c36:	68 68 53 00 00       	push   $0x5368
+    1c3b:	6a 01                	push   $0x1
+    1c3d:	e8 8e 22 00 00       	call   3ed0 <printf>
+      exit();
+    1c42:	e8 7d 20 00 00       	call   3cc4 <exit>
+      printf(1, "bigdir unlink failed");
+    1c47:	83 ec 08             	sub    $0x8,%esp
+    1c4a:	68 7c 53 00 00       	push   $0x537c
+    1c4f:	6a 01                	push   $0x1
+    1c51:	e8 7a 22 00 00       	call   3ed0 <printf>
+      exit();
+    1c56:	e8 69 20 00 00       	call   3cc4 <exit>
+    printf(1, "bigdir create failed\n");
+    1c5b:	50                   	push   %eax
+    1c5c:	50                   	push   %eax
+    1c5d:	68 52 53 00 00       	push   $0x5352
+    1c62:	6a 01                	push   $0x1
+    1c64:	e8 67 22 00 00       	call   3ed0 <printf>
+    exit();
+    1c69:	e8 56 20 00 00       	call   3cc4 <exit>
+    1c6e:	66 90                	xchg   %ax,%ax
+
+00001c70 <iputtest>:
+{
+    1c70:	55                   	push   %ebp
+    1c71:	89 e5                	mov    %esp,%ebp
+    1c73:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "iput test\n");
+    1c76:	68 30 54 00 00       	push   $0x5430
+    1c7b:	ff 35 b4 68 00 00    	push   0x68b4
+    1c81:	e8 4a 22 00 00       	call   3ed0 <printf>
+  if(mkdir("iputdir") < 0){
+    1c86:	c7 04 24 c3 53 00 00 	movl   $0x53c3,(%esp)
+    1c8d:	e8 9a 20 00 00       	call   3d2c <mkdir>
+    1c92:	83 c4 10             	add    $0x10,%esp
+    1c95:	85 c0                	test   %eax,%eax
+    1c97:	78 58                	js     1cf1 <iputtest+0x81>
+  if(chdir("iputdir") < 0){
+    1c99:	83 ec 0c             	sub    $0xc,%esp
+    1c9c:	68 c3 53 00 00       	push   $0x53c3
+    1ca1:	e8 8e 20 00 00       	call   3d34 <chdir>
+    1ca6:	83 c4 10             	add    $0x10,%esp
+    1ca9:	85 c0                	test   %eax,%eax
+    1cab:	0f 88 85 00 00 00    	js     1d36 <iputtest+0xc6>
+  if(unlink("../iputdir") < 0){
+    1cb1:	83 ec 0c             	sub    $0xc,%esp
+    1cb4:	68 c0 53 00 00       	push   $0x53c0
+    1cb9:	e8 56 20 00 00       	call   3d14 <unlink>
+    1cbe:	83 c4 10             	add    $0x10,%esp
+    1cc1:	85 c0                	test   %eax,%eax
+    1cc3:	78 5a                	js     1d1f <iputtest+0xaf>
+  if(chdir("/") < 0){
+    1cc5:	83 ec 0c             	sub    $0xc,%esp
+    1cc8:	68 e5 53 00 00       	push   $0x53e5
+    1ccd:	e8 62 20 00 00       	call   3d34 <chdir>
+    1cd2:	83 c4 10             	add    $0x10,%esp
+    1cd5:	85 c0                	test   %eax,%eax
+    1cd7:	78 2f                	js     1d08 <iputtest+0x98>
+  printf(stdout, "iput test ok\n");
+    1cd9:	83 ec 08             	sub    $0x8,%esp
+    1cdc:	68 59 54 00 00       	push   $0x5459
+    1ce1:	ff 35 b4 68 00 00    	push   0x68b4
+    1ce7:	e8 e4 21 00 00       	call   3ed0 <printf>
+}
+    1cec:	83 c4 10             	add    $0x10,%esp
+    1cef:	c9                   	leave
+    1cf0:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+    1cf1:	50                   	push   %eax
+    1cf2:	50                   	push   %eax
+    1cf3:	68 9c 53 00 00       	push   $0x539c
+    1cf8:	ff 35 b4 68 00 00    	push   0x68b4
+    1cfe:	e8 cd 21 00 00       	call   3ed0 <printf>
+    exit();
+    1d03:	e8 bc 1f 00 00       	call   3cc4 <exit>
+    printf(stdout, "chdir / failed\n");
+    1d08:	50                   	push   %eax
+    1d09:	50                   	push   %eax
+    1d0a:	68 e7 53 00 00       	push   $0x53e7
+    1d0f:	ff 35 b4 68 00 00    	push   0x68b4
+    1d15:	e8 b6 21 00 00       	call   3ed0 <printf>
+    exit();
+    1d1a:	e8 a5 1f 00 00       	call   3cc4 <exit>
+    printf(stdout, "unlink ../iputdir failed\n");
+    1d1f:	52                   	push   %edx
+    1d20:	52                   	push   %edx
+    1d21:	68 cb 53 00 00       	push   $0x53cb
+    1d26:	ff 35 b4 68 00 00    	push   0x68b4
+    1d2c:	e8 9f 21 00 00       	call   3ed0 <printf>
+    exit();
+    1d31:	e8 8e 1f 00 00       	call   3cc4 <exit>
+    printf(stdout, "chdir iputdir failed\n");
+    1d36:	51                   	push   %ecx
+    1d37:	51                   	push   %ecx
+    1d38:	68 aa 53 00 00       	push   $0x53aa
+    1d3d:	ff 35 b4 68 00 00    	push   0x68b4
+    1d43:	e8 88 21 00 00       	call   3ed0 <printf>
+    exit();
+    1d48:	e8 77 1f 00 00       	call   3cc4 <exit>
+    1d4d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00001d50 <exitiputtest>:
+{
+    1d50:	55                   	push   %ebp
+    1d51:	89 e5                	mov    %esp,%ebp
+    1d53:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exitiput test\n");
+    1d56:	68 f7 53 00 00       	push   $0x53f7
+    1d5b:	ff 35 b4 68 00 00    	push   0x68b4
+    1d61:	e8 6a 21 00 00       	call   3ed0 <printf>
+  pid = fork();
+    1d66:	e8 51 1f 00 00       	call   3cbc <fork>
+  if(pid < 0){
+    1d6b:	83 c4 10             	add    $0x10,%esp
+    1d6e:	85 c0                	test   %eax,%eax
+    1d70:	0f 88 8a 00 00 00    	js     1e00 <exitiputtest+0xb0>
+  if(pid == 0){
+    1d76:	75 50                	jne    1dc8 <exitiputtest+0x78>
+    if(mkdir("iputdir") < 0){
+    1d78:	83 ec 0c             	sub    $0xc,%esp
+    1d7b:	68 c3 53 00 00       	push   $0x53c3
+    1d80:	e8 a7 1f 00 00       	call   3d2c <mkdir>
+    1d85:	83 c4 10             	add    $0x10,%esp
+    1d88:	85 c0                	test   %eax,%eax
+    1d8a:	0f 88 87 00 00 00    	js     1e17 <exitiputtest+0xc7>
+    if(chdir("iputdir") < 0){
+    1d90:	83 ec 0c             	sub    $0xc,%esp
+    1d93:	68 c3 53 00 00       	push   $0x53c3
+    1d98:	e8 97 1f 00 00       	call   3d34 <chdir>
+    1d9d:	83 c4 10             	add    $0x10,%esp
+    1da0:	85 c0                	test   %eax,%eax
+    1da2:	0f 88 86 00 00 00    	js     1e2e <exitiputtest+0xde>
+    if(unlink("../iputdir") < 0){
+    1da8:	83 ec 0c             	sub    $0xc,%esp
+    1dab:	68 c0 53 00 00       	push   $0x53c0
+    1db0:	e8 5f 1f 00 00       	call   3d14 <unlink>
+    1db5:	83 c4 10             	add    $0x10,%esp
+    1db8:	85 c0                	test   %eax,%eax
+    1dba:	78 2c                	js     1de8 <exitiputtest+0x98>
+    exit();
+    1dbc:	e8 03 1f 00 00       	call   3cc4 <exit>
+    1dc1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  wait();
+    1dc8:	e8 ff 1e 00 00       	call   3ccc <wait>
+  printf(stdout, "exitiput test ok\n");
+    1dcd:	83 ec 08             	sub    $0x8,%esp
+    1dd0:	68 1a 54 00 00       	push   $0x541a
+    1dd5:	ff 35 b4 68 00 00    	push   0x68b4
+    1ddb:	e8 f0 20 00 00       	call   3ed0 <printf>
+}
+    1de0:	83 c4 10             	add    $0x10,%esp
+    1de3:	c9                   	leave
+    1de4:	c3                   	ret
+    1de5:	8d 76 00             	lea    0x0(%esi),%esi
+      printf(stdout, "unlink ../iputdir failed\n");
+    1de8:	83 ec 08             	sub    $0x8,%esp
+    1deb:	68 cb 53 00 00       	push   $0x53cb
+    1df0:	ff 35 b4 68 00 00    	push   0x68b4
+    1df6:	e8 d5 20 00 00       	call   3ed0 <printf>
+      exit();
+    1dfb:	e8 c4 1e 00 00       	call   3cc4 <exit>
+    printf(stdout, "fork failed\n");
+    1e00:	51                   	push   %ecx
+    1e01:	51                   	push   %ecx
+    1e02:	68 81 5b 00 00       	push   $0x5b81
+    1e07:	ff 35 b4 68 00 00    	push   0x68b4
+    1e0d:	e8 be 20 00 00       	call   3ed0 <printf>
+    exit();
+    1e12:	e8 ad 1e 00 00       	call   3cc4 <exit>
+      printf(stdout, "mkdir failed\n");
+    1e17:	52                   	push   %edx
+    1e18:	52                   	push   %edx
+    1e19:	68 9c 53 00 00       	push   $0x539c
+    1e1e:	ff 35 b4 68 00 00    	push   0x68b4
+    1e24:	e8 a7 20 00 00       	call   3ed0 <printf>
+      exit();
+    1e29:	e8 96 1e 00 00       	call   3cc4 <exit>
+      printf(stdout, "child chdir failed\n");
+    1e2e:	50                   	push   %eax
+    1e2f:	50                   	push   %eax
+    1e30:	68 06 54 00 00       	push   $0x5406
+    1e35:	ff 35 b4 68 00 00    	push   0x68b4
+    1e3b:	e8 90 20 00 00       	call   3ed0 <printf>
+      exit();
+    1e40:	e8 7f 1e 00 00       	call   3cc4 <exit>
+    1e45:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1e4c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00001e50 <openiputtest>:
+{
+    1e50:	55                   	push   %ebp
+    1e51:	89 e5                	mov    %esp,%ebp
+    1e53:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "openiput test\n");
+    1e56:	68 2c 54 00 00       	push   $0x542c
+    1e5b:	ff 35 b4 68 00 00    	push   0x68b4
+    1e61:	e8 6a 20 00 00       	call   3ed0 <printf>
+  if(mkdir("oidir") < 0){
+    1e66:	c7 04 24 3b 54 00 00 	movl   $0x543b,(%esp)
+    1e6d:	e8 ba 1e 00 00       	call   3d2c <mkdir>
+    1e72:	83 c4 10             	add    $0x10,%esp
+    1e75:	85 c0                	test   %eax,%eax
+    1e77:	0f 88 9f 00 00 00    	js     1f1c <openiputtest+0xcc>
+  pid = fork();
+    1e7d:	e8 3a 1e 00 00       	call   3cbc <fork>
+  if(pid < 0){
+    1e82:	85 c0                	test   %eax,%eax
+    1e84:	78 7f                	js     1f05 <openiputtest+0xb5>
+  if(pid == 0){
+    1e86:	75 38                	jne    1ec0 <openiputtest+0x70>
+    int fd = open("oidir", O_RDWR);
+    1e88:	83 ec 08             	sub    $0x8,%esp
+    1e8b:	6a 02                	push   $0x2
+    1e8d:	68 3b 54 00 00       	push   $0x543b
+    1e92:	e8 6d 1e 00 00       	call   3d04 <open>
+    if(fd >= 0){
+    1e97:	83 c4 10             	add    $0x10,%esp
+    1e9a:	85 c0                	test   %eax,%eax
+    1e9c:	78 62                	js     1f00 <openiputtest+0xb0>
+      printf(stdout, "open directory for write succeeded\n");
+    1e9e:	83 ec 08             	sub    $0x8,%esp
+    1ea1:	68 58 47 00 00       	push   $0x4758
+    1ea6:	ff 35 b4 68 00 00    	push   0x68b4
+    1eac:	e8 1f 20 00 00       	call   3ed0 <printf>
+      exit();
+    1eb1:	e8 0e 1e 00 00       	call   3cc4 <exit>
+    1eb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    1ebd:	8d 76 00             	lea    0x0(%esi),%esi
+  sleep(1);
+    1ec0:	83 ec 0c             	sub    $0xc,%esp
+    1ec3:	6a 01                	push   $0x1
+    1ec5:	e8 8a 1e 00 00       	call   3d54 <sleep>
+  if(unlink("oidir") != 0){
+    1eca:	c7 04 24 3b 54 00 00 	movl   $0x543b,(%esp)
+    1ed1:	e8 3e 1e 00 00       	call   3d14 <unlink>
+    1ed6:	83 c4 10             	add    $0x10,%esp
+    1ed9:	85 c0                	test   %eax,%eax
+    1edb:	75 56                	jne    1f33 <openiputtest+0xe3>
+  wait();
+    1edd:	e8 ea 1d 00 00       	call   3ccc <wait>
+  printf(stdout, "openiput test ok\n");
+    1ee2:	83 ec 08             	sub    $0x8,%esp
+    1ee5:	68 55 54 00 00       	push   $0x5455
+    1eea:	ff 35 b4 68 00 00    	push   0x68b4
+    1ef0:	e8 db 1f 00 00       	call   3ed0 <printf>
+}
+    1ef5:	83 c4 10             	add    $0x10,%esp
+    1ef8:	c9                   	leave
+    1ef9:	c3                   	ret
+    1efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    exit();
+    1f00:	e8 bf 1d 00 00       	call   3cc4 <exit>
+    printf(stdout, "fork failed\n");
+    1f05:	52                   	push   %edx
+    1f06:	52                   	push   %edx
+    1f07:	68 81 5b 00 00       	push   $0x5b81
+    1f0c:	ff 35 b4 68 00 00    	push   0x68b4
+    1f12:	e8 b9 1f 00 00       	call   3ed0 <printf>
+    exit();
+    1f17:	e8 a8 1d 00 00       	call   3cc4 <exit>
+    printf(stdout, "mkdir oidir failed\n");
+    1f1c:	51                   	push   %ecx
+    1f1d:	51                   	push   %ecx
+    1f1e:	68 41 54 00 00       	push   $0x5441
+    1f23:	ff 35 b4 68 00 00    	push   0x68b4
+    1f29:	e8 a2 1f 00 00       	call   3ed0 <printf>
+    exit();
+    1f2e:	e8 91 1d 00 00       	call   3cc4 <exit>
+    printf(stdout, "unlink failed\n");
+    1f33:	50                   	push   %eax
+    1f34:	50                   	push   %eax
+    1f35:	68 11 4c 00 00       	push   $0x4c11
+    1f3a:	ff 35 b4 68 00 00    	push   0x68b4
+    1f40:	e8 8b 1f 00 00       	call   3ed0 <printf>
+    exit();
+    1f45:	e8 7a 1d 00 00       	call   3cc4 <exit>
+    1f4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00001f50 <opentest>:
+{
+    1f50:	55                   	push   %ebp
+    1f51:	89 e5                	mov    %esp,%ebp
+    1f53:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "open test\n");
+    1f56:	68 67 54 00 00       	push   $0x5467
+    1f5b:	ff 35 b4 68 00 00    	push   0x68b4
+    1f61:	e8 6a 1f 00 00       	call   3ed0 <printf>
+  fd = open("echo", 0);
+    1f66:	58                   	pop    %eax
+    1f67:	5a                   	pop    %edx
+    1f68:	6a 00                	push   $0x0
+    1f6a:	68 72 54 00 00       	push   $0x5472
+    1f6f:	e8 90 1d 00 00       	call   3d04 <open>
+  if(fd < 0){
+    1f74:	83 c4 10             	add    $0x10,%esp
+    1f77:	85 c0                	test   %eax,%eax
+    1f79:	78 36                	js     1fb1 <opentest+0x61>
+  close(fd);
+    1f7b:	83 ec 0c             	sub    $0xc,%esp
+    1f7e:	50                   	push   %eax
+    1f7f:	e8 68 1d 00 00       	call   3cec <close>
+  fd = open("doesnotexist", 0);
+    1f84:	5a                   	pop    %edx
+    1f85:	59                   	pop    %ecx
+    1f86:	6a 00                	push   $0x0
+    1f88:	68 8a 54 00 00       	push   $0x548a
+    1f8d:	e8 72 1d 00 00       	call   3d04 <open>
+  if(fd >= 0){
+    1f92:	83 c4 10             	add    $0x10,%esp
+    1f95:	85 c0                	test   %eax,%eax
+    1f97:	79 2f                	jns    1fc8 <opentest+0x78>
+  printf(stdout, "open test ok\n");
+    1f99:	83 ec 08             	sub    $0x8,%esp
+    1f9c:	68 b5 54 00 00       	push   $0x54b5
+    1fa1:	ff 35 b4 68 00 00    	push   0x68b4
+    1fa7:	e8 24 1f 00 00       	call   3ed0 <printf>
+}
+    1fac:	83 c4 10             	add    $0x10,%esp
+    1faf:	c9                   	leave
+    1fb0:	c3                   	ret
+    printf(stdout, "open echo failed!\n");
+    1fb1:	50                   	push   %eax
+    1fb2:	50                   	push   %eax
+    1fb3:	68 77 54 00 00       	push   $0x5477
+    1fb8:	ff 35 b4 68 00 00    	push   0x68b4
+    1fbe:	e8 0d 1f 00 00       	call   3ed0 <printf>
+    exit();
+    1fc3:	e8 fc 1c 00 00       	call   3cc4 <exit>
+    printf(stdout, "open doesnotexist succeeded!\n");
+    1fc8:	50                   	push   %eax
+    1fc9:	50                   	push   %eax
+    1fca:	68 97 54 00 00       	push   $0x5497
+    1fcf:	ff 35 b4 68 00 00    	push   0x68b4
+    1fd5:	e8 f6 1e 00 00       	call   3ed0 <printf>
+    exit();
+    1fda:	e8 e5 1c 00 00       	call   3cc4 <exit>
+    1fdf:	90                   	nop
+
+00001fe0 <dirtest>:
+{
+    1fe0:	55                   	push   %ebp
+    1fe1:	89 e5                	mov    %esp,%ebp
+    1fe3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "mkdir test\n");
+    1fe6:	68 c3 54 00 00       	push   $0x54c3
+    1feb:	ff 35 b4 68 00 00    	push   0x68b4
+    1ff1:	e8 da 1e 00 00       	call   3ed0 <printf>
+  if(mkdir("dir0") < 0){
+    1ff6:	c7 04 24 cf 54 00 00 	movl   $0x54cf,(%esp)
+    1ffd:	e8 2a 1d 00 00       	call   3d2c <mkdir>
+    2002:	83 c4 10             	add    $0x10,%esp
+    2005:	85 c0                	test   %eax,%eax
+    2007:	78 58                	js     2061 <dirtest+0x81>
+  if(chdir("dir0") < 0){
+    2009:	83 ec 0c             	sub    $0xc,%esp
+    200c:	68 cf 54 00 00       	push   $0x54cf
+    2011:	e8 1e 1d 00 00       	call   3d34 <chdir>
+    2016:	83 c4 10             	add    $0x10,%esp
+    2019:	85 c0                	test   %eax,%eax
+    201b:	0f 88 85 00 00 00    	js     20a6 <dirtest+0xc6>
+  if(chdir("..") < 0){
+    2021:	83 ec 0c             	sub    $0xc,%esp
+    2024:	68 18 51 00 00       	push   $0x5118
+    2029:	e8 06 1d 00 00       	call   3d34 <chdir>
+    202e:	83 c4 10             	add    $0x10,%esp
+    2031:	85 c0                	test   %eax,%eax
+    2033:	78 5a                	js     208f <dirtest+0xaf>
+  if(unlink("dir0") < 0){
+    2035:	83 ec 0c             	sub    $0xc,%esp
+    2038:	68 cf 54 00 00       	push   $0x54cf
+    203d:	e8 d2 1c 00 00       	call   3d14 <unlink>
+    2042:	83 c4 10             	add    $0x10,%esp
+    2045:	85 c0                	test   %eax,%eax
+    2047:	78 2f                	js     2078 <dirtest+0x98>
+  printf(stdout, "mkdir test ok\n");
+    2049:	83 ec 08             	sub    $0x8,%esp
+    204c:	68 0c 55 00 00       	push   $0x550c
+    2051:	ff 35 b4 68 00 00    	push   0x68b4
+    2057:	e8 74 1e 00 00       	call   3ed0 <printf>
+}
+    205c:	83 c4 10             	add    $0x10,%esp
+    205f:	c9                   	leave
+    2060:	c3                   	ret
+    printf(stdout, "mkdir failed\n");
+    2061:	50                   	push   %eax
+    2062:	50                   	push   %eax
+    2063:	68 9c 53 00 00       	push   $0x539c
+    2068:	ff 35 b4 68 00 00    	push   0x68b4
+    206e:	e8 5d 1e 00 00       	call   3ed0 <printf>
+    exit();
+    2073:	e8 4c 1c 00 00       	call   3cc4 <exit>
+    printf(stdout, "unlink dir0 failed\n");
+    2078:	50                   	push   %eax
+    2079:	50                   	push   %eax
+    207a:	68 f8 54 00 00       	push   $0x54f8
+    207f:	ff 35 b4 68 00 00    	push   0x68b4
+    2085:	e8 46 1e 00 00       	call   3ed0 <printf>
+    exit();
+    208a:	e8 35 1c 00 00       	call   3cc4 <exit>
+    printf(stdout, "chdir .. failed\n");
+    208f:	52                   	push   %edx
+    2090:	52                   	push   %edx
+    2091:	68 e7 54 00 00       	push   $0x54e7
+    2096:	ff 35 b4 68 00 00    	push   0x68b4
+    209c:	e8 2f 1e 00 00       	call   3ed0 <printf>
+    exit();
+    20a1:	e8 1e 1c 00 00       	call   3cc4 <exit>
+    printf(stdout, "chdir dir0 failed\n");
+    20a6:	51                   	push   %ecx
+    20a7:	51                   	push   %ecx
+    20a8:	68 d4 54 00 00       	push   $0x54d4
+    20ad:	ff 35 b4 68 00 00    	push   0x68b4
+    20b3:	e8 18 1e 00 00       	call   3ed0 <printf>
+    exit();
+    20b8:	e8 07 1c 00 00       	call   3cc4 <exit>
+    20bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000020c0 <exectest>:
+{
+    20c0:	55                   	push   %ebp
+    20c1:	89 e5                	mov    %esp,%ebp
+    20c3:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "exec test\n");
+    20c6:	68 1b 55 00 00       	push   $0x551b
+    20cb:	ff 35 b4 68 00 00    	push   0x68b4
+    20d1:	e8 fa 1d 00 00       	call   3ed0 <printf>
+  if(exec("echo", echoargv) < 0){
+    20d6:	5a                   	pop    %edx
+    20d7:	59                   	pop    %ecx
+    20d8:	68 b8 68 00 00       	push   $0x68b8
+    20dd:	68 72 54 00 00       	push   $0x5472
+    20e2:	e8 15 1c 00 00       	call   3cfc <exec>
+    20e7:	83 c4 10             	add    $0x10,%esp
+    20ea:	85 c0                	test   %eax,%eax
+    20ec:	78 02                	js     20f0 <exectest+0x30>
+}
+    20ee:	c9                   	leave
+    20ef:	c3                   	ret
+    printf(stdout, "exec echo failed\n");
+    20f0:	50                   	push   %eax
+    20f1:	50                   	push   %eax
+    20f2:	68 26 55 00 00       	push   $0x5526
+    20f7:	ff 35 b4 68 00 00    	push   0x68b4
+    20fd:	e8 ce 1d 00 00       	call   3ed0 <printf>
+    exit();
+    2102:	e8 bd 1b 00 00       	call   3cc4 <exit>
+    2107:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    210e:	66 90                	xchg   %ax,%ax
+
+00002110 <pipe1>:
+{
+    2110:	55                   	push   %ebp
+    2111:	89 e5                	mov    %esp,%ebp
+    2113:	57                   	push   %edi
+    2114:	56                   	push   %esi
+  if(pipe(fds) != 0){
+    2115:	8d 45 e0             	lea    -0x20(%ebp),%eax
+{
+    2118:	53                   	push   %ebx
+    2119:	83 ec 28             	sub    $0x28,%esp
+  if(pipe(fds) != 0){
+    211c:	50                   	push   %eax
+    211d:	e8 b2 1b 00 00       	call   3cd4 <pipe>
+    2122:	83 c4 10             	add    $0x10,%esp
+    2125:	85 c0                	test   %eax,%eax
+    2127:	0f 85 41 01 00 00    	jne    226e <pipe1+0x15e>
+    212d:	89 c6                	mov    %eax,%esi
+  pid = fork();
+    212f:	e8 88 1b 00 00       	call   3cbc <fork>
+  if(pid == 0){
+    2134:	85 c0                	test   %eax,%eax
+    2136:	0f 84 92 00 00 00    	je     21ce <pipe1+0xbe>
+  } else if(pid > 0){
+    213c:	0f 8e 3f 01 00 00    	jle    2281 <pipe1+0x171>
+    close(fds[1]);
+    2142:	83 ec 0c             	sub    $0xc,%esp
+    2145:	ff 75 e4             	push   -0x1c(%ebp)
+    total = 0;
+    2148:	31 db                	xor    %ebx,%ebx
+    cc = 1;
+    214a:	bf 01 00 00 00       	mov    $0x1,%edi
+    close(fds[1]);
+    214f:	e8 98 1b 00 00       	call   3cec <close>
+    while((n = read(fds[0], buf, cc)) > 0){
+    2154:	83 c4 10             	add    $0x10,%esp
+    2157:	83 ec 04             	sub    $0x4,%esp
+    215a:	57                   	push   %edi
+    215b:	68 00 90 00 00       	push   $0x9000
+    2160:	ff 75 e0             	push   -0x20(%ebp)
+    2163:	e8 74 1b 00 00       	call   3cdc <read>
+    2168:	83 c4 10             	add    $0x10,%esp
+    216b:	89 c1                	mov    %eax,%ecx
+    216d:	85 c0                	test   %eax,%eax
+    216f:	0f 8e b8 00 00 00    	jle    222d <pipe1+0x11d>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+    2175:	89 f0                	mov    %esi,%eax
+    2177:	32 05 00 90 00 00    	xor    0x9000,%al
+    217d:	0f b6 c0             	movzbl %al,%eax
+    2180:	85 c0                	test   %eax,%eax
+    2182:	75 30                	jne    21b4 <pipe1+0xa4>
+    2184:	83 c6 01             	add    $0x1,%esi
+    2187:	eb 0f                	jmp    2198 <pipe1+0x88>
+    2189:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2190:	38 90 00 90 00 00    	cmp    %dl,0x9000(%eax)
+    2196:	75 1c                	jne    21b4 <pipe1+0xa4>
+    2198:	8d 14 06             	lea    (%esi,%eax,1),%edx
+      for(i = 0; i < n; i++){
+    219b:	83 c0 01             	add    $0x1,%eax
+    219e:	39 c1                	cmp    %eax,%ecx
+    21a0:	75 ee                	jne    2190 <pipe1+0x80>
+      cc = cc * 2;
+    21a2:	01 ff                	add    %edi,%edi
+      if(cc > sizeof(buf))
+    21a4:	b8 00 20 00 00       	mov    $0x2000,%eax
+      total += n;
+    21a9:	01 cb                	add    %ecx,%ebx
+      if(cc > sizeof(buf))
+    21ab:	89 d6                	mov    %edx,%esi
+    21ad:	39 c7                	cmp    %eax,%edi
+    21af:	0f 4f f8             	cmovg  %eax,%edi
+    21b2:	eb a3                	jmp    2157 <pipe1+0x47>
+          printf(1, "pipe1 oops 2\n");
+    21b4:	83 ec 08             	sub    $0x8,%esp
+    21b7:	68 55 55 00 00       	push   $0x5555
+    21bc:	6a 01                	push   $0x1
+    21be:	e8 0d 1d 00 00       	call   3ed0 <printf>
+    21c3:	83 c4 10             	add    $0x10,%esp
+}
+    21c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    21c9:	5b                   	pop    %ebx
+    21ca:	5e                   	pop    %esi
+    21cb:	5f                   	pop    %edi
+    21cc:	5d                   	pop    %ebp
+    21cd:	c3                   	ret
+    close(fds[0]);
+    21ce:	83 ec 0c             	sub    $0xc,%esp
+    21d1:	ff 75 e0             	push   -0x20(%ebp)
+  seq = 0;
+    21d4:	31 db                	xor    %ebx,%ebx
+    close(fds[0]);
+    21d6:	e8 11 1b 00 00       	call   3cec <close>
+    21db:	83 c4 10             	add    $0x10,%esp
+    21de:	66 90                	xchg   %ax,%ax
+      for(i = 0; i < 1033; i++)
+    21e0:	31 c0                	xor    %eax,%eax
+    21e2:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+        buf[i] = seq++;
+    21e8:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+      for(i = 0; i < 1033; i++)
+    21eb:	83 c0 01             	add    $0x1,%eax
+        buf[i] = seq++;
+    21ee:	88 90 ff 8f 00 00    	mov    %dl,0x8fff(%eax)
+      for(i = 0; i < 1033; i++)
+    21f4:	3d 09 04 00 00       	cmp    $0x409,%eax
+    21f9:	75 ed                	jne    21e8 <pipe1+0xd8>
+      if(write(fds[1], buf, 1033) != 1033){
+    21fb:	83 ec 04             	sub    $0x4,%esp
+        buf[i] = seq++;
+    21fe:	81 c3 09 04 00 00    	add    $0x409,%ebx
+      if(write(fds[1], buf, 1033) != 1033){
+    2204:	68 09 04 00 00       	push   $0x409
+    2209:	68 00 90 00 00       	push   $0x9000
+    220e:	ff 75 e4             	push   -0x1c(%ebp)
+    2211:	e8 ce 1a 00 00       	call   3ce4 <write>
+    2216:	83 c4 10             	add    $0x10,%esp
+    2219:	3d 09 04 00 00       	cmp    $0x409,%eax
+    221e:	75 74                	jne    2294 <pipe1+0x184>
+    for(n = 0; n < 5; n++){
+    2220:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+    2226:	75 b8                	jne    21e0 <pipe1+0xd0>
+    exit();
+    2228:	e8 97 1a 00 00       	call   3cc4 <exit>
+    if(total != 5 * 1033){
+    222d:	81 fb 2d 14 00 00    	cmp    $0x142d,%ebx
+    2233:	75 26                	jne    225b <pipe1+0x14b>
+    close(fds[0]);
+    2235:	83 ec 0c             	sub    $0xc,%esp
+    2238:	ff 75 e0             	push   -0x20(%ebp)
+    223b:	e8 ac 1a 00 00       	call   3cec <close>
+    wait();
+    2240:	e8 87 1a 00 00       	call   3ccc <wait>
+  printf(1, "pipe1 ok\n");
+    2245:	5a                   	pop    %edx
+    2246:	59                   	pop    %ecx
+    2247:	68 7a 55 00 00       	push   $0x557a
+    224c:	6a 01                	push   $0x1
+    224e:	e8 7d 1c 00 00       	call   3ed0 <printf>
+    2253:	83 c4 10             	add    $0x10,%esp
+    2256:	e9 6b ff ff ff       	jmp    21c6 <pipe1+0xb6>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+    225b:	56                   	push   %esi
+    225c:	53                   	push   %ebx
+    225d:	68 63 55 00 00       	push   $0x5563
+    2262:	6a 01                	push   $0x1
+    2264:	e8 67 1c 00 00       	call   3ed0 <printf>
+      exit();
+    2269:	e8 56 1a 00 00       	call   3cc4 <exit>
+    printf(1, "pipe() failed\n");
+    226e:	50                   	push   %eax
+    226f:	50                   	push   %eax
+    2270:	68 38 55 00 00       	push   $0x5538
+    2275:	6a 01                	push   $0x1
+    2277:	e8 54 1c 00 00       	call   3ed0 <printf>
+    exit();
+    227c:	e8 43 1a 00 00       	call   3cc4 <exit>
+    printf(1, "fork() failed\n");
+    2281:	50                   	push   %eax
+    2282:	50                   	push   %eax
+    2283:	68 84 55 00 00       	push   $0x5584
+    2288:	6a 01                	push   $0x1
+    228a:	e8 41 1c 00 00       	call   3ed0 <printf>
+    exit();
+    228f:	e8 30 1a 00 00       	call   3cc4 <exit>
+        printf(1, "pipe1 oops 1\n");
+    2294:	57                   	push   %edi
+    2295:	57                   	push   %edi
+    2296:	68 47 55 00 00       	push   $0x5547
+    229b:	6a 01                	push   $0x1
+    229d:	e8 2e 1c 00 00       	call   3ed0 <printf>
+        exit();
+    22a2:	e8 1d 1a 00 00       	call   3cc4 <exit>
+    22a7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22ae:	66 90                	xchg   %ax,%ax
+
+000022b0 <preempt>:
+{
+    22b0:	55                   	push   %ebp
+    22b1:	89 e5                	mov    %esp,%ebp
+    22b3:	57                   	push   %edi
+    22b4:	56                   	push   %esi
+    22b5:	53                   	push   %ebx
+    22b6:	83 ec 24             	sub    $0x24,%esp
+  printf(1, "preempt: ");
+    22b9:	68 93 55 00 00       	push   $0x5593
+    22be:	6a 01                	push   $0x1
+    22c0:	e8 0b 1c 00 00       	call   3ed0 <printf>
+  pid1 = fork();
+    22c5:	e8 f2 19 00 00       	call   3cbc <fork>
+  if(pid1 == 0)
+    22ca:	83 c4 10             	add    $0x10,%esp
+    22cd:	85 c0                	test   %eax,%eax
+    22cf:	75 07                	jne    22d8 <preempt+0x28>
+    for(;;)
+    22d1:	eb fe                	jmp    22d1 <preempt+0x21>
+    22d3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    22d7:	90                   	nop
+    22d8:	89 c3                	mov    %eax,%ebx
+  pid2 = fork();
+    22da:	e8 dd 19 00 00       	call   3cbc <fork>
+    22df:	89 c6                	mov    %eax,%esi
+  if(pid2 == 0)
+    22e1:	85 c0                	test   %eax,%eax
+    22e3:	75 0b                	jne    22f0 <preempt+0x40>
+    for(;;)
+    22e5:	eb fe                	jmp    22e5 <preempt+0x35>
+    22e7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    22ee:	66 90                	xchg   %ax,%ax
+  pipe(pfds);
+    22f0:	83 ec 0c             	sub    $0xc,%esp
+    22f3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    22f6:	50                   	push   %eax
+    22f7:	e8 d8 19 00 00       	call   3cd4 <pipe>
+  pid3 = fork();
+    22fc:	e8 bb 19 00 00       	call   3cbc <fork>
+  if(pid3 == 0){
+    2301:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    2304:	89 c7                	mov    %eax,%edi
+  if(pid3 == 0){
+    2306:	85 c0                	test   %eax,%eax
+    2308:	75 3e                	jne    2348 <preempt+0x98>
+    close(pfds[0]);
+    230a:	83 ec 0c             	sub    $0xc,%esp
+    230d:	ff 75 e0             	push   -0x20(%ebp)
+    2310:	e8 d7 19 00 00       	call   3cec <close>
+    if(write(pfds[1], "x", 1) != 1)
+    2315:	83 c4 0c             	add    $0xc,%esp
+    2318:	6a 01                	push   $0x1
+    231a:	68 fc 51 00 00       	push   $0x51fc
+    231f:	ff 75 e4             	push   -0x1c(%ebp)
+    2322:	e8 bd 19 00 00       	call   3ce4 <write>
+    2327:	83 c4 10             	add    $0x10,%esp
+    232a:	83 f8 01             	cmp    $0x1,%eax
+    232d:	0f 85 b8 00 00 00    	jne    23eb <preempt+0x13b>
+    close(pfds[1]);
+    2333:	83 ec 0c             	sub    $0xc,%esp
+    2336:	ff 75 e4             	push   -0x1c(%ebp)
+    2339:	e8 ae 19 00 00       	call   3cec <close>
+    233e:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    2341:	eb fe                	jmp    2341 <preempt+0x91>
+    2343:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2347:	90                   	nop
+  close(pfds[1]);
+    2348:	83 ec 0c             	sub    $0xc,%esp
+    234b:	ff 75 e4             	push   -0x1c(%ebp)
+    234e:	e8 99 19 00 00       	call   3cec <close>
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    2353:	83 c4 0c             	add    $0xc,%esp
+    2356:	68 00 20 00 00       	push   $0x2000
+    235b:	68 00 90 00 00       	push   $0x9000
+    2360:	ff 75 e0             	push   -0x20(%ebp)
+    2363:	e8 74 19 00 00       	call   3cdc <read>
+    2368:	83 c4 10             	add    $0x10,%esp
+    236b:	83 f8 01             	cmp    $0x1,%eax
+    236e:	75 67                	jne    23d7 <preempt+0x127>
+  close(pfds[0]);
+    2370:	83 ec 0c             	sub    $0xc,%esp
+    2373:	ff 75 e0             	push   -0x20(%ebp)
+    2376:	e8 71 19 00 00       	call   3cec <close>
+  printf(1, "kill... ");
+    237b:	58                   	pop    %eax
+    237c:	5a                   	pop    %edx
+    237d:	68 c4 55 00 00       	push   $0x55c4
+    2382:	6a 01                	push   $0x1
+    2384:	e8 47 1b 00 00       	call   3ed0 <printf>
+  kill(pid1);
+    2389:	89 1c 24             	mov    %ebx,(%esp)
+    238c:	e8 63 19 00 00       	call   3cf4 <kill>
+  kill(pid2);
+    2391:	89 34 24             	mov    %esi,(%esp)
+    2394:	e8 5b 19 00 00       	call   3cf4 <kill>
+  kill(pid3);
+    2399:	89 3c 24             	mov    %edi,(%esp)
+    239c:	e8 53 19 00 00       	call   3cf4 <kill>
+  printf(1, "wait... ");
+    23a1:	59                   	pop    %ecx
+    23a2:	5b                   	pop    %ebx
+    23a3:	68 cd 55 00 00       	push   $0x55cd
+    23a8:	6a 01                	push   $0x1
+    23aa:	e8 21 1b 00 00       	call   3ed0 <printf>
+  wait();
+    23af:	e8 18 19 00 00       	call   3ccc <wait>
+  wait();
+    23b4:	e8 13 19 00 00       	call   3ccc <wait>
+  wait();
+    23b9:	e8 0e 19 00 00       	call   3ccc <wait>
+  printf(1, "preempt ok\n");
+    23be:	5e                   	pop    %esi
+    23bf:	5f                   	pop    %edi
+    23c0:	68 d6 55 00 00       	push   $0x55d6
+    23c5:	6a 01                	push   $0x1
+    23c7:	e8 04 1b 00 00       	call   3ed0 <printf>
+    23cc:	83 c4 10             	add    $0x10,%esp
+}
+    23cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    23d2:	5b                   	pop    %ebx
+    23d3:	5e                   	pop    %esi
+    23d4:	5f                   	pop    %edi
+    23d5:	5d                   	pop    %ebp
+    23d6:	c3                   	ret
+    printf(1, "preempt read error");
+    23d7:	83 ec 08             	sub    $0x8,%esp
+    23da:	68 b1 55 00 00       	push   $0x55b1
+    23df:	6a 01                	push   $0x1
+    23e1:	e8 ea 1a 00 00       	call   3ed0 <printf>
+    23e6:	83 c4 10             	add    $0x10,%esp
+    23e9:	eb e4                	jmp    23cf <preempt+0x11f>
+      printf(1, "preempt write error");
+    23eb:	83 ec 08             	sub    $0x8,%esp
+    23ee:	68 9d 55 00 00       	push   $0x559d
+    23f3:	6a 01                	push   $0x1
+    23f5:	e8 d6 1a 00 00       	call   3ed0 <printf>
+    23fa:	83 c4 10             	add    $0x10,%esp
+    23fd:	e9 31 ff ff ff       	jmp    2333 <preempt+0x83>
+    2402:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002410 <exitwait>:
+{
+    2410:	55                   	push   %ebp
+    2411:	89 e5                	mov    %esp,%ebp
+    2413:	56                   	push   %esi
+    2414:	be 64 00 00 00       	mov    $0x64,%esi
+    2419:	53                   	push   %ebx
+    241a:	eb 14                	jmp    2430 <exitwait+0x20>
+    241c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(pid){
+    2420:	74 68                	je     248a <exitwait+0x7a>
+      if(wait() != pid){
+    2422:	e8 a5 18 00 00       	call   3ccc <wait>
+    2427:	39 d8                	cmp    %ebx,%eax
+    2429:	75 2d                	jne    2458 <exitwait+0x48>
+  for(i = 0; i < 100; i++){
+    242b:	83 ee 01             	sub    $0x1,%esi
+    242e:	74 41                	je     2471 <exitwait+0x61>
+    pid = fork();
+    2430:	e8 87 18 00 00       	call   3cbc <fork>
+    2435:	89 c3                	mov    %eax,%ebx
+    if(pid < 0){
+    2437:	85 c0                	test   %eax,%eax
+    2439:	79 e5                	jns    2420 <exitwait+0x10>
+      printf(1, "fork failed\n");
+    243b:	83 ec 08             	sub    $0x8,%esp
+    243e:	68 81 5b 00 00       	push   $0x5b81
+    2443:	6a 01                	push   $0x1
+    2445:	e8 86 1a 00 00       	call   3ed0 <printf>
+      return;
+    244a:	83 c4 10             	add    $0x10,%esp
+}
+    244d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2450:	5b                   	pop    %ebx
+    2451:	5e                   	pop    %esi
+    2452:	5d                   	pop    %ebp
+    2453:	c3                   	ret
+    2454:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        printf(1, "wait wrong pid\n");
+    2458:	83 ec 08             	sub    $0x8,%esp
+    245b:	68 e2 55 00 00       	push   $0x55e2
+    2460:	6a 01                	push   $0x1
+    2462:	e8 69 1a 00 00       	call   3ed0 <printf>
+        return;
+    2467:	83 c4 10             	add    $0x10,%esp
+}
+    246a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    246d:	5b                   	pop    %ebx
+    246e:	5e                   	pop    %esi
+    246f:	5d                   	pop    %ebp
+    2470:	c3                   	ret
+  printf(1, "exitwait ok\n");
+    2471:	83 ec 08             	sub    $0x8,%esp
+    2474:	68 f2 55 00 00       	push   $0x55f2
+    2479:	6a 01                	push   $0x1
+    247b:	e8 50 1a 00 00       	call   3ed0 <printf>
+    2480:	83 c4 10             	add    $0x10,%esp
+}
+    2483:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2486:	5b                   	pop    %ebx
+    2487:	5e                   	pop    %esi
+    2488:	5d                   	pop    %ebp
+    2489:	c3                   	ret
+      exit();
+    248a:	e8 35 18 00 00       	call   3cc4 <exit>
+    248f:	90                   	nop
+
+00002490 <mem>:
+{
+    2490:	55                   	push   %ebp
+    2491:	89 e5                	mov    %esp,%ebp
+    2493:	56                   	push   %esi
+    2494:	31 f6                	xor    %esi,%esi
+    2496:	53                   	push   %ebx
+  printf(1, "mem test\n");
+    2497:	83 ec 08             	sub    $0x8,%esp
+    249a:	68 ff 55 00 00       	push   $0x55ff
+    249f:	6a 01                	push   $0x1
+    24a1:	e8 2a 1a 00 00       	call   3ed0 <printf>
+  ppid = getpid();
+    24a6:	e8 99 18 00 00       	call   3d44 <getpid>
+    24ab:	89 c3                	mov    %eax,%ebx
+  if((pid = fork()) == 0){
+    24ad:	e8 0a 18 00 00       	call   3cbc <fork>
+    24b2:	83 c4 10             	add    $0x10,%esp
+    24b5:	85 c0                	test   %eax,%eax
+    24b7:	74 0b                	je     24c4 <mem+0x34>
+    24b9:	e9 8a 00 00 00       	jmp    2548 <mem+0xb8>
+    24be:	66 90                	xchg   %ax,%ax
+      *(char**)m2 = m1;
+    24c0:	89 30                	mov    %esi,(%eax)
+    24c2:	89 c6                	mov    %eax,%esi
+    while((m2 = malloc(10001)) != 0){
+    24c4:	83 ec 0c             	sub    $0xc,%esp
+    24c7:	68 11 27 00 00       	push   $0x2711
+    24cc:	e8 3f 1c 00 00       	call   4110 <malloc>
+    24d1:	83 c4 10             	add    $0x10,%esp
+    24d4:	85 c0                	test   %eax,%eax
+    24d6:	75 e8                	jne    24c0 <mem+0x30>
+    while(m1){
+    24d8:	85 f6                	test   %esi,%esi
+    24da:	74 18                	je     24f4 <mem+0x64>
+    24dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      m2 = *(char**)m1;
+    24e0:	89 f0                	mov    %esi,%eax
+      free(m1);
+    24e2:	83 ec 0c             	sub    $0xc,%esp
+      m2 = *(char**)m1;
+    24e5:	8b 36                	mov    (%esi),%esi
+      free(m1);
+    24e7:	50                   	push   %eax
+    24e8:	e8 93 1b 00 00       	call   4080 <free>
+    while(m1){
+    24ed:	83 c4 10             	add    $0x10,%esp
+    24f0:	85 f6                	test   %esi,%esi
+    24f2:	75 ec                	jne    24e0 <mem+0x50>
+    m1 = malloc(1024*20);
+    24f4:	83 ec 0c             	sub    $0xc,%esp
+    24f7:	68 00 50 00 00       	push   $0x5000
+    24fc:	e8 0f 1c 00 00       	call   4110 <malloc>
+    if(m1 == 0){
+    2501:	83 c4 10             	add    $0x10,%esp
+    2504:	85 c0                	test   %eax,%eax
+    2506:	74 20                	je     2528 <mem+0x98>
+    free(m1);
+    2508:	83 ec 0c             	sub    $0xc,%esp
+    250b:	50                   	push   %eax
+    250c:	e8 6f 1b 00 00       	call   4080 <free>
+    printf(1, "mem ok\n");
+    2511:	58                   	pop    %eax
+    2512:	5a                   	pop    %edx
+    2513:	68 23 56 00 00       	push   $0x5623
+    2518:	6a 01                	push   $0x1
+    251a:	e8 b1 19 00 00       	call   3ed0 <printf>
+    exit();
+    251f:	e8 a0 17 00 00       	call   3cc4 <exit>
+    2524:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      printf(1, "couldn't allocate mem?!!\n");
+    2528:	83 ec 08             	sub    $0x8,%esp
+    252b:	68 09 56 00 00       	push   $0x5609
+    2530:	6a 01                	push   $0x1
+    2532:	e8 99 19 00 00       	call   3ed0 <printf>
+      kill(ppid);
+    2537:	89 1c 24             	mov    %ebx,(%esp)
+    253a:	e8 b5 17 00 00       	call   3cf4 <kill>
+      exit();
+    253f:	e8 80 17 00 00       	call   3cc4 <exit>
+    2544:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+}
+    2548:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    254b:	5b                   	pop    %ebx
+    254c:	5e                   	pop    %esi
+    254d:	5d                   	pop    %ebp
+    wait();
+    254e:	e9 79 17 00 00       	jmp    3ccc <wait>
+    2553:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    255a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00002560 <unlinkread>:
+{
+    2560:	55                   	push   %ebp
+    2561:	89 e5                	mov    %esp,%ebp
+    2563:	56                   	push   %esi
+    2564:	53                   	push   %ebx
+  printf(1, "unlinkread test\n");
+    2565:	83 ec 08             	sub    $0x8,%esp
+    2568:	68 2b 56 00 00       	push   $0x562b
+    256d:	6a 01                	push   $0x1
+    256f:	e8 5c 19 00 00       	call   3ed0 <printf>
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    2574:	5b                   	pop    %ebx
+    2575:	5e                   	pop    %esi
+    2576:	68 02 02 00 00       	push   $0x202
+    257b:	68 3c 56 00 00       	push   $0x563c
+    2580:	e8 7f 17 00 00       	call   3d04 <open>
+  if(fd < 0){
+    2585:	83 c4 10             	add    $0x10,%esp
+    2588:	85 c0                	test   %eax,%eax
+    258a:	0f 88 e6 00 00 00    	js     2676 <unlinkread+0x116>
+  write(fd, "hello", 5);
+    2590:	83 ec 04             	sub    $0x4,%esp
+    2593:	89 c3                	mov    %eax,%ebx
+    2595:	6a 05                	push   $0x5
+    2597:	68 61 56 00 00       	push   $0x5661
+    259c:	50                   	push   %eax
+    259d:	e8 42 17 00 00       	call   3ce4 <write>
+  close(fd);
+    25a2:	89 1c 24             	mov    %ebx,(%esp)
+    25a5:	e8 42 17 00 00       	call   3cec <close>
+  fd = open("unlinkread", O_RDWR);
+    25aa:	58                   	pop    %eax
+    25ab:	5a                   	pop    %edx
+    25ac:	6a 02                	push   $0x2
+    25ae:	68 3c 56 00 00       	push   $0x563c
+    25b3:	e8 4c 17 00 00       	call   3d04 <open>
+  if(fd < 0){
+    25b8:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_RDWR);
+    25bb:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    25bd:	85 c0                	test   %eax,%eax
+    25bf:	0f 88 10 01 00 00    	js     26d5 <unlinkread+0x175>
+  if(unlink("unlinkread") != 0){
+    25c5:	83 ec 0c             	sub    $0xc,%esp
+    25c8:	68 3c 56 00 00       	push   $0x563c
+    25cd:	e8 42 17 00 00       	call   3d14 <unlink>
+    25d2:	83 c4 10             	add    $0x10,%esp
+    25d5:	85 c0                	test   %eax,%eax
+    25d7:	0f 85 e5 00 00 00    	jne    26c2 <unlinkread+0x162>
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    25dd:	83 ec 08             	sub    $0x8,%esp
+    25e0:	68 02 02 00 00       	push   $0x202
+    25e5:	68 3c 56 00 00       	push   $0x563c
+    25ea:	e8 15 17 00 00       	call   3d04 <open>
+  write(fd1, "yyy", 3);
+    25ef:	83 c4 0c             	add    $0xc,%esp
+    25f2:	6a 03                	push   $0x3
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    25f4:	89 c6                	mov    %eax,%esi
+  write(fd1, "yyy", 3);
+    25f6:	68 99 56 00 00       	push   $0x5699
+    25fb:	50                   	push   %eax
+    25fc:	e8 e3 16 00 00       	call   3ce4 <write>
+  close(fd1);
+    2601:	89 34 24             	mov    %esi,(%esp)
+    2604:	e8 e3 16 00 00       	call   3cec <close>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    2609:	83 c4 0c             	add    $0xc,%esp
+    260c:	68 00 20 00 00       	push   $0x2000
+    2611:	68 00 90 00 00       	push   $0x9000
+    2616:	53                   	push   %ebx
+    2617:	e8 c0 16 00 00       	call   3cdc <read>
+    261c:	83 c4 10             	add    $0x10,%esp
+    261f:	83 f8 05             	cmp    $0x5,%eax
+    2622:	0f 85 87 00 00 00    	jne    26af <unlinkread+0x14f>
+  if(buf[0] != 'h'){
+    2628:	80 3d 00 90 00 00 68 	cmpb   $0x68,0x9000
+    262f:	75 6b                	jne    269c <unlinkread+0x13c>
+  if(write(fd, buf, 10) != 10){
+    2631:	83 ec 04             	sub    $0x4,%esp
+    2634:	6a 0a                	push   $0xa
+    2636:	68 00 90 00 00       	push   $0x9000
+    263b:	53                   	push   %ebx
+    263c:	e8 a3 16 00 00       	call   3ce4 <write>
+    2641:	83 c4 10             	add    $0x10,%esp
+    2644:	83 f8 0a             	cmp    $0xa,%eax
+    2647:	75 40                	jne    2689 <unlinkread+0x129>
+  close(fd);
+    2649:	83 ec 0c             	sub    $0xc,%esp
+    264c:	53                   	push   %ebx
+    264d:	e8 9a 16 00 00       	call   3cec <close>
+  unlink("unlinkread");
+    2652:	c7 04 24 3c 56 00 00 	movl   $0x563c,(%esp)
+    2659:	e8 b6 16 00 00       	call   3d14 <unlink>
+  printf(1, "unlinkread ok\n");
+    265e:	58                   	pop    %eax
+    265f:	5a                   	pop    %edx
+    2660:	68 e4 56 00 00       	push   $0x56e4
+    2665:	6a 01                	push   $0x1
+    2667:	e8 64 18 00 00       	call   3ed0 <printf>
+}
+    266c:	83 c4 10             	add    $0x10,%esp
+    266f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    2672:	5b                   	pop    %ebx
+    2673:	5e                   	pop    %esi
+    2674:	5d                   	pop    %ebp
+    2675:	c3                   	ret
+    printf(1, "create unlinkread failed\n");
+    2676:	51                   	push   %ecx
+    2677:	51                   	push   %ecx
+    2678:	68 47 56 00 00       	push   $0x5647
+    267d:	6a 01                	push   $0x1
+    267f:	e8 4c 18 00 00       	call   3ed0 <printf>
+    exit();
+    2684:	e8 3b 16 00 00       	call   3cc4 <exit>
+    printf(1, "unlinkread write failed\n");
+    2689:	51                   	push   %ecx
+    268a:	51                   	push   %ecx
+    268b:	68 cb 56 00 00       	push   $0x56cb
+    2690:	6a 01                	push   $0x1
+    2692:	e8 39 18 00 00       	call   3ed0 <printf>
+    exit();
+    2697:	e8 28 16 00 00       	call   3cc4 <exit>
+    printf(1, "unlinkread wrong data\n");
+    269c:	53                   	push   %ebx
+    269d:	53                   	push   %ebx
+    269e:	68 b4 56 00 00       	push   $0x56b4
+    26a3:	6a 01                	push   $0x1
+    26a5:	e8 26 18 00 00       	call   3ed0 <printf>
+    exit();
+    26aa:	e8 15 16 00 00       	call   3cc4 <exit>
+    printf(1, "unlinkread read failed");
+    26af:	56                   	push   %esi
+    26b0:	56                   	push   %esi
+    26b1:	68 9d 56 00 00       	push   $0x569d
+    26b6:	6a 01                	push   $0x1
+    26b8:	e8 13 18 00 00       	call   3ed0 <printf>
+    exit();
+    26bd:	e8 02 16 00 00       	call   3cc4 <exit>
+    printf(1, "unlink unlinkread failed\n");
+    26c2:	50                   	push   %eax
+    26c3:	50                   	push   %eax
+    26c4:	68 7f 56 00 00       	push   $0x567f
+    26c9:	6a 01                	push   $0x1
+    26cb:	e8 00 18 00 00       	call   3ed0 <printf>
+    exit();
+    26d0:	e8 ef 15 00 00       	call   3cc4 <exit>
+    printf(1, "open unlinkread failed\n");
+    26d5:	50                   	push   %eax
+    26d6:	50                   	push   %eax
+    26d7:	68 67 56 00 00       	push   $0x5667
+    26dc:	6a 01                	push   $0x1
+    26de:	e8 ed 17 00 00       	call   3ed0 <printf>
+    exit();
+    26e3:	e8 dc 15 00 00       	call   3cc4 <exit>
+    26e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    26ef:	90                   	nop
+
+000026f0 <linktest>:
+{
+    26f0:	55                   	push   %ebp
+    26f1:	89 e5                	mov    %esp,%ebp
+    26f3:	53                   	push   %ebx
+    26f4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "linktest\n");
+    26f7:	68 f3 56 00 00       	push   $0x56f3
+    26fc:	6a 01                	push   $0x1
+    26fe:	e8 cd 17 00 00       	call   3ed0 <printf>
+  unlink("lf1");
+    2703:	c7 04 24 fd 56 00 00 	movl   $0x56fd,(%esp)
+    270a:	e8 05 16 00 00       	call   3d14 <unlink>
+  unlink("lf2");
+    270f:	c7 04 24 01 57 00 00 	movl   $0x5701,(%esp)
+    2716:	e8 f9 15 00 00       	call   3d14 <unlink>
+  fd = open("lf1", O_CREATE|O_RDWR);
+    271b:	58                   	pop    %eax
+    271c:	5a                   	pop    %edx
+    271d:	68 02 02 00 00       	push   $0x202
+    2722:	68 fd 56 00 00       	push   $0x56fd
+    2727:	e8 d8 15 00 00       	call   3d04 <open>
+  if(fd < 0){
+    272c:	83 c4 10             	add    $0x10,%esp
+    272f:	85 c0                	test   %eax,%eax
+    2731:	0f 88 1e 01 00 00    	js     2855 <linktest+0x165>
+  if(write(fd, "hello", 5) != 5){
+    2737:	83 ec 04             	sub    $0x4,%esp
+    273a:	89 c3                	mov    %eax,%ebx
+    273c:	6a 05                	push   $0x5
+    273e:	68 61 56 00 00       	push   $0x5661
+    2743:	50                   	push   %eax
+    2744:	e8 9b 15 00 00       	call   3ce4 <write>
+    2749:	83 c4 10             	add    $0x10,%esp
+    274c:	83 f8 05             	cmp    $0x5,%eax
+    274f:	0f 85 98 01 00 00    	jne    28ed <linktest+0x1fd>
+  close(fd);
+    2755:	83 ec 0c             	sub    $0xc,%esp
+    2758:	53                   	push   %ebx
+    2759:	e8 8e 15 00 00       	call   3cec <close>
+  if(link("lf1", "lf2") < 0){
+    275e:	5b                   	pop    %ebx
+    275f:	58                   	pop    %eax
+    2760:	68 01 57 00 00       	push   $0x5701
+    2765:	68 fd 56 00 00       	push   $0x56fd
+    276a:	e8 b5 15 00 00       	call   3d24 <link>
+    276f:	83 c4 10             	add    $0x10,%esp
+    2772:	85 c0                	test   %eax,%eax
+    2774:	0f 88 60 01 00 00    	js     28da <linktest+0x1ea>
+  unlink("lf1");
+    277a:	83 ec 0c             	sub    $0xc,%esp
+    277d:	68 fd 56 00 00       	push   $0x56fd
+    2782:	e8 8d 15 00 00       	call   3d14 <unlink>
+  if(open("lf1", 0) >= 0){
+    2787:	58                   	pop    %eax
+    2788:	5a                   	pop    %edx
+    2789:	6a 00                	push   $0x0
+    278b:	68 fd 56 00 00       	push   $0x56fd
+    2790:	e8 6f 15 00 00       	call   3d04 <open>
+    2795:	83 c4 10             	add    $0x10,%esp
+    2798:	85 c0                	test   %eax,%eax
+    279a:	0f 89 27 01 00 00    	jns    28c7 <linktest+0x1d7>
+  fd = open("lf2", 0);
+    27a0:	83 ec 08             	sub    $0x8,%esp
+    27a3:	6a 00                	push   $0x0
+    27a5:	68 01 57 00 00       	push   $0x5701
+    27aa:	e8 55 15 00 00       	call   3d04 <open>
+  if(fd < 0){
+    27af:	83 c4 10             	add    $0x10,%esp
+  fd = open("lf2", 0);
+    27b2:	89 c3                	mov    %eax,%ebx
+  if(fd < 0){
+    27b4:	85 c0                	test   %eax,%eax
+    27b6:	0f 88 f8 00 00 00    	js     28b4 <linktest+0x1c4>
+  if(read(fd, buf, sizeof(buf)) != 5){
+    27bc:	83 ec 04             	sub    $0x4,%esp
+    27bf:	68 00 20 00 00       	push   $0x2000
+    27c4:	68 00 90 00 00       	push   $0x9000
+    27c9:	50                   	push   %eax
+    27ca:	e8 0d 15 00 00       	call   3cdc <read>
+    27cf:	83 c4 10             	add    $0x10,%esp
+    27d2:	83 f8 05             	cmp    $0x5,%eax
+    27d5:	0f 85 c6 00 00 00    	jne    28a1 <linktest+0x1b1>
+  close(fd);
+    27db:	83 ec 0c             	sub    $0xc,%esp
+    27de:	53                   	push   %ebx
+    27df:	e8 08 15 00 00       	call   3cec <close>
+  if(link("lf2", "lf2") >= 0){
+    27e4:	58                   	pop    %eax
+    27e5:	5a                   	pop    %edx
+    27e6:	68 01 57 00 00       	push   $0x5701
+    27eb:	68 01 57 00 00       	push   $0x5701
+    27f0:	e8 2f 15 00 00       	call   3d24 <link>
+    27f5:	83 c4 10             	add    $0x10,%esp
+    27f8:	85 c0                	test   %eax,%eax
+    27fa:	0f 89 8e 00 00 00    	jns    288e <linktest+0x19e>
+  unlink("lf2");
+    2800:	83 ec 0c             	sub    $0xc,%esp
+    2803:	68 01 57 00 00       	push   $0x5701
+    2808:	e8 07 15 00 00       	call   3d14 <unlink>
+  if(link("lf2", "lf1") >= 0){
+    280d:	59                   	pop    %ecx
+    280e:	5b                   	pop    %ebx
+    280f:	68 fd 56 00 00       	push   $0x56fd
+    2814:	68 01 57 00 00       	push   $0x5701
+    2819:	e8 06 15 00 00       	call   3d24 <link>
+    281e:	83 c4 10             	add    $0x10,%esp
+    2821:	85 c0                	test   %eax,%eax
+    2823:	79 56                	jns    287b <linktest+0x18b>
+  if(link(".", "lf1") >= 0){
+    2825:	83 ec 08             	sub    $0x8,%esp
+    2828:	68 fd 56 00 00       	push   $0x56fd
+    282d:	68 19 51 00 00       	push   $0x5119
+    2832:	e8 ed 14 00 00       	call   3d24 <link>
+    2837:	83 c4 10             	add    $0x10,%esp
+    283a:	85 c0                	test   %eax,%eax
+    283c:	79 2a                	jns    2868 <linktest+0x178>
+  printf(1, "linktest ok\n");
+    283e:	83 ec 08             	sub    $0x8,%esp
+    2841:	68 9b 57 00 00       	push   $0x579b
+    2846:	6a 01                	push   $0x1
+    2848:	e8 83 16 00 00       	call   3ed0 <printf>
+}
+    284d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2850:	83 c4 10             	add    $0x10,%esp
+    2853:	c9                   	leave
+    2854:	c3                   	ret
+    printf(1, "create lf1 failed\n");
+    2855:	50                   	push   %eax
+    2856:	50                   	push   %eax
+    2857:	68 05 57 00 00       	push   $0x5705
+    285c:	6a 01                	push   $0x1
+    285e:	e8 6d 16 00 00       	call   3ed0 <printf>
+    exit();
+    2863:	e8 5c 14 00 00       	call   3cc4 <exit>
+    printf(1, "link . lf1 succeeded! oops\n");
+    2868:	50                   	push   %eax
+    2869:	50                   	push   %eax
+    286a:	68 7f 57 00 00       	push   $0x577f
+    286f:	6a 01                	push   $0x1
+    2871:	e8 5a 16 00 00       	call   3ed0 <printf>
+    exit();
+    2876:	e8 49 14 00 00       	call   3cc4 <exit>
+    printf(1, "link non-existant succeeded! oops\n");
+    287b:	52                   	push   %edx
+    287c:	52                   	push   %edx
+    287d:	68 a4 47 00 00       	push   $0x47a4
+    2882:	6a 01                	push   $0x1
+    2884:	e8 47 16 00 00       	call   3ed0 <printf>
+    exit();
+    2889:	e8 36 14 00 00       	call   3cc4 <exit>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    288e:	50                   	push   %eax
+    288f:	50                   	push   %eax
+    2890:	68 61 57 00 00       	push   $0x5761
+    2895:	6a 01                	push   $0x1
+    2897:	e8 34 16 00 00       	call   3ed0 <printf>
+    exit();
+    289c:	e8 23 14 00 00       	call   3cc4 <exit>
+    printf(1, "read lf2 failed\n");
+    28a1:	51                   	push   %ecx
+    28a2:	51                   	push   %ecx
+    28a3:	68 50 57 00 00       	push   $0x5750
+    28a8:	6a 01                	push   $0x1
+    28aa:	e8 21 16 00 00       	call   3ed0 <printf>
+    exit();
+    28af:	e8 10 14 00 00       	call   3cc4 <exit>
+    printf(1, "open lf2 failed\n");
+    28b4:	53                   	push   %ebx
+    28b5:	53                   	push   %ebx
+    28b6:	68 3f 57 00 00       	push   $0x573f
+    28bb:	6a 01                	push   $0x1
+    28bd:	e8 0e 16 00 00       	call   3ed0 <printf>
+    exit();
+    28c2:	e8 fd 13 00 00       	call   3cc4 <exit>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    28c7:	50                   	push   %eax
+    28c8:	50                   	push   %eax
+    28c9:	68 7c 47 00 00       	push   $0x477c
+    28ce:	6a 01                	push   $0x1
+    28d0:	e8 fb 15 00 00       	call   3ed0 <printf>
+    exit();
+    28d5:	e8 ea 13 00 00       	call   3cc4 <exit>
+    printf(1, "link lf1 lf2 failed\n");
+    28da:	51                   	push   %ecx
+    28db:	51                   	push   %ecx
+    28dc:	68 2a 57 00 00       	push   $0x572a
+    28e1:	6a 01                	push   $0x1
+    28e3:	e8 e8 15 00 00       	call   3ed0 <printf>
+    exit();
+    28e8:	e8 d7 13 00 00       	call   3cc4 <exit>
+    printf(1, "write lf1 failed\n");
+    28ed:	50                   	push   %eax
+    28ee:	50                   	push   %eax
+    28ef:	68 18 57 00 00       	push   $0x5718
+    28f4:	6a 01                	push   $0x1
+    28f6:	e8 d5 15 00 00       	call   3ed0 <printf>
+    exit();
+    28fb:	e8 c4 13 00 00       	call   3cc4 <exit>
+
+00002900 <fourteen>:
+{
+    2900:	55                   	push   %ebp
+    2901:	89 e5                	mov    %esp,%ebp
+    2903:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "fourteen test\n");
+    2906:	68 a8 57 00 00       	push   $0x57a8
+    290b:	6a 01                	push   $0x1
+    290d:	e8 be 15 00 00       	call   3ed0 <printf>
+  if(mkdir("12345678901234") != 0){
+    2912:	c7 04 24 e3 57 00 00 	movl   $0x57e3,(%esp)
+    2919:	e8 0e 14 00 00       	call   3d2c <mkdir>
+    291e:	83 c4 10             	add    $0x10,%esp
+    2921:	85 c0                	test   %eax,%eax
+    2923:	0f 85 97 00 00 00    	jne    29c0 <fourteen+0xc0>
+  if(mkdir("12345678901234/123456789012345") != 0){
+    2929:	83 ec 0c             	sub    $0xc,%esp
+    292c:	68 c8 47 00 00       	push   $0x47c8
+    2931:	e8 f6 13 00 00       	call   3d2c <mkdir>
+    2936:	83 c4 10             	add    $0x10,%esp
+    2939:	85 c0                	test   %eax,%eax
+    293b:	0f 85 de 00 00 00    	jne    2a1f <fourteen+0x11f>
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    2941:	83 ec 08             	sub    $0x8,%esp
+    2944:	68 00 02 00 00       	push   $0x200
+    2949:	68 18 48 00 00       	push   $0x4818
+    294e:	e8 b1 13 00 00       	call   3d04 <open>
+  if(fd < 0){
+    2953:	83 c4 10             	add    $0x10,%esp
+    2956:	85 c0                	test   %eax,%eax
+    2958:	0f 88 ae 00 00 00    	js     2a0c <fourteen+0x10c>
+  close(fd);
+    295e:	83 ec 0c             	sub    $0xc,%esp
+    2961:	50                   	push   %eax
+    2962:	e8 85 13 00 00       	call   3cec <close>
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    2967:	58                   	pop    %eax
+    2968:	5a                   	pop    %edx
+    2969:	6a 00                	push   $0x0
+    296b:	68 88 48 00 00       	push   $0x4888
+    2970:	e8 8f 13 00 00       	call   3d04 <open>
+  if(fd < 0){
+    2975:	83 c4 10             	add    $0x10,%esp
+    2978:	85 c0                	test   %eax,%eax
+    297a:	78 7d                	js     29f9 <fourteen+0xf9>
+  close(fd);
+    297c:	83 ec 0c             	sub    $0xc,%esp
+    297f:	50                   	push   %eax
+    2980:	e8 67 13 00 00       	call   3cec <close>
+  if(mkdir("12345678901234/12345678901234") == 0){
+    2985:	c7 04 24 d4 57 00 00 	movl   $0x57d4,(%esp)
+    298c:	e8 9b 13 00 00       	call   3d2c <mkdir>
+    2991:	83 c4 10             	add    $0x10,%esp
+    2994:	85 c0                	test   %eax,%eax
+    2996:	74 4e                	je     29e6 <fourteen+0xe6>
+  if(mkdir("123456789012345/12345678901234") == 0){
+    2998:	83 ec 0c             	sub    $0xc,%esp
+    299b:	68 24 49 00 00       	push   $0x4924
+    29a0:	e8 87 13 00 00       	call   3d2c <mkdir>
+    29a5:	83 c4 10             	add    $0x10,%esp
+    29a8:	85 c0                	test   %eax,%eax
+    29aa:	74 27                	je     29d3 <fourteen+0xd3>
+  printf(1, "fourteen ok\n");
+    29ac:	83 ec 08             	sub    $0x8,%esp
+    29af:	68 f2 57 00 00       	push   $0x57f2
+    29b4:	6a 01                	push   $0x1
+    29b6:	e8 15 15 00 00       	call   3ed0 <printf>
+}
+    29bb:	83 c4 10             	add    $0x10,%esp
+    29be:	c9                   	leave
+    29bf:	c3                   	ret
+    printf(1, "mkdir 12345678901234 failed\n");
+    29c0:	50                   	push   %eax
+    29c1:	50                   	push   %eax
+    29c2:	68 b7 57 00 00       	push   $0x57b7
+    29c7:	6a 01                	push   $0x1
+    29c9:	e8 02 15 00 00       	call   3ed0 <printf>
+    exit();
+    29ce:	e8 f1 12 00 00       	call   3cc4 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    29d3:	50                   	push   %eax
+    29d4:	50                   	push   %eax
+    29d5:	68 44 49 00 00       	push   $0x4944
+    29da:	6a 01                	push   $0x1
+    29dc:	e8 ef 14 00 00       	call   3ed0 <printf>
+    exit();
+    29e1:	e8 de 12 00 00       	call   3cc4 <exit>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    29e6:	52                   	push   %edx
+    29e7:	52                   	push   %edx
+    29e8:	68 f4 48 00 00       	push   $0x48f4
+    29ed:	6a 01                	push   $0x1
+    29ef:	e8 dc 14 00 00       	call   3ed0 <printf>
+    exit();
+    29f4:	e8 cb 12 00 00       	call   3cc4 <exit>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    29f9:	51                   	push   %ecx
+    29fa:	51                   	push   %ecx
+    29fb:	68 b8 48 00 00       	push   $0x48b8
+    2a00:	6a 01                	push   $0x1
+    2a02:	e8 c9 14 00 00       	call   3ed0 <printf>
+    exit();
+    2a07:	e8 b8 12 00 00       	call   3cc4 <exit>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    2a0c:	51                   	push   %ecx
+    2a0d:	51                   	push   %ecx
+    2a0e:	68 48 48 00 00       	push   $0x4848
+    2a13:	6a 01                	push   $0x1
+    2a15:	e8 b6 14 00 00       	call   3ed0 <printf>
+    exit();
+    2a1a:	e8 a5 12 00 00       	call   3cc4 <exit>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    2a1f:	50                   	push   %eax
+    2a20:	50                   	push   %eax
+    2a21:	68 e8 47 00 00       	push   $0x47e8
+    2a26:	6a 01                	push   $0x1
+    2a28:	e8 a3 14 00 00       	call   3ed0 <printf>
+    exit();
+    2a2d:	e8 92 12 00 00       	call   3cc4 <exit>
+    2a32:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2a39:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00002a40 <rmdot>:
+{
+    2a40:	55                   	push   %ebp
+    2a41:	89 e5                	mov    %esp,%ebp
+    2a43:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "rmdot test\n");
+    2a46:	68 ff 57 00 00       	push   $0x57ff
+    2a4b:	6a 01                	push   $0x1
+    2a4d:	e8 7e 14 00 00       	call   3ed0 <printf>
+  if(mkdir("dots") != 0){
+    2a52:	c7 04 24 0b 58 00 00 	movl   $0x580b,(%esp)
+    2a59:	e8 ce 12 00 00       	call   3d2c <mkdir>
+    2a5e:	83 c4 10             	add    $0x10,%esp
+    2a61:	85 c0                	test   %eax,%eax
+    2a63:	0f 85 b0 00 00 00    	jne    2b19 <rmdot+0xd9>
+  if(chdir("dots") != 0){
+    2a69:	83 ec 0c             	sub    $0xc,%esp
+    2a6c:	68 0b 58 00 00       	push   $0x580b
+    2a71:	e8 be 12 00 00       	call   3d34 <chdir>
+    2a76:	83 c4 10             	add    $0x10,%esp
+    2a79:	85 c0                	test   %eax,%eax
+    2a7b:	0f 85 1d 01 00 00    	jne    2b9e <rmdot+0x15e>
+  if(unlink(".") == 0){
+    2a81:	83 ec 0c             	sub    $0xc,%esp
+    2a84:	68 19 51 00 00       	push   $0x5119
+    2a89:	e8 86 12 00 00       	call   3d14 <unlink>
+    2a8e:	83 c4 10             	add    $0x10,%esp
+    2a91:	85 c0                	test   %eax,%eax
+    2a93:	0f 84 f2 00 00 00    	je     2b8b <rmdot+0x14b>
+  if(unlink("..") == 0){
+    2a99:	83 ec 0c             	sub    $0xc,%esp
+    2a9c:	68 18 51 00 00       	push   $0x5118
+    2aa1:	e8 6e 12 00 00       	call   3d14 <unlink>
+    2aa6:	83 c4 10             	add    $0x10,%esp
+    2aa9:	85 c0                	test   %eax,%eax
+    2aab:	0f 84 c7 00 00 00    	je     2b78 <rmdot+0x138>
+  if(chdir("/") != 0){
+    2ab1:	83 ec 0c             	sub    $0xc,%esp
+    2ab4:	68 e5 53 00 00       	push   $0x53e5
+    2ab9:	e8 76 12 00 00       	call   3d34 <chdir>
+    2abe:	83 c4 10             	add    $0x10,%esp
+    2ac1:	85 c0                	test   %eax,%eax
+    2ac3:	0f 85 9c 00 00 00    	jne    2b65 <rmdot+0x125>
+  if(unlink("dots/.") == 0){
+    2ac9:	83 ec 0c             	sub    $0xc,%esp
+    2acc:	68 53 58 00 00       	push   $0x5853
+    2ad1:	e8 3e 12 00 00       	call   3d14 <unlink>
+    2ad6:	83 c4 10             	add    $0x10,%esp
+    2ad9:	85 c0                	test   %eax,%eax
+    2adb:	74 75                	je     2b52 <rmdot+0x112>
+  if(unlink("dots/..") == 0){
+    2add:	83 ec 0c             	sub    $0xc,%esp
+    2ae0:	68 71 58 00 00       	push   $0x5871
+    2ae5:	e8 2a 12 00 00       	call   3d14 <unlink>
+    2aea:	83 c4 10             	add    $0x10,%esp
+    2aed:	85 c0                	test   %eax,%eax
+    2aef:	74 4e                	je     2b3f <rmdot+0xff>
+  if(unlink("dots") != 0){
+    2af1:	83 ec 0c             	sub    $0xc,%esp
+    2af4:	68 0b 58 00 00       	push   $0x580b
+    2af9:	e8 16 12 00 00       	call   3d14 <unlink>
+    2afe:	83 c4 10             	add    $0x10,%esp
+    2b01:	85 c0                	test   %eax,%eax
+    2b03:	75 27                	jne    2b2c <rmdot+0xec>
+  printf(1, "rmdot ok\n");
+    2b05:	83 ec 08             	sub    $0x8,%esp
+    2b08:	68 a6 58 00 00       	push   $0x58a6
+    2b0d:	6a 01                	push   $0x1
+    2b0f:	e8 bc 13 00 00       	call   3ed0 <printf>
+}
+    2b14:	83 c4 10             	add    $0x10,%esp
+    2b17:	c9                   	leave
+    2b18:	c3                   	ret
+    printf(1, "mkdir dots failed\n");
+    2b19:	50                   	push   %eax
+    2b1a:	50                   	push   %eax
+    2b1b:	68 10 58 00 00       	push   $0x5810
+    2b20:	6a 01                	push   $0x1
+    2b22:	e8 a9 13 00 00       	call   3ed0 <printf>
+    exit();
+    2b27:	e8 98 11 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dots failed!\n");
+    2b2c:	50                   	push   %eax
+    2b2d:	50                   	push   %eax
+    2b2e:	68 91 58 00 00       	push   $0x5891
+    2b33:	6a 01                	push   $0x1
+    2b35:	e8 96 13 00 00       	call   3ed0 <printf>
+    exit();
+    2b3a:	e8 85 11 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dots/.. worked!\n");
+    2b3f:	52                   	push   %edx
+    2b40:	52                   	push   %edx
+    2b41:	68 79 58 00 00       	push   $0x5879
+    2b46:	6a 01                	push   $0x1
+    2b48:	e8 83 13 00 00       	call   3ed0 <printf>
+    exit();
+    2b4d:	e8 72 11 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dots/. worked!\n");
+    2b52:	51                   	push   %ecx
+    2b53:	51                   	push   %ecx
+    2b54:	68 5a 58 00 00       	push   $0x585a
+    2b59:	6a 01                	push   $0x1
+    2b5b:	e8 70 13 00 00       	call   3ed0 <printf>
+    exit();
+    2b60:	e8 5f 11 00 00       	call   3cc4 <exit>
+    printf(1, "chdir / failed\n");
+    2b65:	50                   	push   %eax
+    2b66:	50                   	push   %eax
+    2b67:	68 e7 53 00 00       	push   $0x53e7
+    2b6c:	6a 01                	push   $0x1
+    2b6e:	e8 5d 13 00 00       	call   3ed0 <printf>
+    exit();
+    2b73:	e8 4c 11 00 00       	call   3cc4 <exit>
+    printf(1, "rm .. worked!\n");
+    2b78:	50                   	push   %eax
+    2b79:	50                   	push   %eax
+    2b7a:	68 44 58 00 00       	push   $0x5844
+    2b7f:	6a 01                	push   $0x1
+    2b81:	e8 4a 13 00 00       	call   3ed0 <printf>
+    exit();
+    2b86:	e8 39 11 00 00       	call   3cc4 <exit>
+    printf(1, "rm . worked!\n");
+    2b8b:	50                   	push   %eax
+    2b8c:	50                   	push   %eax
+    2b8d:	68 36 58 00 00       	push   $0x5836
+    2b92:	6a 01                	push   $0x1
+    2b94:	e8 37 13 00 00       	call   3ed0 <printf>
+    exit();
+    2b99:	e8 26 11 00 00       	call   3cc4 <exit>
+    printf(1, "chdir dots failed\n");
+    2b9e:	50                   	push   %eax
+    2b9f:	50                   	push   %eax
+    2ba0:	68 23 58 00 00       	push   $0x5823
+    2ba5:	6a 01                	push   $0x1
+    2ba7:	e8 24 13 00 00       	call   3ed0 <printf>
+    exit();
+    2bac:	e8 13 11 00 00       	call   3cc4 <exit>
+    2bb1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2bbf:	90                   	nop
+
+00002bc0 <dirfile>:
+{
+    2bc0:	55                   	push   %ebp
+    2bc1:	89 e5                	mov    %esp,%ebp
+    2bc3:	53                   	push   %ebx
+    2bc4:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "dir vs file\n");
+    2bc7:	68 b0 58 00 00       	push   $0x58b0
+    2bcc:	6a 01                	push   $0x1
+    2bce:	e8 fd 12 00 00       	call   3ed0 <printf>
+  fd = open("dirfile", O_CREATE);
+    2bd3:	5b                   	pop    %ebx
+    2bd4:	58                   	pop    %eax
+    2bd5:	68 00 02 00 00       	push   $0x200
+    2bda:	68 bd 58 00 00       	push   $0x58bd
+    2bdf:	e8 20 11 00 00       	call   3d04 <open>
+  if(fd < 0){
+    2be4:	83 c4 10             	add    $0x10,%esp
+    2be7:	85 c0                	test   %eax,%eax
+    2be9:	0f 88 43 01 00 00    	js     2d32 <dirfile+0x172>
+  close(fd);
+    2bef:	83 ec 0c             	sub    $0xc,%esp
+    2bf2:	50                   	push   %eax
+    2bf3:	e8 f4 10 00 00       	call   3cec <close>
+  if(chdir("dirfile") == 0){
+    2bf8:	c7 04 24 bd 58 00 00 	movl   $0x58bd,(%esp)
+    2bff:	e8 30 11 00 00       	call   3d34 <chdir>
+    2c04:	83 c4 10             	add    $0x10,%esp
+    2c07:	85 c0                	test   %eax,%eax
+    2c09:	0f 84 10 01 00 00    	je     2d1f <dirfile+0x15f>
+  fd = open("dirfile/xx", 0);
+    2c0f:	83 ec 08             	sub    $0x8,%esp
+    2c12:	6a 00                	push   $0x0
+    2c14:	68 f6 58 00 00       	push   $0x58f6
+    2c19:	e8 e6 10 00 00       	call   3d04 <open>
+  if(fd >= 0){
+    2c1e:	83 c4 10             	add    $0x10,%esp
+    2c21:	85 c0                	test   %eax,%eax
+    2c23:	0f 89 e3 00 00 00    	jns    2d0c <dirfile+0x14c>
+  fd = open("dirfile/xx", O_CREATE);
+    2c29:	83 ec 08             	sub    $0x8,%esp
+    2c2c:	68 00 02 00 00       	push   $0x200
+    2c31:	68 f6 58 00 00       	push   $0x58f6
+    2c36:	e8 c9 10 00 00       	call   3d04 <open>
+  if(fd >= 0){
+    2c3b:	83 c4 10             	add    $0x10,%esp
+    2c3e:	85 c0                	test   %eax,%eax
+    2c40:	0f 89 c6 00 00 00    	jns    2d0c <dirfile+0x14c>
+  if(mkdir("dirfile/xx") == 0){
+    2c46:	83 ec 0c             	sub    $0xc,%esp
+    2c49:	68 f6 58 00 00       	push   $0x58f6
+    2c4e:	e8 d9 10 00 00       	call   3d2c <mkdir>
+    2c53:	83 c4 10             	add    $0x10,%esp
+    2c56:	85 c0                	test   %eax,%eax
+    2c58:	0f 84 46 01 00 00    	je     2da4 <dirfile+0x1e4>
+  if(unlink("dirfile/xx") == 0){
+    2c5e:	83 ec 0c             	sub    $0xc,%esp
+    2c61:	68 f6 58 00 00       	push   $0x58f6
+    2c66:	e8 a9 10 00 00       	call   3d14 <unlink>
+    2c6b:	83 c4 10             	add    $0x10,%esp
+    2c6e:	85 c0                	test   %eax,%eax
+    2c70:	0f 84 1b 01 00 00    	je     2d91 <dirfile+0x1d1>
+  if(link("README", "dirfile/xx") == 0){
+    2c76:	83 ec 08             	sub    $0x8,%esp
+    2c79:	68 f6 58 00 00       	push   $0x58f6
+    2c7e:	68 5a 59 00 00       	push   $0x595a
+    2c83:	e8 9c 10 00 00       	call   3d24 <link>
+    2c88:	83 c4 10             	add    $0x10,%esp
+    2c8b:	85 c0                	test   %eax,%eax
+    2c8d:	0f 84 eb 00 00 00    	je     2d7e <dirfile+0x1be>
+  if(unlink("dirfile") != 0){
+    2c93:	83 ec 0c             	sub    $0xc,%esp
+    2c96:	68 bd 58 00 00       	push   $0x58bd
+    2c9b:	e8 74 10 00 00       	call   3d14 <unlink>
+    2ca0:	83 c4 10             	add    $0x10,%esp
+    2ca3:	85 c0                	test   %eax,%eax
+    2ca5:	0f 85 c0 00 00 00    	jne    2d6b <dirfile+0x1ab>
+  fd = open(".", O_RDWR);
+    2cab:	83 ec 08             	sub    $0x8,%esp
+    2cae:	6a 02                	push   $0x2
+    2cb0:	68 19 51 00 00       	push   $0x5119
+    2cb5:	e8 4a 10 00 00       	call   3d04 <open>
+  if(fd >= 0){
+    2cba:	83 c4 10             	add    $0x10,%esp
+    2cbd:	85 c0                	test   %eax,%eax
+    2cbf:	0f 89 93 00 00 00    	jns    2d58 <dirfile+0x198>
+  fd = open(".", 0);
+    2cc5:	83 ec 08             	sub    $0x8,%esp
+    2cc8:	6a 00                	push   $0x0
+    2cca:	68 19 51 00 00       	push   $0x5119
+    2ccf:	e8 30 10 00 00       	call   3d04 <open>
+  if(write(fd, "x", 1) > 0){
+    2cd4:	83 c4 0c             	add    $0xc,%esp
+    2cd7:	6a 01                	push   $0x1
+  fd = open(".", 0);
+    2cd9:	89 c3                	mov    %eax,%ebx
+  if(write(fd, "x", 1) > 0){
+    2cdb:	68 fc 51 00 00       	push   $0x51fc
+    2ce0:	50                   	push   %eax
+    2ce1:	e8 fe 0f 00 00       	call   3ce4 <write>
+    2ce6:	83 c4 10             	add    $0x10,%esp
+    2ce9:	85 c0                	test   %eax,%eax
+    2ceb:	7f 58                	jg     2d45 <dirfile+0x185>
+  close(fd);
+    2ced:	83 ec 0c             	sub    $0xc,%esp
+    2cf0:	53                   	push   %ebx
+    2cf1:	e8 f6 0f 00 00       	call   3cec <close>
+  printf(1, "dir vs file OK\n");
+    2cf6:	58                   	pop    %eax
+    2cf7:	5a                   	pop    %edx
+    2cf8:	68 8d 59 00 00       	push   $0x598d
+    2cfd:	6a 01                	push   $0x1
+    2cff:	e8 cc 11 00 00       	call   3ed0 <printf>
+}
+    2d04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2d07:	83 c4 10             	add    $0x10,%esp
+    2d0a:	c9                   	leave
+    2d0b:	c3                   	ret
+    printf(1, "create dirfile/xx succeeded!\n");
+    2d0c:	50                   	push   %eax
+    2d0d:	50                   	push   %eax
+    2d0e:	68 01 59 00 00       	push   $0x5901
+    2d13:	6a 01                	push   $0x1
+    2d15:	e8 b6 11 00 00       	call   3ed0 <printf>
+    exit();
+    2d1a:	e8 a5 0f 00 00       	call   3cc4 <exit>
+    printf(1, "chdir dirfile succeeded!\n");
+    2d1f:	52                   	push   %edx
+    2d20:	52                   	push   %edx
+    2d21:	68 dc 58 00 00       	push   $0x58dc
+    2d26:	6a 01                	push   $0x1
+    2d28:	e8 a3 11 00 00       	call   3ed0 <printf>
+    exit();
+    2d2d:	e8 92 0f 00 00       	call   3cc4 <exit>
+    printf(1, "create dirfile failed\n");
+    2d32:	51                   	push   %ecx
+    2d33:	51                   	push   %ecx
+    2d34:	68 c5 58 00 00       	push   $0x58c5
+    2d39:	6a 01                	push   $0x1
+    2d3b:	e8 90 11 00 00       	call   3ed0 <printf>
+    exit();
+    2d40:	e8 7f 0f 00 00       	call   3cc4 <exit>
+    printf(1, "write . succeeded!\n");
+    2d45:	51                   	push   %ecx
+    2d46:	51                   	push   %ecx
+    2d47:	68 79 59 00 00       	push   $0x5979
+    2d4c:	6a 01                	push   $0x1
+    2d4e:	e8 7d 11 00 00       	call   3ed0 <printf>
+    exit();
+    2d53:	e8 6c 0f 00 00       	call   3cc4 <exit>
+    printf(1, "open . for writing succeeded!\n");
+    2d58:	53                   	push   %ebx
+    2d59:	53                   	push   %ebx
+    2d5a:	68 98 49 00 00       	push   $0x4998
+    2d5f:	6a 01                	push   $0x1
+    2d61:	e8 6a 11 00 00       	call   3ed0 <printf>
+    exit();
+    2d66:	e8 59 0f 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dirfile failed!\n");
+    2d6b:	50                   	push   %eax
+    2d6c:	50                   	push   %eax
+    2d6d:	68 61 59 00 00       	push   $0x5961
+    2d72:	6a 01                	push   $0x1
+    2d74:	e8 57 11 00 00       	call   3ed0 <printf>
+    exit();
+    2d79:	e8 46 0f 00 00       	call   3cc4 <exit>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    2d7e:	50                   	push   %eax
+    2d7f:	50                   	push   %eax
+    2d80:	68 78 49 00 00       	push   $0x4978
+    2d85:	6a 01                	push   $0x1
+    2d87:	e8 44 11 00 00       	call   3ed0 <printf>
+    exit();
+    2d8c:	e8 33 0f 00 00       	call   3cc4 <exit>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    2d91:	50                   	push   %eax
+    2d92:	50                   	push   %eax
+    2d93:	68 3c 59 00 00       	push   $0x593c
+    2d98:	6a 01                	push   $0x1
+    2d9a:	e8 31 11 00 00       	call   3ed0 <printf>
+    exit();
+    2d9f:	e8 20 0f 00 00       	call   3cc4 <exit>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    2da4:	50                   	push   %eax
+    2da5:	50                   	push   %eax
+    2da6:	68 1f 59 00 00       	push   $0x591f
+    2dab:	6a 01                	push   $0x1
+    2dad:	e8 1e 11 00 00       	call   3ed0 <printf>
+    exit();
+    2db2:	e8 0d 0f 00 00       	call   3cc4 <exit>
+    2db7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    2dbe:	66 90                	xchg   %ax,%ax
+
+00002dc0 <iref>:
+{
+    2dc0:	55                   	push   %ebp
+    2dc1:	89 e5                	mov    %esp,%ebp
+    2dc3:	53                   	push   %ebx
+  printf(1, "empty file name\n");
+    2dc4:	bb 33 00 00 00       	mov    $0x33,%ebx
+{
+    2dc9:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "empty file name\n");
+    2dcc:	68 9d 59 00 00       	push   $0x599d
+    2dd1:	6a 01                	push   $0x1
+    2dd3:	e8 f8 10 00 00       	call   3ed0 <printf>
+    2dd8:	83 c4 10             	add    $0x10,%esp
+    2ddb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2ddf:	90                   	nop
+    if(mkdir("irefd") != 0){
+    2de0:	83 ec 0c             	sub    $0xc,%esp
+    2de3:	68 ae 59 00 00       	push   $0x59ae
+    2de8:	e8 3f 0f 00 00       	call   3d2c <mkdir>
+    2ded:	83 c4 10             	add    $0x10,%esp
+    2df0:	85 c0                	test   %eax,%eax
+    2df2:	0f 85 bb 00 00 00    	jne    2eb3 <iref+0xf3>
+    if(chdir("irefd") != 0){
+    2df8:	83 ec 0c             	sub    $0xc,%esp
+    2dfb:	68 ae 59 00 00       	push   $0x59ae
+    2e00:	e8 2f 0f 00 00       	call   3d34 <chdir>
+    2e05:	83 c4 10             	add    $0x10,%esp
+    2e08:	85 c0                	test   %eax,%eax
+    2e0a:	0f 85 b7 00 00 00    	jne    2ec7 <iref+0x107>
+    mkdir("");
+    2e10:	83 ec 0c             	sub    $0xc,%esp
+    2e13:	68 22 56 00 00       	push   $0x5622
+    2e18:	e8 0f 0f 00 00       	call   3d2c <mkdir>
+    link("README", "");
+    2e1d:	59                   	pop    %ecx
+    2e1e:	58                   	pop    %eax
+    2e1f:	68 22 56 00 00       	push   $0x5622
+    2e24:	68 5a 59 00 00       	push   $0x595a
+    2e29:	e8 f6 0e 00 00       	call   3d24 <link>
+    fd = open("", O_CREATE);
+    2e2e:	58                   	pop    %eax
+    2e2f:	5a                   	pop    %edx
+    2e30:	68 00 02 00 00       	push   $0x200
+    2e35:	68 22 56 00 00       	push   $0x5622
+    2e3a:	e8 c5 0e 00 00       	call   3d04 <open>
+    if(fd >= 0)
+    2e3f:	83 c4 10             	add    $0x10,%esp
+    2e42:	85 c0                	test   %eax,%eax
+    2e44:	78 0c                	js     2e52 <iref+0x92>
+      close(fd);
+    2e46:	83 ec 0c             	sub    $0xc,%esp
+    2e49:	50                   	push   %eax
+    2e4a:	e8 9d 0e 00 00       	call   3cec <close>
+    2e4f:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    2e52:	83 ec 08             	sub    $0x8,%esp
+    2e55:	68 00 02 00 00       	push   $0x200
+    2e5a:	68 fb 51 00 00       	push   $0x51fb
+    2e5f:	e8 a0 0e 00 00       	call   3d04 <open>
+    if(fd >= 0)
+    2e64:	83 c4 10             	add    $0x10,%esp
+    2e67:	85 c0                	test   %eax,%eax
+    2e69:	78 0c                	js     2e77 <iref+0xb7>
+      close(fd);
+    2e6b:	83 ec 0c             	sub    $0xc,%esp
+    2e6e:	50                   	push   %eax
+    2e6f:	e8 78 0e 00 00       	call   3cec <close>
+    2e74:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    2e77:	83 ec 0c             	sub    $0xc,%esp
+    2e7a:	68 fb 51 00 00       	push   $0x51fb
+    2e7f:	e8 90 0e 00 00       	call   3d14 <unlink>
+  for(i = 0; i < 50 + 1; i++){
+    2e84:	83 c4 10             	add    $0x10,%esp
+    2e87:	83 eb 01             	sub    $0x1,%ebx
+    2e8a:	0f 85 50 ff ff ff    	jne    2de0 <iref+0x20>
+  chdir("/");
+    2e90:	83 ec 0c             	sub    $0xc,%esp
+    2e93:	68 e5 53 00 00       	push   $0x53e5
+    2e98:	e8 97 0e 00 00       	call   3d34 <chdir>
+  printf(1, "empty file name OK\n");
+    2e9d:	58                   	pop    %eax
+    2e9e:	5a                   	pop    %edx
+    2e9f:	68 dc 59 00 00       	push   $0x59dc
+    2ea4:	6a 01                	push   $0x1
+    2ea6:	e8 25 10 00 00       	call   3ed0 <printf>
+}
+    2eab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2eae:	83 c4 10             	add    $0x10,%esp
+    2eb1:	c9                   	leave
+    2eb2:	c3                   	ret
+      printf(1, "mkdir irefd failed\n");
+    2eb3:	83 ec 08             	sub    $0x8,%esp
+    2eb6:	68 b4 59 00 00       	push   $0x59b4
+    2ebb:	6a 01                	push   $0x1
+    2ebd:	e8 0e 10 00 00       	call   3ed0 <printf>
+      exit();
+    2ec2:	e8 fd 0d 00 00       	call   3cc4 <exit>
+      printf(1, "chdir irefd failed\n");
+    2ec7:	83 ec 08             	sub    $0x8,%esp
+    2eca:	68 c8 59 00 00       	push   $0x59c8
+    2ecf:	6a 01                	push   $0x1
+    2ed1:	e8 fa 0f 00 00       	call   3ed0 <printf>
+      exit();
+    2ed6:	e8 e9 0d 00 00       	call   3cc4 <exit>
+    2edb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    2edf:	90                   	nop
+
+00002ee0 <forktest>:
+{
+    2ee0:	55                   	push   %ebp
+    2ee1:	89 e5                	mov    %esp,%ebp
+    2ee3:	53                   	push   %ebx
+  for(n=0; n<5000; n++){
+    2ee4:	31 db                	xor    %ebx,%ebx
+{
+    2ee6:	83 ec 0c             	sub    $0xc,%esp
+  printf(1, "fork test\n");
+    2ee9:	68 f0 59 00 00       	push   $0x59f0
+    2eee:	6a 01                	push   $0x1
+    2ef0:	e8 db 0f 00 00       	call   3ed0 <printf>
+    2ef5:	83 c4 10             	add    $0x10,%esp
+    2ef8:	eb 13                	jmp    2f0d <forktest+0x2d>
+    2efa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(pid == 0)
+    2f00:	74 4d                	je     2f4f <forktest+0x6f>
+  for(n=0; n<5000; n++){
+    2f02:	83 c3 01             	add    $0x1,%ebx
+    2f05:	81 fb 88 13 00 00    	cmp    $0x1388,%ebx
+    2f0b:	74 6e                	je     2f7b <forktest+0x9b>
+    pid = fork();
+    2f0d:	e8 aa 0d 00 00       	call   3cbc <fork>
+    if(pid < 0)
+    2f12:	85 c0                	test   %eax,%eax
+    2f14:	79 ea                	jns    2f00 <forktest+0x20>
+  for(; n > 0; n--){
+    2f16:	85 db                	test   %ebx,%ebx
+    2f18:	74 14                	je     2f2e <forktest+0x4e>
+    2f1a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    if(wait() < 0){
+    2f20:	e8 a7 0d 00 00       	call   3ccc <wait>
+    2f25:	85 c0                	test   %eax,%eax
+    2f27:	78 2b                	js     2f54 <forktest+0x74>
+  for(; n > 0; n--){
+    2f29:	83 eb 01             	sub    $0x1,%ebx
+    2f2c:	75 f2                	jne    2f20 <forktest+0x40>
+  if(wait() != -1){
+    2f2e:	e8 99 0d 00 00       	call   3ccc <wait>
+    2f33:	83 f8 ff             	cmp    $0xffffffff,%eax
+    2f36:	75 30                	jne    2f68 <forktest+0x88>
+  printf(1, "fork test OK\n");
+    2f38:	83 ec 08             	sub    $0x8,%esp
+    2f3b:	68 22 5a 00 00       	push   $0x5a22
+    2f40:	6a 01                	push   $0x1
+    2f42:	e8 89 0f 00 00       	call   3ed0 <printf>
+}
+    2f47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    2f4a:	83 c4 10             	add    $0x10,%esp
+    2f4d:	c9                   	leave
+    2f4e:	c3                   	ret
+      exit();
+    2f4f:	e8 70 0d 00 00       	call   3cc4 <exit>
+      printf(1, "wait stopped early\n");
+    2f54:	83 ec 08             	sub    $0x8,%esp
+    2f57:	68 fb 59 00 00       	push   $0x59fb
+    2f5c:	6a 01                	push   $0x1
+    2f5e:	e8 6d 0f 00 00       	call   3ed0 <printf>
+      exit();
+    2f63:	e8 5c 0d 00 00       	call   3cc4 <exit>
+    printf(1, "wait got too many\n");
+    2f68:	50                   	push   %eax
+    2f69:	50                   	push   %eax
+    2f6a:	68 0f 5a 00 00       	push   $0x5a0f
+    2f6f:	6a 01                	push   $0x1
+    2f71:	e8 5a 0f 00 00       	call   3ed0 <printf>
+    exit();
+    2f76:	e8 49 0d 00 00       	call   3cc4 <exit>
+    printf(1, "fork claimed to work 5000 times!\n");
+    2f7b:	52                   	push   %edx
+    2f7c:	52                   	push   %edx
+    2f7d:	68 b8 49 00 00       	push   $0x49b8
+    2f82:	6a 01                	push   $0x1
+    2f84:	e8 47 0f 00 00       	call   3ed0 <printf>
+    exit();
+    2f89:	e8 36 0d 00 00       	call   3cc4 <exit>
+    2f8e:	66 90                	xchg   %ax,%ax
+
+00002f90 <sbrktest>:
+{
+    2f90:	55                   	push   %ebp
+    2f91:	89 e5                	mov    %esp,%ebp
+    2f93:	57                   	push   %edi
+    2f94:	56                   	push   %esi
+  for(i = 0; i < 5000; i++){
+    2f95:	31 f6                	xor    %esi,%esi
+{
+    2f97:	53                   	push   %ebx
+    2f98:	83 ec 64             	sub    $0x64,%esp
+  printf(stdout, "sbrk test\n");
+    2f9b:	68 30 5a 00 00       	push   $0x5a30
+    2fa0:	ff 35 b4 68 00 00    	push   0x68b4
+    2fa6:	e8 25 0f 00 00       	call   3ed0 <printf>
+  oldbrk = sbrk(0);
+    2fab:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2fb2:	e8 95 0d 00 00       	call   3d4c <sbrk>
+    2fb7:	89 45 a4             	mov    %eax,-0x5c(%ebp)
+  a = sbrk(0);
+    2fba:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    2fc1:	e8 86 0d 00 00       	call   3d4c <sbrk>
+    2fc6:	83 c4 10             	add    $0x10,%esp
+    2fc9:	89 c3                	mov    %eax,%ebx
+  for(i = 0; i < 5000; i++){
+    2fcb:	eb 05                	jmp    2fd2 <sbrktest+0x42>
+    2fcd:	8d 76 00             	lea    0x0(%esi),%esi
+    a = b + 1;
+    2fd0:	89 c3                	mov    %eax,%ebx
+    b = sbrk(1);
+    2fd2:	83 ec 0c             	sub    $0xc,%esp
+    2fd5:	6a 01                	push   $0x1
+    2fd7:	e8 70 0d 00 00       	call   3d4c <sbrk>
+    if(b != a){
+    2fdc:	83 c4 10             	add    $0x10,%esp
+    2fdf:	39 d8                	cmp    %ebx,%eax
+    2fe1:	0f 85 9c 02 00 00    	jne    3283 <sbrktest+0x2f3>
+  for(i = 0; i < 5000; i++){
+    2fe7:	83 c6 01             	add    $0x1,%esi
+    *b = 1;
+    2fea:	c6 03 01             	movb   $0x1,(%ebx)
+    a = b + 1;
+    2fed:	8d 43 01             	lea    0x1(%ebx),%eax
+  for(i = 0; i < 5000; i++){
+    2ff0:	81 fe 88 13 00 00    	cmp    $0x1388,%esi
+    2ff6:	75 d8                	jne    2fd0 <sbrktest+0x40>
+  pid = fork();
+    2ff8:	e8 bf 0c 00 00       	call   3cbc <fork>
+    2ffd:	89 c6                	mov    %eax,%esi
+  if(pid < 0){
+    2fff:	85 c0                	test   %eax,%eax
+    3001:	0f 88 02 03 00 00    	js     3309 <sbrktest+0x379>
+  c = sbrk(1);
+    3007:	83 ec 0c             	sub    $0xc,%esp
+  if(c != a + 1){
+    300a:	83 c3 02             	add    $0x2,%ebx
+  c = sbrk(1);
+    300d:	6a 01                	push   $0x1
+    300f:	e8 38 0d 00 00       	call   3d4c <sbrk>
+  c = sbrk(1);
+    3014:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+    301b:	e8 2c 0d 00 00       	call   3d4c <sbrk>
+  if(c != a + 1){
+    3020:	83 c4 10             	add    $0x10,%esp
+    3023:	39 c3                	cmp    %eax,%ebx
+    3025:	0f 85 3b 03 00 00    	jne    3366 <sbrktest+0x3d6>
+  if(pid == 0)
+    302b:	85 f6                	test   %esi,%esi
+    302d:	0f 84 2e 03 00 00    	je     3361 <sbrktest+0x3d1>
+  wait();
+    3033:	e8 94 0c 00 00       	call   3ccc <wait>
+  a = sbrk(0);
+    3038:	83 ec 0c             	sub    $0xc,%esp
+    303b:	6a 00                	push   $0x0
+    303d:	e8 0a 0d 00 00       	call   3d4c <sbrk>
+    3042:	89 c3                	mov    %eax,%ebx
+  amt = (BIG) - (uint)a;
+    3044:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3049:	29 d8                	sub    %ebx,%eax
+  p = sbrk(amt);
+    304b:	89 04 24             	mov    %eax,(%esp)
+    304e:	e8 f9 0c 00 00       	call   3d4c <sbrk>
+  if (p != a) {
+    3053:	83 c4 10             	add    $0x10,%esp
+    3056:	39 c3                	cmp    %eax,%ebx
+    3058:	0f 85 94 02 00 00    	jne    32f2 <sbrktest+0x362>
+  a = sbrk(0);
+    305e:	83 ec 0c             	sub    $0xc,%esp
+  *lastaddr = 99;
+    3061:	c6 05 ff ff 3f 06 63 	movb   $0x63,0x63fffff
+  a = sbrk(0);
+    3068:	6a 00                	push   $0x0
+    306a:	e8 dd 0c 00 00       	call   3d4c <sbrk>
+  c = sbrk(-4096);
+    306f:	c7 04 24 00 f0 ff ff 	movl   $0xfffff000,(%esp)
+  a = sbrk(0);
+    3076:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-4096);
+    3078:	e8 cf 0c 00 00       	call   3d4c <sbrk>
+  if(c == (char*)0xffffffff){
+    307d:	83 c4 10             	add    $0x10,%esp
+    3080:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3083:	0f 84 22 03 00 00    	je     33ab <sbrktest+0x41b>
+  c = sbrk(0);
+    3089:	83 ec 0c             	sub    $0xc,%esp
+    308c:	6a 00                	push   $0x0
+    308e:	e8 b9 0c 00 00       	call   3d4c <sbrk>
+  if(c != a - 4096){
+    3093:	8d 93 00 f0 ff ff    	lea    -0x1000(%ebx),%edx
+    3099:	83 c4 10             	add    $0x10,%esp
+    309c:	39 d0                	cmp    %edx,%eax
+    309e:	0f 85 f0 02 00 00    	jne    3394 <sbrktest+0x404>
+  a = sbrk(0);
+    30a4:	83 ec 0c             	sub    $0xc,%esp
+    30a7:	6a 00                	push   $0x0
+    30a9:	e8 9e 0c 00 00       	call   3d4c <sbrk>
+  c = sbrk(4096);
+    30ae:	c7 04 24 00 10 00 00 	movl   $0x1000,(%esp)
+  a = sbrk(0);
+    30b5:	89 c3                	mov    %eax,%ebx
+  c = sbrk(4096);
+    30b7:	e8 90 0c 00 00       	call   3d4c <sbrk>
+  if(c != a || sbrk(0) != a + 4096){
+    30bc:	83 c4 10             	add    $0x10,%esp
+  c = sbrk(4096);
+    30bf:	89 c6                	mov    %eax,%esi
+  if(c != a || sbrk(0) != a + 4096){
+    30c1:	39 c3                	cmp    %eax,%ebx
+    30c3:	0f 85 b4 02 00 00    	jne    337d <sbrktest+0x3ed>
+    30c9:	83 ec 0c             	sub    $0xc,%esp
+    30cc:	6a 00                	push   $0x0
+    30ce:	e8 79 0c 00 00       	call   3d4c <sbrk>
+    30d3:	8d 93 00 10 00 00    	lea    0x1000(%ebx),%edx
+    30d9:	83 c4 10             	add    $0x10,%esp
+    30dc:	39 c2                	cmp    %eax,%edx
+    30de:	0f 85 99 02 00 00    	jne    337d <sbrktest+0x3ed>
+  if(*lastaddr == 99){
+    30e4:	80 3d ff ff 3f 06 63 	cmpb   $0x63,0x63fffff
+    30eb:	0f 84 2f 02 00 00    	je     3320 <sbrktest+0x390>
+  a = sbrk(0);
+    30f1:	83 ec 0c             	sub    $0xc,%esp
+    30f4:	6a 00                	push   $0x0
+    30f6:	e8 51 0c 00 00       	call   3d4c <sbrk>
+  c = sbrk(-(sbrk(0) - oldbrk));
+    30fb:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  a = sbrk(0);
+    3102:	89 c3                	mov    %eax,%ebx
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3104:	e8 43 0c 00 00       	call   3d4c <sbrk>
+    3109:	89 c2                	mov    %eax,%edx
+    310b:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    310e:	29 d0                	sub    %edx,%eax
+    3110:	89 04 24             	mov    %eax,(%esp)
+    3113:	e8 34 0c 00 00       	call   3d4c <sbrk>
+  if(c != a){
+    3118:	83 c4 10             	add    $0x10,%esp
+    311b:	39 c3                	cmp    %eax,%ebx
+    311d:	0f 85 b8 01 00 00    	jne    32db <sbrktest+0x34b>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    3123:	bb 00 00 00 80       	mov    $0x80000000,%ebx
+    3128:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    312f:	90                   	nop
+    ppid = getpid();
+    3130:	e8 0f 0c 00 00       	call   3d44 <getpid>
+    3135:	89 c6                	mov    %eax,%esi
+    pid = fork();
+    3137:	e8 80 0b 00 00       	call   3cbc <fork>
+    if(pid < 0){
+    313c:	85 c0                	test   %eax,%eax
+    313e:	0f 88 5d 01 00 00    	js     32a1 <sbrktest+0x311>
+    if(pid == 0){
+    3144:	0f 84 6f 01 00 00    	je     32b9 <sbrktest+0x329>
+    wait();
+    314a:	e8 7d 0b 00 00       	call   3ccc <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    314f:	81 c3 50 c3 00 00    	add    $0xc350,%ebx
+    3155:	81 fb 80 84 1e 80    	cmp    $0x801e8480,%ebx
+    315b:	75 d3                	jne    3130 <sbrktest+0x1a0>
+  if(pipe(fds) != 0){
+    315d:	83 ec 0c             	sub    $0xc,%esp
+    3160:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    3163:	50                   	push   %eax
+    3164:	e8 6b 0b 00 00       	call   3cd4 <pipe>
+    3169:	83 c4 10             	add    $0x10,%esp
+    316c:	85 c0                	test   %eax,%eax
+    316e:	0f 85 da 01 00 00    	jne    334e <sbrktest+0x3be>
+    3174:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+    3177:	8d 75 e8             	lea    -0x18(%ebp),%esi
+    317a:	89 df                	mov    %ebx,%edi
+    317c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if((pids[i] = fork()) == 0){
+    3180:	e8 37 0b 00 00       	call   3cbc <fork>
+    3185:	89 07                	mov    %eax,(%edi)
+    3187:	85 c0                	test   %eax,%eax
+    3189:	0f 84 91 00 00 00    	je     3220 <sbrktest+0x290>
+    if(pids[i] != -1)
+    318f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3192:	74 14                	je     31a8 <sbrktest+0x218>
+      read(fds[0], &scratch, 1);
+    3194:	83 ec 04             	sub    $0x4,%esp
+    3197:	8d 45 b7             	lea    -0x49(%ebp),%eax
+    319a:	6a 01                	push   $0x1
+    319c:	50                   	push   %eax
+    319d:	ff 75 b8             	push   -0x48(%ebp)
+    31a0:	e8 37 0b 00 00       	call   3cdc <read>
+    31a5:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    31a8:	83 c7 04             	add    $0x4,%edi
+    31ab:	39 f7                	cmp    %esi,%edi
+    31ad:	75 d1                	jne    3180 <sbrktest+0x1f0>
+  c = sbrk(4096);
+    31af:	83 ec 0c             	sub    $0xc,%esp
+    31b2:	68 00 10 00 00       	push   $0x1000
+    31b7:	e8 90 0b 00 00       	call   3d4c <sbrk>
+    31bc:	83 c4 10             	add    $0x10,%esp
+    31bf:	89 c7                	mov    %eax,%edi
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    31c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    if(pids[i] == -1)
+    31c8:	8b 03                	mov    (%ebx),%eax
+    31ca:	83 f8 ff             	cmp    $0xffffffff,%eax
+    31cd:	74 11                	je     31e0 <sbrktest+0x250>
+    kill(pids[i]);
+    31cf:	83 ec 0c             	sub    $0xc,%esp
+    31d2:	50                   	push   %eax
+    31d3:	e8 1c 0b 00 00       	call   3cf4 <kill>
+    wait();
+    31d8:	e8 ef 0a 00 00       	call   3ccc <wait>
+    31dd:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    31e0:	83 c3 04             	add    $0x4,%ebx
+    31e3:	39 f3                	cmp    %esi,%ebx
+    31e5:	75 e1                	jne    31c8 <sbrktest+0x238>
+  if(c == (char*)0xffffffff){
+    31e7:	83 ff ff             	cmp    $0xffffffff,%edi
+    31ea:	0f 84 47 01 00 00    	je     3337 <sbrktest+0x3a7>
+  if(sbrk(0) > oldbrk)
+    31f0:	83 ec 0c             	sub    $0xc,%esp
+    31f3:	6a 00                	push   $0x0
+    31f5:	e8 52 0b 00 00       	call   3d4c <sbrk>
+    31fa:	83 c4 10             	add    $0x10,%esp
+    31fd:	39 45 a4             	cmp    %eax,-0x5c(%ebp)
+    3200:	72 60                	jb     3262 <sbrktest+0x2d2>
+  printf(stdout, "sbrk test OK\n");
+    3202:	83 ec 08             	sub    $0x8,%esp
+    3205:	68 d8 5a 00 00       	push   $0x5ad8
+    320a:	ff 35 b4 68 00 00    	push   0x68b4
+    3210:	e8 bb 0c 00 00       	call   3ed0 <printf>
+}
+    3215:	83 c4 10             	add    $0x10,%esp
+    3218:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    321b:	5b                   	pop    %ebx
+    321c:	5e                   	pop    %esi
+    321d:	5f                   	pop    %edi
+    321e:	5d                   	pop    %ebp
+    321f:	c3                   	ret
+      sbrk(BIG - (uint)sbrk(0));
+    3220:	83 ec 0c             	sub    $0xc,%esp
+    3223:	6a 00                	push   $0x0
+    3225:	e8 22 0b 00 00       	call   3d4c <sbrk>
+    322a:	89 c2                	mov    %eax,%edx
+    322c:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    3231:	29 d0                	sub    %edx,%eax
+    3233:	89 04 24             	mov    %eax,(%esp)
+    3236:	e8 11 0b 00 00       	call   3d4c <sbrk>
+      write(fds[1], "x", 1);
+    323b:	83 c4 0c             	add    $0xc,%esp
+    323e:	6a 01                	push   $0x1
+    3240:	68 fc 51 00 00       	push   $0x51fc
+    3245:	ff 75 bc             	push   -0x44(%ebp)
+    3248:	e8 97 0a 00 00       	call   3ce4 <write>
+    324d:	83 c4 10             	add    $0x10,%esp
+      for(;;) sleep(1000);
+    3250:	83 ec 0c             	sub    $0xc,%esp
+    3253:	68 e8 03 00 00       	push   $0x3e8
+    3258:	e8 f7 0a 00 00       	call   3d54 <sleep>
+    325d:	83 c4 10             	add    $0x10,%esp
+    3260:	eb ee                	jmp    3250 <sbrktest+0x2c0>
+    sbrk(-(sbrk(0) - oldbrk));
+    3262:	83 ec 0c             	sub    $0xc,%esp
+    3265:	6a 00                	push   $0x0
+    3267:	e8 e0 0a 00 00       	call   3d4c <sbrk>
+    326c:	89 c2                	mov    %eax,%edx
+    326e:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+    3271:	29 d0                	sub    %edx,%eax
+    3273:	89 04 24             	mov    %eax,(%esp)
+    3276:	e8 d1 0a 00 00       	call   3d4c <sbrk>
+    327b:	83 c4 10             	add    $0x10,%esp
+    327e:	e9 7f ff ff ff       	jmp    3202 <sbrktest+0x272>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3283:	83 ec 0c             	sub    $0xc,%esp
+    3286:	50                   	push   %eax
+    3287:	53                   	push   %ebx
+    3288:	56                   	push   %esi
+    3289:	68 3b 5a 00 00       	push   $0x5a3b
+    328e:	ff 35 b4 68 00 00    	push   0x68b4
+    3294:	e8 37 0c 00 00       	call   3ed0 <printf>
+      exit();
+    3299:	83 c4 20             	add    $0x20,%esp
+    329c:	e8 23 0a 00 00       	call   3cc4 <exit>
+      printf(stdout, "fork failed\n");
+    32a1:	83 ec 08             	sub    $0x8,%esp
+    32a4:	68 81 5b 00 00       	push   $0x5b81
+    32a9:	ff 35 b4 68 00 00    	push   0x68b4
+    32af:	e8 1c 0c 00 00       	call   3ed0 <printf>
+      exit();
+    32b4:	e8 0b 0a 00 00       	call   3cc4 <exit>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    32b9:	0f be 03             	movsbl (%ebx),%eax
+    32bc:	50                   	push   %eax
+    32bd:	53                   	push   %ebx
+    32be:	68 a4 5a 00 00       	push   $0x5aa4
+    32c3:	ff 35 b4 68 00 00    	push   0x68b4
+    32c9:	e8 02 0c 00 00       	call   3ed0 <printf>
+      kill(ppid);
+    32ce:	89 34 24             	mov    %esi,(%esp)
+    32d1:	e8 1e 0a 00 00       	call   3cf4 <kill>
+      exit();
+    32d6:	e8 e9 09 00 00       	call   3cc4 <exit>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    32db:	50                   	push   %eax
+    32dc:	53                   	push   %ebx
+    32dd:	68 ac 4a 00 00       	push   $0x4aac
+    32e2:	ff 35 b4 68 00 00    	push   0x68b4
+    32e8:	e8 e3 0b 00 00       	call   3ed0 <printf>
+    exit();
+    32ed:	e8 d2 09 00 00       	call   3cc4 <exit>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    32f2:	56                   	push   %esi
+    32f3:	56                   	push   %esi
+    32f4:	68 dc 49 00 00       	push   $0x49dc
+    32f9:	ff 35 b4 68 00 00    	push   0x68b4
+    32ff:	e8 cc 0b 00 00       	call   3ed0 <printf>
+    exit();
+    3304:	e8 bb 09 00 00       	call   3cc4 <exit>
+    printf(stdout, "sbrk test fork failed\n");
+    3309:	50                   	push   %eax
+    330a:	50                   	push   %eax
+    330b:	68 56 5a 00 00       	push   $0x5a56
+    3310:	ff 35 b4 68 00 00    	push   0x68b4
+    3316:	e8 b5 0b 00 00       	call   3ed0 <printf>
+    exit();
+    331b:	e8 a4 09 00 00       	call   3cc4 <exit>
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3320:	51                   	push   %ecx
+    3321:	51                   	push   %ecx
+    3322:	68 7c 4a 00 00       	push   $0x4a7c
+    3327:	ff 35 b4 68 00 00    	push   0x68b4
+    332d:	e8 9e 0b 00 00       	call   3ed0 <printf>
+    exit();
+    3332:	e8 8d 09 00 00       	call   3cc4 <exit>
+    printf(stdout, "failed sbrk leaked memory\n");
+    3337:	50                   	push   %eax
+    3338:	50                   	push   %eax
+    3339:	68 bd 5a 00 00       	push   $0x5abd
+    333e:	ff 35 b4 68 00 00    	push   0x68b4
+    3344:	e8 87 0b 00 00       	call   3ed0 <printf>
+    exit();
+    3349:	e8 76 09 00 00       	call   3cc4 <exit>
+    printf(1, "pipe() failed\n");
+    334e:	52                   	push   %edx
+    334f:	52                   	push   %edx
+    3350:	68 38 55 00 00       	push   $0x5538
+    3355:	6a 01                	push   $0x1
+    3357:	e8 74 0b 00 00       	call   3ed0 <printf>
+    exit();
+    335c:	e8 63 09 00 00       	call   3cc4 <exit>
+    exit();
+    3361:	e8 5e 09 00 00       	call   3cc4 <exit>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3366:	57                   	push   %edi
+    3367:	57                   	push   %edi
+    3368:	68 6d 5a 00 00       	push   $0x5a6d
+    336d:	ff 35 b4 68 00 00    	push   0x68b4
+    3373:	e8 58 0b 00 00       	call   3ed0 <printf>
+    exit();
+    3378:	e8 47 09 00 00       	call   3cc4 <exit>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    337d:	56                   	push   %esi
+    337e:	53                   	push   %ebx
+    337f:	68 54 4a 00 00       	push   $0x4a54
+    3384:	ff 35 b4 68 00 00    	push   0x68b4
+    338a:	e8 41 0b 00 00       	call   3ed0 <printf>
+    exit();
+    338f:	e8 30 09 00 00       	call   3cc4 <exit>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3394:	50                   	push   %eax
+    3395:	53                   	push   %ebx
+    3396:	68 1c 4a 00 00       	push   $0x4a1c
+    339b:	ff 35 b4 68 00 00    	push   0x68b4
+    33a1:	e8 2a 0b 00 00       	call   3ed0 <printf>
+    exit();
+    33a6:	e8 19 09 00 00       	call   3cc4 <exit>
+    printf(stdout, "sbrk could not deallocate\n");
+    33ab:	53                   	push   %ebx
+    33ac:	53                   	push   %ebx
+    33ad:	68 89 5a 00 00       	push   $0x5a89
+    33b2:	ff 35 b4 68 00 00    	push   0x68b4
+    33b8:	e8 13 0b 00 00       	call   3ed0 <printf>
+    exit();
+    33bd:	e8 02 09 00 00       	call   3cc4 <exit>
+    33c2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    33c9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000033d0 <validateint>:
+}
+    33d0:	c3                   	ret
+    33d1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    33d8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    33df:	90                   	nop
+
+000033e0 <validatetest>:
+{
+    33e0:	55                   	push   %ebp
+    33e1:	89 e5                	mov    %esp,%ebp
+    33e3:	56                   	push   %esi
+  for(p = 0; p <= (uint)hi; p += 4096){
+    33e4:	31 f6                	xor    %esi,%esi
+{
+    33e6:	53                   	push   %ebx
+  printf(stdout, "validate test\n");
+    33e7:	83 ec 08             	sub    $0x8,%esp
+    33ea:	68 e6 5a 00 00       	push   $0x5ae6
+    33ef:	ff 35 b4 68 00 00    	push   0x68b4
+    33f5:	e8 d6 0a 00 00       	call   3ed0 <printf>
+    33fa:	83 c4 10             	add    $0x10,%esp
+    33fd:	8d 76 00             	lea    0x0(%esi),%esi
+    if((pid = fork()) == 0){
+    3400:	e8 b7 08 00 00       	call   3cbc <fork>
+    3405:	89 c3                	mov    %eax,%ebx
+    3407:	85 c0                	test   %eax,%eax
+    3409:	74 63                	je     346e <validatetest+0x8e>
+    sleep(0);
+    340b:	83 ec 0c             	sub    $0xc,%esp
+    340e:	6a 00                	push   $0x0
+    3410:	e8 3f 09 00 00       	call   3d54 <sleep>
+    sleep(0);
+    3415:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+    341c:	e8 33 09 00 00       	call   3d54 <sleep>
+    kill(pid);
+    3421:	89 1c 24             	mov    %ebx,(%esp)
+    3424:	e8 cb 08 00 00       	call   3cf4 <kill>
+    wait();
+    3429:	e8 9e 08 00 00       	call   3ccc <wait>
+    if(link("nosuchfile", (char*)p) != -1){
+    342e:	58                   	pop    %eax
+    342f:	5a                   	pop    %edx
+    3430:	56                   	push   %esi
+    3431:	68 f5 5a 00 00       	push   $0x5af5
+    3436:	e8 e9 08 00 00       	call   3d24 <link>
+    343b:	83 c4 10             	add    $0x10,%esp
+    343e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3441:	75 30                	jne    3473 <validatetest+0x93>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    3443:	81 c6 00 10 00 00    	add    $0x1000,%esi
+    3449:	81 fe 00 40 11 00    	cmp    $0x114000,%esi
+    344f:	75 af                	jne    3400 <validatetest+0x20>
+  printf(stdout, "validate ok\n");
+    3451:	83 ec 08             	sub    $0x8,%esp
+    3454:	68 19 5b 00 00       	push   $0x5b19
+    3459:	ff 35 b4 68 00 00    	push   0x68b4
+    345f:	e8 6c 0a 00 00       	call   3ed0 <printf>
+}
+    3464:	83 c4 10             	add    $0x10,%esp
+    3467:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    346a:	5b                   	pop    %ebx
+    346b:	5e                   	pop    %esi
+    346c:	5d                   	pop    %ebp
+    346d:	c3                   	ret
+      exit();
+    346e:	e8 51 08 00 00       	call   3cc4 <exit>
+      printf(stdout, "link should not succeed\n");
+    3473:	83 ec 08             	sub    $0x8,%esp
+    3476:	68 00 5b 00 00       	push   $0x5b00
+    347b:	ff 35 b4 68 00 00    	push   0x68b4
+    3481:	e8 4a 0a 00 00       	call   3ed0 <printf>
+      exit();
+    3486:	e8 39 08 00 00       	call   3cc4 <exit>
+    348b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    348f:	90                   	nop
+
+00003490 <bsstest>:
+{
+    3490:	55                   	push   %ebp
+    3491:	89 e5                	mov    %esp,%ebp
+    3493:	83 ec 10             	sub    $0x10,%esp
+  printf(stdout, "bss test\n");
+    3496:	68 26 5b 00 00       	push   $0x5b26
+    349b:	ff 35 b4 68 00 00    	push   0x68b4
+    34a1:	e8 2a 0a 00 00       	call   3ed0 <printf>
+    34a6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    34a9:	31 c0                	xor    %eax,%eax
+    34ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    34af:	90                   	nop
+    if(uninit[i] != '\0'){
+    34b0:	80 b8 e0 68 00 00 00 	cmpb   $0x0,0x68e0(%eax)
+    34b7:	75 22                	jne    34db <bsstest+0x4b>
+  for(i = 0; i < sizeof(uninit); i++){
+    34b9:	83 c0 01             	add    $0x1,%eax
+    34bc:	3d 10 27 00 00       	cmp    $0x2710,%eax
+    34c1:	75 ed                	jne    34b0 <bsstest+0x20>
+  printf(stdout, "bss test ok\n");
+    34c3:	83 ec 08             	sub    $0x8,%esp
+    34c6:	68 41 5b 00 00       	push   $0x5b41
+    34cb:	ff 35 b4 68 00 00    	push   0x68b4
+    34d1:	e8 fa 09 00 00       	call   3ed0 <printf>
+}
+    34d6:	83 c4 10             	add    $0x10,%esp
+    34d9:	c9                   	leave
+    34da:	c3                   	ret
+      printf(stdout, "bss test failed\n");
+    34db:	83 ec 08             	sub    $0x8,%esp
+    34de:	68 30 5b 00 00       	push   $0x5b30
+    34e3:	ff 35 b4 68 00 00    	push   0x68b4
+    34e9:	e8 e2 09 00 00       	call   3ed0 <printf>
+      exit();
+    34ee:	e8 d1 07 00 00       	call   3cc4 <exit>
+    34f3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    34fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003500 <bigargtest>:
+{
+    3500:	55                   	push   %ebp
+    3501:	89 e5                	mov    %esp,%ebp
+    3503:	83 ec 14             	sub    $0x14,%esp
+  unlink("bigarg-ok");
+    3506:	68 4e 5b 00 00       	push   $0x5b4e
+    350b:	e8 04 08 00 00       	call   3d14 <unlink>
+  pid = fork();
+    3510:	e8 a7 07 00 00       	call   3cbc <fork>
+  if(pid == 0){
+    3515:	83 c4 10             	add    $0x10,%esp
+    3518:	85 c0                	test   %eax,%eax
+    351a:	74 44                	je     3560 <bigargtest+0x60>
+  } else if(pid < 0){
+    351c:	0f 88 c3 00 00 00    	js     35e5 <bigargtest+0xe5>
+  wait();
+    3522:	e8 a5 07 00 00       	call   3ccc <wait>
+  fd = open("bigarg-ok", 0);
+    3527:	83 ec 08             	sub    $0x8,%esp
+    352a:	6a 00                	push   $0x0
+    352c:	68 4e 5b 00 00       	push   $0x5b4e
+    3531:	e8 ce 07 00 00       	call   3d04 <open>
+  if(fd < 0){
+    3536:	83 c4 10             	add    $0x10,%esp
+    3539:	85 c0                	test   %eax,%eax
+    353b:	0f 88 8d 00 00 00    	js     35ce <bigargtest+0xce>
+  close(fd);
+    3541:	83 ec 0c             	sub    $0xc,%esp
+    3544:	50                   	push   %eax
+    3545:	e8 a2 07 00 00       	call   3cec <close>
+  unlink("bigarg-ok");
+    354a:	c7 04 24 4e 5b 00 00 	movl   $0x5b4e,(%esp)
+    3551:	e8 be 07 00 00       	call   3d14 <unlink>
+}
+    3556:	83 c4 10             	add    $0x10,%esp
+    3559:	c9                   	leave
+    355a:	c3                   	ret
+    355b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    355f:	90                   	nop
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    3560:	c7 04 85 00 b0 00 00 	movl   $0x4ad0,0xb000(,%eax,4)
+    3567:	d0 4a 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    356b:	83 c0 01             	add    $0x1,%eax
+    356e:	83 f8 1f             	cmp    $0x1f,%eax
+    3571:	75 ed                	jne    3560 <bigargtest+0x60>
+    args[MAXARG-1] = 0;
+    3573:	31 c9                	xor    %ecx,%ecx
+    3575:	89 0d 7c b0 00 00    	mov    %ecx,0xb07c
+    printf(stdout, "bigarg test\n");
+    357b:	50                   	push   %eax
+    357c:	50                   	push   %eax
+    357d:	68 58 5b 00 00       	push   $0x5b58
+    3582:	ff 35 b4 68 00 00    	push   0x68b4
+    3588:	e8 43 09 00 00       	call   3ed0 <printf>
+    exec("echo", args);
+    358d:	58                   	pop    %eax
+    358e:	5a                   	pop    %edx
+    358f:	68 00 b0 00 00       	push   $0xb000
+    3594:	68 72 54 00 00       	push   $0x5472
+    3599:	e8 5e 07 00 00       	call   3cfc <exec>
+    printf(stdout, "bigarg test ok\n");
+    359e:	59                   	pop    %ecx
+    359f:	58                   	pop    %eax
+    35a0:	68 65 5b 00 00       	push   $0x5b65
+    35a5:	ff 35 b4 68 00 00    	push   0x68b4
+    35ab:	e8 20 09 00 00       	call   3ed0 <printf>
+    fd = open("bigarg-ok", O_CREATE);
+    35b0:	58                   	pop    %eax
+    35b1:	5a                   	pop    %edx
+    35b2:	68 00 02 00 00       	push   $0x200
+    35b7:	68 4e 5b 00 00       	push   $0x5b4e
+    35bc:	e8 43 07 00 00       	call   3d04 <open>
+    close(fd);
+    35c1:	89 04 24             	mov    %eax,(%esp)
+    35c4:	e8 23 07 00 00       	call   3cec <close>
+    exit();
+    35c9:	e8 f6 06 00 00       	call   3cc4 <exit>
+    printf(stdout, "bigarg test failed!\n");
+    35ce:	50                   	push   %eax
+    35cf:	50                   	push   %eax
+    35d0:	68 8e 5b 00 00       	push   $0x5b8e
+    35d5:	ff 35 b4 68 00 00    	push   0x68b4
+    35db:	e8 f0 08 00 00       	call   3ed0 <printf>
+    exit();
+    35e0:	e8 df 06 00 00       	call   3cc4 <exit>
+    printf(stdout, "bigargtest: fork failed\n");
+    35e5:	52                   	push   %edx
+    35e6:	52                   	push   %edx
+    35e7:	68 75 5b 00 00       	push   $0x5b75
+    35ec:	ff 35 b4 68 00 00    	push   0x68b4
+    35f2:	e8 d9 08 00 00       	call   3ed0 <printf>
+    exit();
+    35f7:	e8 c8 06 00 00       	call   3cc4 <exit>
+    35fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003600 <fsfull>:
+{
+    3600:	55                   	push   %ebp
+    3601:	89 e5                	mov    %esp,%ebp
+    3603:	57                   	push   %edi
+    3604:	56                   	push   %esi
+  for(nfiles = 0; ; nfiles++){
+    3605:	31 f6                	xor    %esi,%esi
+{
+    3607:	53                   	push   %ebx
+    3608:	83 ec 54             	sub    $0x54,%esp
+  printf(1, "fsfull test\n");
+    360b:	68 a3 5b 00 00       	push   $0x5ba3
+    3610:	6a 01                	push   $0x1
+    3612:	e8 b9 08 00 00       	call   3ed0 <printf>
+    3617:	83 c4 10             	add    $0x10,%esp
+    361a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3620:	b8 d3 4d 62 10       	mov    $0x10624dd3,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3625:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    printf(1, "writing %s\n", name);
+    362a:	83 ec 04             	sub    $0x4,%esp
+    name[0] = 'f';
+    362d:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3631:	f7 e6                	mul    %esi
+    name[5] = '\0';
+    3633:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3637:	c1 ea 06             	shr    $0x6,%edx
+    363a:	8d 42 30             	lea    0x30(%edx),%eax
+    363d:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3640:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    3646:	89 f2                	mov    %esi,%edx
+    3648:	29 c2                	sub    %eax,%edx
+    364a:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    364f:	f7 e2                	mul    %edx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3651:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3656:	c1 ea 05             	shr    $0x5,%edx
+    3659:	83 c2 30             	add    $0x30,%edx
+    365c:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    365f:	f7 e6                	mul    %esi
+    3661:	c1 ea 05             	shr    $0x5,%edx
+    3664:	6b c2 64             	imul   $0x64,%edx,%eax
+    3667:	89 f2                	mov    %esi,%edx
+    3669:	29 c2                	sub    %eax,%edx
+    366b:	89 d0                	mov    %edx,%eax
+    366d:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    366f:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3671:	c1 ea 03             	shr    $0x3,%edx
+    3674:	83 c2 30             	add    $0x30,%edx
+    3677:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    367a:	f7 e1                	mul    %ecx
+    367c:	89 f0                	mov    %esi,%eax
+    367e:	c1 ea 03             	shr    $0x3,%edx
+    3681:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    3684:	01 d2                	add    %edx,%edx
+    3686:	29 d0                	sub    %edx,%eax
+    3688:	83 c0 30             	add    $0x30,%eax
+    368b:	88 45 ac             	mov    %al,-0x54(%ebp)
+    printf(1, "writing %s\n", name);
+    368e:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    3691:	50                   	push   %eax
+    3692:	68 b0 5b 00 00       	push   $0x5bb0
+    3697:	6a 01                	push   $0x1
+    3699:	e8 32 08 00 00       	call   3ed0 <printf>
+    int fd = open(name, O_CREATE|O_RDWR);
+    369e:	58                   	pop    %eax
+    369f:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    36a2:	5a                   	pop    %edx
+    36a3:	68 02 02 00 00       	push   $0x202
+    36a8:	50                   	push   %eax
+    36a9:	e8 56 06 00 00       	call   3d04 <open>
+    if(fd < 0){
+    36ae:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    36b1:	89 c7                	mov    %eax,%edi
+    if(fd < 0){
+    36b3:	85 c0                	test   %eax,%eax
+    36b5:	78 4f                	js     3706 <fsfull+0x106>
+    int total = 0;
+    36b7:	31 db                	xor    %ebx,%ebx
+    36b9:	eb 07                	jmp    36c2 <fsfull+0xc2>
+    36bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    36bf:	90                   	nop
+      total += cc;
+    36c0:	01 c3                	add    %eax,%ebx
+      int cc = write(fd, buf, 512);
+    36c2:	83 ec 04             	sub    $0x4,%esp
+    36c5:	68 00 02 00 00       	push   $0x200
+    36ca:	68 00 90 00 00       	push   $0x9000
+    36cf:	57                   	push   %edi
+    36d0:	e8 0f 06 00 00       	call   3ce4 <write>
+      if(cc < 512)
+    36d5:	83 c4 10             	add    $0x10,%esp
+    36d8:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+    36dd:	7f e1                	jg     36c0 <fsfull+0xc0>
+    printf(1, "wrote %d bytes\n", total);
+    36df:	83 ec 04             	sub    $0x4,%esp
+    36e2:	53                   	push   %ebx
+    36e3:	68 cc 5b 00 00       	push   $0x5bcc
+    36e8:	6a 01                	push   $0x1
+    36ea:	e8 e1 07 00 00       	call   3ed0 <printf>
+    close(fd);
+    36ef:	89 3c 24             	mov    %edi,(%esp)
+    36f2:	e8 f5 05 00 00       	call   3cec <close>
+    if(total == 0)
+    36f7:	83 c4 10             	add    $0x10,%esp
+    36fa:	85 db                	test   %ebx,%ebx
+    36fc:	74 1e                	je     371c <fsfull+0x11c>
+  for(nfiles = 0; ; nfiles++){
+    36fe:	83 c6 01             	add    $0x1,%esi
+    3701:	e9 1a ff ff ff       	jmp    3620 <fsfull+0x20>
+      printf(1, "open %s failed\n", name);
+    3706:	83 ec 04             	sub    $0x4,%esp
+    3709:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    370c:	50                   	push   %eax
+    370d:	68 bc 5b 00 00       	push   $0x5bbc
+    3712:	6a 01                	push   $0x1
+    3714:	e8 b7 07 00 00       	call   3ed0 <printf>
+      break;
+    3719:	83 c4 10             	add    $0x10,%esp
+    name[1] = '0' + nfiles / 1000;
+    371c:	bf d3 4d 62 10       	mov    $0x10624dd3,%edi
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3721:	bb 1f 85 eb 51       	mov    $0x51eb851f,%ebx
+    3726:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    372d:	8d 76 00             	lea    0x0(%esi),%esi
+    name[1] = '0' + nfiles / 1000;
+    3730:	89 f0                	mov    %esi,%eax
+    unlink(name);
+    3732:	83 ec 0c             	sub    $0xc,%esp
+    name[0] = 'f';
+    3735:	c6 45 a8 66          	movb   $0x66,-0x58(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    3739:	f7 e7                	mul    %edi
+    name[5] = '\0';
+    373b:	c6 45 ad 00          	movb   $0x0,-0x53(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    373f:	c1 ea 06             	shr    $0x6,%edx
+    3742:	8d 42 30             	lea    0x30(%edx),%eax
+    3745:	88 45 a9             	mov    %al,-0x57(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3748:	69 c2 e8 03 00 00    	imul   $0x3e8,%edx,%eax
+    374e:	89 f2                	mov    %esi,%edx
+    3750:	29 c2                	sub    %eax,%edx
+    3752:	89 d0                	mov    %edx,%eax
+    3754:	f7 e3                	mul    %ebx
+    name[3] = '0' + (nfiles % 100) / 10;
+    3756:	89 f0                	mov    %esi,%eax
+    name[2] = '0' + (nfiles % 1000) / 100;
+    3758:	c1 ea 05             	shr    $0x5,%edx
+    375b:	83 c2 30             	add    $0x30,%edx
+    375e:	88 55 aa             	mov    %dl,-0x56(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    3761:	f7 e3                	mul    %ebx
+    3763:	c1 ea 05             	shr    $0x5,%edx
+    3766:	6b ca 64             	imul   $0x64,%edx,%ecx
+    3769:	89 f2                	mov    %esi,%edx
+    376b:	29 ca                	sub    %ecx,%edx
+    376d:	b9 cd cc cc cc       	mov    $0xcccccccd,%ecx
+    3772:	89 d0                	mov    %edx,%eax
+    3774:	f7 e1                	mul    %ecx
+    name[4] = '0' + (nfiles % 10);
+    3776:	89 f0                	mov    %esi,%eax
+    name[3] = '0' + (nfiles % 100) / 10;
+    3778:	c1 ea 03             	shr    $0x3,%edx
+    377b:	83 c2 30             	add    $0x30,%edx
+    377e:	88 55 ab             	mov    %dl,-0x55(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    3781:	f7 e1                	mul    %ecx
+    3783:	89 f0                	mov    %esi,%eax
+    nfiles--;
+    3785:	83 ee 01             	sub    $0x1,%esi
+    name[4] = '0' + (nfiles % 10);
+    3788:	c1 ea 03             	shr    $0x3,%edx
+    378b:	8d 14 92             	lea    (%edx,%edx,4),%edx
+    378e:	01 d2                	add    %edx,%edx
+    3790:	29 d0                	sub    %edx,%eax
+    3792:	83 c0 30             	add    $0x30,%eax
+    3795:	88 45 ac             	mov    %al,-0x54(%ebp)
+    unlink(name);
+    3798:	8d 45 a8             	lea    -0x58(%ebp),%eax
+    379b:	50                   	push   %eax
+    379c:	e8 73 05 00 00       	call   3d14 <unlink>
+  while(nfiles >= 0){
+    37a1:	83 c4 10             	add    $0x10,%esp
+    37a4:	83 fe ff             	cmp    $0xffffffff,%esi
+    37a7:	75 87                	jne    3730 <fsfull+0x130>
+  printf(1, "fsfull test finished\n");
+    37a9:	83 ec 08             	sub    $0x8,%esp
+    37ac:	68 dc 5b 00 00       	push   $0x5bdc
+    37b1:	6a 01                	push   $0x1
+    37b3:	e8 18 07 00 00       	call   3ed0 <printf>
+}
+    37b8:	83 c4 10             	add    $0x10,%esp
+    37bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    37be:	5b                   	pop    %ebx
+    37bf:	5e                   	pop    %esi
+    37c0:	5f                   	pop    %edi
+    37c1:	5d                   	pop    %ebp
+    37c2:	c3                   	ret
+    37c3:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    37ca:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000037d0 <uio>:
+{
+    37d0:	55                   	push   %ebp
+    37d1:	89 e5                	mov    %esp,%ebp
+    37d3:	83 ec 10             	sub    $0x10,%esp
+  printf(1, "uio test\n");
+    37d6:	68 f2 5b 00 00       	push   $0x5bf2
+    37db:	6a 01                	push   $0x1
+    37dd:	e8 ee 06 00 00       	call   3ed0 <printf>
+  pid = fork();
+    37e2:	e8 d5 04 00 00       	call   3cbc <fork>
+  if(pid == 0){
+    37e7:	83 c4 10             	add    $0x10,%esp
+    37ea:	85 c0                	test   %eax,%eax
+    37ec:	74 1b                	je     3809 <uio+0x39>
+  } else if(pid < 0){
+    37ee:	78 3d                	js     382d <uio+0x5d>
+  wait();
+    37f0:	e8 d7 04 00 00       	call   3ccc <wait>
+  printf(1, "uio test done\n");
+    37f5:	83 ec 08             	sub    $0x8,%esp
+    37f8:	68 fc 5b 00 00       	push   $0x5bfc
+    37fd:	6a 01                	push   $0x1
+    37ff:	e8 cc 06 00 00       	call   3ed0 <printf>
+}
+    3804:	83 c4 10             	add    $0x10,%esp
+    3807:	c9                   	leave
+    3808:	c3                   	ret
+    asm volatile("outb %0,%1"::"a"(val), "d" (port));
+    3809:	b8 09 00 00 00       	mov    $0x9,%eax
+    380e:	ba 70 00 00 00       	mov    $0x70,%edx
+    3813:	ee                   	out    %al,(%dx)
+    asm volatile("inb %1,%0" : "=a" (val) : "d" (port));
+    3814:	ba 71 00 00 00       	mov    $0x71,%edx
+    3819:	ec                   	in     (%dx),%al
+    printf(1, "uio: uio succeeded; test FAILED\n");
+    381a:	52                   	push   %edx
+    381b:	52                   	push   %edx
+    381c:	68 b0 4b 00 00       	push   $0x4bb0
+    3821:	6a 01                	push   $0x1
+    3823:	e8 a8 06 00 00       	call   3ed0 <printf>
+    exit();
+    3828:	e8 97 04 00 00       	call   3cc4 <exit>
+    printf (1, "fork failed\n");
+    382d:	50                   	push   %eax
+    382e:	50                   	push   %eax
+    382f:	68 81 5b 00 00       	push   $0x5b81
+    3834:	6a 01                	push   $0x1
+    3836:	e8 95 06 00 00       	call   3ed0 <printf>
+    exit();
+    383b:	e8 84 04 00 00       	call   3cc4 <exit>
+
+00003840 <argptest>:
+{
+    3840:	55                   	push   %ebp
+    3841:	89 e5                	mov    %esp,%ebp
+    3843:	53                   	push   %ebx
+    3844:	83 ec 0c             	sub    $0xc,%esp
+  fd = open("init", O_RDONLY);
+    3847:	6a 00                	push   $0x0
+    3849:	68 0b 5c 00 00       	push   $0x5c0b
+    384e:	e8 b1 04 00 00       	call   3d04 <open>
+  if (fd < 0) {
+    3853:	83 c4 10             	add    $0x10,%esp
+    3856:	85 c0                	test   %eax,%eax
+    3858:	78 39                	js     3893 <argptest+0x53>
+  read(fd, sbrk(0) - 1, -1);
+    385a:	83 ec 0c             	sub    $0xc,%esp
+    385d:	89 c3                	mov    %eax,%ebx
+    385f:	6a 00                	push   $0x0
+    3861:	e8 e6 04 00 00       	call   3d4c <sbrk>
+    3866:	83 c4 0c             	add    $0xc,%esp
+    3869:	83 e8 01             	sub    $0x1,%eax
+    386c:	6a ff                	push   $0xffffffff
+    386e:	50                   	push   %eax
+    386f:	53                   	push   %ebx
+    3870:	e8 67 04 00 00       	call   3cdc <read>
+  close(fd);
+    3875:	89 1c 24             	mov    %ebx,(%esp)
+    3878:	e8 6f 04 00 00       	call   3cec <close>
+  printf(1, "arg test passed\n");
+    387d:	58                   	pop    %eax
+    387e:	5a                   	pop    %edx
+    387f:	68 1d 5c 00 00       	push   $0x5c1d
+    3884:	6a 01                	push   $0x1
+    3886:	e8 45 06 00 00       	call   3ed0 <printf>
+}
+    388b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    388e:	83 c4 10             	add    $0x10,%esp
+    3891:	c9                   	leave
+    3892:	c3                   	ret
+    printf(2, "open failed\n");
+    3893:	51                   	push   %ecx
+    3894:	51                   	push   %ecx
+    3895:	68 10 5c 00 00       	push   $0x5c10
+    389a:	6a 02                	push   $0x2
+    389c:	e8 2f 06 00 00       	call   3ed0 <printf>
+    exit();
+    38a1:	e8 1e 04 00 00       	call   3cc4 <exit>
+    38a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    38ad:	8d 76 00             	lea    0x0(%esi),%esi
+
+000038b0 <rand>:
+  randstate = randstate * 1664525 + 1013904223;
+    38b0:	69 05 b0 68 00 00 0d 	imul   $0x19660d,0x68b0,%eax
+    38b7:	66 19 00 
+    38ba:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    38bf:	a3 b0 68 00 00       	mov    %eax,0x68b0
+}
+    38c4:	c3                   	ret
+    38c5:	66 90                	xchg   %ax,%ax
+    38c7:	66 90                	xchg   %ax,%ax
+    38c9:	66 90                	xchg   %ax,%ax
+    38cb:	66 90                	xchg   %ax,%ax
+    38cd:	66 90                	xchg   %ax,%ax
+    38cf:	90                   	nop
+
+000038d0 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+    38d0:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+    38d1:	31 c0                	xor    %eax,%eax
+{
+    38d3:	89 e5                	mov    %esp,%ebp
+    38d5:	53                   	push   %ebx
+    38d6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    38d9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    38dc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+    38e0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+    38e4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+    38e7:	83 c0 01             	add    $0x1,%eax
+    38ea:	84 d2                	test   %dl,%dl
+    38ec:	75 f2                	jne    38e0 <strcpy+0x10>
+    ;
+  return os;
+}
+    38ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    38f1:	89 c8                	mov    %ecx,%eax
+    38f3:	c9                   	leave
+    38f4:	c3                   	ret
+    38f5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    38fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003900 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+    3900:	55                   	push   %ebp
+    3901:	89 e5                	mov    %esp,%ebp
+    3903:	53                   	push   %ebx
+    3904:	8b 55 08             	mov    0x8(%ebp),%edx
+    3907:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+    390a:	0f b6 02             	movzbl (%edx),%eax
+    390d:	84 c0                	test   %al,%al
+    390f:	75 17                	jne    3928 <strcmp+0x28>
+    3911:	eb 3a                	jmp    394d <strcmp+0x4d>
+    3913:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3917:	90                   	nop
+    3918:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+    391c:	83 c2 01             	add    $0x1,%edx
+    391f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+    3922:	84 c0                	test   %al,%al
+    3924:	74 1a                	je     3940 <strcmp+0x40>
+    p++, q++;
+    3926:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+    3928:	0f b6 19             	movzbl (%ecx),%ebx
+    392b:	38 c3                	cmp    %al,%bl
+    392d:	74 e9                	je     3918 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+    392f:	29 d8                	sub    %ebx,%eax
+}
+    3931:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3934:	c9                   	leave
+    3935:	c3                   	ret
+    3936:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    393d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+    3940:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+    3944:	31 c0                	xor    %eax,%eax
+    3946:	29 d8                	sub    %ebx,%eax
+}
+    3948:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    394b:	c9                   	leave
+    394c:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+    394d:	0f b6 19             	movzbl (%ecx),%ebx
+    3950:	31 c0                	xor    %eax,%eax
+    3952:	eb db                	jmp    392f <strcmp+0x2f>
+    3954:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    395b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    395f:	90                   	nop
+
+00003960 <strlen>:
+
+uint
+strlen(const char *s)
+{
+    3960:	55                   	push   %ebp
+    3961:	89 e5                	mov    %esp,%ebp
+    3963:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+    3966:	80 3a 00             	cmpb   $0x0,(%edx)
+    3969:	74 15                	je     3980 <strlen+0x20>
+    396b:	31 c0                	xor    %eax,%eax
+    396d:	8d 76 00             	lea    0x0(%esi),%esi
+    3970:	83 c0 01             	add    $0x1,%eax
+    3973:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+    3977:	89 c1                	mov    %eax,%ecx
+    3979:	75 f5                	jne    3970 <strlen+0x10>
+    ;
+  return n;
+}
+    397b:	89 c8                	mov    %ecx,%eax
+    397d:	5d                   	pop    %ebp
+    397e:	c3                   	ret
+    397f:	90                   	nop
+  for(n = 0; s[n]; n++)
+    3980:	31 c9                	xor    %ecx,%ecx
+}
+    3982:	5d                   	pop    %ebp
+    3983:	89 c8                	mov    %ecx,%eax
+    3985:	c3                   	ret
+    3986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    398d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00003990 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+    3990:	55                   	push   %ebp
+    3991:	89 e5                	mov    %esp,%ebp
+    3993:	57                   	push   %edi
+    3994:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+    3997:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    399a:	8b 45 0c             	mov    0xc(%ebp),%eax
+    399d:	89 d7                	mov    %edx,%edi
+    399f:	fc                   	cld
+    39a0:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+    39a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+    39a5:	89 d0                	mov    %edx,%eax
+    39a7:	c9                   	leave
+    39a8:	c3                   	ret
+    39a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000039b0 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+    39b0:	55                   	push   %ebp
+    39b1:	89 e5                	mov    %esp,%ebp
+    39b3:	8b 45 08             	mov    0x8(%ebp),%eax
+    39b6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+    39ba:	0f b6 10             	movzbl (%eax),%edx
+    39bd:	84 d2                	test   %dl,%dl
+    39bf:	75 12                	jne    39d3 <strchr+0x23>
+    39c1:	eb 1d                	jmp    39e0 <strchr+0x30>
+    39c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    39c7:	90                   	nop
+    39c8:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+    39cc:	83 c0 01             	add    $0x1,%eax
+    39cf:	84 d2                	test   %dl,%dl
+    39d1:	74 0d                	je     39e0 <strchr+0x30>
+    if(*s == c)
+    39d3:	38 d1                	cmp    %dl,%cl
+    39d5:	75 f1                	jne    39c8 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+    39d7:	5d                   	pop    %ebp
+    39d8:	c3                   	ret
+    39d9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+    39e0:	31 c0                	xor    %eax,%eax
+}
+    39e2:	5d                   	pop    %ebp
+    39e3:	c3                   	ret
+    39e4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    39eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    39ef:	90                   	nop
+
+000039f0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+    39f0:	55                   	push   %ebp
+    39f1:	89 e5                	mov    %esp,%ebp
+    39f3:	57                   	push   %edi
+    39f4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+    39f5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+    39f8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+    39f9:	31 db                	xor    %ebx,%ebx
+{
+    39fb:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+    39fe:	eb 27                	jmp    3a27 <gets+0x37>
+    cc = read(0, &c, 1);
+    3a00:	83 ec 04             	sub    $0x4,%esp
+    3a03:	6a 01                	push   $0x1
+    3a05:	56                   	push   %esi
+    3a06:	6a 00                	push   $0x0
+    3a08:	e8 cf 02 00 00       	call   3cdc <read>
+    if(cc < 1)
+    3a0d:	83 c4 10             	add    $0x10,%esp
+    3a10:	85 c0                	test   %eax,%eax
+    3a12:	7e 1d                	jle    3a31 <gets+0x41>
+      break;
+    buf[i++] = c;
+    3a14:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+    3a18:	8b 55 08             	mov    0x8(%ebp),%edx
+    3a1b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+    3a1f:	3c 0a                	cmp    $0xa,%al
+    3a21:	74 10                	je     3a33 <gets+0x43>
+    3a23:	3c 0d                	cmp    $0xd,%al
+    3a25:	74 0c                	je     3a33 <gets+0x43>
+  for(i=0; i+1 < max; ){
+    3a27:	89 df                	mov    %ebx,%edi
+    3a29:	83 c3 01             	add    $0x1,%ebx
+    3a2c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+    3a2f:	7c cf                	jl     3a00 <gets+0x10>
+    3a31:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+    3a33:	8b 45 08             	mov    0x8(%ebp),%eax
+    3a36:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+    3a3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3a3d:	5b                   	pop    %ebx
+    3a3e:	5e                   	pop    %esi
+    3a3f:	5f                   	pop    %edi
+    3a40:	5d                   	pop    %ebp
+    3a41:	c3                   	ret
+    3a42:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a49:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003a50 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+    3a50:	55                   	push   %ebp
+    3a51:	89 e5                	mov    %esp,%ebp
+    3a53:	56                   	push   %esi
+    3a54:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+    3a55:	83 ec 08             	sub    $0x8,%esp
+    3a58:	6a 00                	push   $0x0
+    3a5a:	ff 75 08             	push   0x8(%ebp)
+    3a5d:	e8 a2 02 00 00       	call   3d04 <open>
+  if(fd < 0)
+    3a62:	83 c4 10             	add    $0x10,%esp
+    3a65:	85 c0                	test   %eax,%eax
+    3a67:	78 27                	js     3a90 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+    3a69:	83 ec 08             	sub    $0x8,%esp
+    3a6c:	ff 75 0c             	push   0xc(%ebp)
+    3a6f:	89 c3                	mov    %eax,%ebx
+    3a71:	50                   	push   %eax
+    3a72:	e8 a5 02 00 00       	call   3d1c <fstat>
+  close(fd);
+    3a77:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+    3a7a:	89 c6                	mov    %eax,%esi
+  close(fd);
+    3a7c:	e8 6b 02 00 00       	call   3cec <close>
+  return r;
+    3a81:	83 c4 10             	add    $0x10,%esp
+}
+    3a84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3a87:	89 f0                	mov    %esi,%eax
+    3a89:	5b                   	pop    %ebx
+    3a8a:	5e                   	pop    %esi
+    3a8b:	5d                   	pop    %ebp
+    3a8c:	c3                   	ret
+    3a8d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+    3a90:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    3a95:	eb ed                	jmp    3a84 <stat+0x34>
+    3a97:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3a9e:	66 90                	xchg   %ax,%ax
+
+00003aa0 <atoi>:
+
+int
+atoi(const char *s)
+{
+    3aa0:	55                   	push   %ebp
+    3aa1:	89 e5                	mov    %esp,%ebp
+    3aa3:	53                   	push   %ebx
+    3aa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+    3aa7:	0f be 02             	movsbl (%edx),%eax
+    3aaa:	8d 48 d0             	lea    -0x30(%eax),%ecx
+    3aad:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+    3ab0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+    3ab5:	77 1e                	ja     3ad5 <atoi+0x35>
+    3ab7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3abe:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+    3ac0:	83 c2 01             	add    $0x1,%edx
+    3ac3:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+    3ac6:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+    3aca:	0f be 02             	movsbl (%edx),%eax
+    3acd:	8d 58 d0             	lea    -0x30(%eax),%ebx
+    3ad0:	80 fb 09             	cmp    $0x9,%bl
+    3ad3:	76 eb                	jbe    3ac0 <atoi+0x20>
+  return n;
+}
+    3ad5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    3ad8:	89 c8                	mov    %ecx,%eax
+    3ada:	c9                   	leave
+    3adb:	c3                   	ret
+    3adc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003ae0 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+    3ae0:	55                   	push   %ebp
+    3ae1:	89 e5                	mov    %esp,%ebp
+    3ae3:	57                   	push   %edi
+    3ae4:	56                   	push   %esi
+    3ae5:	8b 45 10             	mov    0x10(%ebp),%eax
+    3ae8:	8b 55 08             	mov    0x8(%ebp),%edx
+    3aeb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+    3aee:	85 c0                	test   %eax,%eax
+    3af0:	7e 13                	jle    3b05 <memmove+0x25>
+    3af2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+    3af4:	89 d7                	mov    %edx,%edi
+    3af6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3afd:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+    3b00:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+    3b01:	39 f8                	cmp    %edi,%eax
+    3b03:	75 fb                	jne    3b00 <memmove+0x20>
+  return vdst;
+}
+    3b05:	5e                   	pop    %esi
+    3b06:	89 d0                	mov    %edx,%eax
+    3b08:	5f                   	pop    %edi
+    3b09:	5d                   	pop    %ebp
+    3b0a:	c3                   	ret
+    3b0b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3b0f:	90                   	nop
+
+00003b10 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+    3b10:	55                   	push   %ebp
+    3b11:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+    3b13:	8b 45 08             	mov    0x8(%ebp),%eax
+    3b16:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    3b1c:	5d                   	pop    %ebp
+    3b1d:	c3                   	ret
+    3b1e:	66 90                	xchg   %ax,%ax
+
+00003b20 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+    3b20:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+    3b21:	b9 01 00 00 00       	mov    $0x1,%ecx
+    3b26:	89 e5                	mov    %esp,%ebp
+    3b28:	8b 55 08             	mov    0x8(%ebp),%edx
+    3b2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3b2f:	90                   	nop
+    3b30:	89 c8                	mov    %ecx,%eax
+    3b32:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+    3b35:	85 c0                	test   %eax,%eax
+    3b37:	75 f7                	jne    3b30 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+    3b39:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+    3b3e:	5d                   	pop    %ebp
+    3b3f:	c3                   	ret
+
+00003b40 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+    3b40:	55                   	push   %ebp
+    3b41:	31 c0                	xor    %eax,%eax
+    3b43:	89 e5                	mov    %esp,%ebp
+    3b45:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+    3b48:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+    3b4d:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+    3b50:	5d                   	pop    %ebp
+    3b51:	c3                   	ret
+    3b52:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3b59:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00003b60 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+    3b60:	55                   	push   %ebp
+    3b61:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    3b63:	8b 45 08             	mov    0x8(%ebp),%eax
+    3b66:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    3b6c:	5d                   	pop    %ebp
+    3b6d:	c3                   	ret
+    3b6e:	66 90                	xchg   %ax,%ax
+
+00003b70 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+    3b70:	55                   	push   %ebp
+    3b71:	b8 01 00 00 00       	mov    $0x1,%eax
+    3b76:	89 e5                	mov    %esp,%ebp
+    3b78:	56                   	push   %esi
+    3b79:	53                   	push   %ebx
+    3b7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    3b7d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+    3b80:	85 c0                	test   %eax,%eax
+    3b82:	74 2d                	je     3bb1 <mutex_lock+0x41>
+    3b84:	b8 02 00 00 00       	mov    $0x2,%eax
+    3b89:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+    3b8c:	85 c0                	test   %eax,%eax
+    3b8e:	74 21                	je     3bb1 <mutex_lock+0x41>
+    3b90:	be 02 00 00 00       	mov    $0x2,%esi
+    3b95:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+    3b98:	83 ec 04             	sub    $0x4,%esp
+    3b9b:	6a 02                	push   $0x2
+    3b9d:	6a 00                	push   $0x0
+    3b9f:	53                   	push   %ebx
+    3ba0:	e8 37 02 00 00       	call   3ddc <futex>
+    3ba5:	89 f0                	mov    %esi,%eax
+    3ba7:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    3baa:	83 c4 10             	add    $0x10,%esp
+    3bad:	85 c0                	test   %eax,%eax
+    3baf:	75 e7                	jne    3b98 <mutex_lock+0x28>
+}
+    3bb1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    3bb4:	5b                   	pop    %ebx
+    3bb5:	5e                   	pop    %esi
+    3bb6:	5d                   	pop    %ebp
+    3bb7:	c3                   	ret
+    3bb8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3bbf:	90                   	nop
+
+00003bc0 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+    3bc0:	55                   	push   %ebp
+    3bc1:	31 c0                	xor    %eax,%eax
+    3bc3:	89 e5                	mov    %esp,%ebp
+    3bc5:	83 ec 08             	sub    $0x8,%esp
+    3bc8:	8b 55 08             	mov    0x8(%ebp),%edx
+    3bcb:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+    3bce:	83 f8 02             	cmp    $0x2,%eax
+    3bd1:	74 05                	je     3bd8 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+    3bd3:	c9                   	leave
+    3bd4:	c3                   	ret
+    3bd5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+    3bd8:	83 ec 04             	sub    $0x4,%esp
+    3bdb:	6a 01                	push   $0x1
+    3bdd:	6a 01                	push   $0x1
+    3bdf:	52                   	push   %edx
+    3be0:	e8 f7 01 00 00       	call   3ddc <futex>
+    3be5:	83 c4 10             	add    $0x10,%esp
+}
+    3be8:	c9                   	leave
+    3be9:	c3                   	ret
+    3bea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003bf0 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+    3bf0:	55                   	push   %ebp
+    3bf1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    3bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+    3bf6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    3bfc:	5d                   	pop    %ebp
+    3bfd:	c3                   	ret
+    3bfe:	66 90                	xchg   %ax,%ax
+
+00003c00 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+    3c00:	55                   	push   %ebp
+    3c01:	31 c0                	xor    %eax,%eax
+    3c03:	89 e5                	mov    %esp,%ebp
+    3c05:	57                   	push   %edi
+    3c06:	56                   	push   %esi
+    3c07:	53                   	push   %ebx
+    3c08:	83 ec 0c             	sub    $0xc,%esp
+    3c0b:	8b 75 08             	mov    0x8(%ebp),%esi
+    3c0e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+    3c11:	8b 3e                	mov    (%esi),%edi
+    3c13:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+    3c16:	83 f8 02             	cmp    $0x2,%eax
+    3c19:	74 4d                	je     3c68 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+    3c1b:	83 ec 04             	sub    $0x4,%esp
+    3c1e:	57                   	push   %edi
+    3c1f:	6a 00                	push   $0x0
+    3c21:	56                   	push   %esi
+    3c22:	e8 b5 01 00 00       	call   3ddc <futex>
+    3c27:	b8 02 00 00 00       	mov    $0x2,%eax
+    3c2c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+    3c2f:	83 c4 10             	add    $0x10,%esp
+    3c32:	85 c0                	test   %eax,%eax
+    3c34:	74 23                	je     3c59 <cond_wait+0x59>
+    3c36:	be 02 00 00 00       	mov    $0x2,%esi
+    3c3b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3c3f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+    3c40:	83 ec 04             	sub    $0x4,%esp
+    3c43:	6a 02                	push   $0x2
+    3c45:	6a 00                	push   $0x0
+    3c47:	53                   	push   %ebx
+    3c48:	e8 8f 01 00 00       	call   3ddc <futex>
+    3c4d:	89 f0                	mov    %esi,%eax
+    3c4f:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+    3c52:	83 c4 10             	add    $0x10,%esp
+    3c55:	85 c0                	test   %eax,%eax
+    3c57:	75 e7                	jne    3c40 <cond_wait+0x40>
+}
+    3c59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3c5c:	5b                   	pop    %ebx
+    3c5d:	5e                   	pop    %esi
+    3c5e:	5f                   	pop    %edi
+    3c5f:	5d                   	pop    %ebp
+    3c60:	c3                   	ret
+    3c61:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+    3c68:	83 ec 04             	sub    $0x4,%esp
+    3c6b:	6a 01                	push   $0x1
+    3c6d:	6a 01                	push   $0x1
+    3c6f:	53                   	push   %ebx
+    3c70:	e8 67 01 00 00       	call   3ddc <futex>
+    3c75:	83 c4 10             	add    $0x10,%esp
+    3c78:	eb a1                	jmp    3c1b <cond_wait+0x1b>
+    3c7a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00003c80 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+    3c80:	55                   	push   %ebp
+    3c81:	89 e5                	mov    %esp,%ebp
+    3c83:	83 ec 0c             	sub    $0xc,%esp
+    3c86:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    3c89:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+    3c8d:	6a 01                	push   $0x1
+    3c8f:	6a 01                	push   $0x1
+    3c91:	50                   	push   %eax
+    3c92:	e8 45 01 00 00       	call   3ddc <futex>
+}
+    3c97:	83 c4 10             	add    $0x10,%esp
+    3c9a:	c9                   	leave
+    3c9b:	c3                   	ret
+    3c9c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003ca0 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+    3ca0:	55                   	push   %ebp
+    3ca1:	89 e5                	mov    %esp,%ebp
+    3ca3:	83 ec 0c             	sub    $0xc,%esp
+    3ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+    3ca9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+    3cad:	6a ff                	push   $0xffffffff
+    3caf:	6a 01                	push   $0x1
+    3cb1:	50                   	push   %eax
+    3cb2:	e8 25 01 00 00       	call   3ddc <futex>
+}
+    3cb7:	83 c4 10             	add    $0x10,%esp
+    3cba:	c9                   	leave
+    3cbb:	c3                   	ret
+
+00003cbc <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+    3cbc:	b8 01 00 00 00       	mov    $0x1,%eax
+    3cc1:	cd 40                	int    $0x40
+    3cc3:	c3                   	ret
+
+00003cc4 <exit>:
+SYSCALL(exit)
+    3cc4:	b8 02 00 00 00       	mov    $0x2,%eax
+    3cc9:	cd 40                	int    $0x40
+    3ccb:	c3                   	ret
+
+00003ccc <wait>:
+SYSCALL(wait)
+    3ccc:	b8 03 00 00 00       	mov    $0x3,%eax
+    3cd1:	cd 40                	int    $0x40
+    3cd3:	c3                   	ret
+
+00003cd4 <pipe>:
+SYSCALL(pipe)
+    3cd4:	b8 04 00 00 00       	mov    $0x4,%eax
+    3cd9:	cd 40                	int    $0x40
+    3cdb:	c3                   	ret
+
+00003cdc <read>:
+SYSCALL(read)
+    3cdc:	b8 05 00 00 00       	mov    $0x5,%eax
+    3ce1:	cd 40                	int    $0x40
+    3ce3:	c3                   	ret
+
+00003ce4 <write>:
+SYSCALL(write)
+    3ce4:	b8 10 00 00 00       	mov    $0x10,%eax
+    3ce9:	cd 40                	int    $0x40
+    3ceb:	c3                   	ret
+
+00003cec <close>:
+SYSCALL(close)
+    3cec:	b8 15 00 00 00       	mov    $0x15,%eax
+    3cf1:	cd 40                	int    $0x40
+    3cf3:	c3                   	ret
+
+00003cf4 <kill>:
+SYSCALL(kill)
+    3cf4:	b8 06 00 00 00       	mov    $0x6,%eax
+    3cf9:	cd 40                	int    $0x40
+    3cfb:	c3                   	ret
+
+00003cfc <exec>:
+SYSCALL(exec)
+    3cfc:	b8 07 00 00 00       	mov    $0x7,%eax
+    3d01:	cd 40                	int    $0x40
+    3d03:	c3                   	ret
+
+00003d04 <open>:
+SYSCALL(open)
+    3d04:	b8 0f 00 00 00       	mov    $0xf,%eax
+    3d09:	cd 40                	int    $0x40
+    3d0b:	c3                   	ret
+
+00003d0c <mknod>:
+SYSCALL(mknod)
+    3d0c:	b8 11 00 00 00       	mov    $0x11,%eax
+    3d11:	cd 40                	int    $0x40
+    3d13:	c3                   	ret
+
+00003d14 <unlink>:
+SYSCALL(unlink)
+    3d14:	b8 12 00 00 00       	mov    $0x12,%eax
+    3d19:	cd 40                	int    $0x40
+    3d1b:	c3                   	ret
+
+00003d1c <fstat>:
+SYSCALL(fstat)
+    3d1c:	b8 08 00 00 00       	mov    $0x8,%eax
+    3d21:	cd 40                	int    $0x40
+    3d23:	c3                   	ret
+
+00003d24 <link>:
+SYSCALL(link)
+    3d24:	b8 13 00 00 00       	mov    $0x13,%eax
+    3d29:	cd 40                	int    $0x40
+    3d2b:	c3                   	ret
+
+00003d2c <mkdir>:
+SYSCALL(mkdir)
+    3d2c:	b8 14 00 00 00       	mov    $0x14,%eax
+    3d31:	cd 40                	int    $0x40
+    3d33:	c3                   	ret
+
+00003d34 <chdir>:
+SYSCALL(chdir)
+    3d34:	b8 09 00 00 00       	mov    $0x9,%eax
+    3d39:	cd 40                	int    $0x40
+    3d3b:	c3                   	ret
+
+00003d3c <dup>:
+SYSCALL(dup)
+    3d3c:	b8 0a 00 00 00       	mov    $0xa,%eax
+    3d41:	cd 40                	int    $0x40
+    3d43:	c3                   	ret
+
+00003d44 <getpid>:
+SYSCALL(getpid)
+    3d44:	b8 0b 00 00 00       	mov    $0xb,%eax
+    3d49:	cd 40                	int    $0x40
+    3d4b:	c3                   	ret
+
+00003d4c <sbrk>:
+SYSCALL(sbrk)
+    3d4c:	b8 0c 00 00 00       	mov    $0xc,%eax
+    3d51:	cd 40                	int    $0x40
+    3d53:	c3                   	ret
+
+00003d54 <sleep>:
+SYSCALL(sleep)
+    3d54:	b8 0d 00 00 00       	mov    $0xd,%eax
+    3d59:	cd 40                	int    $0x40
+    3d5b:	c3                   	ret
+
+00003d5c <uptime>:
+SYSCALL(uptime)
+    3d5c:	b8 0e 00 00 00       	mov    $0xe,%eax
+    3d61:	cd 40                	int    $0x40
+    3d63:	c3                   	ret
+
+00003d64 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+    3d64:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    3d69:	cd 40                	int    $0x40
+    3d6b:	c3                   	ret
+
+00003d6c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+    3d6c:	b8 19 00 00 00       	mov    $0x19,%eax
+    3d71:	cd 40                	int    $0x40
+    3d73:	c3                   	ret
+
+00003d74 <wmap>:
+SYSCALL(wmap)
+    3d74:	b8 16 00 00 00       	mov    $0x16,%eax
+    3d79:	cd 40                	int    $0x40
+    3d7b:	c3                   	ret
+
+00003d7c <wunmap>:
+SYSCALL(wunmap)
+    3d7c:	b8 17 00 00 00       	mov    $0x17,%eax
+    3d81:	cd 40                	int    $0x40
+    3d83:	c3                   	ret
+
+00003d84 <wremap>:
+SYSCALL(wremap)
+    3d84:	b8 18 00 00 00       	mov    $0x18,%eax
+    3d89:	cd 40                	int    $0x40
+    3d8b:	c3                   	ret
+
+00003d8c <wmlock>:
+SYSCALL(wmlock)
+    3d8c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    3d91:	cd 40                	int    $0x40
+    3d93:	c3                   	ret
+
+00003d94 <wmunlock>:
+SYSCALL(wmunlock)
+    3d94:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    3d99:	cd 40                	int    $0x40
+    3d9b:	c3                   	ret
+
+00003d9c <wmapoff>:
+SYSCALL(wmapoff)
+    3d9c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    3da1:	cd 40                	int    $0x40
+    3da3:	c3                   	ret
+
+00003da4 <wunmaprange>:
+SYSCALL(wunmaprange)
+    3da4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    3da9:	cd 40                	int    $0x40
+    3dab:	c3                   	ret
+
+00003dac <setpriority>:
+SYSCALL(setpriority)
+    3dac:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    3db1:	cd 40                	int    $0x40
+    3db3:	c3                   	ret
+
+00003db4 <getschedinfo>:
+SYSCALL(getschedinfo)
+    3db4:	b8 20 00 00 00       	mov    $0x20,%eax
+    3db9:	cd 40                	int    $0x40
+    3dbb:	c3                   	ret
+
+00003dbc <settickets>:
+SYSCALL(settickets)
+    3dbc:	b8 21 00 00 00       	mov    $0x21,%eax
+    3dc1:	cd 40                	int    $0x40
+    3dc3:	c3                   	ret
+
+00003dc4 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+    3dc4:	b8 22 00 00 00       	mov    $0x22,%eax
+    3dc9:	cd 40                	int    $0x40
+    3dcb:	c3                   	ret
+
+00003dcc <clone>:
+SYSCALL(clone)
+    3dcc:	b8 23 00 00 00       	mov    $0x23,%eax
+    3dd1:	cd 40                	int    $0x40
+    3dd3:	c3                   	ret
+
+00003dd4 <join>:
+SYSCALL(join)
+    3dd4:	b8 24 00 00 00       	mov    $0x24,%eax
+    3dd9:	cd 40                	int    $0x40
+    3ddb:	c3                   	ret
+
+00003ddc <futex>:
+SYSCALL(futex)
+    3ddc:	b8 25 00 00 00       	mov    $0x25,%eax
+    3de1:	cd 40                	int    $0x40
+    3de3:	c3                   	ret
+
+00003de4 <setaffinity>:
+SYSCALL(setaffinity)
+    3de4:	b8 26 00 00 00       	mov    $0x26,%eax
+    3de9:	cd 40                	int    $0x40
+    3deb:	c3                   	ret
+
+00003dec <getaffinity>:
+SYSCALL(getaffinity)
+    3dec:	b8 27 00 00 00       	mov    $0x27,%eax
+    3df1:	cd 40                	int    $0x40
+    3df3:	c3                   	ret
+
+00003df4 <bcstat>:
+SYSCALL(bcstat)
+    3df4:	b8 29 00 00 00       	mov    $0x29,%eax
+    3df9:	cd 40                	int    $0x40
+    3dfb:	c3                   	ret
+
+00003dfc <dropcache>:
+SYSCALL(dropcache)
+    3dfc:	b8 2a 00 00 00       	mov    $0x2a,%eax
+    3e01:	cd 40                	int    $0x40
+    3e03:	c3                   	ret
+
+00003e04 <setiosched>:
+SYSCALL(setiosched)
+    3e04:	b8 2b 00 00 00       	mov    $0x2b,%eax
+    3e09:	cd 40                	int    $0x40
+    3e0b:	c3                   	ret
+
+00003e0c <iostat>:
+SYSCALL(iostat)
+    3e0c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+    3e11:	cd 40                	int    $0x40
+    3e13:	c3                   	ret
+
+00003e14 <fsync>:
+SYSCALL(fsync)
+    3e14:	b8 2d 00 00 00       	mov    $0x2d,%eax
+    3e19:	cd 40                	int    $0x40
+    3e1b:	c3                   	ret
+
+00003e1c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+    3e1c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+    3e1d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+    3e22:	cd 40                	int    $0x40
+    3e24:	ff e1                	jmp    *%ecx
+    3e26:	66 90                	xchg   %ax,%ax
+    3e28:	66 90                	xchg   %ax,%ax
+    3e2a:	66 90                	xchg   %ax,%ax
+    3e2c:	66 90                	xchg   %ax,%ax
+    3e2e:	66 90                	xchg   %ax,%ax
+
+00003e30 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    3e30:	55                   	push   %ebp
+    3e31:	89 e5                	mov    %esp,%ebp
+    3e33:	57                   	push   %edi
+    3e34:	56                   	push   %esi
+    3e35:	53                   	push   %ebx
+    3e36:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+    3e38:	89 d1                	mov    %edx,%ecx
+{
+    3e3a:	83 ec 3c             	sub    $0x3c,%esp
+    3e3d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+    3e40:	85 d2                	test   %edx,%edx
+    3e42:	0f 89 80 00 00 00    	jns    3ec8 <printint+0x98>
+    3e48:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+    3e4c:	74 7a                	je     3ec8 <printint+0x98>
+    x = -xx;
+    3e4e:	f7 d9                	neg    %ecx
+    neg = 1;
+    3e50:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+    3e55:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+    3e58:	31 f6                	xor    %esi,%esi
+    3e5a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+    3e60:	89 c8                	mov    %ecx,%eax
+    3e62:	31 d2                	xor    %edx,%edx
+    3e64:	89 f7                	mov    %esi,%edi
+    3e66:	f7 f3                	div    %ebx
+    3e68:	8d 76 01             	lea    0x1(%esi),%esi
+    3e6b:	0f b6 92 40 5d 00 00 	movzbl 0x5d40(%edx),%edx
+    3e72:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+    3e76:	89 ca                	mov    %ecx,%edx
+    3e78:	89 c1                	mov    %eax,%ecx
+    3e7a:	39 da                	cmp    %ebx,%edx
+    3e7c:	73 e2                	jae    3e60 <printint+0x30>
+  if(neg)
+    3e7e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+    3e81:	85 c0                	test   %eax,%eax
+    3e83:	74 07                	je     3e8c <printint+0x5c>
+    buf[i++] = '-';
+    3e85:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+    3e8a:	89 f7                	mov    %esi,%edi
+    3e8c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    3e8f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+    3e92:	01 df                	add    %ebx,%edi
+    3e94:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+    3e98:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+    3e9b:	83 ec 04             	sub    $0x4,%esp
+    3e9e:	88 45 d7             	mov    %al,-0x29(%ebp)
+    3ea1:	8d 45 d7             	lea    -0x29(%ebp),%eax
+    3ea4:	6a 01                	push   $0x1
+    3ea6:	50                   	push   %eax
+    3ea7:	56                   	push   %esi
+    3ea8:	e8 37 fe ff ff       	call   3ce4 <write>
+  while(--i >= 0)
+    3ead:	89 f8                	mov    %edi,%eax
+    3eaf:	83 c4 10             	add    $0x10,%esp
+    3eb2:	83 ef 01             	sub    $0x1,%edi
+    3eb5:	39 d8                	cmp    %ebx,%eax
+    3eb7:	75 df                	jne    3e98 <printint+0x68>
+}
+    3eb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3ebc:	5b                   	pop    %ebx
+    3ebd:	5e                   	pop    %esi
+    3ebe:	5f                   	pop    %edi
+    3ebf:	5d                   	pop    %ebp
+    3ec0:	c3                   	ret
+    3ec1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+    3ec8:	31 c0                	xor    %eax,%eax
+    3eca:	eb 89                	jmp    3e55 <printint+0x25>
+    3ecc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00003ed0 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+    3ed0:	55                   	push   %ebp
+    3ed1:	89 e5                	mov    %esp,%ebp
+    3ed3:	57                   	push   %edi
+    3ed4:	56                   	push   %esi
+    3ed5:	53                   	push   %ebx
+    3ed6:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+    3ed9:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+    3edc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+    3edf:	0f b6 1e             	movzbl (%esi),%ebx
+    3ee2:	83 c6 01             	add    $0x1,%esi
+    3ee5:	84 db                	test   %bl,%bl
+    3ee7:	74 67                	je     3f50 <printf+0x80>
+    3ee9:	8d 4d 10             	lea    0x10(%ebp),%ecx
+    3eec:	31 d2                	xor    %edx,%edx
+    3eee:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+    3ef1:	eb 34                	jmp    3f27 <printf+0x57>
+    3ef3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3ef7:	90                   	nop
+    3ef8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+    3efb:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+    3f00:	83 f8 25             	cmp    $0x25,%eax
+    3f03:	74 18                	je     3f1d <printf+0x4d>
+  write(fd, &c, 1);
+    3f05:	83 ec 04             	sub    $0x4,%esp
+    3f08:	8d 45 e7             	lea    -0x19(%ebp),%eax
+    3f0b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3f0e:	6a 01                	push   $0x1
+    3f10:	50                   	push   %eax
+    3f11:	57                   	push   %edi
+    3f12:	e8 cd fd ff ff       	call   3ce4 <write>
+    3f17:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+    3f1a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+    3f1d:	0f b6 1e             	movzbl (%esi),%ebx
+    3f20:	83 c6 01             	add    $0x1,%esi
+    3f23:	84 db                	test   %bl,%bl
+    3f25:	74 29                	je     3f50 <printf+0x80>
+    c = fmt[i] & 0xff;
+    3f27:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+    3f2a:	85 d2                	test   %edx,%edx
+    3f2c:	74 ca                	je     3ef8 <printf+0x28>
+      }
+    } else if(state == '%'){
+    3f2e:	83 fa 25             	cmp    $0x25,%edx
+    3f31:	75 ea                	jne    3f1d <printf+0x4d>
+      if(c == 'd'){
+    3f33:	83 f8 25             	cmp    $0x25,%eax
+    3f36:	0f 84 24 01 00 00    	je     4060 <printf+0x190>
+    3f3c:	83 e8 63             	sub    $0x63,%eax
+    3f3f:	83 f8 15             	cmp    $0x15,%eax
+    3f42:	77 1c                	ja     3f60 <printf+0x90>
+    3f44:	ff 24 85 e8 5c 00 00 	jmp    *0x5ce8(,%eax,4)
+    3f4b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    3f4f:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+    3f50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    3f53:	5b                   	pop    %ebx
+    3f54:	5e                   	pop    %esi
+    3f55:	5f                   	pop    %edi
+    3f56:	5d                   	pop    %ebp
+    3f57:	c3                   	ret
+    3f58:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3f5f:	90                   	nop
+  write(fd, &c, 1);
+    3f60:	83 ec 04             	sub    $0x4,%esp
+    3f63:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3f66:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+    3f6a:	6a 01                	push   $0x1
+    3f6c:	52                   	push   %edx
+    3f6d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    3f70:	57                   	push   %edi
+    3f71:	e8 6e fd ff ff       	call   3ce4 <write>
+    3f76:	83 c4 0c             	add    $0xc,%esp
+    3f79:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    3f7c:	6a 01                	push   $0x1
+    3f7e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+    3f81:	52                   	push   %edx
+    3f82:	57                   	push   %edi
+    3f83:	e8 5c fd ff ff       	call   3ce4 <write>
+        putc(fd, c);
+    3f88:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3f8b:	31 d2                	xor    %edx,%edx
+    3f8d:	eb 8e                	jmp    3f1d <printf+0x4d>
+    3f8f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+    3f90:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    3f93:	83 ec 0c             	sub    $0xc,%esp
+    3f96:	b9 10 00 00 00       	mov    $0x10,%ecx
+    3f9b:	8b 13                	mov    (%ebx),%edx
+    3f9d:	6a 00                	push   $0x0
+    3f9f:	89 f8                	mov    %edi,%eax
+        ap++;
+    3fa1:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+    3fa4:	e8 87 fe ff ff       	call   3e30 <printint>
+        ap++;
+    3fa9:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    3fac:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    3faf:	31 d2                	xor    %edx,%edx
+    3fb1:	e9 67 ff ff ff       	jmp    3f1d <printf+0x4d>
+    3fb6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    3fbd:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+    3fc0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3fc3:	8b 18                	mov    (%eax),%ebx
+        ap++;
+    3fc5:	83 c0 04             	add    $0x4,%eax
+    3fc8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+    3fcb:	85 db                	test   %ebx,%ebx
+    3fcd:	0f 84 9d 00 00 00    	je     4070 <printf+0x1a0>
+        while(*s != 0){
+    3fd3:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+    3fd6:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+    3fd8:	84 c0                	test   %al,%al
+    3fda:	0f 84 3d ff ff ff    	je     3f1d <printf+0x4d>
+    3fe0:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    3fe3:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+    3fe6:	89 de                	mov    %ebx,%esi
+    3fe8:	89 d3                	mov    %edx,%ebx
+    3fea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+    3ff0:	83 ec 04             	sub    $0x4,%esp
+    3ff3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+    3ff6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+    3ff9:	6a 01                	push   $0x1
+    3ffb:	53                   	push   %ebx
+    3ffc:	57                   	push   %edi
+    3ffd:	e8 e2 fc ff ff       	call   3ce4 <write>
+        while(*s != 0){
+    4002:	0f b6 06             	movzbl (%esi),%eax
+    4005:	83 c4 10             	add    $0x10,%esp
+    4008:	84 c0                	test   %al,%al
+    400a:	75 e4                	jne    3ff0 <printf+0x120>
+      state = 0;
+    400c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    400f:	31 d2                	xor    %edx,%edx
+    4011:	e9 07 ff ff ff       	jmp    3f1d <printf+0x4d>
+    4016:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    401d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+    4020:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+    4023:	83 ec 0c             	sub    $0xc,%esp
+    4026:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    402b:	8b 13                	mov    (%ebx),%edx
+    402d:	6a 01                	push   $0x1
+    402f:	e9 6b ff ff ff       	jmp    3f9f <printf+0xcf>
+    4034:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+    4038:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+    403b:	83 ec 04             	sub    $0x4,%esp
+    403e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+    4041:	8b 03                	mov    (%ebx),%eax
+        ap++;
+    4043:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+    4046:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+    4049:	6a 01                	push   $0x1
+    404b:	52                   	push   %edx
+    404c:	57                   	push   %edi
+    404d:	e8 92 fc ff ff       	call   3ce4 <write>
+        ap++;
+    4052:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    4055:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+    4058:	31 d2                	xor    %edx,%edx
+    405a:	e9 be fe ff ff       	jmp    3f1d <printf+0x4d>
+    405f:	90                   	nop
+  write(fd, &c, 1);
+    4060:	83 ec 04             	sub    $0x4,%esp
+    4063:	88 5d e7             	mov    %bl,-0x19(%ebp)
+    4066:	8d 55 e7             	lea    -0x19(%ebp),%edx
+    4069:	6a 01                	push   $0x1
+    406b:	e9 11 ff ff ff       	jmp    3f81 <printf+0xb1>
+    4070:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+    4075:	bb df 5c 00 00       	mov    $0x5cdf,%ebx
+    407a:	e9 61 ff ff ff       	jmp    3fe0 <printf+0x110>
+    407f:	90                   	nop
+
+00004080 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    4080:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4081:	a1 80 b0 00 00       	mov    0xb080,%eax
+{
+    4086:	89 e5                	mov    %esp,%ebp
+    4088:	57                   	push   %edi
+    4089:	56                   	push   %esi
+    408a:	53                   	push   %ebx
+    408b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+    408e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    4091:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4098:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    409a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    409c:	39 ca                	cmp    %ecx,%edx
+    409e:	73 30                	jae    40d0 <free+0x50>
+    40a0:	39 c1                	cmp    %eax,%ecx
+    40a2:	72 04                	jb     40a8 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    40a4:	39 c2                	cmp    %eax,%edx
+    40a6:	72 f0                	jb     4098 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    40a8:	8b 73 fc             	mov    -0x4(%ebx),%esi
+    40ab:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+    40ae:	39 f8                	cmp    %edi,%eax
+    40b0:	74 2e                	je     40e0 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+    40b2:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+    40b5:	8b 42 04             	mov    0x4(%edx),%eax
+    40b8:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    40bb:	39 f1                	cmp    %esi,%ecx
+    40bd:	74 38                	je     40f7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+    40bf:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+    40c1:	5b                   	pop    %ebx
+  freep = p;
+    40c2:	89 15 80 b0 00 00    	mov    %edx,0xb080
+}
+    40c8:	5e                   	pop    %esi
+    40c9:	5f                   	pop    %edi
+    40ca:	5d                   	pop    %ebp
+    40cb:	c3                   	ret
+    40cc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    40d0:	39 c1                	cmp    %eax,%ecx
+    40d2:	72 d0                	jb     40a4 <free+0x24>
+    40d4:	eb c2                	jmp    4098 <free+0x18>
+    40d6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    40dd:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+    40e0:	03 70 04             	add    0x4(%eax),%esi
+    40e3:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    40e6:	8b 02                	mov    (%edx),%eax
+    40e8:	8b 00                	mov    (%eax),%eax
+    40ea:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+    40ed:	8b 42 04             	mov    0x4(%edx),%eax
+    40f0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+    40f3:	39 f1                	cmp    %esi,%ecx
+    40f5:	75 c8                	jne    40bf <free+0x3f>
+    p->s.size += bp->s.size;
+    40f7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+    40fa:	89 15 80 b0 00 00    	mov    %edx,0xb080
+    p->s.size += bp->s.size;
+    4100:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+    4103:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+    4106:	89 0a                	mov    %ecx,(%edx)
+}
+    4108:	5b                   	pop    %ebx
+    4109:	5e                   	pop    %esi
+    410a:	5f                   	pop    %edi
+    410b:	5d                   	pop    %ebp
+    410c:	c3                   	ret
+    410d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00004110 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+    4110:	55                   	push   %ebp
+    4111:	89 e5                	mov    %esp,%ebp
+    4113:	57                   	push   %edi
+    4114:	56                   	push   %esi
+    4115:	53                   	push   %ebx
+    4116:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4119:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+    411c:	8b 15 80 b0 00 00    	mov    0xb080,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    4122:	8d 78 07             	lea    0x7(%eax),%edi
+    4125:	c1 ef 03             	shr    $0x3,%edi
+    4128:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+    412b:	85 d2                	test   %edx,%edx
+    412d:	0f 84 8d 00 00 00    	je     41c0 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4133:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4135:	8b 48 04             	mov    0x4(%eax),%ecx
+    4138:	39 f9                	cmp    %edi,%ecx
+    413a:	73 64                	jae    41a0 <malloc+0x90>
+  if(nu < 4096)
+    413c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+    4141:	39 df                	cmp    %ebx,%edi
+    4143:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+    4146:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+    414d:	eb 0a                	jmp    4159 <malloc+0x49>
+    414f:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    4150:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+    4152:	8b 48 04             	mov    0x4(%eax),%ecx
+    4155:	39 f9                	cmp    %edi,%ecx
+    4157:	73 47                	jae    41a0 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+    4159:	89 c2                	mov    %eax,%edx
+    415b:	39 05 80 b0 00 00    	cmp    %eax,0xb080
+    4161:	75 ed                	jne    4150 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+    4163:	83 ec 0c             	sub    $0xc,%esp
+    4166:	56                   	push   %esi
+    4167:	e8 e0 fb ff ff       	call   3d4c <sbrk>
+  if(p == (char*)-1)
+    416c:	83 c4 10             	add    $0x10,%esp
+    416f:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4172:	74 1c                	je     4190 <malloc+0x80>
+  hp->s.size = nu;
+    4174:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+    4177:	83 ec 0c             	sub    $0xc,%esp
+    417a:	83 c0 08             	add    $0x8,%eax
+    417d:	50                   	push   %eax
+    417e:	e8 fd fe ff ff       	call   4080 <free>
+  return freep;
+    4183:	8b 15 80 b0 00 00    	mov    0xb080,%edx
+      if((p = morecore(nunits)) == 0)
+    4189:	83 c4 10             	add    $0x10,%esp
+    418c:	85 d2                	test   %edx,%edx
+    418e:	75 c0                	jne    4150 <malloc+0x40>
+        return 0;
+  }
+}
+    4190:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+    4193:	31 c0                	xor    %eax,%eax
+}
+    4195:	5b                   	pop    %ebx
+    4196:	5e                   	pop    %esi
+    4197:	5f                   	pop    %edi
+    4198:	5d                   	pop    %ebp
+    4199:	c3                   	ret
+    419a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+    41a0:	39 cf                	cmp    %ecx,%edi
+    41a2:	74 4c                	je     41f0 <malloc+0xe0>
+        p->s.size -= nunits;
+    41a4:	29 f9                	sub    %edi,%ecx
+    41a6:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+    41a9:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+    41ac:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+    41af:	89 15 80 b0 00 00    	mov    %edx,0xb080
+}
+    41b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+    41b8:	83 c0 08             	add    $0x8,%eax
+}
+    41bb:	5b                   	pop    %ebx
+    41bc:	5e                   	pop    %esi
+    41bd:	5f                   	pop    %edi
+    41be:	5d                   	pop    %ebp
+    41bf:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+    41c0:	c7 05 80 b0 00 00 84 	movl   $0xb084,0xb080
+    41c7:	b0 00 00 
+    base.s.size = 0;
+    41ca:	b8 84 b0 00 00       	mov    $0xb084,%eax
+    base.s.ptr = freep = prevp = &base;
+    41cf:	c7 05 84 b0 00 00 84 	movl   $0xb084,0xb084
+    41d6:	b0 00 00 
+    base.s.size = 0;
+    41d9:	c7 05 88 b0 00 00 00 	movl   $0x0,0xb088
+    41e0:	00 00 00 
+    if(p->s.size >= nunits){
+    41e3:	e9 54 ff ff ff       	jmp    413c <malloc+0x2c>
+    41e8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    41ef:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+    41f0:	8b 08                	mov    (%eax),%ecx
+    41f2:	89 0a                	mov    %ecx,(%edx)
+    41f4:	eb b9                	jmp    41af <malloc+0x9f>
+    41f6:	66 90                	xchg   %ax,%ax
+    41f8:	66 90                	xchg   %ax,%ax
+    41fa:	66 90                	xchg   %ax,%ax
+    41fc:	66 90                	xchg   %ax,%ax
+    41fe:	66 90                	xchg   %ax,%ax
+
+00004200 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+    4200:	55                   	push   %ebp
+    4201:	89 e5                	mov    %esp,%ebp
+    4203:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+    4206:	8b 45 08             	mov    0x8(%ebp),%eax
+    4209:	c1 e0 04             	shl    $0x4,%eax
+    420c:	ff b0 cc b0 00 00    	push   0xb0cc(%eax)
+    4212:	05 c0 b0 00 00       	add    $0xb0c0,%eax
+    4217:	ff 50 08             	call   *0x8(%eax)
+  exit();
+    421a:	e8 a5 fa ff ff       	call   3cc4 <exit>
+    421f:	90                   	nop
+
+00004220 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    4220:	55                   	push   %ebp
+    4221:	89 e5                	mov    %esp,%ebp
+    4223:	57                   	push   %edi
+    4224:	56                   	push   %esi
+    4225:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+    4226:	31 db                	xor    %ebx,%ebx
+{
+    4228:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+    422b:	68 a0 b0 00 00       	push   $0xb0a0
+    4230:	e8 eb f8 ff ff       	call   3b20 <lock_acquire>
+    4235:	83 c4 10             	add    $0x10,%esp
+    4238:	eb 12                	jmp    424c <thread_create+0x2c>
+    423a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+    4240:	83 c3 01             	add    $0x1,%ebx
+    4243:	83 fb 40             	cmp    $0x40,%ebx
+    4246:	0f 84 c4 00 00 00    	je     4310 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+    424c:	89 de                	mov    %ebx,%esi
+    424e:	c1 e6 04             	shl    $0x4,%esi
+    4251:	8b 96 c0 b0 00 00    	mov    0xb0c0(%esi),%edx
+    4257:	85 d2                	test   %edx,%edx
+    4259:	75 e5                	jne    4240 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+    425b:	83 ec 0c             	sub    $0xc,%esp
+    425e:	68 00 20 00 00       	push   $0x2000
+    4263:	e8 a8 fe ff ff       	call   4110 <malloc>
+    4268:	83 c4 10             	add    $0x10,%esp
+    426b:	85 c0                	test   %eax,%eax
+    426d:	0f 84 9d 00 00 00    	je     4310 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+    4273:	89 86 c4 b0 00 00    	mov    %eax,0xb0c4(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+    4279:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+    427e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+    4281:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    4286:	89 86 c0 b0 00 00    	mov    %eax,0xb0c0(%esi)
+  threads[i].fn = fn;
+    428c:	8b 45 08             	mov    0x8(%ebp),%eax
+    428f:	89 86 c8 b0 00 00    	mov    %eax,0xb0c8(%esi)
+  threads[i].arg = arg;
+    4295:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4298:	89 86 cc b0 00 00    	mov    %eax,0xb0cc(%esi)
+  lock_release(&threadslock);
+    429e:	68 a0 b0 00 00       	push   $0xb0a0
+    42a3:	e8 98 f8 ff ff       	call   3b40 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+    42a8:	83 c4 0c             	add    $0xc,%esp
+    42ab:	ff b6 c0 b0 00 00    	push   0xb0c0(%esi)
+    42b1:	53                   	push   %ebx
+    42b2:	68 00 42 00 00       	push   $0x4200
+    42b7:	e8 10 fb ff ff       	call   3dcc <clone>
+    42bc:	83 c4 10             	add    $0x10,%esp
+    42bf:	85 c0                	test   %eax,%eax
+    42c1:	78 0d                	js     42d0 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+    42c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    42c6:	5b                   	pop    %ebx
+    42c7:	5e                   	pop    %esi
+    42c8:	5f                   	pop    %edi
+    42c9:	5d                   	pop    %ebp
+    42ca:	c3                   	ret
+    42cb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    42cf:	90                   	nop
+    lock_acquire(&threadslock);
+    42d0:	83 ec 0c             	sub    $0xc,%esp
+    42d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    42d6:	68 a0 b0 00 00       	push   $0xb0a0
+    42db:	e8 40 f8 ff ff       	call   3b20 <lock_acquire>
+    free(threads[i].block);
+    42e0:	58                   	pop    %eax
+    42e1:	ff b6 c4 b0 00 00    	push   0xb0c4(%esi)
+    42e7:	e8 94 fd ff ff       	call   4080 <free>
+    threads[i].stack = 0;
+    42ec:	c7 86 c0 b0 00 00 00 	movl   $0x0,0xb0c0(%esi)
+    42f3:	00 00 00 
+    lock_release(&threadslock);
+    42f6:	c7 04 24 a0 b0 00 00 	movl   $0xb0a0,(%esp)
+    42fd:	e8 3e f8 ff ff       	call   3b40 <lock_release>
+    4302:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4305:	83 c4 10             	add    $0x10,%esp
+}
+    4308:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    430b:	5b                   	pop    %ebx
+    430c:	5e                   	pop    %esi
+    430d:	5f                   	pop    %edi
+    430e:	5d                   	pop    %ebp
+    430f:	c3                   	ret
+    lock_release(&threadslock);
+    4310:	83 ec 0c             	sub    $0xc,%esp
+    4313:	68 a0 b0 00 00       	push   $0xb0a0
+    4318:	e8 23 f8 ff ff       	call   3b40 <lock_release>
+    return -1;
+    431d:	83 c4 10             	add    $0x10,%esp
+    4320:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    4325:	eb 9c                	jmp    42c3 <thread_create+0xa3>
+    4327:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    432e:	66 90                	xchg   %ax,%ax
+
+00004330 <thread_join>:
+
+int
+thread_join(void)
+{
+    4330:	55                   	push   %ebp
+    4331:	89 e5                	mov    %esp,%ebp
+    4333:	56                   	push   %esi
+    4334:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+    4335:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+    4338:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+    433b:	50                   	push   %eax
+    433c:	e8 93 fa ff ff       	call   3dd4 <join>
+    4341:	83 c4 10             	add    $0x10,%esp
+    4344:	85 c0                	test   %eax,%eax
+    4346:	78 69                	js     43b1 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+    4348:	83 ec 0c             	sub    $0xc,%esp
+    434b:	89 c6                	mov    %eax,%esi
+    434d:	68 a0 b0 00 00       	push   $0xb0a0
+    4352:	e8 c9 f7 ff ff       	call   3b20 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+    4357:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    435a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+    435d:	31 c0                	xor    %eax,%eax
+    435f:	eb 0f                	jmp    4370 <thread_join+0x40>
+    4361:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    4368:	83 c0 01             	add    $0x1,%eax
+    436b:	83 f8 40             	cmp    $0x40,%eax
+    436e:	74 28                	je     4398 <thread_join+0x68>
+    if(threads[i].stack == stack){
+    4370:	89 c3                	mov    %eax,%ebx
+    4372:	c1 e3 04             	shl    $0x4,%ebx
+    4375:	39 93 c0 b0 00 00    	cmp    %edx,0xb0c0(%ebx)
+    437b:	75 eb                	jne    4368 <thread_join+0x38>
+      free(threads[i].block);
+    437d:	83 ec 0c             	sub    $0xc,%esp
+    4380:	ff b3 c4 b0 00 00    	push   0xb0c4(%ebx)
+    4386:	e8 f5 fc ff ff       	call   4080 <free>
+      threads[i].stack = 0;
+      break;
+    438b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+    438e:	c7 83 c0 b0 00 00 00 	movl   $0x0,0xb0c0(%ebx)
+    4395:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+    4398:	83 ec 0c             	sub    $0xc,%esp
+    439b:	68 a0 b0 00 00       	push   $0xb0a0
+    43a0:	e8 9b f7 ff ff       	call   3b40 <lock_release>
+  return pid;
+    43a5:	83 c4 10             	add    $0x10,%esp
+}
+    43a8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+    43ab:	89 f0                	mov    %esi,%eax
+    43ad:	5b                   	pop    %ebx
+    43ae:	5e                   	pop    %esi
+    43af:	5d                   	pop    %ebp
+    43b0:	c3                   	ret
+    return -1;
+    43b1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+    43b6:	eb f0                	jmp    43a8 <thread_join+0x78>
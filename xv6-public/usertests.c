@@ -184,6 +184,9 @@ writetest(void)
   printf(stdout, "small file test ok\n");
 }
 
+// Blocks in the big file: enough to need a doubly-indirect block.
+#define BIGBLOCKS (NDIRECT + NINDIRECT + NINDIRECT)
+
 void
 writetest1(void)
 {
@@ -197,9 +200,9 @@ writetest1(void)
     exit();
   }
 
-  for(i = 0; i < MAXFILE; i++){
+  for(i = 0; i < BIGBLOCKS; i++){
     ((int*)buf)[0] = i;
-    if(write(fd, buf, 512) != 512){
+    if(write(fd, buf, BSIZE) != BSIZE){
       printf(stdout, "error: write big file failed\n", i);
       exit();
     }
@@ -215,14 +218,14 @@ writetest1(void)
 
   n = 0;
   for(;;){
-    i = read(fd, buf, 512);
+    i = read(fd, buf, BSIZE);
     if(i == 0){
-      if(n == MAXFILE - 1){
+      if(n == BIGBLOCKS - 1){
         printf(stdout, "read only %d blocks from big", n);
         exit();
       }
       break;
-    } else if(i != 512){
+    } else if(i != BSIZE){
       printf(stdout, "read failed %d\n", i);
       exit();
     }
@@ -575,6 +578,8 @@ fourfiles(void)
     }
     unlink(fname);
   }
+  for(i = 2; i < 4; i++)
+    unlink(names[i]);
 
   printf(1, "fourfiles ok\n");
 }
@@ -1383,7 +1388,7 @@ forktest(void)
 
   printf(1, "fork test\n");
 
-  for(n=0; n<1000; n++){
+  for(n=0; n<5000; n++){
     pid = fork();
     if(pid < 0)
       break;
@@ -1391,8 +1396,8 @@ forktest(void)
       exit();
   }
 
-  if(n == 1000){
-    printf(1, "fork claimed to work 1000 times!\n");
+  if(n == 5000){
+    printf(1, "fork claimed to work 5000 times!\n");
     exit();
   }
 
@@ -1589,6 +1594,46 @@ validatetest(void)
   printf(stdout, "validate ok\n");
 }
 
+// Two wmaps placed back to back must stay two mappings:
+// each is remapped and unmapped by its own address alone.
+void
+wmapadjacent(void)
+{
+  struct wmapinfo info;
+  char *a = (char*)0x60000000, *b = a + 4096;
+
+  printf(stdout, "wmap adjacent test\n");
+  if(wmap((uint)a, 4096, MAP_FIXED|MAP_ANONYMOUS|MAP_PRIVATE, -1) != (uint)a ||
+     wmap((uint)b, 4096, MAP_FIXED|MAP_ANONYMOUS|MAP_PRIVATE, -1) != (uint)b){
+    printf(stdout, "wmap adjacent: wmap failed\n");
+    exit();
+  }
+  if(getwmapinfo(&info) < 0 || info.total_mmaps != 2){
+    printf(stdout, "wmap adjacent: maps were merged\n");
+    exit();
+  }
+  a[0] = 'a';
+  b[0] = 'b';
+  if(wremap((uint)b, 4096, 4096, 0) != (uint)b){
+    printf(stdout, "wmap adjacent: wremap of the second map failed\n");
+    exit();
+  }
+  if(wunmap((uint)b) != 0){
+    printf(stdout, "wmap adjacent: wunmap of the second map failed\n");
+    exit();
+  }
+  if(getwmapinfo(&info) < 0 || info.total_mmaps != 1 ||
+     info.addr[0] != (int)a || a[0] != 'a'){
+    printf(stdout, "wmap adjacent: first map lost\n");
+    exit();
+  }
+  if(wunmap((uint)a) != 0 || getwmapinfo(&info) < 0 || info.total_mmaps != 0){
+    printf(stdout, "wmap adjacent: wunmap of the first map failed\n");
+    exit();
+  }
+  printf(stdout, "wmap adjacent ok\n");
+}
+
 // does unintialized data start out zero?
 char uninit[10000];
 void
@@ -1745,9 +1790,48 @@ rand()
   return randstate;
 }
 
+// Tests that can be run by name, as in "usertests fourfiles".
+struct {
+  char *name;
+  void (*fn)(void);
+} named[] = {
+  { "createdelete", createdelete },
+  { "linkunlink", linkunlink },
+  { "concreate", concreate },
+  { "fourfiles", fourfiles },
+  { "sharedfd", sharedfd },
+  { "bigwrite", bigwrite },
+  { "writetest", writetest },
+  { "writetest1", writetest1 },
+  { "createtest", createtest },
+  { "bigfile", bigfile },
+  { "subdir", subdir },
+  { "bigdir", bigdir },
+  { "wmapadjacent", wmapadjacent },
+  { 0, 0 },
+};
+
 int
 main(int argc, char *argv[])
 {
+  int i, j;
+
+  // Run just the named tests, skipping the usertests.ran check
+  // so that benchmarks can run them again and again.
+  if(argc > 1){
+    for(i = 1; i < argc; i++){
+      for(j = 0; named[j].name; j++)
+        if(strcmp(argv[i], named[j].name) == 0)
+          break;
+      if(named[j].name == 0){
+        printf(1, "usertests: no test %s\n", argv[i]);
+        exit();
+      }
+      named[j].fn();
+    }
+    exit();
+  }
+
   printf(1, "usertests starting\n");
 
   if(open("usertests.ran", 0) >= 0){
@@ -1769,6 +1853,7 @@ main(int argc, char *argv[])
   bsstest();
   sbrktest();
   validatetest();
+  wmapadjacent();
 
   opentest();
   writetest();
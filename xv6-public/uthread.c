@@ -0,0 +1,79 @@
+// Threads for user programs, on top of clone and join.
+// Kept out of ulib.c, which forktest links alone, as it needs malloc.
+//
+// Each thread runs on a one-page stack carved out of a
+// malloc'd block at a page boundary, as clone requires; the
+// table remembers the block so that thread_join can free it.
+
+#include "types.h"
+#include "user.h"
+
+#define TSTACKSIZE 4096
+#define MAXTHREADS 64
+
+static struct {
+  void *stack;                 // Stack handed to clone, 0 if slot free
+  void *block;                 // What malloc returned
+  void (*fn)(void*);
+  void *arg;
+} threads[MAXTHREADS];
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+  exit();
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+    if(threads[i].stack == 0)
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+    lock_acquire(&threadslock);
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+
+int
+thread_join(void)
+{
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+    return -1;
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+      free(threads[i].block);
+      threads[i].stack = 0;
+      break;
+    }
+  }
+  lock_release(&threadslock);
+  return pid;
+}
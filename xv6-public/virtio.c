@@ -0,0 +1,356 @@
+// Driver for a virtio block device on PCI, through the legacy
+// interface.  When one is found at boot it serves all buffer
+// cache I/O in place of the IDE driver; see brw in bio.c.  It has
+// not been booted yet, so it only looks for one in a kernel built
+// with "make VIRTIO=1".
+//
+// Unlike the IDE disk, which does one command at a time, the device
+// takes any number of requests at once, so virtiorwv hands all of
+// them over and returns.  A run of consecutive blocks goes as one
+// request whose data is scattered over the bufs.  The device is
+// only asked to interrupt when the last request in flight finishes,
+// or sooner if a process is waiting for one.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "proc.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "sleeplock.h"
+#include "fs.h"
+#include "buf.h"
+#include "bcache.h"
+#include "pci.h"
+#include "virtio.h"
+
+#define SECTOR_SIZE   512
+#define NVDESC        256  // largest queue we can set up
+#define VIRTIO_MAXBLKS 64  // blocks in one request
+
+#define ALIGN(x) (((x) + PGSIZE - 1) & ~(PGSIZE - 1))
+
+// The queue must be physically contiguous, which kernel BSS is.
+static char vqmem[ALIGN(sizeof(struct vring_desc)*NVDESC + 6 + 2*NVDESC) +
+                  6 + sizeof(struct vring_used_elem)*NVDESC]
+  __attribute__((aligned(PGSIZE)));
+
+int virtioblk;  // a virtio disk was found and serves the buffer cache
+
+static struct {
+  struct spinlock lock;
+  ushort iobase;
+  int irq;
+  int qsize;
+  uint capacity;   // disk size in sectors
+  int eventidx;    // device honors used_event
+
+  struct vring_desc *desc;
+  struct vring_avail *avail;
+  struct vring_used *used;
+  ushort *usedevent;
+  ushort lastused; // used ring entries we have seen
+
+  ushort free[NVDESC];  // free descriptors
+  int nfree;
+  int inflight;    // requests handed to the device
+  int nwaiting;    // of those, ones a process is sleeping on
+
+  // A request, indexed by the head of its descriptor chain.
+  struct {
+    struct virtio_blk_req hdr;
+    uchar status;
+    struct buf *b;  // first buf, the rest through qnext
+    int n;
+    int waiter;
+  } req[NVDESC];
+
+  uint nintrs;     // interrupts taken
+  uint nblocks;    // blocks moved
+} vdisk;
+
+int
+virtioinit(void)
+{
+  struct pcidev pd;
+  ushort io;
+  int i, q;
+
+#ifndef VIRTIO
+  return -1;
+#endif
+  if(pcifindid(VIRTIO_VENDOR, VIRTIO_DEV_BLK, &pd) < 0 || !(pd.bar[0] & 1))
+    return -1;
+  if(pd.irq == 0 || pd.irq >= 16)
+    return -1;
+  pcienable(&pd, PCI_CMD_IO | PCI_CMD_MASTER);
+  io = pd.bar[0] & ~3;
+
+  outb(io + VIRTIO_STATUS, 0);  // reset
+  outb(io + VIRTIO_STATUS, VIRTIO_S_ACK);
+  outb(io + VIRTIO_STATUS, VIRTIO_S_ACK | VIRTIO_S_DRIVER);
+  vdisk.eventidx = (inl(io + VIRTIO_FEATURES) & VIRTIO_F_EVENT_IDX) != 0;
+  outl(io + VIRTIO_GFEATURES, vdisk.eventidx ? VIRTIO_F_EVENT_IDX : 0);
+
+  outw(io + VIRTIO_QSEL, 0);
+  q = inw(io + VIRTIO_QSIZE);
+  if(q == 0 || q > NVDESC){
+    outb(io + VIRTIO_STATUS, VIRTIO_S_FAILED);
+    return -1;
+  }
+
+  initlock(&vdisk.lock, "virtio");
+  vdisk.iobase = io;
+  vdisk.irq = pd.irq;
+  vdisk.qsize = q;
+  vdisk.capacity = inl(io + VIRTIO_CONFIG);
+  if(inl(io + VIRTIO_CONFIG + 4) != 0)
+    vdisk.capacity = 0xffffffff;
+  memset(vqmem, 0, sizeof(vqmem));
+  vdisk.desc = (struct vring_desc*)vqmem;
+  vdisk.avail = (struct vring_avail*)(vqmem + sizeof(struct vring_desc)*q);
+  vdisk.usedevent = &vdisk.avail->ring[q];
+  vdisk.used = (struct vring_used*)(vqmem +
+    ALIGN(sizeof(struct vring_desc)*q + 6 + 2*q));
+  for(i = 0; i < q; i++)
+    vdisk.free[i] = i;
+  vdisk.nfree = q;
+  outl(io + VIRTIO_QPFN, V2P(vqmem) / PGSIZE);
+
+  ioapicenable(vdisk.irq, ncpu - 1);
+  outb(io + VIRTIO_STATUS, VIRTIO_S_ACK | VIRTIO_S_DRIVER | VIRTIO_S_OK);
+  virtioblk = 1;
+  cprintf("virtio: disk of %d sectors at port 0x%x irq %d, queue %d\n",
+          vdisk.capacity, io, vdisk.irq, q);
+  return 0;
+}
+
+// Tell the device after which completion to interrupt: the next
+// one if anybody is waiting, else the last one in flight.
+static void
+setevent(void)
+{
+  if(vdisk.eventidx){
+    if(vdisk.nwaiting || vdisk.inflight == 0)
+      *vdisk.usedevent = vdisk.lastused;
+    else
+      *vdisk.usedevent = vdisk.lastused + vdisk.inflight - 1;
+  }
+  __sync_synchronize();
+}
+
+// Finish every request the device has completed, and rearm the
+// interrupt.  Caller must hold vdisk.lock.
+static void
+drain(void)
+{
+  struct vring_used_elem *e;
+  struct buf *b, *next;
+  int head, d, i;
+
+  for(;;){
+    while(vdisk.lastused != vdisk.used->idx){
+      __sync_synchronize();
+      e = &vdisk.used->ring[vdisk.lastused % vdisk.qsize];
+      vdisk.lastused++;
+      head = e->id;
+      if(vdisk.req[head].status != VIRTIO_BLK_S_OK)
+        panic("virtio: disk error");
+
+      for(b = vdisk.req[head].b, i = 0; i < vdisk.req[head].n; b = next, i++){
+        next = b->qnext;
+        b->flags |= B_VALID;
+        b->flags &= ~B_DIRTY;
+        if(b->flags & B_ASYNC)
+          bdone(b);
+        else
+          wakeup(b);
+      }
+      vdisk.nblocks += vdisk.req[head].n;
+      if(vdisk.req[head].waiter)
+        vdisk.nwaiting--;
+      vdisk.inflight--;
+
+      for(d = head; ; d = vdisk.desc[d].next){
+        vdisk.free[vdisk.nfree++] = d;
+        if(!(vdisk.desc[d].flags & VRING_DESC_F_NEXT))
+          break;
+      }
+      wakeup(&vdisk.free);
+    }
+    setevent();
+    // The device may have finished more before it saw the new
+    // used_event, and so not interrupt for them.
+    if(vdisk.lastused == vdisk.used->idx)
+      break;
+  }
+}
+
+// Hand the n bufs at bs, which are consecutive blocks going the
+// same way, to the device as one request.  Caller must hold
+// vdisk.lock.
+static void
+submit(struct buf **bs, int n, struct buf *waitb)
+{
+  int i, d, head, prev, spb;
+  struct buf *b;
+
+  // Let the device start on what is queued so far, and ask to hear
+  // as soon as it gives back some descriptors.
+  while(vdisk.nfree < n + 2){
+    vdisk.nwaiting++;
+    setevent();
+    outw(vdisk.iobase + VIRTIO_QNOTIFY, 0);
+    sleep(&vdisk.free, &vdisk.lock);
+    vdisk.nwaiting--;
+  }
+
+  spb = BSIZE / SECTOR_SIZE;
+  b = bs[0];
+  if(b->blockno*spb + n*spb > vdisk.capacity)
+    panic("virtio: block out of range");
+
+  head = vdisk.free[--vdisk.nfree];
+  vdisk.req[head].hdr.type = (b->flags & B_DIRTY) ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  vdisk.req[head].hdr.reserved = 0;
+  vdisk.req[head].hdr.sector = b->blockno * spb;
+  vdisk.req[head].hdr.sectorhi = 0;
+  vdisk.req[head].status = 0xff;
+  vdisk.req[head].b = b;
+  vdisk.req[head].n = n;
+  vdisk.req[head].waiter = 0;
+  vdisk.desc[head].addr = V2P(&vdisk.req[head].hdr);
+  vdisk.desc[head].addrhi = 0;
+  vdisk.desc[head].len = sizeof(vdisk.req[head].hdr);
+  vdisk.desc[head].flags = VRING_DESC_F_NEXT;
+
+  prev = head;
+  for(i = 0; i < n; i++){
+    d = vdisk.free[--vdisk.nfree];
+    vdisk.desc[prev].next = d;
+    vdisk.desc[d].addr = V2P(bs[i]->data);
+    vdisk.desc[d].addrhi = 0;
+    vdisk.desc[d].len = BSIZE;
+    vdisk.desc[d].flags = VRING_DESC_F_NEXT;
+    if(!(b->flags & B_DIRTY))
+      vdisk.desc[d].flags |= VRING_DESC_F_WRITE;
+    bs[i]->qnext = i+1 < n ? bs[i+1] : 0;
+    if(bs[i] == waitb)
+      vdisk.req[head].waiter = 1;
+    prev = d;
+  }
+
+  d = vdisk.free[--vdisk.nfree];
+  vdisk.desc[prev].next = d;
+  vdisk.desc[d].addr = V2P(&vdisk.req[head].status);
+  vdisk.desc[d].addrhi = 0;
+  vdisk.desc[d].len = 1;
+  vdisk.desc[d].flags = VRING_DESC_F_WRITE;
+
+  vdisk.inflight++;
+  if(vdisk.req[head].waiter)
+    vdisk.nwaiting++;
+  vdisk.avail->ring[vdisk.avail->idx % vdisk.qsize] = head;
+  __sync_synchronize();
+  vdisk.avail->idx++;
+}
+
+// Sync buf with disk, as iderw does.
+void
+virtiorw(struct buf *b)
+{
+  virtiorwv(b, 0, 0);
+}
+
+// Sync b with disk and start the n bufs in async, as iderwv
+// does.  b may be 0.
+void
+virtiorwv(struct buf *b, struct buf **async, int n)
+{
+  struct buf *bs[1 + n], *run[VIRTIO_MAXBLKS];
+  int i, nb, nrun, maxrun;
+
+  nb = 0;
+  if(b)
+    bs[nb++] = b;
+  for(i = 0; i < n; i++)
+    bs[nb++] = async[i];
+  if(nb == 0)
+    return;
+  for(i = 0; i < nb; i++){
+    if(!holdingsleep(&bs[i]->lock))
+      panic("virtiorw: buf not locked");
+    if((bs[i]->flags & (B_VALID|B_DIRTY)) == B_VALID)
+      panic("virtiorw: nothing to do");
+  }
+
+  acquire(&vdisk.lock);
+
+  // Gather runs of consecutive blocks into single requests, each
+  // small enough to fit in the queue.
+  maxrun = vdisk.qsize - 2 < VIRTIO_MAXBLKS ? vdisk.qsize - 2 : VIRTIO_MAXBLKS;
+  nrun = 0;
+  for(i = 0; i < nb; i++){
+    if(nrun > 0 && (nrun == maxrun ||
+       bs[i]->blockno != run[nrun-1]->blockno + 1 ||
+       (bs[i]->flags & B_DIRTY) != (run[0]->flags & B_DIRTY))){
+      submit(run, nrun, b);
+      nrun = 0;
+    }
+    run[nrun++] = bs[i];
+  }
+  submit(run, nrun, b);
+
+  setevent();
+  outw(vdisk.iobase + VIRTIO_QNOTIFY, 0);
+  drain();
+
+  // Wait for request to finish.
+  while(b && (b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+    sleep(b, &vdisk.lock);
+
+  release(&vdisk.lock);
+}
+
+// Wait for the device to finish with b, which virtiorwv started
+// without B_ASYNC.
+void
+virtiorwait(struct buf *b)
+{
+  acquire(&vdisk.lock);
+  if((b->flags & (B_VALID|B_DIRTY)) != B_VALID){
+    // ask for an interrupt at the next completion.
+    vdisk.nwaiting++;
+    drain();
+    while((b->flags & (B_VALID|B_DIRTY)) != B_VALID)
+      sleep(b, &vdisk.lock);
+    vdisk.nwaiting--;
+  }
+  release(&vdisk.lock);
+}
+
+// Interrupt handler.  Returns 1 if irq was the disk's.
+int
+virtiointr(int irq)
+{
+  if(!virtioblk || irq != vdisk.irq)
+    return 0;
+  acquire(&vdisk.lock);
+  inb(vdisk.iobase + VIRTIO_ISR);
+  vdisk.nintrs++;
+  drain();
+  release(&vdisk.lock);
+  return 1;
+}
+
+// Add up the interrupts taken and the blocks moved.
+void
+virtiostat(struct bcstat *st)
+{
+  acquire(&vdisk.lock);
+  st->diskintrs = vdisk.nintrs;
+  st->diskblocks = vdisk.nblocks;
+  release(&vdisk.lock);
+}
@@ -0,0 +1,66 @@
+// Legacy virtio over PCI, and the virtio block device.
+
+#define VIRTIO_VENDOR     0x1af4
+#define VIRTIO_DEV_BLK    0x1001  // block device with the legacy interface
+
+// Legacy registers, in the I/O space at BAR0
+#define VIRTIO_FEATURES   0x00  // features the device offers
+#define VIRTIO_GFEATURES  0x04  // features the driver accepts
+#define VIRTIO_QPFN       0x08  // page number of the selected queue
+#define VIRTIO_QSIZE      0x0c  // entries in the selected queue
+#define VIRTIO_QSEL       0x0e  // queue to program
+#define VIRTIO_QNOTIFY    0x10  // write a queue number to kick it
+#define VIRTIO_STATUS     0x12
+#define VIRTIO_ISR        0x13  // reading acknowledges the interrupt
+#define VIRTIO_CONFIG     0x14  // device-specific configuration
+
+// Bits in VIRTIO_STATUS
+#define VIRTIO_S_ACK      0x01
+#define VIRTIO_S_DRIVER   0x02
+#define VIRTIO_S_OK       0x04
+#define VIRTIO_S_FAILED   0x80
+
+// Device can be told, in used_event, after which completion to
+// interrupt.
+#define VIRTIO_F_EVENT_IDX (1<<29)
+
+// A virtqueue is a descriptor table, then the available ring the
+// driver fills, then, on the next page, the used ring the device
+// fills.
+struct vring_desc {
+  uint addr;
+  uint addrhi;
+  uint len;
+  ushort flags;
+  ushort next;
+};
+#define VRING_DESC_F_NEXT  1  // chained with next
+#define VRING_DESC_F_WRITE 2  // device writes, rather than reads
+
+struct vring_avail {
+  ushort flags;
+  ushort idx;
+  ushort ring[];  // followed by used_event
+};
+
+struct vring_used_elem {
+  uint id;   // head of the finished descriptor chain
+  uint len;
+};
+
+struct vring_used {
+  ushort flags;
+  ushort idx;
+  struct vring_used_elem ring[];
+};
+
+// Block request header; the data and a status byte follow.
+struct virtio_blk_req {
+  uint type;
+  uint reserved;
+  uint sector;
+  uint sectorhi;
+};
+#define VIRTIO_BLK_T_IN  0  // read
+#define VIRTIO_BLK_T_OUT 1  // write
+#define VIRTIO_BLK_S_OK  0
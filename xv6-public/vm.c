@@ -124,6 +124,13 @@ setupkvm(void)
   if((pgdir = (pde_t*)kalloc()) == 0)
     return 0;
   memset(pgdir, 0, PGSIZE);
+  // Once kpgdir exists, every page table shares its kernel
+  // page-table pages instead of building 60-odd of its own.
+  if(kpgdir){
+    memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+            (NPDENTRIES - PDX(KERNBASE)) * sizeof(pde_t));
+    return pgdir;
+  }
   if (P2V(PHYSTOP) > (void*)DEVSPACE)
     panic("PHYSTOP too high");
   for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
@@ -248,6 +255,79 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
+// Allocate zeroed pages for [va, va+sz) and map them with perm in a
+// single pass. Rather than calling walkpgdir once per page like
+// mappages, the page table page for each 4MB slice is looked up once
+// and its PTEs are filled in directly. va must be page-aligned.
+// Returns 0 on success; on failure every page mapped by this call is
+// freed again and -1 is returned.
+int
+populateuvm(pde_t *pgdir, uint va, uint sz, int perm)
+{
+  char *mem;
+  pte_t *pte;
+  uint a, last;
+
+  if(va % PGSIZE != 0)
+    panic("populateuvm: va must be page aligned");
+
+  last = PGROUNDUP(va + sz);
+  a = va;
+  while(a < last){
+    if((pte = walkpgdir(pgdir, (char*)a, 1)) == 0)
+      goto bad;
+    // Fill the rest of this page table page.
+    do {
+      if(*pte & PTE_P)
+        panic("populateuvm: remap");
+      if((mem = kalloc()) == 0)
+        goto bad;
+      memset(mem, 0, PGSIZE);
+      *pte++ = V2P(mem) | perm | PTE_P;
+      a += PGSIZE;
+    } while(a < last && PTX(a) != 0);
+  }
+  return 0;
+
+bad:
+  cprintf("populateuvm out of memory\n");
+  deallocuvm(pgdir, a, va);
+  return -1;
+}
+
+// Map the n frames in mem at [va, va+n*PGSIZE) with perm, filling the
+// PTEs of each page table page directly as populateuvm does. A page
+// that is already mapped keeps its frame. Each frame that gets mapped
+// is cleared from mem, so the ones left there are still the caller's.
+// Returns the number of frames mapped, or -1 if a page table page
+// could not be allocated.
+int
+mapframes(pde_t *pgdir, uint va, char **mem, int n, int perm)
+{
+  pte_t *pte;
+  int i, mapped;
+
+  if(va % PGSIZE != 0)
+    panic("mapframes: va must be page aligned");
+
+  mapped = 0;
+  i = 0;
+  while(i < n){
+    if((pte = walkpgdir(pgdir, (char*)va + i*PGSIZE, 1)) == 0)
+      return -1;
+    do {
+      if(!(*pte & PTE_P)){
+        *pte = V2P(mem[i]) | perm | PTE_P;
+        mem[i] = 0;
+        mapped++;
+      }
+      pte++;
+      i++;
+    } while(i < n && PTX(va + i*PGSIZE) != 0);
+  }
+  return mapped;
+}
+
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
@@ -278,6 +358,131 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   return newsz;
 }
 
+// Unmap the user pages in [start, end) without freeing them: other
+// CPUs running threads of this address space may still reach them
+// through their TLBs.  Each PTE keeps its frame, marked PTE_DEAD
+// instead of PTE_P, for reapuvm to free once the TLBs are flushed.
+void
+unmapuvm(pde_t *pgdir, uint start, uint end)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(start); a < end; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if(*pte & PTE_P)
+      *pte = (*pte & ~PTE_P) | PTE_DEAD;
+  }
+}
+
+// Free the frames unmapuvm left in [start, end).
+void
+reapuvm(pde_t *pgdir, uint start, uint end)
+{
+  pte_t *pte;
+  uint a;
+
+  for(a = PGROUNDDOWN(start); a < end; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if(*pte & PTE_DEAD){
+      kfree(P2V(PTE_ADDR(*pte)));
+      *pte = 0;
+    }
+  }
+}
+
+// Drop the wmlock pins on every pinned page in [start, end).
+// Returns the number of pages unpinned.
+int
+unpinuvm(pde_t *pgdir, uint start, uint end)
+{
+  pte_t *pte;
+  uint a;
+  int n;
+
+  n = 0;
+  for(a = PGROUNDDOWN(start); a < end; a += PGSIZE){
+    pte = walkpgdir(pgdir, (char*)a, 0);
+    if(!pte)
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if((*pte & PTE_P) && (*pte & PTE_PIN)){
+      kunpin(P2V(PTE_ADDR(*pte)));
+      *pte &= ~PTE_PIN;
+      n++;
+    }
+  }
+  return n;
+}
+
+// Can the whole page table page behind src be handed to dst by
+// rewriting PDEs? Both must be 4MB aligned, the move must cover the
+// whole 4MB, and dst's page table (if any) must be empty.
+static int
+pdemovable(pde_t *pgdir, uint src, uint dst, uint left)
+{
+  pte_t *pgtab;
+  int i;
+
+  if(src % PDSIZE || dst % PDSIZE || left < PDSIZE)
+    return 0;
+  if(pgdir[PDX(dst)] & PTE_P){
+    pgtab = (pte_t*)P2V(PTE_ADDR(pgdir[PDX(dst)]));
+    for(i = 0; i < NPTENTRIES; i++)
+      if(pgtab[i] & PTE_P)
+        return 0;
+  }
+  return 1;
+}
+
+// Move the user mappings for [oldva, oldva+sz) so that they start at
+// newva, without copying any page contents. Where both ranges are 4MB
+// aligned whole page table pages are handed over by rewriting a PDE;
+// elsewhere PTEs are moved one at a time. The two ranges must not
+// overlap and the destination must be unmapped. Destination page
+// tables are allocated before anything moves, so on failure (-1)
+// the old mappings are untouched. The caller must flush the TLB.
+int
+moveuvm(pde_t *pgdir, uint oldva, uint newva, uint sz)
+{
+  uint off;
+  pte_t *src, *dst;
+
+  sz = PGROUNDUP(sz);
+  for(off = 0; off < sz; off += PGSIZE){
+    if(pdemovable(pgdir, oldva+off, newva+off, sz-off)){
+      off += PDSIZE - PGSIZE;
+      continue;
+    }
+    src = walkpgdir(pgdir, (char*)oldva+off, 0);
+    if(src && (*src & PTE_P) && walkpgdir(pgdir, (char*)newva+off, 1) == 0)
+      return -1;
+  }
+
+  for(off = 0; off < sz; off += PGSIZE){
+    if(pdemovable(pgdir, oldva+off, newva+off, sz-off)){
+      if(pgdir[PDX(newva+off)] & PTE_P)
+        kfree(P2V(PTE_ADDR(pgdir[PDX(newva+off)])));
+      pgdir[PDX(newva+off)] = pgdir[PDX(oldva+off)];
+      pgdir[PDX(oldva+off)] = 0;
+      off += PDSIZE - PGSIZE;
+      continue;
+    }
+    src = walkpgdir(pgdir, (char*)oldva+off, 0);
+    if(src == 0 || (*src & PTE_P) == 0)
+      continue;
+    dst = walkpgdir(pgdir, (char*)newva+off, 0);
+    if(*dst & PTE_P)
+      panic("moveuvm: remap");
+    *dst = *src;
+    *src = 0;
+  }
+  return 0;
+}
+
 // Free a page table and all the physical memory pages
 // in the user part.
 void
@@ -288,7 +493,8 @@ freevm(pde_t *pgdir)
   if(pgdir == 0)
     panic("freevm: no pgdir");
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  // The kernel's page-table pages belong to kpgdir.
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = P2V(PTE_ADDR(pgdir[i]));
       kfree(v);
@@ -316,31 +522,56 @@ pde_t*
 copyuvm(pde_t *pgdir, uint sz)
 {
   pde_t *d;
-  pte_t *pte;
-  uint pa, i, flags;
-  char *mem;
 
   if((d = setupkvm()) == 0)
     return 0;
-  for(i = 0; i < sz; i += PGSIZE){
-    if((pte = walkpgdir(pgdir, (void *) i, 0)) == 0)
-      panic("copyuvm: pte should exist");
-    if(!(*pte & PTE_P))
-      panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
-    if((mem = kalloc()) == 0)
-      goto bad;
-    memmove(mem, (char*)P2V(pa), PGSIZE);
-    if(mappages(d, (void*)i, PGSIZE, V2P(mem), flags) < 0) {
-      kfree(mem);
-      goto bad;
-    }
+  if(copyuvmrange(d, pgdir, 0, sz, 0) < 0){
+    freevm(d);
+    return 0;
   }
   return d;
+}
 
-bad:
-  freevm(d);
+// Map the present user pages of s in [start, end) into d, copying
+// each one, or with share, mapping the same frame.  Works a page
+// table at a time: an empty page directory entry skips 4MB at
+// once, and d's page-table page is allocated once rather than
+// walked for every page.  wmlock pins are not inherited.
+int
+copyuvmrange(pde_t *d, pde_t *s, uint start, uint end, int share)
+{
+  pte_t *spt, *dpt, pte;
+  uint a, next;
+  char *mem;
+
+  for(a = PGROUNDDOWN(start); a < end; a = next){
+    next = (a + PDSIZE) & ~(PDSIZE - 1);
+    if(next > end)
+      next = end;
+    if((s[PDX(a)] & PTE_P) == 0)
+      continue;
+    spt = (pte_t*)P2V(PTE_ADDR(s[PDX(a)]));
+    dpt = 0;
+    for(; a < next; a += PGSIZE){
+      pte = spt[PTX(a)];
+      if((pte & PTE_P) == 0)
+        continue;
+      if(dpt == 0){
+        if((dpt = walkpgdir(d, (void*)a, 1)) == 0)
+          return -1;
+        dpt -= PTX(a);
+      }
+      if(share){
+        mem = P2V(PTE_ADDR(pte));
+        kshare(mem);
+      } else {
+        if((mem = kalloc()) == 0)
+          return -1;
+        memmove(mem, (char*)P2V(PTE_ADDR(pte)), PGSIZE);
+      }
+      dpt[PTX(a)] = V2P(mem) | (PTE_FLAGS(pte) & ~PTE_PIN);
+    }
+  }
   return 0;
 }
 
@@ -352,7 +583,7 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
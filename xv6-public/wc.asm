@@ -0,0 +1,1937 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+}
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	be 01 00 00 00       	mov    $0x1,%esi
+  14:	53                   	push   %ebx
+  15:	51                   	push   %ecx
+  16:	83 ec 18             	sub    $0x18,%esp
+  19:	8b 01                	mov    (%ecx),%eax
+  1b:	8b 59 04             	mov    0x4(%ecx),%ebx
+  1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  21:	83 c3 04             	add    $0x4,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  24:	83 f8 01             	cmp    $0x1,%eax
+  27:	7f 28                	jg     51 <main+0x51>
+  29:	eb 54                	jmp    7f <main+0x7f>
+  2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  2f:	90                   	nop
+  for(i = 1; i < argc; i++){
+    if((fd = open(argv[i], 0)) < 0){
+      printf(1, "wc: cannot open %s\n", argv[i]);
+      exit();
+    }
+    wc(fd, argv[i]);
+  30:	83 ec 08             	sub    $0x8,%esp
+  33:	ff 33                	push   (%ebx)
+  for(i = 1; i < argc; i++){
+  35:	83 c6 01             	add    $0x1,%esi
+  38:	83 c3 04             	add    $0x4,%ebx
+    wc(fd, argv[i]);
+  3b:	50                   	push   %eax
+  3c:	e8 5f 00 00 00       	call   a0 <wc>
+    close(fd);
+  41:	89 3c 24             	mov    %edi,(%esp)
+  44:	e8 53 05 00 00       	call   59c <close>
+  for(i = 1; i < argc; i++){
+  49:	83 c4 10             	add    $0x10,%esp
+  4c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  4f:	74 29                	je     7a <main+0x7a>
+    if((fd = open(argv[i], 0)) < 0){
+  51:	83 ec 08             	sub    $0x8,%esp
+  54:	6a 00                	push   $0x0
+  56:	ff 33                	push   (%ebx)
+  58:	e8 57 05 00 00       	call   5b4 <open>
+  5d:	83 c4 10             	add    $0x10,%esp
+  60:	89 c7                	mov    %eax,%edi
+  62:	85 c0                	test   %eax,%eax
+  64:	79 ca                	jns    30 <main+0x30>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+  66:	50                   	push   %eax
+  67:	ff 33                	push   (%ebx)
+  69:	68 8b 0c 00 00       	push   $0xc8b
+  6e:	6a 01                	push   $0x1
+  70:	e8 0b 07 00 00       	call   780 <printf>
+      exit();
+  75:	e8 fa 04 00 00       	call   574 <exit>
+  }
+  exit();
+  7a:	e8 f5 04 00 00       	call   574 <exit>
+    wc(0, "");
+  7f:	52                   	push   %edx
+  80:	52                   	push   %edx
+  81:	68 7d 0c 00 00       	push   $0xc7d
+  86:	6a 00                	push   $0x0
+  88:	e8 13 00 00 00       	call   a0 <wc>
+    exit();
+  8d:	e8 e2 04 00 00       	call   574 <exit>
+  92:	66 90                	xchg   %ax,%ax
+  94:	66 90                	xchg   %ax,%ax
+  96:	66 90                	xchg   %ax,%ax
+  98:	66 90                	xchg   %ax,%ax
+  9a:	66 90                	xchg   %ax,%ax
+  9c:	66 90                	xchg   %ax,%ax
+  9e:	66 90                	xchg   %ax,%ax
+
+000000a0 <wc>:
+{
+  a0:	55                   	push   %ebp
+  l = w = c = 0;
+  a1:	31 d2                	xor    %edx,%edx
+{
+  a3:	89 e5                	mov    %esp,%ebp
+  a5:	57                   	push   %edi
+  a6:	56                   	push   %esi
+  inword = 0;
+  a7:	31 f6                	xor    %esi,%esi
+{
+  a9:	53                   	push   %ebx
+  l = w = c = 0;
+  aa:	31 db                	xor    %ebx,%ebx
+{
+  ac:	83 ec 1c             	sub    $0x1c,%esp
+  l = w = c = 0;
+  af:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+  b6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  c0:	83 ec 04             	sub    $0x4,%esp
+  c3:	68 00 02 00 00       	push   $0x200
+  c8:	68 e0 11 00 00       	push   $0x11e0
+  cd:	ff 75 08             	push   0x8(%ebp)
+  d0:	e8 b7 04 00 00       	call   58c <read>
+  d5:	83 c4 10             	add    $0x10,%esp
+  d8:	89 c1                	mov    %eax,%ecx
+  da:	85 c0                	test   %eax,%eax
+  dc:	7e 62                	jle    140 <wc+0xa0>
+    for(i=0; i<n; i++){
+  de:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  e1:	31 ff                	xor    %edi,%edi
+  e3:	eb 0d                	jmp    f2 <wc+0x52>
+  e5:	8d 76 00             	lea    0x0(%esi),%esi
+        inword = 0;
+  e8:	31 f6                	xor    %esi,%esi
+    for(i=0; i<n; i++){
+  ea:	83 c7 01             	add    $0x1,%edi
+  ed:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+  f0:	74 3e                	je     130 <wc+0x90>
+      if(buf[i] == '\n')
+  f2:	0f be 87 e0 11 00 00 	movsbl 0x11e0(%edi),%eax
+        l++;
+  f9:	31 c9                	xor    %ecx,%ecx
+  fb:	3c 0a                	cmp    $0xa,%al
+  fd:	0f 94 c1             	sete   %cl
+      if(strchr(" \r\t\n\v", buf[i]))
+ 100:	83 ec 08             	sub    $0x8,%esp
+ 103:	50                   	push   %eax
+        l++;
+ 104:	01 cb                	add    %ecx,%ebx
+      if(strchr(" \r\t\n\v", buf[i]))
+ 106:	68 68 0c 00 00       	push   $0xc68
+ 10b:	e8 50 01 00 00       	call   260 <strchr>
+ 110:	83 c4 10             	add    $0x10,%esp
+ 113:	85 c0                	test   %eax,%eax
+ 115:	75 d1                	jne    e8 <wc+0x48>
+      else if(!inword){
+ 117:	85 f6                	test   %esi,%esi
+ 119:	75 cf                	jne    ea <wc+0x4a>
+        w++;
+ 11b:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+        inword = 1;
+ 11f:	be 01 00 00 00       	mov    $0x1,%esi
+    for(i=0; i<n; i++){
+ 124:	83 c7 01             	add    $0x1,%edi
+ 127:	39 7d e4             	cmp    %edi,-0x1c(%ebp)
+ 12a:	75 c6                	jne    f2 <wc+0x52>
+ 12c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+      c++;
+ 130:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+ 133:	01 4d dc             	add    %ecx,-0x24(%ebp)
+ 136:	eb 88                	jmp    c0 <wc+0x20>
+ 138:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 13f:	90                   	nop
+  if(n < 0){
+ 140:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 143:	75 22                	jne    167 <wc+0xc7>
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+ 145:	83 ec 08             	sub    $0x8,%esp
+ 148:	ff 75 0c             	push   0xc(%ebp)
+ 14b:	52                   	push   %edx
+ 14c:	ff 75 e0             	push   -0x20(%ebp)
+ 14f:	53                   	push   %ebx
+ 150:	68 7e 0c 00 00       	push   $0xc7e
+ 155:	6a 01                	push   $0x1
+ 157:	e8 24 06 00 00       	call   780 <printf>
+}
+ 15c:	83 c4 20             	add    $0x20,%esp
+ 15f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 162:	5b                   	pop    %ebx
+ 163:	5e                   	pop    %esi
+ 164:	5f                   	pop    %edi
+ 165:	5d                   	pop    %ebp
+ 166:	c3                   	ret
+    printf(1, "wc: read error\n");
+ 167:	50                   	push   %eax
+ 168:	50                   	push   %eax
+ 169:	68 6e 0c 00 00       	push   $0xc6e
+ 16e:	6a 01                	push   $0x1
+ 170:	e8 0b 06 00 00       	call   780 <printf>
+    exit();
+ 175:	e8 fa 03 00 00       	call   574 <exit>
+ 17a:	66 90                	xchg   %ax,%ax
+ 17c:	66 90                	xchg   %ax,%ax
+ 17e:	66 90                	xchg   %ax,%ax
+
+00000180 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+ 180:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+ 181:	31 c0                	xor    %eax,%eax
+{
+ 183:	89 e5                	mov    %esp,%ebp
+ 185:	53                   	push   %ebx
+ 186:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 189:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+ 18c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+ 190:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+ 194:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+ 197:	83 c0 01             	add    $0x1,%eax
+ 19a:	84 d2                	test   %dl,%dl
+ 19c:	75 f2                	jne    190 <strcpy+0x10>
+    ;
+  return os;
+}
+ 19e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1a1:	89 c8                	mov    %ecx,%eax
+ 1a3:	c9                   	leave
+ 1a4:	c3                   	ret
+ 1a5:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ac:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	53                   	push   %ebx
+ 1b4:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+ 1ba:	0f b6 02             	movzbl (%edx),%eax
+ 1bd:	84 c0                	test   %al,%al
+ 1bf:	75 17                	jne    1d8 <strcmp+0x28>
+ 1c1:	eb 3a                	jmp    1fd <strcmp+0x4d>
+ 1c3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 1c7:	90                   	nop
+ 1c8:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+ 1cc:	83 c2 01             	add    $0x1,%edx
+ 1cf:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+ 1d2:	84 c0                	test   %al,%al
+ 1d4:	74 1a                	je     1f0 <strcmp+0x40>
+    p++, q++;
+ 1d6:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+ 1d8:	0f b6 19             	movzbl (%ecx),%ebx
+ 1db:	38 c3                	cmp    %al,%bl
+ 1dd:	74 e9                	je     1c8 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+ 1df:	29 d8                	sub    %ebx,%eax
+}
+ 1e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1e4:	c9                   	leave
+ 1e5:	c3                   	ret
+ 1e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+ 1f0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+ 1f4:	31 c0                	xor    %eax,%eax
+ 1f6:	29 d8                	sub    %ebx,%eax
+}
+ 1f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+ 1fd:	0f b6 19             	movzbl (%ecx),%ebx
+ 200:	31 c0                	xor    %eax,%eax
+ 202:	eb db                	jmp    1df <strcmp+0x2f>
+ 204:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 20b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 20f:	90                   	nop
+
+00000210 <strlen>:
+
+uint
+strlen(const char *s)
+{
+ 210:	55                   	push   %ebp
+ 211:	89 e5                	mov    %esp,%ebp
+ 213:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+ 216:	80 3a 00             	cmpb   $0x0,(%edx)
+ 219:	74 15                	je     230 <strlen+0x20>
+ 21b:	31 c0                	xor    %eax,%eax
+ 21d:	8d 76 00             	lea    0x0(%esi),%esi
+ 220:	83 c0 01             	add    $0x1,%eax
+ 223:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+ 227:	89 c1                	mov    %eax,%ecx
+ 229:	75 f5                	jne    220 <strlen+0x10>
+    ;
+  return n;
+}
+ 22b:	89 c8                	mov    %ecx,%eax
+ 22d:	5d                   	pop    %ebp
+ 22e:	c3                   	ret
+ 22f:	90                   	nop
+  for(n = 0; s[n]; n++)
+ 230:	31 c9                	xor    %ecx,%ecx
+}
+ 232:	5d                   	pop    %ebp
+ 233:	89 c8                	mov    %ecx,%eax
+ 235:	c3                   	ret
+ 236:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 23d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000240 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+ 247:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 24a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 24d:	89 d7                	mov    %edx,%edi
+ 24f:	fc                   	cld
+ 250:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 252:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+ 259:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000260 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	8b 45 08             	mov    0x8(%ebp),%eax
+ 266:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 26a:	0f b6 10             	movzbl (%eax),%edx
+ 26d:	84 d2                	test   %dl,%dl
+ 26f:	75 12                	jne    283 <strchr+0x23>
+ 271:	eb 1d                	jmp    290 <strchr+0x30>
+ 273:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 277:	90                   	nop
+ 278:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 27c:	83 c0 01             	add    $0x1,%eax
+ 27f:	84 d2                	test   %dl,%dl
+ 281:	74 0d                	je     290 <strchr+0x30>
+    if(*s == c)
+ 283:	38 d1                	cmp    %dl,%cl
+ 285:	75 f1                	jne    278 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 287:	5d                   	pop    %ebp
+ 288:	c3                   	ret
+ 289:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 290:	31 c0                	xor    %eax,%eax
+}
+ 292:	5d                   	pop    %ebp
+ 293:	c3                   	ret
+ 294:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 29b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 29f:	90                   	nop
+
+000002a0 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	89 e5                	mov    %esp,%ebp
+ 2a3:	57                   	push   %edi
+ 2a4:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 2a5:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 2a8:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 2a9:	31 db                	xor    %ebx,%ebx
+{
+ 2ab:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 2ae:	eb 27                	jmp    2d7 <gets+0x37>
+    cc = read(0, &c, 1);
+ 2b0:	83 ec 04             	sub    $0x4,%esp
+ 2b3:	6a 01                	push   $0x1
+ 2b5:	56                   	push   %esi
+ 2b6:	6a 00                	push   $0x0
+ 2b8:	e8 cf 02 00 00       	call   58c <read>
+    if(cc < 1)
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	85 c0                	test   %eax,%eax
+ 2c2:	7e 1d                	jle    2e1 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 2c4:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 2c8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2cb:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 2cf:	3c 0a                	cmp    $0xa,%al
+ 2d1:	74 10                	je     2e3 <gets+0x43>
+ 2d3:	3c 0d                	cmp    $0xd,%al
+ 2d5:	74 0c                	je     2e3 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 2d7:	89 df                	mov    %ebx,%edi
+ 2d9:	83 c3 01             	add    $0x1,%ebx
+ 2dc:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 2df:	7c cf                	jl     2b0 <gets+0x10>
+ 2e1:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 2ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2ed:	5b                   	pop    %ebx
+ 2ee:	5e                   	pop    %esi
+ 2ef:	5f                   	pop    %edi
+ 2f0:	5d                   	pop    %ebp
+ 2f1:	c3                   	ret
+ 2f2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2f9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000300 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 300:	55                   	push   %ebp
+ 301:	89 e5                	mov    %esp,%ebp
+ 303:	56                   	push   %esi
+ 304:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 a2 02 00 00       	call   5b4 <open>
+  if(fd < 0)
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	85 c0                	test   %eax,%eax
+ 317:	78 27                	js     340 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 319:	83 ec 08             	sub    $0x8,%esp
+ 31c:	ff 75 0c             	push   0xc(%ebp)
+ 31f:	89 c3                	mov    %eax,%ebx
+ 321:	50                   	push   %eax
+ 322:	e8 a5 02 00 00       	call   5cc <fstat>
+  close(fd);
+ 327:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 32a:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 32c:	e8 6b 02 00 00       	call   59c <close>
+  return r;
+ 331:	83 c4 10             	add    $0x10,%esp
+}
+ 334:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 337:	89 f0                	mov    %esi,%eax
+ 339:	5b                   	pop    %ebx
+ 33a:	5e                   	pop    %esi
+ 33b:	5d                   	pop    %ebp
+ 33c:	c3                   	ret
+ 33d:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 340:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 345:	eb ed                	jmp    334 <stat+0x34>
+ 347:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 34e:	66 90                	xchg   %ax,%ax
+
+00000350 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+ 353:	53                   	push   %ebx
+ 354:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 357:	0f be 02             	movsbl (%edx),%eax
+ 35a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 35d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 360:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 365:	77 1e                	ja     385 <atoi+0x35>
+ 367:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 36e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 370:	83 c2 01             	add    $0x1,%edx
+ 373:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 376:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 37a:	0f be 02             	movsbl (%edx),%eax
+ 37d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 380:	80 fb 09             	cmp    $0x9,%bl
+ 383:	76 eb                	jbe    370 <atoi+0x20>
+  return n;
+}
+ 385:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 388:	89 c8                	mov    %ecx,%eax
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+ 38c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000390 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	57                   	push   %edi
+ 394:	56                   	push   %esi
+ 395:	8b 45 10             	mov    0x10(%ebp),%eax
+ 398:	8b 55 08             	mov    0x8(%ebp),%edx
+ 39b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 39e:	85 c0                	test   %eax,%eax
+ 3a0:	7e 13                	jle    3b5 <memmove+0x25>
+ 3a2:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 3a4:	89 d7                	mov    %edx,%edi
+ 3a6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 3ad:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 3b0:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 3b1:	39 f8                	cmp    %edi,%eax
+ 3b3:	75 fb                	jne    3b0 <memmove+0x20>
+  return vdst;
+}
+ 3b5:	5e                   	pop    %esi
+ 3b6:	89 d0                	mov    %edx,%eax
+ 3b8:	5f                   	pop    %edi
+ 3b9:	5d                   	pop    %ebp
+ 3ba:	c3                   	ret
+ 3bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3bf:	90                   	nop
+
+000003c0 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 3c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3cc:	5d                   	pop    %ebp
+ 3cd:	c3                   	ret
+ 3ce:	66 90                	xchg   %ax,%ax
+
+000003d0 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 3d0:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 3d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 3d6:	89 e5                	mov    %esp,%ebp
+ 3d8:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3db:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 3df:	90                   	nop
+ 3e0:	89 c8                	mov    %ecx,%eax
+ 3e2:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 3e5:	85 c0                	test   %eax,%eax
+ 3e7:	75 f7                	jne    3e0 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 3e9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 3ee:	5d                   	pop    %ebp
+ 3ef:	c3                   	ret
+
+000003f0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 3f0:	55                   	push   %ebp
+ 3f1:	31 c0                	xor    %eax,%eax
+ 3f3:	89 e5                	mov    %esp,%ebp
+ 3f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 3f8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 3fd:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 400:	5d                   	pop    %ebp
+ 401:	c3                   	ret
+ 402:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 409:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000410 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 410:	55                   	push   %ebp
+ 411:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 413:	8b 45 08             	mov    0x8(%ebp),%eax
+ 416:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 41c:	5d                   	pop    %ebp
+ 41d:	c3                   	ret
+ 41e:	66 90                	xchg   %ax,%ax
+
+00000420 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 420:	55                   	push   %ebp
+ 421:	b8 01 00 00 00       	mov    $0x1,%eax
+ 426:	89 e5                	mov    %esp,%ebp
+ 428:	56                   	push   %esi
+ 429:	53                   	push   %ebx
+ 42a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 42d:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 430:	85 c0                	test   %eax,%eax
+ 432:	74 2d                	je     461 <mutex_lock+0x41>
+ 434:	b8 02 00 00 00       	mov    $0x2,%eax
+ 439:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 43c:	85 c0                	test   %eax,%eax
+ 43e:	74 21                	je     461 <mutex_lock+0x41>
+ 440:	be 02 00 00 00       	mov    $0x2,%esi
+ 445:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 448:	83 ec 04             	sub    $0x4,%esp
+ 44b:	6a 02                	push   $0x2
+ 44d:	6a 00                	push   $0x0
+ 44f:	53                   	push   %ebx
+ 450:	e8 37 02 00 00       	call   68c <futex>
+ 455:	89 f0                	mov    %esi,%eax
+ 457:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 45a:	83 c4 10             	add    $0x10,%esp
+ 45d:	85 c0                	test   %eax,%eax
+ 45f:	75 e7                	jne    448 <mutex_lock+0x28>
+}
+ 461:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 464:	5b                   	pop    %ebx
+ 465:	5e                   	pop    %esi
+ 466:	5d                   	pop    %ebp
+ 467:	c3                   	ret
+ 468:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 46f:	90                   	nop
+
+00000470 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 470:	55                   	push   %ebp
+ 471:	31 c0                	xor    %eax,%eax
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	83 ec 08             	sub    $0x8,%esp
+ 478:	8b 55 08             	mov    0x8(%ebp),%edx
+ 47b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 47e:	83 f8 02             	cmp    $0x2,%eax
+ 481:	74 05                	je     488 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 483:	c9                   	leave
+ 484:	c3                   	ret
+ 485:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 488:	83 ec 04             	sub    $0x4,%esp
+ 48b:	6a 01                	push   $0x1
+ 48d:	6a 01                	push   $0x1
+ 48f:	52                   	push   %edx
+ 490:	e8 f7 01 00 00       	call   68c <futex>
+ 495:	83 c4 10             	add    $0x10,%esp
+}
+ 498:	c9                   	leave
+ 499:	c3                   	ret
+ 49a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000004a0 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 4a0:	55                   	push   %ebp
+ 4a1:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4ac:	5d                   	pop    %ebp
+ 4ad:	c3                   	ret
+ 4ae:	66 90                	xchg   %ax,%ax
+
+000004b0 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 4b0:	55                   	push   %ebp
+ 4b1:	31 c0                	xor    %eax,%eax
+ 4b3:	89 e5                	mov    %esp,%ebp
+ 4b5:	57                   	push   %edi
+ 4b6:	56                   	push   %esi
+ 4b7:	53                   	push   %ebx
+ 4b8:	83 ec 0c             	sub    $0xc,%esp
+ 4bb:	8b 75 08             	mov    0x8(%ebp),%esi
+ 4be:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 4c1:	8b 3e                	mov    (%esi),%edi
+ 4c3:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 4c6:	83 f8 02             	cmp    $0x2,%eax
+ 4c9:	74 4d                	je     518 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 4cb:	83 ec 04             	sub    $0x4,%esp
+ 4ce:	57                   	push   %edi
+ 4cf:	6a 00                	push   $0x0
+ 4d1:	56                   	push   %esi
+ 4d2:	e8 b5 01 00 00       	call   68c <futex>
+ 4d7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 4dc:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 4df:	83 c4 10             	add    $0x10,%esp
+ 4e2:	85 c0                	test   %eax,%eax
+ 4e4:	74 23                	je     509 <cond_wait+0x59>
+ 4e6:	be 02 00 00 00       	mov    $0x2,%esi
+ 4eb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 4ef:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 4f0:	83 ec 04             	sub    $0x4,%esp
+ 4f3:	6a 02                	push   $0x2
+ 4f5:	6a 00                	push   $0x0
+ 4f7:	53                   	push   %ebx
+ 4f8:	e8 8f 01 00 00       	call   68c <futex>
+ 4fd:	89 f0                	mov    %esi,%eax
+ 4ff:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 502:	83 c4 10             	add    $0x10,%esp
+ 505:	85 c0                	test   %eax,%eax
+ 507:	75 e7                	jne    4f0 <cond_wait+0x40>
+}
+ 509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 50c:	5b                   	pop    %ebx
+ 50d:	5e                   	pop    %esi
+ 50e:	5f                   	pop    %edi
+ 50f:	5d                   	pop    %ebp
+ 510:	c3                   	ret
+ 511:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 518:	83 ec 04             	sub    $0x4,%esp
+ 51b:	6a 01                	push   $0x1
+ 51d:	6a 01                	push   $0x1
+ 51f:	53                   	push   %ebx
+ 520:	e8 67 01 00 00       	call   68c <futex>
+ 525:	83 c4 10             	add    $0x10,%esp
+ 528:	eb a1                	jmp    4cb <cond_wait+0x1b>
+ 52a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000530 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+ 533:	83 ec 0c             	sub    $0xc,%esp
+ 536:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 539:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 53d:	6a 01                	push   $0x1
+ 53f:	6a 01                	push   $0x1
+ 541:	50                   	push   %eax
+ 542:	e8 45 01 00 00       	call   68c <futex>
+}
+ 547:	83 c4 10             	add    $0x10,%esp
+ 54a:	c9                   	leave
+ 54b:	c3                   	ret
+ 54c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000550 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 550:	55                   	push   %ebp
+ 551:	89 e5                	mov    %esp,%ebp
+ 553:	83 ec 0c             	sub    $0xc,%esp
+ 556:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 559:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 55d:	6a ff                	push   $0xffffffff
+ 55f:	6a 01                	push   $0x1
+ 561:	50                   	push   %eax
+ 562:	e8 25 01 00 00       	call   68c <futex>
+}
+ 567:	83 c4 10             	add    $0x10,%esp
+ 56a:	c9                   	leave
+ 56b:	c3                   	ret
+
+0000056c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 56c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <exit>:
+SYSCALL(exit)
+ 574:	b8 02 00 00 00       	mov    $0x2,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <wait>:
+SYSCALL(wait)
+ 57c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 581:	cd 40                	int    $0x40
+ 583:	c3                   	ret
+
+00000584 <pipe>:
+SYSCALL(pipe)
+ 584:	b8 04 00 00 00       	mov    $0x4,%eax
+ 589:	cd 40                	int    $0x40
+ 58b:	c3                   	ret
+
+0000058c <read>:
+SYSCALL(read)
+ 58c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 591:	cd 40                	int    $0x40
+ 593:	c3                   	ret
+
+00000594 <write>:
+SYSCALL(write)
+ 594:	b8 10 00 00 00       	mov    $0x10,%eax
+ 599:	cd 40                	int    $0x40
+ 59b:	c3                   	ret
+
+0000059c <close>:
+SYSCALL(close)
+ 59c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 5a1:	cd 40                	int    $0x40
+ 5a3:	c3                   	ret
+
+000005a4 <kill>:
+SYSCALL(kill)
+ 5a4:	b8 06 00 00 00       	mov    $0x6,%eax
+ 5a9:	cd 40                	int    $0x40
+ 5ab:	c3                   	ret
+
+000005ac <exec>:
+SYSCALL(exec)
+ 5ac:	b8 07 00 00 00       	mov    $0x7,%eax
+ 5b1:	cd 40                	int    $0x40
+ 5b3:	c3                   	ret
+
+000005b4 <open>:
+SYSCALL(open)
+ 5b4:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 5b9:	cd 40                	int    $0x40
+ 5bb:	c3                   	ret
+
+000005bc <mknod>:
+SYSCALL(mknod)
+ 5bc:	b8 11 00 00 00       	mov    $0x11,%eax
+ 5c1:	cd 40                	int    $0x40
+ 5c3:	c3                   	ret
+
+000005c4 <unlink>:
+SYSCALL(unlink)
+ 5c4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 5c9:	cd 40                	int    $0x40
+ 5cb:	c3                   	ret
+
+000005cc <fstat>:
+SYSCALL(fstat)
+ 5cc:	b8 08 00 00 00       	mov    $0x8,%eax
+ 5d1:	cd 40                	int    $0x40
+ 5d3:	c3                   	ret
+
+000005d4 <link>:
+SYSCALL(link)
+ 5d4:	b8 13 00 00 00       	mov    $0x13,%eax
+ 5d9:	cd 40                	int    $0x40
+ 5db:	c3                   	ret
+
+000005dc <mkdir>:
+SYSCALL(mkdir)
+ 5dc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 5e1:	cd 40                	int    $0x40
+ 5e3:	c3                   	ret
+
+000005e4 <chdir>:
+SYSCALL(chdir)
+ 5e4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 5e9:	cd 40                	int    $0x40
+ 5eb:	c3                   	ret
+
+000005ec <dup>:
+SYSCALL(dup)
+ 5ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 5f1:	cd 40                	int    $0x40
+ 5f3:	c3                   	ret
+
+000005f4 <getpid>:
+SYSCALL(getpid)
+ 5f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 5f9:	cd 40                	int    $0x40
+ 5fb:	c3                   	ret
+
+000005fc <sbrk>:
+SYSCALL(sbrk)
+ 5fc:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 601:	cd 40                	int    $0x40
+ 603:	c3                   	ret
+
+00000604 <sleep>:
+SYSCALL(sleep)
+ 604:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 609:	cd 40                	int    $0x40
+ 60b:	c3                   	ret
+
+0000060c <uptime>:
+SYSCALL(uptime)
+ 60c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 611:	cd 40                	int    $0x40
+ 613:	c3                   	ret
+
+00000614 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 614:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 619:	cd 40                	int    $0x40
+ 61b:	c3                   	ret
+
+0000061c <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 61c:	b8 19 00 00 00       	mov    $0x19,%eax
+ 621:	cd 40                	int    $0x40
+ 623:	c3                   	ret
+
+00000624 <wmap>:
+SYSCALL(wmap)
+ 624:	b8 16 00 00 00       	mov    $0x16,%eax
+ 629:	cd 40                	int    $0x40
+ 62b:	c3                   	ret
+
+0000062c <wunmap>:
+SYSCALL(wunmap)
+ 62c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 631:	cd 40                	int    $0x40
+ 633:	c3                   	ret
+
+00000634 <wremap>:
+SYSCALL(wremap)
+ 634:	b8 18 00 00 00       	mov    $0x18,%eax
+ 639:	cd 40                	int    $0x40
+ 63b:	c3                   	ret
+
+0000063c <wmlock>:
+SYSCALL(wmlock)
+ 63c:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 641:	cd 40                	int    $0x40
+ 643:	c3                   	ret
+
+00000644 <wmunlock>:
+SYSCALL(wmunlock)
+ 644:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 649:	cd 40                	int    $0x40
+ 64b:	c3                   	ret
+
+0000064c <wmapoff>:
+SYSCALL(wmapoff)
+ 64c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 651:	cd 40                	int    $0x40
+ 653:	c3                   	ret
+
+00000654 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 654:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 659:	cd 40                	int    $0x40
+ 65b:	c3                   	ret
+
+0000065c <setpriority>:
+SYSCALL(setpriority)
+ 65c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 661:	cd 40                	int    $0x40
+ 663:	c3                   	ret
+
+00000664 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 664:	b8 20 00 00 00       	mov    $0x20,%eax
+ 669:	cd 40                	int    $0x40
+ 66b:	c3                   	ret
+
+0000066c <settickets>:
+SYSCALL(settickets)
+ 66c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 671:	cd 40                	int    $0x40
+ 673:	c3                   	ret
+
+00000674 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 674:	b8 22 00 00 00       	mov    $0x22,%eax
+ 679:	cd 40                	int    $0x40
+ 67b:	c3                   	ret
+
+0000067c <clone>:
+SYSCALL(clone)
+ 67c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 681:	cd 40                	int    $0x40
+ 683:	c3                   	ret
+
+00000684 <join>:
+SYSCALL(join)
+ 684:	b8 24 00 00 00       	mov    $0x24,%eax
+ 689:	cd 40                	int    $0x40
+ 68b:	c3                   	ret
+
+0000068c <futex>:
+SYSCALL(futex)
+ 68c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 691:	cd 40                	int    $0x40
+ 693:	c3                   	ret
+
+00000694 <setaffinity>:
+SYSCALL(setaffinity)
+ 694:	b8 26 00 00 00       	mov    $0x26,%eax
+ 699:	cd 40                	int    $0x40
+ 69b:	c3                   	ret
+
+0000069c <getaffinity>:
+SYSCALL(getaffinity)
+ 69c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 6a1:	cd 40                	int    $0x40
+ 6a3:	c3                   	ret
+
+000006a4 <bcstat>:
+SYSCALL(bcstat)
+ 6a4:	b8 29 00 00 00       	mov    $0x29,%eax
+ 6a9:	cd 40                	int    $0x40
+ 6ab:	c3                   	ret
+
+000006ac <dropcache>:
+SYSCALL(dropcache)
+ 6ac:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 6b1:	cd 40                	int    $0x40
+ 6b3:	c3                   	ret
+
+000006b4 <setiosched>:
+SYSCALL(setiosched)
+ 6b4:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 6b9:	cd 40                	int    $0x40
+ 6bb:	c3                   	ret
+
+000006bc <iostat>:
+SYSCALL(iostat)
+ 6bc:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 6c1:	cd 40                	int    $0x40
+ 6c3:	c3                   	ret
+
+000006c4 <fsync>:
+SYSCALL(fsync)
+ 6c4:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 6c9:	cd 40                	int    $0x40
+ 6cb:	c3                   	ret
+
+000006cc <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 6cc:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 6cd:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 6d2:	cd 40                	int    $0x40
+ 6d4:	ff e1                	jmp    *%ecx
+ 6d6:	66 90                	xchg   %ax,%ax
+ 6d8:	66 90                	xchg   %ax,%ax
+ 6da:	66 90                	xchg   %ax,%ax
+ 6dc:	66 90                	xchg   %ax,%ax
+ 6de:	66 90                	xchg   %ax,%ax
+
+000006e0 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 6e0:	55                   	push   %ebp
+ 6e1:	89 e5                	mov    %esp,%ebp
+ 6e3:	57                   	push   %edi
+ 6e4:	56                   	push   %esi
+ 6e5:	53                   	push   %ebx
+ 6e6:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 6e8:	89 d1                	mov    %edx,%ecx
+{
+ 6ea:	83 ec 3c             	sub    $0x3c,%esp
+ 6ed:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 6f0:	85 d2                	test   %edx,%edx
+ 6f2:	0f 89 80 00 00 00    	jns    778 <printint+0x98>
+ 6f8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 6fc:	74 7a                	je     778 <printint+0x98>
+    x = -xx;
+ 6fe:	f7 d9                	neg    %ecx
+    neg = 1;
+ 700:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 705:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 708:	31 f6                	xor    %esi,%esi
+ 70a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 710:	89 c8                	mov    %ecx,%eax
+ 712:	31 d2                	xor    %edx,%edx
+ 714:	89 f7                	mov    %esi,%edi
+ 716:	f7 f3                	div    %ebx
+ 718:	8d 76 01             	lea    0x1(%esi),%esi
+ 71b:	0f b6 92 00 0d 00 00 	movzbl 0xd00(%edx),%edx
+ 722:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 726:	89 ca                	mov    %ecx,%edx
+ 728:	89 c1                	mov    %eax,%ecx
+ 72a:	39 da                	cmp    %ebx,%edx
+ 72c:	73 e2                	jae    710 <printint+0x30>
+  if(neg)
+ 72e:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 731:	85 c0                	test   %eax,%eax
+ 733:	74 07                	je     73c <printint+0x5c>
+    buf[i++] = '-';
+ 735:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 73a:	89 f7                	mov    %esi,%edi
+ 73c:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 73f:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 742:	01 df                	add    %ebx,%edi
+ 744:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 748:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 74b:	83 ec 04             	sub    $0x4,%esp
+ 74e:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 751:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 754:	6a 01                	push   $0x1
+ 756:	50                   	push   %eax
+ 757:	56                   	push   %esi
+ 758:	e8 37 fe ff ff       	call   594 <write>
+  while(--i >= 0)
+ 75d:	89 f8                	mov    %edi,%eax
+ 75f:	83 c4 10             	add    $0x10,%esp
+ 762:	83 ef 01             	sub    $0x1,%edi
+ 765:	39 d8                	cmp    %ebx,%eax
+ 767:	75 df                	jne    748 <printint+0x68>
+}
+ 769:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 76c:	5b                   	pop    %ebx
+ 76d:	5e                   	pop    %esi
+ 76e:	5f                   	pop    %edi
+ 76f:	5d                   	pop    %ebp
+ 770:	c3                   	ret
+ 771:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 778:	31 c0                	xor    %eax,%eax
+ 77a:	eb 89                	jmp    705 <printint+0x25>
+ 77c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000780 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	57                   	push   %edi
+ 784:	56                   	push   %esi
+ 785:	53                   	push   %ebx
+ 786:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 789:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 78c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 78f:	0f b6 1e             	movzbl (%esi),%ebx
+ 792:	83 c6 01             	add    $0x1,%esi
+ 795:	84 db                	test   %bl,%bl
+ 797:	74 67                	je     800 <printf+0x80>
+ 799:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 79c:	31 d2                	xor    %edx,%edx
+ 79e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 7a1:	eb 34                	jmp    7d7 <printf+0x57>
+ 7a3:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7a7:	90                   	nop
+ 7a8:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 7ab:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 7b0:	83 f8 25             	cmp    $0x25,%eax
+ 7b3:	74 18                	je     7cd <printf+0x4d>
+  write(fd, &c, 1);
+ 7b5:	83 ec 04             	sub    $0x4,%esp
+ 7b8:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 7bb:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7be:	6a 01                	push   $0x1
+ 7c0:	50                   	push   %eax
+ 7c1:	57                   	push   %edi
+ 7c2:	e8 cd fd ff ff       	call   594 <write>
+ 7c7:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 7ca:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 7cd:	0f b6 1e             	movzbl (%esi),%ebx
+ 7d0:	83 c6 01             	add    $0x1,%esi
+ 7d3:	84 db                	test   %bl,%bl
+ 7d5:	74 29                	je     800 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 7d7:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 7da:	85 d2                	test   %edx,%edx
+ 7dc:	74 ca                	je     7a8 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 7de:	83 fa 25             	cmp    $0x25,%edx
+ 7e1:	75 ea                	jne    7cd <printf+0x4d>
+      if(c == 'd'){
+ 7e3:	83 f8 25             	cmp    $0x25,%eax
+ 7e6:	0f 84 24 01 00 00    	je     910 <printf+0x190>
+ 7ec:	83 e8 63             	sub    $0x63,%eax
+ 7ef:	83 f8 15             	cmp    $0x15,%eax
+ 7f2:	77 1c                	ja     810 <printf+0x90>
+ 7f4:	ff 24 85 a8 0c 00 00 	jmp    *0xca8(,%eax,4)
+ 7fb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 7ff:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 800:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 803:	5b                   	pop    %ebx
+ 804:	5e                   	pop    %esi
+ 805:	5f                   	pop    %edi
+ 806:	5d                   	pop    %ebp
+ 807:	c3                   	ret
+ 808:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 80f:	90                   	nop
+  write(fd, &c, 1);
+ 810:	83 ec 04             	sub    $0x4,%esp
+ 813:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 816:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 81a:	6a 01                	push   $0x1
+ 81c:	52                   	push   %edx
+ 81d:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 820:	57                   	push   %edi
+ 821:	e8 6e fd ff ff       	call   594 <write>
+ 826:	83 c4 0c             	add    $0xc,%esp
+ 829:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 82c:	6a 01                	push   $0x1
+ 82e:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 831:	52                   	push   %edx
+ 832:	57                   	push   %edi
+ 833:	e8 5c fd ff ff       	call   594 <write>
+        putc(fd, c);
+ 838:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 83b:	31 d2                	xor    %edx,%edx
+ 83d:	eb 8e                	jmp    7cd <printf+0x4d>
+ 83f:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 840:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 843:	83 ec 0c             	sub    $0xc,%esp
+ 846:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 84b:	8b 13                	mov    (%ebx),%edx
+ 84d:	6a 00                	push   $0x0
+ 84f:	89 f8                	mov    %edi,%eax
+        ap++;
+ 851:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 854:	e8 87 fe ff ff       	call   6e0 <printint>
+        ap++;
+ 859:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 85c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 85f:	31 d2                	xor    %edx,%edx
+ 861:	e9 67 ff ff ff       	jmp    7cd <printf+0x4d>
+ 866:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 870:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 873:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 875:	83 c0 04             	add    $0x4,%eax
+ 878:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 87b:	85 db                	test   %ebx,%ebx
+ 87d:	0f 84 9d 00 00 00    	je     920 <printf+0x1a0>
+        while(*s != 0){
+ 883:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 886:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 888:	84 c0                	test   %al,%al
+ 88a:	0f 84 3d ff ff ff    	je     7cd <printf+0x4d>
+ 890:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 893:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 896:	89 de                	mov    %ebx,%esi
+ 898:	89 d3                	mov    %edx,%ebx
+ 89a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 8a0:	83 ec 04             	sub    $0x4,%esp
+ 8a3:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 8a6:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 8a9:	6a 01                	push   $0x1
+ 8ab:	53                   	push   %ebx
+ 8ac:	57                   	push   %edi
+ 8ad:	e8 e2 fc ff ff       	call   594 <write>
+        while(*s != 0){
+ 8b2:	0f b6 06             	movzbl (%esi),%eax
+ 8b5:	83 c4 10             	add    $0x10,%esp
+ 8b8:	84 c0                	test   %al,%al
+ 8ba:	75 e4                	jne    8a0 <printf+0x120>
+      state = 0;
+ 8bc:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 8bf:	31 d2                	xor    %edx,%edx
+ 8c1:	e9 07 ff ff ff       	jmp    7cd <printf+0x4d>
+ 8c6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 8cd:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 8d0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 8d3:	83 ec 0c             	sub    $0xc,%esp
+ 8d6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 8db:	8b 13                	mov    (%ebx),%edx
+ 8dd:	6a 01                	push   $0x1
+ 8df:	e9 6b ff ff ff       	jmp    84f <printf+0xcf>
+ 8e4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 8e8:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 8eb:	83 ec 04             	sub    $0x4,%esp
+ 8ee:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 8f1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 8f3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 8f6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 8f9:	6a 01                	push   $0x1
+ 8fb:	52                   	push   %edx
+ 8fc:	57                   	push   %edi
+ 8fd:	e8 92 fc ff ff       	call   594 <write>
+        ap++;
+ 902:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 905:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 908:	31 d2                	xor    %edx,%edx
+ 90a:	e9 be fe ff ff       	jmp    7cd <printf+0x4d>
+ 90f:	90                   	nop
+  write(fd, &c, 1);
+ 910:	83 ec 04             	sub    $0x4,%esp
+ 913:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 916:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 919:	6a 01                	push   $0x1
+ 91b:	e9 11 ff ff ff       	jmp    831 <printf+0xb1>
+ 920:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 925:	bb 9f 0c 00 00       	mov    $0xc9f,%ebx
+ 92a:	e9 61 ff ff ff       	jmp    890 <printf+0x110>
+ 92f:	90                   	nop
+
+00000930 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 930:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 931:	a1 e0 13 00 00       	mov    0x13e0,%eax
+{
+ 936:	89 e5                	mov    %esp,%ebp
+ 938:	57                   	push   %edi
+ 939:	56                   	push   %esi
+ 93a:	53                   	push   %ebx
+ 93b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 93e:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 941:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 948:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 94a:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 94c:	39 ca                	cmp    %ecx,%edx
+ 94e:	73 30                	jae    980 <free+0x50>
+ 950:	39 c1                	cmp    %eax,%ecx
+ 952:	72 04                	jb     958 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 954:	39 c2                	cmp    %eax,%edx
+ 956:	72 f0                	jb     948 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 958:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 95b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 95e:	39 f8                	cmp    %edi,%eax
+ 960:	74 2e                	je     990 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 962:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 965:	8b 42 04             	mov    0x4(%edx),%eax
+ 968:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 96b:	39 f1                	cmp    %esi,%ecx
+ 96d:	74 38                	je     9a7 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 96f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 971:	5b                   	pop    %ebx
+  freep = p;
+ 972:	89 15 e0 13 00 00    	mov    %edx,0x13e0
+}
+ 978:	5e                   	pop    %esi
+ 979:	5f                   	pop    %edi
+ 97a:	5d                   	pop    %ebp
+ 97b:	c3                   	ret
+ 97c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 980:	39 c1                	cmp    %eax,%ecx
+ 982:	72 d0                	jb     954 <free+0x24>
+ 984:	eb c2                	jmp    948 <free+0x18>
+ 986:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 98d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 990:	03 70 04             	add    0x4(%eax),%esi
+ 993:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 996:	8b 02                	mov    (%edx),%eax
+ 998:	8b 00                	mov    (%eax),%eax
+ 99a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 99d:	8b 42 04             	mov    0x4(%edx),%eax
+ 9a0:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 9a3:	39 f1                	cmp    %esi,%ecx
+ 9a5:	75 c8                	jne    96f <free+0x3f>
+    p->s.size += bp->s.size;
+ 9a7:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 9aa:	89 15 e0 13 00 00    	mov    %edx,0x13e0
+    p->s.size += bp->s.size;
+ 9b0:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 9b3:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 9b6:	89 0a                	mov    %ecx,(%edx)
+}
+ 9b8:	5b                   	pop    %ebx
+ 9b9:	5e                   	pop    %esi
+ 9ba:	5f                   	pop    %edi
+ 9bb:	5d                   	pop    %ebp
+ 9bc:	c3                   	ret
+ 9bd:	8d 76 00             	lea    0x0(%esi),%esi
+
+000009c0 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 9c0:	55                   	push   %ebp
+ 9c1:	89 e5                	mov    %esp,%ebp
+ 9c3:	57                   	push   %edi
+ 9c4:	56                   	push   %esi
+ 9c5:	53                   	push   %ebx
+ 9c6:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 9cc:	8b 15 e0 13 00 00    	mov    0x13e0,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 9d2:	8d 78 07             	lea    0x7(%eax),%edi
+ 9d5:	c1 ef 03             	shr    $0x3,%edi
+ 9d8:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 9db:	85 d2                	test   %edx,%edx
+ 9dd:	0f 84 8d 00 00 00    	je     a70 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 9e3:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 9e5:	8b 48 04             	mov    0x4(%eax),%ecx
+ 9e8:	39 f9                	cmp    %edi,%ecx
+ 9ea:	73 64                	jae    a50 <malloc+0x90>
+  if(nu < 4096)
+ 9ec:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 9f1:	39 df                	cmp    %ebx,%edi
+ 9f3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 9f6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 9fd:	eb 0a                	jmp    a09 <malloc+0x49>
+ 9ff:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ a00:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ a02:	8b 48 04             	mov    0x4(%eax),%ecx
+ a05:	39 f9                	cmp    %edi,%ecx
+ a07:	73 47                	jae    a50 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ a09:	89 c2                	mov    %eax,%edx
+ a0b:	39 05 e0 13 00 00    	cmp    %eax,0x13e0
+ a11:	75 ed                	jne    a00 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ a13:	83 ec 0c             	sub    $0xc,%esp
+ a16:	56                   	push   %esi
+ a17:	e8 e0 fb ff ff       	call   5fc <sbrk>
+  if(p == (char*)-1)
+ a1c:	83 c4 10             	add    $0x10,%esp
+ a1f:	83 f8 ff             	cmp    $0xffffffff,%eax
+ a22:	74 1c                	je     a40 <malloc+0x80>
+  hp->s.size = nu;
+ a24:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ a27:	83 ec 0c             	sub    $0xc,%esp
+ a2a:	83 c0 08             	add    $0x8,%eax
+ a2d:	50                   	push   %eax
+ a2e:	e8 fd fe ff ff       	call   930 <free>
+  return freep;
+ a33:	8b 15 e0 13 00 00    	mov    0x13e0,%edx
+      if((p = morecore(nunits)) == 0)
+ a39:	83 c4 10             	add    $0x10,%esp
+ a3c:	85 d2                	test   %edx,%edx
+ a3e:	75 c0                	jne    a00 <malloc+0x40>
+        return 0;
+  }
+}
+ a40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ a43:	31 c0                	xor    %eax,%eax
+}
+ a45:	5b                   	pop    %ebx
+ a46:	5e                   	pop    %esi
+ a47:	5f                   	pop    %edi
+ a48:	5d                   	pop    %ebp
+ a49:	c3                   	ret
+ a4a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ a50:	39 cf                	cmp    %ecx,%edi
+ a52:	74 4c                	je     aa0 <malloc+0xe0>
+        p->s.size -= nunits;
+ a54:	29 f9                	sub    %edi,%ecx
+ a56:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ a59:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ a5c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ a5f:	89 15 e0 13 00 00    	mov    %edx,0x13e0
+}
+ a65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ a68:	83 c0 08             	add    $0x8,%eax
+}
+ a6b:	5b                   	pop    %ebx
+ a6c:	5e                   	pop    %esi
+ a6d:	5f                   	pop    %edi
+ a6e:	5d                   	pop    %ebp
+ a6f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ a70:	c7 05 e0 13 00 00 e4 	movl   $0x13e4,0x13e0
+ a77:	13 00 00 
+    base.s.size = 0;
+ a7a:	b8 e4 13 00 00       	mov    $0x13e4,%eax
+    base.s.ptr = freep = prevp = &base;
+ a7f:	c7 05 e4 13 00 00 e4 	movl   $0x13e4,0x13e4
+ a86:	13 00 00 
+    base.s.size = 0;
+ a89:	c7 05 e8 13 00 00 00 	movl   $0x0,0x13e8
+ a90:	00 00 00 
+    if(p->s.size >= nunits){
+ a93:	e9 54 ff ff ff       	jmp    9ec <malloc+0x2c>
+ a98:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a9f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ aa0:	8b 08                	mov    (%eax),%ecx
+ aa2:	89 0a                	mov    %ecx,(%edx)
+ aa4:	eb b9                	jmp    a5f <malloc+0x9f>
+ aa6:	66 90                	xchg   %ax,%ax
+ aa8:	66 90                	xchg   %ax,%ax
+ aaa:	66 90                	xchg   %ax,%ax
+ aac:	66 90                	xchg   %ax,%ax
+ aae:	66 90                	xchg   %ax,%ax
+
+00000ab0 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ ab0:	55                   	push   %ebp
+ ab1:	89 e5                	mov    %esp,%ebp
+ ab3:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ab9:	c1 e0 04             	shl    $0x4,%eax
+ abc:	ff b0 2c 14 00 00    	push   0x142c(%eax)
+ ac2:	05 20 14 00 00       	add    $0x1420,%eax
+ ac7:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ aca:	e8 a5 fa ff ff       	call   574 <exit>
+ acf:	90                   	nop
+
+00000ad0 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ ad0:	55                   	push   %ebp
+ ad1:	89 e5                	mov    %esp,%ebp
+ ad3:	57                   	push   %edi
+ ad4:	56                   	push   %esi
+ ad5:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ ad6:	31 db                	xor    %ebx,%ebx
+{
+ ad8:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ adb:	68 00 14 00 00       	push   $0x1400
+ ae0:	e8 eb f8 ff ff       	call   3d0 <lock_acquire>
+ ae5:	83 c4 10             	add    $0x10,%esp
+ ae8:	eb 12                	jmp    afc <thread_create+0x2c>
+ aea:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ af0:	83 c3 01             	add    $0x1,%ebx
+ af3:	83 fb 40             	cmp    $0x40,%ebx
+ af6:	0f 84 c4 00 00 00    	je     bc0 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ afc:	89 de                	mov    %ebx,%esi
+ afe:	c1 e6 04             	shl    $0x4,%esi
+ b01:	8b 96 20 14 00 00    	mov    0x1420(%esi),%edx
+ b07:	85 d2                	test   %edx,%edx
+ b09:	75 e5                	jne    af0 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ b0b:	83 ec 0c             	sub    $0xc,%esp
+ b0e:	68 00 20 00 00       	push   $0x2000
+ b13:	e8 a8 fe ff ff       	call   9c0 <malloc>
+ b18:	83 c4 10             	add    $0x10,%esp
+ b1b:	85 c0                	test   %eax,%eax
+ b1d:	0f 84 9d 00 00 00    	je     bc0 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ b23:	89 86 24 14 00 00    	mov    %eax,0x1424(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ b29:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ b2e:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ b31:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ b36:	89 86 20 14 00 00    	mov    %eax,0x1420(%esi)
+  threads[i].fn = fn;
+ b3c:	8b 45 08             	mov    0x8(%ebp),%eax
+ b3f:	89 86 28 14 00 00    	mov    %eax,0x1428(%esi)
+  threads[i].arg = arg;
+ b45:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b48:	89 86 2c 14 00 00    	mov    %eax,0x142c(%esi)
+  lock_release(&threadslock);
+ b4e:	68 00 14 00 00       	push   $0x1400
+ b53:	e8 98 f8 ff ff       	call   3f0 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ b58:	83 c4 0c             	add    $0xc,%esp
+ b5b:	ff b6 20 14 00 00    	push   0x1420(%esi)
+ b61:	53                   	push   %ebx
+ b62:	68 b0 0a 00 00       	push   $0xab0
+ b67:	e8 10 fb ff ff       	call   67c <clone>
+ b6c:	83 c4 10             	add    $0x10,%esp
+ b6f:	85 c0                	test   %eax,%eax
+ b71:	78 0d                	js     b80 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ b73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ b76:	5b                   	pop    %ebx
+ b77:	5e                   	pop    %esi
+ b78:	5f                   	pop    %edi
+ b79:	5d                   	pop    %ebp
+ b7a:	c3                   	ret
+ b7b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ b7f:	90                   	nop
+    lock_acquire(&threadslock);
+ b80:	83 ec 0c             	sub    $0xc,%esp
+ b83:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ b86:	68 00 14 00 00       	push   $0x1400
+ b8b:	e8 40 f8 ff ff       	call   3d0 <lock_acquire>
+    free(threads[i].block);
+ b90:	58                   	pop    %eax
+ b91:	ff b6 24 14 00 00    	push   0x1424(%esi)
+ b97:	e8 94 fd ff ff       	call   930 <free>
+    threads[i].stack = 0;
+ b9c:	c7 86 20 14 00 00 00 	movl   $0x0,0x1420(%esi)
+ ba3:	00 00 00 
+    lock_release(&threadslock);
+ ba6:	c7 04 24 00 14 00 00 	movl   $0x1400,(%esp)
+ bad:	e8 3e f8 ff ff       	call   3f0 <lock_release>
+ bb2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ bb5:	83 c4 10             	add    $0x10,%esp
+}
+ bb8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ bbb:	5b                   	pop    %ebx
+ bbc:	5e                   	pop    %esi
+ bbd:	5f                   	pop    %edi
+ bbe:	5d                   	pop    %ebp
+ bbf:	c3                   	ret
+    lock_release(&threadslock);
+ bc0:	83 ec 0c             	sub    $0xc,%esp
+ bc3:	68 00 14 00 00       	push   $0x1400
+ bc8:	e8 23 f8 ff ff       	call   3f0 <lock_release>
+    return -1;
+ bcd:	83 c4 10             	add    $0x10,%esp
+ bd0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ bd5:	eb 9c                	jmp    b73 <thread_create+0xa3>
+ bd7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ bde:	66 90                	xchg   %ax,%ax
+
+00000be0 <thread_join>:
+
+int
+thread_join(void)
+{
+ be0:	55                   	push   %ebp
+ be1:	89 e5                	mov    %esp,%ebp
+ be3:	56                   	push   %esi
+ be4:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ be5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ be8:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ beb:	50                   	push   %eax
+ bec:	e8 93 fa ff ff       	call   684 <join>
+ bf1:	83 c4 10             	add    $0x10,%esp
+ bf4:	85 c0                	test   %eax,%eax
+ bf6:	78 69                	js     c61 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ bf8:	83 ec 0c             	sub    $0xc,%esp
+ bfb:	89 c6                	mov    %eax,%esi
+ bfd:	68 00 14 00 00       	push   $0x1400
+ c02:	e8 c9 f7 ff ff       	call   3d0 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ c07:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ c0a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ c0d:	31 c0                	xor    %eax,%eax
+ c0f:	eb 0f                	jmp    c20 <thread_join+0x40>
+ c11:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ c18:	83 c0 01             	add    $0x1,%eax
+ c1b:	83 f8 40             	cmp    $0x40,%eax
+ c1e:	74 28                	je     c48 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ c20:	89 c3                	mov    %eax,%ebx
+ c22:	c1 e3 04             	shl    $0x4,%ebx
+ c25:	39 93 20 14 00 00    	cmp    %edx,0x1420(%ebx)
+ c2b:	75 eb                	jne    c18 <thread_join+0x38>
+      free(threads[i].block);
+ c2d:	83 ec 0c             	sub    $0xc,%esp
+ c30:	ff b3 24 14 00 00    	push   0x1424(%ebx)
+ c36:	e8 f5 fc ff ff       	call   930 <free>
+      threads[i].stack = 0;
+      break;
+ c3b:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ c3e:	c7 83 20 14 00 00 00 	movl   $0x0,0x1420(%ebx)
+ c45:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ c48:	83 ec 0c             	sub    $0xc,%esp
+ c4b:	68 00 14 00 00       	push   $0x1400
+ c50:	e8 9b f7 ff ff       	call   3f0 <lock_release>
+  return pid;
+ c55:	83 c4 10             	add    $0x10,%esp
+}
+ c58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ c5b:	89 f0                	mov    %esi,%eax
+ c5d:	5b                   	pop    %ebx
+ c5e:	5e                   	pop    %esi
+ c5f:	5d                   	pop    %ebp
+ c60:	c3                   	ret
+    return -1;
+ c61:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ c66:	eb f0                	jmp    c58 <thread_join+0x78>
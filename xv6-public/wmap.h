@@ -6,6 +6,7 @@
 #define MAP_SHARED 0x0002
 #define MAP_ANONYMOUS 0x0004
 #define MAP_FIXED 0x0008
+#define MAP_POPULATE 0x0010 // Allocate (and read in) every page at wmap time
 // Flags for remap
 #define MREMAP_MAYMOVE 0x1
 
@@ -33,6 +34,8 @@ struct wmapinfo {
     // File-Backed Mapping Additions -BW
     struct file* fptr[MAX_WMMAP_INFO];     // File descriptor of the mapping
     int shared[MAX_WMMAP_INFO]; // Holds value if mapping is shared
+    int offset[MAX_WMMAP_INFO]; // File offset the mapping starts at
+    int mapid[MAX_WMMAP_INFO];  // wmap call the region comes from
 };
 
 #endif
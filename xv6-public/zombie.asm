@@ -0,0 +1,1769 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 06 04 00 00       	call   41c <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 90 04 00 00       	call   4b4 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 f8 03 00 00       	call   424 <exit>
+  2c:	66 90                	xchg   %ax,%ax
+  2e:	66 90                	xchg   %ax,%ax
+
+00000030 <strcpy>:
+#include "user.h"
+#include "x86.h"
+
+char*
+strcpy(char *s, const char *t)
+{
+  30:	55                   	push   %ebp
+  char *os;
+
+  os = s;
+  while((*s++ = *t++) != 0)
+  31:	31 c0                	xor    %eax,%eax
+{
+  33:	89 e5                	mov    %esp,%ebp
+  35:	53                   	push   %ebx
+  36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  3c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  while((*s++ = *t++) != 0)
+  40:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  44:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  47:	83 c0 01             	add    $0x1,%eax
+  4a:	84 d2                	test   %dl,%dl
+  4c:	75 f2                	jne    40 <strcpy+0x10>
+    ;
+  return os;
+}
+  4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  51:	89 c8                	mov    %ecx,%eax
+  53:	c9                   	leave
+  54:	c3                   	ret
+  55:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  5c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000060 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  60:	55                   	push   %ebp
+  61:	89 e5                	mov    %esp,%ebp
+  63:	53                   	push   %ebx
+  64:	8b 55 08             	mov    0x8(%ebp),%edx
+  67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  while(*p && *p == *q)
+  6a:	0f b6 02             	movzbl (%edx),%eax
+  6d:	84 c0                	test   %al,%al
+  6f:	75 17                	jne    88 <strcmp+0x28>
+  71:	eb 3a                	jmp    ad <strcmp+0x4d>
+  73:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  77:	90                   	nop
+  78:	0f b6 42 01          	movzbl 0x1(%edx),%eax
+    p++, q++;
+  7c:	83 c2 01             	add    $0x1,%edx
+  7f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  while(*p && *p == *q)
+  82:	84 c0                	test   %al,%al
+  84:	74 1a                	je     a0 <strcmp+0x40>
+    p++, q++;
+  86:	89 d9                	mov    %ebx,%ecx
+  while(*p && *p == *q)
+  88:	0f b6 19             	movzbl (%ecx),%ebx
+  8b:	38 c3                	cmp    %al,%bl
+  8d:	74 e9                	je     78 <strcmp+0x18>
+  return (uchar)*p - (uchar)*q;
+  8f:	29 d8                	sub    %ebx,%eax
+}
+  91:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  94:	c9                   	leave
+  95:	c3                   	ret
+  96:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  9d:	8d 76 00             	lea    0x0(%esi),%esi
+  return (uchar)*p - (uchar)*q;
+  a0:	0f b6 59 01          	movzbl 0x1(%ecx),%ebx
+  a4:	31 c0                	xor    %eax,%eax
+  a6:	29 d8                	sub    %ebx,%eax
+}
+  a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  ab:	c9                   	leave
+  ac:	c3                   	ret
+  return (uchar)*p - (uchar)*q;
+  ad:	0f b6 19             	movzbl (%ecx),%ebx
+  b0:	31 c0                	xor    %eax,%eax
+  b2:	eb db                	jmp    8f <strcmp+0x2f>
+  b4:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  bb:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+  bf:	90                   	nop
+
+000000c0 <strlen>:
+
+uint
+strlen(const char *s)
+{
+  c0:	55                   	push   %ebp
+  c1:	89 e5                	mov    %esp,%ebp
+  c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for(n = 0; s[n]; n++)
+  c6:	80 3a 00             	cmpb   $0x0,(%edx)
+  c9:	74 15                	je     e0 <strlen+0x20>
+  cb:	31 c0                	xor    %eax,%eax
+  cd:	8d 76 00             	lea    0x0(%esi),%esi
+  d0:	83 c0 01             	add    $0x1,%eax
+  d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  d7:	89 c1                	mov    %eax,%ecx
+  d9:	75 f5                	jne    d0 <strlen+0x10>
+    ;
+  return n;
+}
+  db:	89 c8                	mov    %ecx,%eax
+  dd:	5d                   	pop    %ebp
+  de:	c3                   	ret
+  df:	90                   	nop
+  for(n = 0; s[n]; n++)
+  e0:	31 c9                	xor    %ecx,%ecx
+}
+  e2:	5d                   	pop    %ebp
+  e3:	89 c8                	mov    %ecx,%eax
+  e5:	c3                   	ret
+  e6:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  ed:	8d 76 00             	lea    0x0(%esi),%esi
+
+000000f0 <memset>:
+
+void*
+memset(void *dst, int c, uint n)
+{
+  f0:	55                   	push   %ebp
+  f1:	89 e5                	mov    %esp,%ebp
+  f3:	57                   	push   %edi
+  f4:	8b 55 08             	mov    0x8(%ebp),%edx
+}
+
+static inline void
+stosb(void *addr, int data, int cnt)
+{
+  asm volatile("cld; rep stosb" :
+  f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  fd:	89 d7                	mov    %edx,%edi
+  ff:	fc                   	cld
+ 100:	f3 aa                	rep stos %al,%es:(%edi)
+  stosb(dst, c, n);
+  return dst;
+}
+ 102:	8b 7d fc             	mov    -0x4(%ebp),%edi
+ 105:	89 d0                	mov    %edx,%eax
+ 107:	c9                   	leave
+ 108:	c3                   	ret
+ 109:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+00000110 <strchr>:
+
+char*
+strchr(const char *s, char c)
+{
+ 110:	55                   	push   %ebp
+ 111:	89 e5                	mov    %esp,%ebp
+ 113:	8b 45 08             	mov    0x8(%ebp),%eax
+ 116:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for(; *s; s++)
+ 11a:	0f b6 10             	movzbl (%eax),%edx
+ 11d:	84 d2                	test   %dl,%dl
+ 11f:	75 12                	jne    133 <strchr+0x23>
+ 121:	eb 1d                	jmp    140 <strchr+0x30>
+ 123:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 127:	90                   	nop
+ 128:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+ 12c:	83 c0 01             	add    $0x1,%eax
+ 12f:	84 d2                	test   %dl,%dl
+ 131:	74 0d                	je     140 <strchr+0x30>
+    if(*s == c)
+ 133:	38 d1                	cmp    %dl,%cl
+ 135:	75 f1                	jne    128 <strchr+0x18>
+      return (char*)s;
+  return 0;
+}
+ 137:	5d                   	pop    %ebp
+ 138:	c3                   	ret
+ 139:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  return 0;
+ 140:	31 c0                	xor    %eax,%eax
+}
+ 142:	5d                   	pop    %ebp
+ 143:	c3                   	ret
+ 144:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 14b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 14f:	90                   	nop
+
+00000150 <gets>:
+
+char*
+gets(char *buf, int max)
+{
+ 150:	55                   	push   %ebp
+ 151:	89 e5                	mov    %esp,%ebp
+ 153:	57                   	push   %edi
+ 154:	56                   	push   %esi
+  int i, cc;
+  char c;
+
+  for(i=0; i+1 < max; ){
+    cc = read(0, &c, 1);
+ 155:	8d 75 e7             	lea    -0x19(%ebp),%esi
+{
+ 158:	53                   	push   %ebx
+  for(i=0; i+1 < max; ){
+ 159:	31 db                	xor    %ebx,%ebx
+{
+ 15b:	83 ec 1c             	sub    $0x1c,%esp
+  for(i=0; i+1 < max; ){
+ 15e:	eb 27                	jmp    187 <gets+0x37>
+    cc = read(0, &c, 1);
+ 160:	83 ec 04             	sub    $0x4,%esp
+ 163:	6a 01                	push   $0x1
+ 165:	56                   	push   %esi
+ 166:	6a 00                	push   $0x0
+ 168:	e8 cf 02 00 00       	call   43c <read>
+    if(cc < 1)
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	85 c0                	test   %eax,%eax
+ 172:	7e 1d                	jle    191 <gets+0x41>
+      break;
+    buf[i++] = c;
+ 174:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+ 178:	8b 55 08             	mov    0x8(%ebp),%edx
+ 17b:	88 44 1a ff          	mov    %al,-0x1(%edx,%ebx,1)
+    if(c == '\n' || c == '\r')
+ 17f:	3c 0a                	cmp    $0xa,%al
+ 181:	74 10                	je     193 <gets+0x43>
+ 183:	3c 0d                	cmp    $0xd,%al
+ 185:	74 0c                	je     193 <gets+0x43>
+  for(i=0; i+1 < max; ){
+ 187:	89 df                	mov    %ebx,%edi
+ 189:	83 c3 01             	add    $0x1,%ebx
+ 18c:	3b 5d 0c             	cmp    0xc(%ebp),%ebx
+ 18f:	7c cf                	jl     160 <gets+0x10>
+ 191:	89 fb                	mov    %edi,%ebx
+      break;
+  }
+  buf[i] = '\0';
+ 193:	8b 45 08             	mov    0x8(%ebp),%eax
+ 196:	c6 04 18 00          	movb   $0x0,(%eax,%ebx,1)
+  return buf;
+}
+ 19a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 19d:	5b                   	pop    %ebx
+ 19e:	5e                   	pop    %esi
+ 19f:	5f                   	pop    %edi
+ 1a0:	5d                   	pop    %ebp
+ 1a1:	c3                   	ret
+ 1a2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1a9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000001b0 <stat>:
+
+int
+stat(const char *n, struct stat *st)
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+ 1b3:	56                   	push   %esi
+ 1b4:	53                   	push   %ebx
+  int fd;
+  int r;
+
+  fd = open(n, O_RDONLY);
+ 1b5:	83 ec 08             	sub    $0x8,%esp
+ 1b8:	6a 00                	push   $0x0
+ 1ba:	ff 75 08             	push   0x8(%ebp)
+ 1bd:	e8 a2 02 00 00       	call   464 <open>
+  if(fd < 0)
+ 1c2:	83 c4 10             	add    $0x10,%esp
+ 1c5:	85 c0                	test   %eax,%eax
+ 1c7:	78 27                	js     1f0 <stat+0x40>
+    return -1;
+  r = fstat(fd, st);
+ 1c9:	83 ec 08             	sub    $0x8,%esp
+ 1cc:	ff 75 0c             	push   0xc(%ebp)
+ 1cf:	89 c3                	mov    %eax,%ebx
+ 1d1:	50                   	push   %eax
+ 1d2:	e8 a5 02 00 00       	call   47c <fstat>
+  close(fd);
+ 1d7:	89 1c 24             	mov    %ebx,(%esp)
+  r = fstat(fd, st);
+ 1da:	89 c6                	mov    %eax,%esi
+  close(fd);
+ 1dc:	e8 6b 02 00 00       	call   44c <close>
+  return r;
+ 1e1:	83 c4 10             	add    $0x10,%esp
+}
+ 1e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 1e7:	89 f0                	mov    %esi,%eax
+ 1e9:	5b                   	pop    %ebx
+ 1ea:	5e                   	pop    %esi
+ 1eb:	5d                   	pop    %ebp
+ 1ec:	c3                   	ret
+ 1ed:	8d 76 00             	lea    0x0(%esi),%esi
+    return -1;
+ 1f0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ 1f5:	eb ed                	jmp    1e4 <stat+0x34>
+ 1f7:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 1fe:	66 90                	xchg   %ax,%ax
+
+00000200 <atoi>:
+
+int
+atoi(const char *s)
+{
+ 200:	55                   	push   %ebp
+ 201:	89 e5                	mov    %esp,%ebp
+ 203:	53                   	push   %ebx
+ 204:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  n = 0;
+  while('0' <= *s && *s <= '9')
+ 207:	0f be 02             	movsbl (%edx),%eax
+ 20a:	8d 48 d0             	lea    -0x30(%eax),%ecx
+ 20d:	80 f9 09             	cmp    $0x9,%cl
+  n = 0;
+ 210:	b9 00 00 00 00       	mov    $0x0,%ecx
+  while('0' <= *s && *s <= '9')
+ 215:	77 1e                	ja     235 <atoi+0x35>
+ 217:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 21e:	66 90                	xchg   %ax,%ax
+    n = n*10 + *s++ - '0';
+ 220:	83 c2 01             	add    $0x1,%edx
+ 223:	8d 0c 89             	lea    (%ecx,%ecx,4),%ecx
+ 226:	8d 4c 48 d0          	lea    -0x30(%eax,%ecx,2),%ecx
+  while('0' <= *s && *s <= '9')
+ 22a:	0f be 02             	movsbl (%edx),%eax
+ 22d:	8d 58 d0             	lea    -0x30(%eax),%ebx
+ 230:	80 fb 09             	cmp    $0x9,%bl
+ 233:	76 eb                	jbe    220 <atoi+0x20>
+  return n;
+}
+ 235:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 238:	89 c8                	mov    %ecx,%eax
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+ 23c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000240 <memmove>:
+
+void*
+memmove(void *vdst, const void *vsrc, int n)
+{
+ 240:	55                   	push   %ebp
+ 241:	89 e5                	mov    %esp,%ebp
+ 243:	57                   	push   %edi
+ 244:	56                   	push   %esi
+ 245:	8b 45 10             	mov    0x10(%ebp),%eax
+ 248:	8b 55 08             	mov    0x8(%ebp),%edx
+ 24b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  char *dst;
+  const char *src;
+
+  dst = vdst;
+  src = vsrc;
+  while(n-- > 0)
+ 24e:	85 c0                	test   %eax,%eax
+ 250:	7e 13                	jle    265 <memmove+0x25>
+ 252:	01 d0                	add    %edx,%eax
+  dst = vdst;
+ 254:	89 d7                	mov    %edx,%edi
+ 256:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 25d:	8d 76 00             	lea    0x0(%esi),%esi
+    *dst++ = *src++;
+ 260:	a4                   	movsb  %ds:(%esi),%es:(%edi)
+  while(n-- > 0)
+ 261:	39 f8                	cmp    %edi,%eax
+ 263:	75 fb                	jne    260 <memmove+0x20>
+  return vdst;
+}
+ 265:	5e                   	pop    %esi
+ 266:	89 d0                	mov    %edx,%eax
+ 268:	5f                   	pop    %edi
+ 269:	5d                   	pop    %ebp
+ 26a:	c3                   	ret
+ 26b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 26f:	90                   	nop
+
+00000270 <lock_init>:
+
+// Spinlocks for threads sharing an address space.
+void
+lock_init(lock_t *lk)
+{
+ 270:	55                   	push   %ebp
+ 271:	89 e5                	mov    %esp,%ebp
+  lk->locked = 0;
+ 273:	8b 45 08             	mov    0x8(%ebp),%eax
+ 276:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 27c:	5d                   	pop    %ebp
+ 27d:	c3                   	ret
+ 27e:	66 90                	xchg   %ax,%ax
+
+00000280 <lock_acquire>:
+
+void
+lock_acquire(lock_t *lk)
+{
+ 280:	55                   	push   %ebp
+xchg(volatile uint *addr, uint newval)
+{
+  uint result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile("lock; xchgl %0, %1" :
+ 281:	b9 01 00 00 00       	mov    $0x1,%ecx
+ 286:	89 e5                	mov    %esp,%ebp
+ 288:	8b 55 08             	mov    0x8(%ebp),%edx
+ 28b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 28f:	90                   	nop
+ 290:	89 c8                	mov    %ecx,%eax
+ 292:	f0 87 02             	lock xchg %eax,(%edx)
+  // The xchg is atomic.
+  while(xchg(&lk->locked, 1) != 0)
+ 295:	85 c0                	test   %eax,%eax
+ 297:	75 f7                	jne    290 <lock_acquire+0x10>
+    ;
+  // Keep the critical section's loads and stores after this point.
+  __sync_synchronize();
+ 299:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+}
+ 29e:	5d                   	pop    %ebp
+ 29f:	c3                   	ret
+
+000002a0 <lock_release>:
+
+void
+lock_release(lock_t *lk)
+{
+ 2a0:	55                   	push   %ebp
+ 2a1:	31 c0                	xor    %eax,%eax
+ 2a3:	89 e5                	mov    %esp,%ebp
+ 2a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  __sync_synchronize();
+ 2a8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+ 2ad:	f0 87 02             	lock xchg %eax,(%edx)
+  xchg(&lk->locked, 0);
+}
+ 2b0:	5d                   	pop    %ebp
+ 2b1:	c3                   	ret
+ 2b2:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 2b9:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+
+000002c0 <mutex_init>:
+// Sleeping mutex on futex.  state is 0 when free, 1 when held
+// and 2 when held with possible waiters; unlock only enters the
+// kernel in the last case.
+void
+mutex_init(mutex_t *m)
+{
+ 2c0:	55                   	push   %ebp
+ 2c1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2cc:	5d                   	pop    %ebp
+ 2cd:	c3                   	ret
+ 2ce:	66 90                	xchg   %ax,%ax
+
+000002d0 <mutex_lock>:
+
+void
+mutex_lock(mutex_t *m)
+{
+ 2d0:	55                   	push   %ebp
+ 2d1:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2d6:	89 e5                	mov    %esp,%ebp
+ 2d8:	56                   	push   %esi
+ 2d9:	53                   	push   %ebx
+ 2da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 2dd:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 1) == 0)
+ 2e0:	85 c0                	test   %eax,%eax
+ 2e2:	74 2d                	je     311 <mutex_lock+0x41>
+ 2e4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 2e9:	f0 87 03             	lock xchg %eax,(%ebx)
+    return;
+  // Contended.  Mark the mutex as having waiters before every
+  // sleep; if the xchg above overwrote a 2, this restores it.
+  while(xchg(&m->state, 2) != 0)
+ 2ec:	85 c0                	test   %eax,%eax
+ 2ee:	74 21                	je     311 <mutex_lock+0x41>
+ 2f0:	be 02 00 00 00       	mov    $0x2,%esi
+ 2f5:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAIT, 2);
+ 2f8:	83 ec 04             	sub    $0x4,%esp
+ 2fb:	6a 02                	push   $0x2
+ 2fd:	6a 00                	push   $0x0
+ 2ff:	53                   	push   %ebx
+ 300:	e8 37 02 00 00       	call   53c <futex>
+ 305:	89 f0                	mov    %esi,%eax
+ 307:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 30a:	83 c4 10             	add    $0x10,%esp
+ 30d:	85 c0                	test   %eax,%eax
+ 30f:	75 e7                	jne    2f8 <mutex_lock+0x28>
+}
+ 311:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ 314:	5b                   	pop    %ebx
+ 315:	5e                   	pop    %esi
+ 316:	5d                   	pop    %ebp
+ 317:	c3                   	ret
+ 318:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 31f:	90                   	nop
+
+00000320 <mutex_unlock>:
+
+void
+mutex_unlock(mutex_t *m)
+{
+ 320:	55                   	push   %ebp
+ 321:	31 c0                	xor    %eax,%eax
+ 323:	89 e5                	mov    %esp,%ebp
+ 325:	83 ec 08             	sub    $0x8,%esp
+ 328:	8b 55 08             	mov    0x8(%ebp),%edx
+ 32b:	f0 87 02             	lock xchg %eax,(%edx)
+  if(xchg(&m->state, 0) == 2)
+ 32e:	83 f8 02             	cmp    $0x2,%eax
+ 331:	74 05                	je     338 <mutex_unlock+0x18>
+    futex(&m->state, FUTEX_WAKE, 1);
+}
+ 333:	c9                   	leave
+ 334:	c3                   	ret
+ 335:	8d 76 00             	lea    0x0(%esi),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 338:	83 ec 04             	sub    $0x4,%esp
+ 33b:	6a 01                	push   $0x1
+ 33d:	6a 01                	push   $0x1
+ 33f:	52                   	push   %edx
+ 340:	e8 f7 01 00 00       	call   53c <futex>
+ 345:	83 c4 10             	add    $0x10,%esp
+}
+ 348:	c9                   	leave
+ 349:	c3                   	ret
+ 34a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+00000350 <cond_init>:
+// unchanged since it read it, so a signal between mutex_unlock and
+// the sleep is not lost.  Wakeups may be spurious; callers recheck
+// their condition in a loop.
+void
+cond_init(cond_t *c)
+{
+ 350:	55                   	push   %ebp
+ 351:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 35c:	5d                   	pop    %ebp
+ 35d:	c3                   	ret
+ 35e:	66 90                	xchg   %ax,%ax
+
+00000360 <cond_wait>:
+
+void
+cond_wait(cond_t *c, mutex_t *m)
+{
+ 360:	55                   	push   %ebp
+ 361:	31 c0                	xor    %eax,%eax
+ 363:	89 e5                	mov    %esp,%ebp
+ 365:	57                   	push   %edi
+ 366:	56                   	push   %esi
+ 367:	53                   	push   %ebx
+ 368:	83 ec 0c             	sub    $0xc,%esp
+ 36b:	8b 75 08             	mov    0x8(%ebp),%esi
+ 36e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint seq;
+
+  seq = c->seq;
+ 371:	8b 3e                	mov    (%esi),%edi
+ 373:	f0 87 03             	lock xchg %eax,(%ebx)
+  if(xchg(&m->state, 0) == 2)
+ 376:	83 f8 02             	cmp    $0x2,%eax
+ 379:	74 4d                	je     3c8 <cond_wait+0x68>
+  mutex_unlock(m);
+  futex(&c->seq, FUTEX_WAIT, seq);
+ 37b:	83 ec 04             	sub    $0x4,%esp
+ 37e:	57                   	push   %edi
+ 37f:	6a 00                	push   $0x0
+ 381:	56                   	push   %esi
+ 382:	e8 b5 01 00 00       	call   53c <futex>
+ 387:	b8 02 00 00 00       	mov    $0x2,%eax
+ 38c:	f0 87 03             	lock xchg %eax,(%ebx)
+  // Others may be waiting too, so take m as contended.
+  while(xchg(&m->state, 2) != 0)
+ 38f:	83 c4 10             	add    $0x10,%esp
+ 392:	85 c0                	test   %eax,%eax
+ 394:	74 23                	je     3b9 <cond_wait+0x59>
+ 396:	be 02 00 00 00       	mov    $0x2,%esi
+ 39b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 39f:	90                   	nop
+    futex(&m->state, FUTEX_WAIT, 2);
+ 3a0:	83 ec 04             	sub    $0x4,%esp
+ 3a3:	6a 02                	push   $0x2
+ 3a5:	6a 00                	push   $0x0
+ 3a7:	53                   	push   %ebx
+ 3a8:	e8 8f 01 00 00       	call   53c <futex>
+ 3ad:	89 f0                	mov    %esi,%eax
+ 3af:	f0 87 03             	lock xchg %eax,(%ebx)
+  while(xchg(&m->state, 2) != 0)
+ 3b2:	83 c4 10             	add    $0x10,%esp
+ 3b5:	85 c0                	test   %eax,%eax
+ 3b7:	75 e7                	jne    3a0 <cond_wait+0x40>
+}
+ 3b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 3bc:	5b                   	pop    %ebx
+ 3bd:	5e                   	pop    %esi
+ 3be:	5f                   	pop    %edi
+ 3bf:	5d                   	pop    %ebp
+ 3c0:	c3                   	ret
+ 3c1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+    futex(&m->state, FUTEX_WAKE, 1);
+ 3c8:	83 ec 04             	sub    $0x4,%esp
+ 3cb:	6a 01                	push   $0x1
+ 3cd:	6a 01                	push   $0x1
+ 3cf:	53                   	push   %ebx
+ 3d0:	e8 67 01 00 00       	call   53c <futex>
+ 3d5:	83 c4 10             	add    $0x10,%esp
+ 3d8:	eb a1                	jmp    37b <cond_wait+0x1b>
+ 3da:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+
+000003e0 <cond_signal>:
+
+void
+cond_signal(cond_t *c)
+{
+ 3e0:	55                   	push   %ebp
+ 3e1:	89 e5                	mov    %esp,%ebp
+ 3e3:	83 ec 0c             	sub    $0xc,%esp
+ 3e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 3e9:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, 1);
+ 3ed:	6a 01                	push   $0x1
+ 3ef:	6a 01                	push   $0x1
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 45 01 00 00       	call   53c <futex>
+}
+ 3f7:	83 c4 10             	add    $0x10,%esp
+ 3fa:	c9                   	leave
+ 3fb:	c3                   	ret
+ 3fc:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000400 <cond_broadcast>:
+
+void
+cond_broadcast(cond_t *c)
+{
+ 400:	55                   	push   %ebp
+ 401:	89 e5                	mov    %esp,%ebp
+ 403:	83 ec 0c             	sub    $0xc,%esp
+ 406:	8b 45 08             	mov    0x8(%ebp),%eax
+  __sync_fetch_and_add(&c->seq, 1);
+ 409:	f0 83 00 01          	lock addl $0x1,(%eax)
+  futex(&c->seq, FUTEX_WAKE, -1);  // all of them
+ 40d:	6a ff                	push   $0xffffffff
+ 40f:	6a 01                	push   $0x1
+ 411:	50                   	push   %eax
+ 412:	e8 25 01 00 00       	call   53c <futex>
+}
+ 417:	83 c4 10             	add    $0x10,%esp
+ 41a:	c9                   	leave
+ 41b:	c3                   	ret
+
+0000041c <fork>:
+  name: \
+    movl $SYS_ ## name, %eax; \
+    int $T_SYSCALL; \
+    ret
+
+SYSCALL(fork)
+ 41c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 421:	cd 40                	int    $0x40
+ 423:	c3                   	ret
+
+00000424 <exit>:
+SYSCALL(exit)
+ 424:	b8 02 00 00 00       	mov    $0x2,%eax
+ 429:	cd 40                	int    $0x40
+ 42b:	c3                   	ret
+
+0000042c <wait>:
+SYSCALL(wait)
+ 42c:	b8 03 00 00 00       	mov    $0x3,%eax
+ 431:	cd 40                	int    $0x40
+ 433:	c3                   	ret
+
+00000434 <pipe>:
+SYSCALL(pipe)
+ 434:	b8 04 00 00 00       	mov    $0x4,%eax
+ 439:	cd 40                	int    $0x40
+ 43b:	c3                   	ret
+
+0000043c <read>:
+SYSCALL(read)
+ 43c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 441:	cd 40                	int    $0x40
+ 443:	c3                   	ret
+
+00000444 <write>:
+SYSCALL(write)
+ 444:	b8 10 00 00 00       	mov    $0x10,%eax
+ 449:	cd 40                	int    $0x40
+ 44b:	c3                   	ret
+
+0000044c <close>:
+SYSCALL(close)
+ 44c:	b8 15 00 00 00       	mov    $0x15,%eax
+ 451:	cd 40                	int    $0x40
+ 453:	c3                   	ret
+
+00000454 <kill>:
+SYSCALL(kill)
+ 454:	b8 06 00 00 00       	mov    $0x6,%eax
+ 459:	cd 40                	int    $0x40
+ 45b:	c3                   	ret
+
+0000045c <exec>:
+SYSCALL(exec)
+ 45c:	b8 07 00 00 00       	mov    $0x7,%eax
+ 461:	cd 40                	int    $0x40
+ 463:	c3                   	ret
+
+00000464 <open>:
+SYSCALL(open)
+ 464:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 469:	cd 40                	int    $0x40
+ 46b:	c3                   	ret
+
+0000046c <mknod>:
+SYSCALL(mknod)
+ 46c:	b8 11 00 00 00       	mov    $0x11,%eax
+ 471:	cd 40                	int    $0x40
+ 473:	c3                   	ret
+
+00000474 <unlink>:
+SYSCALL(unlink)
+ 474:	b8 12 00 00 00       	mov    $0x12,%eax
+ 479:	cd 40                	int    $0x40
+ 47b:	c3                   	ret
+
+0000047c <fstat>:
+SYSCALL(fstat)
+ 47c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 481:	cd 40                	int    $0x40
+ 483:	c3                   	ret
+
+00000484 <link>:
+SYSCALL(link)
+ 484:	b8 13 00 00 00       	mov    $0x13,%eax
+ 489:	cd 40                	int    $0x40
+ 48b:	c3                   	ret
+
+0000048c <mkdir>:
+SYSCALL(mkdir)
+ 48c:	b8 14 00 00 00       	mov    $0x14,%eax
+ 491:	cd 40                	int    $0x40
+ 493:	c3                   	ret
+
+00000494 <chdir>:
+SYSCALL(chdir)
+ 494:	b8 09 00 00 00       	mov    $0x9,%eax
+ 499:	cd 40                	int    $0x40
+ 49b:	c3                   	ret
+
+0000049c <dup>:
+SYSCALL(dup)
+ 49c:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 4a1:	cd 40                	int    $0x40
+ 4a3:	c3                   	ret
+
+000004a4 <getpid>:
+SYSCALL(getpid)
+ 4a4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 4a9:	cd 40                	int    $0x40
+ 4ab:	c3                   	ret
+
+000004ac <sbrk>:
+SYSCALL(sbrk)
+ 4ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 4b1:	cd 40                	int    $0x40
+ 4b3:	c3                   	ret
+
+000004b4 <sleep>:
+SYSCALL(sleep)
+ 4b4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 4b9:	cd 40                	int    $0x40
+ 4bb:	c3                   	ret
+
+000004bc <uptime>:
+SYSCALL(uptime)
+ 4bc:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 4c1:	cd 40                	int    $0x40
+ 4c3:	c3                   	ret
+
+000004c4 <getpgdirinfo>:
+SYSCALL(getpgdirinfo)
+ 4c4:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 4c9:	cd 40                	int    $0x40
+ 4cb:	c3                   	ret
+
+000004cc <getwmapinfo>:
+SYSCALL(getwmapinfo)
+ 4cc:	b8 19 00 00 00       	mov    $0x19,%eax
+ 4d1:	cd 40                	int    $0x40
+ 4d3:	c3                   	ret
+
+000004d4 <wmap>:
+SYSCALL(wmap)
+ 4d4:	b8 16 00 00 00       	mov    $0x16,%eax
+ 4d9:	cd 40                	int    $0x40
+ 4db:	c3                   	ret
+
+000004dc <wunmap>:
+SYSCALL(wunmap)
+ 4dc:	b8 17 00 00 00       	mov    $0x17,%eax
+ 4e1:	cd 40                	int    $0x40
+ 4e3:	c3                   	ret
+
+000004e4 <wremap>:
+SYSCALL(wremap)
+ 4e4:	b8 18 00 00 00       	mov    $0x18,%eax
+ 4e9:	cd 40                	int    $0x40
+ 4eb:	c3                   	ret
+
+000004ec <wmlock>:
+SYSCALL(wmlock)
+ 4ec:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 4f1:	cd 40                	int    $0x40
+ 4f3:	c3                   	ret
+
+000004f4 <wmunlock>:
+SYSCALL(wmunlock)
+ 4f4:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 4f9:	cd 40                	int    $0x40
+ 4fb:	c3                   	ret
+
+000004fc <wmapoff>:
+SYSCALL(wmapoff)
+ 4fc:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 501:	cd 40                	int    $0x40
+ 503:	c3                   	ret
+
+00000504 <wunmaprange>:
+SYSCALL(wunmaprange)
+ 504:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 509:	cd 40                	int    $0x40
+ 50b:	c3                   	ret
+
+0000050c <setpriority>:
+SYSCALL(setpriority)
+ 50c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 511:	cd 40                	int    $0x40
+ 513:	c3                   	ret
+
+00000514 <getschedinfo>:
+SYSCALL(getschedinfo)
+ 514:	b8 20 00 00 00       	mov    $0x20,%eax
+ 519:	cd 40                	int    $0x40
+ 51b:	c3                   	ret
+
+0000051c <settickets>:
+SYSCALL(settickets)
+ 51c:	b8 21 00 00 00       	mov    $0x21,%eax
+ 521:	cd 40                	int    $0x40
+ 523:	c3                   	ret
+
+00000524 <setschedpolicy>:
+SYSCALL(setschedpolicy)
+ 524:	b8 22 00 00 00       	mov    $0x22,%eax
+ 529:	cd 40                	int    $0x40
+ 52b:	c3                   	ret
+
+0000052c <clone>:
+SYSCALL(clone)
+ 52c:	b8 23 00 00 00       	mov    $0x23,%eax
+ 531:	cd 40                	int    $0x40
+ 533:	c3                   	ret
+
+00000534 <join>:
+SYSCALL(join)
+ 534:	b8 24 00 00 00       	mov    $0x24,%eax
+ 539:	cd 40                	int    $0x40
+ 53b:	c3                   	ret
+
+0000053c <futex>:
+SYSCALL(futex)
+ 53c:	b8 25 00 00 00       	mov    $0x25,%eax
+ 541:	cd 40                	int    $0x40
+ 543:	c3                   	ret
+
+00000544 <setaffinity>:
+SYSCALL(setaffinity)
+ 544:	b8 26 00 00 00       	mov    $0x26,%eax
+ 549:	cd 40                	int    $0x40
+ 54b:	c3                   	ret
+
+0000054c <getaffinity>:
+SYSCALL(getaffinity)
+ 54c:	b8 27 00 00 00       	mov    $0x27,%eax
+ 551:	cd 40                	int    $0x40
+ 553:	c3                   	ret
+
+00000554 <bcstat>:
+SYSCALL(bcstat)
+ 554:	b8 29 00 00 00       	mov    $0x29,%eax
+ 559:	cd 40                	int    $0x40
+ 55b:	c3                   	ret
+
+0000055c <dropcache>:
+SYSCALL(dropcache)
+ 55c:	b8 2a 00 00 00       	mov    $0x2a,%eax
+ 561:	cd 40                	int    $0x40
+ 563:	c3                   	ret
+
+00000564 <setiosched>:
+SYSCALL(setiosched)
+ 564:	b8 2b 00 00 00       	mov    $0x2b,%eax
+ 569:	cd 40                	int    $0x40
+ 56b:	c3                   	ret
+
+0000056c <iostat>:
+SYSCALL(iostat)
+ 56c:	b8 2c 00 00 00       	mov    $0x2c,%eax
+ 571:	cd 40                	int    $0x40
+ 573:	c3                   	ret
+
+00000574 <fsync>:
+SYSCALL(fsync)
+ 574:	b8 2d 00 00 00       	mov    $0x2d,%eax
+ 579:	cd 40                	int    $0x40
+ 57b:	c3                   	ret
+
+0000057c <vfork>:
+# The vfork child returns first and goes on to make calls that reuse
+# the stack slot of our return address, so keep it in %ecx instead;
+# the trapframe gives both parent and child their %ecx back.
+.globl vfork
+vfork:
+  popl %ecx
+ 57c:	59                   	pop    %ecx
+  movl $SYS_vfork, %eax
+ 57d:	b8 28 00 00 00       	mov    $0x28,%eax
+  int $T_SYSCALL
+ 582:	cd 40                	int    $0x40
+ 584:	ff e1                	jmp    *%ecx
+ 586:	66 90                	xchg   %ax,%ax
+ 588:	66 90                	xchg   %ax,%ax
+ 58a:	66 90                	xchg   %ax,%ax
+ 58c:	66 90                	xchg   %ax,%ax
+ 58e:	66 90                	xchg   %ax,%ax
+
+00000590 <printint>:
+  write(fd, &c, 1);
+}
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 590:	55                   	push   %ebp
+ 591:	89 e5                	mov    %esp,%ebp
+ 593:	57                   	push   %edi
+ 594:	56                   	push   %esi
+ 595:	53                   	push   %ebx
+ 596:	89 cb                	mov    %ecx,%ebx
+  uint x;
+
+  neg = 0;
+  if(sgn && xx < 0){
+    neg = 1;
+    x = -xx;
+ 598:	89 d1                	mov    %edx,%ecx
+{
+ 59a:	83 ec 3c             	sub    $0x3c,%esp
+ 59d:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  if(sgn && xx < 0){
+ 5a0:	85 d2                	test   %edx,%edx
+ 5a2:	0f 89 80 00 00 00    	jns    628 <printint+0x98>
+ 5a8:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+ 5ac:	74 7a                	je     628 <printint+0x98>
+    x = -xx;
+ 5ae:	f7 d9                	neg    %ecx
+    neg = 1;
+ 5b0:	b8 01 00 00 00       	mov    $0x1,%eax
+  } else {
+    x = xx;
+  }
+
+  i = 0;
+ 5b5:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+ 5b8:	31 f6                	xor    %esi,%esi
+ 5ba:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  do{
+    buf[i++] = digits[x % base];
+ 5c0:	89 c8                	mov    %ecx,%eax
+ 5c2:	31 d2                	xor    %edx,%edx
+ 5c4:	89 f7                	mov    %esi,%edi
+ 5c6:	f7 f3                	div    %ebx
+ 5c8:	8d 76 01             	lea    0x1(%esi),%esi
+ 5cb:	0f b6 92 78 0b 00 00 	movzbl 0xb78(%edx),%edx
+ 5d2:	88 54 35 d7          	mov    %dl,-0x29(%ebp,%esi,1)
+  }while((x /= base) != 0);
+ 5d6:	89 ca                	mov    %ecx,%edx
+ 5d8:	89 c1                	mov    %eax,%ecx
+ 5da:	39 da                	cmp    %ebx,%edx
+ 5dc:	73 e2                	jae    5c0 <printint+0x30>
+  if(neg)
+ 5de:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+ 5e1:	85 c0                	test   %eax,%eax
+ 5e3:	74 07                	je     5ec <printint+0x5c>
+    buf[i++] = '-';
+ 5e5:	c6 44 35 d8 2d       	movb   $0x2d,-0x28(%ebp,%esi,1)
+    buf[i++] = digits[x % base];
+ 5ea:	89 f7                	mov    %esi,%edi
+ 5ec:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+ 5ef:	8b 75 c0             	mov    -0x40(%ebp),%esi
+ 5f2:	01 df                	add    %ebx,%edi
+ 5f4:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+  while(--i >= 0)
+    putc(fd, buf[i]);
+ 5f8:	0f b6 07             	movzbl (%edi),%eax
+  write(fd, &c, 1);
+ 5fb:	83 ec 04             	sub    $0x4,%esp
+ 5fe:	88 45 d7             	mov    %al,-0x29(%ebp)
+ 601:	8d 45 d7             	lea    -0x29(%ebp),%eax
+ 604:	6a 01                	push   $0x1
+ 606:	50                   	push   %eax
+ 607:	56                   	push   %esi
+ 608:	e8 37 fe ff ff       	call   444 <write>
+  while(--i >= 0)
+ 60d:	89 f8                	mov    %edi,%eax
+ 60f:	83 c4 10             	add    $0x10,%esp
+ 612:	83 ef 01             	sub    $0x1,%edi
+ 615:	39 d8                	cmp    %ebx,%eax
+ 617:	75 df                	jne    5f8 <printint+0x68>
+}
+ 619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 61c:	5b                   	pop    %ebx
+ 61d:	5e                   	pop    %esi
+ 61e:	5f                   	pop    %edi
+ 61f:	5d                   	pop    %ebp
+ 620:	c3                   	ret
+ 621:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+  neg = 0;
+ 628:	31 c0                	xor    %eax,%eax
+ 62a:	eb 89                	jmp    5b5 <printint+0x25>
+ 62c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+
+00000630 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, const char *fmt, ...)
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	57                   	push   %edi
+ 634:	56                   	push   %esi
+ 635:	53                   	push   %ebx
+ 636:	83 ec 2c             	sub    $0x2c,%esp
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+  ap = (uint*)(void*)&fmt + 1;
+  for(i = 0; fmt[i]; i++){
+ 639:	8b 75 0c             	mov    0xc(%ebp),%esi
+{
+ 63c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  for(i = 0; fmt[i]; i++){
+ 63f:	0f b6 1e             	movzbl (%esi),%ebx
+ 642:	83 c6 01             	add    $0x1,%esi
+ 645:	84 db                	test   %bl,%bl
+ 647:	74 67                	je     6b0 <printf+0x80>
+ 649:	8d 4d 10             	lea    0x10(%ebp),%ecx
+ 64c:	31 d2                	xor    %edx,%edx
+ 64e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+ 651:	eb 34                	jmp    687 <printf+0x57>
+ 653:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 657:	90                   	nop
+ 658:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    c = fmt[i] & 0xff;
+    if(state == 0){
+      if(c == '%'){
+        state = '%';
+ 65b:	ba 25 00 00 00       	mov    $0x25,%edx
+      if(c == '%'){
+ 660:	83 f8 25             	cmp    $0x25,%eax
+ 663:	74 18                	je     67d <printf+0x4d>
+  write(fd, &c, 1);
+ 665:	83 ec 04             	sub    $0x4,%esp
+ 668:	8d 45 e7             	lea    -0x19(%ebp),%eax
+ 66b:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 66e:	6a 01                	push   $0x1
+ 670:	50                   	push   %eax
+ 671:	57                   	push   %edi
+ 672:	e8 cd fd ff ff       	call   444 <write>
+ 677:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+      } else {
+        putc(fd, c);
+ 67a:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; fmt[i]; i++){
+ 67d:	0f b6 1e             	movzbl (%esi),%ebx
+ 680:	83 c6 01             	add    $0x1,%esi
+ 683:	84 db                	test   %bl,%bl
+ 685:	74 29                	je     6b0 <printf+0x80>
+    c = fmt[i] & 0xff;
+ 687:	0f b6 c3             	movzbl %bl,%eax
+    if(state == 0){
+ 68a:	85 d2                	test   %edx,%edx
+ 68c:	74 ca                	je     658 <printf+0x28>
+      }
+    } else if(state == '%'){
+ 68e:	83 fa 25             	cmp    $0x25,%edx
+ 691:	75 ea                	jne    67d <printf+0x4d>
+      if(c == 'd'){
+ 693:	83 f8 25             	cmp    $0x25,%eax
+ 696:	0f 84 24 01 00 00    	je     7c0 <printf+0x190>
+ 69c:	83 e8 63             	sub    $0x63,%eax
+ 69f:	83 f8 15             	cmp    $0x15,%eax
+ 6a2:	77 1c                	ja     6c0 <printf+0x90>
+ 6a4:	ff 24 85 20 0b 00 00 	jmp    *0xb20(,%eax,4)
+ 6ab:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ 6af:	90                   	nop
+        putc(fd, c);
+      }
+      state = 0;
+    }
+  }
+}
+ 6b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 6b3:	5b                   	pop    %ebx
+ 6b4:	5e                   	pop    %esi
+ 6b5:	5f                   	pop    %edi
+ 6b6:	5d                   	pop    %ebp
+ 6b7:	c3                   	ret
+ 6b8:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 6bf:	90                   	nop
+  write(fd, &c, 1);
+ 6c0:	83 ec 04             	sub    $0x4,%esp
+ 6c3:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 6c6:	c6 45 e7 25          	movb   $0x25,-0x19(%ebp)
+ 6ca:	6a 01                	push   $0x1
+ 6cc:	52                   	push   %edx
+ 6cd:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+ 6d0:	57                   	push   %edi
+ 6d1:	e8 6e fd ff ff       	call   444 <write>
+ 6d6:	83 c4 0c             	add    $0xc,%esp
+ 6d9:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 6dc:	6a 01                	push   $0x1
+ 6de:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+ 6e1:	52                   	push   %edx
+ 6e2:	57                   	push   %edi
+ 6e3:	e8 5c fd ff ff       	call   444 <write>
+        putc(fd, c);
+ 6e8:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 6eb:	31 d2                	xor    %edx,%edx
+ 6ed:	eb 8e                	jmp    67d <printf+0x4d>
+ 6ef:	90                   	nop
+        printint(fd, *ap, 16, 0);
+ 6f0:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 6f3:	83 ec 0c             	sub    $0xc,%esp
+ 6f6:	b9 10 00 00 00       	mov    $0x10,%ecx
+ 6fb:	8b 13                	mov    (%ebx),%edx
+ 6fd:	6a 00                	push   $0x0
+ 6ff:	89 f8                	mov    %edi,%eax
+        ap++;
+ 701:	83 c3 04             	add    $0x4,%ebx
+        printint(fd, *ap, 16, 0);
+ 704:	e8 87 fe ff ff       	call   590 <printint>
+        ap++;
+ 709:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 70c:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 70f:	31 d2                	xor    %edx,%edx
+ 711:	e9 67 ff ff ff       	jmp    67d <printf+0x4d>
+ 716:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 71d:	8d 76 00             	lea    0x0(%esi),%esi
+        s = (char*)*ap;
+ 720:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 723:	8b 18                	mov    (%eax),%ebx
+        ap++;
+ 725:	83 c0 04             	add    $0x4,%eax
+ 728:	89 45 d0             	mov    %eax,-0x30(%ebp)
+        if(s == 0)
+ 72b:	85 db                	test   %ebx,%ebx
+ 72d:	0f 84 9d 00 00 00    	je     7d0 <printf+0x1a0>
+        while(*s != 0){
+ 733:	0f b6 03             	movzbl (%ebx),%eax
+      state = 0;
+ 736:	31 d2                	xor    %edx,%edx
+        while(*s != 0){
+ 738:	84 c0                	test   %al,%al
+ 73a:	0f 84 3d ff ff ff    	je     67d <printf+0x4d>
+ 740:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 743:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+ 746:	89 de                	mov    %ebx,%esi
+ 748:	89 d3                	mov    %edx,%ebx
+ 74a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  write(fd, &c, 1);
+ 750:	83 ec 04             	sub    $0x4,%esp
+ 753:	88 45 e7             	mov    %al,-0x19(%ebp)
+          s++;
+ 756:	83 c6 01             	add    $0x1,%esi
+  write(fd, &c, 1);
+ 759:	6a 01                	push   $0x1
+ 75b:	53                   	push   %ebx
+ 75c:	57                   	push   %edi
+ 75d:	e8 e2 fc ff ff       	call   444 <write>
+        while(*s != 0){
+ 762:	0f b6 06             	movzbl (%esi),%eax
+ 765:	83 c4 10             	add    $0x10,%esp
+ 768:	84 c0                	test   %al,%al
+ 76a:	75 e4                	jne    750 <printf+0x120>
+      state = 0;
+ 76c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 76f:	31 d2                	xor    %edx,%edx
+ 771:	e9 07 ff ff ff       	jmp    67d <printf+0x4d>
+ 776:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 77d:	8d 76 00             	lea    0x0(%esi),%esi
+        printint(fd, *ap, 10, 1);
+ 780:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+ 783:	83 ec 0c             	sub    $0xc,%esp
+ 786:	b9 0a 00 00 00       	mov    $0xa,%ecx
+ 78b:	8b 13                	mov    (%ebx),%edx
+ 78d:	6a 01                	push   $0x1
+ 78f:	e9 6b ff ff ff       	jmp    6ff <printf+0xcf>
+ 794:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+        putc(fd, *ap);
+ 798:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  write(fd, &c, 1);
+ 79b:	83 ec 04             	sub    $0x4,%esp
+ 79e:	8d 55 e7             	lea    -0x19(%ebp),%edx
+        putc(fd, *ap);
+ 7a1:	8b 03                	mov    (%ebx),%eax
+        ap++;
+ 7a3:	83 c3 04             	add    $0x4,%ebx
+        putc(fd, *ap);
+ 7a6:	88 45 e7             	mov    %al,-0x19(%ebp)
+  write(fd, &c, 1);
+ 7a9:	6a 01                	push   $0x1
+ 7ab:	52                   	push   %edx
+ 7ac:	57                   	push   %edi
+ 7ad:	e8 92 fc ff ff       	call   444 <write>
+        ap++;
+ 7b2:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+ 7b5:	83 c4 10             	add    $0x10,%esp
+      state = 0;
+ 7b8:	31 d2                	xor    %edx,%edx
+ 7ba:	e9 be fe ff ff       	jmp    67d <printf+0x4d>
+ 7bf:	90                   	nop
+  write(fd, &c, 1);
+ 7c0:	83 ec 04             	sub    $0x4,%esp
+ 7c3:	88 5d e7             	mov    %bl,-0x19(%ebp)
+ 7c6:	8d 55 e7             	lea    -0x19(%ebp),%edx
+ 7c9:	6a 01                	push   $0x1
+ 7cb:	e9 11 ff ff ff       	jmp    6e1 <printf+0xb1>
+ 7d0:	b8 28 00 00 00       	mov    $0x28,%eax
+          s = "(null)";
+ 7d5:	bb 18 0b 00 00       	mov    $0xb18,%ebx
+ 7da:	e9 61 ff ff ff       	jmp    740 <printf+0x110>
+ 7df:	90                   	nop
+
+000007e0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 7e0:	55                   	push   %ebp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7e1:	a1 00 10 00 00       	mov    0x1000,%eax
+{
+ 7e6:	89 e5                	mov    %esp,%ebp
+ 7e8:	57                   	push   %edi
+ 7e9:	56                   	push   %esi
+ 7ea:	53                   	push   %ebx
+ 7eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bp = (Header*)ap - 1;
+ 7ee:	8d 4b f8             	lea    -0x8(%ebx),%ecx
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7f1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 7f8:	89 c2                	mov    %eax,%edx
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 7fa:	8b 00                	mov    (%eax),%eax
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 7fc:	39 ca                	cmp    %ecx,%edx
+ 7fe:	73 30                	jae    830 <free+0x50>
+ 800:	39 c1                	cmp    %eax,%ecx
+ 802:	72 04                	jb     808 <free+0x28>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 804:	39 c2                	cmp    %eax,%edx
+ 806:	72 f0                	jb     7f8 <free+0x18>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ 808:	8b 73 fc             	mov    -0x4(%ebx),%esi
+ 80b:	8d 3c f1             	lea    (%ecx,%esi,8),%edi
+ 80e:	39 f8                	cmp    %edi,%eax
+ 810:	74 2e                	je     840 <free+0x60>
+    bp->s.size += p->s.ptr->s.size;
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 812:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  } else
+    bp->s.ptr = p->s.ptr;
+  if(p + p->s.size == bp){
+ 815:	8b 42 04             	mov    0x4(%edx),%eax
+ 818:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 81b:	39 f1                	cmp    %esi,%ecx
+ 81d:	74 38                	je     857 <free+0x77>
+    p->s.size += bp->s.size;
+    p->s.ptr = bp->s.ptr;
+ 81f:	89 0a                	mov    %ecx,(%edx)
+  } else
+    p->s.ptr = bp;
+  freep = p;
+}
+ 821:	5b                   	pop    %ebx
+  freep = p;
+ 822:	89 15 00 10 00 00    	mov    %edx,0x1000
+}
+ 828:	5e                   	pop    %esi
+ 829:	5f                   	pop    %edi
+ 82a:	5d                   	pop    %ebp
+ 82b:	c3                   	ret
+ 82c:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 830:	39 c1                	cmp    %eax,%ecx
+ 832:	72 d0                	jb     804 <free+0x24>
+ 834:	eb c2                	jmp    7f8 <free+0x18>
+ 836:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 83d:	8d 76 00             	lea    0x0(%esi),%esi
+    bp->s.size += p->s.ptr->s.size;
+ 840:	03 70 04             	add    0x4(%eax),%esi
+ 843:	89 73 fc             	mov    %esi,-0x4(%ebx)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ 846:	8b 02                	mov    (%edx),%eax
+ 848:	8b 00                	mov    (%eax),%eax
+ 84a:	89 43 f8             	mov    %eax,-0x8(%ebx)
+  if(p + p->s.size == bp){
+ 84d:	8b 42 04             	mov    0x4(%edx),%eax
+ 850:	8d 34 c2             	lea    (%edx,%eax,8),%esi
+ 853:	39 f1                	cmp    %esi,%ecx
+ 855:	75 c8                	jne    81f <free+0x3f>
+    p->s.size += bp->s.size;
+ 857:	03 43 fc             	add    -0x4(%ebx),%eax
+  freep = p;
+ 85a:	89 15 00 10 00 00    	mov    %edx,0x1000
+    p->s.size += bp->s.size;
+ 860:	89 42 04             	mov    %eax,0x4(%edx)
+    p->s.ptr = bp->s.ptr;
+ 863:	8b 4b f8             	mov    -0x8(%ebx),%ecx
+ 866:	89 0a                	mov    %ecx,(%edx)
+}
+ 868:	5b                   	pop    %ebx
+ 869:	5e                   	pop    %esi
+ 86a:	5f                   	pop    %edi
+ 86b:	5d                   	pop    %ebp
+ 86c:	c3                   	ret
+ 86d:	8d 76 00             	lea    0x0(%esi),%esi
+
+00000870 <malloc>:
+  return freep;
+}
+
+void*
+malloc(uint nbytes)
+{
+ 870:	55                   	push   %ebp
+ 871:	89 e5                	mov    %esp,%ebp
+ 873:	57                   	push   %edi
+ 874:	56                   	push   %esi
+ 875:	53                   	push   %ebx
+ 876:	83 ec 0c             	sub    $0xc,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 879:	8b 45 08             	mov    0x8(%ebp),%eax
+  if((prevp = freep) == 0){
+ 87c:	8b 15 00 10 00 00    	mov    0x1000,%edx
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ 882:	8d 78 07             	lea    0x7(%eax),%edi
+ 885:	c1 ef 03             	shr    $0x3,%edi
+ 888:	83 c7 01             	add    $0x1,%edi
+  if((prevp = freep) == 0){
+ 88b:	85 d2                	test   %edx,%edx
+ 88d:	0f 84 8d 00 00 00    	je     920 <malloc+0xb0>
+    base.s.ptr = freep = prevp = &base;
+    base.s.size = 0;
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 893:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 895:	8b 48 04             	mov    0x4(%eax),%ecx
+ 898:	39 f9                	cmp    %edi,%ecx
+ 89a:	73 64                	jae    900 <malloc+0x90>
+  if(nu < 4096)
+ 89c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+ 8a1:	39 df                	cmp    %ebx,%edi
+ 8a3:	0f 43 df             	cmovae %edi,%ebx
+  p = sbrk(nu * sizeof(Header));
+ 8a6:	8d 34 dd 00 00 00 00 	lea    0x0(,%ebx,8),%esi
+ 8ad:	eb 0a                	jmp    8b9 <malloc+0x49>
+ 8af:	90                   	nop
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ 8b0:	8b 02                	mov    (%edx),%eax
+    if(p->s.size >= nunits){
+ 8b2:	8b 48 04             	mov    0x4(%eax),%ecx
+ 8b5:	39 f9                	cmp    %edi,%ecx
+ 8b7:	73 47                	jae    900 <malloc+0x90>
+        p->s.size = nunits;
+      }
+      freep = prevp;
+      return (void*)(p + 1);
+    }
+    if(p == freep)
+ 8b9:	89 c2                	mov    %eax,%edx
+ 8bb:	39 05 00 10 00 00    	cmp    %eax,0x1000
+ 8c1:	75 ed                	jne    8b0 <malloc+0x40>
+  p = sbrk(nu * sizeof(Header));
+ 8c3:	83 ec 0c             	sub    $0xc,%esp
+ 8c6:	56                   	push   %esi
+ 8c7:	e8 e0 fb ff ff       	call   4ac <sbrk>
+  if(p == (char*)-1)
+ 8cc:	83 c4 10             	add    $0x10,%esp
+ 8cf:	83 f8 ff             	cmp    $0xffffffff,%eax
+ 8d2:	74 1c                	je     8f0 <malloc+0x80>
+  hp->s.size = nu;
+ 8d4:	89 58 04             	mov    %ebx,0x4(%eax)
+  free((void*)(hp + 1));
+ 8d7:	83 ec 0c             	sub    $0xc,%esp
+ 8da:	83 c0 08             	add    $0x8,%eax
+ 8dd:	50                   	push   %eax
+ 8de:	e8 fd fe ff ff       	call   7e0 <free>
+  return freep;
+ 8e3:	8b 15 00 10 00 00    	mov    0x1000,%edx
+      if((p = morecore(nunits)) == 0)
+ 8e9:	83 c4 10             	add    $0x10,%esp
+ 8ec:	85 d2                	test   %edx,%edx
+ 8ee:	75 c0                	jne    8b0 <malloc+0x40>
+        return 0;
+  }
+}
+ 8f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+        return 0;
+ 8f3:	31 c0                	xor    %eax,%eax
+}
+ 8f5:	5b                   	pop    %ebx
+ 8f6:	5e                   	pop    %esi
+ 8f7:	5f                   	pop    %edi
+ 8f8:	5d                   	pop    %ebp
+ 8f9:	c3                   	ret
+ 8fa:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+      if(p->s.size == nunits)
+ 900:	39 cf                	cmp    %ecx,%edi
+ 902:	74 4c                	je     950 <malloc+0xe0>
+        p->s.size -= nunits;
+ 904:	29 f9                	sub    %edi,%ecx
+ 906:	89 48 04             	mov    %ecx,0x4(%eax)
+        p += p->s.size;
+ 909:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+        p->s.size = nunits;
+ 90c:	89 78 04             	mov    %edi,0x4(%eax)
+      freep = prevp;
+ 90f:	89 15 00 10 00 00    	mov    %edx,0x1000
+}
+ 915:	8d 65 f4             	lea    -0xc(%ebp),%esp
+      return (void*)(p + 1);
+ 918:	83 c0 08             	add    $0x8,%eax
+}
+ 91b:	5b                   	pop    %ebx
+ 91c:	5e                   	pop    %esi
+ 91d:	5f                   	pop    %edi
+ 91e:	5d                   	pop    %ebp
+ 91f:	c3                   	ret
+    base.s.ptr = freep = prevp = &base;
+ 920:	c7 05 00 10 00 00 04 	movl   $0x1004,0x1000
+ 927:	10 00 00 
+    base.s.size = 0;
+ 92a:	b8 04 10 00 00       	mov    $0x1004,%eax
+    base.s.ptr = freep = prevp = &base;
+ 92f:	c7 05 04 10 00 00 04 	movl   $0x1004,0x1004
+ 936:	10 00 00 
+    base.s.size = 0;
+ 939:	c7 05 08 10 00 00 00 	movl   $0x0,0x1008
+ 940:	00 00 00 
+    if(p->s.size >= nunits){
+ 943:	e9 54 ff ff ff       	jmp    89c <malloc+0x2c>
+ 948:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ 94f:	90                   	nop
+        prevp->s.ptr = p->s.ptr;
+ 950:	8b 08                	mov    (%eax),%ecx
+ 952:	89 0a                	mov    %ecx,(%edx)
+ 954:	eb b9                	jmp    90f <malloc+0x9f>
+ 956:	66 90                	xchg   %ax,%ax
+ 958:	66 90                	xchg   %ax,%ax
+ 95a:	66 90                	xchg   %ax,%ax
+ 95c:	66 90                	xchg   %ax,%ax
+ 95e:	66 90                	xchg   %ax,%ax
+
+00000960 <threadstart>:
+static lock_t threadslock;     // Also keeps malloc single-threaded here
+
+// Every thread starts here, so that returning from fn exits.
+static void
+threadstart(void *t)
+{
+ 960:	55                   	push   %ebp
+ 961:	89 e5                	mov    %esp,%ebp
+ 963:	83 ec 14             	sub    $0x14,%esp
+  int i = (int)t;
+
+  threads[i].fn(threads[i].arg);
+ 966:	8b 45 08             	mov    0x8(%ebp),%eax
+ 969:	c1 e0 04             	shl    $0x4,%eax
+ 96c:	ff b0 4c 10 00 00    	push   0x104c(%eax)
+ 972:	05 40 10 00 00       	add    $0x1040,%eax
+ 977:	ff 50 08             	call   *0x8(%eax)
+  exit();
+ 97a:	e8 a5 fa ff ff       	call   424 <exit>
+ 97f:	90                   	nop
+
+00000980 <thread_create>:
+}
+
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ 980:	55                   	push   %ebp
+ 981:	89 e5                	mov    %esp,%ebp
+ 983:	57                   	push   %edi
+ 984:	56                   	push   %esi
+ 985:	53                   	push   %ebx
+  int i, pid;
+  char *block;
+
+  lock_acquire(&threadslock);
+  for(i = 0; i < MAXTHREADS; i++)
+ 986:	31 db                	xor    %ebx,%ebx
+{
+ 988:	83 ec 28             	sub    $0x28,%esp
+  lock_acquire(&threadslock);
+ 98b:	68 20 10 00 00       	push   $0x1020
+ 990:	e8 eb f8 ff ff       	call   280 <lock_acquire>
+ 995:	83 c4 10             	add    $0x10,%esp
+ 998:	eb 12                	jmp    9ac <thread_create+0x2c>
+ 99a:	8d b6 00 00 00 00    	lea    0x0(%esi),%esi
+  for(i = 0; i < MAXTHREADS; i++)
+ 9a0:	83 c3 01             	add    $0x1,%ebx
+ 9a3:	83 fb 40             	cmp    $0x40,%ebx
+ 9a6:	0f 84 c4 00 00 00    	je     a70 <thread_create+0xf0>
+    if(threads[i].stack == 0)
+ 9ac:	89 de                	mov    %ebx,%esi
+ 9ae:	c1 e6 04             	shl    $0x4,%esi
+ 9b1:	8b 96 40 10 00 00    	mov    0x1040(%esi),%edx
+ 9b7:	85 d2                	test   %edx,%edx
+ 9b9:	75 e5                	jne    9a0 <thread_create+0x20>
+      break;
+  if(i == MAXTHREADS || (block = malloc(2*TSTACKSIZE)) == 0){
+ 9bb:	83 ec 0c             	sub    $0xc,%esp
+ 9be:	68 00 20 00 00       	push   $0x2000
+ 9c3:	e8 a8 fe ff ff       	call   870 <malloc>
+ 9c8:	83 c4 10             	add    $0x10,%esp
+ 9cb:	85 c0                	test   %eax,%eax
+ 9cd:	0f 84 9d 00 00 00    	je     a70 <thread_create+0xf0>
+    lock_release(&threadslock);
+    return -1;
+  }
+  threads[i].block = block;
+ 9d3:	89 86 44 10 00 00    	mov    %eax,0x1044(%esi)
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ 9d9:	05 ff 0f 00 00       	add    $0xfff,%eax
+  threads[i].fn = fn;
+  threads[i].arg = arg;
+  lock_release(&threadslock);
+ 9de:	83 ec 0c             	sub    $0xc,%esp
+  threads[i].stack = (void*)(((uint)block + TSTACKSIZE-1) & ~(TSTACKSIZE-1));
+ 9e1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+ 9e6:	89 86 40 10 00 00    	mov    %eax,0x1040(%esi)
+  threads[i].fn = fn;
+ 9ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ef:	89 86 48 10 00 00    	mov    %eax,0x1048(%esi)
+  threads[i].arg = arg;
+ 9f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9f8:	89 86 4c 10 00 00    	mov    %eax,0x104c(%esi)
+  lock_release(&threadslock);
+ 9fe:	68 20 10 00 00       	push   $0x1020
+ a03:	e8 98 f8 ff ff       	call   2a0 <lock_release>
+
+  if((pid = clone(threadstart, (void*)i, threads[i].stack)) < 0){
+ a08:	83 c4 0c             	add    $0xc,%esp
+ a0b:	ff b6 40 10 00 00    	push   0x1040(%esi)
+ a11:	53                   	push   %ebx
+ a12:	68 60 09 00 00       	push   $0x960
+ a17:	e8 10 fb ff ff       	call   52c <clone>
+ a1c:	83 c4 10             	add    $0x10,%esp
+ a1f:	85 c0                	test   %eax,%eax
+ a21:	78 0d                	js     a30 <thread_create+0xb0>
+    free(threads[i].block);
+    threads[i].stack = 0;
+    lock_release(&threadslock);
+  }
+  return pid;
+}
+ a23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a26:	5b                   	pop    %ebx
+ a27:	5e                   	pop    %esi
+ a28:	5f                   	pop    %edi
+ a29:	5d                   	pop    %ebp
+ a2a:	c3                   	ret
+ a2b:	8d 74 26 00          	lea    0x0(%esi,%eiz,1),%esi
+ a2f:	90                   	nop
+    lock_acquire(&threadslock);
+ a30:	83 ec 0c             	sub    $0xc,%esp
+ a33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ a36:	68 20 10 00 00       	push   $0x1020
+ a3b:	e8 40 f8 ff ff       	call   280 <lock_acquire>
+    free(threads[i].block);
+ a40:	58                   	pop    %eax
+ a41:	ff b6 44 10 00 00    	push   0x1044(%esi)
+ a47:	e8 94 fd ff ff       	call   7e0 <free>
+    threads[i].stack = 0;
+ a4c:	c7 86 40 10 00 00 00 	movl   $0x0,0x1040(%esi)
+ a53:	00 00 00 
+    lock_release(&threadslock);
+ a56:	c7 04 24 20 10 00 00 	movl   $0x1020,(%esp)
+ a5d:	e8 3e f8 ff ff       	call   2a0 <lock_release>
+ a62:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a65:	83 c4 10             	add    $0x10,%esp
+}
+ a68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ a6b:	5b                   	pop    %ebx
+ a6c:	5e                   	pop    %esi
+ a6d:	5f                   	pop    %edi
+ a6e:	5d                   	pop    %ebp
+ a6f:	c3                   	ret
+    lock_release(&threadslock);
+ a70:	83 ec 0c             	sub    $0xc,%esp
+ a73:	68 20 10 00 00       	push   $0x1020
+ a78:	e8 23 f8 ff ff       	call   2a0 <lock_release>
+    return -1;
+ a7d:	83 c4 10             	add    $0x10,%esp
+ a80:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ a85:	eb 9c                	jmp    a23 <thread_create+0xa3>
+ a87:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ a8e:	66 90                	xchg   %ax,%ax
+
+00000a90 <thread_join>:
+
+int
+thread_join(void)
+{
+ a90:	55                   	push   %ebp
+ a91:	89 e5                	mov    %esp,%ebp
+ a93:	56                   	push   %esi
+ a94:	53                   	push   %ebx
+  int i, pid;
+  void *stack;
+
+  if((pid = join(&stack)) < 0)
+ a95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+{
+ a98:	83 ec 1c             	sub    $0x1c,%esp
+  if((pid = join(&stack)) < 0)
+ a9b:	50                   	push   %eax
+ a9c:	e8 93 fa ff ff       	call   534 <join>
+ aa1:	83 c4 10             	add    $0x10,%esp
+ aa4:	85 c0                	test   %eax,%eax
+ aa6:	78 69                	js     b11 <thread_join+0x81>
+    return -1;
+  lock_acquire(&threadslock);
+ aa8:	83 ec 0c             	sub    $0xc,%esp
+ aab:	89 c6                	mov    %eax,%esi
+ aad:	68 20 10 00 00       	push   $0x1020
+ ab2:	e8 c9 f7 ff ff       	call   280 <lock_acquire>
+  for(i = 0; i < MAXTHREADS; i++){
+    if(threads[i].stack == stack){
+ ab7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ aba:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < MAXTHREADS; i++){
+ abd:	31 c0                	xor    %eax,%eax
+ abf:	eb 0f                	jmp    ad0 <thread_join+0x40>
+ ac1:	8d b4 26 00 00 00 00 	lea    0x0(%esi,%eiz,1),%esi
+ ac8:	83 c0 01             	add    $0x1,%eax
+ acb:	83 f8 40             	cmp    $0x40,%eax
+ ace:	74 28                	je     af8 <thread_join+0x68>
+    if(threads[i].stack == stack){
+ ad0:	89 c3                	mov    %eax,%ebx
+ ad2:	c1 e3 04             	shl    $0x4,%ebx
+ ad5:	39 93 40 10 00 00    	cmp    %edx,0x1040(%ebx)
+ adb:	75 eb                	jne    ac8 <thread_join+0x38>
+      free(threads[i].block);
+ add:	83 ec 0c             	sub    $0xc,%esp
+ ae0:	ff b3 44 10 00 00    	push   0x1044(%ebx)
+ ae6:	e8 f5 fc ff ff       	call   7e0 <free>
+      threads[i].stack = 0;
+      break;
+ aeb:	83 c4 10             	add    $0x10,%esp
+      threads[i].stack = 0;
+ aee:	c7 83 40 10 00 00 00 	movl   $0x0,0x1040(%ebx)
+ af5:	00 00 00 
+    }
+  }
+  lock_release(&threadslock);
+ af8:	83 ec 0c             	sub    $0xc,%esp
+ afb:	68 20 10 00 00       	push   $0x1020
+ b00:	e8 9b f7 ff ff       	call   2a0 <lock_release>
+  return pid;
+ b05:	83 c4 10             	add    $0x10,%esp
+}
+ b08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+ b0b:	89 f0                	mov    %esi,%eax
+ b0d:	5b                   	pop    %ebx
+ b0e:	5e                   	pop    %esi
+ b0f:	5d                   	pop    %ebp
+ b10:	c3                   	ret
+    return -1;
+ b11:	be ff ff ff ff       	mov    $0xffffffff,%esi
+ b16:	eb f0                	jmp    b08 <thread_join+0x78>